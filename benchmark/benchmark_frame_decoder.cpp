@@ -0,0 +1,486 @@
+/*!
+ * @file    benchmark_frame_decoder.cpp
+ * @brief   Benchmarks of the policy-templated frame decoder: each static
+ *          checksum/resync/sink combination against the same decoder
+ *          configured at run time. Same table, options and JSON as
+ *          benchmark_lin_pid.c, so benchmark_compare.py reads both.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+#include "lin_pid.h"
+#include "lin_frame_decoder.hpp"
+
+/* Local Macro Definitions */
+#define NS_PER_SEC                  1000000000.0
+#define DEFAULT_NUM_OF_ROUNDS       7u
+#define SAMPLES_PER_ROUND           1000u
+#define TARGET_SAMPLE_DURATION_NS   2000.0   // Each timed sample should last roughly this long
+#define MAX_ITERATIONS_PER_SAMPLE   (1u << 20)
+#define JSON_SCHEMA_VERSION         1
+#define STREAM_LEN                  (64u * 1024u)
+#define STREAM_READ_LEN             256u     // What a pty read() hands over at a time
+
+/* Datatypes */
+
+struct BenchmarkScenario_S
+{
+   const char * name;
+   const char * description;
+   size_t tokens_per_op;   // How many bytes a single op decodes (for tokens/s)
+   void (*run)(size_t iterations);
+};
+
+struct BenchmarkResult_S
+{
+   double ns_per_op;       // Mean over every timed iteration of every round
+   double p50_ns;          // Median across rounds of each round's p50
+   double p99_ns;          // Median across rounds of each round's p99
+   double tokens_per_sec;
+   double p50_spread_pct;  // (max - min) / median of the per-round p50s: the noise estimate
+   size_t iterations_per_sample;
+   size_t rounds;
+};
+
+// What a specialized pipeline does with a frame, inlined into the decoder
+struct CountingSink
+{
+   size_t frames;
+   uint8_t acc;
+
+   void operator()( const CAP_Frame_S & frame )
+   {
+      frames++;
+      acc = static_cast<uint8_t>( acc ^ frame.checksum ^ frame.flags );
+   }
+};
+
+/* Local Data */
+
+// Built on first use by BuildStream()
+static std::vector<uint8_t> Stream;
+
+// Set in main() so the compiler can't fold the runtime decoder's
+// configuration back into constants
+static LOG_Checksum_E RuntimeModel;
+static bool RuntimeStrict[2];          // Indexed by the scenario's own strictness
+static void (*RuntimeOnFrame)( const CAP_Frame_S * frame, void * ctx );
+
+// Keeps the optimizer from discarding the work under benchmark
+static volatile uint8_t Sink;
+
+/* Private Function Prototypes */
+
+static void Run_Runtime_Lenient(size_t iterations);
+static void Run_Runtime_Strict(size_t iterations);
+static void Run_LIN2_Lenient(size_t iterations);
+static void Run_LIN2_Strict(size_t iterations);
+static void Run_Classic_Strict(size_t iterations);
+template <typename ChecksumPolicy, typename ResyncPolicy>
+static void RunStatic(size_t iterations);
+static void RunRuntime( bool strict, size_t iterations );
+template <typename Decoder>
+static void FeedStream( Decoder & decoder );
+
+static void BuildStream(void);
+static void CountFrame( const CAP_Frame_S * frame, void * ctx );
+
+static double NowNs(void);
+static int DoubleCmp( const void * a, const void * b );
+static double Percentile( double * sorted, size_t n, double pct );
+static size_t CalibrateIterations( const struct BenchmarkScenario_S * scenario );
+static void RunScenario( const struct BenchmarkScenario_S * scenario,
+                         size_t rounds,
+                         struct BenchmarkResult_S * result );
+static bool WriteJSON( const char * path,
+                       const struct BenchmarkResult_S * results,
+                       const bool * ran );
+static void PrintUsage(const char * prog);
+
+/* Scenario Table */
+
+static const struct BenchmarkScenario_S Scenarios[] =
+{
+   { "decode_runtime",        "RuntimeFrameDecoder, LIN 2 + lenient, callback sink, of a 64 KiB pty stream (tokens = bytes)", STREAM_LEN, Run_Runtime_Lenient },
+   { "decode_runtime_strict", "Same, strict resync (tokens = bytes)",                STREAM_LEN, Run_Runtime_Strict },
+   { "decode_lin2_lenient",   "FrameDecoder<Lin2Checksum, LenientResync> (tokens = bytes)", STREAM_LEN, Run_LIN2_Lenient },
+   { "decode_lin2_strict",    "FrameDecoder<Lin2Checksum, StrictResync> (tokens = bytes)", STREAM_LEN, Run_LIN2_Strict },
+   { "decode_classic_strict", "FrameDecoder<ClassicChecksum, StrictResync> (tokens = bytes)", STREAM_LEN, Run_Classic_Strict },
+};
+#define NUM_OF_SCENARIOS   ( sizeof(Scenarios) / sizeof(Scenarios[0]) )
+
+/* Meat of the Program */
+
+int main( int argc, char * argv[] )
+{
+   const char * json_path = nullptr;
+   const char * only_scenario = nullptr;
+   size_t rounds = DEFAULT_NUM_OF_ROUNDS;
+
+   RuntimeModel = LOG_CHECKSUM_LIN2;
+   RuntimeStrict[0] = false;
+   RuntimeStrict[1] = true;
+   RuntimeOnFrame = CountFrame;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp(argv[i], "--json") == 0) && ((i + 1) < argc) )
+      {
+         json_path = argv[++i];
+      }
+      else if ( (strcmp(argv[i], "--scenario") == 0) && ((i + 1) < argc) )
+      {
+         only_scenario = argv[++i];
+      }
+      else if ( (strcmp(argv[i], "--rounds") == 0) && ((i + 1) < argc) )
+      {
+         long r = strtol(argv[++i], nullptr, 10);
+         if ( r <= 0 )
+         {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+         }
+         rounds = static_cast<size_t>(r);
+      }
+      else if ( strcmp(argv[i], "--list") == 0 )
+      {
+         for ( size_t s = 0; s < NUM_OF_SCENARIOS; s++ )
+         {
+            printf("%-22s %s\n", Scenarios[s].name, Scenarios[s].description);
+         }
+         return EXIT_SUCCESS;
+      }
+      else
+      {
+         PrintUsage(argv[0]);
+         return EXIT_FAILURE;
+      }
+   }
+
+   struct BenchmarkResult_S results[NUM_OF_SCENARIOS];
+   bool ran[NUM_OF_SCENARIOS] = { false };
+   bool any_ran = false;
+
+   printf("\n%-22s %12s %10s %10s %14s %8s\n",
+          "Scenario", "ns/op", "p50 (ns)", "p99 (ns)", "tokens/s", "noise");
+   printf("------------------------------------------------------------------------------\n");
+
+   for ( size_t s = 0; s < NUM_OF_SCENARIOS; s++ )
+   {
+      if ( (only_scenario != nullptr) && (strcmp(only_scenario, Scenarios[s].name) != 0) )
+      {
+         continue;
+      }
+
+      RunScenario(&Scenarios[s], rounds, &results[s]);
+      ran[s] = true;
+      any_ran = true;
+
+      printf("%-22s %12.2f %10.2f %10.2f %14.0f %7.1f%%\n",
+             Scenarios[s].name,
+             results[s].ns_per_op,
+             results[s].p50_ns,
+             results[s].p99_ns,
+             results[s].tokens_per_sec,
+             results[s].p50_spread_pct);
+   }
+   printf("\n");
+
+   if ( !any_ran )
+   {
+      fprintf(stderr, "Unknown scenario: %s\n", only_scenario);
+      return EXIT_FAILURE;
+   }
+
+   if ( (json_path != nullptr) && !WriteJSON(json_path, results, ran) )
+   {
+      fprintf(stderr, "Failed to write benchmark results to %s\n", json_path);
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+
+/* Scenarios */
+
+static void Run_Runtime_Lenient(size_t iterations)
+{
+   RunRuntime( false, iterations );
+}
+
+static void Run_Runtime_Strict(size_t iterations)
+{
+   RunRuntime( true, iterations );
+}
+
+static void Run_LIN2_Lenient(size_t iterations)
+{
+   RunStatic<lin_pid::Lin2Checksum, lin_pid::LenientResync>( iterations );
+}
+
+static void Run_LIN2_Strict(size_t iterations)
+{
+   RunStatic<lin_pid::Lin2Checksum, lin_pid::StrictResync>( iterations );
+}
+
+static void Run_Classic_Strict(size_t iterations)
+{
+   RunStatic<lin_pid::ClassicChecksum, lin_pid::StrictResync>( iterations );
+}
+
+template <typename ChecksumPolicy, typename ResyncPolicy>
+static void RunStatic(size_t iterations)
+{
+   if ( Stream.empty() )
+   {
+      BuildStream();
+   }
+
+   uint8_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      lin_pid::FrameDecoder<ChecksumPolicy, ResyncPolicy, CountingSink> decoder;
+      FeedStream( decoder );
+      acc = static_cast<uint8_t>( acc ^ decoder.sink().acc ^ decoder.sink().frames );
+   }
+   Sink = acc;
+}
+
+static void RunRuntime( bool strict, size_t iterations )
+{
+   if ( Stream.empty() )
+   {
+      BuildStream();
+   }
+
+   uint8_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      CountingSink counts {};
+      lin_pid::RuntimeFrameDecoder decoder( lin_pid::FunctionSink { RuntimeOnFrame, &counts },
+                                            lin_pid::RuntimeChecksum { RuntimeModel },
+                                            lin_pid::RuntimeResync { RuntimeStrict[strict ? 1 : 0] } );
+      FeedStream( decoder );
+      acc = static_cast<uint8_t>( acc ^ counts.acc ^ counts.frames );
+   }
+   Sink = acc;
+}
+
+// In read()-sized pieces, as off a pty
+template <typename Decoder>
+static void FeedStream( Decoder & decoder )
+{
+   for ( size_t offset = 0; offset < Stream.size(); offset += STREAM_READ_LEN )
+   {
+      size_t len = Stream.size() - offset;
+      decoder.feed( Stream.data() + offset, (len < STREAM_READ_LEN) ? len : STREAM_READ_LEN );
+   }
+   decoder.flush();
+}
+
+/* Helper Functions */
+
+/**
+ * @brief Fill Stream with frames of random IDs and lengths, about one in
+ *        sixteen with a bad PID and as many with a bad checksum.
+ */
+static void BuildStream(void)
+{
+   uint32_t x = 0x9E3779B9u;
+   Stream.reserve(STREAM_LEN);
+   while ( Stream.size() < STREAM_LEN )
+   {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      uint8_t id = static_cast<uint8_t>( x & MAX_ID_ALLOWED );
+      uint8_t pid = lin_pid::compute_pid(id);
+      uint8_t data[CAP_MAX_FRAME_LEN];
+      size_t len = 1u + ( (x >> 6) % CAP_MAX_FRAME_LEN );
+      for ( size_t i = 0; i < len; i++ )
+      {
+         data[i] = static_cast<uint8_t>( x >> (i * 3u) );
+      }
+      uint8_t checksum = lin_pid::checksum( pid, data, len, lin_pid::Lin2Checksum::enhanced(id) );
+
+      switch ( (x >> 24) & 0xFu )
+      {
+         case 0:
+            pid ^= 0x80;
+            break;
+         case 1:
+            checksum ^= 0x01;
+            break;
+         default:
+            break;
+      }
+
+      const uint8_t header[] = { 0x00, lin_pid::frame_sync_byte, pid };
+      Stream.insert( Stream.end(), header, header + sizeof(header) );
+      Stream.insert( Stream.end(), data, data + len );
+      Stream.push_back( checksum );
+   }
+   Stream.resize(STREAM_LEN);
+}
+
+static void CountFrame( const CAP_Frame_S * frame, void * ctx )
+{
+   assert( (frame != nullptr) && (ctx != nullptr) );
+   (*static_cast<CountingSink *>(ctx))( *frame );
+}
+
+static double NowNs(void)
+{
+   struct timespec ts;
+   (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (static_cast<double>(ts.tv_sec) * NS_PER_SEC) + static_cast<double>(ts.tv_nsec);
+}
+
+static int DoubleCmp( const void * a, const void * b )
+{
+   assert( (a != nullptr) && (b != nullptr) );
+
+   double c = *static_cast<const double *>(a);
+   double d = *static_cast<const double *>(b);
+
+   return (c > d) - (c < d);
+}
+
+static double Percentile( double * sorted, size_t n, double pct )
+{
+   assert( (sorted != nullptr) && (n > 0) );
+
+   size_t idx = static_cast<size_t>( (pct / 100.0) * static_cast<double>(n - 1) + 0.5 );
+   return sorted[ (idx < n) ? idx : (n - 1) ];
+}
+
+/**
+ * @brief Pick how many iterations a single timed sample should run so that
+ *        the clock's own overhead stays small relative to the measurement.
+ */
+static size_t CalibrateIterations( const struct BenchmarkScenario_S * scenario )
+{
+   size_t iterations = 1;
+   while ( iterations < MAX_ITERATIONS_PER_SAMPLE )
+   {
+      double start = NowNs();
+      scenario->run(iterations);
+      double elapsed = NowNs() - start;
+      if ( elapsed >= TARGET_SAMPLE_DURATION_NS )
+      {
+         break;
+      }
+      iterations *= 2;
+   }
+   return iterations;
+}
+
+static void RunScenario( const struct BenchmarkScenario_S * scenario,
+                         size_t rounds,
+                         struct BenchmarkResult_S * result )
+{
+   assert( (scenario != nullptr) && (result != nullptr) && (rounds > 0) );
+
+   double samples[SAMPLES_PER_ROUND];
+   std::vector<double> round_p50(rounds);
+   std::vector<double> round_p99(rounds);
+
+   // Warm up caches and branch predictors before calibrating
+   scenario->run(1);
+   size_t iterations = CalibrateIterations(scenario);
+
+   double total_ns = 0.0;
+   double total_ops = 0.0;
+   for ( size_t r = 0; r < rounds; r++ )
+   {
+      for ( size_t s = 0; s < SAMPLES_PER_ROUND; s++ )
+      {
+         double start = NowNs();
+         scenario->run(iterations);
+         double elapsed = NowNs() - start;
+         samples[s] = elapsed / static_cast<double>(iterations);
+         total_ns += elapsed;
+         total_ops += static_cast<double>(iterations);
+      }
+      qsort(samples, SAMPLES_PER_ROUND, sizeof(double), DoubleCmp);
+      round_p50[r] = Percentile(samples, SAMPLES_PER_ROUND, 50.0);
+      round_p99[r] = Percentile(samples, SAMPLES_PER_ROUND, 99.0);
+   }
+
+   qsort(round_p50.data(), rounds, sizeof(double), DoubleCmp);
+   qsort(round_p99.data(), rounds, sizeof(double), DoubleCmp);
+
+   result->ns_per_op = total_ns / total_ops;
+   result->p50_ns = Percentile(round_p50.data(), rounds, 50.0);
+   result->p99_ns = Percentile(round_p99.data(), rounds, 50.0);
+   result->tokens_per_sec = (result->ns_per_op > 0.0) ?
+                              ( (NS_PER_SEC / result->ns_per_op) * static_cast<double>(scenario->tokens_per_op) ) :
+                              0.0;
+   result->p50_spread_pct = (result->p50_ns > 0.0) ?
+                              ( 100.0 * (round_p50[rounds - 1] - round_p50[0]) / result->p50_ns ) :
+                              0.0;
+   result->iterations_per_sample = iterations;
+   result->rounds = rounds;
+}
+
+static bool WriteJSON( const char * path,
+                       const struct BenchmarkResult_S * results,
+                       const bool * ran )
+{
+   assert( (path != nullptr) && (results != nullptr) && (ran != nullptr) );
+
+   FILE * fp = fopen(path, "w");
+   if ( nullptr == fp )
+   {
+      return false;
+   }
+
+   fprintf(fp, "{\n");
+   fprintf(fp, "  \"schema\": %d,\n", JSON_SCHEMA_VERSION);
+#ifdef __VERSION__
+   fprintf(fp, "  \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+   fprintf(fp, "  \"scenarios\": [\n");
+
+   bool first = true;
+   for ( size_t s = 0; s < NUM_OF_SCENARIOS; s++ )
+   {
+      if ( !ran[s] )
+      {
+         continue;
+      }
+      fprintf(fp, "%s    {\n", first ? "" : ",\n");
+      fprintf(fp, "      \"name\": \"%s\",\n", Scenarios[s].name);
+      fprintf(fp, "      \"ns_per_op\": %.3f,\n", results[s].ns_per_op);
+      fprintf(fp, "      \"p50_ns\": %.3f,\n", results[s].p50_ns);
+      fprintf(fp, "      \"p99_ns\": %.3f,\n", results[s].p99_ns);
+      fprintf(fp, "      \"tokens_per_sec\": %.1f,\n", results[s].tokens_per_sec);
+      fprintf(fp, "      \"p50_spread_pct\": %.3f,\n", results[s].p50_spread_pct);
+      fprintf(fp, "      \"iterations_per_sample\": %zu,\n", results[s].iterations_per_sample);
+      fprintf(fp, "      \"rounds\": %zu\n", results[s].rounds);
+      fprintf(fp, "    }");
+      first = false;
+   }
+
+   fprintf(fp, "\n  ]\n}\n");
+
+   return (fclose(fp) == 0);
+}
+
+static void PrintUsage(const char * prog)
+{
+   fprintf(stderr,
+      "Usage: %s [--json <path>] [--scenario <name>] [--rounds <n>] [--list]\n",
+      prog);
+}
@@ -0,0 +1,1265 @@
+/*!
+ * @file    benchmark_lin_pid.c
+ * @brief   Micro-benchmark suite for the lin_pid parser, computation, and
+ *          output paths. Results are printed as a table and, optionally,
+ *          written out as JSON so they can be diffed against a baseline.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "lin_pid.h"
+#include "lin_ldf.h"
+#include "lin_decode.h"
+#include "lin_sched.h"
+#include "lin_log.h"
+#include "lin_cap.h"
+#include "lin_stats.h"
+#include "lin_tp.h"
+#include "lin_la.h"
+
+/* Local Macro Definitions */
+#define NS_PER_SEC                  1000000000.0
+#define DEFAULT_NUM_OF_ROUNDS       7u
+#define SAMPLES_PER_ROUND           1000u
+#define TARGET_SAMPLE_DURATION_NS   2000.0   // Each timed sample should last roughly this long
+#define MAX_ITERATIONS_PER_SAMPLE   (1u << 20)
+#define JSON_SCHEMA_VERSION         1
+#define ID_STREAM_TOKENS            4096u
+#define ID_STREAM_MAX_LEN           (ID_STREAM_TOKENS * 5u)   // Longest token in IDTokens and a '\n'
+#define SYNTHETIC_LDF_FRAMES        60u      // About as many as a real cluster uses
+#define SYNTHETIC_LDF_SIGNALS_PER_FRAME 8u
+#define SYNTHETIC_LDF_MAX_LEN       (64u * 1024u)
+#define DECODE_BATCH_FRAMES         4096u
+#define SWEEP_CANDIDATES            4096u
+#define LOG_INGEST_LINES            4096u
+#define LOG_INGEST_MAX_LEN          (256u * 1024u)
+#define CAPTURE_SEEK_FRAMES         (64u * 1024u)
+#define CAPTURE_SEEK_PERIOD_US      1000u
+#define CAPTURE_QUERY_MATCHES       (CAPTURE_SEEK_FRAMES / CAP_NUM_OF_IDS)
+#define CAPTURE_MERGE_INPUTS        8u
+#define TP_FLASH_FRAMES             (64u * 1024u)
+#define TP_FLASH_BLOCK_LEN          128u     // Bytes per TransferData request
+#define SAMPLE_DUMP_RATE_HZ         1000000u
+#define SAMPLE_DUMP_LEN             (1024u * 1024u)   // About 8 s of bus at 1 MHz
+
+/* Datatypes */
+
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd, pre, width, base, upper, suf ) \
+   enum,
+
+enum NumericFormat_E
+{
+   #include "lin_pid_supported_formats.h"
+   NUM_OF_NUMERIC_FORMATS,
+   INVALID_NUMERIC_FORMAT
+};
+
+#undef LIN_PID_NUMERIC_FORMAT
+
+struct IDSpelling_S
+{
+   uint32_t key;
+   uint8_t id;
+   uint8_t format;
+   bool ishex;
+   bool isdec;
+};
+
+struct BenchmarkScenario_S
+{
+   const char * name;
+   const char * description;
+   size_t tokens_per_op;   // How many ID tokens a single op consumes (for tokens/s)
+   void (*run)(size_t iterations);
+};
+
+struct BenchmarkResult_S
+{
+   double ns_per_op;       // Mean over every timed iteration of every round
+   double p50_ns;          // Median across rounds of each round's p50
+   double p99_ns;          // Median across rounds of each round's p99
+   double tokens_per_sec;
+   double p50_spread_pct;  // (max - min) / median of the per-round p50s: the noise estimate
+   size_t iterations_per_sample;
+   size_t rounds;
+};
+
+/* External Functions Under Benchmark */
+extern enum LIN_PID_Result_E GetID( const char * str,
+                                    uint8_t * id,
+                                    bool * ishex,
+                                    bool * isdec );
+
+extern enum NumericFormat_E DetermineEntryFormat( const char * str,
+                                                  bool ishex,
+                                                  bool isdec );
+
+extern size_t (* const NumericFormatters[NUM_OF_NUMERIC_FORMATS])( char * buf, unsigned int value );
+
+extern const struct IDSpelling_S * LookupIDSpelling( const char * str,
+                                                     bool ishex,
+                                                     bool isdec );
+
+/* Local Data */
+
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd, pre, width, base, upper, suf ) \
+   prnt_fmt,
+static const char * const PrintFormats[NUM_OF_NUMERIC_FORMATS] =
+{
+   #include "lin_pid_supported_formats.h"
+};
+#undef LIN_PID_NUMERIC_FORMAT
+
+// A mix of the supported spellings so that no single parser path dominates
+static const char * IDTokens[] =
+{
+   "0x3F", "3Fh", "x3F", "63d", "27", "0x0a", "1B", "Ah", "X2c", "09D", "00", "3c"
+};
+#define NUM_OF_ID_TOKENS   ( sizeof(IDTokens) / sizeof(IDTokens[0]) )
+
+// Built on first use by BuildIDStream(), as cat ids.txt would pipe them in
+static char IDStream[ID_STREAM_MAX_LEN];
+static size_t IDStreamLen;
+static uint8_t IDStreamIDs[ID_STREAM_TOKENS];
+static enum LIN_PID_Result_E IDStreamResults[ID_STREAM_TOKENS];
+
+// Built on first use by BuildSyntheticLDF()
+static char SyntheticLDF[SYNTHETIC_LDF_MAX_LEN];
+static size_t SyntheticLDFLen;
+
+// Set up on first use by SetUpDecodeBatch()
+static struct LDF_Database_S DecodeDB;
+static struct LDF_DecodePlan_S DecodePlan;
+static struct LDF_SignalColumns_S DecodeCols;
+static struct LIN_Frame_S DecodeFrames[DECODE_BATCH_FRAMES];
+static bool DecodeBatchReady = false;
+
+// Set up on first use by SetUpScheduleSweep()
+static struct Sched_Slot_S * SweepSlots;
+static struct Sched_Candidate_S SweepCandidates[SWEEP_CANDIDATES];
+static struct Sched_Summary_S SweepSummaries[SWEEP_CANDIDATES];
+
+// Set up on first use by SetUpLogIngest()
+static char LogText[LOG_INGEST_MAX_LEN];
+static size_t LogTextLen;
+static struct LOG_Summary_S LogSummary;
+
+// Set up on first use by SetUpCaptureSeek()
+static uint8_t * CaptureBuf;
+static struct CAP_Reader_S CaptureReader;
+static struct Stats_Summary_S StatsSummary;
+
+// Set up on first use by SetUpTPFlash()
+static uint8_t * TPFlashBuf;
+static struct CAP_Reader_S TPFlashReader;
+static struct TP_Reassembler_S TPReassembler;
+
+// Set up on first use by SetUpSampleDump()
+static uint8_t * SampleDump;
+
+// Keeps the optimizer from discarding the work under benchmark
+static volatile uint8_t Sink;
+
+static int SavedStdOut = -1;
+static int SavedStdIn  = -1;
+static int QuietStdInPipe[2] = { -1, -1 };
+
+/* Private Function Prototypes */
+
+static void Run_ComputePID(size_t iterations);
+static void Run_GetID(size_t iterations);
+static void Run_DetermineEntryFormat(size_t iterations);
+static void Run_LookupIDSpelling(size_t iterations);
+static void Run_ParseIDs(size_t iterations);
+static void Run_ParseComputeFormat(size_t iterations);
+static void Run_CLI_Quiet(size_t iterations);
+static void Run_FormatPrintf(size_t iterations);
+static void Run_FormatSpecialized(size_t iterations);
+static void Run_LDFParse(size_t iterations);
+static void Run_SignalDecode(size_t iterations);
+static void Run_ScheduleSweep(size_t iterations);
+static void Run_LogIngest(size_t iterations);
+static void Run_CaptureSeek(size_t iterations);
+static void Run_CaptureQuery(size_t iterations);
+static void Run_CaptureMerge(size_t iterations);
+static void Run_StatsByID(size_t iterations);
+static void Run_TPReassemble(size_t iterations);
+static void Run_SampleDecode(size_t iterations);
+static void Run_SampleDecodeAutoBaud(size_t iterations);
+static void DecodeSampleDump( uint32_t baud, size_t iterations );
+
+static void BuildIDStream(void);
+static void BuildSyntheticLDF(void);
+static bool SetUpDecodeBatch(void);
+static bool SetUpScheduleSweep(void);
+static void SetUpLogIngest(void);
+static bool SetUpCaptureSeek(void);
+static bool SetUpTPFlash(void);
+static void CountTPMessage( const struct TP_Message_S * message, void * ctx );
+static bool SetUpSampleDump(void);
+static void CountSampledFrame( const struct CAP_Frame_S * frame, void * ctx );
+
+static bool RedirectCLIStreams(void);
+static void RestoreCLIStreams(void);
+
+static double NowNs(void);
+static int DoubleCmp( const void * a, const void * b );
+static double Percentile( double * sorted, size_t n, double pct );
+static size_t CalibrateIterations( const struct BenchmarkScenario_S * scenario );
+static void RunScenario( const struct BenchmarkScenario_S * scenario,
+                         size_t rounds,
+                         struct BenchmarkResult_S * result );
+static bool WriteJSON( const char * path,
+                       const struct BenchmarkResult_S * results,
+                       const bool * ran );
+static void PrintUsage(const char * prog);
+
+/* Scenario Table */
+
+static const struct BenchmarkScenario_S Scenarios[] =
+{
+   { "compute_pid",           "ComputePID() across the full ID range",              1, Run_ComputePID },
+   { "parse_id",              "GetID() over a mix of hex/dec spellings",            1, Run_GetID },
+   { "detect_format",         "DetermineEntryFormat() regex-based detection",       1, Run_DetermineEntryFormat },
+   { "parse_id_hashed",       "LookupIDSpelling(): ID and format in one probe, same mix", 1, Run_LookupIDSpelling },
+   { "parse_ids_bulk",        "ParseIDs() of 4096 newline-separated IDs, same mix (tokens = IDs)", ID_STREAM_TOKENS, Run_ParseIDs },
+   { "parse_compute_format",  "GetID() + ComputePID() + snprintf() of the result",  1, Run_ParseComputeFormat },
+   { "cli_quiet",             "Full lin_pid_cli() run in --quiet mode to /dev/null", 1, Run_CLI_Quiet },
+   { "format_printf",         "snprintf() of a PID with each format's print format", 1, Run_FormatPrintf },
+   { "format_specialized",    "The same through each format's generated formatter", 1, Run_FormatSpecialized },
+   { "ldf_parse",             "LDF_Parse() + LDF_Free() of a 60-frame LDF (tokens = frames)", SYNTHETIC_LDF_FRAMES, Run_LDFParse },
+   { "signal_decode",         "LDF_DecodeBatch() of 4096 frames x 8 signals (tokens = frames)", DECODE_BATCH_FRAMES, Run_SignalDecode },
+   { "schedule_sweep",        "Sched_Sweep() of a 60-slot table at 4096 baud rates, all cores (tokens = candidates)", SWEEP_CANDIDATES, Run_ScheduleSweep },
+   { "log_ingest",            "LOG_ProcessStream() of a 4096-line CSV log from memory, all cores (tokens = lines)", LOG_INGEST_LINES, Run_LogIngest },
+   { "capture_seek",          "CAP_SeekTime() + CAP_Next() to a random point in a 65536-frame capture", 1, Run_CaptureSeek },
+   { "capture_query",         "Every frame with ID 0x22 in a 65536-frame capture via its posting list (tokens = matches)", CAPTURE_QUERY_MATCHES, Run_CaptureQuery },
+   { "capture_merge",         "CAP_MergeNext() through 8 65536-frame captures with identical timestamps (tokens = frames)", CAPTURE_MERGE_INPUTS * CAPTURE_SEEK_FRAMES, Run_CaptureMerge },
+   { "stats_by_id",           "Stats_ProcessCapture() of a 65536-frame capture, all cores (tokens = frames)", CAPTURE_SEEK_FRAMES, Run_StatsByID },
+   { "tp_reassemble",         "TP_ProcessCapture() of a 65536-frame flashing session on 0x3C/0x3D (tokens = frames)", TP_FLASH_FRAMES, Run_TPReassemble },
+   { "sample_decode",         "LA_Decode() of a 1 MiB logic-analyzer dump at 1 MHz, 19200 baud, bus 2/3 busy (tokens = bytes)", SAMPLE_DUMP_LEN, Run_SampleDecode },
+   { "sample_decode_auto",    "Same, with the baud rate measured from every sync field (tokens = bytes)", SAMPLE_DUMP_LEN, Run_SampleDecodeAutoBaud },
+};
+#define NUM_OF_SCENARIOS   ( sizeof(Scenarios) / sizeof(Scenarios[0]) )
+
+/* Meat of the Program */
+
+int main( int argc, char * argv[] )
+{
+   const char * json_path = NULL;
+   const char * only_scenario = NULL;
+   size_t rounds = DEFAULT_NUM_OF_ROUNDS;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp(argv[i], "--json") == 0) && ((i + 1) < argc) )
+      {
+         json_path = argv[++i];
+      }
+      else if ( (strcmp(argv[i], "--scenario") == 0) && ((i + 1) < argc) )
+      {
+         only_scenario = argv[++i];
+      }
+      else if ( (strcmp(argv[i], "--rounds") == 0) && ((i + 1) < argc) )
+      {
+         long r = strtol(argv[++i], NULL, 10);
+         if ( r <= 0 )
+         {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+         }
+         rounds = (size_t)r;
+      }
+      else if ( strcmp(argv[i], "--list") == 0 )
+      {
+         for ( size_t s = 0; s < NUM_OF_SCENARIOS; s++ )
+         {
+            printf("%-22s %s\n", Scenarios[s].name, Scenarios[s].description);
+         }
+         return EXIT_SUCCESS;
+      }
+      else
+      {
+         PrintUsage(argv[0]);
+         return EXIT_FAILURE;
+      }
+   }
+
+   struct BenchmarkResult_S results[NUM_OF_SCENARIOS];
+   bool ran[NUM_OF_SCENARIOS] = { false };
+   bool any_ran = false;
+
+   printf("\n%-22s %12s %10s %10s %14s %8s\n",
+          "Scenario", "ns/op", "p50 (ns)", "p99 (ns)", "tokens/s", "noise");
+   printf("------------------------------------------------------------------------------\n");
+
+   for ( size_t s = 0; s < NUM_OF_SCENARIOS; s++ )
+   {
+      if ( (only_scenario != NULL) && (strcmp(only_scenario, Scenarios[s].name) != 0) )
+      {
+         continue;
+      }
+
+      RunScenario(&Scenarios[s], rounds, &results[s]);
+      ran[s] = true;
+      any_ran = true;
+
+      printf("%-22s %12.2f %10.2f %10.2f %14.0f %7.1f%%\n",
+             Scenarios[s].name,
+             results[s].ns_per_op,
+             results[s].p50_ns,
+             results[s].p99_ns,
+             results[s].tokens_per_sec,
+             results[s].p50_spread_pct);
+   }
+   printf("\n");
+
+   if ( !any_ran )
+   {
+      fprintf(stderr, "Unknown scenario: %s\n", only_scenario);
+      return EXIT_FAILURE;
+   }
+
+   if ( (json_path != NULL) && !WriteJSON(json_path, results, ran) )
+   {
+      fprintf(stderr, "Failed to write benchmark results to %s\n", json_path);
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+
+/* Scenarios */
+
+static void Run_ComputePID(size_t iterations)
+{
+   uint8_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      acc ^= ComputePID( (uint8_t)(i & MAX_ID_ALLOWED) );
+   }
+   Sink = acc;
+}
+
+static void Run_GetID(size_t iterations)
+{
+   uint8_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      uint8_t id = 0;
+      bool ishex = false;
+      bool isdec = false;
+      (void)GetID( IDTokens[i % NUM_OF_ID_TOKENS], &id, &ishex, &isdec );
+      acc ^= id;
+   }
+   Sink = acc;
+}
+
+static void Run_DetermineEntryFormat(size_t iterations)
+{
+   uint8_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      acc ^= (uint8_t)DetermineEntryFormat( IDTokens[i % NUM_OF_ID_TOKENS], false, false );
+   }
+   Sink = acc;
+}
+
+static void Run_LookupIDSpelling(size_t iterations)
+{
+   uint8_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      const struct IDSpelling_S * spelling = LookupIDSpelling( IDTokens[i % NUM_OF_ID_TOKENS], false, false );
+      if ( spelling != NULL )
+      {
+         acc ^= (uint8_t)( spelling->id ^ spelling->format );
+      }
+   }
+   Sink = acc;
+}
+
+static void Run_ParseIDs(size_t iterations)
+{
+   if ( 0 == IDStreamLen )
+   {
+      BuildIDStream();
+   }
+
+   uint8_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      size_t consumed;
+      size_t num_ids = ParseIDs( IDStream, IDStreamLen, false, false,
+                                 IDStreamIDs, IDStreamResults, ID_STREAM_TOKENS, &consumed );
+      assert( ID_STREAM_TOKENS == num_ids );
+      acc ^= IDStreamIDs[ i % num_ids ];
+   }
+   Sink = acc;
+}
+
+static void Run_ParseComputeFormat(size_t iterations)
+{
+   char out[16];
+   uint8_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      uint8_t id = 0;
+      bool ishex = false;
+      bool isdec = false;
+      (void)GetID( IDTokens[i % NUM_OF_ID_TOKENS], &id, &ishex, &isdec );
+      int len = snprintf( out, sizeof(out), "0x%02X", (unsigned int)ComputePID(id) );
+      acc ^= (uint8_t)(out[len - 1]);
+   }
+   Sink = acc;
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"   // The formats are lin_pid_supported_formats.h's own
+#endif
+static void Run_FormatPrintf(size_t iterations)
+{
+   char out[16];
+   uint8_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      int len = snprintf( out, sizeof(out), PrintFormats[i % NUM_OF_NUMERIC_FORMATS], (unsigned int)(i & UINT8_MAX) );
+      acc ^= (uint8_t)(out[len - 1]);
+   }
+   Sink = acc;
+}
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+static void Run_FormatSpecialized(size_t iterations)
+{
+   char out[16];
+   uint8_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      size_t len = NumericFormatters[i % NUM_OF_NUMERIC_FORMATS]( out, (unsigned int)(i & UINT8_MAX) );
+      acc ^= (uint8_t)(out[len - 1]);
+   }
+   Sink = acc;
+}
+
+static void Run_CLI_Quiet(size_t iterations)
+{
+   char prog[] = "lin_pid";
+   char flag[] = "-q";
+   char token[8];
+
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      // lin_pid_cli() takes non-const strings, so hand it a private copy
+      strncpy( token, IDTokens[i % NUM_OF_ID_TOKENS], sizeof(token) - 1 );
+      token[sizeof(token) - 1] = '\0';
+      char * argv[] = { prog, token, flag, NULL };
+      Sink = (uint8_t)lin_pid_cli( 3, argv );
+   }
+   fflush(stdout);
+}
+
+static void Run_LDFParse(size_t iterations)
+{
+   if ( 0 == SyntheticLDFLen )
+   {
+      BuildSyntheticLDF();
+   }
+
+   size_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      struct LDF_Database_S db;
+      (void)LDF_Parse( SyntheticLDF, SyntheticLDFLen, &db );
+      acc += db.num_frames;
+      LDF_Free(&db);
+   }
+   Sink = (uint8_t)acc;
+}
+
+static void Run_SignalDecode(size_t iterations)
+{
+   if ( !DecodeBatchReady && !SetUpDecodeBatch() )
+   {
+      return;
+   }
+
+   size_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      LDF_ResetColumns(&DecodeCols);
+      acc += LDF_DecodeBatch( &DecodePlan, DecodeFrames, DECODE_BATCH_FRAMES, &DecodeCols );
+   }
+   Sink = (uint8_t)(acc + DecodeCols.values[0][0]);
+}
+
+static void Run_ScheduleSweep(size_t iterations)
+{
+   if ( (NULL == SweepSlots) && !SetUpScheduleSweep() )
+   {
+      return;
+   }
+
+   size_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      Sched_Sweep( SweepCandidates, SWEEP_CANDIDATES, SweepSummaries, 0 );
+      acc += SweepSummaries[SWEEP_CANDIDATES - 1u].num_overruns;
+   }
+   Sink = (uint8_t)acc;
+}
+
+static void Run_LogIngest(size_t iterations)
+{
+   if ( 0 == LogTextLen )
+   {
+      SetUpLogIngest();
+   }
+
+   struct LOG_Options_S options = { 0 };
+   options.format = LOG_FORMAT_CSV;
+   options.checksum = LOG_CHECKSUM_LIN2;
+
+   uint64_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      FILE * fp = fmemopen( LogText, LogTextLen, "r" );
+      if ( NULL == fp )
+      {
+         return;
+      }
+      (void)LOG_ProcessStream( fp, &options, &LogSummary );
+      (void)fclose(fp);
+      acc += LogSummary.anomalies[LOG_ANOMALY_CHECKSUM];
+   }
+   Sink = (uint8_t)acc;
+}
+
+static void Run_CaptureSeek(size_t iterations)
+{
+   if ( (NULL == CaptureBuf) && !SetUpCaptureSeek() )
+   {
+      return;
+   }
+
+   uint64_t span_us = (uint64_t)CAPTURE_SEEK_FRAMES * CAPTURE_SEEK_PERIOD_US;
+   uint64_t acc = 0;
+   uint32_t state = 0x12345678u;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      state = (state * 1664525u) + 1013904223u;   // LCG; cheap next to the seek
+      struct CAP_Cursor_S cursor;
+      struct CAP_Frame_S frame;
+      if ( CAP_SeekTime(&CaptureReader, (uint64_t)state % span_us, &cursor) &&
+           CAP_Next(&CaptureReader, &cursor, &frame) )
+      {
+         acc += frame.id;
+      }
+   }
+   Sink = (uint8_t)acc;
+}
+
+static void Run_CaptureQuery(size_t iterations)
+{
+   if ( (NULL == CaptureBuf) && !SetUpCaptureSeek() )
+   {
+      return;
+   }
+
+   uint64_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      struct CAP_Postings_S postings;
+      struct CAP_Frame_S frame;
+      if ( !CAP_PostingsOpen(&CaptureReader, 0x22, &postings) )
+      {
+         return;
+      }
+      while ( CAP_NextPosting(&CaptureReader, &postings, &frame) )
+      {
+         acc += frame.data[0];
+      }
+   }
+   Sink = (uint8_t)acc;
+}
+
+static void Run_CaptureMerge(size_t iterations)
+{
+   if ( (NULL == CaptureBuf) && !SetUpCaptureSeek() )
+   {
+      return;
+   }
+
+   // Every input is the same capture, so every frame ties and the heap does the most work
+   struct CAP_Reader_S readers[CAPTURE_MERGE_INPUTS];
+   for ( size_t i = 0; i < CAPTURE_MERGE_INPUTS; i++ )
+   {
+      readers[i] = CaptureReader;
+   }
+
+   uint64_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      struct CAP_Merge_S merge;
+      struct CAP_Frame_S frame;
+      if ( CAP_MergeOpen(&merge, readers, CAPTURE_MERGE_INPUTS, true) != GoodResult )
+      {
+         return;
+      }
+      while ( CAP_MergeNext(&merge, &frame, NULL) )
+      {
+         acc += frame.channel;
+      }
+      CAP_MergeClose(&merge);
+   }
+   Sink = (uint8_t)acc;
+}
+
+static void Run_StatsByID(size_t iterations)
+{
+   if ( (NULL == CaptureBuf) && !SetUpCaptureSeek() )
+   {
+      return;
+   }
+
+   uint64_t acc = 0;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      Stats_Init(&StatsSummary);
+      (void)Stats_ProcessCapture( &CaptureReader, 0, &StatsSummary );
+      acc += StatsSummary.per_id[0x22].period_max_us;
+   }
+   Sink = (uint8_t)acc;
+}
+
+static void Run_TPReassemble(size_t iterations)
+{
+   if ( (NULL == TPFlashBuf) && !SetUpTPFlash() )
+   {
+      return;
+   }
+
+   uint64_t acc = 0;
+   struct TP_Options_S options = { 0 };
+   options.on_message = CountTPMessage;
+   options.ctx = &acc;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      TP_Init(&TPReassembler, &options);
+      (void)TP_ProcessCapture( &TPReassembler, &TPFlashReader );
+   }
+   Sink = (uint8_t)acc;
+}
+
+static void Run_SampleDecode(size_t iterations)
+{
+   DecodeSampleDump(LA_DEFAULT_BAUD, iterations);
+}
+
+static void Run_SampleDecodeAutoBaud(size_t iterations)
+{
+   DecodeSampleDump(0, iterations);
+}
+
+static void DecodeSampleDump( uint32_t baud, size_t iterations )
+{
+   if ( (NULL == SampleDump) && !SetUpSampleDump() )
+   {
+      return;
+   }
+
+   uint64_t acc = 0;
+   struct LA_Options_S options = { 0 };
+   options.sample_rate_hz = SAMPLE_DUMP_RATE_HZ;
+   options.baud = baud;
+   options.on_frame = CountSampledFrame;
+   options.ctx = &acc;
+   for ( size_t i = 0; i < iterations; i++ )
+   {
+      (void)LA_Decode( SampleDump, SAMPLE_DUMP_LEN, &options, NULL );
+   }
+   Sink = (uint8_t)acc;
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief Write out an LDF shaped like a busy production cluster: a master and
+ *        a handful of slaves, 60 frames with 8 signals each, and a schedule
+ *        table that visits every frame.
+ */
+static void BuildIDStream(void)
+{
+   IDStreamLen = 0;
+   for ( size_t i = 0; i < ID_STREAM_TOKENS; i++ )
+   {
+      size_t len = strlen( IDTokens[i % NUM_OF_ID_TOKENS] );
+      assert( (IDStreamLen + len + 1u) <= ID_STREAM_MAX_LEN );
+      memcpy( &IDStream[IDStreamLen], IDTokens[i % NUM_OF_ID_TOKENS], len );
+      IDStreamLen += len;
+      IDStream[IDStreamLen++] = '\n';
+   }
+}
+
+static void BuildSyntheticLDF(void)
+{
+   char * buf = SyntheticLDF;
+   size_t cap = sizeof(SyntheticLDF);
+   size_t len = 0;
+
+#define APPEND(...)                                                     \
+   do                                                                   \
+   {                                                                    \
+      int n = snprintf( buf + len, cap - len, __VA_ARGS__ );            \
+      assert( (n > 0) && ((size_t)n < (cap - len)) );                   \
+      len += (size_t)n;                                                 \
+   } while (0)
+
+   APPEND( "LIN_description_file;\n"
+           "LIN_protocol_version = \"2.1\";\n"
+           "LIN_language_version = \"2.1\";\n"
+           "LIN_speed = 19.2 kbps;\n"
+           "Nodes {\n   Master: Gateway, 5 ms, 0.1 ms;\n   Slaves: Node0, Node1, Node2, Node3;\n}\n" );
+
+   APPEND( "Signals {\n" );
+   for ( unsigned int f = 0; f < SYNTHETIC_LDF_FRAMES; f++ )
+   {
+      for ( unsigned int s = 0; s < SYNTHETIC_LDF_SIGNALS_PER_FRAME; s++ )
+      {
+         APPEND( "   Frame%02u_Signal%u: 8, 0, Node%u, Gateway;\n", f, s, f % 4u );
+      }
+   }
+   APPEND( "}\n" );
+
+   APPEND( "Frames {\n" );
+   for ( unsigned int f = 0; f < SYNTHETIC_LDF_FRAMES; f++ )
+   {
+      APPEND( "   Frame%02u: 0x%02X, Node%u, 8 {\n", f, f, f % 4u );
+      for ( unsigned int s = 0; s < SYNTHETIC_LDF_SIGNALS_PER_FRAME; s++ )
+      {
+         APPEND( "      Frame%02u_Signal%u, %u;\n", f, s, s * 8u );
+      }
+      APPEND( "   }\n" );
+   }
+   APPEND( "}\n" );
+
+   APPEND( "Schedule_tables {\n   Normal {\n" );
+   for ( unsigned int f = 0; f < SYNTHETIC_LDF_FRAMES; f++ )
+   {
+      APPEND( "      Frame%02u delay 10 ms;\n", f );
+   }
+   APPEND( "   }\n}\n" );
+
+#undef APPEND
+
+   SyntheticLDFLen = len;
+}
+
+/**
+ * @brief Compile a decode plan for the synthetic LDF and fill a batch with
+ *        frames cycling through every ID it defines. The database, plan, and
+ *        columns live for the rest of the run.
+ */
+static bool SetUpDecodeBatch(void)
+{
+   if ( 0 == SyntheticLDFLen )
+   {
+      BuildSyntheticLDF();
+   }
+
+   if ( (LDF_Parse(SyntheticLDF, SyntheticLDFLen, &DecodeDB) != GoodResult) ||
+        (LDF_CompileDecodePlan(&DecodeDB, &DecodePlan) != GoodResult) ||
+        (LDF_InitColumns(&DecodePlan, DECODE_BATCH_FRAMES, &DecodeCols) != GoodResult) )
+   {
+      fprintf(stderr, "Couldn't set up the signal_decode batch.\n");
+      return false;
+   }
+
+   uint32_t lcg = 12345u;
+   for ( size_t i = 0; i < DECODE_BATCH_FRAMES; i++ )
+   {
+      DecodeFrames[i].id = (uint8_t)(i % SYNTHETIC_LDF_FRAMES);
+      DecodeFrames[i].length = 8u;
+      for ( size_t b = 0; b < LDF_MAX_FRAME_LEN; b++ )
+      {
+         lcg = (lcg * 1103515245u) + 12345u;
+         DecodeFrames[i].data[b] = (uint8_t)(lcg >> 16);
+      }
+   }
+
+   DecodeBatchReady = true;
+   return true;
+}
+
+/**
+ * @brief Pull the synthetic LDF's 60-slot schedule table out once and point
+ *        every sweep candidate at it, each with its own baud rate.
+ */
+static bool SetUpScheduleSweep(void)
+{
+   if ( 0 == SyntheticLDFLen )
+   {
+      BuildSyntheticLDF();
+   }
+
+   struct LDF_Database_S db;
+   size_t num_slots = 0;
+   bool ok = ( LDF_Parse(SyntheticLDF, SyntheticLDFLen, &db) == GoodResult ) &&
+             ( Sched_SlotsFromLDF(&db, 0, &SweepSlots, &num_slots) == GoodResult );
+   LDF_Free(&db);
+   if ( !ok )
+   {
+      fprintf(stderr, "Couldn't set up the schedule_sweep candidates.\n");
+      return false;
+   }
+
+   for ( size_t i = 0; i < SWEEP_CANDIDATES; i++ )
+   {
+      SweepCandidates[i].slots = SweepSlots;
+      SweepCandidates[i].num_slots = num_slots;
+      SweepCandidates[i].baud_rate = 1000u + (uint32_t)(5u * i);
+   }
+
+   return true;
+}
+
+/**
+ * @brief A CSV capture cycling through every ID, with a bad checksum every
+ *        97th frame so the anomaly path gets exercised too.
+ */
+static void SetUpLogIngest(void)
+{
+   size_t len = 0;
+   for ( uint32_t i = 0; i < LOG_INGEST_LINES; i++ )
+   {
+      uint8_t id = (uint8_t)(i % (MAX_ID_ALLOWED + 1u));
+      uint8_t pid = ReferencePID(id);
+      uint8_t data[4] = { (uint8_t)i, (uint8_t)(i >> 8), 0x5A, 0xA5 };
+      uint8_t checksum = LOG_Checksum(pid, data, sizeof(data), id < 0x3Cu);
+      if ( 0 == (i % 97u) )
+      {
+         checksum ^= 0x01u;
+      }
+
+      int n = snprintf( LogText + len, sizeof(LogText) - len,
+                        "%u.%06u,1,0x%02X,0x%02X,%02X %02X %02X %02X,%02X\n",
+                        (unsigned int)(i / 1000u), (unsigned int)((i % 1000u) * 1000u),
+                        (unsigned int)id, (unsigned int)pid,
+                        (unsigned int)data[0], (unsigned int)data[1],
+                        (unsigned int)data[2], (unsigned int)data[3], (unsigned int)checksum );
+      assert( (n > 0) && ((size_t)n < (sizeof(LogText) - len)) );
+      len += (size_t)n;
+   }
+   LogTextLen = len;
+}
+
+/**
+ * @brief A capture of one 4-byte frame every millisecond across every ID, in
+ *        default-sized blocks, held in memory so seeks don't touch the disk.
+ */
+static bool SetUpCaptureSeek(void)
+{
+   FILE * fp = tmpfile();
+   if ( NULL == fp )
+   {
+      return false;
+   }
+
+   struct CAP_Writer_S writer;
+   bool ok = ( GoodResult == CAP_WriterOpen(&writer, fp, 0) );
+   for ( uint32_t i = 0; ok && (i < CAPTURE_SEEK_FRAMES); i++ )
+   {
+      struct CAP_Frame_S frame = { 0 };
+      frame.timestamp_us = (uint64_t)i * CAPTURE_SEEK_PERIOD_US;
+      frame.id = (uint8_t)(i % (MAX_ID_ALLOWED + 1u));
+      frame.pid = ReferencePID(frame.id);
+      frame.length = 4;
+      frame.data[0] = (uint8_t)i;
+      frame.data[1] = (uint8_t)(i >> 8);
+      frame.checksum = LOG_Checksum(frame.pid, frame.data, frame.length, frame.id < 0x3Cu);
+      ok = ( GoodResult == CAP_WriteFrame(&writer, &frame) );
+   }
+   ok = ( GoodResult == CAP_WriterClose(&writer) ) && ok;
+
+   long size = ok ? ftell(fp) : -1L;
+   uint8_t * buf = ( size > 0 ) ? malloc( (size_t)size ) : NULL;
+   ok = ( buf != NULL ) && ( fseek(fp, 0, SEEK_SET) == 0 ) &&
+        ( fread(buf, 1, (size_t)size, fp) == (size_t)size ) &&
+        ( GoodResult == CAP_OpenMemory(buf, (size_t)size, &CaptureReader) );
+   (void)fclose(fp);
+   if ( !ok )
+   {
+      free(buf);
+      return false;
+   }
+
+   CaptureBuf = buf;
+   return true;
+}
+
+/**
+ * @brief A flashing session: TransferData requests of TP_FLASH_BLOCK_LEN
+ *        bytes, each a first frame and its consecutive frames, answered by a
+ *        single-frame positive response, one frame every millisecond.
+ */
+static bool SetUpTPFlash(void)
+{
+   FILE * fp = tmpfile();
+   if ( NULL == fp )
+   {
+      return false;
+   }
+
+   struct CAP_Writer_S writer;
+   bool ok = ( GoodResult == CAP_WriterOpen(&writer, fp, 0) );
+   uint32_t sent = 0;       // Bytes of the request so far
+   uint8_t sn = 0;
+   for ( uint32_t i = 0; ok && (i < TP_FLASH_FRAMES); i++ )
+   {
+      struct CAP_Frame_S frame = { 0 };
+      frame.timestamp_us = (uint64_t)i * CAPTURE_SEEK_PERIOD_US;
+      frame.id = TP_MASTER_REQUEST_ID;
+      frame.length = TP_FRAME_LEN;
+      frame.data[0] = 0x01;
+      memset( &frame.data[2], (int)(i & 0xFFu), 6 );
+      if ( sent >= TP_FLASH_BLOCK_LEN )
+      {
+         frame.id = TP_SLAVE_RESPONSE_ID;
+         frame.data[1] = 0x02;
+         frame.data[2] = 0x76;
+         sent = 0;
+      }
+      else if ( 0u == sent )
+      {
+         frame.data[1] = (uint8_t)(0x10u | (TP_FLASH_BLOCK_LEN >> 8));
+         frame.data[2] = (uint8_t)(TP_FLASH_BLOCK_LEN & 0xFFu);
+         frame.data[3] = 0x36;
+         sent = TP_FF_DATA_LEN;
+         sn = 1;
+      }
+      else
+      {
+         frame.data[1] = (uint8_t)(0x20u | sn);
+         sent += TP_CF_DATA_LEN;
+         sn = (uint8_t)((sn + 1u) & 0x0Fu);
+      }
+      frame.pid = ReferencePID(frame.id);
+      frame.checksum = LOG_Checksum(frame.pid, frame.data, frame.length, false);
+      ok = ( GoodResult == CAP_WriteFrame(&writer, &frame) );
+   }
+   ok = ( GoodResult == CAP_WriterClose(&writer) ) && ok;
+
+   long size = ok ? ftell(fp) : -1L;
+   uint8_t * buf = ( size > 0 ) ? malloc( (size_t)size ) : NULL;
+   ok = ( buf != NULL ) && ( fseek(fp, 0, SEEK_SET) == 0 ) &&
+        ( fread(buf, 1, (size_t)size, fp) == (size_t)size ) &&
+        ( GoodResult == CAP_OpenMemory(buf, (size_t)size, &TPFlashReader) );
+   (void)fclose(fp);
+   if ( !ok )
+   {
+      free(buf);
+      return false;
+   }
+
+   TPFlashBuf = buf;
+   return true;
+}
+
+static void CountTPMessage( const struct TP_Message_S * message, void * ctx )
+{
+   *(uint64_t *)ctx += message->length;
+}
+
+/**
+ * @brief A bus at 19200 baud sampled at 1 MHz: 8-byte frames across every ID
+ *        back to back, with a third of each 10 ms slot left idle.
+ */
+static bool SetUpSampleDump(void)
+{
+   uint8_t * dump = malloc(SAMPLE_DUMP_LEN);
+   if ( NULL == dump )
+   {
+      return false;
+   }
+   memset( dump, 0xFF, SAMPLE_DUMP_LEN );
+
+   const double samples_per_bit = (double)SAMPLE_DUMP_RATE_HZ / (double)LA_DEFAULT_BAUD;
+   const uint64_t num_samples = (uint64_t)SAMPLE_DUMP_LEN * 8u;
+   uint64_t slot_start = 0;
+   for ( uint32_t n = 0; slot_start < num_samples; n++ )
+   {
+      uint8_t id = (uint8_t)(n % 60u);
+      uint8_t bytes[11] = { LA_SYNC_BYTE, ReferencePID(id) };
+      for ( uint8_t i = 0; i < 8u; i++ )
+      {
+         bytes[2u + i] = (uint8_t)(n + i);
+      }
+      bytes[10] = LOG_Checksum(bytes[1], &bytes[2], 8, true);
+
+      double bit = 13.0 + 1.0;   // Past the break and its delimiter
+      uint64_t break_end = slot_start + (uint64_t)(13.0 * samples_per_bit);
+      for ( uint64_t s = slot_start; (s < break_end) && (s < num_samples); s++ )
+      {
+         dump[s / 8u] &= (uint8_t)~(1u << (s % 8u));
+      }
+      for ( size_t b = 0; b < sizeof(bytes); b++ )
+      {
+         unsigned int frame_bits = ( (unsigned int)bytes[b] << 1 ) | 0x200u;   // Start, data, stop
+         for ( unsigned int k = 0; k < 10u; k++, bit += 1.0 )
+         {
+            if ( 0u == ((frame_bits >> k) & 1u) )
+            {
+               uint64_t from = slot_start + (uint64_t)(bit * samples_per_bit);
+               uint64_t to = slot_start + (uint64_t)((bit + 1.0) * samples_per_bit);
+               for ( uint64_t s = from; (s < to) && (s < num_samples); s++ )
+               {
+                  dump[s / 8u] &= (uint8_t)~(1u << (s % 8u));
+               }
+            }
+         }
+      }
+      slot_start += 10000u;      // 10 ms slots at 1 MHz
+   }
+
+   SampleDump = dump;
+   return true;
+}
+
+static void CountSampledFrame( const struct CAP_Frame_S * frame, void * ctx )
+{
+   *(uint64_t *)ctx += frame->checksum;
+}
+
+/**
+ * @brief Point stdout at /dev/null and stdin at an empty (but still open) pipe,
+ *        as a script's often is, so that lin_pid_cli() doesn't flood the
+ *        terminal. The ID on the command line keeps it off the piped path.
+ */
+static bool RedirectCLIStreams(void)
+{
+   fflush(stdout);
+   SavedStdOut = dup(STDOUT_FILENO);
+   SavedStdIn  = dup(STDIN_FILENO);
+   int dev_null = open("/dev/null", O_WRONLY);
+
+   if ( (SavedStdOut < 0) || (SavedStdIn < 0) || (dev_null < 0) || (pipe(QuietStdInPipe) != 0) )
+   {
+      if ( dev_null >= 0 ) close(dev_null);
+      return false;
+   }
+
+   (void)dup2(dev_null, STDOUT_FILENO);
+   (void)dup2(QuietStdInPipe[0], STDIN_FILENO);
+   close(dev_null);
+
+   return true;
+}
+
+static void RestoreCLIStreams(void)
+{
+   fflush(stdout);
+   if ( SavedStdOut >= 0 )
+   {
+      (void)dup2(SavedStdOut, STDOUT_FILENO);
+      close(SavedStdOut);
+      SavedStdOut = -1;
+   }
+   if ( SavedStdIn >= 0 )
+   {
+      (void)dup2(SavedStdIn, STDIN_FILENO);
+      close(SavedStdIn);
+      SavedStdIn = -1;
+   }
+   for ( size_t i = 0; i < 2; i++ )
+   {
+      if ( QuietStdInPipe[i] >= 0 )
+      {
+         close(QuietStdInPipe[i]);
+         QuietStdInPipe[i] = -1;
+      }
+   }
+}
+
+static double NowNs(void)
+{
+   struct timespec ts;
+   (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ((double)ts.tv_sec * NS_PER_SEC) + (double)ts.tv_nsec;
+}
+
+static int DoubleCmp( const void * a, const void * b )
+{
+   assert( (a != NULL) && (b != NULL) );
+
+   double c = *(const double *)a;
+   double d = *(const double *)b;
+
+   return (c > d) - (c < d);
+}
+
+static double Percentile( double * sorted, size_t n, double pct )
+{
+   assert( (sorted != NULL) && (n > 0) );
+
+   size_t idx = (size_t)( (pct / 100.0) * (double)(n - 1) + 0.5 );
+   return sorted[ (idx < n) ? idx : (n - 1) ];
+}
+
+/**
+ * @brief Pick how many iterations a single timed sample should run so that
+ *        the clock's own overhead stays small relative to the measurement.
+ */
+static size_t CalibrateIterations( const struct BenchmarkScenario_S * scenario )
+{
+   size_t iterations = 1;
+   while ( iterations < MAX_ITERATIONS_PER_SAMPLE )
+   {
+      double start = NowNs();
+      scenario->run(iterations);
+      double elapsed = NowNs() - start;
+      if ( elapsed >= TARGET_SAMPLE_DURATION_NS )
+      {
+         break;
+      }
+      iterations *= 2;
+   }
+   return iterations;
+}
+
+static void RunScenario( const struct BenchmarkScenario_S * scenario,
+                         size_t rounds,
+                         struct BenchmarkResult_S * result )
+{
+   assert( (scenario != NULL) && (result != NULL) && (rounds > 0) );
+
+   bool redirected = false;
+   if ( Run_CLI_Quiet == scenario->run )
+   {
+      redirected = RedirectCLIStreams();
+   }
+
+   double samples[SAMPLES_PER_ROUND];
+   double * round_p50 = malloc( rounds * sizeof(double) );
+   double * round_p99 = malloc( rounds * sizeof(double) );
+   if ( (NULL == round_p50) || (NULL == round_p99) )
+   {
+      free(round_p50);
+      free(round_p99);
+      memset(result, 0, sizeof(*result));
+      if ( redirected ) RestoreCLIStreams();
+      return;
+   }
+
+   // Warm up caches and branch predictors before calibrating
+   scenario->run(SAMPLES_PER_ROUND);
+   size_t iterations = CalibrateIterations(scenario);
+
+   double total_ns = 0.0;
+   double total_ops = 0.0;
+   for ( size_t r = 0; r < rounds; r++ )
+   {
+      for ( size_t s = 0; s < SAMPLES_PER_ROUND; s++ )
+      {
+         double start = NowNs();
+         scenario->run(iterations);
+         double elapsed = NowNs() - start;
+         samples[s] = elapsed / (double)iterations;
+         total_ns += elapsed;
+         total_ops += (double)iterations;
+      }
+      qsort(samples, SAMPLES_PER_ROUND, sizeof(double), DoubleCmp);
+      round_p50[r] = Percentile(samples, SAMPLES_PER_ROUND, 50.0);
+      round_p99[r] = Percentile(samples, SAMPLES_PER_ROUND, 99.0);
+   }
+
+   if ( redirected )
+   {
+      RestoreCLIStreams();
+   }
+
+   qsort(round_p50, rounds, sizeof(double), DoubleCmp);
+   qsort(round_p99, rounds, sizeof(double), DoubleCmp);
+
+   result->ns_per_op = total_ns / total_ops;
+   result->p50_ns = Percentile(round_p50, rounds, 50.0);
+   result->p99_ns = Percentile(round_p99, rounds, 50.0);
+   result->tokens_per_sec = (result->ns_per_op > 0.0) ?
+                              ( (NS_PER_SEC / result->ns_per_op) * (double)scenario->tokens_per_op ) :
+                              0.0;
+   result->p50_spread_pct = (result->p50_ns > 0.0) ?
+                              ( 100.0 * (round_p50[rounds - 1] - round_p50[0]) / result->p50_ns ) :
+                              0.0;
+   result->iterations_per_sample = iterations;
+   result->rounds = rounds;
+
+   free(round_p50);
+   free(round_p99);
+}
+
+static bool WriteJSON( const char * path,
+                       const struct BenchmarkResult_S * results,
+                       const bool * ran )
+{
+   assert( (path != NULL) && (results != NULL) && (ran != NULL) );
+
+   FILE * fp = fopen(path, "w");
+   if ( NULL == fp )
+   {
+      return false;
+   }
+
+   fprintf(fp, "{\n");
+   fprintf(fp, "  \"schema\": %d,\n", JSON_SCHEMA_VERSION);
+#ifdef __VERSION__
+   fprintf(fp, "  \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+   fprintf(fp, "  \"scenarios\": [\n");
+
+   bool first = true;
+   for ( size_t s = 0; s < NUM_OF_SCENARIOS; s++ )
+   {
+      if ( !ran[s] )
+      {
+         continue;
+      }
+      fprintf(fp, "%s    {\n", first ? "" : ",\n");
+      fprintf(fp, "      \"name\": \"%s\",\n", Scenarios[s].name);
+      fprintf(fp, "      \"ns_per_op\": %.3f,\n", results[s].ns_per_op);
+      fprintf(fp, "      \"p50_ns\": %.3f,\n", results[s].p50_ns);
+      fprintf(fp, "      \"p99_ns\": %.3f,\n", results[s].p99_ns);
+      fprintf(fp, "      \"tokens_per_sec\": %.1f,\n", results[s].tokens_per_sec);
+      fprintf(fp, "      \"p50_spread_pct\": %.3f,\n", results[s].p50_spread_pct);
+      fprintf(fp, "      \"iterations_per_sample\": %zu,\n", results[s].iterations_per_sample);
+      fprintf(fp, "      \"rounds\": %zu\n", results[s].rounds);
+      fprintf(fp, "    }");
+      first = false;
+   }
+
+   fprintf(fp, "\n  ]\n}\n");
+
+   return (fclose(fp) == 0);
+}
+
+static void PrintUsage(const char * prog)
+{
+   fprintf(stderr,
+      "Usage: %s [--json <path>] [--scenario <name>] [--rounds <n>] [--list]\n",
+      prog);
+}
@@ -0,0 +1,435 @@
+/*!
+ * @file    benchmark_startup.c
+ * @brief   Process startup latency benchmark for the lin_pid executable.
+ *
+ * For single-ID lookups from scripts, nearly all of the CLI's cost is the
+ * exec -> exit round trip (dynamic loader, libc init, stdio), not the PID
+ * computation itself. This launches the built executables thousands of times
+ * with posix_spawn() and reports the distribution of spawn-to-reap latencies.
+ * Results use the same JSON layout as benchmark_lin_pid.c so that
+ * benchmark_compare.py can diff them against the baseline.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+/* Local Macro Definitions */
+#define NS_PER_SEC                  1000000000.0
+#define NS_PER_US                   1000.0
+#define DEFAULT_NUM_OF_ROUNDS       20u
+#define LAUNCHES_PER_ROUND          250u     // 5000 launches by default
+#define WARMUP_LAUNCHES             50u      // Get the executable into the page cache
+#define JSON_SCHEMA_VERSION         1
+
+/* Datatypes */
+
+struct StartupTarget_S
+{
+   const char * name;
+   const char * description;
+   const char * exe_path;
+};
+
+struct StartupResult_S
+{
+   double min_ns;
+   double mean_ns;
+   double p50_ns;          // Median across rounds of each round's p50
+   double p90_ns;
+   double p99_ns;          // Median across rounds of each round's p99
+   double max_ns;
+   double stddev_ns;
+   double launches_per_sec;
+   double p50_spread_pct;  // (max - min) / median of the per-round p50s: the noise estimate
+   size_t launches;
+   size_t rounds;
+};
+
+/* Local Data */
+
+extern char ** environ;
+
+// Paths are relative to the repo root, which is where the Makefile runs us from
+static struct StartupTarget_S Targets[] =
+{
+   { "startup_release",    "`make release` build: dynamic, stdio, tiny-regex",        "build/lin_pid.out" },
+   { "startup_fast_start", "`make release-fast-start` build: static, no stdio/regex", "build/fast_start/lin_pid.out" },
+};
+#define NUM_OF_TARGETS  ( sizeof(Targets) / sizeof(Targets[0]) )
+
+// What a script would typically ask of the CLI
+static char ArgID[]    = "0x27";
+static char ArgQuiet[] = "-q";
+
+/* Private Function Prototypes */
+
+static bool LaunchOnce( const char * exe_path,
+                        const posix_spawn_file_actions_t * actions,
+                        double * elapsed_ns );
+static bool SetUpFileActions( posix_spawn_file_actions_t * actions, int * stdin_pipe );
+static bool RunTarget( const struct StartupTarget_S * target,
+                       size_t rounds,
+                       struct StartupResult_S * result );
+
+static double NowNs(void);
+static int DoubleCmp( const void * a, const void * b );
+static double Percentile( double * sorted, size_t n, double pct );
+static bool WriteJSON( const char * path,
+                       const struct StartupResult_S * results,
+                       const bool * ran );
+static void PrintUsage(const char * prog);
+
+/* Meat of the Program */
+
+int main( int argc, char * argv[] )
+{
+   const char * json_path = NULL;
+   const char * only_scenario = NULL;
+   size_t rounds = DEFAULT_NUM_OF_ROUNDS;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp(argv[i], "--json") == 0) && ((i + 1) < argc) )
+      {
+         json_path = argv[++i];
+      }
+      else if ( (strcmp(argv[i], "--scenario") == 0) && ((i + 1) < argc) )
+      {
+         only_scenario = argv[++i];
+      }
+      else if ( (strcmp(argv[i], "--rounds") == 0) && ((i + 1) < argc) )
+      {
+         long r = strtol(argv[++i], NULL, 10);
+         if ( r <= 0 )
+         {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+         }
+         rounds = (size_t)r;
+      }
+      else if ( (strcmp(argv[i], "--exe") == 0) && ((i + 2) < argc) )
+      {
+         // Point one of the scenarios at a different executable
+         const char * name = argv[++i];
+         const char * path = argv[++i];
+         bool found = false;
+         for ( size_t t = 0; t < NUM_OF_TARGETS; t++ )
+         {
+            if ( strcmp(Targets[t].name, name) == 0 )
+            {
+               Targets[t].exe_path = path;
+               found = true;
+            }
+         }
+         if ( !found )
+         {
+            fprintf(stderr, "Unknown scenario: %s\n", name);
+            return EXIT_FAILURE;
+         }
+      }
+      else if ( strcmp(argv[i], "--list") == 0 )
+      {
+         for ( size_t t = 0; t < NUM_OF_TARGETS; t++ )
+         {
+            printf("%-22s %s\n", Targets[t].name, Targets[t].description);
+         }
+         return EXIT_SUCCESS;
+      }
+      else
+      {
+         PrintUsage(argv[0]);
+         return EXIT_FAILURE;
+      }
+   }
+
+   struct StartupResult_S results[NUM_OF_TARGETS];
+   bool ran[NUM_OF_TARGETS] = { false };
+   bool any_ran = false;
+
+   printf("\n%-22s %9s %9s %9s %9s %9s %9s %9s %8s\n",
+          "Scenario", "min (us)", "mean (us)", "p50 (us)", "p90 (us)",
+          "p99 (us)", "max (us)", "stddev", "noise");
+   printf("-----------------------------------------------------------------------------------------------------\n");
+
+   for ( size_t t = 0; t < NUM_OF_TARGETS; t++ )
+   {
+      if ( (only_scenario != NULL) && (strcmp(only_scenario, Targets[t].name) != 0) )
+      {
+         continue;
+      }
+      any_ran = true;
+
+      if ( access(Targets[t].exe_path, X_OK) != 0 )
+      {
+         printf("%-22s skipped: %s has not been built\n", Targets[t].name, Targets[t].exe_path);
+         continue;
+      }
+
+      if ( !RunTarget(&Targets[t], rounds, &results[t]) )
+      {
+         fprintf(stderr, "Failed to launch %s\n", Targets[t].exe_path);
+         return EXIT_FAILURE;
+      }
+      ran[t] = true;
+
+      printf("%-22s %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %7.1f%%\n",
+             Targets[t].name,
+             results[t].min_ns / NS_PER_US,
+             results[t].mean_ns / NS_PER_US,
+             results[t].p50_ns / NS_PER_US,
+             results[t].p90_ns / NS_PER_US,
+             results[t].p99_ns / NS_PER_US,
+             results[t].max_ns / NS_PER_US,
+             results[t].stddev_ns / NS_PER_US,
+             results[t].p50_spread_pct);
+   }
+   printf("\n");
+
+   if ( !any_ran )
+   {
+      fprintf(stderr, "Unknown scenario: %s\n", only_scenario);
+      return EXIT_FAILURE;
+   }
+
+   if ( (json_path != NULL) && !WriteJSON(json_path, results, ran) )
+   {
+      fprintf(stderr, "Failed to write benchmark results to %s\n", json_path);
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief Give every child stdout -> /dev/null and stdin -> the read end of a
+ *        pipe that we keep open, as a script's stdin often is. The ID on the
+ *        command line keeps the CLI on the single-ID path regardless.
+ */
+static bool SetUpFileActions( posix_spawn_file_actions_t * actions, int * stdin_pipe )
+{
+   assert( (actions != NULL) && (stdin_pipe != NULL) );
+
+   if ( pipe(stdin_pipe) != 0 )
+   {
+      return false;
+   }
+   // Only the dup2'd copy should make it into the child
+   (void)fcntl(stdin_pipe[0], F_SETFD, FD_CLOEXEC);
+   (void)fcntl(stdin_pipe[1], F_SETFD, FD_CLOEXEC);
+
+   if ( posix_spawn_file_actions_init(actions) != 0 )
+   {
+      return false;
+   }
+
+   return ( posix_spawn_file_actions_adddup2(actions, stdin_pipe[0], STDIN_FILENO) == 0 ) &&
+          ( posix_spawn_file_actions_addopen(actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0) == 0 );
+}
+
+/**
+ * @brief Spawn the executable once and wait for it to exit.
+ * @param elapsed_ns Time from just before posix_spawn() to just after the
+ *                   child has been reaped.
+ * @return false if the launch failed or the CLI didn't exit cleanly.
+ */
+static bool LaunchOnce( const char * exe_path,
+                        const posix_spawn_file_actions_t * actions,
+                        double * elapsed_ns )
+{
+   assert( (exe_path != NULL) && (actions != NULL) && (elapsed_ns != NULL) );
+
+   char * child_argv[] = { (char *)exe_path, ArgID, ArgQuiet, NULL };
+   pid_t child;
+   int status;
+
+   double start = NowNs();
+   if ( posix_spawn(&child, exe_path, actions, NULL, child_argv, environ) != 0 )
+   {
+      return false;
+   }
+   if ( waitpid(child, &status, 0) != child )
+   {
+      return false;
+   }
+   *elapsed_ns = NowNs() - start;
+
+   return WIFEXITED(status) && (EXIT_SUCCESS == WEXITSTATUS(status));
+}
+
+static bool RunTarget( const struct StartupTarget_S * target,
+                       size_t rounds,
+                       struct StartupResult_S * result )
+{
+   assert( (target != NULL) && (result != NULL) && (rounds > 0) );
+
+   posix_spawn_file_actions_t actions;
+   int stdin_pipe[2] = { -1, -1 };
+   bool success = SetUpFileActions(&actions, stdin_pipe);
+
+   size_t num_launches = rounds * LAUNCHES_PER_ROUND;
+   double * all = malloc( num_launches * sizeof(double) );
+   double * round_p50 = malloc( rounds * sizeof(double) );
+   double * round_p99 = malloc( rounds * sizeof(double) );
+   double samples[LAUNCHES_PER_ROUND];
+   success = success && (all != NULL) && (round_p50 != NULL) && (round_p99 != NULL);
+
+   double dummy;
+   for ( size_t i = 0; success && (i < WARMUP_LAUNCHES); i++ )
+   {
+      success = LaunchOnce(target->exe_path, &actions, &dummy);
+   }
+
+   double sum = 0.0;
+   for ( size_t r = 0; success && (r < rounds); r++ )
+   {
+      for ( size_t s = 0; success && (s < LAUNCHES_PER_ROUND); s++ )
+      {
+         success = LaunchOnce(target->exe_path, &actions, &samples[s]);
+         all[(r * LAUNCHES_PER_ROUND) + s] = samples[s];
+         sum += samples[s];
+      }
+      qsort(samples, LAUNCHES_PER_ROUND, sizeof(double), DoubleCmp);
+      round_p50[r] = Percentile(samples, LAUNCHES_PER_ROUND, 50.0);
+      round_p99[r] = Percentile(samples, LAUNCHES_PER_ROUND, 99.0);
+   }
+
+   if ( success )
+   {
+      double mean = sum / (double)num_launches;
+      double sq_dev = 0.0;
+      for ( size_t i = 0; i < num_launches; i++ )
+      {
+         sq_dev += (all[i] - mean) * (all[i] - mean);
+      }
+
+      qsort(all, num_launches, sizeof(double), DoubleCmp);
+      qsort(round_p50, rounds, sizeof(double), DoubleCmp);
+      qsort(round_p99, rounds, sizeof(double), DoubleCmp);
+
+      result->min_ns = all[0];
+      result->mean_ns = mean;
+      result->p50_ns = Percentile(round_p50, rounds, 50.0);
+      result->p90_ns = Percentile(all, num_launches, 90.0);
+      result->p99_ns = Percentile(round_p99, rounds, 50.0);
+      result->max_ns = all[num_launches - 1];
+      result->stddev_ns = sqrt( sq_dev / (double)num_launches );
+      result->launches_per_sec = NS_PER_SEC / mean;
+      result->p50_spread_pct = 100.0 * (round_p50[rounds - 1] - round_p50[0]) / result->p50_ns;
+      result->launches = num_launches;
+      result->rounds = rounds;
+   }
+
+   free(all);
+   free(round_p50);
+   free(round_p99);
+   (void)posix_spawn_file_actions_destroy(&actions);
+   for ( size_t i = 0; i < 2; i++ )
+   {
+      if ( stdin_pipe[i] >= 0 )
+      {
+         close(stdin_pipe[i]);
+      }
+   }
+
+   return success;
+}
+
+static double NowNs(void)
+{
+   struct timespec ts;
+   (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ((double)ts.tv_sec * NS_PER_SEC) + (double)ts.tv_nsec;
+}
+
+static int DoubleCmp( const void * a, const void * b )
+{
+   assert( (a != NULL) && (b != NULL) );
+
+   double c = *(const double *)a;
+   double d = *(const double *)b;
+
+   return (c > d) - (c < d);
+}
+
+static double Percentile( double * sorted, size_t n, double pct )
+{
+   assert( (sorted != NULL) && (n > 0) );
+
+   size_t idx = (size_t)( (pct / 100.0) * (double)(n - 1) + 0.5 );
+   return sorted[ (idx < n) ? idx : (n - 1) ];
+}
+
+static bool WriteJSON( const char * path,
+                       const struct StartupResult_S * results,
+                       const bool * ran )
+{
+   assert( (path != NULL) && (results != NULL) && (ran != NULL) );
+
+   FILE * fp = fopen(path, "w");
+   if ( NULL == fp )
+   {
+      return false;
+   }
+
+   fprintf(fp, "{\n");
+   fprintf(fp, "  \"schema\": %d,\n", JSON_SCHEMA_VERSION);
+#ifdef __VERSION__
+   fprintf(fp, "  \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+   fprintf(fp, "  \"scenarios\": [\n");
+
+   bool first = true;
+   for ( size_t t = 0; t < NUM_OF_TARGETS; t++ )
+   {
+      if ( !ran[t] )
+      {
+         continue;
+      }
+      fprintf(fp, "%s    {\n", first ? "" : ",\n");
+      fprintf(fp, "      \"name\": \"%s\",\n", Targets[t].name);
+      fprintf(fp, "      \"ns_per_op\": %.3f,\n", results[t].mean_ns);
+      fprintf(fp, "      \"min_ns\": %.3f,\n", results[t].min_ns);
+      fprintf(fp, "      \"p50_ns\": %.3f,\n", results[t].p50_ns);
+      fprintf(fp, "      \"p90_ns\": %.3f,\n", results[t].p90_ns);
+      fprintf(fp, "      \"p99_ns\": %.3f,\n", results[t].p99_ns);
+      fprintf(fp, "      \"max_ns\": %.3f,\n", results[t].max_ns);
+      fprintf(fp, "      \"stddev_ns\": %.3f,\n", results[t].stddev_ns);
+      fprintf(fp, "      \"launches_per_sec\": %.1f,\n", results[t].launches_per_sec);
+      fprintf(fp, "      \"p50_spread_pct\": %.3f,\n", results[t].p50_spread_pct);
+      fprintf(fp, "      \"launches\": %zu,\n", results[t].launches);
+      fprintf(fp, "      \"rounds\": %zu\n", results[t].rounds);
+      fprintf(fp, "    }");
+      first = false;
+   }
+
+   fprintf(fp, "\n  ]\n}\n");
+
+   return (fclose(fp) == 0);
+}
+
+static void PrintUsage(const char * prog)
+{
+   fprintf(stderr,
+      "Usage: %s [--json <path>] [--scenario <name>] [--rounds <n>]\n"
+      "       [--exe <scenario> <path>] [--list]\n",
+      prog);
+}
@@ -0,0 +1,120 @@
+"""Compare benchmark results JSON against the committed baseline.
+
+Both arguments may either be a single JSON file or a directory of them (one per
+benchmark executable), in which case their scenarios are pooled and matched up
+by scenario name.
+
+A scenario counts as a regression when its p50 (or p99) got slower than the
+baseline by more than the allowed margin. The margin is noise-aware: it is the
+larger of a fixed percentage and a multiple of the run-to-run spread that both
+the baseline and the current run measured for that scenario.
+
+Exits non-zero if any scenario regressed or if a baseline scenario is missing
+from the current results. The names of the regressed scenarios are optionally
+written one-per-line to a file so the Makefile can profile them.
+"""
+import argparse
+import json
+import os
+import sys
+
+# Define colors
+RED = "\033[1;31m"
+GREEN = "\033[1;32m"
+YEL = "\033[0;33m"
+RESET = "\033[0m"
+
+
+def load_scenarios(path):
+    with open(path, "r", encoding="utf-8") as f:
+        data = json.load(f)
+    return {s["name"]: s for s in data.get("scenarios", [])}
+
+
+def load_all(path):
+    """Load every scenario found at path (a JSON file or a directory of them)."""
+    if not os.path.isdir(path):
+        return load_scenarios(path)
+
+    scenarios = {}
+    for fname in sorted(os.listdir(path)):
+        if fname.endswith(".json"):
+            scenarios.update(load_scenarios(os.path.join(path, fname)))
+    return scenarios
+
+
+def pct_change(base, cur):
+    if base <= 0.0:
+        return 0.0
+    return 100.0 * (cur - base) / base
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold-pct", type=float, default=10.0,
+                        help="minimum p50 slowdown (%%) treated as a regression")
+    parser.add_argument("--p99-threshold-pct", type=float, default=25.0,
+                        help="minimum p99 slowdown (%%) treated as a regression")
+    parser.add_argument("--noise-factor", type=float, default=1.5,
+                        help="multiple of the measured run-to-run spread to tolerate")
+    parser.add_argument("--regressions-out", default=None,
+                        help="file to write the names of regressed scenarios to")
+    args = parser.parse_args()
+
+    baseline = load_all(args.baseline)
+    current = load_all(args.current)
+
+    regressed = []
+    missing = []
+    print(f"\n{'Scenario':<22} {'base p50':>10} {'cur p50':>10} {'delta':>8} "
+          f"{'base p99':>10} {'cur p99':>10} {'delta':>8} {'allowed':>8}")
+    print("-" * 94)
+
+    for name, base in baseline.items():
+        cur = current.get(name)
+        if cur is None:
+            print(f"{RED}{name:<22} missing from current results{RESET}")
+            missing.append(name)
+            continue
+
+        noise = max(base.get("p50_spread_pct", 0.0), cur.get("p50_spread_pct", 0.0))
+        allowed_p50 = max(args.threshold_pct, args.noise_factor * noise)
+        allowed_p99 = max(args.p99_threshold_pct, args.noise_factor * noise)
+
+        d50 = pct_change(base["p50_ns"], cur["p50_ns"])
+        d99 = pct_change(base["p99_ns"], cur["p99_ns"])
+        is_regression = (d50 > allowed_p50) or (d99 > allowed_p99)
+
+        color = RED if is_regression else GREEN
+        print(f"{color}{name:<22} {base['p50_ns']:>10.2f} {cur['p50_ns']:>10.2f} {d50:>+7.1f}% "
+              f"{base['p99_ns']:>10.2f} {cur['p99_ns']:>10.2f} {d99:>+7.1f}% {allowed_p50:>7.1f}%{RESET}")
+
+        if is_regression:
+            regressed.append(name)
+
+    for name in current:
+        if name not in baseline:
+            print(f"{YEL}{name:<22} new scenario (no baseline){RESET}")
+
+    if args.regressions_out is not None:
+        with open(args.regressions_out, "w", encoding="utf-8") as f:
+            for name in regressed:
+                f.write(name + "\n")
+
+    print()
+    if missing:
+        print(f"{RED}Baseline scenarios missing from current results: {', '.join(missing)}{RESET}")
+    if regressed:
+        print(f"{RED}Performance regression detected in: {', '.join(regressed)}{RESET}")
+    if missing or regressed:
+        print()
+        return 1
+
+    print(f"{GREEN}No performance regressions detected.{RESET}\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,357 @@
+"""Generate the perfect hash of every ID spelling lin_pid takes.
+
+Runs GetID()'s state machine and DetermineEntryFormat()'s first-match rule
+(both ported from lin_pid.c) over every token of up to four characters, with
+no flag, with --hex and with --dec. Each token GetID() accepts as an ID in
+range, and that one of the formats in lin_pid_supported_formats.h mirrors,
+goes into a hash-and-displace table keyed by the token's bytes.
+LookupIDSpelling() in lin_pid.c answers from that table in one probe and
+leaves everything else (errors included) to the state machine.
+
+The hash is spelled out twice, here and in IDSpellingSlot() in lin_pid.c.
+
+GetID()'s state machine exists three times. It is in lin_pid.c, get_id() in
+lin_pid.hpp and get_id() here, so change all three together.
+test_LookupIDSpelling_AgreesWithGetID_EveryShortToken (test_lin_pid.c) checks
+every short token against GetID(). It fails if this port or the hash drifts.
+test_parse_id_AgreesWithParseID (test_lin_pid_hpp.cpp) does the same for the
+C++ copy.
+"""
+import argparse
+import itertools
+import re
+import sys
+
+FORMAT_ROW = re.compile(
+    r'^LIN_PID_NUMERIC_FORMAT\(\s*(\w+)\s*,\s*"([^"]*)"\s*,\s*"[^"]*"\s*,'
+    r'\s*(true|false)\s*,\s*(true|false)\s*,')
+
+DEC_DIGIT = set("0123456789")
+HEX_DIGIT = DEC_DIGIT | set("abcdefABCDEF")
+HEX_PREFIX = set("xX")
+HEX_SUFFIX = set("hHxX")
+DEC_SUFFIX = set("dD")
+
+# Anything else fails GetID() wherever it shows up
+ALPHABET = sorted(HEX_DIGIT | HEX_PREFIX | HEX_SUFFIX | DEC_SUFFIX)
+
+MAX_TOKEN_LEN = 4           # strlen("0x3F"); GetID() turns away anything longer
+MAX_ID_ALLOWED = 0x3F
+
+# ASCII leaves bit 7 of every byte clear, so the flags ride along in the key
+KEY_FLAG_HEX = 0x00000080
+KEY_FLAG_DEC = 0x00008000
+
+MASK32 = 0xFFFFFFFF
+MAX_SEED = 0xFFFF
+LOAD_FACTOR = 0.8
+
+
+def load_formats(path):
+    formats = []
+    with open(path, "r", encoding="utf-8") as f:
+        for line in f:
+            m = FORMAT_ROW.match(line.strip())
+            if m:
+                name, regex, ishex, isdec = m.groups()
+                formats.append((name, re.compile(regex), ishex == "true", isdec == "true"))
+    if not formats:
+        sys.exit(f"No LIN_PID_NUMERIC_FORMAT rows in {path}")
+    return formats
+
+
+def get_id(token, ishex, isdec):
+    """GetID(), state for state. Returns (id, ishex, isdec) or None on an error.
+
+    Keep in step with GetID() in lin_pid.c and get_id() in lin_pid.hpp.
+    """
+    state = "PreemptivelyHex" if ishex else ("PreemptivelyDec" if isdec else "Init")
+    first = second = None
+    assume_hex, assume_dec = ishex, isdec
+    prefix_seen = False
+
+    for ch in token:
+        if state == "Init":
+            if ch == "0":
+                first, state = ch, "OneZeroIn"
+            elif ch in HEX_DIGIT:
+                if ch in DEC_DIGIT:
+                    state = "IndeterminateOneDigitIn"
+                else:
+                    assume_hex, state = True, "HexDigits"
+                first = ch
+            elif ch in HEX_PREFIX:
+                assume_hex, prefix_seen, state = True, True, "HexPrefix"
+            else:
+                return None
+        elif state == "OneZeroIn":
+            if ch == "0":
+                second, state = ch, "TwoZerosIn"
+            elif ch in HEX_PREFIX:
+                assume_hex, prefix_seen, state = True, True, "HexPrefix"
+            elif ch in HEX_DIGIT:
+                if ch not in DEC_DIGIT:
+                    assume_hex, state = True, "TwoHexDigits"
+                else:
+                    state = "IndeterminateTwoDigitsIn"
+                first = ch
+            elif ch in HEX_SUFFIX:
+                assume_hex, state = True, "TwoDigitsAlreadyRead"
+            else:
+                return None
+        elif state == "HexPrefix":
+            if ch in HEX_DIGIT:
+                first, state = ch, "HexDigits"
+            else:
+                return None
+        elif state == "IndeterminateOneDigitIn":
+            if ch in HEX_DIGIT:
+                if ch in DEC_DIGIT:
+                    state = "IndeterminateTwoDigitsIn"
+                else:
+                    assume_hex, state = True, "TwoHexDigits"
+                second = ch
+            elif ch in HEX_SUFFIX:
+                assume_hex, state = True, "TwoDigitsAlreadyRead"
+            else:
+                return None
+        elif state in ("IndeterminateTwoDigitsIn", "TwoZerosIn"):
+            if not assume_dec and ch in HEX_SUFFIX:
+                assume_hex, state = True, "TwoDigitsAlreadyRead"
+            elif not assume_hex and ch in DEC_SUFFIX:
+                assume_dec, state = True, "TwoDigitsAlreadyRead"
+            else:
+                return None
+        elif state == "OneDecDigit":
+            if ch in DEC_DIGIT:
+                second, state = ch, "TwoDecDigits"
+            else:
+                return None
+        elif state == "TwoDecDigits":
+            if ch in DEC_SUFFIX:
+                state = "TwoDigitsAlreadyRead"
+            else:
+                return None
+        elif state == "HexDigits":
+            if ch in HEX_DIGIT:
+                second, state = ch, "TwoHexDigits"
+            elif ch in HEX_SUFFIX and not prefix_seen:
+                assume_hex, state = True, "TwoDigitsAlreadyRead"
+            else:
+                return None
+        elif state == "TwoHexDigits":
+            if ch in HEX_SUFFIX and not prefix_seen:
+                state = "TwoDigitsAlreadyRead"
+            else:
+                return None
+        elif state == "TwoDigitsAlreadyRead":
+            return None
+        elif state == "PreemptivelyHex":
+            if ch in HEX_PREFIX:
+                prefix_seen, state = True, "HexPrefix"
+            elif ch == "0":
+                first, state = ch, "OneZeroIn"
+            elif ch in HEX_DIGIT:
+                first, state = ch, "HexDigits"
+            else:
+                return None
+        elif state == "PreemptivelyDec":
+            if ch in HEX_PREFIX or (ch in HEX_DIGIT and ch not in DEC_DIGIT):
+                return None
+            elif ch == "0":
+                first, state = ch, "PreemptivelyDecOneZeroIn"
+            elif ch in DEC_DIGIT:
+                first, state = ch, "OneDecDigit"
+            else:
+                return None
+        elif state == "PreemptivelyDecOneZeroIn":
+            if ch in HEX_PREFIX or (ch in HEX_DIGIT and ch not in DEC_DIGIT):
+                return None
+            elif ch == "0":
+                state = "PreemptivelyDecTwoZerosIn"
+            elif ch in DEC_DIGIT:
+                first, state = ch, "TwoDecDigits"
+            else:
+                return None
+        elif state == "PreemptivelyDecTwoZerosIn":
+            if ch in DEC_SUFFIX:
+                state = "TwoDigitsAlreadyRead"
+            else:
+                return None
+        else:
+            raise AssertionError(state)
+
+    if first is None:
+        # Only a prefix (or nothing a digit could come from) was entered
+        return None
+
+    if second is None:
+        msd, lsd = 0, int(first, 16)
+    else:
+        msd, lsd = int(first, 16), int(second, 16)
+
+    if msd == 0 and lsd == 0:
+        value = 0
+    elif assume_hex or not assume_dec:
+        value = msd * 0x10 + lsd
+    else:
+        value = msd * 10 + lsd
+    return value, assume_hex, assume_dec
+
+
+def determine_entry_format(formats, token, ishex, isdec):
+    """DetermineEntryFormat(): the first format that spells the token, if any."""
+    for idx, (_, regex, fmt_ishex, fmt_isdec) in enumerate(formats):
+        if (ishex and fmt_isdec) or (isdec and fmt_ishex):
+            continue
+        if regex.match(token):
+            return idx
+    return None
+
+
+def pack_key(token, ishex, isdec):
+    key = 0
+    for i, ch in enumerate(token):
+        key |= ord(ch) << (8 * i)
+    if ishex:
+        key |= KEY_FLAG_HEX
+    if isdec:
+        key |= KEY_FLAG_DEC
+    return key
+
+
+def spellings(formats):
+    """Every (key, token, flag, id, format, ishex, isdec) the table answers for."""
+    found = []
+    for ishex, isdec, flag in ((False, False, ""), (True, False, "--hex"), (False, True, "--dec")):
+        for length in range(1, MAX_TOKEN_LEN + 1):
+            for chars in itertools.product(ALPHABET, repeat=length):
+                token = "".join(chars)
+                parsed = get_id(token, ishex, isdec)
+                if parsed is None or parsed[0] > MAX_ID_ALLOWED:
+                    continue
+                value, out_hex, out_dec = parsed
+                fmt = determine_entry_format(formats, token, out_hex, out_dec)
+                if fmt is None:
+                    continue
+                found.append((pack_key(token, ishex, isdec), token, flag, value, fmt, out_hex, out_dec))
+    return found
+
+
+def bucket_of(key, bucket_bits):
+    return ((key * 0x9E3779B1) & MASK32) >> (32 - bucket_bits)
+
+
+def slot_of(key, seed, slot_bits):
+    h = ((key ^ seed) * 0x85EBCA6B) & MASK32
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & MASK32
+    return h >> (32 - slot_bits)
+
+
+def build_table(keys, slot_bits, bucket_bits):
+    """Hash and displace: a seed per bucket that puts its keys in free slots."""
+    buckets = [[] for _ in range(1 << bucket_bits)]
+    for key in keys:
+        buckets[bucket_of(key, bucket_bits)].append(key)
+
+    seeds = [0] * (1 << bucket_bits)
+    taken = [None] * (1 << slot_bits)
+    order = sorted(range(len(buckets)), key=lambda b: len(buckets[b]), reverse=True)
+    for b in order:
+        if not buckets[b]:
+            break
+        for seed in range(MAX_SEED + 1):
+            slots = {slot_of(key, seed, slot_bits) for key in buckets[b]}
+            if len(slots) == len(buckets[b]) and all(taken[s] is None for s in slots):
+                break
+        else:
+            return None
+        seeds[b] = seed
+        for key in buckets[b]:
+            taken[slot_of(key, seed, slot_bits)] = key
+    return seeds, taken
+
+
+def write_header(path, formats, entries, seeds, taken, slot_bits, bucket_bits):
+    by_key = {e[0]: e for e in entries}
+    lines = [
+        "/**",
+        " * @file lin_pid_id_spellings.h",
+        " * @brief Perfect hash of every ID spelling lin_pid takes, for LookupIDSpelling().",
+        " *",
+        " * @note Generated by scripts/gen_id_spellings.py from",
+        " *       lin_pid_supported_formats.h; don't edit it by hand.",
+        " */",
+        "",
+        "#ifndef LIN_PID_ID_SPELLINGS_H",
+        "#define LIN_PID_ID_SPELLINGS_H",
+        "",
+        f"#define ID_SPELLING_BUCKET_BITS        {bucket_bits}u",
+        f"#define ID_SPELLING_SLOT_BITS          {slot_bits}u",
+        f"#define NUM_OF_ID_SPELLINGS            {len(entries)}u",
+        "",
+        "// A key is the token's bytes, first in the low byte, and the flag it came with",
+        f"#define ID_SPELLING_MAX_LEN            {MAX_TOKEN_LEN}u",
+        f"#define ID_SPELLING_KEY_HEX            0x{KEY_FLAG_HEX:08X}u",
+        f"#define ID_SPELLING_KEY_DEC            0x{KEY_FLAG_DEC:08X}u",
+        "",
+        "static const uint16_t IDSpellingSeeds[1u << ID_SPELLING_BUCKET_BITS] =",
+        "{",
+    ]
+    for i in range(0, len(seeds), 8):
+        lines.append("   " + " ".join(f"0x{s:04X}," for s in seeds[i:i + 8]))
+    lines += [
+        "};",
+        "",
+        "static const struct IDSpelling_S IDSpellings[1u << ID_SPELLING_SLOT_BITS] =",
+        "{",
+    ]
+    for key in taken:
+        if key is None:
+            lines.append("   { 0x00000000u, 0x00u, 0u, false, false },")
+            continue
+        _, token, flag, value, fmt, ishex, isdec = by_key[key]
+        entry = (f"   {{ 0x{key:08X}u, 0x{value:02X}u, {formats[fmt][0]}, "
+                 f"{'true' if ishex else 'false'}, {'true' if isdec else 'false'} }},")
+        note = f'"{token}"' + (f" {flag}" if flag else "")
+        lines.append(f"{entry:<92}// {note}")
+    lines += [
+        "};",
+        "",
+        "#endif // LIN_PID_ID_SPELLINGS_H",
+        "",
+    ]
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("formats", help="lin_pid_supported_formats.h")
+    parser.add_argument("output", help="the header to write")
+    args = parser.parse_args()
+
+    formats = load_formats(args.formats)
+    entries = spellings(formats)
+    keys = [e[0] for e in entries]
+    assert len(set(keys)) == len(keys)
+
+    slot_bits = 1
+    while (1 << slot_bits) * LOAD_FACTOR < len(keys):
+        slot_bits += 1
+    # Fewer buckets keep the seed table small; take the fewest that still works
+    for bucket_bits in range(max(1, slot_bits - 3), slot_bits + 1):
+        table = build_table(keys, slot_bits, bucket_bits)
+        if table is not None:
+            break
+    else:
+        sys.exit("No perfect hash found; raise ID_SPELLING_SLOT_BITS")
+
+    seeds, taken = table
+    write_header(args.output, formats, entries, seeds, taken, slot_bits, bucket_bits)
+    print(f"{len(keys)} spellings in {1 << slot_bits} slots, {1 << bucket_bits} buckets")
+
+
+if __name__ == "__main__":
+    main()
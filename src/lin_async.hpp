@@ -0,0 +1,494 @@
+/*!
+ * @file    lin_async.hpp
+ * @brief   C++20 coroutine pipeline for decoding many capture streams at
+ *          once on one thread: decoder stages are async generators that
+ *          co_yield frames, resumed by an epoll-based IoExecutor whenever
+ *          their fd has more to read.
+ *
+ *    IoExecutor        Owns the epoll set and the top-level Tasks; run() until
+ *                      every Task has finished.
+ *    Task              A top-level coroutine handed to IoExecutor::spawn().
+ *    AsyncGenerator<T> A stage: co_yield values, co_await readable(), and its
+ *                      consumer pulls with `co_await gen.next()`, which comes
+ *                      back nullptr at the end.
+ *    decode_frames<>   The stage that reads a non-blocking fd and runs a
+ *                      FrameDecoder over it.
+ *
+ * Decoding allocates nothing once a stage is running: frames are decoded into
+ * a batch inside the coroutine frame, which every resumption reuses, and PIDs
+ * are checked against lin_pid::pid_table. The coroutine frames themselves come
+ * from a per-thread pool, so a stream that ends hands its frame to the next.
+ * Linux only.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_ASYNC_HPP
+#define LIN_ASYNC_HPP
+
+/* File Inclusions */
+#include <cassert>
+#include <cerrno>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <utility>
+#include <sys/epoll.h>
+#include <unistd.h>
+#include "lin_frame_decoder.hpp"
+
+namespace lin_pid
+{
+
+/* Public Constants */
+
+constexpr std::size_t stream_read_len = 256u;
+// A frame takes at least a break, sync and PID, plus one left over from the
+// last read and one flushed at the end
+constexpr std::size_t max_frames_per_read = ( stream_read_len / 3u ) + 2u;
+
+namespace detail
+{
+
+/**
+ * @brief Free lists of coroutine frames by size class. Single-threaded like
+ *        the executor, so there's one per thread.
+ */
+class CoroutineFramePool
+{
+public:
+   static constexpr std::size_t granule = 64u;
+   static constexpr std::size_t num_of_classes = 128u;  // Up to 8 KiB; bigger goes to the heap
+
+   CoroutineFramePool() = default;
+   CoroutineFramePool( const CoroutineFramePool & ) = delete;
+   CoroutineFramePool & operator=( const CoroutineFramePool & ) = delete;
+
+   ~CoroutineFramePool()
+   {
+      for ( FreeBlock * & head : free_ )
+      {
+         while ( head != nullptr )
+         {
+            FreeBlock * next = head->next;
+            ::operator delete( head );
+            head = next;
+         }
+      }
+   }
+
+   void * allocate( std::size_t size )
+   {
+      const std::size_t cls = size_class( size );
+      if ( cls >= num_of_classes )
+      {
+         return ::operator new( size );
+      }
+      if ( free_[cls] != nullptr )
+      {
+         FreeBlock * block = free_[cls];
+         free_[cls] = block->next;
+         return block;
+      }
+      blocks_++;
+      return ::operator new( (cls + 1u) * granule );
+   }
+
+   void release( void * ptr, std::size_t size ) noexcept
+   {
+      const std::size_t cls = size_class( size );
+      if ( cls >= num_of_classes )
+      {
+         ::operator delete( ptr );
+         return;
+      }
+      FreeBlock * block = static_cast<FreeBlock *>( ptr );
+      block->next = free_[cls];
+      free_[cls] = block;
+   }
+
+   // How many blocks were ever taken from the heap
+   std::size_t blocks() const noexcept { return blocks_; }
+
+private:
+   struct FreeBlock
+   {
+      FreeBlock * next;
+   };
+
+   static constexpr std::size_t size_class( std::size_t size ) noexcept
+   {
+      return ( size > 0u ) ? ((size - 1u) / granule) : 0u;
+   }
+
+   FreeBlock * free_[num_of_classes] {};
+   std::size_t blocks_ = 0;
+};
+
+inline CoroutineFramePool & frame_pool()
+{
+   static thread_local CoroutineFramePool pool;
+   return pool;
+}
+
+// Coroutine frames of every promise here come from frame_pool()
+struct PooledPromise
+{
+   static void * operator new( std::size_t size ) { return frame_pool().allocate( size ); }
+   static void operator delete( void * ptr, std::size_t size ) noexcept { frame_pool().release( ptr, size ); }
+};
+
+} // namespace detail
+
+class IoExecutor;
+
+/* Task */
+
+class Task
+{
+public:
+   struct promise_type : detail::PooledPromise
+   {
+      IoExecutor * executor = nullptr;
+
+      Task get_return_object() noexcept
+      {
+         return Task( std::coroutine_handle<promise_type>::from_promise(*this) );
+      }
+      std::suspend_always initial_suspend() noexcept { return {}; }
+      auto final_suspend() noexcept;
+      void return_void() noexcept {}
+      void unhandled_exception() noexcept { std::terminate(); }
+   };
+
+   Task( Task && other ) noexcept : handle_( std::exchange(other.handle_, nullptr) ) {}
+   Task( const Task & ) = delete;
+   Task & operator=( const Task & ) = delete;
+   Task & operator=( Task && ) = delete;
+
+   ~Task()
+   {
+      if ( handle_ )
+      {
+         handle_.destroy();
+      }
+   }
+
+private:
+   friend class IoExecutor;
+
+   explicit Task( std::coroutine_handle<promise_type> handle ) noexcept : handle_( handle ) {}
+
+   std::coroutine_handle<promise_type> handle_;
+};
+
+/* IoExecutor */
+
+class IoExecutor
+{
+public:
+   IoExecutor() noexcept : epoll_fd_( epoll_create1(EPOLL_CLOEXEC) ) {}
+   IoExecutor( const IoExecutor & ) = delete;
+   IoExecutor & operator=( const IoExecutor & ) = delete;
+
+   ~IoExecutor()
+   {
+      if ( epoll_fd_ >= 0 )
+      {
+         (void)close( epoll_fd_ );
+      }
+   }
+
+   bool ok() const noexcept { return epoll_fd_ >= 0; }
+   std::size_t live_tasks() const noexcept { return live_tasks_; }
+
+   /**
+    * @brief Start task; it runs up to its first suspension right away.
+    */
+   void spawn( Task task )
+   {
+      std::coroutine_handle<Task::promise_type> handle = std::exchange( task.handle_, nullptr );
+      handle.promise().executor = this;
+      live_tasks_++;
+      handle.resume();
+   }
+
+   /**
+    * @brief Resume whatever's waiting on an fd that became readable, waiting
+    *        up to timeout_ms (-1 for as long as it takes).
+    *
+    * @return false if epoll failed.
+    */
+   bool run_once( int timeout_ms )
+   {
+      epoll_event events[max_events];
+      int num_events = epoll_wait( epoll_fd_, events, static_cast<int>(max_events), timeout_ms );
+      if ( num_events < 0 )
+      {
+         return ( EINTR == errno );
+      }
+      for ( int i = 0; i < num_events; i++ )
+      {
+         std::coroutine_handle<>::from_address( events[i].data.ptr ).resume();
+      }
+      return true;
+   }
+
+   /**
+    * @brief Run until every spawned Task has finished.
+    *
+    * @return false if epoll failed.
+    */
+   bool run()
+   {
+      while ( live_tasks_ > 0u )
+      {
+         if ( !run_once(-1) )
+         {
+            return false;
+         }
+      }
+      return true;
+   }
+
+   /**
+    * @brief co_await this to suspend until fd has something to read. Resumes
+    *        right away for an fd epoll can't watch, such as a regular file.
+    */
+   auto readable( int fd ) noexcept
+   {
+      struct Awaiter
+      {
+         IoExecutor & executor;
+         int fd;
+
+         bool await_ready() const noexcept { return false; }
+         bool await_suspend( std::coroutine_handle<> waiter ) const noexcept
+         {
+            epoll_event event {};
+            event.events = EPOLLIN | EPOLLONESHOT;
+            event.data.ptr = waiter.address();
+            // One shot, so after the first wait the fd only needs re-arming
+            if ( epoll_ctl(executor.epoll_fd_, EPOLL_CTL_MOD, fd, &event) == 0 )
+            {
+               return true;
+            }
+            return ( epoll_ctl(executor.epoll_fd_, EPOLL_CTL_ADD, fd, &event) == 0 );
+         }
+         void await_resume() const noexcept {}
+      };
+      return Awaiter { *this, fd };
+   }
+
+   /**
+    * @brief Stop watching fd, once its stream is done with it.
+    */
+   void forget( int fd ) noexcept
+   {
+      (void)epoll_ctl( epoll_fd_, EPOLL_CTL_DEL, fd, nullptr );
+   }
+
+private:
+   friend struct Task::promise_type;
+
+   static constexpr std::size_t max_events = 64u;
+
+   int epoll_fd_;
+   std::size_t live_tasks_ = 0;
+};
+
+inline auto Task::promise_type::final_suspend() noexcept
+{
+   struct Awaiter
+   {
+      bool await_ready() const noexcept { return false; }
+      void await_suspend( std::coroutine_handle<promise_type> handle ) const noexcept
+      {
+         IoExecutor * executor = handle.promise().executor;
+         handle.destroy();
+         if ( executor != nullptr )
+         {
+            executor->live_tasks_--;
+         }
+      }
+      void await_resume() const noexcept {}
+   };
+   return Awaiter {};
+}
+
+/* AsyncGenerator */
+
+template <typename T>
+class AsyncGenerator
+{
+public:
+   struct promise_type : detail::PooledPromise
+   {
+      const T * current = nullptr;
+      std::coroutine_handle<> consumer;
+
+      // Hand the value, or the end, straight back to whoever is waiting in next()
+      struct YieldAwaiter
+      {
+         bool await_ready() const noexcept { return false; }
+         std::coroutine_handle<> await_suspend( std::coroutine_handle<promise_type> handle ) const noexcept
+         {
+            return handle.promise().consumer;
+         }
+         void await_resume() const noexcept {}
+      };
+
+      AsyncGenerator get_return_object() noexcept
+      {
+         return AsyncGenerator( std::coroutine_handle<promise_type>::from_promise(*this) );
+      }
+      std::suspend_always initial_suspend() noexcept { return {}; }
+      YieldAwaiter final_suspend() noexcept
+      {
+         current = nullptr;
+         return {};
+      }
+      YieldAwaiter yield_value( const T & value ) noexcept
+      {
+         current = &value;
+         return {};
+      }
+      void return_void() noexcept {}
+      void unhandled_exception() noexcept { std::terminate(); }
+   };
+
+   AsyncGenerator( AsyncGenerator && other ) noexcept : handle_( std::exchange(other.handle_, nullptr) ) {}
+   AsyncGenerator( const AsyncGenerator & ) = delete;
+   AsyncGenerator & operator=( const AsyncGenerator & ) = delete;
+   AsyncGenerator & operator=( AsyncGenerator && ) = delete;
+
+   ~AsyncGenerator()
+   {
+      if ( handle_ )
+      {
+         handle_.destroy();
+      }
+   }
+
+   /**
+    * @brief co_await this for the next value, or nullptr once the stage is
+    *        done. The value stays good until the next call.
+    */
+   auto next() noexcept
+   {
+      struct Awaiter
+      {
+         std::coroutine_handle<promise_type> handle;
+
+         bool await_ready() const noexcept { return handle.done(); }
+         std::coroutine_handle<> await_suspend( std::coroutine_handle<> consumer ) const noexcept
+         {
+            handle.promise().consumer = consumer;
+            return handle;
+         }
+         const T * await_resume() const noexcept
+         {
+            return handle.done() ? nullptr : handle.promise().current;
+         }
+      };
+      assert( handle_ );
+      return Awaiter { handle_ };
+   }
+
+private:
+   explicit AsyncGenerator( std::coroutine_handle<promise_type> handle ) noexcept : handle_( handle ) {}
+
+   std::coroutine_handle<promise_type> handle_;
+};
+
+/* Decoder Stage */
+
+namespace detail
+{
+
+struct BatchSink
+{
+   CAP_Frame_S * frames;
+   std::size_t * count;
+
+   void operator()( const CAP_Frame_S & frame ) const
+   {
+      assert( *count < max_frames_per_read );
+      frames[(*count)++] = frame;
+   }
+};
+
+} // namespace detail
+
+// GCC before 14 takes the switch it builds over a coroutine's suspend points
+// for one of ours
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 14)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+
+/**
+ * @brief Decode the stream on a non-blocking fd until it ends, yielding each
+ *        frame. The fd is left open; stats, if given, get the decoder's
+ *        counts once the stream ends.
+ */
+template <typename ChecksumPolicy = Lin2Checksum, typename ResyncPolicy = StrictResync>
+AsyncGenerator<CAP_Frame_S> decode_frames( IoExecutor & executor, int fd, DecoderStats * stats = nullptr )
+{
+   CAP_Frame_S batch[max_frames_per_read];
+   std::size_t batch_len = 0;
+   std::uint8_t buf[stream_read_len];
+   FrameDecoder<ChecksumPolicy, ResyncPolicy, detail::BatchSink> decoder( detail::BatchSink { batch, &batch_len } );
+
+   for ( ;; )
+   {
+      ssize_t num_read = read( fd, buf, sizeof(buf) );
+      if ( num_read > 0 )
+      {
+         decoder.feed( buf, static_cast<std::size_t>(num_read) );
+      }
+      else if ( (num_read < 0) && (EAGAIN == errno) )     // Same as EWOULDBLOCK on Linux
+      {
+         co_await executor.readable( fd );
+         continue;
+      }
+      else if ( (num_read < 0) && (EINTR == errno) )
+      {
+         continue;
+      }
+      else
+      {
+         // End of the stream, or an error that ends it just the same
+         decoder.flush();
+      }
+
+      for ( std::size_t i = 0; i < batch_len; i++ )
+      {
+         co_yield batch[i];
+      }
+      batch_len = 0;
+
+      if ( num_read <= 0 )
+      {
+         break;
+      }
+   }
+
+   executor.forget( fd );
+   if ( stats != nullptr )
+   {
+      *stats = decoder.stats();
+   }
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 14)
+#pragma GCC diagnostic pop
+#endif
+
+} // namespace lin_pid
+
+#endif // LIN_ASYNC_HPP
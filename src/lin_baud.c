@@ -0,0 +1,106 @@
+/*!
+ * @file    lin_baud.c
+ * @brief   Baud-rate estimation from measured bit times.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "lin_baud.h"
+
+/* Private Function Prototypes */
+static double Median( const double * values, unsigned int n );
+
+/* Public Function Implementations */
+
+void Baud_Init( struct Baud_Estimator_S * estimator )
+{
+   assert( estimator != NULL );
+   memset( estimator, 0, sizeof(*estimator) );
+}
+
+bool Baud_Add( struct Baud_Estimator_S * estimator, double bit_time )
+{
+   assert( (estimator != NULL) && (bit_time > 0.0) );
+
+   if ( !estimator->seeded )
+   {
+      estimator->window[estimator->window_len++] = bit_time;
+      estimator->bit_time = Median(estimator->window, estimator->window_len);
+      estimator->accepted++;
+      if ( BAUD_WINDOW == estimator->window_len )
+      {
+         estimator->seeded = true;
+         estimator->window_len = 0;
+      }
+      return true;
+   }
+
+   double error = ( bit_time > estimator->bit_time ) ? (bit_time - estimator->bit_time)
+                                                      : (estimator->bit_time - bit_time);
+   if ( error <= (BAUD_TOLERANCE * estimator->bit_time) )
+   {
+      estimator->bit_time += ( bit_time - estimator->bit_time ) / BAUD_TRACKING_WEIGHT;
+      estimator->window_len = 0;
+      estimator->accepted++;
+      return true;
+   }
+
+   // A full window of rejects in a row that agree with each other means the
+   // bus really is running at another speed now
+   estimator->rejected++;
+   estimator->window[estimator->window_len++] = bit_time;
+   if ( BAUD_WINDOW == estimator->window_len )
+   {
+      double median = Median(estimator->window, estimator->window_len);
+      bool agree = true;
+      for ( unsigned int i = 0; agree && (i < estimator->window_len); i++ )
+      {
+         double spread = ( estimator->window[i] > median ) ? (estimator->window[i] - median)
+                                                           : (median - estimator->window[i]);
+         agree = ( spread <= (BAUD_TOLERANCE * median) );
+      }
+      if ( agree )
+      {
+         estimator->bit_time = median;
+      }
+      estimator->window_len = 0;
+   }
+   return false;
+}
+
+double Baud_Rate( const struct Baud_Estimator_S * estimator, double units_per_sec )
+{
+   assert( estimator != NULL );
+   return ( estimator->bit_time > 0.0 ) ? (units_per_sec / estimator->bit_time) : 0.0;
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief Insertion sort of a copy; n is at most BAUD_WINDOW.
+ */
+static double Median( const double * values, unsigned int n )
+{
+   assert( (n > 0) && (n <= BAUD_WINDOW) );
+
+   double sorted[BAUD_WINDOW];
+   for ( unsigned int i = 0; i < n; i++ )
+   {
+      unsigned int j = i;
+      for ( ; (j > 0) && (sorted[j - 1u] > values[i]); j-- )
+      {
+         sorted[j] = sorted[j - 1u];
+      }
+      sorted[j] = values[i];
+   }
+   return ( (n % 2u) != 0u ) ? sorted[n / 2u] : ((sorted[(n / 2u) - 1u] + sorted[n / 2u]) / 2.0);
+}
@@ -0,0 +1,63 @@
+/*!
+ * @file    lin_baud.h
+ * @brief   Baud-rate estimation from measured bit times, with outlier
+ *          rejection and drift tracking.
+ *
+ * Whatever measures the bus (sync-field edges in a sample dump, say) hands
+ * in one bit time per header, in whatever unit it counts time in. The first
+ * BAUD_WINDOW measurements seed the estimate with their median, so a few bad
+ * ones can't drag it off. After that a measurement within BAUD_TOLERANCE of
+ * the estimate is accepted and nudges it along (an exponential moving
+ * average over about BAUD_TRACKING_WEIGHT headers), which follows a master
+ * clock drifting over a long capture. Anything further out is rejected,
+ * unless BAUD_WINDOW of them in a row agree, in which case the bus changed
+ * speed and the estimate starts over from them.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_BAUD_H
+#define LIN_BAUD_H
+
+/* File Inclusions */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public Macro Definitions */
+#define BAUD_WINDOW              8u
+#define BAUD_TOLERANCE           0.05     // Of the estimate; a synchronized slave must be within 2%
+#define BAUD_TRACKING_WEIGHT     16.0
+
+/* Public Datatypes */
+
+struct Baud_Estimator_S
+{
+   double bit_time;                 // Current estimate; 0 until the first measurement
+   double window[BAUD_WINDOW];      // Seeding measurements, or the latest run of rejects
+   unsigned int window_len;
+   bool seeded;
+   uint64_t accepted;
+   uint64_t rejected;
+};
+
+/* Public API */
+
+void Baud_Init( struct Baud_Estimator_S * estimator );
+
+/**
+ * @brief Take one measured bit time.
+ *
+ * @return true if it was consistent with the estimate (always, while seeding).
+ */
+bool Baud_Add( struct Baud_Estimator_S * estimator, double bit_time );
+
+/**
+ * @brief The estimate as a baud rate, given how many time units make a
+ *        second. 0 until there's been a measurement.
+ */
+double Baud_Rate( const struct Baud_Estimator_S * estimator, double units_per_sec );
+
+#endif // LIN_BAUD_H
@@ -0,0 +1,1136 @@
+/*!
+ * @file    lin_cap.c
+ * @brief   Binary capture writer, log converter, and memory-mapped reader.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stddef.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "lin_pid.h"
+#include "lin_log.h"
+#include "lin_cap.h"
+
+/* Local Macro Definitions */
+#define CAP_MAGIC                "LINCAP"
+#define CAP_MAGIC_LEN            6u
+#define US_PER_SEC               1000000.0
+#define ID_MASK                  0x3Fu
+#define LENGTH_MASK              0x0Fu
+#define CHANNEL_SHIFT            4u
+#define VARINT_MAX_LEN           10u
+#define VARINT_MORE              0x80u
+#define VARINT_PAYLOAD           0x7Fu
+#define INITIAL_POSTINGS_CAP     64u
+
+/* Datatypes */
+
+struct ConvertCtx_S
+{
+   struct CAP_Writer_S writer;      // First, so the callback's ctx is the writer as well
+   struct CAP_ConvertStats_S * stats;
+   enum LIN_PID_Result_E result;    // First write error, if any
+};
+
+// ConvertFrame() takes its ctx as the writer too, which only works while the
+// writer comes first. C99 has no static_assert, so a negative array size
+// stops the build instead.
+typedef char ConvertCtxWriterComesFirst[ (offsetof(struct ConvertCtx_S, writer) == 0) ? 1 : -1 ];
+
+/* Private Function Prototypes */
+static void ConvertFrame( const struct LOG_Frame_S * frame, enum LOG_Anomaly_E kind, void * ctx );
+static bool CheckIndex( const struct CAP_Reader_S * reader );
+static bool CheckPostings( const struct CAP_Reader_S * reader, uint64_t postings_offset );
+static bool AddPosting( struct CAP_PostingList_S * list, uint64_t offset, uint64_t timestamp_us );
+static bool AppendVarint( struct CAP_PostingList_S * list, uint64_t value );
+static bool ReadVarint( const uint8_t ** pos, const uint8_t * end, uint64_t * value );
+static enum LIN_PID_Result_E WritePostings( FILE * fp, const struct CAP_PostingList_S * lists, uint64_t section_offset );
+static void FreePostings( struct CAP_PostingList_S * lists );
+static void FillFrame( const uint8_t * record, uint64_t timestamp_us, struct CAP_Frame_S * frame );
+static uint64_t BlockFirstFrame( const struct CAP_Reader_S * reader, uint64_t block );
+static uint64_t BlockStartUs( const struct CAP_Reader_S * reader, uint64_t block );
+static uint64_t BlockOffset( const struct CAP_Reader_S * reader, uint64_t block );
+static uint64_t BlockEnd( const struct CAP_Reader_S * reader, uint64_t block );
+static void StartOfBlock( const struct CAP_Reader_S * reader, uint64_t block, struct CAP_Cursor_S * cursor );
+static uint64_t BlockFrameEnd( const struct CAP_Reader_S * reader, uint64_t block );
+static bool PeekRecord( const struct CAP_Reader_S * reader,
+                        const struct CAP_Cursor_S * cursor,
+                        uint64_t end,
+                        uint64_t * timestamp_us,
+                        uint64_t * record_len );
+static bool AdvanceInput( struct CAP_Merge_S * merge, uint32_t input );
+static bool HeadBefore( const struct CAP_MergeHead_S * a, const struct CAP_MergeHead_S * b );
+static void SiftDown( struct CAP_MergeHead_S * heap, size_t len, size_t i );
+static void StoreU16( uint8_t * dst, uint16_t value );
+static void StoreU32( uint8_t * dst, uint32_t value );
+static void StoreU64( uint8_t * dst, uint64_t value );
+static uint16_t LoadU16( const uint8_t * src );
+static uint32_t LoadU32( const uint8_t * src );
+static uint64_t LoadU64( const uint8_t * src );
+
+/* Public Function Implementations */
+
+enum LIN_PID_Result_E CAP_WriterOpen( struct CAP_Writer_S * writer, FILE * fp, uint32_t block_frames )
+{
+   assert( (writer != NULL) && (fp != NULL) );
+
+   memset( writer, 0, sizeof(*writer) );
+   writer->fp = fp;
+   writer->block_frames = ( block_frames > 0 ) ? block_frames : CAP_DEFAULT_BLOCK_FRAMES;
+   writer->offset = CAP_HEADER_LEN;
+
+   // Placeholder until CAP_WriterClose() knows the counts
+   uint8_t header[CAP_HEADER_LEN] = { 0 };
+   if ( fwrite(header, 1, sizeof(header), fp) != sizeof(header) )
+   {
+      return CaptureFileUnwritable;
+   }
+   return GoodResult;
+}
+
+enum LIN_PID_Result_E CAP_WriteFrame( struct CAP_Writer_S * writer, const struct CAP_Frame_S * frame )
+{
+   assert( (writer != NULL) && (frame != NULL) );
+   assert( (frame->id <= MAX_ID_ALLOWED) && (frame->length <= CAP_MAX_FRAME_LEN) );
+
+   if ( frame->channel > CAP_MAX_CHANNEL )
+   {
+      return CaptureChannelOOR;
+   }
+   if ( (writer->num_frames > 0) && (frame->timestamp_us < writer->prev_us) )
+   {
+      return CaptureTimestampsOutOfOrder;
+   }
+
+   uint64_t delta = frame->timestamp_us - writer->prev_us;
+   if ( (0 == writer->num_frames) || (writer->frames_in_block == writer->block_frames) || (delta > UINT32_MAX) )
+   {
+      if ( writer->index_len == writer->index_cap )
+      {
+         size_t new_cap = ( writer->index_cap > 0 ) ? (writer->index_cap * 2u) : (64u * CAP_INDEX_ENTRY_LEN);
+         uint8_t * grown = realloc( writer->index, new_cap );
+         if ( NULL == grown )
+         {
+            return OutOfMemory;
+         }
+         writer->index = grown;
+         writer->index_cap = new_cap;
+      }
+
+      uint8_t * entry = &writer->index[writer->index_len];
+      StoreU64( &entry[0], writer->num_frames );
+      StoreU64( &entry[8], frame->timestamp_us );
+      StoreU64( &entry[16], writer->offset );
+      writer->index_len += CAP_INDEX_ENTRY_LEN;
+      writer->num_blocks++;
+      writer->frames_in_block = 0;
+      delta = 0;
+   }
+
+   uint8_t record[CAP_RECORD_HEADER_LEN + CAP_MAX_FRAME_LEN];
+   StoreU32( &record[0], (uint32_t)delta );
+   record[4] = (uint8_t)( (frame->id & ID_MASK) | (frame->flags & (CAP_FLAG_PID_ERROR | CAP_FLAG_CHECKSUM_ERROR)) );
+   record[5] = (uint8_t)( frame->length | (uint8_t)(frame->channel << CHANNEL_SHIFT) );
+   record[6] = frame->pid;
+   record[7] = frame->checksum;
+   memcpy( &record[CAP_RECORD_HEADER_LEN], frame->data, frame->length );
+
+   size_t record_len = CAP_RECORD_HEADER_LEN + frame->length;
+   if ( fwrite(record, 1, record_len, writer->fp) != record_len )
+   {
+      return CaptureFileUnwritable;
+   }
+   if ( !AddPosting(&writer->postings[frame->id], writer->offset, frame->timestamp_us) )
+   {
+      return OutOfMemory;
+   }
+
+   writer->offset += record_len;
+   writer->prev_us = frame->timestamp_us;
+   writer->frames_in_block++;
+   writer->num_frames++;
+   return GoodResult;
+}
+
+enum LIN_PID_Result_E CAP_WriterClose( struct CAP_Writer_S * writer )
+{
+   assert( writer != NULL );
+
+   enum LIN_PID_Result_E result = GoodResult;
+   uint64_t postings_offset = writer->offset + writer->index_len;
+   if ( (writer->index_len > 0) &&
+        (fwrite(writer->index, 1, writer->index_len, writer->fp) != writer->index_len) )
+   {
+      result = CaptureFileUnwritable;
+   }
+   if ( GoodResult == result )
+   {
+      result = WritePostings(writer->fp, writer->postings, postings_offset);
+   }
+
+   uint8_t header[CAP_HEADER_LEN] = { 0 };
+   memcpy( &header[0], CAP_MAGIC, CAP_MAGIC_LEN );
+   StoreU16( &header[6], CAP_VERSION );
+   StoreU32( &header[8], CAP_HEADER_LEN );
+   StoreU32( &header[12], writer->block_frames );
+   StoreU64( &header[16], writer->num_frames );
+   StoreU64( &header[24], writer->num_blocks );
+   StoreU64( &header[32], writer->offset );
+   StoreU64( &header[40], writer->prev_us );
+   StoreU64( &header[48], postings_offset );
+
+   if ( (GoodResult == result) &&
+        ((fseek(writer->fp, 0, SEEK_SET) != 0) ||
+         (fwrite(header, 1, sizeof(header), writer->fp) != sizeof(header)) ||
+         (fseek(writer->fp, 0, SEEK_END) != 0) ||
+         (fflush(writer->fp) != 0)) )
+   {
+      result = CaptureFileUnwritable;
+   }
+
+   free(writer->index);
+   FreePostings(writer->postings);
+   writer->index = NULL;
+   writer->index_len = 0;
+   writer->index_cap = 0;
+   return result;
+}
+
+enum LIN_PID_Result_E CAP_ConvertLog( FILE * in,
+                                      FILE * out,
+                                      const struct LOG_Options_S * options,
+                                      uint32_t block_frames,
+                                      struct CAP_ConvertStats_S * stats )
+{
+   assert( (in != NULL) && (out != NULL) && (options != NULL) && (stats != NULL) );
+
+   memset( stats, 0, sizeof(*stats) );
+
+   // ctx owns the writer, and everything the writer allocates is freed by
+   // the one CAP_WriterClose() below
+   struct ConvertCtx_S ctx;
+   ctx.stats = stats;
+   ctx.result = GoodResult;
+   enum LIN_PID_Result_E result = CAP_WriterOpen(&ctx.writer, out, block_frames);
+   if ( result != GoodResult )
+   {
+      return result;
+   }
+
+   struct LOG_Options_S convert_options = *options;
+   convert_options.on_anomaly = NULL;
+   convert_options.on_frame = ConvertFrame;
+   convert_options.ctx = &ctx;
+
+   // Too big for the stack with all 64 per-ID entries
+   struct LOG_Summary_S * summary = malloc( sizeof(*summary) );
+   result = ( NULL == summary ) ? OutOfMemory : LOG_ProcessStream(in, &convert_options, summary);
+   if ( GoodResult == result )
+   {
+      result = ctx.result;
+   }
+
+   enum LIN_PID_Result_E close_result = CAP_WriterClose(&ctx.writer);
+   if ( GoodResult == result )
+   {
+      result = close_result;
+      stats->lines = summary->lines;
+      stats->skipped = summary->frames - stats->frames;
+      stats->blocks = ctx.writer.num_blocks;
+   }
+
+   free(summary);
+   return result;
+}
+
+enum LIN_PID_Result_E CAP_Open( const char * path, struct CAP_Reader_S * reader )
+{
+   assert( (path != NULL) && (reader != NULL) );
+
+   memset( reader, 0, sizeof(*reader) );
+
+#ifdef _WIN32
+   FILE * fp = fopen(path, "rb");
+   if ( NULL == fp )
+   {
+      return CaptureFileUnreadable;
+   }
+   long size = ( fseek(fp, 0, SEEK_END) == 0 ) ? ftell(fp) : -1L;
+   uint8_t * buf = ( size > 0 ) ? malloc( (size_t)size ) : NULL;
+   bool read_ok = ( buf != NULL ) && ( fseek(fp, 0, SEEK_SET) == 0 ) &&
+                  ( fread(buf, 1, (size_t)size, fp) == (size_t)size );
+   (void)fclose(fp);
+   if ( !read_ok )
+   {
+      free(buf);
+      return ( size > 0 ) ? CaptureFileUnreadable : CaptureFileCorrupt;
+   }
+   enum LIN_PID_Result_E result = CAP_OpenMemory(buf, (size_t)size, reader);
+   if ( result != GoodResult )
+   {
+      free(buf);
+      return result;
+   }
+   reader->owned = true;
+   reader->mapped = false;
+   return GoodResult;
+#else
+   int fd = open(path, O_RDONLY);
+   if ( fd < 0 )
+   {
+      return CaptureFileUnreadable;
+   }
+
+   struct stat st;
+   if ( (fstat(fd, &st) != 0) || (st.st_size < (off_t)CAP_HEADER_LEN) )
+   {
+      (void)close(fd);
+      return CaptureFileCorrupt;
+   }
+
+   size_t size = (size_t)st.st_size;
+   void * map = mmap( NULL, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+   (void)close(fd);   // The mapping keeps the file alive
+   if ( MAP_FAILED == map )
+   {
+      return CaptureFileUnreadable;
+   }
+
+   enum LIN_PID_Result_E result = CAP_OpenMemory( (const uint8_t *)map, size, reader );
+   if ( result != GoodResult )
+   {
+      (void)munmap(map, size);
+      return result;
+   }
+   reader->owned = true;
+   reader->mapped = true;
+   return GoodResult;
+#endif
+}
+
+enum LIN_PID_Result_E CAP_OpenMemory( const uint8_t * buf, size_t size, struct CAP_Reader_S * reader )
+{
+   assert( (buf != NULL) && (reader != NULL) );
+
+   memset( reader, 0, sizeof(*reader) );
+   if ( (size < CAP_HEADER_LEN) || (memcmp(buf, CAP_MAGIC, CAP_MAGIC_LEN) != 0) ||
+        (LoadU16(&buf[6]) != CAP_VERSION) )
+   {
+      return CaptureFileCorrupt;
+   }
+
+   uint32_t header_len = LoadU32(&buf[8]);
+   reader->base = buf;
+   reader->size = size;
+   reader->block_frames = LoadU32(&buf[12]);
+   reader->num_frames = LoadU64(&buf[16]);
+   reader->num_blocks = LoadU64(&buf[24]);
+   reader->index_offset = LoadU64(&buf[32]);
+   reader->last_us = LoadU64(&buf[40]);
+
+   if ( (header_len < CAP_HEADER_LEN) || (0 == reader->block_frames) ||
+        (reader->index_offset < header_len) || (reader->index_offset > size) ||
+        (reader->num_blocks > ((size - reader->index_offset) / CAP_INDEX_ENTRY_LEN)) ||
+        (reader->num_blocks > reader->num_frames) ||
+        ((0 == reader->num_blocks) != (0 == reader->num_frames)) )
+   {
+      memset( reader, 0, sizeof(*reader) );
+      return CaptureFileCorrupt;
+   }
+   reader->index = &buf[reader->index_offset];
+
+   uint64_t postings_offset = LoadU64(&buf[48]);
+   if ( !CheckIndex(reader) || ((postings_offset != 0) && !CheckPostings(reader, postings_offset)) )
+   {
+      memset( reader, 0, sizeof(*reader) );
+      return CaptureFileCorrupt;
+   }
+   reader->postings = ( postings_offset != 0 ) ? &buf[postings_offset] : NULL;
+   return GoodResult;
+}
+
+void CAP_Close( struct CAP_Reader_S * reader )
+{
+   assert( reader != NULL );
+
+   if ( reader->owned )
+   {
+#ifndef _WIN32
+      if ( reader->mapped )
+      {
+         (void)munmap( (void *)(uintptr_t)reader->base, reader->size );
+      }
+      else
+#endif
+      {
+         free( (void *)(uintptr_t)reader->base );
+      }
+   }
+   memset( reader, 0, sizeof(*reader) );
+}
+
+bool CAP_SeekFrame( const struct CAP_Reader_S * reader, uint64_t frame, struct CAP_Cursor_S * cursor )
+{
+   assert( (reader != NULL) && (cursor != NULL) );
+
+   if ( frame >= reader->num_frames )
+   {
+      return false;
+   }
+
+   // Last block whose first frame is at or before the one wanted
+   uint64_t lo = 0;
+   uint64_t hi = reader->num_blocks - 1u;
+   while ( lo < hi )
+   {
+      uint64_t mid = lo + ((hi - lo + 1u) / 2u);
+      if ( BlockFirstFrame(reader, mid) <= frame )
+      {
+         lo = mid;
+      }
+      else
+      {
+         hi = mid - 1u;
+      }
+   }
+
+   StartOfBlock(reader, lo, cursor);
+   uint64_t end = BlockEnd(reader, lo);
+   while ( cursor->frame < frame )
+   {
+      uint64_t timestamp_us;
+      uint64_t record_len;
+      if ( !PeekRecord(reader, cursor, end, &timestamp_us, &record_len) )
+      {
+         return false;
+      }
+      cursor->prev_us = timestamp_us;
+      cursor->offset += record_len;
+      cursor->frame++;
+   }
+   return true;
+}
+
+bool CAP_SeekTime( const struct CAP_Reader_S * reader, uint64_t timestamp_us, struct CAP_Cursor_S * cursor )
+{
+   assert( (reader != NULL) && (cursor != NULL) );
+
+   if ( 0 == reader->num_blocks )
+   {
+      return false;
+   }
+
+   // First block starting at or after timestamp_us. The one before it may
+   // still end with frames that qualify, so the walk starts there.
+   uint64_t lo = 0;
+   uint64_t hi = reader->num_blocks;
+   while ( lo < hi )
+   {
+      uint64_t mid = lo + ((hi - lo) / 2u);
+      if ( BlockStartUs(reader, mid) < timestamp_us )
+      {
+         lo = mid + 1u;
+      }
+      else
+      {
+         hi = mid;
+      }
+   }
+
+   uint64_t block = ( lo > 0 ) ? (lo - 1u) : 0u;
+   uint64_t end = BlockEnd(reader, block);
+   uint64_t frame_end = BlockFrameEnd(reader, block);
+   StartOfBlock(reader, block, cursor);
+   while ( cursor->frame < frame_end )
+   {
+      uint64_t record_us;
+      uint64_t record_len;
+      if ( !PeekRecord(reader, cursor, end, &record_us, &record_len) )
+      {
+         return false;
+      }
+      if ( record_us >= timestamp_us )
+      {
+         return true;
+      }
+      cursor->prev_us = record_us;
+      cursor->offset += record_len;
+      cursor->frame++;
+   }
+
+   // Everything in that block was earlier, so it's the next block's first frame
+   if ( (block + 1u) < reader->num_blocks )
+   {
+      StartOfBlock(reader, block + 1u, cursor);
+      return true;
+   }
+   return false;
+}
+
+bool CAP_Next( const struct CAP_Reader_S * reader, struct CAP_Cursor_S * cursor, struct CAP_Frame_S * frame )
+{
+   assert( (reader != NULL) && (cursor != NULL) && (frame != NULL) );
+
+   if ( cursor->frame >= reader->num_frames )
+   {
+      return false;
+   }
+
+   // Crossing into the next block resets the time base
+   if ( ((cursor->block + 1u) < reader->num_blocks) &&
+        (BlockFirstFrame(reader, cursor->block + 1u) == cursor->frame) )
+   {
+      if ( (BlockOffset(reader, cursor->block + 1u) != cursor->offset) ||
+           (BlockStartUs(reader, cursor->block + 1u) < cursor->prev_us) )
+      {
+         return false;
+      }
+      StartOfBlock(reader, cursor->block + 1u, cursor);
+   }
+
+   uint64_t timestamp_us;
+   uint64_t record_len;
+   if ( !PeekRecord(reader, cursor, BlockEnd(reader, cursor->block), &timestamp_us, &record_len) )
+   {
+      return false;
+   }
+
+   FillFrame( &reader->base[cursor->offset], timestamp_us, frame );
+   cursor->prev_us = timestamp_us;
+   cursor->offset += record_len;
+   cursor->frame++;
+   return true;
+}
+
+bool CAP_PostingsOpen( const struct CAP_Reader_S * reader, uint8_t id, struct CAP_Postings_S * postings )
+{
+   assert( (reader != NULL) && (postings != NULL) && (id <= MAX_ID_ALLOWED) );
+
+   memset( postings, 0, sizeof(*postings) );
+   if ( NULL == reader->postings )
+   {
+      return false;
+   }
+
+   // CheckPostings() already made sure every list lies inside the file
+   const uint8_t * entry = &reader->postings[(size_t)id * CAP_POSTINGS_DIR_ENTRY_LEN];
+   postings->remaining = LoadU64(&entry[0]);
+   postings->pos = &reader->base[LoadU64(&entry[8])];
+   postings->end = postings->pos + LoadU64(&entry[16]);
+   postings->id = id;
+   return true;
+}
+
+bool CAP_NextPosting( const struct CAP_Reader_S * reader, struct CAP_Postings_S * postings, struct CAP_Frame_S * frame )
+{
+   assert( (reader != NULL) && (postings != NULL) && (frame != NULL) );
+
+   uint64_t offset_delta;
+   uint64_t us_delta;
+   if ( (0 == postings->remaining) ||
+        !ReadVarint(&postings->pos, postings->end, &offset_delta) ||
+        !ReadVarint(&postings->pos, postings->end, &us_delta) ||
+        (offset_delta > (reader->index_offset - postings->offset)) ||
+        (us_delta > (UINT64_MAX - postings->timestamp_us)) )
+   {
+      return false;
+   }
+
+   uint64_t offset = postings->offset + offset_delta;
+   uint64_t avail = reader->index_offset - offset;
+   if ( (offset < CAP_HEADER_LEN) || (avail < CAP_RECORD_HEADER_LEN) )
+   {
+      return false;
+   }
+   const uint8_t * record = &reader->base[offset];
+   uint64_t length = record[5] & LENGTH_MASK;
+   if ( (length > CAP_MAX_FRAME_LEN) || (avail < (CAP_RECORD_HEADER_LEN + length)) ||
+        ((record[4] & ID_MASK) != postings->id) )
+   {
+      return false;
+   }
+
+   postings->offset = offset;
+   postings->timestamp_us += us_delta;
+   postings->remaining--;
+   FillFrame( record, postings->timestamp_us, frame );
+   return true;
+}
+
+enum LIN_PID_Result_E CAP_AddPostings( const char * path )
+{
+   assert( path != NULL );
+
+   struct CAP_Reader_S reader;
+   enum LIN_PID_Result_E result = CAP_Open(path, &reader);
+   if ( (result != GoodResult) || (reader.postings != NULL) )
+   {
+      CAP_Close(&reader);
+      return result;
+   }
+
+   // One pass over the records; the cursor sits on each record before it's read
+   struct CAP_PostingList_S lists[CAP_NUM_OF_IDS];
+   memset( lists, 0, sizeof(lists) );
+   struct CAP_Cursor_S cursor;
+   struct CAP_Frame_S frame;
+   bool more = CAP_SeekFrame(&reader, 0, &cursor);
+   while ( more && (GoodResult == result) )
+   {
+      uint64_t offset = cursor.offset;
+      more = CAP_Next(&reader, &cursor, &frame);
+      if ( more && !AddPosting(&lists[frame.id], offset, frame.timestamp_us) )
+      {
+         result = OutOfMemory;
+      }
+   }
+   if ( (GoodResult == result) && (cursor.frame != reader.num_frames) )
+   {
+      result = CaptureFileCorrupt;
+   }
+
+   // The postings go on the end, past anything already there
+   uint64_t section_offset = reader.size;
+   CAP_Close(&reader);
+
+   FILE * fp = ( GoodResult == result ) ? fopen(path, "r+b") : NULL;
+   if ( (GoodResult == result) && (NULL == fp) )
+   {
+      result = CaptureFileUnwritable;
+   }
+   if ( GoodResult == result )
+   {
+      uint8_t field[8];
+      StoreU64( field, section_offset );
+      result = ( (fseek(fp, 0, SEEK_END) == 0) && ((uint64_t)ftell(fp) == section_offset) )
+               ? WritePostings(fp, lists, section_offset) : CaptureFileUnwritable;
+
+      // Only point the header at the postings once they're all there
+      if ( (GoodResult == result) &&
+           ((fflush(fp) != 0) || (fseek(fp, 48, SEEK_SET) != 0) ||
+            (fwrite(field, 1, sizeof(field), fp) != sizeof(field))) )
+      {
+         result = CaptureFileUnwritable;
+      }
+   }
+   if ( (fp != NULL) && (fclose(fp) != 0) && (GoodResult == result) )
+   {
+      result = CaptureFileUnwritable;
+   }
+
+   FreePostings(lists);
+   return result;
+}
+
+enum LIN_PID_Result_E CAP_MergeOpen( struct CAP_Merge_S * merge,
+                                     const struct CAP_Reader_S * readers,
+                                     size_t num_readers,
+                                     bool retag )
+{
+   assert( (merge != NULL) && ((readers != NULL) || (0 == num_readers)) );
+
+   memset( merge, 0, sizeof(*merge) );
+   if ( retag && (num_readers > CAP_MAX_CHANNEL) )
+   {
+      return CaptureChannelOOR;
+   }
+   if ( num_readers > UINT32_MAX )
+   {
+      return OutOfMemory;
+   }
+   if ( 0 == num_readers )
+   {
+      return GoodResult;
+   }
+
+   merge->inputs = malloc( num_readers * sizeof(*merge->inputs) );
+   merge->heap = malloc( num_readers * sizeof(*merge->heap) );
+   if ( (NULL == merge->inputs) || (NULL == merge->heap) )
+   {
+      CAP_MergeClose(merge);
+      return OutOfMemory;
+   }
+   merge->num_inputs = num_readers;
+   merge->retag = retag;
+
+   for ( size_t i = 0; i < num_readers; i++ )
+   {
+      struct CAP_MergeInput_S * in = &merge->inputs[i];
+      in->reader = &readers[i];
+#ifndef _WIN32
+      // Each input is read straight through, so let the kernel read far ahead
+      if ( readers[i].mapped )
+      {
+         (void)posix_madvise( (void *)(uintptr_t)readers[i].base, readers[i].size, POSIX_MADV_SEQUENTIAL );
+      }
+#endif
+      if ( CAP_SeekFrame(in->reader, 0, &in->cursor) && AdvanceInput(merge, (uint32_t)i) )
+      {
+         merge->heap[merge->heap_len].timestamp_us = in->next.timestamp_us;
+         merge->heap[merge->heap_len].input = (uint32_t)i;
+         merge->heap_len++;
+      }
+   }
+
+   for ( size_t i = merge->heap_len / 2u; i > 0; i-- )
+   {
+      SiftDown(merge->heap, merge->heap_len, i - 1u);
+   }
+   return GoodResult;
+}
+
+bool CAP_MergeNext( struct CAP_Merge_S * merge, struct CAP_Frame_S * frame, size_t * input )
+{
+   assert( (merge != NULL) && (frame != NULL) );
+
+   if ( 0 == merge->heap_len )
+   {
+      return false;
+   }
+
+   uint32_t first = merge->heap[0].input;
+   struct CAP_MergeInput_S * in = &merge->inputs[first];
+   *frame = in->next;
+   if ( input != NULL )
+   {
+      *input = first;
+   }
+
+   if ( ReferencePID(frame->id) != frame->pid )
+   {
+      frame->flags |= CAP_FLAG_PID_ERROR;
+      merge->pid_errors++;
+   }
+   else
+   {
+      frame->flags &= (uint8_t)~CAP_FLAG_PID_ERROR;
+   }
+   if ( merge->retag )
+   {
+      frame->channel = (uint8_t)(first + 1u);
+   }
+   merge->frames++;
+
+   // Refill the top in place; only a used-up input shrinks the heap
+   if ( AdvanceInput(merge, first) )
+   {
+      merge->heap[0].timestamp_us = in->next.timestamp_us;
+   }
+   else
+   {
+      merge->heap_len--;
+      merge->heap[0] = merge->heap[merge->heap_len];
+   }
+   SiftDown(merge->heap, merge->heap_len, 0);
+   return true;
+}
+
+void CAP_MergeClose( struct CAP_Merge_S * merge )
+{
+   assert( merge != NULL );
+
+   free(merge->inputs);
+   free(merge->heap);
+   merge->inputs = NULL;
+   merge->heap = NULL;
+   merge->num_inputs = 0;
+   merge->heap_len = 0;
+}
+
+uint64_t CAP_SecondsToUs( double seconds )
+{
+   if ( !(seconds > 0.0) )
+   {
+      return 0;
+   }
+   double us = (seconds * US_PER_SEC) + 0.5;
+   return ( us >= 18446744073709551615.0 ) ? UINT64_MAX : (uint64_t)us;
+}
+
+/* Private Function Implementations */
+
+static void ConvertFrame( const struct LOG_Frame_S * frame, enum LOG_Anomaly_E kind, void * ctx )
+{
+   // Reaching the writer through ctx itself rather than through a member of
+   // it keeps -fanalyzer from losing track of what the writer allocates
+   struct ConvertCtx_S * convert = ctx;
+   struct CAP_Writer_S * writer = ctx;
+   if ( convert->result != GoodResult )
+   {
+      return;
+   }
+
+   struct CAP_Frame_S out;
+   out.timestamp_us = CAP_SecondsToUs(frame->timestamp);
+   out.id = frame->id;
+   out.pid = frame->has_pid ? frame->pid : ReferencePID(frame->id);
+   out.checksum = frame->checksum;
+   out.length = frame->length;
+   out.channel = frame->channel;
+   out.flags = (uint8_t)( ((LOG_ANOMALY_PID_MISMATCH == kind) ? CAP_FLAG_PID_ERROR : 0u) |
+                          ((LOG_ANOMALY_CHECKSUM == kind) ? CAP_FLAG_CHECKSUM_ERROR : 0u) );
+   memcpy( out.data, frame->data, sizeof(out.data) );
+
+   convert->result = CAP_WriteFrame(writer, &out);
+   if ( GoodResult == convert->result )
+   {
+      convert->stats->frames++;
+   }
+}
+
+/**
+ * @brief Make sure the postings directory and every list it points to lie
+ *        after the index and inside the file.
+ */
+static bool CheckPostings( const struct CAP_Reader_S * reader, uint64_t postings_offset )
+{
+   uint64_t index_end = reader->index_offset + (reader->num_blocks * CAP_INDEX_ENTRY_LEN);
+   if ( (postings_offset < index_end) || (postings_offset > reader->size) ||
+        ((reader->size - postings_offset) < CAP_POSTINGS_DIR_LEN) )
+   {
+      return false;
+   }
+
+   const uint8_t * dir = &reader->base[postings_offset];
+   uint64_t lists_start = postings_offset + CAP_POSTINGS_DIR_LEN;
+   for ( size_t id = 0; id < CAP_NUM_OF_IDS; id++ )
+   {
+      const uint8_t * entry = &dir[id * CAP_POSTINGS_DIR_ENTRY_LEN];
+      uint64_t count = LoadU64(&entry[0]);
+      uint64_t offset = LoadU64(&entry[8]);
+      uint64_t len = LoadU64(&entry[16]);
+      if ( (count > reader->num_frames) || (offset < lists_start) || (offset > reader->size) ||
+           (len > (reader->size - offset)) )
+      {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+/**
+ * @brief Make sure every index entry is in order and inside the record area,
+ *        so seeks can trust it.
+ */
+static bool CheckIndex( const struct CAP_Reader_S * reader )
+{
+   for ( uint64_t b = 0; b < reader->num_blocks; b++ )
+   {
+      uint64_t first_frame = BlockFirstFrame(reader, b);
+      uint64_t offset = BlockOffset(reader, b);
+      if ( (first_frame >= reader->num_frames) || (offset >= reader->index_offset) )
+      {
+         return false;
+      }
+      if ( 0 == b )
+      {
+         if ( (first_frame != 0) || (offset != LoadU32(&reader->base[8])) )
+         {
+            return false;
+         }
+      }
+      else if ( (first_frame <= BlockFirstFrame(reader, b - 1u)) ||
+                (BlockStartUs(reader, b) < BlockStartUs(reader, b - 1u)) ||
+                (offset <= BlockOffset(reader, b - 1u)) )
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+static bool AddPosting( struct CAP_PostingList_S * list, uint64_t offset, uint64_t timestamp_us )
+{
+   assert( (offset >= list->prev_offset) && (timestamp_us >= list->prev_us) );
+
+   if ( !AppendVarint(list, offset - list->prev_offset) || !AppendVarint(list, timestamp_us - list->prev_us) )
+   {
+      return false;
+   }
+   list->prev_offset = offset;
+   list->prev_us = timestamp_us;
+   list->count++;
+   return true;
+}
+
+/**
+ * @brief LEB128: seven bits at a time, low bits first, top bit set on every
+ *        byte but the last.
+ */
+static bool AppendVarint( struct CAP_PostingList_S * list, uint64_t value )
+{
+   if ( (list->cap - list->len) < VARINT_MAX_LEN )
+   {
+      size_t new_cap = ( list->cap > 0 ) ? (list->cap * 2u) : INITIAL_POSTINGS_CAP;
+      uint8_t * grown = realloc( list->buf, new_cap );
+      if ( NULL == grown )
+      {
+         return false;
+      }
+      list->buf = grown;
+      list->cap = new_cap;
+   }
+
+   while ( value > VARINT_PAYLOAD )
+   {
+      list->buf[list->len++] = (uint8_t)((value & VARINT_PAYLOAD) | VARINT_MORE);
+      value >>= 7;
+   }
+   list->buf[list->len++] = (uint8_t)value;
+   return true;
+}
+
+static bool ReadVarint( const uint8_t ** pos, const uint8_t * end, uint64_t * value )
+{
+   uint64_t acc = 0;
+   const uint8_t * p = *pos;
+   for ( unsigned int shift = 0; (p < end) && (shift < (7u * VARINT_MAX_LEN)); shift += 7u )
+   {
+      uint8_t byte = *p++;
+      acc |= (uint64_t)(byte & VARINT_PAYLOAD) << shift;
+      if ( 0 == (byte & VARINT_MORE) )
+      {
+         *pos = p;
+         *value = acc;
+         return true;
+      }
+   }
+   return false;
+}
+
+/**
+ * @brief Write the postings directory and lists, starting at section_offset
+ *        (which must be where fp is).
+ */
+static enum LIN_PID_Result_E WritePostings( FILE * fp, const struct CAP_PostingList_S * lists, uint64_t section_offset )
+{
+   uint8_t dir[CAP_POSTINGS_DIR_LEN];
+   uint64_t offset = section_offset + CAP_POSTINGS_DIR_LEN;
+   for ( size_t id = 0; id < CAP_NUM_OF_IDS; id++ )
+   {
+      uint8_t * entry = &dir[id * CAP_POSTINGS_DIR_ENTRY_LEN];
+      StoreU64( &entry[0], lists[id].count );
+      StoreU64( &entry[8], offset );
+      StoreU64( &entry[16], lists[id].len );
+      offset += lists[id].len;
+   }
+
+   if ( fwrite(dir, 1, sizeof(dir), fp) != sizeof(dir) )
+   {
+      return CaptureFileUnwritable;
+   }
+   for ( size_t id = 0; id < CAP_NUM_OF_IDS; id++ )
+   {
+      if ( (lists[id].len > 0) && (fwrite(lists[id].buf, 1, lists[id].len, fp) != lists[id].len) )
+      {
+         return CaptureFileUnwritable;
+      }
+   }
+   return GoodResult;
+}
+
+static void FreePostings( struct CAP_PostingList_S * lists )
+{
+   for ( size_t id = 0; id < CAP_NUM_OF_IDS; id++ )
+   {
+      free(lists[id].buf);
+   }
+   memset( lists, 0, CAP_NUM_OF_IDS * sizeof(*lists) );
+}
+
+/**
+ * @brief Decode a record that's already been bounds-checked.
+ */
+static void FillFrame( const uint8_t * record, uint64_t timestamp_us, struct CAP_Frame_S * frame )
+{
+   uint8_t length = record[5] & LENGTH_MASK;
+   frame->timestamp_us = timestamp_us;
+   frame->id = record[4] & ID_MASK;
+   frame->flags = record[4] & (uint8_t)~ID_MASK;
+   frame->length = length;
+   frame->channel = (uint8_t)(record[5] >> CHANNEL_SHIFT);
+   frame->pid = record[6];
+   frame->checksum = record[7];
+   memcpy( frame->data, &record[CAP_RECORD_HEADER_LEN], length );
+   memset( &frame->data[length], 0, CAP_MAX_FRAME_LEN - length );
+}
+
+static uint64_t BlockFirstFrame( const struct CAP_Reader_S * reader, uint64_t block )
+{
+   return LoadU64( &reader->index[(block * CAP_INDEX_ENTRY_LEN) + 0u] );
+}
+
+static uint64_t BlockStartUs( const struct CAP_Reader_S * reader, uint64_t block )
+{
+   return LoadU64( &reader->index[(block * CAP_INDEX_ENTRY_LEN) + 8u] );
+}
+
+static uint64_t BlockOffset( const struct CAP_Reader_S * reader, uint64_t block )
+{
+   return LoadU64( &reader->index[(block * CAP_INDEX_ENTRY_LEN) + 16u] );
+}
+
+static uint64_t BlockEnd( const struct CAP_Reader_S * reader, uint64_t block )
+{
+   return ( (block + 1u) < reader->num_blocks ) ? BlockOffset(reader, block + 1u) : reader->index_offset;
+}
+
+/**
+ * @brief One past the last frame number in block.
+ */
+static uint64_t BlockFrameEnd( const struct CAP_Reader_S * reader, uint64_t block )
+{
+   return ( (block + 1u) < reader->num_blocks ) ? BlockFirstFrame(reader, block + 1u) : reader->num_frames;
+}
+
+/**
+ * @brief Timestamp and size of the record under cursor, without decoding the
+ *        rest of it, so seeks can walk through a block cheaply.
+ *
+ * @return false if the record doesn't fit before end.
+ */
+static bool PeekRecord( const struct CAP_Reader_S * reader,
+                        const struct CAP_Cursor_S * cursor,
+                        uint64_t end,
+                        uint64_t * timestamp_us,
+                        uint64_t * record_len )
+{
+   if ( (cursor->offset > end) || ((end - cursor->offset) < CAP_RECORD_HEADER_LEN) )
+   {
+      return false;
+   }
+
+   const uint8_t * record = &reader->base[cursor->offset];
+   uint64_t len = CAP_RECORD_HEADER_LEN + (uint64_t)(record[5] & LENGTH_MASK);
+   if ( (len > (CAP_RECORD_HEADER_LEN + CAP_MAX_FRAME_LEN)) || ((end - cursor->offset) < len) )
+   {
+      return false;
+   }
+
+   *timestamp_us = cursor->prev_us + LoadU32(&record[0]);
+   *record_len = len;
+   return true;
+}
+
+static void StartOfBlock( const struct CAP_Reader_S * reader, uint64_t block, struct CAP_Cursor_S * cursor )
+{
+   cursor->block = block;
+   cursor->frame = BlockFirstFrame(reader, block);
+   cursor->offset = BlockOffset(reader, block);
+   cursor->prev_us = BlockStartUs(reader, block);
+}
+
+/**
+ * @brief Decode input's next frame into its slot.
+ *
+ * @return false once it has none left.
+ */
+static bool AdvanceInput( struct CAP_Merge_S * merge, uint32_t input )
+{
+   struct CAP_MergeInput_S * in = &merge->inputs[input];
+   if ( CAP_Next(in->reader, &in->cursor, &in->next) )
+   {
+      return true;
+   }
+   if ( in->cursor.frame != in->reader->num_frames )
+   {
+      merge->corrupt = true;
+   }
+   return false;
+}
+
+static bool HeadBefore( const struct CAP_MergeHead_S * a, const struct CAP_MergeHead_S * b )
+{
+   return ( a->timestamp_us < b->timestamp_us ) ||
+          ( (a->timestamp_us == b->timestamp_us) && (a->input < b->input) );
+}
+
+static void SiftDown( struct CAP_MergeHead_S * heap, size_t len, size_t i )
+{
+   struct CAP_MergeHead_S moving = heap[i];
+   for ( ;; )
+   {
+      size_t child = (2u * i) + 1u;
+      if ( child >= len )
+      {
+         break;
+      }
+      if ( ((child + 1u) < len) && HeadBefore(&heap[child + 1u], &heap[child]) )
+      {
+         child++;
+      }
+      if ( !HeadBefore(&heap[child], &moving) )
+      {
+         break;
+      }
+      heap[i] = heap[child];
+      i = child;
+   }
+   heap[i] = moving;
+}
+
+static void StoreU16( uint8_t * dst, uint16_t value )
+{
+   dst[0] = (uint8_t)value;
+   dst[1] = (uint8_t)(value >> 8);
+}
+
+static void StoreU32( uint8_t * dst, uint32_t value )
+{
+   for ( unsigned int i = 0; i < 4u; i++ )
+   {
+      dst[i] = (uint8_t)(value >> (8u * i));
+   }
+}
+
+static void StoreU64( uint8_t * dst, uint64_t value )
+{
+   for ( unsigned int i = 0; i < 8u; i++ )
+   {
+      dst[i] = (uint8_t)(value >> (8u * i));
+   }
+}
+
+static uint16_t LoadU16( const uint8_t * src )
+{
+   return (uint16_t)( (unsigned int)src[0] | ((unsigned int)src[1] << 8) );
+}
+
+static uint32_t LoadU32( const uint8_t * src )
+{
+   uint32_t value = 0;
+   for ( unsigned int i = 0; i < 4u; i++ )
+   {
+      value |= (uint32_t)src[i] << (8u * i);
+   }
+   return value;
+}
+
+static uint64_t LoadU64( const uint8_t * src )
+{
+   uint64_t value = 0;
+   for ( unsigned int i = 0; i < 8u; i++ )
+   {
+      value |= (uint64_t)src[i] << (8u * i);
+   }
+   return value;
+}
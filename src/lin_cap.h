@@ -0,0 +1,321 @@
+/*!
+ * @file    lin_cap.h
+ * @brief   Compact binary LIN capture files with a block index for random access.
+ *
+ * A capture is written once (usually converted from a text log) and then read
+ * many times through a memory map. Seeking to a frame number or a point in
+ * time is a binary search over the block index plus a walk through at most
+ * one block, so it never scans the file. Pulling out every frame with one ID
+ * goes through that ID's posting list instead, so it only touches the
+ * matching records.
+ *
+ * Layout (all integers little-endian):
+ *
+ *    Header      CAP_HEADER_LEN bytes
+ *                   0  "LINCAP"          6  version (u16)
+ *                   8  header length     12 frames per block (u32)
+ *                  16  frames (u64)      24 blocks (u64)
+ *                  32  index offset (u64)
+ *                  40  last timestamp, us (u64)
+ *                  48  postings offset (u64); 0 if there are none
+ *
+ *    Records     One per frame, back to back, block after block:
+ *                   0  microseconds since the previous frame in the block (u32);
+ *                      0 for the first frame of a block
+ *                   4  ID (bits 0-5) | CAP_FLAG_PID_ERROR | CAP_FLAG_CHECKSUM_ERROR
+ *                   5  data length (bits 0-3) | channel (bits 4-7)
+ *                   6  PID as logged (the reference PID if the log had none)
+ *                   7  checksum as logged
+ *                   8  data bytes
+ *
+ *    Index       One CAP_INDEX_ENTRY_LEN entry per block:
+ *                   0  first frame number (u64)
+ *                   8  first frame's timestamp, us (u64)
+ *                  16  file offset of the first record (u64)
+ *
+ *    Postings    A directory of CAP_POSTINGS_DIR_ENTRY_LEN entries, one per ID:
+ *                   0  number of frames with that ID (u64)
+ *                   8  file offset of its list (u64)
+ *                  16  list length in bytes (u64)
+ *                followed by the lists. Each frame in a list is two LEB128
+ *                varints: its record offset and its timestamp (us), both
+ *                relative to the previous frame in the same list (0 for
+ *                the first).
+ *
+ * A block holds up to the header's frames-per-block records. One is closed
+ * early if the gap to the next frame doesn't fit in a record's u32 delta.
+ *
+ * Captures are written with postings. A capture without them gets them
+ * appended by CAP_AddPostings(); the rest of the file is left alone.
+ *
+ * Several captures (one per bus channel, say) can be read back as a single
+ * time-ordered stream with CAP_MergeOpen()/CAP_MergeNext(). Each input is read
+ * front to back, so the cost is a few heap swaps per frame on top of reading
+ * the files once.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_CAP_H
+#define LIN_CAP_H
+
+/* File Inclusions */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "lin_pid.h"
+#include "lin_log.h"
+
+/* Public Macro Definitions */
+#define CAP_VERSION                1u
+#define CAP_HEADER_LEN             56u
+#define CAP_RECORD_HEADER_LEN      8u
+#define CAP_INDEX_ENTRY_LEN        24u
+#define CAP_NUM_OF_IDS             (MAX_ID_ALLOWED + 1u)
+#define CAP_POSTINGS_DIR_ENTRY_LEN 24u
+#define CAP_POSTINGS_DIR_LEN       (CAP_NUM_OF_IDS * CAP_POSTINGS_DIR_ENTRY_LEN)
+#define CAP_MAX_FRAME_LEN          8u
+#define CAP_MAX_CHANNEL            15u
+#define CAP_DEFAULT_BLOCK_FRAMES   256u
+
+#define CAP_FLAG_PID_ERROR         0x40u
+#define CAP_FLAG_CHECKSUM_ERROR    0x80u
+
+/* Public Datatypes */
+
+struct CAP_Frame_S
+{
+   uint64_t timestamp_us;
+   uint8_t id;
+   uint8_t pid;
+   uint8_t checksum;
+   uint8_t length;
+   uint8_t channel;
+   uint8_t flags;                // CAP_FLAG_*
+   uint8_t data[CAP_MAX_FRAME_LEN];
+};
+
+struct CAP_PostingList_S
+{
+   uint8_t * buf;                // Encoded list
+   size_t len;
+   size_t cap;
+   uint64_t count;
+   uint64_t prev_offset;
+   uint64_t prev_us;
+};
+
+struct CAP_Writer_S
+{
+   FILE * fp;                    // Must be seekable; the header is rewritten on close
+   uint8_t * index;              // Serialized index entries, written out on close
+   size_t index_len;
+   size_t index_cap;
+   uint64_t num_frames;
+   uint64_t num_blocks;
+   uint64_t offset;              // Where the next record goes
+   uint64_t prev_us;
+   uint32_t block_frames;
+   uint32_t frames_in_block;
+   struct CAP_PostingList_S postings[CAP_NUM_OF_IDS];
+};
+
+struct CAP_Reader_S
+{
+   const uint8_t * base;         // Whole file
+   size_t size;
+   const uint8_t * index;
+   const uint8_t * postings;     // Directory, or NULL if the capture has none
+   uint64_t num_frames;
+   uint64_t num_blocks;
+   uint64_t index_offset;
+   uint64_t last_us;
+   uint32_t block_frames;
+   bool owned;                   // base is released by CAP_Close()
+   bool mapped;                  // ...with munmap() rather than free()
+};
+
+struct CAP_Cursor_S
+{
+   uint64_t frame;               // Number of the frame CAP_Next() returns next
+   uint64_t offset;              // Its record
+   uint64_t prev_us;             // Timestamp its delta is relative to
+   uint64_t block;
+};
+
+struct CAP_Postings_S
+{
+   const uint8_t * pos;          // Next varint
+   const uint8_t * end;
+   uint64_t remaining;           // Frames left in the list
+   uint64_t offset;              // Record of the frame returned last
+   uint64_t timestamp_us;
+   uint8_t id;
+};
+
+struct CAP_MergeHead_S
+{
+   uint64_t timestamp_us;        // Of the input's next frame; the heap key
+   uint32_t input;               // Breaks ties, so equal timestamps keep input order
+};
+
+struct CAP_MergeInput_S
+{
+   const struct CAP_Reader_S * reader;
+   struct CAP_Cursor_S cursor;
+   struct CAP_Frame_S next;      // Decoded, waiting for its turn
+};
+
+struct CAP_Merge_S
+{
+   struct CAP_MergeInput_S * inputs;
+   struct CAP_MergeHead_S * heap;   // Min-heap with one entry per input that has frames left
+   size_t num_inputs;
+   size_t heap_len;
+   uint64_t frames;              // Returned so far
+   uint64_t pid_errors;          // ...of which had a PID that doesn't match their ID
+   bool retag;                   // Channel becomes the input's position, from 1
+   bool corrupt;                 // An input ended before its last frame
+};
+
+struct CAP_ConvertStats_S
+{
+   uint64_t lines;
+   uint64_t frames;              // Written to the capture
+   uint64_t skipped;             // Frame lines that couldn't be stored (syntax, bad ID, length)
+   uint64_t blocks;
+};
+
+/* Public API */
+
+/**
+ * @brief Start a capture on fp, which must be open for binary writing and seekable.
+ *
+ * @param[in] block_frames Frames per index block; 0 for CAP_DEFAULT_BLOCK_FRAMES.
+ * @return GoodResult, or CaptureFileUnwritable.
+ */
+enum LIN_PID_Result_E CAP_WriterOpen( struct CAP_Writer_S * writer, FILE * fp, uint32_t block_frames );
+
+/**
+ * @brief Append a frame. Timestamps must never go backwards.
+ *
+ * @return GoodResult, CaptureTimestampsOutOfOrder, CaptureChannelOOR,
+ *         CaptureFileUnwritable, or OutOfMemory.
+ */
+enum LIN_PID_Result_E CAP_WriteFrame( struct CAP_Writer_S * writer, const struct CAP_Frame_S * frame );
+
+/**
+ * @brief Write the index and the final header, and release the writer.
+ *        fp is left open.
+ */
+enum LIN_PID_Result_E CAP_WriterClose( struct CAP_Writer_S * writer );
+
+/**
+ * @brief Convert a text log (see lin_log.h) into a capture.
+ *
+ * Lines are parsed and validated in parallel as in LOG_ProcessStream(). Frames
+ * with a PID or checksum mismatch are kept and flagged; lines that don't hold
+ * a complete frame are counted as skipped. Only the format, checksum,
+ * num_threads, and chunk_len options are used.
+ */
+enum LIN_PID_Result_E CAP_ConvertLog( FILE * in,
+                                      FILE * out,
+                                      const struct LOG_Options_S * options,
+                                      uint32_t block_frames,
+                                      struct CAP_ConvertStats_S * stats );
+
+/**
+ * @brief Memory-map a capture and check its header and index.
+ *
+ * @return GoodResult, CaptureFileUnreadable, or CaptureFileCorrupt.
+ */
+enum LIN_PID_Result_E CAP_Open( const char * path, struct CAP_Reader_S * reader );
+
+/**
+ * @brief Read a capture that's already in memory. buf must outlive the reader.
+ */
+enum LIN_PID_Result_E CAP_OpenMemory( const uint8_t * buf, size_t size, struct CAP_Reader_S * reader );
+
+void CAP_Close( struct CAP_Reader_S * reader );
+
+/**
+ * @brief Position cursor on frame number frame (0-based).
+ *
+ * @return false if there's no such frame or the capture is corrupt.
+ */
+bool CAP_SeekFrame( const struct CAP_Reader_S * reader, uint64_t frame, struct CAP_Cursor_S * cursor );
+
+/**
+ * @brief Position cursor on the first frame at or after timestamp_us.
+ *
+ * @return false if every frame is earlier or the capture is corrupt.
+ */
+bool CAP_SeekTime( const struct CAP_Reader_S * reader, uint64_t timestamp_us, struct CAP_Cursor_S * cursor );
+
+/**
+ * @brief Decode the frame under cursor and move on to the next one.
+ *
+ * @return false at the end of the capture, if a record runs off the end of
+ *         its data, or if the next block starts before this one ended.
+ */
+bool CAP_Next( const struct CAP_Reader_S * reader, struct CAP_Cursor_S * cursor, struct CAP_Frame_S * frame );
+
+/**
+ * @brief Start reading the posting list for id.
+ *
+ * @return false if the capture has no postings (see CAP_AddPostings()).
+ */
+bool CAP_PostingsOpen( const struct CAP_Reader_S * reader, uint8_t id, struct CAP_Postings_S * postings );
+
+/**
+ * @brief Decode the next frame in a posting list, straight from its record.
+ *
+ * @return false at the end of the list, or if the list or a record is corrupt.
+ */
+bool CAP_NextPosting( const struct CAP_Reader_S * reader, struct CAP_Postings_S * postings, struct CAP_Frame_S * frame );
+
+/**
+ * @brief Build posting lists for a capture that doesn't have them yet and
+ *        append them to the file. Does nothing if it already has them.
+ *
+ * @return GoodResult, CaptureFileUnreadable, CaptureFileCorrupt,
+ *         CaptureFileUnwritable, or OutOfMemory.
+ */
+enum LIN_PID_Result_E CAP_AddPostings( const char * path );
+
+/**
+ * @brief Start merging readers into one stream in timestamp order. The readers
+ *        must stay open until CAP_MergeClose().
+ *
+ * @param[in] retag Replace each frame's channel with its reader's position in
+ *                  readers, counting from 1, for captures that were each
+ *                  recorded as the same channel.
+ * @return GoodResult, CaptureChannelOOR if retag is set and there are more
+ *         readers than channels, or OutOfMemory.
+ */
+enum LIN_PID_Result_E CAP_MergeOpen( struct CAP_Merge_S * merge,
+                                     const struct CAP_Reader_S * readers,
+                                     size_t num_readers,
+                                     bool retag );
+
+/**
+ * @brief Next frame across every input. Its PID is checked against its ID
+ *        again, and CAP_FLAG_PID_ERROR set to match.
+ *
+ * @param[out] input Position of the reader the frame came from; may be NULL.
+ * @return false once every input is used up. merge->corrupt tells whether one
+ *         was cut short.
+ */
+bool CAP_MergeNext( struct CAP_Merge_S * merge, struct CAP_Frame_S * frame, size_t * input );
+
+void CAP_MergeClose( struct CAP_Merge_S * merge );
+
+/**
+ * @brief Seconds to whole microseconds, rounded to nearest.
+ */
+uint64_t CAP_SecondsToUs( double seconds ) __attribute__((const));
+
+#endif // LIN_CAP_H
@@ -0,0 +1,20 @@
+/*!
+ * @file    lin_char.c
+ * @brief   The character class table behind lin_char.h.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+
+#include "lin_char.h"
+
+/* Public Data */
+
+const uint16_t Char_Class[256] =
+{
+   #include "lin_char_class_table.h"
+};
@@ -0,0 +1,61 @@
+/*!
+ * @file    lin_char.h
+ * @brief   Character classes for every parser and tokenizer in the tool,
+ *          from one constant table instead of <ctype.h>.
+ *
+ * isxdigit() and friends go through the C locale machinery on every call
+ * and answer differently once something calls setlocale(); they're also
+ * undefined for a negative char, which is any byte past 0x7F on most
+ * targets. Char_Class[] is indexed by the byte as an unsigned char, means
+ * ASCII under any LC_ALL, and carries the value of a hex digit in its low
+ * nibble, so classifying a digit and converting it is one load.
+ *
+ * The entries themselves are in lin_char_class_table.h, so lin_pid.hpp can
+ * build the same table at compile time.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_CHAR_H
+#define LIN_CHAR_H
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public Macro Definitions */
+
+// Low nibble: the value of a hex (or decimal) digit, 0 for anything else
+#define CHAR_VALUE_MASK    0x000Fu
+
+#define CHAR_DEC_DIGIT     0x0010u  // 0-9
+#define CHAR_HEX_DIGIT     0x0020u  // 0-9, a-f, A-F
+#define CHAR_HEX_PREFIX    0x0040u  // x X, as in 0xZZ and xZZ
+#define CHAR_HEX_SUFFIX    0x0080u  // h H x X, as in ZZh and ZZx
+#define CHAR_DEC_SUFFIX    0x0100u  // d D, as in ZZd
+#define CHAR_BLANK         0x0200u  // Space and tab
+#define CHAR_SPACE         0x0400u  // Blank, \r, \f and \v; not \n, which parsers count lines on
+#define CHAR_TOKEN_DELIM   0x0800u  // NUL, whitespace and ',', between IDs piped in on stdin
+#define CHAR_ALPHA         0x1000u  // a-z, A-Z
+#define CHAR_IDENT_START   0x2000u  // Alpha and _
+#define CHAR_IDENT         0x4000u  // Alpha, 0-9 and _
+
+#define CHAR_CLASS(ch)           ( Char_Class[(unsigned char)(ch)] )
+#define CHAR_IS(ch, classes)     ( (CHAR_CLASS(ch) & (classes)) != 0u )
+#define CHAR_DIGIT_VALUE(ch)     ( (uint8_t)(CHAR_CLASS(ch) & CHAR_VALUE_MASK) )
+
+/* Public Data */
+
+extern const uint16_t Char_Class[256];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LIN_CHAR_H
@@ -0,0 +1,118 @@
+/**
+ * @file lin_char_class_table.h
+ * @brief The CHAR_* classes of every byte from 0x00 to 0xFF, in byte order.
+ *
+ * Just the initializer list, so Char_Class[] in lin_char.c and the
+ * compile-time table in lin_pid.hpp come from the same 256 entries:
+ *
+ *    const uint16_t TABLE[256] = {
+ *       #include "lin_char_class_table.h"
+ *    };
+ *
+ * Only ASCII has a class; 0x80 to 0xFF are 0 whatever the locale says.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+CHAR_TOKEN_DELIM,                                                                       /* 0x00 '\0' */
+0, 0, 0, 0, 0, 0, 0,                                                                    /* 0x01 - 0x07 */
+0,                                                                                      /* 0x08 */
+CHAR_BLANK | CHAR_SPACE | CHAR_TOKEN_DELIM,                                             /* 0x09 '\t' */
+CHAR_TOKEN_DELIM,                                                                       /* 0x0A '\n' */
+CHAR_SPACE | CHAR_TOKEN_DELIM,                                                          /* 0x0B '\v' */
+CHAR_SPACE | CHAR_TOKEN_DELIM,                                                          /* 0x0C '\f' */
+CHAR_SPACE | CHAR_TOKEN_DELIM,                                                          /* 0x0D '\r' */
+0, 0,                                                                                   /* 0x0E - 0x0F */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0x10 - 0x17 */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0x18 - 0x1F */
+CHAR_BLANK | CHAR_SPACE | CHAR_TOKEN_DELIM,                                             /* 0x20 ' ' */
+0, 0, 0, 0, 0, 0, 0,                                                                    /* 0x21 '!' - 0x27 '\'' */
+0, 0, 0, 0,                                                                             /* 0x28 '(' - 0x2B '+' */
+CHAR_TOKEN_DELIM,                                                                       /* 0x2C ',' */
+0, 0, 0,                                                                                /* 0x2D '-' - 0x2F '/' */
+CHAR_DEC_DIGIT | CHAR_HEX_DIGIT | CHAR_IDENT | 0x0u,                                    /* 0x30 '0' */
+CHAR_DEC_DIGIT | CHAR_HEX_DIGIT | CHAR_IDENT | 0x1u,                                    /* 0x31 '1' */
+CHAR_DEC_DIGIT | CHAR_HEX_DIGIT | CHAR_IDENT | 0x2u,                                    /* 0x32 '2' */
+CHAR_DEC_DIGIT | CHAR_HEX_DIGIT | CHAR_IDENT | 0x3u,                                    /* 0x33 '3' */
+CHAR_DEC_DIGIT | CHAR_HEX_DIGIT | CHAR_IDENT | 0x4u,                                    /* 0x34 '4' */
+CHAR_DEC_DIGIT | CHAR_HEX_DIGIT | CHAR_IDENT | 0x5u,                                    /* 0x35 '5' */
+CHAR_DEC_DIGIT | CHAR_HEX_DIGIT | CHAR_IDENT | 0x6u,                                    /* 0x36 '6' */
+CHAR_DEC_DIGIT | CHAR_HEX_DIGIT | CHAR_IDENT | 0x7u,                                    /* 0x37 '7' */
+CHAR_DEC_DIGIT | CHAR_HEX_DIGIT | CHAR_IDENT | 0x8u,                                    /* 0x38 '8' */
+CHAR_DEC_DIGIT | CHAR_HEX_DIGIT | CHAR_IDENT | 0x9u,                                    /* 0x39 '9' */
+0, 0, 0, 0, 0, 0,                                                                       /* 0x3A ':' - 0x3F '?' */
+0,                                                                                      /* 0x40 '@' */
+CHAR_HEX_DIGIT | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | 0xAu,                     /* 0x41 'A' */
+CHAR_HEX_DIGIT | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | 0xBu,                     /* 0x42 'B' */
+CHAR_HEX_DIGIT | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | 0xCu,                     /* 0x43 'C' */
+CHAR_HEX_DIGIT | CHAR_DEC_SUFFIX | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | 0xDu,   /* 0x44 'D' */
+CHAR_HEX_DIGIT | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | 0xEu,                     /* 0x45 'E' */
+CHAR_HEX_DIGIT | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | 0xFu,                     /* 0x46 'F' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x47 'G' */
+CHAR_HEX_SUFFIX | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                           /* 0x48 'H' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x49 'I' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x4A 'J' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x4B 'K' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x4C 'L' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x4D 'M' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x4E 'N' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x4F 'O' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x50 'P' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x51 'Q' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x52 'R' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x53 'S' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x54 'T' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x55 'U' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x56 'V' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x57 'W' */
+CHAR_HEX_PREFIX | CHAR_HEX_SUFFIX | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,         /* 0x58 'X' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x59 'Y' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x5A 'Z' */
+0, 0, 0, 0,                                                                             /* 0x5B '[' - 0x5E '^' */
+CHAR_IDENT_START | CHAR_IDENT,                                                          /* 0x5F '_' */
+0,                                                                                      /* 0x60 '`' */
+CHAR_HEX_DIGIT | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | 0xAu,                     /* 0x61 'a' */
+CHAR_HEX_DIGIT | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | 0xBu,                     /* 0x62 'b' */
+CHAR_HEX_DIGIT | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | 0xCu,                     /* 0x63 'c' */
+CHAR_HEX_DIGIT | CHAR_DEC_SUFFIX | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | 0xDu,   /* 0x64 'd' */
+CHAR_HEX_DIGIT | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | 0xEu,                     /* 0x65 'e' */
+CHAR_HEX_DIGIT | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | 0xFu,                     /* 0x66 'f' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x67 'g' */
+CHAR_HEX_SUFFIX | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                           /* 0x68 'h' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x69 'i' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x6A 'j' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x6B 'k' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x6C 'l' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x6D 'm' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x6E 'n' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x6F 'o' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x70 'p' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x71 'q' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x72 'r' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x73 's' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x74 't' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x75 'u' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x76 'v' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x77 'w' */
+CHAR_HEX_PREFIX | CHAR_HEX_SUFFIX | CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,         /* 0x78 'x' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x79 'y' */
+CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,                                             /* 0x7A 'z' */
+0, 0, 0, 0, 0,                                                                          /* 0x7B '{' - 0x7F */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0x80 - 0x87 */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0x88 - 0x8F */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0x90 - 0x97 */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0x98 - 0x9F */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0xA0 - 0xA7 */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0xA8 - 0xAF */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0xB0 - 0xB7 */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0xB8 - 0xBF */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0xC0 - 0xC7 */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0xC8 - 0xCF */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0xD0 - 0xD7 */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0xD8 - 0xDF */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0xE0 - 0xE7 */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0xE8 - 0xEF */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0xF0 - 0xF7 */
+0, 0, 0, 0, 0, 0, 0, 0,                                                                 /* 0xF8 - 0xFF */
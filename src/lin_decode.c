@@ -0,0 +1,275 @@
+/*!
+ * @file    lin_decode.c
+ * @brief   Compile LDF frame layouts into shift/mask extraction plans and run
+ *          them over batches of frames, producing columnar signal arrays.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "lin_pid.h"
+#include "lin_ldf.h"
+#include "lin_decode.h"
+
+/* Local Macro Definitions */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+   #define PAYLOAD_IS_BIG_ENDIAN_HOST  1
+#else
+   #define PAYLOAD_IS_BIG_ENDIAN_HOST  0
+#endif
+
+/* Private Function Prototypes */
+static uint64_t LoadPayloadWord( const uint8_t data[LDF_MAX_FRAME_LEN] );
+
+/* Public Function Implementations */
+
+enum LIN_PID_Result_E LDF_CompileDecodePlan( const struct LDF_Database_S * db, struct LDF_DecodePlan_S * plan )
+{
+   assert( (db != NULL) && (plan != NULL) );
+
+   memset( plan, 0, sizeof(*plan) );
+
+   // One op per frame signal, plus one column per signal
+   if ( db->num_frame_signals > 0 )
+   {
+      plan->ops = malloc( db->num_frame_signals * sizeof(*plan->ops) );
+      if ( NULL == plan->ops )
+      {
+         return OutOfMemory;
+      }
+   }
+   if ( db->num_signals > 0 )
+   {
+      plan->columns = malloc( db->num_signals * sizeof(*plan->columns) );
+      if ( NULL == plan->columns )
+      {
+         LDF_FreeDecodePlan(plan);
+         return OutOfMemory;
+      }
+   }
+
+   for ( size_t i = 0; i < db->num_signals; i++ )
+   {
+      const struct LDF_Signal_S * signal = &db->signals[i];
+      struct LDF_DecodeColumn_S * column = &plan->columns[i];
+
+      column->name = signal->name;
+      column->size_bits = signal->size_bits;
+      column->unit = NULL;
+      column->scale = 1.0;
+      column->offset = 0.0;
+      if ( signal->encoding != LDF_NO_INDEX )
+      {
+         const struct LDF_Encoding_S * encoding = &db->encodings[signal->encoding];
+         column->unit = encoding->unit;
+         column->scale = encoding->scale;
+         column->offset = encoding->offset;
+      }
+   }
+   plan->num_columns = db->num_signals;
+
+   // Lay the ops out in ID order so each ID's ops are one contiguous run
+   for ( uint8_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      plan->ops_start[id] = (uint32_t)plan->num_ops;
+
+      const struct LDF_Frame_S * frame = LDF_FrameByID(db, id);
+      if ( NULL == frame )
+      {
+         continue;
+      }
+
+      plan->frame_len[id] = frame->length;
+      for ( uint16_t s = 0; s < frame->num_signals; s++ )
+      {
+         const struct LDF_FrameSignal_S * frame_signal = &db->frame_signals[frame->first_signal + s];
+         uint8_t size_bits = db->signals[frame_signal->signal].size_bits;
+
+         assert( (size_bits > 0) && (size_bits <= LDF_MAX_SIGNAL_BITS) );
+         assert( (frame_signal->bit_offset + size_bits) <= (LDF_MAX_FRAME_LEN * 8u) );
+
+         struct LDF_SignalOp_S * op = &plan->ops[plan->num_ops++];
+         op->shift = frame_signal->bit_offset;
+         op->mask = ( size_bits >= 64u ) ? UINT64_MAX : ( (UINT64_C(1) << size_bits) - 1u );
+         op->column = frame_signal->signal;
+      }
+   }
+   plan->ops_start[MAX_ID_ALLOWED + 1] = (uint32_t)plan->num_ops;
+
+   return GoodResult;
+}
+
+void LDF_FreeDecodePlan( struct LDF_DecodePlan_S * plan )
+{
+   assert( plan != NULL );
+
+   free(plan->ops);
+   free(plan->columns);
+   memset( plan, 0, sizeof(*plan) );
+}
+
+enum LIN_PID_Result_E LDF_InitColumns( const struct LDF_DecodePlan_S * plan,
+                                       size_t capacity,
+                                       struct LDF_SignalColumns_S * cols )
+{
+   assert( (plan != NULL) && (cols != NULL) );
+
+   memset( cols, 0, sizeof(*cols) );
+
+   // Row numbers are stored in 32 bits
+   if ( capacity > UINT32_MAX )
+   {
+      return OutOfMemory;
+   }
+
+   size_t num_columns = plan->num_columns;
+   if ( num_columns > 0 )
+   {
+      // A frame holds a signal at most once, so no column can get more values
+      // than there are rows. Each of the three arrays is one allocation.
+      if ( (capacity > 0) && (num_columns > (SIZE_MAX / sizeof(uint64_t) / capacity)) )
+      {
+         return OutOfMemory;
+      }
+      // cols owns every allocation as soon as it's made, so there's one way out
+      cols->values = calloc( num_columns, sizeof(*cols->values) );
+      cols->rows = calloc( num_columns, sizeof(*cols->rows) );
+      cols->counts = calloc( num_columns, sizeof(*cols->counts) );
+      cols->value_store = malloc( (num_columns * capacity * sizeof(uint64_t)) + 1u );
+      cols->row_store = malloc( (num_columns * capacity * sizeof(uint32_t)) + 1u );
+      if ( (NULL == cols->values) || (NULL == cols->rows) || (NULL == cols->counts) ||
+           (NULL == cols->value_store) || (NULL == cols->row_store) )
+      {
+         LDF_FreeColumns(cols);
+         return OutOfMemory;
+      }
+
+      for ( size_t c = 0; c < num_columns; c++ )
+      {
+         cols->values[c] = cols->value_store + (c * capacity);
+         cols->rows[c] = cols->row_store + (c * capacity);
+      }
+   }
+
+   cols->num_columns = num_columns;
+   cols->capacity = capacity;
+
+   return GoodResult;
+}
+
+void LDF_ResetColumns( struct LDF_SignalColumns_S * cols )
+{
+   assert( cols != NULL );
+
+   if ( cols->num_columns > 0 )
+   {
+      memset( cols->counts, 0, cols->num_columns * sizeof(*cols->counts) );
+   }
+   cols->num_rows = 0;
+   cols->frames_skipped = 0;
+}
+
+void LDF_FreeColumns( struct LDF_SignalColumns_S * cols )
+{
+   assert( cols != NULL );
+
+   free(cols->value_store);
+   free(cols->row_store);
+   free(cols->values);
+   free(cols->rows);
+   free(cols->counts);
+   memset( cols, 0, sizeof(*cols) );
+}
+
+size_t LDF_DecodeBatch( const struct LDF_DecodePlan_S * plan,
+                        const struct LIN_Frame_S * frames,
+                        size_t num_frames,
+                        struct LDF_SignalColumns_S * cols )
+{
+   assert( (plan != NULL) && (cols != NULL) );
+   assert( (frames != NULL) || (0 == num_frames) );
+   assert( cols->num_columns == plan->num_columns );
+
+   size_t room = cols->capacity - cols->num_rows;
+   size_t n = ( num_frames < room ) ? num_frames : room;
+
+   const struct LDF_SignalOp_S * ops = plan->ops;
+   uint64_t * const * values = cols->values;
+   uint32_t * const * rows = cols->rows;
+   size_t * counts = cols->counts;
+   uint32_t row = (uint32_t)cols->num_rows;
+   size_t skipped = 0;
+
+   for ( size_t i = 0; i < n; i++, row++ )
+   {
+      const struct LIN_Frame_S * frame = &frames[i];
+      uint8_t id = frame->id;
+
+      if ( (id > MAX_ID_ALLOWED) || (0 == plan->frame_len[id]) || (frame->length != plan->frame_len[id]) )
+      {
+         skipped++;
+         continue;
+      }
+
+      uint64_t payload = LoadPayloadWord(frame->data);
+      uint32_t end = plan->ops_start[id + 1];
+      for ( uint32_t o = plan->ops_start[id]; o < end; o++ )
+      {
+         uint16_t column = ops[o].column;
+         size_t count = counts[column];
+         values[column][count] = (payload >> ops[o].shift) & ops[o].mask;
+         rows[column][count] = row;
+         counts[column] = count + 1u;
+      }
+   }
+
+   cols->num_rows += n;
+   cols->frames_skipped += skipped;
+
+   return n;
+}
+
+void LDF_ScaleColumn( const struct LDF_DecodePlan_S * plan,
+                      const struct LDF_SignalColumns_S * cols,
+                      size_t column,
+                      double * out )
+{
+   assert( (plan != NULL) && (cols != NULL) );
+   assert( (column < plan->num_columns) && (column < cols->num_columns) );
+   assert( (out != NULL) || (0 == cols->counts[column]) );
+
+   const uint64_t * values = cols->values[column];
+   double scale = plan->columns[column].scale;
+   double offset = plan->columns[column].offset;
+   size_t count = cols->counts[column];
+
+   for ( size_t i = 0; i < count; i++ )
+   {
+      out[i] = ((double)values[i] * scale) + offset;
+   }
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief LIN sends data LSB first, byte 0 first, and LDF bit offsets count
+ *        from bit 0 of byte 0. Loading the payload little-endian therefore
+ *        puts every signal at (word >> offset).
+ */
+static uint64_t LoadPayloadWord( const uint8_t data[LDF_MAX_FRAME_LEN] )
+{
+   uint64_t word;
+   memcpy( &word, data, sizeof(word) );
+#if PAYLOAD_IS_BIG_ENDIAN_HOST
+   word = __builtin_bswap64(word);
+#endif
+   return word;
+}
@@ -0,0 +1,137 @@
+/*!
+ * @file    lin_decode.h
+ * @brief   Batch signal decoder driven by precompiled per-frame extraction
+ *          plans.
+ *
+ * LDF_CompileDecodePlan() walks an LDF database once and turns every frame's
+ * signal layout into a flat list of shift/mask ops over the frame's 64-bit
+ * payload word, grouped by frame ID. LDF_DecodeBatch() then decodes frames by
+ * loading the payload once and running the ops for that ID; nothing about the
+ * bit layout is interpreted per frame. Decoded values land in columnar arrays,
+ * one column per LDF signal.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_DECODE_H
+#define LIN_DECODE_H
+
+/* File Inclusions */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "lin_pid.h"
+#include "lin_ldf.h"
+
+/* Public Datatypes */
+
+// A frame as it came off the bus. Bytes past length are ignored.
+struct LIN_Frame_S
+{
+   uint8_t id;
+   uint8_t length;
+   uint8_t data[LDF_MAX_FRAME_LEN];
+};
+
+// value = (payload >> shift) & mask, appended to column
+struct LDF_SignalOp_S
+{
+   uint64_t mask;
+   uint16_t column;
+   uint8_t shift;
+};
+
+struct LDF_DecodeColumn_S
+{
+   const char * name;      // Points into the LDF database
+   const char * unit;      // NULL if the signal has no physical encoding/unit
+   double scale;           // physical = (raw * scale) + offset
+   double offset;
+   uint8_t size_bits;
+};
+
+struct LDF_DecodePlan_S
+{
+   struct LDF_SignalOp_S * ops;
+   size_t num_ops;
+   uint32_t ops_start[MAX_ID_ALLOWED + 2];   // Ops for ID i are ops[ops_start[i]] up to ops[ops_start[i+1]]
+   uint8_t frame_len[MAX_ID_ALLOWED + 1];    // 0 if the LDF has no frame with that ID
+
+   struct LDF_DecodeColumn_S * columns;      // Indexed like the database's signals
+   size_t num_columns;
+};
+
+struct LDF_SignalColumns_S
+{
+   uint64_t ** values;     // values[c][i] is the i-th raw value decoded for column c
+   uint32_t ** rows;       // rows[c][i] is the input frame it came from, counted since the last reset
+   size_t * counts;        // How many values each column holds
+   uint64_t * value_store; // Every column's values, in one allocation that values[] points into
+   uint32_t * row_store;   // ...and the same for rows[]
+   size_t num_columns;
+   size_t capacity;        // Input frames the columns can take before they need a reset
+
+   size_t num_rows;        // Input frames consumed since the last reset
+   size_t frames_skipped;  // Of those, how many had an unknown ID or the wrong length
+};
+
+/* Public API */
+
+/**
+ * @brief Compile db's frame layouts into a decode plan.
+ *
+ * The plan borrows names from db, so db must outlive it.
+ *
+ * @return GoodResult, or OutOfMemory.
+ */
+enum LIN_PID_Result_E LDF_CompileDecodePlan( const struct LDF_Database_S * db, struct LDF_DecodePlan_S * plan );
+
+/**
+ * @brief Release everything LDF_CompileDecodePlan() allocated and zero plan.
+ */
+void LDF_FreeDecodePlan( struct LDF_DecodePlan_S * plan );
+
+/**
+ * @brief Allocate columns for plan that can take capacity input frames.
+ * @return GoodResult, or OutOfMemory.
+ */
+enum LIN_PID_Result_E LDF_InitColumns( const struct LDF_DecodePlan_S * plan,
+                                       size_t capacity,
+                                       struct LDF_SignalColumns_S * cols );
+
+/**
+ * @brief Empty the columns without freeing them.
+ */
+void LDF_ResetColumns( struct LDF_SignalColumns_S * cols );
+
+/**
+ * @brief Release everything LDF_InitColumns() allocated and zero cols.
+ */
+void LDF_FreeColumns( struct LDF_SignalColumns_S * cols );
+
+/**
+ * @brief Decode a batch of frames, appending every signal value to its column.
+ *
+ * Frames whose ID isn't in the plan, or whose length doesn't match the LDF,
+ * still take up a row but are otherwise skipped.
+ *
+ * @return How many frames were consumed. Less than num_frames once the
+ *         columns are full; reset them and carry on from there.
+ */
+size_t LDF_DecodeBatch( const struct LDF_DecodePlan_S * plan,
+                        const struct LIN_Frame_S * frames,
+                        size_t num_frames,
+                        struct LDF_SignalColumns_S * cols );
+
+/**
+ * @brief Convert every raw value in a column to its physical value.
+ * @param[out] out Must hold cols->counts[column] values.
+ */
+void LDF_ScaleColumn( const struct LDF_DecodePlan_S * plan,
+                      const struct LDF_SignalColumns_S * cols,
+                      size_t column,
+                      double * out );
+
+#endif // LIN_DECODE_H
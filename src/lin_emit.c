@@ -0,0 +1,321 @@
+/*!
+ * @file    lin_emit.c
+ * @brief   C and C++ header generator for PID lookups in table, parity, and
+ *          mask layouts.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "lin_pid.h"
+#include "lin_char.h"
+#include "lin_emit.h"
+
+/* Local Macro Definitions */
+#define PARITY_SHIFT             6u
+#define PARITY_MASK              0x3u
+#define IDS_PER_PARITY_BYTE      4u
+#define BYTES_PER_LINE           8u
+
+/* Datatypes */
+
+// How the two languages spell the same code
+struct Syntax_S
+{
+   const char * language_flag;
+   const char * u8;
+   const char * size;
+   const char * data;               // Storage for the tables
+   const char * function;           // And for the functions
+   const char * no_except;
+   const char * cast_u8;            // Opens a cast to u8, closed with " )"
+   const char * cast_uint;          // And to unsigned int, closed with ")"
+   const char * names;              // What starts every name
+};
+
+/* Private Function Prototypes */
+static void WriteBanner( FILE * out, const struct EMIT_Options_S * options, const char * guard );
+static void WriteTable( FILE * out, const struct Syntax_S * syntax, const char * name, const uint8_t * bytes, size_t len );
+static void WritePIDFunction( FILE * out, const struct EMIT_Options_S * options, const struct Syntax_S * syntax, const char * upper );
+static void WriteChecksumFunction( FILE * out, const struct Syntax_S * syntax );
+static void WriteChecks( FILE * out );
+static void ToUpper( const char * from, char * to );
+
+/* Local Variables */
+
+static const struct EMIT_Cost_S Costs[NUM_OF_EMIT_LAYOUTS] =
+{
+   [EMIT_LAYOUT_TABLE]  = { "table",  EMIT_PID_TABLE_LEN,    7u,   5u,   3u },
+   [EMIT_LAYOUT_PARITY] = { "parity", EMIT_PARITY_TABLE_LEN, 24u,  16u,  7u },
+   [EMIT_LAYOUT_MASK]   = { "mask",   2u * sizeof(uint64_t), 180u, 110u, 12u },
+};
+
+static const struct Syntax_S CSyntax =
+{
+   "--emit-c", "uint8_t", "uint8_t", "static const", "static inline", "", "(uint8_t)(", "(unsigned int)(", NULL
+};
+
+static const struct Syntax_S CPPSyntax =
+{
+   "--emit-cpp", "std::uint8_t", "std::size_t", "constexpr", "constexpr", " noexcept",
+   "static_cast<std::uint8_t>(", "static_cast<unsigned int>(", ""
+};
+
+/* Public Function Implementations */
+
+enum LIN_PID_Result_E EMIT_Header( FILE * out, const struct EMIT_Options_S * options )
+{
+   assert( (out != NULL) && (options != NULL) && (options->layout < NUM_OF_EMIT_LAYOUTS) );
+   assert( EMIT_PrefixIsValid(options->prefix) );
+
+   struct Syntax_S syntax = ( EMIT_C == options->language ) ? CSyntax : CPPSyntax;
+   char names[EMIT_MAX_PREFIX_LEN + 2u];
+   char upper[EMIT_MAX_PREFIX_LEN + 1u];
+   (void)snprintf(names, sizeof(names), "%s_", options->prefix);
+   ToUpper(options->prefix, upper);
+   syntax.names = ( EMIT_C == options->language ) ? names : "";
+
+   char guard[EMIT_MAX_PREFIX_LEN + sizeof("_PID_LUT_HPP")];
+   (void)snprintf(guard, sizeof(guard), "%s_PID_LUT_%s", upper, (EMIT_C == options->language) ? "H" : "HPP");
+   WriteBanner(out, options, guard);
+
+   if ( EMIT_C == options->language )
+   {
+      fprintf(out, "#include <stdint.h>\n#include <stdbool.h>\n\n");
+   }
+   else
+   {
+      fprintf(out, "#include <cstddef>\n#include <cstdint>\n\nnamespace %s\n{\n\n", options->prefix);
+   }
+
+   if ( EMIT_LAYOUT_TABLE == options->layout )
+   {
+      uint8_t table[EMIT_PID_TABLE_LEN];
+      for ( uint8_t id = 0; id < EMIT_PID_TABLE_LEN; id++ )
+      {
+         table[id] = ComputePID(id);
+      }
+      WriteTable(out, &syntax, "pid_table", table, sizeof(table));
+   }
+   else if ( EMIT_LAYOUT_PARITY == options->layout )
+   {
+      uint8_t table[EMIT_PARITY_TABLE_LEN];
+      EMIT_ParityTable(table);
+      fprintf(out, "// Bits 2k+1:2k of byte n are P1:P0 of ID 4n + k\n");
+      WriteTable(out, &syntax, "pid_parity", table, sizeof(table));
+   }
+   else
+   {
+      uint64_t p0;
+      uint64_t p1;
+      EMIT_ParityMasks(&p0, &p1);
+      fprintf(out, "// Bit n is set when ID n's P0 (P1) is\n");
+      if ( EMIT_C == options->language )
+      {
+         fprintf(out, "#define %s_PID_P0_MASK  UINT64_C(0x%016llX)\n", upper, (unsigned long long)p0);
+         fprintf(out, "#define %s_PID_P1_MASK  UINT64_C(0x%016llX)\n\n", upper, (unsigned long long)p1);
+      }
+      else
+      {
+         fprintf(out, "constexpr std::uint64_t pid_p0_mask = 0x%016llXull;\n", (unsigned long long)p0);
+         fprintf(out, "constexpr std::uint64_t pid_p1_mask = 0x%016llXull;\n\n", (unsigned long long)p1);
+      }
+   }
+
+   WritePIDFunction(out, options, &syntax, upper);
+   WriteChecksumFunction(out, &syntax);
+
+   if ( EMIT_CPP == options->language )
+   {
+      WriteChecks(out);
+      fprintf(out, "} // namespace %s\n\n", options->prefix);
+   }
+   fprintf(out, "#endif // %s\n", guard);
+
+   return ( ferror(out) || (fflush(out) != 0) ) ? EmitFileUnwritable : GoodResult;
+}
+
+bool EMIT_LayoutFromName( const char * name, enum EMIT_Layout_E * layout )
+{
+   assert( (name != NULL) && (layout != NULL) );
+
+   for ( size_t i = 0; i < NUM_OF_EMIT_LAYOUTS; i++ )
+   {
+      if ( strcmp(Costs[i].name, name) == 0 )
+      {
+         *layout = (enum EMIT_Layout_E)i;
+         return true;
+      }
+   }
+   return false;
+}
+
+const struct EMIT_Cost_S * EMIT_LayoutCost( enum EMIT_Layout_E layout )
+{
+   assert( layout < NUM_OF_EMIT_LAYOUTS );
+   return &Costs[layout];
+}
+
+bool EMIT_PrefixIsValid( const char * prefix )
+{
+   if ( (NULL == prefix) || !CHAR_IS(prefix[0], CHAR_IDENT_START) ||
+        (strlen(prefix) > EMIT_MAX_PREFIX_LEN) )
+   {
+      return false;
+   }
+   for ( const char * c = prefix; *c != '\0'; c++ )
+   {
+      if ( !CHAR_IS(*c, CHAR_IDENT) )
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+void EMIT_ParityTable( uint8_t table[EMIT_PARITY_TABLE_LEN] )
+{
+   assert( table != NULL );
+
+   memset( table, 0, EMIT_PARITY_TABLE_LEN );
+   for ( uint8_t id = 0; id < EMIT_PID_TABLE_LEN; id++ )
+   {
+      unsigned int parity = ( (unsigned int)ComputePID(id) >> PARITY_SHIFT ) & PARITY_MASK;
+      table[id / IDS_PER_PARITY_BYTE] |= (uint8_t)( parity << (2u * (id % IDS_PER_PARITY_BYTE)) );
+   }
+}
+
+void EMIT_ParityMasks( uint64_t * p0, uint64_t * p1 )
+{
+   assert( (p0 != NULL) && (p1 != NULL) );
+
+   *p0 = 0;
+   *p1 = 0;
+   for ( uint8_t id = 0; id < EMIT_PID_TABLE_LEN; id++ )
+   {
+      uint8_t pid = ComputePID(id);
+      *p0 |= (uint64_t)( (pid >> PARITY_SHIFT) & 1u ) << id;
+      *p1 |= (uint64_t)( (pid >> (PARITY_SHIFT + 1u)) & 1u ) << id;
+   }
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief What made the file, and what each layout costs, this one marked.
+ */
+static void WriteBanner( FILE * out, const struct EMIT_Options_S * options, const char * guard )
+{
+   const struct Syntax_S * syntax = ( EMIT_C == options->language ) ? &CSyntax : &CPPSyntax;
+
+   fprintf(out, "/*\n * LIN protected IDs (%s layout) and checksums.\n", Costs[options->layout].name);
+   fprintf(out, " * Generated by: lin_pid %s --layout %s --prefix %s\n",
+           syntax->language_flag, Costs[options->layout].name, options->prefix);
+   fprintf(out, " * Do not edit; generate it again instead.\n *\n");
+   fprintf(out, " * Layout    Data     Cycles per lookup, roughly (-Os, data in flash)\n");
+   fprintf(out, " *                    8-bit (AVR)  16-bit (MSP430)  32-bit (Cortex-M3)\n");
+   for ( size_t i = 0; i < NUM_OF_EMIT_LAYOUTS; i++ )
+   {
+      fprintf(out, " * %-8s %3u B  %11u  %15u  %18u%s\n",
+              Costs[i].name, (unsigned int)Costs[i].data_bytes,
+              Costs[i].cycles_8bit, Costs[i].cycles_16bit, Costs[i].cycles_32bit,
+              (i == (size_t)options->layout) ? "   <- this one" : "");
+   }
+   fprintf(out, " *\n * On AVR, tables stay in flash only if they're PROGMEM and read with\n");
+   fprintf(out, " * pgm_read_byte(); otherwise they're copied to RAM at startup.\n */\n\n");
+   fprintf(out, "#ifndef %s\n#define %s\n\n", guard, guard);
+}
+
+static void WriteTable( FILE * out, const struct Syntax_S * syntax, const char * name, const uint8_t * bytes, size_t len )
+{
+   fprintf(out, "%s %s %s%s[%u] =\n{", syntax->data, syntax->u8, syntax->names, name, (unsigned int)len);
+   for ( size_t i = 0; i < len; i++ )
+   {
+      fprintf(out, "%s0x%02X%s", (0 == (i % BYTES_PER_LINE)) ? "\n   " : " ",
+              (unsigned int)bytes[i], (i + 1u < len) ? "," : "");
+   }
+   fprintf(out, "\n};\n\n");
+}
+
+/**
+ * @brief <names>pid(): ID to PID; bits above the 6 of the ID are ignored.
+ */
+static void WritePIDFunction( FILE * out, const struct EMIT_Options_S * options, const struct Syntax_S * syntax, const char * upper )
+{
+   fprintf(out, "// ID (0x00 to 0x3F; higher bits are ignored) to PID\n");
+   fprintf(out, "%s %s %spid( %s id )%s\n{\n", syntax->function, syntax->u8, syntax->names, syntax->u8, syntax->no_except);
+   if ( EMIT_LAYOUT_TABLE == options->layout )
+   {
+      fprintf(out, "   return %spid_table[id & 0x3Fu];\n", syntax->names);
+   }
+   else if ( EMIT_LAYOUT_PARITY == options->layout )
+   {
+      fprintf(out, "   id &= 0x3Fu;\n");
+      fprintf(out, "   return %s id | (((%s%spid_parity[id >> 2]) >> ((id & 3u) << 1)) & 3u) << 6) );\n",
+              syntax->cast_u8, syntax->cast_uint, syntax->names);
+   }
+   else if ( EMIT_C == options->language )
+   {
+      fprintf(out, "   id &= 0x3Fu;\n");
+      fprintf(out, "   return %s id | (((%s_PID_P0_MASK >> id) & 1u) << 6) | (((%s_PID_P1_MASK >> id) & 1u) << 7) );\n",
+              syntax->cast_u8, upper, upper);
+   }
+   else
+   {
+      fprintf(out, "   id &= 0x3Fu;\n");
+      fprintf(out, "   return %s id | (((pid_p0_mask >> id) & 1u) << 6) | (((pid_p1_mask >> id) & 1u) << 7) );\n",
+              syntax->cast_u8);
+   }
+   fprintf(out, "}\n\n");
+}
+
+/**
+ * @brief <names>checksum(): classic over the data, or enhanced with the PID
+ *        in the sum, as lin_log.h's LOG_Checksum().
+ */
+static void WriteChecksumFunction( FILE * out, const struct Syntax_S * syntax )
+{
+   fprintf(out, "// Classic checksum over the data, or enhanced (LIN 2.x) with the PID in the sum\n");
+   fprintf(out, "%s %s %schecksum( %s protected_id, const %s * data, %s length, bool enhanced )%s\n{\n",
+           syntax->function, syntax->u8, syntax->names, syntax->u8, syntax->u8, syntax->size, syntax->no_except);
+   fprintf(out, "   unsigned int sum = enhanced ? protected_id : 0u;\n");
+   fprintf(out, "   for ( %s i = 0; i < length; i++ )\n   {\n", syntax->size);
+   fprintf(out, "      sum += data[i];\n");
+   fprintf(out, "      if ( sum > 0xFFu )\n      {\n         sum -= 0xFFu;\n      }\n   }\n");
+   fprintf(out, "   return %s ~sum & 0xFFu );\n}\n\n", syntax->cast_u8);
+}
+
+/**
+ * @brief C++ only: a few PIDs checked at compile time, the ends of the ID
+ *        range and the diagnostic frames.
+ */
+static void WriteChecks( FILE * out )
+{
+   static const uint8_t ids[] = { 0x00u, 0x01u, 0x3Cu, 0x3Du, MAX_ID_ALLOWED };
+
+   fprintf(out, "static_assert(");
+   for ( size_t i = 0; i < sizeof(ids); i++ )
+   {
+      fprintf(out, "%s pid(0x%02X) == 0x%02X", (i > 0) ? " &&\n              " : "",
+              (unsigned int)ids[i], (unsigned int)ComputePID(ids[i]));
+   }
+   fprintf(out, ",\n              \"PID lookup disagrees with the LIN 2.x parity equations\" );\n\n");
+}
+
+static void ToUpper( const char * from, char * to )
+{
+   for ( ; *from != '\0'; from++, to++ )
+   {
+      *to = ( (*from >= 'a') && (*from <= 'z') ) ? (char)(*from - 'a' + 'A') : *from;
+   }
+   *to = '\0';
+}
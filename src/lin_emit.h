@@ -0,0 +1,106 @@
+/*!
+ * @file    lin_emit.h
+ * @brief   Generate ready-to-include C or C++ headers with PID lookups and a
+ *          checksum helper for embedded targets.
+ *
+ * Three layouts trade flash for lookup speed:
+ *
+ *    table    64 bytes: the PID for every ID, one load per lookup.
+ *    parity   16 bytes: only the two parity bits for every ID, 4 IDs to a
+ *             byte (bits 2k+1:2k of byte n are P1:P0 of ID 4n + k), so a
+ *             load, a shift, and an OR per lookup.
+ *    mask     Two 64-bit constants with bit n set when ID n's P0 (P1) is,
+ *             and an inline extractor. No table at all, but 64-bit shifts,
+ *             which 8 and 16-bit cores do in software.
+ *
+ * The C header is C99 (static inline). The C++ one is C++14: everything is
+ * constexpr and static_asserts check a few PIDs at compile time. Each starts
+ * with the rough size and cycle cost of every layout, for choosing between
+ * them.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_EMIT_H
+#define LIN_EMIT_H
+
+/* File Inclusions */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "lin_pid.h"
+
+/* Public Macro Definitions */
+#define EMIT_PID_TABLE_LEN       ( MAX_ID_ALLOWED + 1u )
+#define EMIT_PARITY_TABLE_LEN    ( EMIT_PID_TABLE_LEN / 4u )
+#define EMIT_MAX_PREFIX_LEN      32u
+#define EMIT_DEFAULT_PREFIX      "lin"
+
+/* Public Datatypes */
+
+enum EMIT_Language_E
+{
+   EMIT_C,
+   EMIT_CPP
+};
+
+enum EMIT_Layout_E
+{
+   EMIT_LAYOUT_TABLE,
+   EMIT_LAYOUT_PARITY,
+   EMIT_LAYOUT_MASK,
+   NUM_OF_EMIT_LAYOUTS
+};
+
+/**
+ * @brief What a layout costs: its data exactly, and cycles per lookup
+ *        roughly, as hand-counted for -Os code with the data in flash.
+ */
+struct EMIT_Cost_S
+{
+   const char * name;               // As given to --layout
+   size_t data_bytes;
+   unsigned int cycles_8bit;        // AVR
+   unsigned int cycles_16bit;       // MSP430
+   unsigned int cycles_32bit;       // Cortex-M3
+};
+
+struct EMIT_Options_S
+{
+   enum EMIT_Language_E language;
+   enum EMIT_Layout_E layout;
+   const char * prefix;             // Names start with it (the namespace in C++); a C identifier
+};
+
+/* Public API */
+
+/**
+ * @brief Write the header to out.
+ *
+ * @return GoodResult, or EmitFileUnwritable if a write fails.
+ */
+enum LIN_PID_Result_E EMIT_Header( FILE * out, const struct EMIT_Options_S * options );
+
+/**
+ * @brief Look up a layout by its --layout name.
+ */
+bool EMIT_LayoutFromName( const char * name, enum EMIT_Layout_E * layout );
+
+const struct EMIT_Cost_S * EMIT_LayoutCost( enum EMIT_Layout_E layout );
+
+/**
+ * @brief Whether prefix can start the generated names: a C identifier of up
+ *        to EMIT_MAX_PREFIX_LEN characters.
+ */
+bool EMIT_PrefixIsValid( const char * prefix );
+
+/**
+ * @brief The data behind the parity and mask layouts, as emitted.
+ */
+void EMIT_ParityTable( uint8_t table[EMIT_PARITY_TABLE_LEN] );
+void EMIT_ParityMasks( uint64_t * p0, uint64_t * p1 );
+
+#endif // LIN_EMIT_H
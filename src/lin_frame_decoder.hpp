@@ -0,0 +1,378 @@
+/*!
+ * @file    lin_frame_decoder.hpp
+ * @brief   Header-only C++ frame decoder whose checksum model, resync rule and
+ *          frame sink are template policies, so each combination compiles
+ *          into its own loop with nothing to decide per byte.
+ *
+ * The input is the byte stream a pty carries (see lin_node.h): a header is a
+ * bare 0x00 for the break, 0x55, and the PID, and the response is everything
+ * up to the next break, its last byte being the checksum. A 0x00 inside a
+ * response is a break only when 0x55 and a PID the resync policy accepts
+ * follow; otherwise it's data. Frames come out as CAP_Frame_S, flagged like
+ * TTY_DecoderFeed() flags them, without timestamps or a channel.
+ *
+ *    ChecksumPolicy   enhanced(id): whether the checksum covers the PID.
+ *                     ClassicChecksum, EnhancedChecksum, Lin2Checksum, or
+ *                     RuntimeChecksum for an enum LOG_Checksum_E.
+ *    ResyncPolicy     accept_header(pid): whether a header with that PID
+ *                     starts a frame. StrictResync takes only valid PIDs and
+ *                     drops the rest up to the next break; LenientResync
+ *                     takes any, flagging bad ones; RuntimeResync picks.
+ *    Sink             Called with each frame; FunctionSink wraps a C-style
+ *                     callback.
+ *
+ * The Runtime* policies and FunctionSink are what a decoder configured at run
+ * time looks like; benchmark_frame_decoder.cpp measures them against the
+ * static ones. Needs C++17.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_FRAME_DECODER_HPP
+#define LIN_FRAME_DECODER_HPP
+
+/* File Inclusions */
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include "lin_pid.hpp"
+#include "lin_log.h"
+#include "lin_cap.h"
+
+namespace lin_pid
+{
+
+/* Public Constants */
+
+constexpr std::uint8_t frame_sync_byte = 0x55u;
+constexpr std::uint8_t first_classic_only_id = 0x3Cu;    // Diagnostic frames use the classic checksum
+constexpr std::size_t max_response_len = CAP_MAX_FRAME_LEN + 1u;   // Data and checksum
+
+/* Public Datatypes */
+
+struct DecoderStats
+{
+   std::uint64_t bytes;
+   std::uint64_t breaks;
+   std::uint64_t frames;
+   std::uint64_t sync_errors;          // A break not followed by 0x55
+   std::uint64_t pid_errors;           // Bad PIDs, dropped or flagged
+   std::uint64_t checksum_errors;
+   std::uint64_t stray_bytes;          // Outside any frame, or past the longest response
+};
+
+/* Checksum Policies */
+
+/**
+ * @brief The LIN checksum: an inverted sum with carry of the data, and of
+ *        the PID too if enhanced. Same as LOG_Checksum().
+ */
+constexpr std::uint8_t checksum( std::uint8_t pid, const std::uint8_t * data, std::size_t length, bool enhanced ) noexcept
+{
+   unsigned int sum = enhanced ? pid : 0u;
+   for ( std::size_t i = 0; i < length; i++ )
+   {
+      sum += data[i];
+      sum = ( sum > UINT8_MAX ) ? (sum - UINT8_MAX) : sum;
+   }
+   return static_cast<std::uint8_t>( ~sum );
+}
+
+struct ClassicChecksum
+{
+   static constexpr bool enhanced( std::uint8_t ) noexcept { return false; }
+};
+
+struct EnhancedChecksum
+{
+   static constexpr bool enhanced( std::uint8_t ) noexcept { return true; }
+};
+
+// What --classic leaves off: enhanced except for the diagnostic frames
+struct Lin2Checksum
+{
+   static constexpr bool enhanced( std::uint8_t id ) noexcept { return id < first_classic_only_id; }
+};
+
+struct RuntimeChecksum
+{
+   LOG_Checksum_E model;
+
+   constexpr bool enhanced( std::uint8_t id ) const noexcept
+   {
+      return ( LOG_CHECKSUM_LIN2 == model ) && ( id < first_classic_only_id );
+   }
+};
+
+/* Resync Policies */
+
+struct StrictResync
+{
+   static constexpr bool accept_header( std::uint8_t pid ) noexcept { return validate_pid(pid); }
+};
+
+struct LenientResync
+{
+   static constexpr bool accept_header( std::uint8_t ) noexcept { return true; }
+};
+
+struct RuntimeResync
+{
+   bool strict;
+
+   constexpr bool accept_header( std::uint8_t pid ) const noexcept
+   {
+      return !strict || validate_pid(pid);
+   }
+};
+
+/* Sinks */
+
+struct FunctionSink
+{
+   void (*on_frame)( const CAP_Frame_S * frame, void * ctx );
+   void * ctx;
+
+   void operator()( const CAP_Frame_S & frame ) const
+   {
+      if ( on_frame != nullptr )
+      {
+         on_frame( &frame, ctx );
+      }
+   }
+};
+
+/* The Decoder */
+
+template <typename ChecksumPolicy, typename ResyncPolicy, typename Sink>
+class FrameDecoder
+{
+public:
+   explicit FrameDecoder( Sink sink = Sink(),
+                          ChecksumPolicy checksum_policy = ChecksumPolicy(),
+                          ResyncPolicy resync_policy = ResyncPolicy() )
+      : sink_( std::move(sink) ),
+        checksum_( checksum_policy ),
+        resync_( resync_policy )
+   {
+   }
+
+   /**
+    * @brief Decode len more bytes of the stream.
+    */
+   void feed( const std::uint8_t * bytes, std::size_t len )
+   {
+      assert( (bytes != nullptr) || (0u == len) );
+      stats_.bytes += len;
+      for ( std::size_t i = 0; i < len; i++ )
+      {
+         take_byte( bytes[i] );
+      }
+   }
+
+#ifdef __cpp_lib_span
+   void feed( std::span<const std::uint8_t> bytes )
+   {
+      feed( bytes.data(), bytes.size() );
+   }
+#endif
+
+   /**
+    * @brief Bytes went missing: drop the frame in progress without handing it out.
+    */
+   void resync() noexcept
+   {
+      state_ = State::idle;
+      held_len_ = 0;
+   }
+
+   /**
+    * @brief Hand out the frame in progress, if any. Call once the input ends.
+    */
+   void flush()
+   {
+      end_frame();
+   }
+
+   const DecoderStats & stats() const noexcept { return stats_; }
+   Sink & sink() noexcept { return sink_; }
+
+private:
+   enum class State
+   {
+      idle,                            // Waiting for a break
+      sync,
+      pid,
+      response
+   };
+
+   void take_byte( std::uint8_t value )
+   {
+      // A 0x00 in a response, maybe with 0x55 after it, is a header only if
+      // a PID the resync policy takes comes next
+      if ( held_len_ > 0u )
+      {
+         if ( (1u == held_len_) && (frame_sync_byte == value) )
+         {
+            held_len_ = 2u;
+            return;
+         }
+         if ( (2u == held_len_) && (value != 0x00u) && resync_.accept_header(value) )
+         {
+            held_len_ = 0;
+            start_frame();
+            take_pid( value );
+            return;
+         }
+         release_held();
+      }
+
+      if ( (0x00u == value) && (state_ != State::response) )
+      {
+         start_frame();
+         return;
+      }
+
+      switch ( state_ )
+      {
+         case State::sync:
+            if ( frame_sync_byte == value )
+            {
+               state_ = State::pid;
+            }
+            else
+            {
+               stats_.sync_errors++;
+               state_ = State::idle;
+            }
+            break;
+
+         case State::pid:
+            if ( resync_.accept_header(value) )
+            {
+               take_pid( value );
+            }
+            else
+            {
+               stats_.pid_errors++;
+               state_ = State::idle;
+            }
+            break;
+
+         case State::response:
+            if ( (0x00u == value) && (response_len_ < max_response_len) )
+            {
+               held_len_ = 1u;
+            }
+            else if ( 0x00u == value )
+            {
+               // No room for it in the response, so it can only be a break
+               start_frame();
+            }
+            else
+            {
+               append_response( value );
+            }
+            break;
+
+         case State::idle:
+         default:
+            stats_.stray_bytes++;
+            break;
+      }
+   }
+
+   void take_pid( std::uint8_t pid )
+   {
+      frame_.pid = pid;
+      frame_.id = static_cast<std::uint8_t>( pid & MAX_ID_ALLOWED );
+      frame_.flags = validate_pid(pid) ? 0u : static_cast<std::uint8_t>(CAP_FLAG_PID_ERROR);
+      response_len_ = 0;
+      state_ = State::response;
+   }
+
+   void append_response( std::uint8_t value )
+   {
+      if ( response_len_ < max_response_len )
+      {
+         response_[response_len_++] = value;
+      }
+      else
+      {
+         stats_.stray_bytes++;
+      }
+   }
+
+   // What was held back as a possible header is response data after all
+   void release_held()
+   {
+      static constexpr std::uint8_t HELD[2] = { 0x00u, frame_sync_byte };
+      const std::uint8_t held_len = held_len_;
+      held_len_ = 0;
+      for ( std::uint8_t i = 0; i < held_len; i++ )
+      {
+         append_response( HELD[i] );
+      }
+   }
+
+   // A break: hand out the frame before it and look for the next header
+   void start_frame()
+   {
+      end_frame();
+      stats_.breaks++;
+      frame_ = CAP_Frame_S {};
+      state_ = State::sync;
+   }
+
+   void end_frame()
+   {
+      release_held();
+      if ( state_ != State::response )
+      {
+         state_ = State::idle;
+         return;
+      }
+      state_ = State::idle;
+
+      CAP_Frame_S & frame = frame_;
+      if ( response_len_ > 0u )
+      {
+         frame.length = static_cast<std::uint8_t>( response_len_ - 1u );
+         std::memcpy( frame.data, response_, frame.length );
+         frame.checksum = response_[frame.length];
+         if ( checksum(frame.pid, frame.data, frame.length, checksum_.enhanced(frame.id)) != frame.checksum )
+         {
+            frame.flags = static_cast<std::uint8_t>( frame.flags | CAP_FLAG_CHECKSUM_ERROR );
+         }
+      }
+
+      stats_.frames++;
+      stats_.pid_errors += ( (frame.flags & CAP_FLAG_PID_ERROR) != 0u ) ? 1u : 0u;
+      stats_.checksum_errors += ( (frame.flags & CAP_FLAG_CHECKSUM_ERROR) != 0u ) ? 1u : 0u;
+      sink_( frame );
+   }
+
+   Sink sink_;
+   ChecksumPolicy checksum_;
+   ResyncPolicy resync_;
+   DecoderStats stats_ {};
+
+   State state_ = State::idle;
+   CAP_Frame_S frame_ {};
+   std::uint8_t response_[max_response_len] {};
+   std::size_t response_len_ = 0;
+   std::uint8_t held_len_ = 0;         // 0x00 (and 0x55) held back in a response
+};
+
+/**
+ * @brief The decoder configured at run time, as the C decoders are.
+ */
+using RuntimeFrameDecoder = FrameDecoder<RuntimeChecksum, RuntimeResync, FunctionSink>;
+
+} // namespace lin_pid
+
+#endif // LIN_FRAME_DECODER_HPP
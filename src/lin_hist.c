@@ -0,0 +1,178 @@
+/*!
+ * @file    lin_hist.c
+ * @brief   Log-linear (HDR-style) latency histograms.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include "lin_hist.h"
+
+/* Local Macro Definitions */
+#define SUB_BUCKETS              ( UINT64_C(1) << HIST_SUB_BITS )
+#define SUB_MASK                 ( SUB_BUCKETS - 1u )
+
+// One writer, any number of readers: relaxed atomics are enough to keep each
+// counter whole. Without them, read a histogram only from its own thread.
+#ifdef __GNUC__
+#define LOAD_RELAXED(ptr)        __atomic_load_n( (ptr), __ATOMIC_RELAXED )
+#define STORE_RELAXED(ptr, val)  __atomic_store_n( (ptr), (val), __ATOMIC_RELAXED )
+#else
+#define LOAD_RELAXED(ptr)        ( *(ptr) )
+#define STORE_RELAXED(ptr, val)  ( *(ptr) = (val) )
+#endif
+
+/* Private Function Prototypes */
+static unsigned int HighestBit( uint64_t value );
+
+/* Public Function Implementations */
+
+void Hist_Init( struct Hist_S * hist )
+{
+   assert( hist != NULL );
+   memset( hist, 0, sizeof(*hist) );
+   hist->min = UINT64_MAX;
+}
+
+void Hist_Record( struct Hist_S * hist, uint64_t value )
+{
+   assert( hist != NULL );
+
+   size_t bucket = Hist_Bucket(value);
+   STORE_RELAXED(&hist->buckets[bucket], hist->buckets[bucket] + 1u);
+   STORE_RELAXED(&hist->sum, hist->sum + value);
+   if ( value < hist->min )
+   {
+      STORE_RELAXED(&hist->min, value);
+   }
+   if ( value > hist->max )
+   {
+      STORE_RELAXED(&hist->max, value);
+   }
+   STORE_RELAXED(&hist->count, hist->count + 1u);
+}
+
+void Hist_Merge( struct Hist_S * into, const struct Hist_S * from )
+{
+   assert( (into != NULL) && (from != NULL) && (into != from) );
+
+   // The count is summed from the buckets, so a snapshot always agrees with
+   // itself even if from was being recorded into
+   for ( size_t b = 0; b < HIST_NUM_BUCKETS; b++ )
+   {
+      uint64_t n = LOAD_RELAXED(&from->buckets[b]);
+      into->buckets[b] += n;
+      into->count += n;
+   }
+   into->sum += LOAD_RELAXED(&from->sum);
+   uint64_t min = LOAD_RELAXED(&from->min);
+   uint64_t max = LOAD_RELAXED(&from->max);
+   into->min = ( min < into->min ) ? min : into->min;
+   into->max = ( max > into->max ) ? max : into->max;
+}
+
+uint64_t Hist_Percentile( const struct Hist_S * hist, double pct )
+{
+   assert( (hist != NULL) && (pct >= 0.0) && (pct <= 100.0) );
+   if ( 0 == hist->count )
+   {
+      return 0;
+   }
+
+   // Rank of the sample wanted, counting from 1
+   uint64_t rank = (uint64_t)( (pct / 100.0) * (double)hist->count + 0.5 );
+   rank = ( rank < 1u ) ? 1u : rank;
+   uint64_t seen = 0;
+   for ( size_t b = 0; b < HIST_NUM_BUCKETS; b++ )
+   {
+      seen += hist->buckets[b];
+      if ( seen >= rank )
+      {
+         uint64_t high = ( b == (HIST_NUM_BUCKETS - 1u) ) ? hist->max : Hist_BucketHigh(b);
+         high = ( high > hist->max ) ? hist->max : high;
+         return ( high < hist->min ) ? hist->min : high;
+      }
+   }
+   return hist->max;
+}
+
+double Hist_Mean( const struct Hist_S * hist )
+{
+   assert( hist != NULL );
+   return ( hist->count > 0 ) ? ((double)hist->sum / (double)hist->count) : 0.0;
+}
+
+uint64_t Hist_CountBetween( const struct Hist_S * hist, uint64_t from, uint64_t to )
+{
+   assert( hist != NULL );
+
+   uint64_t n = 0;
+   for ( size_t b = Hist_Bucket(from); (b < HIST_NUM_BUCKETS) && (Hist_BucketLow(b) < to); b++ )
+   {
+      n += ( Hist_BucketLow(b) >= from ) ? hist->buckets[b] : 0u;
+   }
+   return n;
+}
+
+size_t Hist_Bucket( uint64_t value )
+{
+   if ( value < SUB_BUCKETS )
+   {
+      return (size_t)value;
+   }
+   unsigned int top = HighestBit(value);
+   if ( top >= HIST_MAX_BITS )
+   {
+      return HIST_NUM_BUCKETS - 1u;
+   }
+
+   // Keep the HIST_SUB_BITS bits under the top one; each power of 2 from
+   // SUB_BUCKETS up takes the next SUB_BUCKETS buckets
+   unsigned int shift = top - HIST_SUB_BITS;
+   return ( (size_t)(shift + 1u) << HIST_SUB_BITS ) + (size_t)( (value >> shift) & SUB_MASK );
+}
+
+uint64_t Hist_BucketLow( size_t bucket )
+{
+   assert( bucket < HIST_NUM_BUCKETS );
+   if ( bucket < SUB_BUCKETS )
+   {
+      return (uint64_t)bucket;
+   }
+   unsigned int shift = (unsigned int)(bucket >> HIST_SUB_BITS) - 1u;
+   return ( SUB_BUCKETS | ((uint64_t)bucket & SUB_MASK) ) << shift;
+}
+
+uint64_t Hist_BucketHigh( size_t bucket )
+{
+   assert( bucket < HIST_NUM_BUCKETS );
+   if ( bucket == (HIST_NUM_BUCKETS - 1u) )
+   {
+      return UINT64_MAX;
+   }
+   return Hist_BucketLow(bucket + 1u) - 1u;
+}
+
+/* Private Function Implementations */
+
+static unsigned int HighestBit( uint64_t value )
+{
+   assert( value != 0u );
+#ifdef __GNUC__
+   return 63u - (unsigned int)__builtin_clzll( (unsigned long long)value );
+#else
+   unsigned int n = 0;
+   for ( ; value > 1u; value >>= 1 )
+   {
+      n++;
+   }
+   return n;
+#endif
+}
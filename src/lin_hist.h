@@ -0,0 +1,82 @@
+/*!
+ * @file    lin_hist.h
+ * @brief   Log-linear (HDR-style) histograms of latencies, in fixed memory.
+ *
+ * Values below 2^HIST_SUB_BITS each get a bucket of their own. Above that,
+ * every power of 2 is split into 2^HIST_SUB_BITS equal buckets, so a bucket
+ * is never wider than 1/2^HIST_SUB_BITS of the values in it, from a few ns to
+ * hours. Values from 2^HIST_MAX_BITS up all land in the last bucket; the
+ * exact min and max are kept besides.
+ *
+ * Recording never locks. Each histogram has one writer, normally one per
+ * thread, which updates it with relaxed atomic stores; any other thread may
+ * Hist_Merge() it into one of its own at any time for a snapshot, and sum
+ * several that way. A snapshot taken mid-record can be one sample behind in
+ * places, never torn.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_HIST_H
+#define LIN_HIST_H
+
+/* File Inclusions */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public Macro Definitions */
+#define HIST_SUB_BITS            6u       // 64 buckets per power of 2: within 1.6%
+#define HIST_MAX_BITS            44u      // 2^44 ns is almost 5 hours
+#define HIST_NUM_BUCKETS         ( ((HIST_MAX_BITS - HIST_SUB_BITS + 1u) << HIST_SUB_BITS) + 1u )   // And one from 2^HIST_MAX_BITS up
+
+/* Public Datatypes */
+
+struct Hist_S
+{
+   uint64_t count;
+   uint64_t sum;
+   uint64_t min;                    // UINT64_MAX until there's a sample
+   uint64_t max;
+   uint64_t buckets[HIST_NUM_BUCKETS];
+};
+
+/* Public API */
+
+void Hist_Init( struct Hist_S * hist );
+
+/**
+ * @brief Count one value. Only the histogram's one writer may call this.
+ */
+void Hist_Record( struct Hist_S * hist, uint64_t value );
+
+/**
+ * @brief Add from's samples into into, which must not be written by anyone
+ *        else meanwhile. from may be recorded into while this runs.
+ */
+void Hist_Merge( struct Hist_S * into, const struct Hist_S * from );
+
+/**
+ * @brief The highest value that shares a bucket with the pct'th percentile
+ *        (0 to 100), held within the min and max, or 0 if there are no
+ *        samples.
+ */
+uint64_t Hist_Percentile( const struct Hist_S * hist, double pct );
+
+double Hist_Mean( const struct Hist_S * hist );
+
+/**
+ * @brief Samples in the buckets that start from from up to, not including, to.
+ */
+uint64_t Hist_CountBetween( const struct Hist_S * hist, uint64_t from, uint64_t to );
+
+/**
+ * @brief Bucket value falls in, and the lowest and highest values that share it.
+ */
+size_t Hist_Bucket( uint64_t value );
+uint64_t Hist_BucketLow( size_t bucket );
+uint64_t Hist_BucketHigh( size_t bucket );
+
+#endif // LIN_HIST_H
@@ -0,0 +1,503 @@
+/*!
+ * @file    lin_la.c
+ * @brief   LIN frame recovery from logic-analyzer sample dumps, with a
+ *          word-at-a-time edge search.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "lin_pid.h"
+#include "lin_log.h"
+#include "lin_cap.h"
+#include "lin_baud.h"
+#include "lin_la.h"
+
+/* Local Macro Definitions */
+#define ID_MASK                  0x3Fu
+#define FIRST_CLASSIC_ONLY_ID    0x3Cu
+#define BITS_PER_UART_BYTE       10u      // Start, 8 data, stop
+#define STOP_BIT                 9u
+#define US_PER_SEC               1000000u
+#define SYNC_FALLING_EDGES       5u       // 0x55: start bit and data bits 1, 3, 5, 7
+#define SYNC_EDGE_TOLERANCE      0.125    // Of the 2-bit spacing between falling edges
+
+/* Datatypes */
+
+enum DecodeState_E
+{
+   STATE_IDLE,                // Waiting for a break
+   STATE_SYNC,
+   STATE_PID,
+   STATE_RESPONSE
+};
+
+struct Decoder_S
+{
+   const uint8_t * samples;
+   uint64_t num_samples;
+   double samples_per_bit;          // For the frame being read
+   bool detect;                     // No baud rate given
+   struct Baud_Estimator_S baud;
+   const struct LA_Options_S * options;
+   struct LA_Stats_S stats;
+
+   enum DecodeState_E state;
+   struct CAP_Frame_S frame;
+   uint8_t response[LA_MAX_RESPONSE_LEN];
+   uint8_t response_len;
+   bool response_bad;
+};
+
+/* Private Function Prototypes */
+static uint64_t NextEdge( const uint8_t * samples, uint64_t num_samples, uint64_t pos, unsigned int level );
+static unsigned int SampleAt( const uint8_t * samples, uint64_t pos );
+static uint64_t LoadWord( const uint8_t * src );
+static unsigned int CountTrailingZeros( uint64_t word );
+static bool MeasureSync( const struct Decoder_S * decoder, uint64_t from, double * bit_samples );
+static uint64_t BitCentre( const struct Decoder_S * decoder, uint64_t start, unsigned int bit );
+static bool ReadByte( const struct Decoder_S * decoder, uint64_t start, uint8_t * value, bool * framing_ok );
+static void TakeByte( struct Decoder_S * decoder, uint8_t value, bool framing_ok );
+static void EndFrame( struct Decoder_S * decoder );
+static void ReportStats( const struct Decoder_S * decoder, struct LA_Stats_S * stats );
+static uint64_t SampleToUs( uint64_t sample, uint64_t sample_rate_hz );
+
+/* Public Function Implementations */
+
+enum LIN_PID_Result_E LA_Decode( const uint8_t * samples,
+                                 size_t len,
+                                 const struct LA_Options_S * options,
+                                 struct LA_Stats_S * stats )
+{
+   assert( ((samples != NULL) || (0 == len)) && (options != NULL) );
+
+   if ( (options->baud > 0) && (options->sample_rate_hz < ((uint64_t)options->baud * LA_MIN_SAMPLES_PER_BIT)) )
+   {
+      return SampleRateTooLow;
+   }
+
+   struct Decoder_S decoder;
+   memset( &decoder, 0, sizeof(decoder) );
+   decoder.samples = samples;
+   decoder.num_samples = (uint64_t)len * 8u;
+   decoder.detect = ( 0 == options->baud );
+   decoder.samples_per_bit = decoder.detect ? 0.0 : ((double)options->sample_rate_hz / (double)options->baud);
+   Baud_Init(&decoder.baud);
+   decoder.options = options;
+   decoder.stats.samples = decoder.num_samples;
+   decoder.state = STATE_IDLE;
+
+   // An empty dump may come without a buffer at all
+   if ( 0u == len )
+   {
+      ReportStats(&decoder, stats);
+      return GoodResult;
+   }
+
+   uint64_t pos = 0;
+   while ( pos < decoder.num_samples )
+   {
+      // Everything starts on a falling edge: a break or a start bit
+      uint64_t fall = NextEdge(samples, decoder.num_samples, pos, 1u);
+      if ( fall >= decoder.num_samples )
+      {
+         break;
+      }
+      uint64_t rise = NextEdge(samples, decoder.num_samples, fall, 0u);
+      uint64_t low = rise - fall;
+
+      // A break is measured against the bit time so far, or, before there is
+      // one, against the sync field that has to follow it
+      double bit_samples = decoder.detect ? decoder.baud.bit_time : decoder.samples_per_bit;
+      double sync_bit_samples = 0.0;
+      bool is_break;
+      if ( bit_samples > 0.0 )
+      {
+         is_break = ( (double)low >= ((double)LA_BREAK_MIN_BITS * bit_samples) );
+      }
+      else
+      {
+         is_break = ( low >= ((uint64_t)LA_BREAK_MIN_BITS * LA_MIN_SAMPLES_PER_BIT) ) &&
+                    MeasureSync(&decoder, rise, &sync_bit_samples) &&
+                    ( (double)low >= ((double)LA_BREAK_MIN_BITS * sync_bit_samples) );
+      }
+
+      if ( is_break )
+      {
+         EndFrame(&decoder);
+         decoder.stats.breaks++;
+         memset( &decoder.frame, 0, sizeof(decoder.frame) );
+         decoder.frame.timestamp_us = SampleToUs(fall, options->sample_rate_hz);
+         decoder.frame.channel = options->channel;
+         decoder.state = STATE_SYNC;
+         if ( decoder.detect && ((sync_bit_samples > 0.0) || MeasureSync(&decoder, rise, &sync_bit_samples)) )
+         {
+            // Read the frame the way a slave would: at its own header's bit time
+            if ( Baud_Add(&decoder.baud, sync_bit_samples) )
+            {
+               decoder.samples_per_bit = sync_bit_samples;
+            }
+            else
+            {
+               decoder.stats.sync_outliers++;
+               decoder.samples_per_bit = decoder.baud.bit_time;
+            }
+         }
+         pos = rise;
+         continue;
+      }
+      if ( decoder.samples_per_bit <= 0.0 )
+      {
+         // No idea of the bit time yet, so nothing to read bytes with
+         pos = rise;
+         continue;
+      }
+
+      uint8_t value;
+      bool framing_ok;
+      if ( !ReadByte(&decoder, fall, &value, &framing_ok) )
+      {
+         // Cut off by the end of the dump
+         break;
+      }
+      TakeByte(&decoder, value, framing_ok);
+
+      // The next start bit can't begin before the middle of this stop bit
+      pos = BitCentre(&decoder, fall, STOP_BIT);
+   }
+   EndFrame(&decoder);
+
+   ReportStats(&decoder, stats);
+   return GoodResult;
+}
+
+enum LIN_PID_Result_E LA_DecodeFile( const char * path,
+                                     const struct LA_Options_S * options,
+                                     struct LA_Stats_S * stats )
+{
+   assert( (path != NULL) && (options != NULL) );
+
+#ifdef _WIN32
+   FILE * fp = fopen(path, "rb");
+   if ( NULL == fp )
+   {
+      return SampleFileUnreadable;
+   }
+   long size = ( fseek(fp, 0, SEEK_END) == 0 ) ? ftell(fp) : -1L;
+   uint8_t * buf = ( size > 0 ) ? malloc( (size_t)size ) : NULL;
+   bool read_ok = ( 0 == size ) ||
+                  ( ( buf != NULL ) && ( fseek(fp, 0, SEEK_SET) == 0 ) &&
+                    ( fread(buf, 1, (size_t)size, fp) == (size_t)size ) );
+   (void)fclose(fp);
+   if ( !read_ok )
+   {
+      free(buf);
+      return SampleFileUnreadable;
+   }
+   enum LIN_PID_Result_E result = LA_Decode(buf, (size_t)size, options, stats);
+   free(buf);
+   return result;
+#else
+   int fd = open(path, O_RDONLY);
+   if ( fd < 0 )
+   {
+      return SampleFileUnreadable;
+   }
+
+   struct stat st;
+   if ( fstat(fd, &st) != 0 )
+   {
+      (void)close(fd);
+      return SampleFileUnreadable;
+   }
+   if ( 0 == st.st_size )
+   {
+      (void)close(fd);
+      return LA_Decode(NULL, 0, options, stats);
+   }
+
+   size_t size = (size_t)st.st_size;
+   void * map = mmap( NULL, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+   (void)close(fd);   // The mapping keeps the file alive
+   if ( MAP_FAILED == map )
+   {
+      return SampleFileUnreadable;
+   }
+   (void)posix_madvise( map, size, POSIX_MADV_SEQUENTIAL );
+
+   enum LIN_PID_Result_E result = LA_Decode( (const uint8_t *)map, size, options, stats );
+   (void)munmap(map, size);
+   return result;
+#endif
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief First sample at or after pos that isn't level, or num_samples if
+ *        there is none.
+ */
+static uint64_t NextEdge( const uint8_t * samples, uint64_t num_samples, uint64_t pos, unsigned int level )
+{
+   // XOR with the level leaves a 1 wherever the line differs from it
+   uint64_t flip = ( level != 0u ) ? UINT64_MAX : 0u;
+   uint64_t num_words = num_samples / 64u;
+   uint64_t word = pos / 64u;
+   uint64_t mask = UINT64_MAX << (pos % 64u);
+
+   for ( ; word < num_words; word++ )
+   {
+      uint64_t diff = ( LoadWord(&samples[word * 8u]) ^ flip ) & mask;
+      if ( diff != 0u )
+      {
+         return (word * 64u) + CountTrailingZeros(diff);
+      }
+      mask = UINT64_MAX;
+   }
+
+   // Fewer than 8 bytes left
+   for ( pos = ( pos > (num_words * 64u) ) ? pos : (num_words * 64u); pos < num_samples; pos++ )
+   {
+      if ( SampleAt(samples, pos) != level )
+      {
+         return pos;
+      }
+   }
+   return num_samples;
+}
+
+static unsigned int SampleAt( const uint8_t * samples, uint64_t pos )
+{
+   return ( (unsigned int)samples[pos / 8u] >> (pos % 8u) ) & 1u;
+}
+
+/**
+ * @brief Little-endian, so sample n of the word is bit n. Compilers turn
+ *        this into a single load where the byte order allows.
+ */
+static uint64_t LoadWord( const uint8_t * src )
+{
+   uint64_t value = 0;
+   for ( unsigned int i = 0; i < 8u; i++ )
+   {
+      value |= (uint64_t)src[i] << (8u * i);
+   }
+   return value;
+}
+
+static unsigned int CountTrailingZeros( uint64_t word )
+{
+   assert( word != 0u );
+#ifdef __GNUC__
+   return (unsigned int)__builtin_ctzll( (unsigned long long)word );
+#else
+   unsigned int n = 0;
+   for ( ; 0u == (word & 1u); word >>= 1 )
+   {
+      n++;
+   }
+   return n;
+#endif
+}
+
+/**
+ * @brief Measure the bit time from the sync field that should start at the
+ *        first falling edge from from on.
+ *
+ * @return false unless the five falling edges are evenly spaced and each
+ *         dominant bit is about half the spacing, as 0x55 has to be.
+ */
+static bool MeasureSync( const struct Decoder_S * decoder, uint64_t from, double * bit_samples )
+{
+   uint64_t falls[SYNC_FALLING_EDGES];
+   uint64_t lows[SYNC_FALLING_EDGES];
+   uint64_t pos = from;
+   for ( unsigned int i = 0; i < SYNC_FALLING_EDGES; i++ )
+   {
+      falls[i] = NextEdge(decoder->samples, decoder->num_samples, pos, 1u);
+      pos = NextEdge(decoder->samples, decoder->num_samples, falls[i], 0u);
+      if ( pos >= decoder->num_samples )
+      {
+         return false;
+      }
+      lows[i] = pos - falls[i];
+   }
+
+   double spacing = (double)(falls[SYNC_FALLING_EDGES - 1u] - falls[0]) / (double)(SYNC_FALLING_EDGES - 1u);
+   double tolerance = SYNC_EDGE_TOLERANCE * spacing;
+   for ( unsigned int i = 0; i < SYNC_FALLING_EDGES; i++ )
+   {
+      double low_error = (double)lows[i] - (spacing / 2.0);
+      if ( (low_error > tolerance) || (low_error < -tolerance) )
+      {
+         return false;
+      }
+      if ( i > 0 )
+      {
+         double spacing_error = (double)(falls[i] - falls[i - 1u]) - spacing;
+         if ( (spacing_error > tolerance) || (spacing_error < -tolerance) )
+         {
+            return false;
+         }
+      }
+   }
+
+   *bit_samples = spacing / 2.0;
+   return ( *bit_samples >= (double)LA_MIN_SAMPLES_PER_BIT );
+}
+
+static uint64_t BitCentre( const struct Decoder_S * decoder, uint64_t start, unsigned int bit )
+{
+   return start + (uint64_t)( ((double)bit + 0.5) * decoder->samples_per_bit );
+}
+
+/**
+ * @brief One UART byte whose start bit falls at start.
+ *
+ * @return false if the dump ends before its stop bit.
+ */
+static bool ReadByte( const struct Decoder_S * decoder, uint64_t start, uint8_t * value, bool * framing_ok )
+{
+   if ( BitCentre(decoder, start, STOP_BIT) >= decoder->num_samples )
+   {
+      return false;
+   }
+
+   unsigned int byte = 0;
+   for ( unsigned int bit = 1; bit <= 8u; bit++ )
+   {
+      byte |= SampleAt( decoder->samples, BitCentre(decoder, start, bit) ) << (bit - 1u);
+   }
+   *value = (uint8_t)byte;
+   *framing_ok = ( 1u == SampleAt(decoder->samples, BitCentre(decoder, start, STOP_BIT)) );
+   return true;
+}
+
+static void TakeByte( struct Decoder_S * decoder, uint8_t value, bool framing_ok )
+{
+   struct LA_Stats_S * stats = &decoder->stats;
+   if ( !framing_ok )
+   {
+      stats->framing_errors++;
+   }
+
+   switch ( decoder->state )
+   {
+      case STATE_SYNC:
+         if ( framing_ok && (LA_SYNC_BYTE == value) )
+         {
+            decoder->state = STATE_PID;
+         }
+         else
+         {
+            stats->sync_errors++;
+            decoder->state = STATE_IDLE;
+         }
+         break;
+
+      case STATE_PID:
+         if ( !framing_ok )
+         {
+            decoder->state = STATE_IDLE;
+            break;
+         }
+         decoder->frame.pid = value;
+         decoder->frame.id = (uint8_t)(value & ID_MASK);
+         if ( ReferencePID(decoder->frame.id) != value )
+         {
+            decoder->frame.flags |= CAP_FLAG_PID_ERROR;
+         }
+         decoder->response_len = 0;
+         decoder->response_bad = false;
+         decoder->state = STATE_RESPONSE;
+         break;
+
+      case STATE_RESPONSE:
+         if ( decoder->response_len < LA_MAX_RESPONSE_LEN )
+         {
+            decoder->response[decoder->response_len++] = value;
+            decoder->response_bad = decoder->response_bad || !framing_ok;
+         }
+         else
+         {
+            stats->stray_bytes++;
+         }
+         break;
+
+      case STATE_IDLE:
+      default:
+         stats->stray_bytes++;
+         break;
+   }
+}
+
+/**
+ * @brief Hand out the frame in progress, if its header got as far as a PID.
+ */
+static void EndFrame( struct Decoder_S * decoder )
+{
+   if ( decoder->state != STATE_RESPONSE )
+   {
+      decoder->state = STATE_IDLE;
+      return;
+   }
+   decoder->state = STATE_IDLE;
+
+   struct CAP_Frame_S * frame = &decoder->frame;
+   if ( decoder->response_len > 0 )
+   {
+      frame->length = (uint8_t)(decoder->response_len - 1u);
+      memcpy( frame->data, decoder->response, frame->length );
+      frame->checksum = decoder->response[frame->length];
+
+      bool enhanced = ( LOG_CHECKSUM_LIN2 == decoder->options->checksum ) && ( frame->id < FIRST_CLASSIC_ONLY_ID );
+      if ( decoder->response_bad ||
+           (LOG_Checksum(frame->pid, frame->data, frame->length, enhanced) != frame->checksum) )
+      {
+         frame->flags |= CAP_FLAG_CHECKSUM_ERROR;
+      }
+   }
+
+   decoder->stats.frames++;
+   decoder->stats.pid_errors += ( (frame->flags & CAP_FLAG_PID_ERROR) != 0u ) ? 1u : 0u;
+   decoder->stats.checksum_errors += ( (frame->flags & CAP_FLAG_CHECKSUM_ERROR) != 0u ) ? 1u : 0u;
+   if ( decoder->options->on_frame != NULL )
+   {
+      decoder->options->on_frame( frame, decoder->options->ctx );
+   }
+}
+
+static void ReportStats( const struct Decoder_S * decoder, struct LA_Stats_S * stats )
+{
+   if ( stats != NULL )
+   {
+      *stats = decoder->stats;
+      stats->baud = decoder->detect ? Baud_Rate(&decoder->baud, (double)decoder->options->sample_rate_hz)
+                                    : (double)decoder->options->baud;
+   }
+}
+
+static uint64_t SampleToUs( uint64_t sample, uint64_t sample_rate_hz )
+{
+   // Split so the multiply can't overflow on long dumps
+   return ( (sample / sample_rate_hz) * US_PER_SEC ) +
+          ( ((sample % sample_rate_hz) * US_PER_SEC) / sample_rate_hz );
+}
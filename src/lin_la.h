@@ -0,0 +1,110 @@
+/*!
+ * @file    lin_la.h
+ * @brief   LIN frame recovery from raw logic-analyzer sample dumps.
+ *
+ * A dump is the LIN wire sampled at a fixed rate, one bit per sample, packed
+ * eight to a byte with the earliest sample in bit 0. 1 is recessive (idle) and
+ * 0 is dominant.
+ *
+ * Every frame starts with a break: a dominant stretch of at least 13 bit times
+ * from the master. A slave must take anything from LA_BREAK_MIN_BITS on as a
+ * break, so that's the threshold used here. The break delimiter is followed
+ * by UART bytes (start bit, 8 data bits LSB first, stop bit): the sync field
+ * 0x55, the PID, and then whatever response came back, up to the next break.
+ * The last response byte is taken as the checksum.
+ *
+ * Bytes are read by sampling each bit at its centre from the start bit's
+ * falling edge, so the only scanning is for the next edge. That is done a
+ * 64-bit word at a time: idle bus and stop bits go by 64 samples per step.
+ *
+ * Without a baud rate, it's found the way a slave finds it: from the spacing
+ * of the sync field's five falling edges, eight bit times end to end. Each
+ * header's measurement goes to a Baud_Estimator_S (see lin_baud.h), and the
+ * frame is read at that header's own bit time if the estimator accepts it,
+ * or at the estimate if not. Before there's an estimate, a dominant run only
+ * counts as a break if a well-formed sync field follows it and it is at least
+ * LA_BREAK_MIN_BITS of that sync field's bit times long.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_LA_H
+#define LIN_LA_H
+
+/* File Inclusions */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "lin_pid.h"
+#include "lin_log.h"
+#include "lin_cap.h"
+#include "lin_baud.h"
+
+/* Public Macro Definitions */
+#define LA_DEFAULT_BAUD          19200u   // The usual LIN rate, for callers that want one
+#define LA_BREAK_MIN_BITS        11u
+#define LA_MIN_SAMPLES_PER_BIT   4u      // Below this a bit centre can't be found reliably
+#define LA_SYNC_BYTE             0x55u
+#define LA_MAX_RESPONSE_LEN      ( CAP_MAX_FRAME_LEN + 1u )   // Data and checksum
+
+/* Public Datatypes */
+
+struct LA_Options_S
+{
+   uint64_t sample_rate_hz;
+   uint32_t baud;                   // 0 to detect it from the sync fields
+   enum LOG_Checksum_E checksum;
+   uint8_t channel;                 // Stamped on every frame
+
+   // Called for every frame recovered, in order. May be NULL.
+   void (*on_frame)( const struct CAP_Frame_S * frame, void * ctx );
+   void * ctx;
+};
+
+struct LA_Stats_S
+{
+   uint64_t samples;
+   uint64_t breaks;
+   uint64_t frames;
+   uint64_t sync_errors;            // Break not followed by a good 0x55
+   uint64_t framing_errors;         // Stop bit dominant
+   uint64_t pid_errors;
+   uint64_t checksum_errors;
+   uint64_t stray_bytes;            // Outside any frame, or past the longest response
+   uint64_t sync_outliers;          // Sync fields whose bit time the estimator rejected
+   double baud;                     // As given, or the final estimate (0 if no sync field was found)
+};
+
+/* Public API */
+
+/**
+ * @brief Recover every frame from a dump held in memory.
+ *
+ * Frames are stamped with the start of their break, in microseconds from the
+ * first sample, and flagged with CAP_FLAG_PID_ERROR and CAP_FLAG_CHECKSUM_ERROR
+ * as they deserve. A framing error in the response counts as a checksum error.
+ * A frame with no response comes out with length 0.
+ *
+ * @param[out] stats Totals for the dump; may be NULL.
+ * @return GoodResult, or SampleRateTooLow for a given baud rate. A detected
+ *         one whose sync field is under LA_MIN_SAMPLES_PER_BIT samples per
+ *         bit is never found.
+ */
+enum LIN_PID_Result_E LA_Decode( const uint8_t * samples,
+                                 size_t len,
+                                 const struct LA_Options_S * options,
+                                 struct LA_Stats_S * stats );
+
+/**
+ * @brief Same, for a dump file. The file is mapped rather than read in, so it
+ *        can be far bigger than memory.
+ *
+ * @return GoodResult, SampleFileUnreadable, or SampleRateTooLow.
+ */
+enum LIN_PID_Result_E LA_DecodeFile( const char * path,
+                                     const struct LA_Options_S * options,
+                                     struct LA_Stats_S * stats );
+
+#endif // LIN_LA_H
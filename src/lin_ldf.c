@@ -0,0 +1,1328 @@
+/*!
+ * @file    lin_ldf.c
+ * @brief   Hand-written lexer and recursive-descent parser for LIN
+ *          Description Files, producing an ID-indexed frame database.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "lin_pid.h"
+#include "lin_char.h"
+#include "lin_ldf.h"
+
+/* Local Macro Definitions */
+#define INITIAL_ARRAY_CAPACITY   16u
+#define INITIAL_HASH_CAPACITY    64u      // Must be a power of 2
+#define FNV1A_OFFSET_BASIS       2166136261u
+#define FNV1A_PRIME              16777619u
+#define BITS_PER_KBIT            1000.0
+#define MASTER_REQ_FRAME_ID      0x3Cu
+
+/* Datatypes */
+
+enum LDF_TokenType_E
+{
+   LDF_TOKEN_END,
+   LDF_TOKEN_IDENT,
+   LDF_TOKEN_NUMBER,
+   LDF_TOKEN_STRING,
+   LDF_TOKEN_PUNCT,
+   LDF_TOKEN_INVALID       // e.g., an unterminated string
+};
+
+struct LDF_Token_S
+{
+   enum LDF_TokenType_E type;
+   const char * start;     // For strings, excludes the quotes
+   size_t len;
+   size_t line;
+   double number;
+   uint64_t integer;
+   bool is_integer;
+};
+
+struct LDF_Parser_S
+{
+   const char * cur;
+   const char * end;
+   size_t line;
+   struct LDF_Token_S tok;       // One token of lookahead
+   struct LDF_Database_S * db;
+   enum LIN_PID_Result_E err;
+
+   // Only needed while parsing
+   size_t strings_cap;
+   size_t nodes_cap;
+   size_t signals_cap;
+   size_t frames_cap;
+   size_t frame_signals_cap;
+   size_t schedule_tables_cap;
+   size_t schedule_entries_cap;
+   size_t encodings_cap;
+   uint32_t * signal_hash;       // Open addressing. Holds signal index + 1; 0 is empty.
+   size_t signal_hash_cap;
+};
+
+/* Private Function Prototypes */
+
+static void NextToken( struct LDF_Parser_S * p );
+static void LexNumber( struct LDF_Parser_S * p );
+
+static bool Fail( struct LDF_Parser_S * p, enum LIN_PID_Result_E err );
+static bool TokenIs( const struct LDF_Token_S * tok, const char * ident );
+static bool Accept( struct LDF_Parser_S * p, char punct );
+static bool Expect( struct LDF_Parser_S * p, char punct );
+static bool ExpectIdent( struct LDF_Parser_S * p, struct LDF_Token_S * ident );
+static bool ExpectInteger( struct LDF_Parser_S * p, uint64_t max, uint64_t * value );
+static bool ExpectValueWithUnit( struct LDF_Parser_S * p, double * value );
+static bool SkipBlockBody( struct LDF_Parser_S * p );
+static bool SkipStatement( struct LDF_Parser_S * p );
+
+static const char * Intern( struct LDF_Parser_S * p, const struct LDF_Token_S * tok );
+static void * GrowIfFull( void * arr, size_t len, size_t * cap, size_t elem_size );
+static uint32_t HashName( const char * str, size_t len );
+static bool AddSignalToHash( struct LDF_Parser_S * p, uint16_t signal_idx );
+static uint16_t FindSignal( const struct LDF_Parser_S * p, const struct LDF_Token_S * name );
+static uint16_t FindNode( const struct LDF_Database_S * db, const struct LDF_Token_S * name );
+static uint16_t FindFrame( const struct LDF_Database_S * db, const struct LDF_Token_S * name );
+static uint16_t FindEncoding( const struct LDF_Database_S * db, const struct LDF_Token_S * name );
+
+static bool ParseTopLevel( struct LDF_Parser_S * p );
+static bool ParseNodes( struct LDF_Parser_S * p );
+static bool ParseSignals( struct LDF_Parser_S * p );
+static bool ParseFrames( struct LDF_Parser_S * p, bool is_diagnostic );
+static bool ParseFrameSignals( struct LDF_Parser_S * p, struct LDF_Frame_S * frame );
+static bool ParseScheduleTables( struct LDF_Parser_S * p );
+static bool ParseEncodingTypes( struct LDF_Parser_S * p );
+static bool ParseEncodingValue( struct LDF_Parser_S * p, struct LDF_Encoding_S * encoding );
+static bool ParseSignalRepresentation( struct LDF_Parser_S * p );
+
+/* Public Function Implementations */
+
+enum LIN_PID_Result_E LDF_Parse( const char * text, size_t len, struct LDF_Database_S * db )
+{
+   assert( (text != NULL) || (0 == len) );
+   assert( db != NULL );
+
+   memset( db, 0, sizeof(*db) );
+   for ( size_t i = 0; i <= MAX_ID_ALLOWED; i++ )
+   {
+      db->frame_by_id[i] = LDF_NO_INDEX;
+   }
+
+   struct LDF_Parser_S p =
+   {
+      .cur = text,
+      .end = text + len,
+      .line = 1,
+      .db = db,
+      .err = GoodResult
+   };
+
+   // Every name is a distinct substring of text followed by at least one more
+   // byte (or the end), so the arena never has to grow and its pointers stay put.
+   p.strings_cap = len + 1;
+   db->strings = malloc(p.strings_cap);
+   if ( NULL == db->strings )
+   {
+      return OutOfMemory;
+   }
+
+   NextToken(&p);
+   bool success = ParseTopLevel(&p);
+
+   free(p.signal_hash);
+
+   if ( !success )
+   {
+      size_t error_line = p.tok.line;
+      LDF_Free(db);
+      db->error_line = error_line;
+      assert( p.err != GoodResult );
+      return p.err;
+   }
+
+   return GoodResult;
+}
+
+enum LIN_PID_Result_E LDF_Load( const char * path, struct LDF_Database_S * db )
+{
+   assert( (path != NULL) && (db != NULL) );
+
+   memset( db, 0, sizeof(*db) );
+
+   FILE * fp = fopen(path, "rb");
+   if ( NULL == fp )
+   {
+      return LDFFileUnreadable;
+   }
+
+   char * text = NULL;
+   long size = -1;
+   if ( fseek(fp, 0, SEEK_END) == 0 )
+   {
+      size = ftell(fp);
+   }
+   if ( (size < 0) || (fseek(fp, 0, SEEK_SET) != 0) )
+   {
+      fclose(fp);
+      return LDFFileUnreadable;
+   }
+
+   text = malloc( (size_t)size + 1 );
+   if ( NULL == text )
+   {
+      fclose(fp);
+      return OutOfMemory;
+   }
+
+   size_t num_read = fread(text, 1, (size_t)size, fp);
+   bool read_error = ( ferror(fp) != 0 );
+   fclose(fp);
+   if ( read_error )
+   {
+      free(text);
+      return LDFFileUnreadable;
+   }
+
+   enum LIN_PID_Result_E result = LDF_Parse(text, num_read, db);
+   free(text);
+
+   return result;
+}
+
+void LDF_Free( struct LDF_Database_S * db )
+{
+   assert( db != NULL );
+
+   free(db->strings);
+   free(db->nodes);
+   free(db->signals);
+   free(db->frames);
+   free(db->frame_signals);
+   free(db->schedule_tables);
+   free(db->schedule_entries);
+   free(db->encodings);
+
+   memset( db, 0, sizeof(*db) );
+   for ( size_t i = 0; i <= MAX_ID_ALLOWED; i++ )
+   {
+      db->frame_by_id[i] = LDF_NO_INDEX;
+   }
+}
+
+const struct LDF_Frame_S * LDF_FrameByID( const struct LDF_Database_S * db, uint8_t id )
+{
+   assert( db != NULL );
+
+   if ( (id > MAX_ID_ALLOWED) || (LDF_NO_INDEX == db->frame_by_id[id]) )
+   {
+      return NULL;
+   }
+
+   return &db->frames[ db->frame_by_id[id] ];
+}
+
+const struct LDF_Frame_S * LDF_FrameByName( const struct LDF_Database_S * db, const char * name )
+{
+   assert( (db != NULL) && (name != NULL) );
+
+   // There are at most a few dozen frames, so a scan is plenty
+   for ( size_t i = 0; i < db->num_frames; i++ )
+   {
+      if ( strcmp(db->frames[i].name, name) == 0 )
+      {
+         return &db->frames[i];
+      }
+   }
+
+   return NULL;
+}
+
+/* Lexer */
+
+/**
+ * @brief Advance p->tok to the next token, skipping whitespace and both
+ *        comment styles. Anything that isn't an identifier, number, or string
+ *        comes back as a single-character punctuation token.
+ */
+static void NextToken( struct LDF_Parser_S * p )
+{
+   assert( p != NULL );
+
+   // Work on locals: the compiler can't keep p->cur in a register across the
+   // stores to p->tok, and this loop is where the parser spends its time
+   const char * cur = p->cur;
+   const char * const end = p->end;
+   size_t line = p->line;
+
+   // Skip whitespace and comments
+   while ( cur < end )
+   {
+      char ch = *cur;
+      if ( '\n' == ch )
+      {
+         line++;
+         cur++;
+      }
+      else if ( CHAR_IS(ch, CHAR_SPACE) )
+      {
+         cur++;
+      }
+      else if ( ('/' == ch) && ((cur + 1) < end) && ('/' == cur[1]) )
+      {
+         while ( (cur < end) && (*cur != '\n') )
+         {
+            cur++;
+         }
+      }
+      else if ( ('/' == ch) && ((cur + 1) < end) && ('*' == cur[1]) )
+      {
+         cur += 2;
+         while ( (cur < end) && !( ('*' == cur[0]) && ((cur + 1) < end) && ('/' == cur[1]) ) )
+         {
+            if ( '\n' == *cur )
+            {
+               line++;
+            }
+            cur++;
+         }
+         cur = ( cur < end ) ? (cur + 2) : end;
+      }
+      else
+      {
+         break;
+      }
+   }
+
+   p->line = line;
+
+   struct LDF_Token_S * tok = &p->tok;
+   tok->start = cur;
+   tok->len = 0;
+   tok->line = line;
+   tok->is_integer = false;
+   p->cur = cur;
+
+   if ( cur >= end )
+   {
+      tok->type = LDF_TOKEN_END;
+      return;
+   }
+
+   char ch = *cur;
+   char next = ( (cur + 1) < end ) ? cur[1] : '\0';
+
+   if ( CHAR_IS(ch, CHAR_IDENT_START) )
+   {
+      while ( (cur < end) && CHAR_IS(*cur, CHAR_IDENT) )
+      {
+         cur++;
+      }
+      p->cur = cur;
+      tok->type = LDF_TOKEN_IDENT;
+      tok->len = (size_t)(cur - tok->start);
+   }
+   else if ( CHAR_IS(ch, CHAR_DEC_DIGIT) ||
+             ( (('-' == ch) || ('.' == ch)) && CHAR_IS(next, CHAR_DEC_DIGIT) ) )
+   {
+      LexNumber(p);
+   }
+   else if ( '"' == ch )
+   {
+      p->cur++;
+      tok->start = p->cur;
+      while ( (p->cur < p->end) && (*p->cur != '"') && (*p->cur != '\n') )
+      {
+         p->cur++;
+      }
+      if ( (p->cur >= p->end) || (*p->cur != '"') )
+      {
+         tok->type = LDF_TOKEN_INVALID;
+         return;
+      }
+      tok->type = LDF_TOKEN_STRING;
+      tok->len = (size_t)(p->cur - tok->start);
+      p->cur++;
+   }
+   else
+   {
+      tok->type = LDF_TOKEN_PUNCT;
+      tok->len = 1;
+      p->cur++;
+   }
+}
+
+/**
+ * @brief Lex a decimal integer, 0x-prefixed hex integer, or real number
+ *        (optionally negative, with fraction and exponent).
+ */
+static void LexNumber( struct LDF_Parser_S * p )
+{
+   struct LDF_Token_S * tok = &p->tok;
+   bool negative = false;
+
+   if ( '-' == *p->cur )
+   {
+      negative = true;
+      p->cur++;
+   }
+
+   uint64_t integer = 0;
+   bool overflow = false;
+
+   if ( ('0' == *p->cur) && ((p->cur + 1) < p->end) && CHAR_IS(p->cur[1], CHAR_HEX_PREFIX) )
+   {
+      p->cur += 2;
+      while ( (p->cur < p->end) && CHAR_IS(*p->cur, CHAR_HEX_DIGIT) )
+      {
+         uint8_t digit = CHAR_DIGIT_VALUE(*p->cur);
+         overflow = overflow || (integer > (UINT64_MAX >> 4));
+         integer = (integer << 4) | digit;
+         p->cur++;
+      }
+      tok->type = LDF_TOKEN_NUMBER;
+      tok->len = (size_t)(p->cur - tok->start);
+      tok->integer = integer;
+      tok->is_integer = !negative && !overflow;
+      tok->number = negative ? -(double)integer : (double)integer;
+      return;
+   }
+
+   double number = 0.0;
+   while ( (p->cur < p->end) && CHAR_IS(*p->cur, CHAR_DEC_DIGIT) )
+   {
+      uint64_t digit = CHAR_DIGIT_VALUE(*p->cur);
+      overflow = overflow || ( integer > ((UINT64_MAX - digit) / 10u) );
+      integer = (integer * 10u) + digit;
+      number = (number * 10.0) + (double)digit;
+      p->cur++;
+   }
+
+   bool is_integer = !negative && !overflow;
+
+   if ( (p->cur < p->end) && ('.' == *p->cur) )
+   {
+      is_integer = false;
+      p->cur++;
+      double scale = 0.1;
+      while ( (p->cur < p->end) && CHAR_IS(*p->cur, CHAR_DEC_DIGIT) )
+      {
+         number += scale * (double)CHAR_DIGIT_VALUE(*p->cur);
+         scale *= 0.1;
+         p->cur++;
+      }
+   }
+
+   if ( (p->cur < p->end) && (('e' == *p->cur) || ('E' == *p->cur)) )
+   {
+      const char * exp_start = p->cur;
+      p->cur++;
+      bool exp_negative = false;
+      if ( (p->cur < p->end) && (('-' == *p->cur) || ('+' == *p->cur)) )
+      {
+         exp_negative = ('-' == *p->cur);
+         p->cur++;
+      }
+      if ( (p->cur < p->end) && CHAR_IS(*p->cur, CHAR_DEC_DIGIT) )
+      {
+         int exponent = 0;
+         while ( (p->cur < p->end) && CHAR_IS(*p->cur, CHAR_DEC_DIGIT) )
+         {
+            exponent = (exponent < 1000) ? ((exponent * 10) + CHAR_DIGIT_VALUE(*p->cur)) : exponent;
+            p->cur++;
+         }
+         for ( int i = 0; i < exponent; i++ )
+         {
+            number = exp_negative ? (number / 10.0) : (number * 10.0);
+         }
+         is_integer = false;
+      }
+      else
+      {
+         p->cur = exp_start; // Just a number followed by an identifier
+      }
+   }
+
+   tok->type = LDF_TOKEN_NUMBER;
+   tok->len = (size_t)(p->cur - tok->start);
+   tok->integer = integer;
+   tok->is_integer = is_integer;
+   tok->number = negative ? -number : number;
+}
+
+/* Parser Helpers */
+
+static bool Fail( struct LDF_Parser_S * p, enum LIN_PID_Result_E err )
+{
+   if ( GoodResult == p->err )
+   {
+      p->err = err;
+   }
+   return false;
+}
+
+static bool TokenIs( const struct LDF_Token_S * tok, const char * ident )
+{
+   size_t len = strlen(ident);
+   return ( LDF_TOKEN_IDENT == tok->type ) &&
+          ( tok->len == len ) &&
+          ( memcmp(tok->start, ident, len) == 0 );
+}
+
+static bool Accept( struct LDF_Parser_S * p, char punct )
+{
+   if ( (LDF_TOKEN_PUNCT == p->tok.type) && (*p->tok.start == punct) )
+   {
+      NextToken(p);
+      return true;
+   }
+   return false;
+}
+
+static bool Expect( struct LDF_Parser_S * p, char punct )
+{
+   return Accept(p, punct) || Fail(p, LDFSyntaxError);
+}
+
+static bool ExpectIdent( struct LDF_Parser_S * p, struct LDF_Token_S * ident )
+{
+   if ( p->tok.type != LDF_TOKEN_IDENT )
+   {
+      return Fail(p, LDFSyntaxError);
+   }
+   *ident = p->tok;
+   NextToken(p);
+   return true;
+}
+
+static bool ExpectInteger( struct LDF_Parser_S * p, uint64_t max, uint64_t * value )
+{
+   if ( (p->tok.type != LDF_TOKEN_NUMBER) || !p->tok.is_integer )
+   {
+      return Fail(p, LDFSyntaxError);
+   }
+   if ( p->tok.integer > max )
+   {
+      return Fail(p, LDFValueOutOfRange);
+   }
+   *value = p->tok.integer;
+   NextToken(p);
+   return true;
+}
+
+/**
+ * @brief Parse a number with an optional unit after it, e.g. "5 ms" or "19.2 kbps".
+ */
+static bool ExpectValueWithUnit( struct LDF_Parser_S * p, double * value )
+{
+   if ( p->tok.type != LDF_TOKEN_NUMBER )
+   {
+      return Fail(p, LDFSyntaxError);
+   }
+   *value = p->tok.number;
+   NextToken(p);
+   if ( LDF_TOKEN_IDENT == p->tok.type )
+   {
+      NextToken(p);
+   }
+   return true;
+}
+
+/**
+ * @brief Skip everything up to and including the '}' that closes a block
+ *        whose '{' has already been consumed.
+ */
+static bool SkipBlockBody( struct LDF_Parser_S * p )
+{
+   size_t depth = 1;
+   while ( depth > 0 )
+   {
+      if ( (LDF_TOKEN_END == p->tok.type) || (LDF_TOKEN_INVALID == p->tok.type) )
+      {
+         return Fail(p, LDFSyntaxError);
+      }
+      if ( (LDF_TOKEN_PUNCT == p->tok.type) && ('{' == *p->tok.start) )
+      {
+         depth++;
+      }
+      else if ( (LDF_TOKEN_PUNCT == p->tok.type) && ('}' == *p->tok.start) )
+      {
+         depth--;
+      }
+      NextToken(p);
+   }
+   return true;
+}
+
+/**
+ * @brief Skip everything up to and including the next ';' that isn't nested
+ *        in braces.
+ */
+static bool SkipStatement( struct LDF_Parser_S * p )
+{
+   while ( !Accept(p, ';') )
+   {
+      if ( (LDF_TOKEN_END == p->tok.type) || (LDF_TOKEN_INVALID == p->tok.type) ||
+           ((LDF_TOKEN_PUNCT == p->tok.type) && ('}' == *p->tok.start)) )
+      {
+         return Fail(p, LDFSyntaxError);
+      }
+      if ( Accept(p, '{') )
+      {
+         if ( !SkipBlockBody(p) ) return false;
+      }
+      else
+      {
+         NextToken(p);
+      }
+   }
+   return true;
+}
+
+static const char * Intern( struct LDF_Parser_S * p, const struct LDF_Token_S * tok )
+{
+   struct LDF_Database_S * db = p->db;
+
+   assert( (db->strings_len + tok->len + 1) <= p->strings_cap );
+   if ( (db->strings_len + tok->len + 1) > p->strings_cap )
+   {
+      return NULL;
+   }
+
+   char * str = &db->strings[db->strings_len];
+   memcpy(str, tok->start, tok->len);
+   str[tok->len] = '\0';
+   db->strings_len += tok->len + 1;
+
+   return str;
+}
+
+/**
+ * @brief Make room for one more element in a dynamic array.
+ * @return The (possibly moved) array, or NULL if it had to grow and couldn't.
+ *         On NULL, the original array is still valid.
+ */
+static void * GrowIfFull( void * arr, size_t len, size_t * cap, size_t elem_size )
+{
+   if ( (arr != NULL) && (len < *cap) )
+   {
+      return arr;
+   }
+
+   size_t new_cap = ( *cap > 0 ) ? (*cap * 2u) : INITIAL_ARRAY_CAPACITY;
+   void * grown = realloc(arr, new_cap * elem_size);
+   if ( grown != NULL )
+   {
+      *cap = new_cap;
+   }
+   return grown;
+}
+
+static uint32_t HashName( const char * str, size_t len )
+{
+   uint32_t hash = FNV1A_OFFSET_BASIS;
+   for ( size_t i = 0; i < len; i++ )
+   {
+      hash ^= (uint8_t)str[i];
+      hash *= FNV1A_PRIME;
+   }
+   return hash;
+}
+
+static bool AddSignalToHash( struct LDF_Parser_S * p, uint16_t signal_idx )
+{
+   // Keep the load factor at or below 1/2 so probe sequences stay short
+   if ( ((size_t)signal_idx + 1u) * 2u > p->signal_hash_cap )
+   {
+      size_t new_cap = ( p->signal_hash_cap > 0 ) ? (p->signal_hash_cap * 2u) : INITIAL_HASH_CAPACITY;
+      uint32_t * new_hash = calloc(new_cap, sizeof(uint32_t));
+      if ( NULL == new_hash )
+      {
+         return Fail(p, OutOfMemory);
+      }
+      free(p->signal_hash);
+      p->signal_hash = new_hash;
+      p->signal_hash_cap = new_cap;
+
+      // Re-insert everything before this one
+      for ( uint16_t i = 0; i < signal_idx; i++ )
+      {
+         const char * name = p->db->signals[i].name;
+         size_t slot = HashName(name, strlen(name)) & (new_cap - 1u);
+         while ( new_hash[slot] != 0 )
+         {
+            slot = (slot + 1u) & (new_cap - 1u);
+         }
+         new_hash[slot] = (uint32_t)i + 1u;
+      }
+   }
+
+   const char * name = p->db->signals[signal_idx].name;
+   size_t slot = HashName(name, strlen(name)) & (p->signal_hash_cap - 1u);
+   while ( p->signal_hash[slot] != 0 )
+   {
+      slot = (slot + 1u) & (p->signal_hash_cap - 1u);
+   }
+   p->signal_hash[slot] = (uint32_t)signal_idx + 1u;
+
+   return true;
+}
+
+static uint16_t FindSignal( const struct LDF_Parser_S * p, const struct LDF_Token_S * name )
+{
+   if ( 0 == p->signal_hash_cap )
+   {
+      return LDF_NO_INDEX;
+   }
+
+   size_t slot = HashName(name->start, name->len) & (p->signal_hash_cap - 1u);
+   while ( p->signal_hash[slot] != 0 )
+   {
+      const char * candidate = p->db->signals[ p->signal_hash[slot] - 1u ].name;
+      if ( (strncmp(candidate, name->start, name->len) == 0) && ('\0' == candidate[name->len]) )
+      {
+         return (uint16_t)(p->signal_hash[slot] - 1u);
+      }
+      slot = (slot + 1u) & (p->signal_hash_cap - 1u);
+   }
+
+   return LDF_NO_INDEX;
+}
+
+static uint16_t FindNode( const struct LDF_Database_S * db, const struct LDF_Token_S * name )
+{
+   for ( size_t i = 0; i < db->num_nodes; i++ )
+   {
+      if ( (strncmp(db->nodes[i].name, name->start, name->len) == 0) && ('\0' == db->nodes[i].name[name->len]) )
+      {
+         return (uint16_t)i;
+      }
+   }
+   return LDF_NO_INDEX;
+}
+
+static uint16_t FindFrame( const struct LDF_Database_S * db, const struct LDF_Token_S * name )
+{
+   for ( size_t i = 0; i < db->num_frames; i++ )
+   {
+      if ( (strncmp(db->frames[i].name, name->start, name->len) == 0) && ('\0' == db->frames[i].name[name->len]) )
+      {
+         return (uint16_t)i;
+      }
+   }
+   return LDF_NO_INDEX;
+}
+
+static uint16_t FindEncoding( const struct LDF_Database_S * db, const struct LDF_Token_S * name )
+{
+   for ( size_t i = 0; i < db->num_encodings; i++ )
+   {
+      if ( (strncmp(db->encodings[i].name, name->start, name->len) == 0) && ('\0' == db->encodings[i].name[name->len]) )
+      {
+         return (uint16_t)i;
+      }
+   }
+   return LDF_NO_INDEX;
+}
+
+/* Grammar */
+
+/**
+ * @brief file := { ident ';' | ident '=' ... ';' | ident '{' ... '}' }
+ */
+static bool ParseTopLevel( struct LDF_Parser_S * p )
+{
+   while ( p->tok.type != LDF_TOKEN_END )
+   {
+      struct LDF_Token_S name;
+      if ( !ExpectIdent(p, &name) )
+      {
+         return false;
+      }
+
+      if ( Accept(p, '{') )
+      {
+         bool ok;
+         if ( TokenIs(&name, "Nodes") )                       ok = ParseNodes(p);
+         else if ( TokenIs(&name, "Signals") )                ok = ParseSignals(p);
+         else if ( TokenIs(&name, "Diagnostic_signals") )     ok = ParseSignals(p);
+         else if ( TokenIs(&name, "Frames") )                 ok = ParseFrames(p, false);
+         else if ( TokenIs(&name, "Diagnostic_frames") )      ok = ParseFrames(p, true);
+         else if ( TokenIs(&name, "Schedule_tables") )        ok = ParseScheduleTables(p);
+         else if ( TokenIs(&name, "Signal_encoding_types") )  ok = ParseEncodingTypes(p);
+         else if ( TokenIs(&name, "Signal_representation") )  ok = ParseSignalRepresentation(p);
+         else                                                 ok = SkipBlockBody(p);
+         if ( !ok )
+         {
+            return false;
+         }
+      }
+      else if ( Accept(p, '=') )
+      {
+         if ( TokenIs(&name, "LIN_speed") )
+         {
+            double kbps;
+            if ( !ExpectValueWithUnit(p, &kbps) ) return false;
+            if ( (kbps <= 0.0) || (kbps > (double)UINT32_MAX / BITS_PER_KBIT) )
+            {
+               return Fail(p, LDFValueOutOfRange);
+            }
+            p->db->baud_rate = (uint32_t)( (kbps * BITS_PER_KBIT) + 0.5 );
+         }
+         else if ( TokenIs(&name, "LIN_protocol_version") && (LDF_TOKEN_STRING == p->tok.type) )
+         {
+            p->db->protocol_version = Intern(p, &p->tok);
+            NextToken(p);
+         }
+         if ( !SkipStatement(p) )
+         {
+            return false;
+         }
+      }
+      else if ( !Expect(p, ';') )
+      {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+/**
+ * @brief Nodes { Master: name, time_base ms, jitter ms [, ...]; Slaves: name {, name}; }
+ */
+static bool ParseNodes( struct LDF_Parser_S * p )
+{
+   struct LDF_Database_S * db = p->db;
+
+   while ( !Accept(p, '}') )
+   {
+      struct LDF_Token_S kind;
+      if ( !ExpectIdent(p, &kind) || !Expect(p, ':') )
+      {
+         return false;
+      }
+
+      bool is_master = TokenIs(&kind, "Master");
+      if ( !is_master && !TokenIs(&kind, "Slaves") )
+      {
+         if ( !SkipStatement(p) ) return false;
+         continue;
+      }
+
+      do
+      {
+         struct LDF_Token_S name;
+         if ( !ExpectIdent(p, &name) )
+         {
+            return false;
+         }
+         if ( FindNode(db, &name) != LDF_NO_INDEX )
+         {
+            return Fail(p, LDFDuplicateDefinition);
+         }
+
+         struct LDF_Node_S * nodes = GrowIfFull(db->nodes, db->num_nodes, &p->nodes_cap, sizeof(*db->nodes));
+         if ( NULL == nodes )
+         {
+            return Fail(p, OutOfMemory);
+         }
+         db->nodes = nodes;
+
+         struct LDF_Node_S * node = &db->nodes[db->num_nodes++];
+         memset(node, 0, sizeof(*node));
+         node->name = Intern(p, &name);
+         node->is_master = is_master;
+
+         if ( is_master )
+         {
+            if ( !Expect(p, ',') || !ExpectValueWithUnit(p, &node->time_base_ms) ||
+                 !Expect(p, ',') || !ExpectValueWithUnit(p, &node->jitter_ms) )
+            {
+               return false;
+            }
+            // LIN 2.2 adds bit length and tolerance, which we have no use for
+            break;
+         }
+      } while ( Accept(p, ',') );
+
+      if ( !SkipStatement(p) )
+      {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+/**
+ * @brief Signals { name: size, init_value, publisher {, subscriber}; }
+ *
+ * init_value is either a number or a {byte, byte, ...} array. Diagnostic
+ * signals leave out the publisher and subscribers.
+ */
+static bool ParseSignals( struct LDF_Parser_S * p )
+{
+   struct LDF_Database_S * db = p->db;
+
+   while ( !Accept(p, '}') )
+   {
+      struct LDF_Token_S name;
+      uint64_t size_bits;
+      uint64_t init_value = 0;
+
+      if ( !ExpectIdent(p, &name) || !Expect(p, ':') ||
+           !ExpectInteger(p, LDF_MAX_SIGNAL_BITS, &size_bits) || !Expect(p, ',') )
+      {
+         return false;
+      }
+      if ( 0 == size_bits )
+      {
+         return Fail(p, LDFValueOutOfRange);
+      }
+
+      if ( Accept(p, '{') )
+      {
+         unsigned int byte_idx = 0;
+         do
+         {
+            uint64_t byte;
+            if ( !ExpectInteger(p, UINT8_MAX, &byte) )
+            {
+               return false;
+            }
+            if ( byte_idx < LDF_MAX_FRAME_LEN )
+            {
+               init_value |= byte << (8u * byte_idx);
+            }
+            byte_idx++;
+         } while ( Accept(p, ',') );
+         if ( !Expect(p, '}') )
+         {
+            return false;
+         }
+      }
+      else if ( !ExpectInteger(p, UINT64_MAX, &init_value) )
+      {
+         return false;
+      }
+
+      uint16_t publisher_idx = LDF_NO_INDEX;
+      if ( Accept(p, ',') )
+      {
+         struct LDF_Token_S publisher;
+         if ( !ExpectIdent(p, &publisher) )
+         {
+            return false;
+         }
+         publisher_idx = FindNode(db, &publisher);
+         if ( LDF_NO_INDEX == publisher_idx )
+         {
+            return Fail(p, LDFUndefinedReference);
+         }
+      }
+
+      if ( FindSignal(p, &name) != LDF_NO_INDEX )
+      {
+         return Fail(p, LDFDuplicateDefinition);
+      }
+      if ( db->num_signals >= LDF_NO_INDEX )
+      {
+         return Fail(p, LDFValueOutOfRange);
+      }
+
+      struct LDF_Signal_S * signals = GrowIfFull(db->signals, db->num_signals, &p->signals_cap, sizeof(*db->signals));
+      if ( NULL == signals )
+      {
+         return Fail(p, OutOfMemory);
+      }
+      db->signals = signals;
+
+      struct LDF_Signal_S * signal = &db->signals[db->num_signals];
+      signal->name = Intern(p, &name);
+      signal->size_bits = (uint8_t)size_bits;
+      signal->init_value = init_value;
+      signal->publisher = publisher_idx;
+      signal->encoding = LDF_NO_INDEX;
+
+      if ( !AddSignalToHash(p, (uint16_t)db->num_signals) )
+      {
+         return false;
+      }
+      db->num_signals++;
+
+      // Subscribers aren't kept
+      if ( !SkipStatement(p) )
+      {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+/**
+ * @brief Frames { name: id, publisher, length { signal, offset; ... } }
+ *        Diagnostic_frames { name: id { signal, offset; ... } }
+ *
+ * Diagnostic frames have no publisher or length; they are always 8 bytes.
+ * A regular frame without a length gets the LIN 1.3 default for its ID.
+ */
+static bool ParseFrames( struct LDF_Parser_S * p, bool is_diagnostic )
+{
+   struct LDF_Database_S * db = p->db;
+
+   while ( !Accept(p, '}') )
+   {
+      struct LDF_Token_S name;
+      uint64_t id;
+
+      if ( !ExpectIdent(p, &name) || !Expect(p, ':') || !ExpectInteger(p, MAX_ID_ALLOWED, &id) )
+      {
+         return false;
+      }
+      if ( (FindFrame(db, &name) != LDF_NO_INDEX) || (db->frame_by_id[id] != LDF_NO_INDEX) )
+      {
+         return Fail(p, LDFDuplicateDefinition);
+      }
+
+      uint16_t publisher_idx = LDF_NO_INDEX;
+      uint64_t length = ( is_diagnostic || (id >= 0x30u) ) ? 8u : ( (id >= 0x20u) ? 4u : 2u );
+
+      if ( Accept(p, ',') )
+      {
+         struct LDF_Token_S publisher;
+         if ( !ExpectIdent(p, &publisher) )
+         {
+            return false;
+         }
+         publisher_idx = FindNode(db, &publisher);
+         if ( LDF_NO_INDEX == publisher_idx )
+         {
+            return Fail(p, LDFUndefinedReference);
+         }
+         if ( Accept(p, ',') && !ExpectInteger(p, LDF_MAX_FRAME_LEN, &length) )
+         {
+            return false;
+         }
+      }
+      if ( 0 == length )
+      {
+         return Fail(p, LDFValueOutOfRange);
+      }
+      if ( !Expect(p, '{') )
+      {
+         return false;
+      }
+
+      struct LDF_Frame_S * frames = GrowIfFull(db->frames, db->num_frames, &p->frames_cap, sizeof(*db->frames));
+      if ( NULL == frames )
+      {
+         return Fail(p, OutOfMemory);
+      }
+      db->frames = frames;
+
+      struct LDF_Frame_S * frame = &db->frames[db->num_frames];
+      frame->name = Intern(p, &name);
+      frame->id = (uint8_t)id;
+      frame->pid = ComputePID( (uint8_t)id );
+      frame->length = (uint8_t)length;
+      frame->publisher = publisher_idx;
+      frame->is_diagnostic = is_diagnostic;
+      frame->first_signal = (uint32_t)db->num_frame_signals;
+      frame->num_signals = 0;
+
+      if ( !ParseFrameSignals(p, frame) )
+      {
+         return false;
+      }
+
+      db->frame_by_id[id] = (uint16_t)db->num_frames;
+      db->num_frames++;
+   }
+
+   return true;
+}
+
+static bool ParseFrameSignals( struct LDF_Parser_S * p, struct LDF_Frame_S * frame )
+{
+   struct LDF_Database_S * db = p->db;
+
+   while ( !Accept(p, '}') )
+   {
+      struct LDF_Token_S name;
+      uint64_t bit_offset;
+
+      if ( !ExpectIdent(p, &name) || !Expect(p, ',') ||
+           !ExpectInteger(p, (LDF_MAX_FRAME_LEN * 8u) - 1u, &bit_offset) || !Expect(p, ';') )
+      {
+         return false;
+      }
+
+      uint16_t signal_idx = FindSignal(p, &name);
+      if ( LDF_NO_INDEX == signal_idx )
+      {
+         return Fail(p, LDFUndefinedReference);
+      }
+      if ( (bit_offset + db->signals[signal_idx].size_bits) > ((uint64_t)frame->length * 8u) )
+      {
+         return Fail(p, LDFValueOutOfRange);
+      }
+      for ( uint32_t i = frame->first_signal; i < db->num_frame_signals; i++ )
+      {
+         if ( db->frame_signals[i].signal == signal_idx )
+         {
+            return Fail(p, LDFDuplicateDefinition);
+         }
+      }
+
+      struct LDF_FrameSignal_S * frame_signals =
+         GrowIfFull(db->frame_signals, db->num_frame_signals, &p->frame_signals_cap, sizeof(*db->frame_signals));
+      if ( NULL == frame_signals )
+      {
+         return Fail(p, OutOfMemory);
+      }
+      db->frame_signals = frame_signals;
+
+      db->frame_signals[db->num_frame_signals].signal = signal_idx;
+      db->frame_signals[db->num_frame_signals].bit_offset = (uint8_t)bit_offset;
+      db->num_frame_signals++;
+      frame->num_signals++;
+   }
+
+   return true;
+}
+
+/**
+ * @brief Schedule_tables { name { entry delay N ms; ... } }
+ *
+ * An entry is a frame name, or a command such as AssignNAD { ... }. Commands
+ * go out in the MasterReq frame, so that's the frame they are recorded
+ * against. Anything else (sporadic/event-triggered frames) is kept with
+ * LDF_NO_INDEX so the timing is still there.
+ */
+static bool ParseScheduleTables( struct LDF_Parser_S * p )
+{
+   struct LDF_Database_S * db = p->db;
+
+   while ( !Accept(p, '}') )
+   {
+      struct LDF_Token_S name;
+      if ( !ExpectIdent(p, &name) || !Expect(p, '{') )
+      {
+         return false;
+      }
+
+      struct LDF_ScheduleTable_S * tables =
+         GrowIfFull(db->schedule_tables, db->num_schedule_tables, &p->schedule_tables_cap, sizeof(*db->schedule_tables));
+      if ( NULL == tables )
+      {
+         return Fail(p, OutOfMemory);
+      }
+      db->schedule_tables = tables;
+
+      struct LDF_ScheduleTable_S * table = &db->schedule_tables[db->num_schedule_tables++];
+      table->name = Intern(p, &name);
+      table->first_entry = (uint32_t)db->num_schedule_entries;
+      table->num_entries = 0;
+
+      while ( !Accept(p, '}') )
+      {
+         struct LDF_Token_S entry_name;
+         struct LDF_Token_S delay_kw;
+         double delay_ms;
+
+         if ( !ExpectIdent(p, &entry_name) )
+         {
+            return false;
+         }
+
+         uint16_t frame_idx = FindFrame(db, &entry_name);
+         if ( Accept(p, '{') )
+         {
+            if ( !SkipBlockBody(p) ) return false;
+            if ( LDF_NO_INDEX == frame_idx )
+            {
+               frame_idx = db->frame_by_id[MASTER_REQ_FRAME_ID];
+            }
+         }
+
+         if ( !ExpectIdent(p, &delay_kw) || !TokenIs(&delay_kw, "delay") )
+         {
+            return Fail(p, LDFSyntaxError);
+         }
+         if ( !ExpectValueWithUnit(p, &delay_ms) || !Expect(p, ';') )
+         {
+            return false;
+         }
+
+         struct LDF_ScheduleEntry_S * entries =
+            GrowIfFull(db->schedule_entries, db->num_schedule_entries, &p->schedule_entries_cap, sizeof(*db->schedule_entries));
+         if ( NULL == entries )
+         {
+            return Fail(p, OutOfMemory);
+         }
+         db->schedule_entries = entries;
+
+         db->schedule_entries[db->num_schedule_entries].frame = frame_idx;
+         db->schedule_entries[db->num_schedule_entries].delay_ms = delay_ms;
+         db->num_schedule_entries++;
+         table->num_entries++;
+      }
+   }
+
+   return true;
+}
+
+/**
+ * @brief Signal_encoding_types { name { value; ... } }
+ *
+ * The values are logical_value, physical_value, bcd_value, or ascii_value
+ * entries. Only the first physical_value range is kept, since that's what
+ * gives a raw signal value its scaling.
+ */
+static bool ParseEncodingTypes( struct LDF_Parser_S * p )
+{
+   struct LDF_Database_S * db = p->db;
+
+   while ( !Accept(p, '}') )
+   {
+      struct LDF_Token_S name;
+      if ( !ExpectIdent(p, &name) || !Expect(p, '{') )
+      {
+         return false;
+      }
+      if ( FindEncoding(db, &name) != LDF_NO_INDEX )
+      {
+         return Fail(p, LDFDuplicateDefinition);
+      }
+      if ( db->num_encodings >= LDF_NO_INDEX )
+      {
+         return Fail(p, LDFValueOutOfRange);
+      }
+
+      struct LDF_Encoding_S * encodings =
+         GrowIfFull(db->encodings, db->num_encodings, &p->encodings_cap, sizeof(*db->encodings));
+      if ( NULL == encodings )
+      {
+         return Fail(p, OutOfMemory);
+      }
+      db->encodings = encodings;
+
+      struct LDF_Encoding_S * encoding = &db->encodings[db->num_encodings++];
+      memset(encoding, 0, sizeof(*encoding));
+      encoding->name = Intern(p, &name);
+      encoding->scale = 1.0;
+      encoding->offset = 0.0;
+
+      while ( !Accept(p, '}') )
+      {
+         if ( !ParseEncodingValue(p, encoding) )
+         {
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
+
+/**
+ * @brief physical_value, min, max, scale, offset [, "unit"];
+ *        Any other kind of value is skipped.
+ */
+static bool ParseEncodingValue( struct LDF_Parser_S * p, struct LDF_Encoding_S * encoding )
+{
+   struct LDF_Token_S kind;
+   if ( !ExpectIdent(p, &kind) )
+   {
+      return false;
+   }
+   if ( !TokenIs(&kind, "physical_value") || encoding->has_physical )
+   {
+      return SkipStatement(p);
+   }
+
+   uint64_t min;
+   uint64_t max;
+   double scale;
+   double offset;
+   if ( !Expect(p, ',') || !ExpectInteger(p, UINT64_MAX, &min) ||
+        !Expect(p, ',') || !ExpectInteger(p, UINT64_MAX, &max) ||
+        !Expect(p, ',') || !ExpectValueWithUnit(p, &scale) ||
+        !Expect(p, ',') || !ExpectValueWithUnit(p, &offset) )
+   {
+      return false;
+   }
+   if ( min > max )
+   {
+      return Fail(p, LDFValueOutOfRange);
+   }
+
+   encoding->scale = scale;
+   encoding->offset = offset;
+   encoding->has_physical = true;
+   if ( Accept(p, ',') && (LDF_TOKEN_STRING == p->tok.type) )
+   {
+      encoding->unit = Intern(p, &p->tok);
+      NextToken(p);
+   }
+
+   return SkipStatement(p);
+}
+
+/**
+ * @brief Signal_representation { encoding: signal {, signal}; }
+ */
+static bool ParseSignalRepresentation( struct LDF_Parser_S * p )
+{
+   struct LDF_Database_S * db = p->db;
+
+   while ( !Accept(p, '}') )
+   {
+      struct LDF_Token_S name;
+      if ( !ExpectIdent(p, &name) || !Expect(p, ':') )
+      {
+         return false;
+      }
+
+      uint16_t encoding_idx = FindEncoding(db, &name);
+      if ( LDF_NO_INDEX == encoding_idx )
+      {
+         return Fail(p, LDFUndefinedReference);
+      }
+
+      do
+      {
+         struct LDF_Token_S signal_name;
+         if ( !ExpectIdent(p, &signal_name) )
+         {
+            return false;
+         }
+         uint16_t signal_idx = FindSignal(p, &signal_name);
+         if ( LDF_NO_INDEX == signal_idx )
+         {
+            return Fail(p, LDFUndefinedReference);
+         }
+         db->signals[signal_idx].encoding = encoding_idx;
+      } while ( Accept(p, ',') );
+
+      if ( !Expect(p, ';') )
+      {
+         return false;
+      }
+   }
+
+   return true;
+}
@@ -0,0 +1,157 @@
+/*!
+ * @file    lin_ldf.h
+ * @brief   LIN Description File (LDF) parser and in-memory frame database.
+ *
+ * Parses the parts of an LDF that matter for ID/PID work and the decode stage
+ * (nodes, signals, frames, diagnostic frames, schedule tables, and signal
+ * encodings) into a compact database. Frames are indexed by their 6-bit ID,
+ * so looking up a frame from a received ID is a single array access, and
+ * every frame carries its PID precomputed via ComputePID().
+ *
+ * Blocks the parser doesn't model (node attributes, sporadic and
+ * event-triggered frames, ...) are skipped over.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_LDF_H
+#define LIN_LDF_H
+
+/* File Inclusions */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "lin_pid.h"
+
+/* Public Macro Definitions */
+#define LDF_NO_INDEX          UINT16_MAX  // Unresolved node/frame reference
+#define LDF_MAX_FRAME_LEN     8u          // Bytes
+#define LDF_MAX_SIGNAL_BITS   64u
+
+/* Public Datatypes */
+
+struct LDF_Node_S
+{
+   const char * name;
+   bool is_master;
+   double time_base_ms;    // Master only
+   double jitter_ms;       // Master only
+};
+
+struct LDF_Encoding_S
+{
+   const char * name;
+   const char * unit;      // NULL if there's no physical range, or it has no unit
+   double scale;           // physical = (raw * scale) + offset
+   double offset;
+   bool has_physical;      // Only the first physical_value range is kept
+};
+
+struct LDF_Signal_S
+{
+   const char * name;
+   uint64_t init_value;    // Byte-array initializers are packed little-endian
+   uint16_t publisher;     // Index into nodes, or LDF_NO_INDEX
+   uint16_t encoding;      // Index into encodings, or LDF_NO_INDEX
+   uint8_t size_bits;
+};
+
+struct LDF_FrameSignal_S
+{
+   uint16_t signal;        // Index into signals
+   uint8_t bit_offset;
+};
+
+struct LDF_Frame_S
+{
+   const char * name;
+   uint32_t first_signal;  // Index into frame_signals
+   uint16_t num_signals;
+   uint16_t publisher;     // Index into nodes, or LDF_NO_INDEX
+   uint8_t id;
+   uint8_t pid;
+   uint8_t length;         // Bytes
+   bool is_diagnostic;
+};
+
+struct LDF_ScheduleEntry_S
+{
+   uint16_t frame;         // Index into frames. Commands map to MasterReq.
+   double delay_ms;
+};
+
+struct LDF_ScheduleTable_S
+{
+   const char * name;
+   uint32_t first_entry;   // Index into schedule_entries
+   uint16_t num_entries;
+};
+
+struct LDF_Database_S
+{
+   char * strings;         // Arena holding every name. Pointers into it stay valid.
+   size_t strings_len;
+
+   struct LDF_Node_S * nodes;
+   size_t num_nodes;
+   struct LDF_Signal_S * signals;
+   size_t num_signals;
+   struct LDF_Frame_S * frames;
+   size_t num_frames;
+   struct LDF_FrameSignal_S * frame_signals;
+   size_t num_frame_signals;
+   struct LDF_ScheduleTable_S * schedule_tables;
+   size_t num_schedule_tables;
+   struct LDF_ScheduleEntry_S * schedule_entries;
+   size_t num_schedule_entries;
+   struct LDF_Encoding_S * encodings;
+   size_t num_encodings;
+
+   uint16_t frame_by_id[MAX_ID_ALLOWED + 1]; // LDF_NO_INDEX if no frame uses the ID
+
+   const char * protocol_version;
+   uint32_t baud_rate;     // From LIN_speed, in bit/s. 0 if absent.
+
+   size_t error_line;      // Set to the offending line when parsing fails
+};
+
+/* Public API */
+
+/**
+ * @brief Parse an LDF held in memory into db.
+ *
+ * db is zeroed first. On failure, whatever was allocated is freed again and
+ * db->error_line points at the offending line.
+ *
+ * @param[in] text LDF contents. Need not be null-terminated.
+ * @param[in] len Length of text in bytes.
+ * @param[out] db Database to fill in. Release with LDF_Free().
+ * @return GoodResult, or the LDF exception describing what went wrong.
+ */
+enum LIN_PID_Result_E LDF_Parse( const char * text, size_t len, struct LDF_Database_S * db );
+
+/**
+ * @brief Read the LDF at path and parse it into db. See LDF_Parse().
+ */
+enum LIN_PID_Result_E LDF_Load( const char * path, struct LDF_Database_S * db );
+
+/**
+ * @brief Release everything LDF_Parse()/LDF_Load() allocated and zero db.
+ */
+void LDF_Free( struct LDF_Database_S * db );
+
+/**
+ * @brief Look up a frame by its ID.
+ * @return The frame, or NULL if the ID is out of range or unused.
+ */
+const struct LDF_Frame_S * LDF_FrameByID( const struct LDF_Database_S * db, uint8_t id );
+
+/**
+ * @brief Look up a frame by name.
+ * @return The frame, or NULL if no frame has that name.
+ */
+const struct LDF_Frame_S * LDF_FrameByName( const struct LDF_Database_S * db, const char * name );
+
+#endif // LIN_LDF_H
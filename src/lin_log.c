@@ -0,0 +1,1172 @@
+/*!
+ * @file    lin_log.c
+ * @brief   Chunked, multi-threaded validation of text LIN bus logs.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/select.h>
+#include <sys/stat.h>
+#endif
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
+
+#include "lin_pid.h"
+#include "lin_char.h"
+#include "lin_log.h"
+
+/* Local Macro Definitions */
+#define MAX_LOG_THREADS          256u
+#define MIN_PIECE_LEN            (64u * 1024u)  // Smaller pieces aren't worth a thread
+#define MAX_ID_TOKEN_LEN         15u
+#define MAX_FRACTION_DIGITS      9u
+#define FIRST_CLASSIC_ONLY_ID    0x3Cu          // Diagnostic frames always use the classic checksum
+#define INITIAL_ARRAY_CAP        16u
+#define INITIAL_PARTIAL_CAP      256u
+
+/* Datatypes */
+
+struct Cursor_S
+{
+   const char * pos;
+   const char * end;
+};
+
+struct PieceFrame_S
+{
+   struct LOG_Frame_S frame;
+   enum LOG_Anomaly_E kind;
+};
+
+struct Piece_S
+{
+   const char * start;
+   const char * end;
+   enum LOG_Format_E format;
+   enum LOG_Checksum_E checksum;
+   struct LOG_Summary_S summary;
+   struct LOG_Anomaly_S * anomalies;    // Line numbers relative to the start of the piece
+   size_t num_anomalies;
+   size_t anomalies_cap;
+   bool keep_frames;                    // Only when someone wants on_frame calls
+   struct PieceFrame_S * frames;
+   size_t num_frames;
+   size_t frames_cap;
+   bool out_of_memory;
+};
+
+/* Local Data */
+
+#ifndef _WIN32
+static volatile sig_atomic_t FollowStop = 0;   // Set by SIGINT/SIGTERM while LOG_Follow() runs
+#endif
+
+/* Private Function Prototypes */
+static void ProcessPiece( struct Piece_S * piece );
+static void CountFrame( struct LOG_Summary_S * summary, const struct LOG_Frame_S * frame, enum LOG_Anomaly_E kind );
+static bool IsCompleteFrame( enum LOG_Anomaly_E kind );
+static void TailLines( struct LOG_Tail_S * tail, const char * start, const char * end );
+static bool HoldPartial( struct LOG_Tail_S * tail, const char * data, size_t len );
+static void MergePiece( struct LOG_Summary_S * summary,
+                        struct Piece_S * piece,
+                        uint64_t first_line,
+                        const struct LOG_Options_S * options );
+static void RunPieces( struct Piece_S * pieces, unsigned int num_pieces );
+static bool GrowArray( void ** array, size_t * cap, size_t elem_size );
+static bool ParseCSVLine( struct Cursor_S * cur, struct LOG_Frame_S * frame, struct LOG_Anomaly_S * anomaly );
+static bool ParseASCLine( struct Cursor_S * cur, struct LOG_Frame_S * frame, struct LOG_Anomaly_S * anomaly );
+static void ValidateFrame( const struct LOG_Frame_S * frame,
+                           enum LOG_Checksum_E checksum,
+                           struct LOG_Anomaly_S * anomaly );
+static bool ParseIDToken( const char * start, const char * end, bool ishex, struct LOG_Frame_S * frame, struct LOG_Anomaly_S * anomaly );
+static bool ParseHexByte( const char * start, const char * end, uint8_t * byte );
+static bool ParseDecByte( const char * start, const char * end, uint8_t * byte );
+static void NextWord( struct Cursor_S * cur, const char ** start, const char ** end );
+static void NextField( struct Cursor_S * cur, const char ** start, const char ** end );
+static bool TokenIs( const char * start, const char * end, const char * word );
+static void SkipBlanks( struct Cursor_S * cur );
+static int HexDigitValue( char ch );
+static unsigned int NumOfThreads( unsigned int requested );
+#ifndef _WIN32
+static void WaitForAppend( int watch_fd, const sigset_t * wait_mask );
+static void StopFollowing( int sig );
+static void * PieceThread( void * arg );
+#endif
+
+/* Public Function Implementations */
+
+enum LOG_Format_E LOG_FormatFromPath( const char * path )
+{
+   assert( path != NULL );
+
+   const char * dot = strrchr(path, '.');
+   if ( (dot != NULL) &&
+        ((dot[1] | 0x20) == 'a') && ((dot[2] | 0x20) == 's') && ((dot[3] | 0x20) == 'c') &&
+        ('\0' == dot[4]) )
+   {
+      return LOG_FORMAT_ASC;
+   }
+   return LOG_FORMAT_CSV;
+}
+
+uint8_t LOG_Checksum( uint8_t pid, const uint8_t * data, uint8_t length, bool enhanced )
+{
+   assert( (data != NULL) || (0 == length) );
+
+   // Sum with carry: every carry out of bit 7 is added back in
+   unsigned int sum = enhanced ? pid : 0u;
+   for ( uint8_t i = 0; i < length; i++ )
+   {
+      sum += data[i];
+      if ( sum > UINT8_MAX )
+      {
+         sum -= UINT8_MAX;
+      }
+   }
+   return (uint8_t)~sum;
+}
+
+bool LOG_ProcessLine( const char * line,
+                      size_t len,
+                      enum LOG_Format_E format,
+                      enum LOG_Checksum_E checksum,
+                      struct LOG_Frame_S * frame,
+                      struct LOG_Anomaly_S * anomaly )
+{
+   assert( (line != NULL) && (frame != NULL) && (anomaly != NULL) );
+
+   struct Cursor_S cur = { line, line + len };
+   memset( frame, 0, sizeof(*frame) );
+   memset( anomaly, 0, sizeof(*anomaly) );
+
+   SkipBlanks(&cur);
+   // Blank lines, comments, headers, and anything else that doesn't start with a timestamp
+   if ( (cur.pos == cur.end) || !CHAR_IS(*cur.pos, CHAR_DEC_DIGIT) )
+   {
+      return false;
+   }
+
+   bool is_frame = ( LOG_FORMAT_ASC == format ) ? ParseASCLine(&cur, frame, anomaly)
+                                                : ParseCSVLine(&cur, frame, anomaly);
+   if ( is_frame && (LOG_ANOMALY_NONE == anomaly->kind) )
+   {
+      ValidateFrame(frame, checksum, anomaly);
+   }
+   if ( anomaly->kind != LOG_ANOMALY_NONE )
+   {
+      anomaly->frame = *frame;
+   }
+   return is_frame;
+}
+
+enum LIN_PID_Result_E LOG_ProcessStream( FILE * fp,
+                                         const struct LOG_Options_S * options,
+                                         struct LOG_Summary_S * summary )
+{
+   assert( (fp != NULL) && (options != NULL) && (summary != NULL) );
+
+   memset( summary, 0, sizeof(*summary) );
+
+   size_t chunk_len = ( options->chunk_len > 0 ) ? options->chunk_len : LOG_DEFAULT_CHUNK_LEN;
+   unsigned int num_threads = NumOfThreads(options->num_threads);
+
+   size_t cap = chunk_len;
+   char * buf = malloc(cap);
+   struct Piece_S * pieces = calloc( num_threads, sizeof(*pieces) );
+   if ( (NULL == buf) || (NULL == pieces) )
+   {
+      free(buf);
+      free(pieces);
+      return OutOfMemory;
+   }
+
+   enum LIN_PID_Result_E result = GoodResult;
+   size_t have = 0;
+   bool eof = false;
+   while ( (GoodResult == result) && !eof )
+   {
+      have += fread( buf + have, 1, cap - have, fp );
+      if ( have < cap )
+      {
+         if ( ferror(fp) )
+         {
+            result = LogFileUnreadable;
+            break;
+         }
+         eof = true;
+      }
+
+      // Only whole lines are processed; the partial last one carries over to
+      // the next chunk. At the end of the file it's processed as is.
+      size_t usable = have;
+      if ( !eof )
+      {
+         while ( (usable > 0) && (buf[usable - 1] != '\n') )
+         {
+            usable--;
+         }
+         if ( 0 == usable )
+         {
+            // One line longer than the whole buffer
+            char * bigger = ( cap <= (SIZE_MAX / 2u) ) ? realloc(buf, cap * 2u) : NULL;
+            if ( NULL == bigger )
+            {
+               result = OutOfMemory;
+               break;
+            }
+            buf = bigger;
+            cap *= 2u;
+            continue;
+         }
+      }
+
+      // Split at line boundaries, one piece per thread
+      unsigned int num_pieces = num_threads;
+      if ( (usable / MIN_PIECE_LEN) < num_pieces )
+      {
+         num_pieces = ( usable >= MIN_PIECE_LEN ) ? (unsigned int)(usable / MIN_PIECE_LEN) : 1u;
+      }
+      const char * piece_start = buf;
+      const char * chunk_end = buf + usable;
+      for ( unsigned int p = 0; p < num_pieces; p++ )
+      {
+         const char * piece_end = chunk_end;
+         if ( p < (num_pieces - 1u) )
+         {
+            piece_end = buf + ((usable / num_pieces) * (p + 1u));
+            if ( piece_end < piece_start )
+            {
+               piece_end = piece_start;
+            }
+            const char * newline = memchr( piece_end, '\n', (size_t)(chunk_end - piece_end) );
+            piece_end = ( newline != NULL ) ? (newline + 1) : chunk_end;
+         }
+
+         struct Piece_S * piece = &pieces[p];
+         piece->start = piece_start;
+         piece->end = piece_end;
+         piece->format = options->format;
+         piece->checksum = options->checksum;
+         piece->num_anomalies = 0;
+         piece->keep_frames = ( options->on_frame != NULL );
+         piece->num_frames = 0;
+         piece->out_of_memory = false;
+         piece_start = piece_end;
+      }
+
+      RunPieces(pieces, num_pieces);
+
+      // Merge in file order so anomalies and frames come out in the order they were logged
+      for ( unsigned int p = 0; p < num_pieces; p++ )
+      {
+         if ( pieces[p].out_of_memory )
+         {
+            result = OutOfMemory;
+         }
+         MergePiece(summary, &pieces[p], summary->lines, options);
+      }
+
+      memmove( buf, buf + usable, have - usable );
+      have -= usable;
+   }
+
+   for ( unsigned int p = 0; p < num_threads; p++ )
+   {
+      free(pieces[p].anomalies);
+      free(pieces[p].frames);
+   }
+   free(pieces);
+   free(buf);
+
+   return result;
+}
+
+void LOG_TailInit( struct LOG_Tail_S * tail, const struct LOG_Options_S * options )
+{
+   assert( (tail != NULL) && (options != NULL) );
+
+   memset( tail, 0, sizeof(*tail) );
+   tail->options = *options;
+}
+
+enum LIN_PID_Result_E LOG_TailFeed( struct LOG_Tail_S * tail, const char * data, size_t len )
+{
+   assert( (tail != NULL) && ((data != NULL) || (0 == len)) );
+
+   const char * end = data + len;
+
+   // Finish the line held over from last time before anything else
+   if ( tail->partial_len > 0 )
+   {
+      const char * newline = memchr( data, '\n', len );
+      size_t take = ( newline != NULL ) ? (size_t)(newline + 1 - data) : len;
+      if ( !HoldPartial(tail, data, take) )
+      {
+         return OutOfMemory;
+      }
+      data += take;
+      if ( NULL == newline )
+      {
+         return GoodResult;
+      }
+      TailLines(tail, tail->partial, tail->partial + tail->partial_len);
+      tail->partial_len = 0;
+   }
+
+   // Whole lines straight from data; the rest waits for its newline
+   const char * lines_end = end;
+   while ( (lines_end > data) && (lines_end[-1] != '\n') )
+   {
+      lines_end--;
+   }
+   TailLines(tail, data, lines_end);
+   return HoldPartial(tail, lines_end, (size_t)(end - lines_end)) ? GoodResult : OutOfMemory;
+}
+
+void LOG_TailFlush( struct LOG_Tail_S * tail )
+{
+   assert( tail != NULL );
+
+   if ( tail->partial_len > 0 )
+   {
+      TailLines(tail, tail->partial, tail->partial + tail->partial_len);
+      tail->partial_len = 0;
+   }
+}
+
+void LOG_TailFree( struct LOG_Tail_S * tail )
+{
+   assert( tail != NULL );
+
+   free(tail->partial);
+   tail->partial = NULL;
+   tail->partial_len = 0;
+   tail->partial_cap = 0;
+}
+
+enum LIN_PID_Result_E LOG_Follow( const char * path,
+                                  const struct LOG_Options_S * options,
+                                  struct LOG_Summary_S * summary )
+{
+   assert( (path != NULL) && (options != NULL) && (summary != NULL) );
+
+   memset( summary, 0, sizeof(*summary) );
+
+#ifdef _WIN32
+   (void)path;
+   (void)options;
+   return FollowUnsupported;
+#else
+   int fd = open(path, O_RDONLY);
+   if ( fd < 0 )
+   {
+      return LogFileUnreadable;
+   }
+
+   // Too big for the stack with its summary
+   char * buf = malloc(LOG_FOLLOW_READ_LEN);
+   struct LOG_Tail_S * tail = malloc( sizeof(*tail) );
+   if ( (NULL == buf) || (NULL == tail) )
+   {
+      free(buf);
+      free(tail);
+      (void)close(fd);
+      return OutOfMemory;
+   }
+   LOG_TailInit(tail, options);
+
+   // SIGINT and SIGTERM stay blocked except while waiting, so a stop that
+   // comes in mid-read is picked up by the next wait rather than lost.
+   sigset_t stop_set;
+   sigset_t saved_mask;
+   sigset_t wait_mask;
+   (void)sigemptyset(&stop_set);
+   (void)sigaddset(&stop_set, SIGINT);
+   (void)sigaddset(&stop_set, SIGTERM);
+   (void)sigprocmask(SIG_BLOCK, &stop_set, &saved_mask);
+   wait_mask = saved_mask;
+   (void)sigdelset(&wait_mask, SIGINT);
+   (void)sigdelset(&wait_mask, SIGTERM);
+
+   struct sigaction action;
+   struct sigaction saved_int;
+   struct sigaction saved_term;
+   memset( &action, 0, sizeof(action) );
+   action.sa_handler = StopFollowing;   // No SA_RESTART: the wait has to return
+   (void)sigemptyset(&action.sa_mask);
+   (void)sigaction(SIGINT, &action, &saved_int);
+   (void)sigaction(SIGTERM, &action, &saved_term);
+   FollowStop = 0;
+
+   int watch_fd = -1;
+#ifdef __linux__
+   watch_fd = inotify_init1(IN_CLOEXEC);
+   if ( (watch_fd >= 0) &&
+        (inotify_add_watch(watch_fd, path, IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_DELETE_SELF) < 0) )
+   {
+      (void)close(watch_fd);
+      watch_fd = -1;   // Poll instead
+   }
+#endif
+
+   enum LIN_PID_Result_E result = GoodResult;
+   off_t offset = 0;
+   while ( (GoodResult == result) && !FollowStop )
+   {
+      ssize_t n = 0;
+      while ( (GoodResult == result) && ((n = read(fd, buf, LOG_FOLLOW_READ_LEN)) > 0) )
+      {
+         result = LOG_TailFeed(tail, buf, (size_t)n);
+         offset += n;
+      }
+      if ( (n < 0) && (errno != EINTR) && (GoodResult == result) )
+      {
+         result = LogFileUnreadable;
+      }
+
+      struct stat st;
+      if ( (GoodResult == result) && (fstat(fd, &st) != 0) )
+      {
+         result = LogFileUnreadable;
+      }
+      if ( (result != GoodResult) || (0 == st.st_nlink) )
+      {
+         break;   // Deleted: everything it ever held has been read
+      }
+      if ( st.st_size < offset )
+      {
+         // Truncated, e.g. the logger started over. The held line was from
+         // before, so it goes.
+         tail->partial_len = 0;
+         offset = lseek(fd, 0, SEEK_SET);
+         continue;
+      }
+
+      WaitForAppend(watch_fd, &wait_mask);
+   }
+
+   if ( watch_fd >= 0 )
+   {
+      (void)close(watch_fd);
+   }
+   (void)sigaction(SIGINT, &saved_int, NULL);
+   (void)sigaction(SIGTERM, &saved_term, NULL);
+   (void)sigprocmask(SIG_SETMASK, &saved_mask, NULL);
+
+   // A line without its newline yet may still be mid-write, so it isn't judged
+   *summary = tail->summary;
+   LOG_TailFree(tail);
+   free(tail);
+   free(buf);
+   (void)close(fd);
+   return result;
+#endif
+}
+
+bool LOG_ParseTimestamp( const char * start, const char * end, double * timestamp )
+{
+   static const double scale[MAX_FRACTION_DIGITS + 1] =
+   {
+      1.0, 1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 1e-8, 1e-9
+   };
+
+   uint64_t whole = 0;
+   const char * p = start;
+   while ( (p < end) && CHAR_IS(*p, CHAR_DEC_DIGIT) )
+   {
+      if ( whole > ((UINT64_MAX - 9u) / 10u) )
+      {
+         return false;
+      }
+      whole = (whole * 10u) + CHAR_DIGIT_VALUE(*p);
+      p++;
+   }
+   if ( p == start )
+   {
+      return false;
+   }
+
+   uint32_t fraction = 0;
+   unsigned int fraction_digits = 0;
+   if ( (p < end) && ('.' == *p) )
+   {
+      p++;
+      while ( (p < end) && CHAR_IS(*p, CHAR_DEC_DIGIT) )
+      {
+         // Past nanoseconds the digits don't change anything a double can tell apart
+         if ( fraction_digits < MAX_FRACTION_DIGITS )
+         {
+            fraction = (fraction * 10u) + CHAR_DIGIT_VALUE(*p);
+            fraction_digits++;
+         }
+         p++;
+      }
+   }
+   if ( p != end )
+   {
+      return false;
+   }
+
+   *timestamp = (double)whole + ((double)fraction * scale[fraction_digits]);
+   return true;
+}
+
+const char * LOG_AnomalyName( enum LOG_Anomaly_E kind )
+{
+   static const char * const names[NUM_OF_LOG_ANOMALIES] =
+   {
+      "none",
+      "syntax error",
+      "bad ID",
+      "length mismatch",
+      "PID mismatch",
+      "checksum mismatch"
+   };
+
+   assert( kind < NUM_OF_LOG_ANOMALIES );
+   return names[kind];
+}
+
+/* Private Function Implementations */
+
+static void ProcessPiece( struct Piece_S * piece )
+{
+   memset( &piece->summary, 0, sizeof(piece->summary) );
+
+   const char * pos = piece->start;
+   while ( pos < piece->end )
+   {
+      const char * newline = memchr( pos, '\n', (size_t)(piece->end - pos) );
+      const char * line_end = ( newline != NULL ) ? newline : piece->end;
+      size_t len = (size_t)(line_end - pos);
+      if ( (len > 0) && ('\r' == pos[len - 1]) )
+      {
+         len--;
+      }
+
+      piece->summary.lines++;
+
+      struct LOG_Frame_S frame;
+      struct LOG_Anomaly_S anomaly;
+      if ( LOG_ProcessLine(pos, len, piece->format, piece->checksum, &frame, &anomaly) )
+      {
+         CountFrame(&piece->summary, &frame, anomaly.kind);
+
+         if ( anomaly.kind != LOG_ANOMALY_NONE )
+         {
+            if ( (piece->num_anomalies == piece->anomalies_cap) &&
+                 !GrowArray((void **)&piece->anomalies, &piece->anomalies_cap, sizeof(*piece->anomalies)) )
+            {
+               piece->out_of_memory = true;
+               return;
+            }
+            anomaly.line = piece->summary.lines;
+            piece->anomalies[piece->num_anomalies++] = anomaly;
+         }
+
+         if ( piece->keep_frames && IsCompleteFrame(anomaly.kind) )
+         {
+            if ( (piece->num_frames == piece->frames_cap) &&
+                 !GrowArray((void **)&piece->frames, &piece->frames_cap, sizeof(*piece->frames)) )
+            {
+               piece->out_of_memory = true;
+               return;
+            }
+            piece->frames[piece->num_frames].frame = frame;
+            piece->frames[piece->num_frames].kind = anomaly.kind;
+            piece->num_frames++;
+         }
+      }
+
+      pos = ( newline != NULL ) ? (newline + 1) : piece->end;
+   }
+}
+
+/**
+ * @brief Fold one frame line into summary's counters.
+ */
+static void CountFrame( struct LOG_Summary_S * summary, const struct LOG_Frame_S * frame, enum LOG_Anomaly_E kind )
+{
+   summary->frames++;
+   summary->anomalies[kind]++;
+
+   if ( (kind != LOG_ANOMALY_SYNTAX) && (kind != LOG_ANOMALY_BAD_ID) )
+   {
+      struct LOG_IDStats_S * stats = &summary->per_id[frame->id];
+      if ( 0 == stats->frames )
+      {
+         stats->first_timestamp = frame->timestamp;
+      }
+      stats->last_timestamp = frame->timestamp;
+      stats->frames++;
+      stats->pid_errors += ( LOG_ANOMALY_PID_MISMATCH == kind ) ? 1u : 0u;
+      stats->checksum_errors += ( LOG_ANOMALY_CHECKSUM == kind ) ? 1u : 0u;
+   }
+}
+
+/**
+ * @brief Complete frames only: the ID and every data byte made it through.
+ */
+static bool IsCompleteFrame( enum LOG_Anomaly_E kind )
+{
+   return (LOG_ANOMALY_NONE == kind) || (LOG_ANOMALY_PID_MISMATCH == kind) || (LOG_ANOMALY_CHECKSUM == kind);
+}
+
+/**
+ * @brief Validate whole lines in [start, end) and report them right away.
+ */
+static void TailLines( struct LOG_Tail_S * tail, const char * start, const char * end )
+{
+   const struct LOG_Options_S * options = &tail->options;
+   const char * pos = start;
+   while ( pos < end )
+   {
+      const char * newline = memchr( pos, '\n', (size_t)(end - pos) );
+      const char * line_end = ( newline != NULL ) ? newline : end;
+      size_t len = (size_t)(line_end - pos);
+      if ( (len > 0) && ('\r' == pos[len - 1]) )
+      {
+         len--;
+      }
+
+      tail->summary.lines++;
+
+      struct LOG_Frame_S frame;
+      struct LOG_Anomaly_S anomaly;
+      if ( LOG_ProcessLine(pos, len, options->format, options->checksum, &frame, &anomaly) )
+      {
+         CountFrame(&tail->summary, &frame, anomaly.kind);
+         if ( (anomaly.kind != LOG_ANOMALY_NONE) && (options->on_anomaly != NULL) )
+         {
+            anomaly.line = (size_t)tail->summary.lines;
+            options->on_anomaly(&anomaly, options->ctx);
+         }
+         if ( (options->on_frame != NULL) && IsCompleteFrame(anomaly.kind) )
+         {
+            options->on_frame(&frame, anomaly.kind, options->ctx);
+         }
+      }
+
+      pos = ( newline != NULL ) ? (newline + 1) : end;
+   }
+}
+
+/**
+ * @brief Append to the held partial line.
+ */
+static bool HoldPartial( struct LOG_Tail_S * tail, const char * data, size_t len )
+{
+   if ( (tail->partial_cap - tail->partial_len) < len )
+   {
+      size_t new_cap = ( tail->partial_cap > 0 ) ? tail->partial_cap : INITIAL_PARTIAL_CAP;
+      while ( (new_cap - tail->partial_len) < len )
+      {
+         new_cap *= 2u;
+      }
+      char * grown = realloc( tail->partial, new_cap );
+      if ( NULL == grown )
+      {
+         return false;
+      }
+      tail->partial = grown;
+      tail->partial_cap = new_cap;
+   }
+   if ( len > 0 )
+   {
+      memcpy( tail->partial + tail->partial_len, data, len );
+      tail->partial_len += len;
+   }
+   return true;
+}
+
+static void MergePiece( struct LOG_Summary_S * summary,
+                        struct Piece_S * piece,
+                        uint64_t first_line,
+                        const struct LOG_Options_S * options )
+{
+   for ( size_t i = 0; i < piece->num_anomalies; i++ )
+   {
+      struct LOG_Anomaly_S * anomaly = &piece->anomalies[i];
+      anomaly->line += (size_t)first_line;
+      if ( options->on_anomaly != NULL )
+      {
+         options->on_anomaly(anomaly, options->ctx);
+      }
+   }
+   for ( size_t i = 0; (options->on_frame != NULL) && (i < piece->num_frames); i++ )
+   {
+      options->on_frame(&piece->frames[i].frame, piece->frames[i].kind, options->ctx);
+   }
+
+   summary->lines += piece->summary.lines;
+   summary->frames += piece->summary.frames;
+   for ( size_t k = 0; k < NUM_OF_LOG_ANOMALIES; k++ )
+   {
+      summary->anomalies[k] += piece->summary.anomalies[k];
+   }
+   for ( size_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      const struct LOG_IDStats_S * from = &piece->summary.per_id[id];
+      struct LOG_IDStats_S * to = &summary->per_id[id];
+      if ( 0 == from->frames )
+      {
+         continue;
+      }
+      if ( 0 == to->frames )
+      {
+         to->first_timestamp = from->first_timestamp;
+      }
+      to->last_timestamp = from->last_timestamp;
+      to->frames += from->frames;
+      to->pid_errors += from->pid_errors;
+      to->checksum_errors += from->checksum_errors;
+   }
+}
+
+static void RunPieces( struct Piece_S * pieces, unsigned int num_pieces )
+{
+   assert( num_pieces > 0 );
+
+#ifdef _WIN32
+   for ( unsigned int p = 0; p < num_pieces; p++ )
+   {
+      ProcessPiece(&pieces[p]);
+   }
+#else
+   pthread_t threads[MAX_LOG_THREADS];
+   bool started[MAX_LOG_THREADS] = { false };
+
+   // Same arrangement as Sched_Sweep(): piece 0 runs here, and a piece whose
+   // thread couldn't be started runs here afterwards.
+   for ( unsigned int p = 1; p < num_pieces; p++ )
+   {
+      started[p] = ( pthread_create(&threads[p], NULL, PieceThread, &pieces[p]) == 0 );
+   }
+   ProcessPiece(&pieces[0]);
+   for ( unsigned int p = 1; p < num_pieces; p++ )
+   {
+      if ( started[p] )
+      {
+         (void)pthread_join(threads[p], NULL);
+      }
+      else
+      {
+         ProcessPiece(&pieces[p]);
+      }
+   }
+#endif
+}
+
+static bool GrowArray( void ** array, size_t * cap, size_t elem_size )
+{
+   size_t new_cap = ( *cap > 0 ) ? (*cap * 2u) : INITIAL_ARRAY_CAP;
+   void * grown = realloc( *array, new_cap * elem_size );
+   if ( NULL == grown )
+   {
+      return false;
+   }
+   *array = grown;
+   *cap = new_cap;
+   return true;
+}
+
+/**
+ * @brief timestamp,channel,id,pid,data,checksum
+ */
+static bool ParseCSVLine( struct Cursor_S * cur, struct LOG_Frame_S * frame, struct LOG_Anomaly_S * anomaly )
+{
+   const char * start;
+   const char * end;
+
+   NextField(cur, &start, &end);
+   if ( !LOG_ParseTimestamp(start, end, &frame->timestamp) )
+   {
+      anomaly->kind = LOG_ANOMALY_SYNTAX;
+      return true;
+   }
+
+   NextField(cur, &start, &end);
+   if ( !ParseDecByte(start, end, &frame->channel) )
+   {
+      anomaly->kind = LOG_ANOMALY_SYNTAX;
+      return true;
+   }
+
+   NextField(cur, &start, &end);
+   if ( !ParseIDToken(start, end, false, frame, anomaly) )
+   {
+      return true;
+   }
+
+   NextField(cur, &start, &end);
+   if ( start != end )
+   {
+      if ( !ParseHexByte(start, end, &frame->pid) )
+      {
+         anomaly->kind = LOG_ANOMALY_SYNTAX;
+         return true;
+      }
+      frame->has_pid = true;
+   }
+
+   const char * data_start;
+   const char * data_end;
+   NextField(cur, &data_start, &data_end);
+   struct Cursor_S data = { data_start, data_end };
+   while ( data.pos < data.end )
+   {
+      NextWord(&data, &start, &end);
+      if ( start == end )
+      {
+         break;
+      }
+      if ( frame->length == LOG_MAX_FRAME_LEN )
+      {
+         anomaly->kind = LOG_ANOMALY_LENGTH;
+         anomaly->expected = LOG_MAX_FRAME_LEN;
+         return true;
+      }
+      if ( !ParseHexByte(start, end, &frame->data[frame->length]) )
+      {
+         anomaly->kind = LOG_ANOMALY_SYNTAX;
+         return true;
+      }
+      frame->length++;
+   }
+
+   NextField(cur, &start, &end);
+   if ( !ParseHexByte(start, end, &frame->checksum) || (cur->pos != cur->end) )
+   {
+      anomaly->kind = LOG_ANOMALY_SYNTAX;
+   }
+   return true;
+}
+
+/**
+ * @brief timestamp L<channel> id Rx|Tx dlc data... checksum = cs [...]
+ */
+static bool ParseASCLine( struct Cursor_S * cur, struct LOG_Frame_S * frame, struct LOG_Anomaly_S * anomaly )
+{
+   const char * start;
+   const char * end;
+
+   NextWord(cur, &start, &end);
+   if ( !LOG_ParseTimestamp(start, end, &frame->timestamp) )
+   {
+      return false;
+   }
+
+   // Channel: 'L', maybe some letters (e.g. "Li"), then the channel number
+   NextWord(cur, &start, &end);
+   if ( (start == end) || (*start != 'L') )
+   {
+      return false;
+   }
+   start++;
+   while ( (start < end) && CHAR_IS(*start, CHAR_ALPHA) )
+   {
+      start++;
+   }
+   if ( (start != end) && !ParseDecByte(start, end, &frame->channel) )
+   {
+      return false;
+   }
+
+   const char * id_start;
+   const char * id_end;
+   NextWord(cur, &id_start, &id_end);
+
+   // Only Rx/Tx lines are frames; anything else on a channel is a bus event
+   NextWord(cur, &start, &end);
+   if ( !TokenIs(start, end, "Rx") && !TokenIs(start, end, "Tx") )
+   {
+      return false;
+   }
+
+   if ( !ParseIDToken(id_start, id_end, true, frame, anomaly) )
+   {
+      return true;
+   }
+
+   uint8_t dlc = 0;
+   NextWord(cur, &start, &end);
+   if ( !ParseDecByte(start, end, &dlc) )
+   {
+      anomaly->kind = LOG_ANOMALY_SYNTAX;
+      return true;
+   }
+
+   for ( ;; )
+   {
+      NextWord(cur, &start, &end);
+      if ( (start == end) || TokenIs(start, end, "checksum") )
+      {
+         break;
+      }
+      if ( frame->length == LOG_MAX_FRAME_LEN )
+      {
+         anomaly->kind = LOG_ANOMALY_LENGTH;
+         anomaly->expected = LOG_MAX_FRAME_LEN;
+         return true;
+      }
+      if ( !ParseHexByte(start, end, &frame->data[frame->length]) )
+      {
+         anomaly->kind = LOG_ANOMALY_SYNTAX;
+         return true;
+      }
+      frame->length++;
+   }
+   if ( !TokenIs(start, end, "checksum") )
+   {
+      anomaly->kind = LOG_ANOMALY_SYNTAX;
+      return true;
+   }
+
+   NextWord(cur, &start, &end);
+   if ( !TokenIs(start, end, "=") )
+   {
+      anomaly->kind = LOG_ANOMALY_SYNTAX;
+      return true;
+   }
+   NextWord(cur, &start, &end);
+   if ( !ParseHexByte(start, end, &frame->checksum) )
+   {
+      anomaly->kind = LOG_ANOMALY_SYNTAX;
+      return true;
+   }
+
+   // Whatever follows the checksum (header/response times, etc.) is ignored
+   if ( dlc != frame->length )
+   {
+      anomaly->kind = LOG_ANOMALY_LENGTH;
+      anomaly->expected = dlc;
+   }
+   return true;
+}
+
+static void ValidateFrame( const struct LOG_Frame_S * frame,
+                           enum LOG_Checksum_E checksum,
+                           struct LOG_Anomaly_S * anomaly )
+{
+   uint8_t reference_pid = ReferencePID(frame->id);
+   if ( frame->has_pid && (frame->pid != reference_pid) )
+   {
+      anomaly->kind = LOG_ANOMALY_PID_MISMATCH;
+      anomaly->expected = reference_pid;
+      return;
+   }
+
+   bool enhanced = ( LOG_CHECKSUM_LIN2 == checksum ) && ( frame->id < FIRST_CLASSIC_ONLY_ID );
+   uint8_t expected = LOG_Checksum(reference_pid, frame->data, frame->length, enhanced);
+   if ( frame->checksum != expected )
+   {
+      anomaly->kind = LOG_ANOMALY_CHECKSUM;
+      anomaly->expected = expected;
+   }
+}
+
+/**
+ * @brief Run an ID token through ParseID(), the same parser the CLI uses.
+ */
+static bool ParseIDToken( const char * start, const char * end, bool ishex, struct LOG_Frame_S * frame, struct LOG_Anomaly_S * anomaly )
+{
+   size_t len = (size_t)(end - start);
+   if ( 0 == len )
+   {
+      anomaly->kind = LOG_ANOMALY_SYNTAX;
+      return false;
+   }
+   if ( len > MAX_ID_TOKEN_LEN )
+   {
+      anomaly->kind = LOG_ANOMALY_BAD_ID;
+      anomaly->id_error = TooManyDigitsEntered;
+      return false;
+   }
+
+   char token[MAX_ID_TOKEN_LEN + 1];
+   memcpy( token, start, len );
+   token[len] = '\0';
+
+   enum LIN_PID_Result_E result = ParseID(token, ishex, false, &frame->id);
+   if ( result != GoodResult )
+   {
+      anomaly->kind = LOG_ANOMALY_BAD_ID;
+      anomaly->id_error = result;
+      return false;
+   }
+   return true;
+}
+
+/**
+ * @brief One or two hex digits, with an optional 0x prefix.
+ */
+static bool ParseHexByte( const char * start, const char * end, uint8_t * byte )
+{
+   if ( ((end - start) > 2) && ('0' == start[0]) && CHAR_IS(start[1], CHAR_HEX_PREFIX) )
+   {
+      start += 2;
+   }
+
+   ptrdiff_t len = end - start;
+   if ( (len < 1) || (len > 2) )
+   {
+      return false;
+   }
+
+   int hi = ( 2 == len ) ? HexDigitValue(start[0]) : 0;
+   int lo = HexDigitValue(start[len - 1]);
+   if ( (hi < 0) || (lo < 0) )
+   {
+      return false;
+   }
+   *byte = (uint8_t)((hi << 4) | lo);
+   return true;
+}
+
+static bool ParseDecByte( const char * start, const char * end, uint8_t * byte )
+{
+   unsigned int value = 0;
+   if ( (start == end) || ((end - start) > 3) )
+   {
+      return false;
+   }
+   for ( const char * p = start; p < end; p++ )
+   {
+      if ( !CHAR_IS(*p, CHAR_DEC_DIGIT) )
+      {
+         return false;
+      }
+      value = (value * 10u) + CHAR_DIGIT_VALUE(*p);
+   }
+   if ( value > UINT8_MAX )
+   {
+      return false;
+   }
+   *byte = (uint8_t)value;
+   return true;
+}
+
+/**
+ * @brief Next whitespace-separated token. start == end when there are none left.
+ */
+static void NextWord( struct Cursor_S * cur, const char ** start, const char ** end )
+{
+   SkipBlanks(cur);
+   *start = cur->pos;
+   while ( (cur->pos < cur->end) && !CHAR_IS(*cur->pos, CHAR_BLANK) )
+   {
+      cur->pos++;
+   }
+   *end = cur->pos;
+}
+
+/**
+ * @brief Next comma-separated field, with surrounding blanks trimmed.
+ */
+static void NextField( struct Cursor_S * cur, const char ** start, const char ** end )
+{
+   SkipBlanks(cur);
+   *start = cur->pos;
+   const char * comma = ( cur->pos < cur->end ) ? memchr( cur->pos, ',', (size_t)(cur->end - cur->pos) ) : NULL;
+   const char * field_end = ( comma != NULL ) ? comma : cur->end;
+   cur->pos = ( comma != NULL ) ? (comma + 1) : cur->end;
+
+   while ( (field_end > *start) && CHAR_IS(field_end[-1], CHAR_BLANK) )
+   {
+      field_end--;
+   }
+   *end = field_end;
+}
+
+static bool TokenIs( const char * start, const char * end, const char * word )
+{
+   size_t len = strlen(word);
+   return ( (size_t)(end - start) == len ) && ( memcmp(start, word, len) == 0 );
+}
+
+static void SkipBlanks( struct Cursor_S * cur )
+{
+   while ( (cur->pos < cur->end) && CHAR_IS(*cur->pos, CHAR_BLANK) )
+   {
+      cur->pos++;
+   }
+}
+
+static int HexDigitValue( char ch )
+{
+   return CHAR_IS(ch, CHAR_HEX_DIGIT) ? (int)CHAR_DIGIT_VALUE(ch) : -1;
+}
+
+static unsigned int NumOfThreads( unsigned int requested )
+{
+#ifdef _WIN32
+   (void)requested;
+   return 1u;
+#else
+   if ( 0 == requested )
+   {
+      long cores = sysconf(_SC_NPROCESSORS_ONLN);
+      requested = ( cores > 0 ) ? (unsigned int)cores : 1u;
+   }
+   return ( requested > MAX_LOG_THREADS ) ? MAX_LOG_THREADS : requested;
+#endif
+}
+
+#ifndef _WIN32
+/**
+ * @brief Sleep until the watched file changes (or, without inotify, for a
+ *        poll period), or until a stop signal comes in.
+ */
+static void WaitForAppend( int watch_fd, const sigset_t * wait_mask )
+{
+   if ( watch_fd >= 0 )
+   {
+      fd_set fds;
+      FD_ZERO(&fds);
+      FD_SET(watch_fd, &fds);
+      if ( pselect(watch_fd + 1, &fds, NULL, NULL, NULL, wait_mask) > 0 )
+      {
+         // Only the wake-up matters; the events themselves are dropped
+         char events[4096];
+         (void)read(watch_fd, events, sizeof(events));
+      }
+   }
+   else
+   {
+      struct timespec poll_period = { 0, (long)LOG_FOLLOW_POLL_MS * 1000000L };
+      (void)pselect(0, NULL, NULL, NULL, &poll_period, wait_mask);
+   }
+}
+
+static void StopFollowing( int sig )
+{
+   (void)sig;
+   FollowStop = 1;
+}
+
+static void * PieceThread( void * arg )
+{
+   ProcessPiece( (struct Piece_S *)arg );
+   return NULL;
+}
+#endif
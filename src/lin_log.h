@@ -0,0 +1,227 @@
+/*!
+ * @file    lin_log.h
+ * @brief   Streaming validation of text LIN bus logs (CSV or ASC-style).
+ *
+ * Logs are read in large chunks. Each chunk is split at line boundaries into
+ * one piece per thread, and every piece is parsed and validated on its own.
+ * Each line's ID goes through the same parser as the CLI's ID argument, and
+ * its PID and checksum are checked against the reference PID table. Only
+ * anomalies are handed back, in file order. Everything else is folded into
+ * per-ID counters.
+ *
+ * A log that's still being written can be followed instead: LOG_Follow()
+ * waits for appends and validates each line as soon as its newline lands,
+ * carrying a partly written line over to the next append.
+ *
+ * Supported line formats (blank lines, '#'/'//' comments, headers, and
+ * non-frame events are skipped):
+ *
+ *    CSV:  timestamp,channel,id,pid,data,checksum
+ *          e.g. 1.234567,1,0x27,0xE7,01 02 03 04,0E
+ *          pid may be left empty; data bytes are space-separated hex.
+ *
+ *    ASC:  timestamp L<channel> id Rx|Tx dlc data... checksum = cs [...]
+ *          e.g. 1.234567 Li1 27 Rx 4 01 02 03 04 checksum = 0E
+ *          The id is hex, as Vector ASC logs write it.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_LOG_H
+#define LIN_LOG_H
+
+/* File Inclusions */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "lin_pid.h"
+
+/* Public Macro Definitions */
+#define LOG_MAX_FRAME_LEN     8u
+#define LOG_DEFAULT_CHUNK_LEN (8u * 1024u * 1024u)
+#define LOG_FOLLOW_READ_LEN   (64u * 1024u)
+#define LOG_FOLLOW_POLL_MS    50u      // Where there's no inotify to wait on
+
+/* Public Datatypes */
+
+enum LOG_Format_E
+{
+   LOG_FORMAT_CSV,
+   LOG_FORMAT_ASC
+};
+
+enum LOG_Checksum_E
+{
+   LOG_CHECKSUM_LIN2,      // Enhanced, except classic for the diagnostic IDs 0x3C-0x3F
+   LOG_CHECKSUM_CLASSIC    // LIN 1.x: classic everywhere
+};
+
+enum LOG_Anomaly_E
+{
+   LOG_ANOMALY_NONE,
+   LOG_ANOMALY_SYNTAX,           // Frame line that couldn't be parsed
+   LOG_ANOMALY_BAD_ID,           // ID token rejected by ParseID()
+   LOG_ANOMALY_LENGTH,           // DLC doesn't match the data bytes, or more than 8 bytes
+   LOG_ANOMALY_PID_MISMATCH,     // Logged PID differs from the reference table
+   LOG_ANOMALY_CHECKSUM,         // Logged checksum doesn't match the data
+   NUM_OF_LOG_ANOMALIES
+};
+
+struct LOG_Frame_S
+{
+   double timestamp;             // Seconds
+   uint8_t channel;
+   uint8_t id;
+   uint8_t pid;                  // Only meaningful if has_pid
+   uint8_t length;
+   uint8_t data[LOG_MAX_FRAME_LEN];
+   uint8_t checksum;
+   bool has_pid;
+};
+
+struct LOG_Anomaly_S
+{
+   size_t line;                  // 1-based
+   enum LOG_Anomaly_E kind;
+   enum LIN_PID_Result_E id_error;  // Why ParseID() rejected the ID, for LOG_ANOMALY_BAD_ID
+   struct LOG_Frame_S frame;     // As far as it was parsed
+   uint8_t expected;             // Expected PID or checksum for the mismatch kinds. For
+                                 // LOG_ANOMALY_LENGTH, the DLC, or LOG_MAX_FRAME_LEN when
+                                 // more bytes than that were logged (frame.length == expected).
+};
+
+struct LOG_IDStats_S
+{
+   uint64_t frames;
+   uint64_t pid_errors;
+   uint64_t checksum_errors;
+   double first_timestamp;
+   double last_timestamp;
+};
+
+struct LOG_Summary_S
+{
+   uint64_t lines;
+   uint64_t frames;              // Lines that held a frame, valid or not
+   uint64_t anomalies[NUM_OF_LOG_ANOMALIES];
+   struct LOG_IDStats_S per_id[MAX_ID_ALLOWED + 1];
+};
+
+struct LOG_Options_S
+{
+   enum LOG_Format_E format;
+   enum LOG_Checksum_E checksum;
+   unsigned int num_threads;     // 0 for one per online core
+   size_t chunk_len;             // 0 for LOG_DEFAULT_CHUNK_LEN
+
+   // Called once per anomaly, in file order, from the calling thread. May be NULL.
+   void (*on_anomaly)( const struct LOG_Anomaly_S * anomaly, void * ctx );
+
+   // Called once per complete frame (valid, or with only a PID or checksum
+   // mismatch, given as kind), in file order, from the calling thread. Each
+   // piece's anomalies are delivered before its frames. May be NULL.
+   void (*on_frame)( const struct LOG_Frame_S * frame, enum LOG_Anomaly_E kind, void * ctx );
+
+   void * ctx;
+};
+
+struct LOG_Tail_S
+{
+   struct LOG_Options_S options;  // num_threads and chunk_len aren't used
+   struct LOG_Summary_S summary;
+   char * partial;                // Last line so far, waiting for its newline
+   size_t partial_len;
+   size_t partial_cap;
+};
+
+/* Public API */
+
+/**
+ * @brief Pick the format from a file name: ".asc" is ASC, anything else CSV.
+ */
+enum LOG_Format_E LOG_FormatFromPath( const char * path );
+
+/**
+ * @brief Parse and validate a single line (no newline).
+ *
+ * @param[out] anomaly Filled in when the line is a frame with a problem.
+ * @param[out] frame The parsed frame, when the line held one.
+ * @return true if the line held a frame (valid or not), false if it was skipped.
+ */
+bool LOG_ProcessLine( const char * line,
+                      size_t len,
+                      enum LOG_Format_E format,
+                      enum LOG_Checksum_E checksum,
+                      struct LOG_Frame_S * frame,
+                      struct LOG_Anomaly_S * anomaly );
+
+/**
+ * @brief Classic (data only) or enhanced (PID + data) LIN checksum.
+ */
+uint8_t LOG_Checksum( uint8_t pid, const uint8_t * data, uint8_t length, bool enhanced );
+
+/**
+ * @brief Read a whole log from fp and validate every line.
+ *
+ * @param[out] summary Zeroed first, then filled in.
+ * @return GoodResult, OutOfMemory, or LogFileUnreadable on a read error.
+ */
+enum LIN_PID_Result_E LOG_ProcessStream( FILE * fp,
+                                         const struct LOG_Options_S * options,
+                                         struct LOG_Summary_S * summary );
+
+/**
+ * @brief Start validating a log that arrives a piece at a time.
+ */
+void LOG_TailInit( struct LOG_Tail_S * tail, const struct LOG_Options_S * options );
+
+/**
+ * @brief Validate every line that data completes, in order, on the calling
+ *        thread. Whatever follows the last newline is held until a later
+ *        call finishes it, so data may be split anywhere.
+ *
+ * @return GoodResult, or OutOfMemory.
+ */
+enum LIN_PID_Result_E LOG_TailFeed( struct LOG_Tail_S * tail, const char * data, size_t len );
+
+/**
+ * @brief Validate a held last line as is, as LOG_ProcessStream() does at the
+ *        end of a file.
+ */
+void LOG_TailFlush( struct LOG_Tail_S * tail );
+
+void LOG_TailFree( struct LOG_Tail_S * tail );
+
+/**
+ * @brief Validate the log at path, then keep validating whatever is appended
+ *        to it until SIGINT/SIGTERM or the file is deleted.
+ *
+ * Waits on inotify where there is one and polls every LOG_FOLLOW_POLL_MS
+ * otherwise; nothing runs while the file is idle. A line is only validated
+ * once its newline has been written. If the file shrinks, it's read again
+ * from the top. SIGINT and SIGTERM are handled here only while following.
+ *
+ * @param[out] summary Everything validated, including before the stop.
+ * @return GoodResult, LogFileUnreadable, OutOfMemory, or FollowUnsupported.
+ */
+enum LIN_PID_Result_E LOG_Follow( const char * path,
+                                  const struct LOG_Options_S * options,
+                                  struct LOG_Summary_S * summary );
+
+/**
+ * @brief Parse seconds written as <digits>[.<digits>] (no sign, no exponent),
+ *        the way both log formats write timestamps.
+ *
+ * @return false unless all of [start, end) is such a number.
+ */
+bool LOG_ParseTimestamp( const char * start, const char * end, double * timestamp );
+
+/**
+ * @brief Human-readable name of an anomaly kind.
+ */
+const char * LOG_AnomalyName( enum LOG_Anomaly_E kind );
+
+#endif // LIN_LOG_H
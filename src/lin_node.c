@@ -0,0 +1,676 @@
+/*!
+ * @file    lin_node.c
+ * @brief   LIN master/slave node emulation over a pseudo-terminal or tty.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#define _XOPEN_SOURCE 700     // posix_openpt() and friends, on top of POSIX.1-2008
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <termios.h>
+#include <time.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#endif
+
+#include "lin_pid.h"
+#include "lin_log.h"
+#include "lin_ldf.h"
+#include "lin_cap.h"
+#include "lin_sched.h"
+#include "lin_hist.h"
+#include "lin_node.h"
+
+/* Local Macro Definitions */
+#define ID_MASK                  0x3Fu
+#define FIRST_CLASSIC_ONLY_ID    0x3Cu
+#define HEADER_LEN               3u       // Break, sync, PID
+#define MAX_RESPONSE_LEN         ( CAP_MAX_FRAME_LEN + 1u )   // Data and checksum
+#define READ_LEN                 256u
+#define MAX_EVENTS               2u
+#define NS_PER_US                1000u
+#define NS_PER_MS                1000000.0
+#define NS_PER_SEC               1000000000u
+
+/* Datatypes */
+
+enum HeaderState_E
+{
+   HEADER_IDLE,               // Waiting for a break
+   HEADER_SYNC,
+   HEADER_PID,
+   HEADER_RESPONSE            // After a header: someone's response, or nothing
+};
+
+struct Node_S
+{
+   const struct Node_Options_S * options;
+   struct Node_Stats_S stats;
+   uint64_t start_ns;
+
+   // Master: the slot in progress
+   size_t slot;
+   uint64_t cycle;
+   uint64_t header_ns;
+   bool slot_open;
+   bool own_response;               // The master answered its own header
+   uint8_t expected_len;            // Response bytes, checksum included
+   uint8_t response[MAX_RESPONSE_LEN];
+   uint8_t response_len;
+
+   // Slave
+   enum HeaderState_E state;
+   bool after_header;               // A break that turns out not to be one is response data
+};
+
+/* Private Function Prototypes */
+static void PackResponse( uint8_t pid, const struct Node_Response_S * response, bool enhanced, uint8_t * out );
+static bool IsEnhanced( const struct Node_S * node, uint8_t id );
+#ifdef __linux__
+static bool MakeRaw( int fd );
+static uint64_t NowNs( void );
+static bool WriteAll( struct Node_S * node, const uint8_t * bytes, size_t len );
+static bool ArmTimer( int timer_fd, uint64_t deadline_ns );
+static void StartSlot( struct Node_S * node );
+static void EndSlot( struct Node_S * node );
+static void MasterTakeBytes( struct Node_S * node, const uint8_t * bytes, size_t len, uint64_t now_ns );
+static bool SlaveTakeBytes( struct Node_S * node, const uint8_t * bytes, size_t len, uint64_t now_ns );
+static void StopRunning( int sig );
+static void RequestReport( int sig );
+#endif
+
+/* Local Variables */
+#ifdef __linux__
+static volatile sig_atomic_t RunStop = 0;    // Set by SIGINT/SIGTERM while Node_Run() runs
+static volatile sig_atomic_t RunReport = 0;  // Set by SIGUSR1 while Node_Run() runs
+#endif
+
+/* Public Function Implementations */
+
+enum LIN_PID_Result_E Node_OpenPty( int * master_fd, int * slave_fd, char * slave_path )
+{
+   assert( (master_fd != NULL) && (slave_fd != NULL) && (slave_path != NULL) );
+
+#ifdef __linux__
+   int fd = posix_openpt(O_RDWR | O_NOCTTY);
+   if ( fd < 0 )
+   {
+      return NodePortUnusable;
+   }
+   const char * name = ( (grantpt(fd) == 0) && (unlockpt(fd) == 0) ) ? ptsname(fd) : NULL;
+   if ( (NULL == name) || (strlen(name) >= NODE_MAX_PATH_LEN) || !MakeRaw(fd) )
+   {
+      (void)close(fd);
+      return NodePortUnusable;
+   }
+   (void)strcpy(slave_path, name);
+
+   enum LIN_PID_Result_E result = Node_OpenPort(slave_path, slave_fd);
+   if ( result != GoodResult )
+   {
+      (void)close(fd);
+      return result;
+   }
+   *master_fd = fd;
+   return GoodResult;
+#else
+   (void)master_fd;
+   (void)slave_fd;
+   (void)slave_path;
+   return NodeUnsupported;
+#endif
+}
+
+enum LIN_PID_Result_E Node_OpenPort( const char * path, int * fd )
+{
+   assert( (path != NULL) && (fd != NULL) );
+
+#ifdef __linux__
+   int port = open(path, O_RDWR | O_NOCTTY);
+   if ( port < 0 )
+   {
+      return NodePortUnusable;
+   }
+   if ( !MakeRaw(port) )
+   {
+      (void)close(port);
+      return NodePortUnusable;
+   }
+   *fd = port;
+   return GoodResult;
+#else
+   (void)path;
+   (void)fd;
+   return NodeUnsupported;
+#endif
+}
+
+void Node_ClosePort( int fd )
+{
+#ifdef __linux__
+   if ( fd >= 0 )
+   {
+      (void)close(fd);
+   }
+#else
+   (void)fd;
+#endif
+}
+
+void Node_ResponsesFromLDF( const struct LDF_Database_S * db,
+                            uint16_t node,
+                            struct Node_Response_S responses[CAP_NUM_OF_IDS] )
+{
+   assert( (db != NULL) && (responses != NULL) );
+
+   memset( responses, 0, CAP_NUM_OF_IDS * sizeof(responses[0]) );
+   for ( size_t f = 0; f < db->num_frames; f++ )
+   {
+      const struct LDF_Frame_S * frame = &db->frames[f];
+      if ( (frame->publisher != node) || frame->is_diagnostic )
+      {
+         continue;
+      }
+
+      struct Node_Response_S * response = &responses[frame->id];
+      response->published = true;
+      response->length = frame->length;
+      for ( uint16_t s = 0; s < frame->num_signals; s++ )
+      {
+         const struct LDF_FrameSignal_S * frame_signal = &db->frame_signals[frame->first_signal + s];
+         const struct LDF_Signal_S * signal = &db->signals[frame_signal->signal];
+         for ( unsigned int bit = 0; bit < signal->size_bits; bit++ )
+         {
+            unsigned int at = frame_signal->bit_offset + bit;
+            if ( (at < (CAP_MAX_FRAME_LEN * 8u)) && (((signal->init_value >> bit) & 1u) != 0u) )
+            {
+               response->data[at / 8u] |= (uint8_t)(1u << (at % 8u));
+            }
+         }
+      }
+   }
+}
+
+enum LIN_PID_Result_E Node_Run( const struct Node_Options_S * options, struct Node_Stats_S * stats )
+{
+   assert( (options != NULL) && (stats != NULL) );
+   assert( (options->role != NODE_MASTER) || (options->slots != NULL) || (0 == options->num_slots) );
+
+#ifdef __linux__
+   struct Node_S node;
+   memset( &node, 0, sizeof(node) );
+   node.options = options;
+   Hist_Init(&node.stats.latency);
+   node.state = HEADER_IDLE;
+
+   bool is_master = ( NODE_MASTER == options->role );
+   if ( is_master && (0 == options->num_slots) )
+   {
+      *stats = node.stats;
+      return GoodResult;
+   }
+
+   int flags = fcntl(options->fd, F_GETFL);
+   int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+   int timer_fd = is_master ? timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC) : -1;
+   struct epoll_event port_event = { .events = EPOLLIN, .data = { .fd = options->fd } };
+   struct epoll_event timer_event = { .events = EPOLLIN, .data = { .fd = timer_fd } };
+   bool set_up = ( flags >= 0 ) && ( fcntl(options->fd, F_SETFL, flags | O_NONBLOCK) == 0 ) &&
+                 ( epoll_fd >= 0 ) && ( epoll_ctl(epoll_fd, EPOLL_CTL_ADD, options->fd, &port_event) == 0 ) &&
+                 ( !is_master || ((timer_fd >= 0) && (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, timer_fd, &timer_event) == 0)) );
+   if ( !set_up )
+   {
+      if ( epoll_fd >= 0 )
+      {
+         (void)close(epoll_fd);
+      }
+      if ( timer_fd >= 0 )
+      {
+         (void)close(timer_fd);
+      }
+      if ( flags >= 0 )
+      {
+         (void)fcntl(options->fd, F_SETFL, flags);
+      }
+      return NodePortUnusable;
+   }
+
+   // SIGINT, SIGTERM, and SIGUSR1 stay blocked except while waiting, as in
+   // LOG_Follow()
+   sigset_t stop_set;
+   sigset_t saved_mask;
+   sigset_t wait_mask;
+   (void)sigemptyset(&stop_set);
+   (void)sigaddset(&stop_set, SIGINT);
+   (void)sigaddset(&stop_set, SIGTERM);
+   (void)sigaddset(&stop_set, SIGUSR1);
+   (void)pthread_sigmask(SIG_BLOCK, &stop_set, &saved_mask);
+   wait_mask = saved_mask;
+   (void)sigdelset(&wait_mask, SIGINT);
+   (void)sigdelset(&wait_mask, SIGTERM);
+   (void)sigdelset(&wait_mask, SIGUSR1);
+
+   struct sigaction action;
+   struct sigaction report_action;
+   struct sigaction saved_int;
+   struct sigaction saved_term;
+   struct sigaction saved_usr1;
+   memset( &action, 0, sizeof(action) );
+   action.sa_handler = StopRunning;
+   (void)sigemptyset(&action.sa_mask);
+   report_action = action;
+   report_action.sa_handler = RequestReport;
+   (void)sigaction(SIGINT, &action, &saved_int);
+   (void)sigaction(SIGTERM, &action, &saved_term);
+   (void)sigaction(SIGUSR1, &report_action, &saved_usr1);
+   RunStop = 0;
+   RunReport = 0;
+
+   enum LIN_PID_Result_E result = GoodResult;
+   node.start_ns = NowNs();
+   uint64_t deadline_ns = node.start_ns;
+   uint64_t slot_ns = 0;
+   if ( is_master )
+   {
+      StartSlot(&node);
+      slot_ns = (uint64_t)(options->slots[0].slot_ms * NS_PER_MS);
+      deadline_ns += slot_ns;
+      result = ArmTimer(timer_fd, deadline_ns) ? GoodResult : NodePortUnusable;
+   }
+
+   bool running = ( GoodResult == result );
+   while ( running && !RunStop )
+   {
+      struct epoll_event events[MAX_EVENTS];
+      int num_events = epoll_pwait(epoll_fd, events, (int)MAX_EVENTS, -1, &wait_mask);
+      if ( RunReport )
+      {
+         RunReport = 0;
+         if ( options->on_report != NULL )
+         {
+            options->on_report( &node.stats, options->ctx );
+         }
+      }
+      if ( num_events < 0 )
+      {
+         running = ( EINTR == errno );
+         result = running ? GoodResult : NodePortUnusable;
+         continue;
+      }
+
+      for ( int e = 0; running && (e < num_events); e++ )
+      {
+         if ( events[e].data.fd == timer_fd )
+         {
+            uint64_t expirations;
+            (void)read(timer_fd, &expirations, sizeof(expirations));
+            uint64_t now_ns = NowNs();
+            if ( (now_ns - deadline_ns) >= slot_ns )
+            {
+               node.stats.late_slots++;
+            }
+
+            EndSlot(&node);
+            if ( ++node.slot == options->num_slots )
+            {
+               node.slot = 0;
+               node.cycle++;
+               running = ( 0 == options->cycles ) || ( node.cycle < options->cycles );
+            }
+            if ( running )
+            {
+               StartSlot(&node);
+               slot_ns = (uint64_t)(options->slots[node.slot].slot_ms * NS_PER_MS);
+               deadline_ns += slot_ns;
+               running = ArmTimer(timer_fd, deadline_ns);
+               result = running ? GoodResult : NodePortUnusable;
+            }
+            continue;
+         }
+
+         // The port: drain it, then see whether the other end is gone
+         uint8_t bytes[READ_LEN];
+         ssize_t n;
+         while ( running && ((n = read(options->fd, bytes, sizeof(bytes))) > 0) )
+         {
+            uint64_t now_ns = NowNs();
+            if ( is_master )
+            {
+               MasterTakeBytes(&node, bytes, (size_t)n, now_ns);
+            }
+            else
+            {
+               running = SlaveTakeBytes(&node, bytes, (size_t)n, now_ns);
+               result = running ? GoodResult : NodePortUnusable;
+            }
+         }
+         if ( running && (n < 0) && (errno != EAGAIN) && (errno != EINTR) )
+         {
+            // A pty's slave end reads EIO once the master end has closed
+            running = false;
+            result = ( EIO == errno ) ? GoodResult : NodePortUnusable;
+         }
+         else if ( running && ((0 == n) || ((events[e].events & EPOLLHUP) != 0u)) )
+         {
+            running = false;
+         }
+      }
+   }
+   if ( is_master && node.slot_open )
+   {
+      EndSlot(&node);
+   }
+
+   (void)sigaction(SIGINT, &saved_int, NULL);
+   (void)sigaction(SIGTERM, &saved_term, NULL);
+   (void)sigaction(SIGUSR1, &saved_usr1, NULL);
+   (void)pthread_sigmask(SIG_SETMASK, &saved_mask, NULL);
+   if ( timer_fd >= 0 )
+   {
+      (void)close(timer_fd);
+   }
+   (void)close(epoll_fd);
+   (void)fcntl(options->fd, F_SETFL, flags);
+
+   *stats = node.stats;
+   return result;
+#else
+   (void)PackResponse;
+   (void)IsEnhanced;
+   memset( stats, 0, sizeof(*stats) );
+   return NodeUnsupported;
+#endif
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief Data bytes and then the checksum, length + 1 bytes in all.
+ */
+static void PackResponse( uint8_t pid, const struct Node_Response_S * response, bool enhanced, uint8_t * out )
+{
+   memcpy( out, response->data, response->length );
+   out[response->length] = LOG_Checksum(pid, response->data, response->length, enhanced);
+}
+
+static bool IsEnhanced( const struct Node_S * node, uint8_t id )
+{
+   return ( LOG_CHECKSUM_LIN2 == node->options->checksum ) && ( id < FIRST_CLASSIC_ONLY_ID );
+}
+
+#ifdef __linux__
+static bool MakeRaw( int fd )
+{
+   struct termios tio;
+   if ( tcgetattr(fd, &tio) != 0 )
+   {
+      return false;
+   }
+   tio.c_iflag &= ~(tcflag_t)(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON | IXOFF);
+   tio.c_oflag &= ~(tcflag_t)OPOST;
+   tio.c_lflag &= ~(tcflag_t)(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+   tio.c_cflag &= ~(tcflag_t)(CSIZE | PARENB);
+   tio.c_cflag |= (tcflag_t)(CS8 | CLOCAL | CREAD);
+   tio.c_cc[VMIN] = 1;
+   tio.c_cc[VTIME] = 0;
+   return ( tcsetattr(fd, TCSANOW, &tio) == 0 );
+}
+
+static uint64_t NowNs( void )
+{
+   struct timespec ts;
+   (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ( (uint64_t)ts.tv_sec * NS_PER_SEC ) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @return false only if the port failed. A full port drops the rest and
+ *         counts it, since a test bus has to keep to its schedule.
+ */
+static bool WriteAll( struct Node_S * node, const uint8_t * bytes, size_t len )
+{
+   while ( len > 0 )
+   {
+      ssize_t n = write(node->options->fd, bytes, len);
+      if ( n > 0 )
+      {
+         bytes += n;
+         len -= (size_t)n;
+      }
+      else if ( (n < 0) && (EAGAIN == errno) )
+      {
+         node->stats.dropped_writes++;
+         return true;
+      }
+      else if ( (n < 0) && (errno != EINTR) )
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+static bool ArmTimer( int timer_fd, uint64_t deadline_ns )
+{
+   struct itimerspec spec;
+   memset( &spec, 0, sizeof(spec) );
+   spec.it_value.tv_sec = (time_t)(deadline_ns / NS_PER_SEC);
+   spec.it_value.tv_nsec = (long)(deadline_ns % NS_PER_SEC);
+   return ( timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &spec, NULL) == 0 );
+}
+
+/**
+ * @brief Send the slot's header, and its response too if the master
+ *        publishes the frame.
+ */
+static void StartSlot( struct Node_S * node )
+{
+   const struct Sched_Slot_S * slot = &node->options->slots[node->slot];
+   node->slot_open = ( slot->id != SCHED_NO_ID );
+   node->response_len = 0;
+   if ( !node->slot_open )
+   {
+      return;   // Nothing the LDF models goes out in this slot
+   }
+
+   uint8_t id = slot->id & ID_MASK;
+   uint8_t pid = ComputePID(id);
+   const struct Node_Response_S * own = &node->options->responses[id];
+   node->own_response = own->published;
+   node->expected_len = (uint8_t)( (own->published ? own->length : slot->length) + 1u );
+
+   uint8_t bytes[HEADER_LEN + MAX_RESPONSE_LEN] = { NODE_BREAK_BYTE, NODE_SYNC_BYTE, pid };
+   size_t len = HEADER_LEN;
+   if ( own->published )
+   {
+      PackResponse(pid, own, IsEnhanced(node, id), &bytes[HEADER_LEN]);
+      memcpy( node->response, &bytes[HEADER_LEN], node->expected_len );
+      node->response_len = node->expected_len;
+      len += node->expected_len;
+   }
+   node->header_ns = NowNs();
+   (void)WriteAll(node, bytes, len);
+   node->stats.headers++;
+}
+
+/**
+ * @brief Judge whatever response came in during the slot.
+ */
+static void EndSlot( struct Node_S * node )
+{
+   if ( !node->slot_open )
+   {
+      return;
+   }
+   node->slot_open = false;
+
+   uint8_t id = node->options->slots[node->slot].id & ID_MASK;
+   struct CAP_Frame_S frame;
+   memset( &frame, 0, sizeof(frame) );
+   frame.timestamp_us = (node->header_ns - node->start_ns) / NS_PER_US;
+   frame.id = id;
+   frame.pid = ComputePID(id);
+
+   if ( 0 == node->response_len )
+   {
+      node->stats.no_responses++;
+   }
+   else
+   {
+      frame.length = (uint8_t)(node->response_len - 1u);
+      memcpy( frame.data, node->response, frame.length );
+      frame.checksum = node->response[frame.length];
+      if ( (node->response_len < node->expected_len) ||
+           (LOG_Checksum(frame.pid, frame.data, frame.length, IsEnhanced(node, id)) != frame.checksum) )
+      {
+         node->stats.checksum_errors++;
+         frame.flags = CAP_FLAG_CHECKSUM_ERROR;
+      }
+      else
+      {
+         node->stats.responses++;
+      }
+   }
+   if ( node->options->on_frame != NULL )
+   {
+      node->options->on_frame(&frame, node->options->ctx);
+   }
+}
+
+static void MasterTakeBytes( struct Node_S * node, const uint8_t * bytes, size_t len, uint64_t now_ns )
+{
+   for ( size_t i = 0; i < len; i++ )
+   {
+      if ( !node->slot_open || node->own_response || (node->response_len >= node->expected_len) )
+      {
+         node->stats.stray_bytes++;
+         continue;
+      }
+      node->response[node->response_len++] = bytes[i];
+      if ( node->response_len == node->expected_len )
+      {
+         Hist_Record(&node->stats.latency, now_ns - node->header_ns);
+      }
+   }
+}
+
+/**
+ * @return false only if answering failed.
+ */
+static bool SlaveTakeBytes( struct Node_S * node, const uint8_t * bytes, size_t len, uint64_t now_ns )
+{
+   for ( size_t i = 0; i < len; i++ )
+   {
+      uint8_t value = bytes[i];
+      switch ( node->state )
+      {
+         case HEADER_IDLE:
+            if ( NODE_BREAK_BYTE == value )
+            {
+               node->state = HEADER_SYNC;
+            }
+            else
+            {
+               node->stats.stray_bytes++;
+            }
+            break;
+
+         case HEADER_SYNC:
+            if ( NODE_SYNC_BYTE == value )
+            {
+               node->state = HEADER_PID;
+            }
+            else if ( node->after_header )
+            {
+               node->state = HEADER_RESPONSE;
+            }
+            else if ( value != NODE_BREAK_BYTE )
+            {
+               node->stats.stray_bytes++;
+               node->state = HEADER_IDLE;
+            }
+            break;
+
+         case HEADER_PID:
+         {
+            node->state = HEADER_RESPONSE;
+            node->after_header = true;
+            node->stats.headers++;
+            uint8_t id = value & ID_MASK;
+            if ( ComputePID(id) != value )
+            {
+               node->stats.pid_errors++;
+               break;
+            }
+            const struct Node_Response_S * response = &node->options->responses[id];
+            if ( !response->published )
+            {
+               break;
+            }
+
+            uint8_t out[MAX_RESPONSE_LEN];
+            PackResponse(value, response, IsEnhanced(node, id), out);
+            if ( !WriteAll(node, out, response->length + 1u) )
+            {
+               return false;
+            }
+            Hist_Record(&node->stats.latency, NowNs() - now_ns);
+            node->stats.responses++;
+
+            if ( node->options->on_frame != NULL )
+            {
+               struct CAP_Frame_S frame;
+               memset( &frame, 0, sizeof(frame) );
+               frame.timestamp_us = (now_ns - node->start_ns) / NS_PER_US;
+               frame.id = id;
+               frame.pid = value;
+               frame.length = response->length;
+               memcpy( frame.data, response->data, response->length );
+               frame.checksum = out[response->length];
+               node->options->on_frame(&frame, node->options->ctx);
+            }
+            break;
+         }
+
+         case HEADER_RESPONSE:
+            if ( NODE_BREAK_BYTE == value )
+            {
+               node->state = HEADER_SYNC;
+            }
+            break;
+
+         default:
+            assert(false);
+            break;
+      }
+   }
+   return true;
+}
+
+static void StopRunning( int sig )
+{
+   (void)sig;
+   RunStop = 1;
+}
+
+static void RequestReport( int sig )
+{
+   (void)sig;
+   RunReport = 1;
+}
+#endif
@@ -0,0 +1,148 @@
+/*!
+ * @file    lin_node.h
+ * @brief   LIN master/slave node emulation over a pseudo-terminal or tty, for
+ *          hardware-free integration and load tests.
+ *
+ * A pty carries bytes, not line levels, so the break goes out as a 0x00 byte
+ * (which is what a UART reads a break as). A header is then the three bytes
+ * 0x00 0x55 PID, and a response is the data bytes followed by the checksum.
+ * There is no echo: a node doesn't read back what it sends.
+ *
+ * As master, Node_Run() walks a schedule table (see lin_sched.h) on an
+ * absolute CLOCK_MONOTONIC timer, so late wake-ups don't add up over the
+ * cycles. Each slot sends its header, or header and response if the master
+ * publishes that frame, and whatever comes back before the next slot is the
+ * response. Its latency is from the header written to the last byte read.
+ *
+ * As slave, it answers every header whose ID it publishes, as soon as the
+ * PID is in. Its latency is from the PID read to the response written.
+ * Whatever follows a header until the next break is taken as some other
+ * node's response. So a response holding 0x00 0x55 and then a valid PID
+ * reads as a header, which a real break can't be confused with; keep such
+ * payloads out of slave tests.
+ *
+ * Both run in a single epoll loop (the port, plus a timerfd for the master),
+ * with latencies kept in nanoseconds in a log-linear histogram (see
+ * lin_hist.h). SIGINT and SIGTERM stop the loop; so does the other end of
+ * the port hanging up. SIGUSR1 hands the stats so far to on_report without
+ * stopping. Linux only.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_NODE_H
+#define LIN_NODE_H
+
+/* File Inclusions */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "lin_pid.h"
+#include "lin_log.h"
+#include "lin_ldf.h"
+#include "lin_cap.h"
+#include "lin_sched.h"
+#include "lin_hist.h"
+
+/* Public Macro Definitions */
+#define NODE_BREAK_BYTE          0x00u
+#define NODE_SYNC_BYTE           0x55u
+#define NODE_MAX_PATH_LEN        64u
+
+/* Public Datatypes */
+
+enum Node_Role_E
+{
+   NODE_MASTER,
+   NODE_SLAVE
+};
+
+struct Node_Response_S
+{
+   bool published;                  // This node answers the ID
+   uint8_t length;
+   uint8_t data[CAP_MAX_FRAME_LEN];
+};
+
+struct Node_Stats_S
+{
+   uint64_t headers;                // Sent as master, or seen as slave
+   uint64_t responses;              // Complete and with a good checksum
+   uint64_t no_responses;           // Master: slots nobody answered
+   uint64_t checksum_errors;        // Master: responses cut short or with a bad checksum
+   uint64_t pid_errors;             // Slave: headers whose PID parity was wrong
+   uint64_t stray_bytes;            // Outside any header or expected response
+   uint64_t late_slots;             // Master: slots that started a whole slot late or more
+   uint64_t dropped_writes;         // The other end wasn't reading and the port was full
+   struct Hist_S latency;           // ns
+};
+
+struct Node_Options_S
+{
+   enum Node_Role_E role;
+   int fd;                          // Open, raw port. Node_Run() makes it non-blocking.
+   enum LOG_Checksum_E checksum;
+   struct Node_Response_S responses[CAP_NUM_OF_IDS];   // Frames this node publishes
+
+   // Master only
+   const struct Sched_Slot_S * slots;
+   size_t num_slots;
+   uint64_t cycles;                 // Passes through the table; 0 to run until stopped
+
+   // Called for every frame this node took part in: as master, every slot
+   // with the response as read back (length 0 if none came); as slave, every
+   // header it answered. Timestamps are from the start of the run. May be NULL.
+   void (*on_frame)( const struct CAP_Frame_S * frame, void * ctx );
+
+   // Called with the stats so far whenever SIGUSR1 comes in. May be NULL.
+   void (*on_report)( const struct Node_Stats_S * stats, void * ctx );
+   void * ctx;
+};
+
+/* Public API */
+
+/**
+ * @brief Open a new pty in raw mode.
+ *
+ * The slave end is opened too and left open, so the master end doesn't see a
+ * hang-up while nobody else has it open. Either end can be given to
+ * Node_Run(); whatever is under test opens slave_path.
+ *
+ * @param[out] slave_path At least NODE_MAX_PATH_LEN bytes.
+ * @return GoodResult, NodePortUnusable, or NodeUnsupported.
+ */
+enum LIN_PID_Result_E Node_OpenPty( int * master_fd, int * slave_fd, char * slave_path );
+
+/**
+ * @brief Open an existing tty (or pty slave) in raw mode.
+ *
+ * @return GoodResult, NodePortUnusable, or NodeUnsupported.
+ */
+enum LIN_PID_Result_E Node_OpenPort( const char * path, int * fd );
+
+/**
+ * @brief Close a port from Node_OpenPty() or Node_OpenPort(). Does nothing
+ *        for a negative fd.
+ */
+void Node_ClosePort( int fd );
+
+/**
+ * @brief Fill in responses with every unconditional frame node publishes in
+ *        db, its data made up of its signals' init values.
+ */
+void Node_ResponsesFromLDF( const struct LDF_Database_S * db,
+                            uint16_t node,
+                            struct Node_Response_S responses[CAP_NUM_OF_IDS] );
+
+/**
+ * @brief Run as a bus node until the cycles are done (master), the other end
+ *        hangs up, or SIGINT/SIGTERM comes in. SIGUSR1 is caught meanwhile.
+ *
+ * @return GoodResult, NodePortUnusable if reading or writing the port fails,
+ *         or NodeUnsupported.
+ */
+enum LIN_PID_Result_E Node_Run( const struct Node_Options_S * options, struct Node_Stats_S * stats );
+
+#endif // LIN_NODE_H
@@ -8,37 +8,70 @@
  * @copyright MIT License
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 /* File Inclusions */
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
 #include <stdbool.h>
-#include <ctype.h>
 #include <string.h>
 
 #ifdef _WIN32
+#ifdef LIN_PID_FAST_START
+#error "The fast-start build writes straight to the stdout file descriptor and is POSIX-only"
+#endif
 #include <windows.h>
 #else
 #include <unistd.h>
+#include <sys/stat.h>
 #ifndef _POSIX_VERSION
-#error "No options available for checking stdin in a non-blocking manner"
+#error "No options available for telling whether stdin is piped in"
 #endif
 #endif
 
+#ifndef LIN_PID_FAST_START
 #include "re.h"
+#endif
 #include "lin_pid.h"
+#include "lin_char.h"
+#include "lin_ldf.h"
+#include "lin_sched.h"
+#include "lin_log.h"
+#include "lin_cap.h"
+#include "lin_stats.h"
+#include "lin_tp.h"
+#include "lin_la.h"
+#include "lin_hist.h"
+#include "lin_node.h"
+#include "lin_tty.h"
+#include "lin_emit.h"
 
 /* Local Macro Definitions */
 #define MAX_ARGS_TO_CHECK              5  // e.g., lin_pid XX --hex --quiet --no-new-line
 #define MAX_NUM_LEN                    (strlen("0x3F") + 1)
 #define MAX_ARG_LEN                    (strlen("--no-new-line"))
 #define MAX_ERR_MSG_LEN                250
+#define MAX_OUTPUT_LEN                 16 // e.g., "0xFF\n" with room to spare
 #define NO_SPECIAL_COMP_FLAGS          0
+#define ID_TOKEN_PREFIX_LEN            6u    // GetID() never reads further into a token than this
+#define PIPED_CHUNK_LEN                65536u
+#define PIPED_BATCH_IDS                1024u
+#define PIPED_LINE_MAX_LEN             (2 * MAX_OUTPUT_LEN + 24) // ID and PID, colored
+#define PIPED_ID_WIDTH                 6u
+#define PIPED_ID_COLOR                 "\033[36m"
+#define PIPED_PID_COLOR                "\033[0m\033[32m"
+#define PIPED_NO_COLOR                 "\033[0m"
+
+// Eight bytes at a time in a uint64_t, the first in the low byte
+#define SWAR_ONES                      UINT64_C(0x0101010101010101)
+#define SWAR_HIGHS                     UINT64_C(0x8080808080808080)
+#define SWAR_LOW7S                     UINT64_C(0x7F7F7F7F7F7F7F7F)
 
 #define GET_BIT(x, n)      ((x >> n) & 0x01)
 
-#ifdef TEST
+#if defined(TEST) || defined(BENCHMARK)
    #define STATIC // Set to nothing
 #else
    #define STATIC static
@@ -46,7 +79,7 @@
 
 /* Datatypes */
 
-#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd ) \
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd, pre, width, base, upper, suf ) \
    enum,
 
 enum NumericFormat_E
@@ -66,19 +99,46 @@ struct NumericFormatStrings_S
    const bool isdec;
 };
 
+// One way of spelling an ID, as lin_pid_id_spellings.h hashes them
+struct IDSpelling_S
+{
+   uint32_t key;                    // The token's bytes and its --hex/--dec flag; 0 for an empty slot
+   uint8_t id;
+   uint8_t format;                  // enum NumericFormat_E to echo the ID back in
+   bool ishex;                      // GetID()'s verdict on the token
+   bool isdec;
+};
+
+// Renders a number in one format into buf (MAX_OUTPUT_LEN), unterminated
+typedef size_t (*NumericFormatter_F)( char * buf, unsigned int value );
+
+// Modes that take over the whole command line when their flag comes first
+struct CLIMode_S
+{
+   const char * flag;
+   int (*run)( int argc, char * argv[] );
+};
+
+// Where --samples sends each frame it recovers
+struct SampledFrameSink_S
+{
+   struct CAP_Writer_S * writer;    // NULL to print them
+   enum LIN_PID_Result_E result;    // First write error
+};
+
+// What --node's SIGUSR1 reports need to print the stats
+struct NodeReport_S
+{
+   enum Node_Role_E role;
+   bool quiet;
+};
+
 
 /* Local Data */
 
 static const uint8_t REFERENCE_PID_TABLE[MAX_ID_ALLOWED + 1] =
 {
-   0x80, 0xC1, 0x42, 0x03, 0xC4, 0x85, 0x06, 0x47, 
-   0x08, 0x49, 0xCA, 0x8B, 0x4C, 0x0D, 0x8E, 0xCF, 
-   0x50, 0x11, 0x92, 0xD3, 0x14, 0x55, 0xD6, 0x97, 
-   0xD8, 0x99, 0x1A, 0x5B, 0x9C, 0xDD, 0x5E, 0x1F, 
-   0x20, 0x61, 0xE2, 0xA3, 0x64, 0x25, 0xA6, 0xE7, 
-   0xA8, 0xE9, 0x6A, 0x2B, 0xEC, 0xAD, 0x2E, 0x6F, 
-   0xF0, 0xB1, 0x32, 0x73, 0xB4, 0xF5, 0x76, 0x37, 
-   0x78, 0x39, 0xBA, 0xFB, 0x3C, 0x7D, 0xFE, 0xBF
+   #include "lin_pid_reference_table.h"
 };
 
 #ifndef NDEBUG
@@ -118,7 +178,7 @@ STATIC const char * AcceptableFlags[] =
    "--no-new-line"
 };
 
-#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd ) \
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd, pre, width, base, upper, suf ) \
    {                                                               \
       .regex_pattern = regexp,                                     \
       .print_format  = prnt_fmt,                                   \
@@ -133,13 +193,15 @@ const struct NumericFormatStrings_S NumericFormats[] =
 
 #undef LIN_PID_NUMERIC_FORMAT
 
+#include "lin_pid_id_spellings.h"
+
 /* Private Function Prototypes */
 
 STATIC bool OnlyValidFlagsArePresent( char const * args[], int argc );
 
 STATIC bool InputIsPiped(void);
 
-STATIC char * ReadNextStdInToken(void);
+static bool IDsArePiped( char const * args[], int argc );
 
 STATIC size_t ArgOccurrenceCount( char const * args[],
                                   char const * str,
@@ -161,21 +223,187 @@ STATIC enum NumericFormat_E DetermineEntryFormat( const char * str,
                                                   bool ishex,
                                                   bool isdec );
 
+#if defined(LIN_PID_FAST_START) || defined(TEST)
+STATIC bool MatchFormatPattern( const char * pattern, const char * str );
+#endif
+
+STATIC const struct IDSpelling_S * LookupIDSpelling( const char * str,
+                                                     bool ishex,
+                                                     bool isdec );
+
+static inline uint32_t IDSpellingSlot( uint32_t key );
+
+static inline const struct IDSpelling_S * ProbeIDSpelling( uint32_t key );
+
+static inline uint64_t TokenDelimiters( uint64_t word );
+
+static inline uint64_t LoadWord( const char * src );
+
+static inline uint64_t LoadBytes( const char * src, size_t n );
+
+static inline size_t FirstMarkedByte( uint64_t marks );
+
+static size_t NextTokenEdge( const char * data, size_t from, size_t len, bool delimiter );
+
+static inline enum LIN_PID_Result_E ParseIDToken( const char * token,
+                                                  size_t len,
+                                                  uint64_t word,
+                                                  bool ishex,
+                                                  bool isdec,
+                                                  uint8_t * id );
+
+static enum LIN_PID_Result_E ParseUnterminatedID( const char * token,
+                                                  size_t len,
+                                                  bool ishex,
+                                                  bool isdec,
+                                                  uint8_t * id );
+
+static inline size_t FormatNumber( char * buf,
+                                   unsigned int value,
+                                   const char * prefix,
+                                   size_t prefix_len,
+                                   size_t width,
+                                   unsigned int base,
+                                   bool upper,
+                                   const char * suffix,
+                                   size_t suffix_len );
+
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd, pre, width, base, upper, suf ) \
+   static size_t FormatNumber_##enum( char * buf, unsigned int value );
+#include "lin_pid_supported_formats.h"
+#undef LIN_PID_NUMERIC_FORMAT
+
 static void PrintHelpMsg(void);
 
 static void PrintReferenceTable(void);
 
 static void PrintErrMsg(enum LIN_PID_Result_E err);
 
+static int PipedMode( int argc, char * argv[] );
+
+static int LDFMode( int argc, char * argv[] );
+
+static int ScheduleMode( int argc, char * argv[] );
+
+static int LogMode( int argc, char * argv[] );
+
+static int FollowMode( int argc, char * argv[] );
+
+static int ConvertMode( int argc, char * argv[] );
+
+static int DumpMode( int argc, char * argv[] );
+
+static int QueryMode( int argc, char * argv[] );
+
+static int MergeMode( int argc, char * argv[] );
+
+static int StatsMode( int argc, char * argv[] );
+
+static int TPMode( int argc, char * argv[] );
+
+static int SamplesMode( int argc, char * argv[] );
+
+static int NodeMode( int argc, char * argv[] );
+
+static int CaptureMode( int argc, char * argv[] );
+
+static int EmitMode( int argc, char * argv[] );
+
+static bool LoadLDFForCLI( const char * path, struct LDF_Database_S * db );
+
+static bool ParseUInt32Arg( const char * str, uint32_t * value );
+
+static bool ParseUInt64Arg( const char * str, uint64_t * value );
+
+static bool ParseSecondsArg( const char * str, uint64_t * timestamp_us );
+
+static void PrintScheduleSlots( const struct LDF_Database_S * db,
+                                const struct LDF_ScheduleTable_S * table,
+                                const struct Sched_SlotTiming_S * timings,
+                                const struct Sched_Summary_S * summary,
+                                bool quiet );
+
+static void PrintScheduleSummary( const char * table_name,
+                                  size_t num_slots,
+                                  const struct Sched_Summary_S * summary,
+                                  bool quiet );
+
+static void PrintLDFFrame( const struct LDF_Database_S * db,
+                           const struct LDF_Frame_S * frame,
+                           bool quiet );
+
+static void PrintLogAnomaly( const struct LOG_Anomaly_S * anomaly, void * ctx );
+
+static void PrintLogSummary( const struct LOG_Summary_S * summary, bool quiet );
+
+static void PrintCaptureFrame( const struct CAP_Frame_S * frame );
+
+static void PrintIDStats( const struct Stats_Summary_S * summary, bool quiet );
+
+static void PrintTPMessage( const struct TP_Message_S * message, void * ctx );
+
+static void PrintTPError( const struct TP_Error_S * error, void * ctx );
+
+static void TakeSampledFrame( const struct CAP_Frame_S * frame, void * ctx );
+
+static void PrintNodeStats( const struct Node_Stats_S * stats, enum Node_Role_E role, bool quiet );
+
+static void ReportNodeStats( const struct Node_Stats_S * stats, void * ctx );
+
+static void TakeCapturedFrame( const struct CAP_Frame_S * frame, void * ctx );
+
+/* CLI Modes */
+
+static const struct CLIMode_S CLIModes[] =
+{
+   { "--ldf", LDFMode },
+   { "--schedule", ScheduleMode },
+   { "--log", LogMode },
+   { "--follow", FollowMode },
+   { "--convert", ConvertMode },
+   { "--dump", DumpMode },
+   { "--query", QueryMode },
+   { "--merge", MergeMode },
+   { "--stats-by-id", StatsMode },
+   { "--tp", TPMode },
+   { "--samples", SamplesMode },
+   { "--node", NodeMode },
+   { "--capture", CaptureMode },
+   { "--emit-c", EmitMode },
+   { "--emit-cpp", EmitMode },
+};
+#define NUM_OF_CLI_MODES   ( sizeof(CLIModes) / sizeof(CLIModes[0]) )
+
+/* Numeric Formatters */
+
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd, pre, width, base, upper, suf ) \
+   FormatNumber_##enum,
+
+STATIC const NumericFormatter_F NumericFormatters[NUM_OF_NUMERIC_FORMATS] =
+{
+   #include "lin_pid_supported_formats.h"
+};
+
+#undef LIN_PID_NUMERIC_FORMAT
+
 
 /* Meat of the Program */
 
-#ifdef TEST
+#if defined(TEST) || defined(BENCHMARK)
 int lin_pid_cli( int argc, char * argv[] )
 #else
 int main( int argc, char * argv[] )
 #endif
 {
+   /* Modes with their own argument handling */
+   for ( size_t i = 0; (argc > 1) && (i < NUM_OF_CLI_MODES); i++ )
+   {
+      if ( strcmp(CLIModes[i].flag, argv[1]) == 0 )
+      {
+         return CLIModes[i].run(argc, argv);
+      }
+   }
+
    /* Early return opportunities */
    if ( argc > MAX_ARGS_TO_CHECK )
    {
@@ -189,29 +417,9 @@ int main( int argc, char * argv[] )
       return EXIT_FAILURE;
    }
 
-   else if ( InputIsPiped() )
+   else if ( IDsArePiped( (const char **)argv, argc ) )
    {
-      printf("Input pipe detected.");
-
-      // TODO: Input is piped, so process data that way
-      // Split input by spaces or ',' by default
-      // Vectorize... → Use ccol!
-      // Need vector of strings...
-      struct Vector_S * num_list = VectorInit(
-                                       sizeof(char *), // element size
-                                       8, // initial capacity
-                                       65536, // maximum capacity
-                                       0 // initial length
-                                    );
-      // Oh boy... This is gonna be painful to manually manage. I now miss
-      // C++'s RAII...
-      do
-      {
-         char * next_str = ReadNextStdInToken();
-         VectorPush(next_str);
-      } while( next_str != NULL );
-
-      return EXIT_SUCCESS;
+      return PipedMode( argc, argv );
    }
 
    else if ( (1 == argc) || ( strcmp("--help", argv[1]) == 0 ) )
@@ -307,19 +515,41 @@ int main( int argc, char * argv[] )
       assert(id_arg != NULL);
 
       /* Now try to get the ID the user provided... */
-      result_status = GetID(id_arg, &user_input, &ishex, &isdec);
-      assert( ((int)result_status >= 0) && (result_status < NUM_OF_EXCEPTIONS) );
-      if ( GoodResult != result_status )
+      enum NumericFormat_E num_format;
+      const struct IDSpelling_S * spelling = LookupIDSpelling(id_arg, ishex, isdec);
+      if ( spelling != NULL )
       {
-         PrintErrMsg(result_status);
-         return EXIT_FAILURE;
+         // A spelling the formats mirror: the ID and the format to echo it
+         // back in come out of one probe, no state machine or regex needed
+         user_input = spelling->id;
+         num_format = (enum NumericFormat_E)spelling->format;
       }
-
-      /* Process input */
-      if ( user_input > MAX_ID_ALLOWED )
+      else
       {
-         PrintErrMsg(ID_OOR);
-         return EXIT_FAILURE;
+         result_status = GetID(id_arg, &user_input, &ishex, &isdec);
+         assert( ((int)result_status >= 0) && (result_status < NUM_OF_EXCEPTIONS) );
+         if ( GoodResult != result_status )
+         {
+            PrintErrMsg(result_status);
+            return EXIT_FAILURE;
+         }
+
+         /* Process input */
+         if ( user_input > MAX_ID_ALLOWED )
+         {
+            PrintErrMsg(ID_OOR);
+            return EXIT_FAILURE;
+         }
+
+         /* Determine format to print output in */
+         num_format = DetermineEntryFormat(id_arg, ishex, isdec);
+         if ( INVALID_NUMERIC_FORMAT == num_format )
+         {
+            // GetID takes a few spellings no output format mirrors (0X1A, aB),
+            // so answer those in a plain format rather than index past the table
+            num_format = isdec ? DecNoPrefixOrSuffix_NoLeadingZeros
+                               : ClassicHexPrefix_LeadingZeros_Uppercase;
+         }
       }
 
       pid = user_input;
@@ -335,41 +565,29 @@ int main( int argc, char * argv[] )
                            sizeof(uint8_t),
                            UInt8_Cmp ) != NULL) );
 
-      /* Determine format to print output in */
-      enum NumericFormat_E num_format = DetermineEntryFormat(id_arg, ishex, isdec);
       assert( (int)num_format < NUM_OF_NUMERIC_FORMATS );
-      //enum NumericFormat_E num_format = ClassicHexPrefix_LeadingZeros_Uppercase;
-      const char * print_format = NumericFormats[ (unsigned int)num_format ].print_format;
+      NumericFormatter_F format_number = NumericFormatters[ (unsigned int)num_format ];
 
       /* Print Output */
+      char out[MAX_OUTPUT_LEN];
+      size_t out_len = format_number( out, pid );
 
-#ifdef __GNUC__
-/* -Wformat-nonliteral suppression:
-* Specifically, the warning is:
-*
-* src/lin_pid.c:307:13: warning: format not a string literal, argument types not checked [-Wformat-nonliteral]
-*   307 |             printf(print_format, pid);
-*       |             ^~~~~~
-* 
-*
-* As long as nobody puts anything dumb or malicious in lin_pid_supported_formats.h for
-* the format string, we should be fine with this otherwise unsafe situation.
-*/
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wformat-nonliteral"
-#endif
       if ( (ArgOccurrenceCount((const char **)argv, "--quiet", argc, NULL) > 0) ||
            (ArgOccurrenceCount((const char **)argv, "-q", argc, NULL) > 0) )
       {
          if ( (ArgOccurrenceCount((const char **)argv, "--no-new-line", argc, NULL) == 0) )
          {
-            printf(print_format, pid);
-            printf("\n");
+            out[out_len++] = '\n';
          }
-         else
+#ifdef LIN_PID_FAST_START
+         // Scripts hammer this path, so skip stdio entirely: one write() call
+         if ( write(STDOUT_FILENO, out, out_len) != (ssize_t)out_len )
          {
-            printf(print_format, pid);
+            return EXIT_FAILURE;
          }
+#else
+         (void)fwrite( out, sizeof(char), out_len, stdout );
+#endif
       }
       else if ( (ArgOccurrenceCount((const char **)argv, "--no-new-line", argc, NULL) > 0) )
       {
@@ -378,18 +596,12 @@ int main( int argc, char * argv[] )
       }
       else
       {
-         printf( "\n%-5s\033[36m", "ID: " );
-         printf( print_format, user_input );
-         printf( "\033[0m\n" );
-         printf( "%-5s\033[32m", "PID:" );
-         printf( print_format, pid );
-         printf( "\033[0m\n" );
+         char id_out[MAX_OUTPUT_LEN];
+         size_t id_out_len = format_number( id_out, user_input );
+         printf( "\n%-5s\033[36m%.*s\033[0m\n", "ID: ", (int)id_out_len, id_out );
+         printf( "%-5s\033[32m%.*s\033[0m\n", "PID:", (int)out_len, out );
          printf("\n");
       }
-   
-#ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif
 
    }
 
@@ -432,6 +644,101 @@ uint8_t ComputePID(uint8_t id)
    return pid;
 }
 
+enum LIN_PID_Result_E ParseID(const char * str, bool ishex, bool isdec, uint8_t * id)
+{
+   assert( (str != NULL) && (id != NULL) && !(ishex && isdec) );
+
+   const struct IDSpelling_S * spelling = LookupIDSpelling(str, ishex, isdec);
+   if ( spelling != NULL )
+   {
+      *id = spelling->id;
+      return GoodResult;
+   }
+
+   uint8_t parsed = 0;
+   enum LIN_PID_Result_E result = GetID(str, &parsed, &ishex, &isdec);
+   if ( GoodResult != result )
+   {
+      return result;
+   }
+   if ( parsed > MAX_ID_ALLOWED )
+   {
+      return ID_OOR;
+   }
+
+   *id = parsed;
+   return GoodResult;
+}
+
+/*
+ * The delimiters are found eight bytes at a time, and a token of up to four
+ * bytes is already its key in lin_pid_id_spellings.h, so a valid ID costs a
+ * few 64-bit operations and one probe. Only the tokens the hash doesn't
+ * hold (errors, mostly) go through GetID().
+ */
+size_t ParseIDs( const char * data,
+                 size_t len,
+                 bool ishex,
+                 bool isdec,
+                 uint8_t * ids,
+                 enum LIN_PID_Result_E * results,
+                 size_t max_ids,
+                 size_t * consumed )
+{
+   assert( ((data != NULL) || (0 == len)) &&
+           (ids != NULL) && (results != NULL) && (consumed != NULL) &&
+           !(ishex && isdec) );
+
+   size_t num_ids = 0;
+   size_t pos = 0;
+   while ( num_ids < max_ids )
+   {
+      // Mostly a single delimiter between IDs, so try the next byte first
+      size_t start = pos;
+      if ( (start >= len) || CHAR_IS(data[start], CHAR_TOKEN_DELIM) )
+      {
+         start = NextTokenEdge( data, pos, len, false );
+      }
+
+      // A token shorter than a word ends in the word that starts it
+      size_t end;
+      uint64_t word = 0;
+      uint64_t delimiters = 0;
+      if ( (start + 8u) <= len )
+      {
+         word = LoadWord( data + start );
+         delimiters = TokenDelimiters(word);
+      }
+
+      if ( delimiters != 0u )
+      {
+         end = start + FirstMarkedByte(delimiters);
+      }
+      else
+      {
+         end = NextTokenEdge( data, start, len, true );
+         if ( end >= len )
+         {
+            pos = start; // Nothing, or a token that may not have ended yet
+            break;
+         }
+         word = LoadBytes( data + start, ((end - start) < 8u) ? (end - start) : 8u );
+      }
+
+      results[num_ids] = ParseIDToken( data + start, end - start, word, ishex, isdec, &ids[num_ids] );
+      num_ids++;
+      pos = end + 1;
+   }
+
+   *consumed = pos;
+   return num_ids;
+}
+
+uint8_t ReferencePID(uint8_t id)
+{
+   return ( id <= MAX_ID_ALLOWED ) ? REFERENCE_PID_TABLE[id] : INVALID_PID;
+}
+
 STATIC bool OnlyValidFlagsArePresent( char const * args[], int argc )
 {
    assert(args != NULL);
@@ -446,11 +753,7 @@ STATIC bool OnlyValidFlagsArePresent( char const * args[], int argc )
          only_valid = false;
          break;
       }
-      else if (
-           ( (args[i][0] >= '0') && (args[i][0] <= '9') ) ||  /* General Digits */
-           ( (tolower(args[i][0]) == 'x') && (tolower(args[i][0]) == 'h') ) || /* Hex prefixes*/
-           ( (tolower(args[i][0]) >= 'a')  && (tolower(args[i][0]) <= 'f') ) /* Unique Hex Digits */
-         )
+      else if ( CHAR_IS(args[i][0], CHAR_HEX_DIGIT | CHAR_HEX_PREFIX) )
       {
          continue;   // This is the number argument. Skip it.
       }
@@ -482,87 +785,54 @@ STATIC bool OnlyValidFlagsArePresent( char const * args[], int argc )
    return only_valid;
 }
 
+/**
+ * @brief Whether stdin is a pipe or a file rather than a terminal.
+ *
+ * Decided from what stdin is, not from whether anything is waiting on it:
+ * the writer at the other end of a pipe may not have written yet, and the
+ * IDs are read until EOF either way.
+ */
 STATIC bool InputIsPiped(void)
 {
 #ifdef _WIN32
-   // Windows way
-   size_t num_of_bytes_avail = 0;
-
    HANDLE h_stdin = GetStdHandle(STD_INPUT_HANDLE);
-   DWORD bytes_avail = 0;
-
-   assert( h_stdin != INVALID_HANDLE_VALUE );
-   bool pipe_check_went_thru =
-      PeekNamedPipe(
-         h_stdin,       // HANDLE hNamedPipe [in]
-         NULL,          // LPVOID lpBuffer [out, optional]
-         0,             // DWORD nBufferSize [in]
-         NULL,          // LPDWORD lpBytesRead [out, optional]
-         &bytes_avail,  // LPDWORD lpTotalBytesAvail [out, optional]
-         NULL           // LPDWORD lpBytesLeftThisMessage [out, optional]
-      );
-
-   num_of_bytes_avail = pipe_check_went_thru ? (size_t)bytes_avail : 0;
-   
-   return (num_of_bytes_avail > 0);
+   if ( (NULL == h_stdin) || (INVALID_HANDLE_VALUE == h_stdin) )
+   {
+      return false;
+   }
+
+   DWORD file_type = GetFileType(h_stdin);
+   return (FILE_TYPE_PIPE == file_type) || (FILE_TYPE_DISK == file_type);
 #else
-   // POSIX way
-   fd_set read_fds;  // Set of file descriptors
-   struct timeval tv;
-   bool data_avail = false;
-   
-   // Configure the set of file descriptors to be read to just be stdin
-   FD_ZERO(&read_fds);
-   FD_SET(0, &read_fds);   // 0 is the file-descriptor for stdin
-   // No waiting
-   tv.tv_sec = 0;
-   tv.tv_usec = 0;
-
-   data_avail = select(
-                  1,          // int nfds (number of file descriptors in set)
-                  &read_fds,  // fd_set * readfds
-                  NULL,       // fd_set * writefds
-                  NULL,       // fd_set * exceptfds
-                  &tv         // struct timeval * timeout
-               );
-
-   return data_avail;
+   struct stat st;
+   if ( fstat(STDIN_FILENO, &st) != 0 )
+   {
+      return false;
+   }
+
+   // Not /dev/null or a terminal, so a bare `lin_pid` from a script still gets help
+   return S_ISFIFO(st.st_mode) || S_ISREG(st.st_mode) || S_ISSOCK(st.st_mode);
 #endif
 }
 
-STATIC char * ReadNextStdInToken(void)
+/**
+ * @brief IDs come in on stdin when something's piped in and the command line
+ *        has only flags that go with them: no ID, --table or --help.
+ */
+static bool IDsArePiped( char const * args[], int argc )
 {
-   size_t str_cap = 8;
-   char * str = malloc(str_cap);  // NOTE: Remember to destroy after use!
-   if ( NULL == str ) return NULL;
-   char * ret_val = str;
-
-   size_t str_len = 0;
-   int c;
-   while( ( (c = fgetc(stdin)) != EOF ) &&
-          (c != ',') &&
-          (c != ' ') &&
-          (str_len < (str_cap - 2)) )
+   for ( int i = 1; i < argc; i++ )
    {
-      *(str++) = (char)c;
-      str_len++;
-
-      if ( str_len >= (str_cap - 2) )
+      if ( (args[i][0] != '-') ||
+           (strcmp(args[i], "--help") == 0) ||
+           (strcmp(args[i], "--table") == 0) ||
+           (strcmp(args[i], "-t") == 0) )
       {
-         char * tmp = realloc(ret_val, str_cap * 2);
-         if ( NULL == tmp )
-         {
-            free(ret_val);
-            return NULL;
-         }
-         ret_val = tmp;
-         str = tmp + str_len;
-         str_cap *= 2;
+         return false;
       }
    }
-   *str = '\0';
 
-   return ret_val;
+   return InputIsPiped();
 }
 
 STATIC size_t ArgOccurrenceCount( char const * args[],
@@ -611,6 +881,12 @@ STATIC size_t ArgOccurrenceCount( char const * args[],
 // Acceptable formats:
 // Hex:     0xZZ, Z, ZZ, ZZh, ZZH, ZZx, ZZX, xZZ, XZZ
 // Decimal: ZZd, ZZD
+//
+// This state machine has two copies: get_id() in lin_pid.hpp and get_id() in
+// scripts/gen_id_spellings.py. Change all three together.
+// test_parse_id_AgreesWithParseID (test_lin_pid_hpp.cpp) and
+// test_LookupIDSpelling_AgreesWithGetID_EveryShortToken (test_lin_pid.c)
+// fail when a copy drifts.
 STATIC enum LIN_PID_Result_E GetID( const char * str,
                                     uint8_t * id,
                                     bool * ishex,
@@ -631,7 +907,7 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
       /* x2 as max allowance of leading whitespace */
       (loop_limit_counter <= (MAX_NUM_LEN * 2)) &&
       (str[idx] != '\0') &&
-      (isblank( (int)str[idx] ))
+      CHAR_IS(str[idx], CHAR_BLANK)
    )
    {
       idx++;
@@ -698,9 +974,9 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
                first_digit = ch;
                parser_state = ParserOneZeroIn;
             }
-            else if ( isxdigit(ch) )
+            else if ( CHAR_IS(ch, CHAR_HEX_DIGIT) )
             {
-               if ( isdigit(ch) )
+               if ( CHAR_IS(ch, CHAR_DEC_DIGIT) )
                {
                   // Determined to be within hex range but also within dec range
                   // so, still indeterminate...
@@ -714,7 +990,7 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
                }
                first_digit = ch;
             }
-            else if ( ('x' == ch) || ('X' == ch) )
+            else if ( CHAR_IS(ch, CHAR_HEX_PREFIX) )
             {
                assume_hex = true;
                hex_prefix_already_encountered = true;
@@ -733,15 +1009,15 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
                second_digit = ch;
                parser_state = ParserTwoZerosIn;
             }
-            else if ( ('x' == ch) || ('X' == ch) )
+            else if ( CHAR_IS(ch, CHAR_HEX_PREFIX) )
             {
                assume_hex = true;
                hex_prefix_already_encountered = true;
                parser_state = ParserHexPrefix;
             }
-            else if ( isxdigit(ch) )
+            else if ( CHAR_IS(ch, CHAR_HEX_DIGIT) )
             {
-               if ( !isdigit(ch) )
+               if ( !CHAR_IS(ch, CHAR_DEC_DIGIT) )
                {
                   // Must be a uniquely hex digit
                   // NOTE: The 'd' suffix would also lead to this line,
@@ -757,7 +1033,7 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
                }
                first_digit = ch;
             }
-            else if ( ('h' == ch) || ('H' == ch) )
+            else if ( CHAR_IS(ch, CHAR_HEX_SUFFIX) )
             {
                assume_hex = true;
                parser_state = ParserTwoDigitsAlreadyRead;
@@ -770,7 +1046,7 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
             break;
 
          case ParserHexPrefix:
-            if ( isxdigit(ch) )
+            if ( CHAR_IS(ch, CHAR_HEX_DIGIT) )
             {
                first_digit = ch;
                parser_state = ParserHexDigits;
@@ -783,9 +1059,9 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
             break;
 
          case ParserIndeterminateOneDigitIn:
-            if ( isxdigit(ch) )
+            if ( CHAR_IS(ch, CHAR_HEX_DIGIT) )
             {
-               if ( isdigit(ch) )
+               if ( CHAR_IS(ch, CHAR_DEC_DIGIT) )
                {
                   parser_state = ParserIndeterminateTwoDigitsIn;
                }
@@ -796,8 +1072,7 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
                }
                second_digit = ch;
             }
-            else if ( ('x' == ch) || ('X' == ch) ||
-                      ('h' == ch) || ('H' == ch) )
+            else if ( CHAR_IS(ch, CHAR_HEX_SUFFIX) )
             {
                assume_hex = true;
                parser_state = ParserTwoDigitsAlreadyRead;
@@ -810,12 +1085,14 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
             break;
          
          case ParserIndeterminateTwoDigitsIn:
-            if ( ('x' == ch) || ('X' == ch) || ('h' == ch) || ('H' == ch) )
+            // Reachable under --hex too (by way of a leading 0), so a 'd'
+            // suffix mustn't make it both
+            if ( !assume_dec && CHAR_IS(ch, CHAR_HEX_SUFFIX) )
             {
                assume_hex = true;
                parser_state = ParserTwoDigitsAlreadyRead;
             }
-            else if ( ('d' == ch) || ('D' == ch) )
+            else if ( !assume_hex && CHAR_IS(ch, CHAR_DEC_SUFFIX) )
             {
                assume_dec = true;
                parser_state = ParserTwoDigitsAlreadyRead;
@@ -828,7 +1105,7 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
             break;
 
          case ParserOneDecDigit:
-            if ( isdigit(ch) )
+            if ( CHAR_IS(ch, CHAR_DEC_DIGIT) )
             {
                second_digit = ch;
                parser_state = ParserTwoDecDigits;
@@ -842,7 +1119,7 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
 
          case ParserTwoDecDigits:
             // Two decimal digits will have already been read in...
-            if ( ('d' == ch) || ('D' == ch) )
+            if ( CHAR_IS(ch, CHAR_DEC_SUFFIX) )
             {
                parser_state = ParserTwoDigitsAlreadyRead;
             }
@@ -854,13 +1131,12 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
             break;
          
          case ParserHexDigits:
-            if ( isxdigit(ch) )
+            if ( CHAR_IS(ch, CHAR_HEX_DIGIT) )
             {
                second_digit = ch;
                parser_state = ParserTwoHexDigits;
             }
-            else if ( ('x' == ch) || ('X' == ch) ||
-                      ('h' == ch) || ('H' == ch) )
+            else if ( CHAR_IS(ch, CHAR_HEX_SUFFIX) )
             {
                if ( hex_prefix_already_encountered )
                {
@@ -882,8 +1158,12 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
 
          case ParserTwoHexDigits:
             // Two hex digits will have already been read in...
-            if ( ('x' == ch) || ('X' == ch) ||
-                 ('h' == ch) || ('H' == ch) )
+            if ( CHAR_IS(ch, CHAR_HEX_SUFFIX) && hex_prefix_already_encountered )
+            {
+               result = HexPrefixAndSuffixEncountered;
+               exit_loop = true;
+            }
+            else if ( CHAR_IS(ch, CHAR_HEX_SUFFIX) )
             {
                parser_state = ParserTwoDigitsAlreadyRead;
             }
@@ -895,14 +1175,12 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
             break;
 
          case ParserTwoZerosIn:
-            if ( !assume_dec &&
-                     ( ('x' == ch) || ('X' == ch) || ('h' == ch) || ('H' == ch) ) )
+            if ( !assume_dec && CHAR_IS(ch, CHAR_HEX_SUFFIX) )
             {
                assume_hex = true;
                parser_state = ParserTwoDigitsAlreadyRead;
             }
-            else if ( !assume_hex &&
-                     ( ('d' == ch) || ('D' == ch) ) )
+            else if ( !assume_hex && CHAR_IS(ch, CHAR_DEC_SUFFIX) )
             {
                assume_dec = true;
                parser_state = ParserTwoDigitsAlreadyRead;
@@ -920,16 +1198,17 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
             break;
 
          case ParserPreemptivelyHex:
-            if ( ('x' == ch) || ('X' == ch) )
+            if ( CHAR_IS(ch, CHAR_HEX_PREFIX) )
             {
                hex_prefix_already_encountered = true;
                parser_state = ParserHexPrefix;
             }
             else if ( '0' == ch )
             {
+               first_digit = ch;
                parser_state = ParserOneZeroIn;
             }
-            else if ( isxdigit(ch) )
+            else if ( CHAR_IS(ch, CHAR_HEX_DIGIT) )
             {
                first_digit = ch;
                parser_state = ParserHexDigits;
@@ -942,7 +1221,7 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
             break;
 
          case ParserPreemptivelyDec:
-            if ( ('x' == ch) || ('X' == ch) || (isxdigit(ch) && !isdigit(ch)) )
+            if ( CHAR_IS(ch, CHAR_HEX_PREFIX) || (CHAR_IS(ch, CHAR_HEX_DIGIT) && !CHAR_IS(ch, CHAR_DEC_DIGIT)) )
             {
                result = HexDigitEncounteredUnderDecSetting_FirstDigit;
                exit_loop = true;
@@ -952,7 +1231,7 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
                first_digit = ch;
                parser_state = ParserPreemptivelyDecOneZeroIn;
             }
-            else if ( isdigit(ch) )
+            else if ( CHAR_IS(ch, CHAR_DEC_DIGIT) )
             {
                first_digit = ch;
                parser_state = ParserOneDecDigit;
@@ -965,7 +1244,7 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
             break;
 
          case ParserPreemptivelyDecOneZeroIn:
-            if ( ('x' == ch) || ('X' == ch) || (isxdigit(ch) && !isdigit(ch)) )
+            if ( CHAR_IS(ch, CHAR_HEX_PREFIX) || (CHAR_IS(ch, CHAR_HEX_DIGIT) && !CHAR_IS(ch, CHAR_DEC_DIGIT)) )
             {
                result = HexDigitEncounteredUnderDecSetting_SecondDigit;
                exit_loop = true;
@@ -974,7 +1253,7 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
             {
                parser_state = ParserPreemptivelyDecTwoZerosIn;
             }
-            else if ( isdigit(ch) )
+            else if ( CHAR_IS(ch, CHAR_DEC_DIGIT) )
             {
                first_digit = ch;
                parser_state = ParserTwoDecDigits;
@@ -987,7 +1266,7 @@ STATIC enum LIN_PID_Result_E GetID( const char * str,
             break;
 
          case ParserPreemptivelyDecTwoZerosIn:
-            if ( ('d' == ch) || ('D' == ch) )
+            if ( CHAR_IS(ch, CHAR_DEC_SUFFIX) )
             {
                parser_state = ParserTwoDigitsAlreadyRead;
             }
@@ -1097,28 +1376,11 @@ STATIC bool MyAtoI(char digit, uint8_t * converted_digit)
 
    bool ret_val = false;
 
-   // Check input validity
-   if (
-          ( (digit >= '0') && (digit <= '9') ) ||
-          ( (digit >= 'A') && (digit <= 'F') ) ||
-          ( (digit >= 'a') && (digit <= 'f') )
-      )
+   // The table carries each hex digit's value, in either case
+   if ( CHAR_IS(digit, CHAR_HEX_DIGIT) )
    {
-      if ( (digit >= '0') && (digit <= '9') )
-      {
-         *converted_digit = (uint8_t)(digit - '0');
-         ret_val = true;
-      }
-      else if ( (digit >= 'A') && (digit <= 'F') )
-      {
-         *converted_digit = (uint8_t)( 10 + (digit - 'A') );
-         ret_val = true;
-      }
-      else
-      {
-         *converted_digit = (uint8_t)( 10 + (digit - 'a') );
-         ret_val = true;
-      }
+      *converted_digit = CHAR_DIGIT_VALUE(digit);
+      ret_val = true;
    }
 
    return ret_val;
@@ -1135,6 +1397,27 @@ static void PrintHelpMsg(void)
       "\033[0m\033[36;1mlin_pid\033[0m \033[35m[FORMAT]\033[0m \033[34;1m<hex or dec num>\033[0m \033[35m(--quiet | -q)\033[0m \033[0m \033[35m[--no-new-line]\033[0m \033[;3msame as above but quieter and not colored.\033[0m\n"
       "\033[0m\033[36;1mlin_pid\033[0m \033[35m[--help]\033[0m \033[;3mto print the help message.\033[0m\n"
       "\033[0m\033[36;1mlin_pid\033[0m \033[35m(--table | -t)\033[0m \033[;3mto print a full LIN ID vs PID table for reference.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--ldf\033[0m \033[34;1m<file>\033[0m \033[35m[--frame <name>] [--quiet | -q]\033[0m \033[;3mto get the ID/PID of one or every frame in an LDF.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--schedule\033[0m \033[34;1m<file>\033[0m \033[35m[--table <name>] [--baud <bps>] [--quiet | -q]\033[0m \033[;3mfor slot timings, bus utilization, and headroom of an LDF's schedule tables.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--schedule\033[0m \033[34;1m<file>\033[0m \033[35m--sweep <from>:<to>:<step> [--threads <n>] [--quiet | -q]\033[0m \033[;3mto try every schedule table across a range of baud rates.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--log\033[0m \033[34;1m<file | ->\033[0m \033[35m[--format csv | asc] [--classic] [--threads <n>] [--summary] [--quiet | -q]\033[0m \033[;3mto check every frame's PID and checksum in a CSV or ASC bus log.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--follow\033[0m \033[34;1m<file>\033[0m \033[35m[--format csv | asc] [--classic] [--summary] [--quiet | -q]\033[0m \033[;3mto keep checking a log as it's written, until Ctrl+C.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--convert\033[0m \033[34;1m<log | -> <capture>\033[0m \033[35m[--format csv | asc] [--classic] [--threads <n>] [--block-frames <n>] [--quiet | -q]\033[0m \033[;3mto turn a bus log into an indexed binary capture.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--dump\033[0m \033[34;1m<capture>\033[0m \033[35m[--frame <n> | --from <seconds>] [--to <seconds>] [--count <n>] [--quiet | -q]\033[0m \033[;3mto print a capture's frames as a CSV log, starting anywhere.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--query\033[0m \033[34;1mid=<ID> <capture>\033[0m \033[35m[--from <seconds>] [--to <seconds>] [--count <n>] [--index] [--quiet | -q]\033[0m \033[;3mto print only the frames with one ID, via the capture's per-ID index (--index adds one to a capture without).\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--merge\033[0m \033[34;1m<capture>...\033[0m \033[35m[--out <capture>] [--retag] [--block-frames <n>] [--quiet | -q]\033[0m \033[;3mto interleave captures of several channels into one stream in time order.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--stats-by-id\033[0m \033[34;1m<capture>...\033[0m \033[35m[--threads <n>] [--quiet | -q]\033[0m \033[;3mfor each ID's period, jitter, and error counts across captures.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--tp\033[0m \033[34;1m<capture>\033[0m \033[35m[--timeout <ms>] [--index] [--quiet | -q]\033[0m \033[;3mto reassemble the diagnostic requests and responses on 0x3C/0x3D.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--samples\033[0m \033[34;1m<dump>\033[0m \033[35m--rate <Hz> [--baud <bps>] [--classic] [--out <capture>] [--quiet | -q]\033[0m \033[;3mto recover frames from a logic-analyzer dump of the bus, detecting the baud rate unless it's given.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--node\033[0m \033[34;1m<ldf>\033[0m \033[35m--master [--table <name>] [--cycles <n>] [--port <tty>] [--classic] [--quiet | -q]\033[0m \033[;3mto run the LDF's schedule as bus master on a new pty (or tty), with response latency percentiles (SIGUSR1 for them so far).\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--node\033[0m \033[34;1m<ldf>\033[0m \033[35m--slave <node> [--port <tty>] [--classic] [--quiet | -q]\033[0m \033[;3mto answer every frame an LDF node publishes, with its signals' init values.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m--capture\033[0m \033[34;1m<tty>...\033[0m \033[35m[--baud <bps>] [--classic] [--out <capture>...] [--quiet | -q]\033[0m \033[;3mto decode frames from several serial LIN interfaces (or ptys) at once, until Ctrl+C.\033[0m\n"
+      "\033[0m\033[36;1mlin_pid\033[0m \033[35m(--emit-c | --emit-cpp)\033[0m \033[35m[--layout table | parity | mask] [--prefix <name>] [--out <header>]\033[0m \033[;3mto generate a firmware header with the PID lookup and a checksum helper.\033[0m\n"
+   );
+
+   // Split in two to stay under the string length C99 compilers must support
+   fprintf(stdout,
+      "\033[0m\033[34;1m...\033[0m | \033[36;1mlin_pid\033[0m \033[35m[FORMAT] [--quiet | -q]\033[0m \033[;3mfor the PID of every ID piped in (separated by whitespace, ',' or NUL), one per line.\033[0m\n"
 
       "\n\033[;3mNote that deviations from the above usage will result in an\033[0m \033[31;3merror message\033[0m.\n"
 
@@ -1190,51 +1473,2866 @@ static void PrintErrMsg(enum LIN_PID_Result_E err)
    fprintf(stderr, "%.*s", MAX_ERR_MSG_LEN, ErrorMsgs[err]);
 }
 
-#ifndef NDEBUG
-
-STATIC int UInt8_Cmp( const void * a, const void * b )
-{
-   assert( (a != NULL) && (b != NULL) );
-
-   uint8_t * c = (uint8_t *)a;
-   uint8_t * d = (uint8_t *)b;
-
-   return ( *c - *d );
-}
-
-#endif
-
 /**
- * @brief Determines the numeric format of the given string entry.
+ * @brief ... | lin_pid [FORMAT] [--quiet | -q]
  *
- * This function analyzes the input string and identifies its numeric format,
- * based on a list of supported formats.
- * 
- * @note str is assumed to be a valid ID entry! Do not call this function before
- *       passing the string through GetID.
+ * The PID of every ID on stdin, one line per ID in the order they came, e.g.,
+ * from cat ids.txt. IDs are separated by whitespace, ',' or NUL, and each is
+ * read as the single-ID command line would read it with the same FORMAT.
+ * A bad ID gets its error on stderr (prefixed with its position) and the
+ * rest carry on. Output is in one format throughout (0x3F, or 63 with
+ * --dec). Any other flag, --no-new-line included, is an invalid flag here.
  *
- * @param str Pointer to the null-terminated string to be analyzed.
- * @return NumericFormat_E enunm indicating the detected format.
+ * stdin is read a chunk at a time and parsed by ParseIDs() in batches, with
+ * each batch's lines written out in one go.
  */
-STATIC enum NumericFormat_E DetermineEntryFormat( const char * str,
-                                                  bool ishex,
-                                                  bool isdec )
+static int PipedMode( int argc, char * argv[] )
 {
-   assert( (str != NULL) && (str[0] != '\0') );
-
-   // Let's try this /w regex, just for fun.
-   for ( int i = 0; i < NUM_OF_NUMERIC_FORMATS; i++ )
+   static char in[PIPED_CHUNK_LEN + 1];
+   static char out[PIPED_BATCH_IDS * PIPED_LINE_MAX_LEN];
+   static uint8_t ids[PIPED_BATCH_IDS];
+   static enum LIN_PID_Result_E results[PIPED_BATCH_IDS];
+
+   bool quiet = false;
+   bool ishex = false;
+   bool isdec = false;
+   for ( int i = 1; i < argc; i++ )
    {
-      if ( (ishex && NumericFormats[i].isdec) || (isdec && NumericFormats[i].ishex) )
+      bool * flag = NULL;
+      if ( (strcmp("--hex", argv[i]) == 0) || (strcmp("-h", argv[i]) == 0) )
       {
-         continue;
+         flag = &ishex;
       }
-      int match_len; // don't care about this but tiny-regex-c expects it
-      if ( re_match( NumericFormats[i].regex_pattern, str, &match_len) != -1 )
+      else if ( (strcmp("--dec", argv[i]) == 0) || (strcmp("-d", argv[i]) == 0) )
       {
-         return (enum NumericFormat_E)i;
+         flag = &isdec;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidFlagDetected);
+         return EXIT_FAILURE;
+      }
+
+      if ( flag != NULL )
+      {
+         if ( *flag )
+         {
+            PrintErrMsg(DuplicateFormatFlagsUsed);
+            return EXIT_FAILURE;
+         }
+         *flag = true;
       }
    }
 
-   return INVALID_NUMERIC_FORMAT;
-}
+   if ( ishex && isdec )
+   {
+      PrintErrMsg(HexAndDecFlagsSimultaneouslyUsed);
+      return EXIT_FAILURE;
+   }
+
+   NumericFormatter_F format_number =
+      NumericFormatters[ isdec ? DecNoPrefixOrSuffix_NoLeadingZeros
+                               : ClassicHexPrefix_LeadingZeros_Uppercase ];
+
+   bool all_good = true;
+   bool at_end = false;
+   bool skipping = false;  // Through the rest of a token longer than a chunk
+   size_t len = 0;
+   size_t num_parsed = 0;
+   while ( !at_end )
+   {
+      size_t num_read = fread( in + len, sizeof(char), PIPED_CHUNK_LEN - len, stdin );
+      at_end = ( num_read < (PIPED_CHUNK_LEN - len) );
+
+      if ( skipping )
+      {
+         // GetID() has what it needs of the token already; drop up to its end
+         size_t end = len;
+         while ( (end < (len + num_read)) && !CHAR_IS(in[end], CHAR_TOKEN_DELIM) )
+         {
+            end++;
+         }
+         skipping = ( end == (len + num_read) );
+         memmove( in + len, in + end, (len + num_read) - end );
+         num_read -= end - len;
+      }
+      len += num_read;
+
+      if ( at_end )
+      {
+         in[len++] = '\n';  // So the last ID counts even without one
+      }
+
+      size_t pos = 0;
+      size_t num_ids;
+      do
+      {
+         size_t consumed;
+         num_ids = ParseIDs( in + pos, len - pos, ishex, isdec,
+                             ids, results, PIPED_BATCH_IDS, &consumed );
+         pos += consumed;
+
+         size_t out_len = 0;
+         for ( size_t i = 0; i < num_ids; i++ )
+         {
+            num_parsed++;
+            if ( results[i] != GoodResult )
+            {
+               (void)fwrite( out, sizeof(char), out_len, stdout );
+               out_len = 0;
+               (void)fflush(stdout);
+               fprintf(stderr, "\nID #%zu:", num_parsed);
+               PrintErrMsg(results[i]);
+               all_good = false;
+               continue;
+            }
+
+            // Formatted straight into out: snprintf() would cost more than the rest
+            if ( !quiet )
+            {
+               memcpy( out + out_len, PIPED_ID_COLOR, strlen(PIPED_ID_COLOR) );
+               out_len += strlen(PIPED_ID_COLOR);
+               size_t id_len = format_number( out + out_len, ids[i] );
+               for ( ; id_len < PIPED_ID_WIDTH; id_len++ )
+               {
+                  out[out_len + id_len] = ' ';
+               }
+               out_len += id_len;
+               memcpy( out + out_len, PIPED_PID_COLOR, strlen(PIPED_PID_COLOR) );
+               out_len += strlen(PIPED_PID_COLOR);
+            }
+
+            out_len += format_number( out + out_len, ComputePID(ids[i]) );
+
+            if ( !quiet )
+            {
+               memcpy( out + out_len, PIPED_NO_COLOR, strlen(PIPED_NO_COLOR) );
+               out_len += strlen(PIPED_NO_COLOR);
+            }
+            out[out_len++] = '\n';
+         }
+         (void)fwrite( out, sizeof(char), out_len, stdout );
+      } while ( PIPED_BATCH_IDS == num_ids );
+
+      // Carry the token cut off at the end of the chunk over to the next
+      len -= pos;
+      memmove( in, in + pos, len );
+      if ( PIPED_CHUNK_LEN == len )
+      {
+         len = ID_TOKEN_PREFIX_LEN;
+         skipping = true;
+      }
+   }
+
+   if ( ferror(stdin) )
+   {
+      all_good = false;
+   }
+
+   return all_good ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief lin_pid --ldf <file> [--frame <name>] [--quiet | -q]
+ *
+ * With --frame, prints that frame's ID and PID (just the PID when quiet).
+ * Without it, prints every frame in the LDF in ID order (one
+ * "<name> <ID> <PID>" line per frame when quiet).
+ */
+static int LDFMode( int argc, char * argv[] )
+{
+   const char * path = NULL;
+   const char * frame_name = NULL;
+   bool quiet = false;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp("--ldf", argv[i]) == 0) && ((i + 1) < argc) && (NULL == path) )
+      {
+         path = argv[++i];
+      }
+      else if ( (strcmp("--frame", argv[i]) == 0) && ((i + 1) < argc) && (NULL == frame_name) )
+      {
+         frame_name = argv[++i];
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidLDFUsage);
+         return EXIT_FAILURE;
+      }
+   }
+
+   if ( NULL == path )
+   {
+      PrintErrMsg(InvalidLDFUsage);
+      return EXIT_FAILURE;
+   }
+
+   struct LDF_Database_S db;
+   if ( !LoadLDFForCLI(path, &db) )
+   {
+      return EXIT_FAILURE;
+   }
+
+   int exit_status = EXIT_SUCCESS;
+   if ( frame_name != NULL )
+   {
+      const struct LDF_Frame_S * frame = LDF_FrameByName(&db, frame_name);
+      if ( NULL == frame )
+      {
+         PrintErrMsg(LDFFrameNotFound);
+         exit_status = EXIT_FAILURE;
+      }
+      else if ( quiet )
+      {
+         fprintf(stdout, "0x%02X\n", (unsigned int)frame->pid);
+      }
+      else
+      {
+         fprintf(stdout, "\n%-7s%s\n", "Frame:", frame->name);
+         fprintf(stdout, "%-7s\033[36m0x%02X\033[0m\n", "ID:", (unsigned int)frame->id);
+         fprintf(stdout, "%-7s\033[32m0x%02X\033[0m\n\n", "PID:", (unsigned int)frame->pid);
+      }
+   }
+   else
+   {
+      if ( !quiet )
+      {
+         fprintf(stdout, "\n%-32s %-6s %-6s %-4s %s\n", "Frame", "ID", "PID", "Len", "Publisher");
+         fprintf(stdout, "--------------------------------------------------------------------\n");
+      }
+      for ( uint8_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+      {
+         const struct LDF_Frame_S * frame = LDF_FrameByID(&db, id);
+         if ( frame != NULL )
+         {
+            PrintLDFFrame(&db, frame, quiet);
+         }
+      }
+      if ( !quiet )
+      {
+         fprintf(stdout, "\n");
+      }
+   }
+
+   LDF_Free(&db);
+   return exit_status;
+}
+
+static void PrintLDFFrame( const struct LDF_Database_S * db,
+                           const struct LDF_Frame_S * frame,
+                           bool quiet )
+{
+   assert( (db != NULL) && (frame != NULL) );
+
+   if ( quiet )
+   {
+      fprintf(stdout, "%s 0x%02X 0x%02X\n", frame->name, (unsigned int)frame->id, (unsigned int)frame->pid);
+      return;
+   }
+
+   const char * publisher = ( frame->publisher != LDF_NO_INDEX ) ? db->nodes[frame->publisher].name : "-";
+   fprintf(stdout, "%-32s \033[36m0x%02X\033[0m   \033[32m0x%02X\033[0m   %-4u %s\n",
+           frame->name,
+           (unsigned int)frame->id,
+           (unsigned int)frame->pid,
+           (unsigned int)frame->length,
+           publisher);
+}
+
+/**
+ * @brief lin_pid --schedule <file> [--table <name>] [--baud <bps>] [--quiet | -q]
+ *        lin_pid --schedule <file> --sweep <from>:<to>:<step> [--threads <n>] [--quiet | -q]
+ *
+ * With --table, prints every slot of that schedule table: when it starts, its
+ * nominal and worst-case (TFrame_Max) frame times, and the headroom left.
+ * Without it, prints one summary line per schedule table. --baud overrides
+ * the LDF's LIN_speed.
+ *
+ * --sweep simulates every schedule table at every baud rate in the range,
+ * spread across all cores (or --threads of them), one summary line each.
+ */
+static int ScheduleMode( int argc, char * argv[] )
+{
+   const char * path = NULL;
+   const char * table_name = NULL;
+   const char * sweep = NULL;
+   uint32_t baud_rate = 0;
+   uint32_t num_threads = 0;
+   bool quiet = false;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp("--schedule", argv[i]) == 0) && ((i + 1) < argc) && (NULL == path) )
+      {
+         path = argv[++i];
+      }
+      else if ( (strcmp("--table", argv[i]) == 0) && ((i + 1) < argc) && (NULL == table_name) )
+      {
+         table_name = argv[++i];
+      }
+      else if ( (strcmp("--baud", argv[i]) == 0) && ((i + 1) < argc) && (0 == baud_rate) &&
+                ParseUInt32Arg(argv[i + 1], &baud_rate) && (baud_rate > 0) )
+      {
+         i++;
+      }
+      else if ( (strcmp("--sweep", argv[i]) == 0) && ((i + 1) < argc) && (NULL == sweep) )
+      {
+         sweep = argv[++i];
+      }
+      else if ( (strcmp("--threads", argv[i]) == 0) && ((i + 1) < argc) && (0 == num_threads) &&
+                ParseUInt32Arg(argv[i + 1], &num_threads) && (num_threads > 0) )
+      {
+         i++;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidScheduleUsage);
+         return EXIT_FAILURE;
+      }
+   }
+
+   // --sweep picks its own baud rates, and --threads only means something with it
+   uint32_t sweep_from = 0;
+   uint32_t sweep_to = 0;
+   uint32_t sweep_step = 0;
+   if ( sweep != NULL )
+   {
+      char from_str[11] = { 0 };
+      char to_str[11] = { 0 };
+      char step_str[11] = { 0 };
+      char extra = '\0';
+      if ( (table_name != NULL) || (baud_rate != 0) ||
+           (sscanf(sweep, "%10[0-9]:%10[0-9]:%10[0-9]%c", from_str, to_str, step_str, &extra) != 3) ||
+           !ParseUInt32Arg(from_str, &sweep_from) || !ParseUInt32Arg(to_str, &sweep_to) ||
+           !ParseUInt32Arg(step_str, &sweep_step) ||
+           (0 == sweep_from) || (sweep_from > sweep_to) || (0 == sweep_step) )
+      {
+         PrintErrMsg(InvalidScheduleUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   if ( (NULL == path) || ((num_threads != 0) && (NULL == sweep)) )
+   {
+      PrintErrMsg(InvalidScheduleUsage);
+      return EXIT_FAILURE;
+   }
+
+   struct LDF_Database_S db;
+   if ( !LoadLDFForCLI(path, &db) )
+   {
+      return EXIT_FAILURE;
+   }
+
+   if ( 0 == baud_rate )
+   {
+      baud_rate = db.baud_rate;
+   }
+   if ( (NULL == sweep) && (0 == baud_rate) )
+   {
+      PrintErrMsg(NoBaudRate);
+      LDF_Free(&db);
+      return EXIT_FAILURE;
+   }
+
+   // Every table's slots are worked out once, up front
+   struct Sched_Slot_S ** slots = calloc( db.num_schedule_tables + 1u, sizeof(*slots) );
+   size_t * num_slots = calloc( db.num_schedule_tables + 1u, sizeof(*num_slots) );
+   enum LIN_PID_Result_E result = ( (NULL == slots) || (NULL == num_slots) ) ? OutOfMemory : GoodResult;
+   for ( size_t t = 0; (GoodResult == result) && (t < db.num_schedule_tables); t++ )
+   {
+      result = Sched_SlotsFromLDF(&db, t, &slots[t], &num_slots[t]);
+   }
+
+   size_t table_idx = db.num_schedule_tables;
+   if ( (GoodResult == result) && (table_name != NULL) )
+   {
+      for ( size_t t = 0; t < db.num_schedule_tables; t++ )
+      {
+         if ( strcmp(db.schedule_tables[t].name, table_name) == 0 )
+         {
+            table_idx = t;
+         }
+      }
+      if ( table_idx == db.num_schedule_tables )
+      {
+         result = ScheduleTableNotFound;
+      }
+   }
+
+   if ( GoodResult == result )
+   {
+      if ( sweep != NULL )
+      {
+         size_t num_bauds = ((size_t)(sweep_to - sweep_from) / sweep_step) + 1u;
+         size_t num_candidates = num_bauds * db.num_schedule_tables;
+         struct Sched_Candidate_S * candidates = calloc( num_candidates + 1u, sizeof(*candidates) );
+         struct Sched_Summary_S * summaries = calloc( num_candidates + 1u, sizeof(*summaries) );
+         if ( (NULL == candidates) || (NULL == summaries) )
+         {
+            result = OutOfMemory;
+         }
+         else
+         {
+            for ( size_t t = 0; t < db.num_schedule_tables; t++ )
+            {
+               for ( size_t b = 0; b < num_bauds; b++ )
+               {
+                  struct Sched_Candidate_S * candidate = &candidates[(t * num_bauds) + b];
+                  candidate->slots = slots[t];
+                  candidate->num_slots = num_slots[t];
+                  candidate->baud_rate = sweep_from + (uint32_t)(b * sweep_step);
+               }
+            }
+
+            Sched_Sweep(candidates, num_candidates, summaries, num_threads);
+
+            if ( !quiet )
+            {
+               fprintf(stdout, "\n%-32s %-6s %-8s %-10s %-8s %-11s %-13s %s\n",
+                       "Schedule Table", "Slots", "Baud", "Cycle(ms)", "Util(%)", "MaxUtil(%)", "Headroom(ms)", "Overruns");
+               fprintf(stdout, "-----------------------------------------------------------------------------------------------------\n");
+            }
+            for ( size_t c = 0; c < num_candidates; c++ )
+            {
+               PrintScheduleSummary(db.schedule_tables[c / num_bauds].name, candidates[c].num_slots, &summaries[c], quiet);
+            }
+            if ( !quiet )
+            {
+               fprintf(stdout, "\n");
+            }
+         }
+         free(candidates);
+         free(summaries);
+      }
+      else if ( table_name != NULL )
+      {
+         struct Sched_SlotTiming_S * timings = calloc( num_slots[table_idx] + 1u, sizeof(*timings) );
+         if ( NULL == timings )
+         {
+            result = OutOfMemory;
+         }
+         else
+         {
+            struct Sched_Summary_S summary;
+            Sched_Simulate(slots[table_idx], num_slots[table_idx], baud_rate, timings, &summary);
+            PrintScheduleSlots(&db, &db.schedule_tables[table_idx], timings, &summary, quiet);
+         }
+         free(timings);
+      }
+      else
+      {
+         if ( !quiet )
+         {
+            fprintf(stdout, "\n%-32s %-6s %-8s %-10s %-8s %-11s %-13s %s\n",
+                    "Schedule Table", "Slots", "Baud", "Cycle(ms)", "Util(%)", "MaxUtil(%)", "Headroom(ms)", "Overruns");
+            fprintf(stdout, "-----------------------------------------------------------------------------------------------------\n");
+         }
+         for ( size_t t = 0; t < db.num_schedule_tables; t++ )
+         {
+            struct Sched_Summary_S summary;
+            Sched_Simulate(slots[t], num_slots[t], baud_rate, NULL, &summary);
+            PrintScheduleSummary(db.schedule_tables[t].name, num_slots[t], &summary, quiet);
+         }
+         if ( !quiet )
+         {
+            fprintf(stdout, "\n");
+         }
+      }
+   }
+
+   if ( result != GoodResult )
+   {
+      PrintErrMsg(result);
+   }
+
+   for ( size_t t = 0; (slots != NULL) && (t < db.num_schedule_tables); t++ )
+   {
+      free(slots[t]);
+   }
+   free(slots);
+   free(num_slots);
+   LDF_Free(&db);
+
+   return ( GoodResult == result ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief Load an LDF for one of the CLI modes, reporting any error (and the
+ *        line it was on) to stderr.
+ */
+static bool LoadLDFForCLI( const char * path, struct LDF_Database_S * db )
+{
+   assert( (path != NULL) && (db != NULL) );
+
+   enum LIN_PID_Result_E result = LDF_Load(path, db);
+   if ( result != GoodResult )
+   {
+      PrintErrMsg(result);
+      if ( db->error_line > 0 )
+      {
+         fprintf(stderr, "%s:%zu\n\n", path, db->error_line);
+      }
+      return false;
+   }
+
+   return true;
+}
+
+/**
+ * @brief Parse a whole argument as an unsigned decimal number.
+ */
+static bool ParseUInt32Arg( const char * str, uint32_t * value )
+{
+   assert( (str != NULL) && (value != NULL) );
+
+   uint64_t acc = 0;
+   if ( !ParseUInt64Arg(str, &acc) || (acc > UINT32_MAX) )
+   {
+      return false;
+   }
+
+   *value = (uint32_t)acc;
+   return true;
+}
+
+static bool ParseUInt64Arg( const char * str, uint64_t * value )
+{
+   assert( (str != NULL) && (value != NULL) );
+
+   uint64_t acc = 0;
+   if ( '\0' == *str )
+   {
+      return false;
+   }
+   for ( ; *str != '\0'; str++ )
+   {
+      if ( !CHAR_IS(*str, CHAR_DEC_DIGIT) || (acc > ((UINT64_MAX - 9u) / 10u)) )
+      {
+         return false;
+      }
+      acc = (acc * 10u) + CHAR_DIGIT_VALUE(*str);
+   }
+
+   *value = acc;
+   return true;
+}
+
+/**
+ * @brief Parse a whole argument as seconds (e.g. 12.5) into microseconds.
+ */
+static bool ParseSecondsArg( const char * str, uint64_t * timestamp_us )
+{
+   assert( (str != NULL) && (timestamp_us != NULL) );
+
+   double seconds = 0.0;
+   if ( !LOG_ParseTimestamp(str, str + strlen(str), &seconds) )
+   {
+      return false;
+   }
+
+   *timestamp_us = CAP_SecondsToUs(seconds);
+   return true;
+}
+
+static void PrintScheduleSlots( const struct LDF_Database_S * db,
+                                const struct LDF_ScheduleTable_S * table,
+                                const struct Sched_SlotTiming_S * timings,
+                                const struct Sched_Summary_S * summary,
+                                bool quiet )
+{
+   assert( (db != NULL) && (table != NULL) && (summary != NULL) );
+   assert( (timings != NULL) || (0 == table->num_entries) );
+
+   if ( !quiet )
+   {
+      fprintf(stdout, "\n%s @ %u bit/s\n\n", table->name, (unsigned int)summary->baud_rate);
+      fprintf(stdout, "%-4s %-32s %-6s %-6s %-4s %-10s %-10s %-12s %-12s %s\n",
+              "Slot", "Frame", "ID", "PID", "Len", "Start(ms)", "Slot(ms)", "TFrame(ms)", "TFrameMax", "Headroom(ms)");
+      fprintf(stdout, "-------------------------------------------------------------------------------------------------------------------\n");
+   }
+
+   for ( uint16_t i = 0; i < table->num_entries; i++ )
+   {
+      const struct Sched_SlotTiming_S * slot = &timings[i];
+      const struct LDF_Frame_S * frame = ( slot->id != SCHED_NO_ID ) ? LDF_FrameByID(db, slot->id) : NULL;
+      const char * frame_name = ( frame != NULL ) ? frame->name : "?";
+      double slot_ms = slot->headroom_ms + slot->max_ms;
+
+      if ( quiet )
+      {
+         fprintf(stdout, "%u %s 0x%02X 0x%02X %u %.3f %.3f %.3f %.3f %.3f\n",
+                 (unsigned int)i, frame_name, (unsigned int)slot->id, (unsigned int)slot->pid,
+                 (unsigned int)slot->length, slot->start_ms, slot_ms, slot->nominal_ms,
+                 slot->max_ms, slot->headroom_ms);
+      }
+      else
+      {
+         fprintf(stdout, "%-4u %-32s \033[36m0x%02X\033[0m   \033[32m0x%02X\033[0m   %-4u %-10.3f %-10.3f %-12.3f %-12.3f %s%.3f\033[0m\n",
+                 (unsigned int)i, frame_name, (unsigned int)slot->id, (unsigned int)slot->pid,
+                 (unsigned int)slot->length, slot->start_ms, slot_ms, slot->nominal_ms,
+                 slot->max_ms, slot->overrun ? "\033[31m" : "\033[32m", slot->headroom_ms);
+      }
+   }
+
+   if ( !quiet )
+   {
+      fprintf(stdout, "\n%-24s%.3f ms\n", "Cycle:", summary->cycle_ms);
+      fprintf(stdout, "%-24s%.1f %%\n", "Utilization:", summary->utilization * 100.0);
+      fprintf(stdout, "%-24s%.1f %%\n", "Worst-case utilization:", summary->worst_case_utilization * 100.0);
+      fprintf(stdout, "%-24s%s%.3f ms\033[0m (slot %zu)\n", "Min headroom:",
+              (summary->num_overruns > 0) ? "\033[31m" : "\033[32m",
+              summary->min_headroom_ms, summary->worst_slot);
+      fprintf(stdout, "%-24s%zu\n\n", "Overruns:", summary->num_overruns);
+   }
+}
+
+static void PrintScheduleSummary( const char * table_name,
+                                  size_t num_slots,
+                                  const struct Sched_Summary_S * summary,
+                                  bool quiet )
+{
+   assert( (table_name != NULL) && (summary != NULL) );
+
+   if ( quiet )
+   {
+      fprintf(stdout, "%s %zu %u %.3f %.4f %.4f %.3f %zu\n",
+              table_name, num_slots, (unsigned int)summary->baud_rate, summary->cycle_ms,
+              summary->utilization, summary->worst_case_utilization,
+              summary->min_headroom_ms, summary->num_overruns);
+      return;
+   }
+
+   fprintf(stdout, "%-32s %-6zu %-8u %-10.3f %-8.1f %-11.1f %s%-13.3f\033[0m %zu\n",
+           table_name, num_slots, (unsigned int)summary->baud_rate, summary->cycle_ms,
+           summary->utilization * 100.0, summary->worst_case_utilization * 100.0,
+           (summary->num_overruns > 0) ? "\033[31m" : "\033[32m",
+           summary->min_headroom_ms, summary->num_overruns);
+}
+
+/**
+ * @brief lin_pid --log <file | -> [--format csv | asc] [--classic] [--threads <n>] [--summary] [--quiet | -q]
+ *
+ * Checks every frame in a text bus log ("-" reads stdin) and prints one line
+ * per anomaly, in file order, followed by totals. With --summary, a per-ID
+ * table is printed instead of the anomalies. The format comes from the file
+ * extension (.asc, otherwise CSV) unless --format is given. --classic checks
+ * every checksum as LIN 1.x classic.
+ */
+static int LogMode( int argc, char * argv[] )
+{
+   const char * path = NULL;
+   const char * format = NULL;
+   uint32_t num_threads = 0;
+   bool classic = false;
+   bool summary_only = false;
+   bool quiet = false;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp("--log", argv[i]) == 0) && ((i + 1) < argc) && (NULL == path) )
+      {
+         path = argv[++i];
+      }
+      else if ( (strcmp("--format", argv[i]) == 0) && ((i + 1) < argc) && (NULL == format) &&
+                ((strcmp("csv", argv[i + 1]) == 0) || (strcmp("asc", argv[i + 1]) == 0)) )
+      {
+         format = argv[++i];
+      }
+      else if ( (strcmp("--threads", argv[i]) == 0) && ((i + 1) < argc) && (0 == num_threads) &&
+                ParseUInt32Arg(argv[i + 1], &num_threads) && (num_threads > 0) )
+      {
+         i++;
+      }
+      else if ( strcmp("--classic", argv[i]) == 0 )
+      {
+         classic = true;
+      }
+      else if ( strcmp("--summary", argv[i]) == 0 )
+      {
+         summary_only = true;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidLogUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   if ( NULL == path )
+   {
+      PrintErrMsg(InvalidLogUsage);
+      return EXIT_FAILURE;
+   }
+
+   bool from_stdin = ( strcmp("-", path) == 0 );
+   FILE * fp = from_stdin ? stdin : fopen(path, "rb");
+   if ( NULL == fp )
+   {
+      PrintErrMsg(LogFileUnreadable);
+      return EXIT_FAILURE;
+   }
+
+   struct LOG_Options_S options = { 0 };
+   if ( format != NULL )
+   {
+      options.format = ( strcmp("asc", format) == 0 ) ? LOG_FORMAT_ASC : LOG_FORMAT_CSV;
+   }
+   else
+   {
+      options.format = from_stdin ? LOG_FORMAT_CSV : LOG_FormatFromPath(path);
+   }
+   options.checksum = classic ? LOG_CHECKSUM_CLASSIC : LOG_CHECKSUM_LIN2;
+   options.num_threads = num_threads;
+   options.on_anomaly = summary_only ? NULL : PrintLogAnomaly;
+   options.ctx = &quiet;
+
+   // Too big for the stack with all 64 per-ID entries
+   struct LOG_Summary_S * summary = malloc( sizeof(*summary) );
+   enum LIN_PID_Result_E result = ( NULL == summary ) ? OutOfMemory
+                                                      : LOG_ProcessStream(fp, &options, summary);
+   if ( !from_stdin )
+   {
+      (void)fclose(fp);
+   }
+
+   if ( GoodResult == result )
+   {
+      if ( summary_only )
+      {
+         PrintLogSummary(summary, quiet);
+      }
+      if ( !quiet )
+      {
+         uint64_t num_anomalies = summary->frames - summary->anomalies[LOG_ANOMALY_NONE];
+         fprintf(stdout, "\n%llu lines, %llu frames, %s%llu anomalies\033[0m\n\n",
+                 (unsigned long long)summary->lines, (unsigned long long)summary->frames,
+                 (num_anomalies > 0) ? "\033[31m" : "\033[32m", (unsigned long long)num_anomalies);
+      }
+   }
+   else
+   {
+      PrintErrMsg(result);
+   }
+
+   free(summary);
+   return ( GoodResult == result ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static void PrintLogAnomaly( const struct LOG_Anomaly_S * anomaly, void * ctx )
+{
+   assert( (anomaly != NULL) && (ctx != NULL) );
+
+   bool quiet = *(const bool *)ctx;
+   const struct LOG_Frame_S * frame = &anomaly->frame;
+
+   if ( quiet )
+   {
+      fprintf(stdout, "%zu %.6f ", anomaly->line, frame->timestamp);
+   }
+   else
+   {
+      fprintf(stdout, "line %-8zu %-14.6f \033[31m%s\033[0m: ", anomaly->line, frame->timestamp,
+              LOG_AnomalyName(anomaly->kind));
+   }
+
+   switch ( anomaly->kind )
+   {
+      case LOG_ANOMALY_BAD_ID:
+         // ErrorMsgs[] are formatted for stderr, so just say which way the ID was wrong
+         fprintf(stdout, "%s%s\n", quiet ? "bad-id " : "",
+                 (ID_OOR == anomaly->id_error) ? "ID out of range" : "not a valid ID");
+         break;
+
+      case LOG_ANOMALY_LENGTH:
+         if ( frame->length == anomaly->expected )
+         {
+            fprintf(stdout, "%sID 0x%02X, more than %u data bytes\n", quiet ? "length " : "",
+                    (unsigned int)frame->id, (unsigned int)anomaly->expected);
+         }
+         else
+         {
+            fprintf(stdout, "%sID 0x%02X, %u data bytes, DLC %u\n", quiet ? "length " : "",
+                    (unsigned int)frame->id, (unsigned int)frame->length, (unsigned int)anomaly->expected);
+         }
+         break;
+
+      case LOG_ANOMALY_PID_MISMATCH:
+         fprintf(stdout, "%sID 0x%02X, logged 0x%02X, expected 0x%02X\n", quiet ? "pid " : "",
+                 (unsigned int)frame->id, (unsigned int)frame->pid, (unsigned int)anomaly->expected);
+         break;
+
+      case LOG_ANOMALY_CHECKSUM:
+         fprintf(stdout, "%sID 0x%02X, logged 0x%02X, expected 0x%02X\n", quiet ? "checksum " : "",
+                 (unsigned int)frame->id, (unsigned int)frame->checksum, (unsigned int)anomaly->expected);
+         break;
+
+      case LOG_ANOMALY_SYNTAX:
+      case LOG_ANOMALY_NONE:
+      case NUM_OF_LOG_ANOMALIES:
+      default:
+         fprintf(stdout, "%s\n", quiet ? "syntax" : "unparseable frame line");
+         break;
+   }
+}
+
+static void PrintLogSummary( const struct LOG_Summary_S * summary, bool quiet )
+{
+   assert( summary != NULL );
+
+   if ( !quiet )
+   {
+      fprintf(stdout, "\n%-6s %-6s %-12s %-10s %-10s %-16s %s\n",
+              "ID", "PID", "Frames", "PIDErrs", "CsumErrs", "First(s)", "Last(s)");
+      fprintf(stdout, "-----------------------------------------------------------------------------\n");
+   }
+
+   for ( uint8_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      const struct LOG_IDStats_S * stats = &summary->per_id[id];
+      if ( 0 == stats->frames )
+      {
+         continue;
+      }
+
+      if ( quiet )
+      {
+         fprintf(stdout, "0x%02X 0x%02X %llu %llu %llu %.6f %.6f\n",
+                 (unsigned int)id, (unsigned int)REFERENCE_PID_TABLE[id],
+                 (unsigned long long)stats->frames, (unsigned long long)stats->pid_errors,
+                 (unsigned long long)stats->checksum_errors, stats->first_timestamp, stats->last_timestamp);
+      }
+      else
+      {
+         bool errors = ( (stats->pid_errors + stats->checksum_errors) > 0 );
+         fprintf(stdout, "\033[36m0x%02X\033[0m   \033[32m0x%02X\033[0m   %-12llu %s%-10llu %-10llu\033[0m %-16.6f %.6f\n",
+                 (unsigned int)id, (unsigned int)REFERENCE_PID_TABLE[id],
+                 (unsigned long long)stats->frames, errors ? "\033[31m" : "",
+                 (unsigned long long)stats->pid_errors, (unsigned long long)stats->checksum_errors,
+                 stats->first_timestamp, stats->last_timestamp);
+      }
+   }
+}
+
+/**
+ * @brief lin_pid --follow <file> [--format csv | asc] [--classic] [--summary] [--quiet | -q]
+ *
+ * Like --log, but keeps going as the log grows and reports each anomaly as
+ * soon as its line is complete. Stops on Ctrl+C (or SIGTERM, or the file
+ * being deleted) and then prints totals, plus the per-ID table with
+ * --summary.
+ */
+static int FollowMode( int argc, char * argv[] )
+{
+   const char * path = NULL;
+   const char * format = NULL;
+   bool classic = false;
+   bool summary_too = false;
+   bool quiet = false;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp("--follow", argv[i]) == 0) && ((i + 1) < argc) && (NULL == path) )
+      {
+         path = argv[++i];
+      }
+      else if ( (strcmp("--format", argv[i]) == 0) && ((i + 1) < argc) && (NULL == format) &&
+                ((strcmp("csv", argv[i + 1]) == 0) || (strcmp("asc", argv[i + 1]) == 0)) )
+      {
+         format = argv[++i];
+      }
+      else if ( strcmp("--classic", argv[i]) == 0 )
+      {
+         classic = true;
+      }
+      else if ( strcmp("--summary", argv[i]) == 0 )
+      {
+         summary_too = true;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidFollowUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   if ( NULL == path )
+   {
+      PrintErrMsg(InvalidFollowUsage);
+      return EXIT_FAILURE;
+   }
+
+   struct LOG_Options_S options = { 0 };
+   if ( format != NULL )
+   {
+      options.format = ( strcmp("asc", format) == 0 ) ? LOG_FORMAT_ASC : LOG_FORMAT_CSV;
+   }
+   else
+   {
+      options.format = LOG_FormatFromPath(path);
+   }
+   options.checksum = classic ? LOG_CHECKSUM_CLASSIC : LOG_CHECKSUM_LIN2;
+   options.on_anomaly = PrintLogAnomaly;
+   options.ctx = &quiet;
+
+   // Each anomaly should show up as soon as it's found, even through a pipe
+   (void)setvbuf(stdout, NULL, _IOLBF, 0);
+
+   // Too big for the stack with all 64 per-ID entries
+   struct LOG_Summary_S * summary = malloc( sizeof(*summary) );
+   enum LIN_PID_Result_E result = ( NULL == summary ) ? OutOfMemory
+                                                      : LOG_Follow(path, &options, summary);
+   if ( GoodResult == result )
+   {
+      if ( summary_too )
+      {
+         PrintLogSummary(summary, quiet);
+      }
+      if ( !quiet )
+      {
+         uint64_t num_anomalies = summary->frames - summary->anomalies[LOG_ANOMALY_NONE];
+         fprintf(stdout, "\n%llu lines, %llu frames, %s%llu anomalies\033[0m\n\n",
+                 (unsigned long long)summary->lines, (unsigned long long)summary->frames,
+                 (num_anomalies > 0) ? "\033[31m" : "\033[32m", (unsigned long long)num_anomalies);
+      }
+   }
+   else
+   {
+      PrintErrMsg(result);
+   }
+
+   free(summary);
+   return ( GoodResult == result ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief lin_pid --convert <log | -> <capture> [--format csv | asc] [--classic] [--threads <n>] [--block-frames <n>] [--quiet | -q]
+ *
+ * Parses a text bus log the same way --log does and writes every complete
+ * frame to a binary capture, flagging PID and checksum mismatches. Prints
+ * what was written unless quiet. A capture that fails part way is removed.
+ */
+static int ConvertMode( int argc, char * argv[] )
+{
+   const char * log_path = NULL;
+   const char * cap_path = NULL;
+   const char * format = NULL;
+   uint32_t num_threads = 0;
+   uint32_t block_frames = 0;
+   bool classic = false;
+   bool quiet = false;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp("--convert", argv[i]) == 0) && ((i + 2) < argc) && (NULL == log_path) )
+      {
+         log_path = argv[++i];
+         cap_path = argv[++i];
+      }
+      else if ( (strcmp("--format", argv[i]) == 0) && ((i + 1) < argc) && (NULL == format) &&
+                ((strcmp("csv", argv[i + 1]) == 0) || (strcmp("asc", argv[i + 1]) == 0)) )
+      {
+         format = argv[++i];
+      }
+      else if ( (strcmp("--threads", argv[i]) == 0) && ((i + 1) < argc) && (0 == num_threads) &&
+                ParseUInt32Arg(argv[i + 1], &num_threads) && (num_threads > 0) )
+      {
+         i++;
+      }
+      else if ( (strcmp("--block-frames", argv[i]) == 0) && ((i + 1) < argc) && (0 == block_frames) &&
+                ParseUInt32Arg(argv[i + 1], &block_frames) && (block_frames > 0) )
+      {
+         i++;
+      }
+      else if ( strcmp("--classic", argv[i]) == 0 )
+      {
+         classic = true;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidConvertUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   if ( NULL == log_path )
+   {
+      PrintErrMsg(InvalidConvertUsage);
+      return EXIT_FAILURE;
+   }
+
+   bool from_stdin = ( strcmp("-", log_path) == 0 );
+   FILE * in = from_stdin ? stdin : fopen(log_path, "rb");
+   if ( NULL == in )
+   {
+      PrintErrMsg(LogFileUnreadable);
+      return EXIT_FAILURE;
+   }
+   FILE * out = fopen(cap_path, "wb");
+   if ( NULL == out )
+   {
+      if ( !from_stdin )
+      {
+         (void)fclose(in);
+      }
+      PrintErrMsg(CaptureFileUnwritable);
+      return EXIT_FAILURE;
+   }
+
+   struct LOG_Options_S options = { 0 };
+   if ( format != NULL )
+   {
+      options.format = ( strcmp("asc", format) == 0 ) ? LOG_FORMAT_ASC : LOG_FORMAT_CSV;
+   }
+   else
+   {
+      options.format = from_stdin ? LOG_FORMAT_CSV : LOG_FormatFromPath(log_path);
+   }
+   options.checksum = classic ? LOG_CHECKSUM_CLASSIC : LOG_CHECKSUM_LIN2;
+   options.num_threads = num_threads;
+
+   struct CAP_ConvertStats_S stats;
+   enum LIN_PID_Result_E result = CAP_ConvertLog(in, out, &options, block_frames, &stats);
+   if ( !from_stdin )
+   {
+      (void)fclose(in);
+   }
+   if ( (fclose(out) != 0) && (GoodResult == result) )
+   {
+      result = CaptureFileUnwritable;
+   }
+
+   if ( result != GoodResult )
+   {
+      (void)remove(cap_path);
+      PrintErrMsg(result);
+      return EXIT_FAILURE;
+   }
+
+   if ( !quiet )
+   {
+      fprintf(stdout, "\n%llu frames in %llu blocks written to %s\n",
+              (unsigned long long)stats.frames, (unsigned long long)stats.blocks, cap_path);
+      fprintf(stdout, "%llu lines read, %s%llu frame lines skipped\033[0m\n\n",
+              (unsigned long long)stats.lines, (stats.skipped > 0) ? "\033[31m" : "\033[32m",
+              (unsigned long long)stats.skipped);
+   }
+   return EXIT_SUCCESS;
+}
+
+/**
+ * @brief lin_pid --dump <capture> [--frame <n> | --from <seconds>] [--to <seconds>] [--count <n>] [--quiet | -q]
+ *
+ * Prints frames from a capture in the CSV log format, so the output can be
+ * fed back to --log or --convert. --frame and --from seek through the block
+ * index rather than reading the capture from the start. The CSV header line
+ * is left out when quiet.
+ */
+static int DumpMode( int argc, char * argv[] )
+{
+   const char * path = NULL;
+   uint64_t start_frame = 0;
+   uint64_t from_us = 0;
+   uint64_t to_us = UINT64_MAX;
+   uint64_t count = UINT64_MAX;
+   bool have_frame = false;
+   bool have_from = false;
+   bool have_to = false;
+   bool have_count = false;
+   bool quiet = false;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp("--dump", argv[i]) == 0) && ((i + 1) < argc) && (NULL == path) )
+      {
+         path = argv[++i];
+      }
+      else if ( (strcmp("--frame", argv[i]) == 0) && ((i + 1) < argc) && !have_frame &&
+                ParseUInt64Arg(argv[i + 1], &start_frame) )
+      {
+         have_frame = true;
+         i++;
+      }
+      else if ( (strcmp("--from", argv[i]) == 0) && ((i + 1) < argc) && !have_from &&
+                ParseSecondsArg(argv[i + 1], &from_us) )
+      {
+         have_from = true;
+         i++;
+      }
+      else if ( (strcmp("--to", argv[i]) == 0) && ((i + 1) < argc) && !have_to &&
+                ParseSecondsArg(argv[i + 1], &to_us) )
+      {
+         have_to = true;
+         i++;
+      }
+      else if ( (strcmp("--count", argv[i]) == 0) && ((i + 1) < argc) && !have_count &&
+                ParseUInt64Arg(argv[i + 1], &count) )
+      {
+         have_count = true;
+         i++;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidDumpUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   if ( (NULL == path) || (have_frame && have_from) )
+   {
+      PrintErrMsg(InvalidDumpUsage);
+      return EXIT_FAILURE;
+   }
+
+   struct CAP_Reader_S reader;
+   enum LIN_PID_Result_E result = CAP_Open(path, &reader);
+   if ( result != GoodResult )
+   {
+      PrintErrMsg(result);
+      return EXIT_FAILURE;
+   }
+
+   if ( !quiet )
+   {
+      fprintf(stdout, "timestamp,channel,id,pid,data,checksum\n");
+   }
+
+   // Running off the end of the capture just means there's nothing to print
+   struct CAP_Cursor_S cursor;
+   bool positioned = have_from ? CAP_SeekTime(&reader, from_us, &cursor)
+                               : CAP_SeekFrame(&reader, start_frame, &cursor);
+   struct CAP_Frame_S frame;
+   for ( uint64_t n = 0; positioned && (n < count) && CAP_Next(&reader, &cursor, &frame); n++ )
+   {
+      if ( frame.timestamp_us > to_us )
+      {
+         break;
+      }
+      PrintCaptureFrame(&frame);
+   }
+
+   CAP_Close(&reader);
+   return EXIT_SUCCESS;
+}
+
+/**
+ * @brief lin_pid --query id=<ID> <capture> [--from <seconds>] [--to <seconds>] [--count <n>] [--index] [--quiet | -q]
+ *
+ * Prints the frames with one ID, in the same form as --dump. Only that ID's
+ * posting list and the records it points at are read. In a capture without
+ * postings every frame is checked instead, unless --index asks for them to be
+ * added to the file (once) first.
+ */
+static int QueryMode( int argc, char * argv[] )
+{
+   const char * id_str = NULL;
+   const char * path = NULL;
+   uint64_t from_us = 0;
+   uint64_t to_us = UINT64_MAX;
+   uint64_t count = UINT64_MAX;
+   bool have_from = false;
+   bool have_to = false;
+   bool have_count = false;
+   bool add_postings = false;
+   bool quiet = false;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp("--query", argv[i]) == 0) && ((i + 2) < argc) && (NULL == path) &&
+           (strncmp("id=", argv[i + 1], 3) == 0) )
+      {
+         id_str = argv[++i] + 3;
+         path = argv[++i];
+      }
+      else if ( (strcmp("--from", argv[i]) == 0) && ((i + 1) < argc) && !have_from &&
+                ParseSecondsArg(argv[i + 1], &from_us) )
+      {
+         have_from = true;
+         i++;
+      }
+      else if ( (strcmp("--to", argv[i]) == 0) && ((i + 1) < argc) && !have_to &&
+                ParseSecondsArg(argv[i + 1], &to_us) )
+      {
+         have_to = true;
+         i++;
+      }
+      else if ( (strcmp("--count", argv[i]) == 0) && ((i + 1) < argc) && !have_count &&
+                ParseUInt64Arg(argv[i + 1], &count) )
+      {
+         have_count = true;
+         i++;
+      }
+      else if ( strcmp("--index", argv[i]) == 0 )
+      {
+         add_postings = true;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidQueryUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   if ( NULL == path )
+   {
+      PrintErrMsg(InvalidQueryUsage);
+      return EXIT_FAILURE;
+   }
+
+   uint8_t id = 0;
+   enum LIN_PID_Result_E result = ParseID(id_str, false, false, &id);
+   if ( (GoodResult == result) && add_postings )
+   {
+      result = CAP_AddPostings(path);
+   }
+   struct CAP_Reader_S reader;
+   if ( GoodResult == result )
+   {
+      result = CAP_Open(path, &reader);
+   }
+   if ( result != GoodResult )
+   {
+      PrintErrMsg(result);
+      return EXIT_FAILURE;
+   }
+
+   if ( !quiet )
+   {
+      fprintf(stdout, "timestamp,channel,id,pid,data,checksum\n");
+   }
+
+   struct CAP_Postings_S postings;
+   struct CAP_Cursor_S cursor;
+   struct CAP_Frame_S frame;
+   uint64_t n = 0;
+   bool indexed = CAP_PostingsOpen(&reader, id, &postings);
+   bool more = indexed || CAP_SeekTime(&reader, from_us, &cursor);
+   while ( more && (n < count) )
+   {
+      more = indexed ? CAP_NextPosting(&reader, &postings, &frame) : CAP_Next(&reader, &cursor, &frame);
+      if ( !more || (frame.id != id) )
+      {
+         continue;
+      }
+      if ( frame.timestamp_us > to_us )
+      {
+         more = false;
+      }
+      else if ( frame.timestamp_us >= from_us )
+      {
+         PrintCaptureFrame(&frame);
+         n++;
+      }
+   }
+
+   CAP_Close(&reader);
+   return EXIT_SUCCESS;
+}
+
+/**
+ * @brief lin_pid --merge <capture>... [--out <capture>] [--retag] [--block-frames <n>] [--quiet | -q]
+ *
+ * Reads every capture front to back at once and puts out their frames in
+ * timestamp order, with each PID checked against its ID again. Frames with the
+ * same timestamp come out in the order their captures were given. The result
+ * is printed as a CSV log like --dump, or written to a new capture with --out.
+ * --retag numbers the channels after the captures' positions, from 1.
+ */
+static int MergeMode( int argc, char * argv[] )
+{
+   const char * out_path = NULL;
+   uint32_t block_frames = 0;
+   bool retag = false;
+   bool quiet = false;
+   int first_input = 0;
+   int num_inputs = 0;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp("--merge", argv[i]) == 0) && (0 == first_input) )
+      {
+         // Everything up to the next option is an input
+         first_input = i + 1;
+         while ( ((i + 1) < argc) && (strncmp("--", argv[i + 1], 2) != 0) && (strcmp("-q", argv[i + 1]) != 0) )
+         {
+            num_inputs++;
+            i++;
+         }
+      }
+      else if ( (strcmp("--out", argv[i]) == 0) && ((i + 1) < argc) && (NULL == out_path) )
+      {
+         out_path = argv[++i];
+      }
+      else if ( (strcmp("--block-frames", argv[i]) == 0) && ((i + 1) < argc) && (0 == block_frames) &&
+                ParseUInt32Arg(argv[i + 1], &block_frames) && (block_frames > 0) )
+      {
+         i++;
+      }
+      else if ( strcmp("--retag", argv[i]) == 0 )
+      {
+         retag = true;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidMergeUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   bool valid = ( num_inputs > 0 ) && ( (0 == block_frames) || (out_path != NULL) );
+   for ( int i = 0; valid && (out_path != NULL) && (i < num_inputs); i++ )
+   {
+      // Truncating an input while it's mapped would pull it out from under the merge
+      valid = ( strcmp(out_path, argv[first_input + i]) != 0 );
+   }
+   if ( !valid )
+   {
+      PrintErrMsg(InvalidMergeUsage);
+      return EXIT_FAILURE;
+   }
+
+   struct CAP_Reader_S * readers = calloc( (size_t)num_inputs, sizeof(*readers) );
+   if ( NULL == readers )
+   {
+      PrintErrMsg(OutOfMemory);
+      return EXIT_FAILURE;
+   }
+   enum LIN_PID_Result_E result = GoodResult;
+   int num_open = 0;
+   while ( (GoodResult == result) && (num_open < num_inputs) )
+   {
+      result = CAP_Open(argv[first_input + num_open], &readers[num_open]);
+      if ( GoodResult == result )
+      {
+         num_open++;
+      }
+   }
+
+   struct CAP_Merge_S merge;
+   bool merging = false;
+   if ( GoodResult == result )
+   {
+      result = CAP_MergeOpen(&merge, readers, (size_t)num_inputs, retag);
+      merging = ( GoodResult == result );
+   }
+
+   FILE * out = NULL;
+   struct CAP_Writer_S writer;
+   bool writing = false;
+   if ( (GoodResult == result) && (out_path != NULL) )
+   {
+      out = fopen(out_path, "wb");
+      result = ( out != NULL ) ? CAP_WriterOpen(&writer, out, block_frames) : CaptureFileUnwritable;
+      writing = ( GoodResult == result );
+   }
+   else if ( (GoodResult == result) && !quiet )
+   {
+      fprintf(stdout, "timestamp,channel,id,pid,data,checksum\n");
+   }
+
+   struct CAP_Frame_S frame;
+   while ( (GoodResult == result) && CAP_MergeNext(&merge, &frame, NULL) )
+   {
+      if ( writing )
+      {
+         result = CAP_WriteFrame(&writer, &frame);
+      }
+      else
+      {
+         PrintCaptureFrame(&frame);
+      }
+   }
+   if ( (GoodResult == result) && merge.corrupt )
+   {
+      result = CaptureFileCorrupt;
+   }
+
+   if ( writing )
+   {
+      enum LIN_PID_Result_E close_result = CAP_WriterClose(&writer);
+      result = ( GoodResult == result ) ? close_result : result;
+   }
+   if ( (out != NULL) && (fclose(out) != 0) && (GoodResult == result) )
+   {
+      result = CaptureFileUnwritable;
+   }
+   if ( (result != GoodResult) && (out != NULL) )
+   {
+      (void)remove(out_path);
+   }
+
+   if ( (GoodResult == result) && (out_path != NULL) && !quiet )
+   {
+      fprintf(stdout, "\n%llu frames from %d captures written to %s\n",
+              (unsigned long long)merge.frames, num_inputs, out_path);
+      fprintf(stdout, "%s%llu PID errors\033[0m\n\n",
+              (merge.pid_errors > 0) ? "\033[31m" : "\033[32m", (unsigned long long)merge.pid_errors);
+   }
+
+   if ( merging )
+   {
+      CAP_MergeClose(&merge);
+   }
+   for ( int i = 0; i < num_open; i++ )
+   {
+      CAP_Close(&readers[i]);
+   }
+   free(readers);
+
+   if ( result != GoodResult )
+   {
+      PrintErrMsg(result);
+      return EXIT_FAILURE;
+   }
+   return EXIT_SUCCESS;
+}
+
+/**
+ * @brief lin_pid --stats-by-id <capture>... [--threads <n>] [--quiet | -q]
+ *
+ * Prints, for every ID seen, its frame count, its period (min/mean/max), a
+ * histogram of cycle-to-cycle period jitter, and its parity, checksum, and
+ * missing-response counts (see lin_stats.h). Each capture is split across
+ * threads. Periods aren't measured from one capture into the next.
+ */
+static int StatsMode( int argc, char * argv[] )
+{
+   uint32_t num_threads = 0;
+   bool quiet = false;
+   int first_input = 0;
+   int num_inputs = 0;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp("--stats-by-id", argv[i]) == 0) && (0 == first_input) )
+      {
+         // Everything up to the next option is an input
+         first_input = i + 1;
+         while ( ((i + 1) < argc) && (strncmp("--", argv[i + 1], 2) != 0) && (strcmp("-q", argv[i + 1]) != 0) )
+         {
+            num_inputs++;
+            i++;
+         }
+      }
+      else if ( (strcmp("--threads", argv[i]) == 0) && ((i + 1) < argc) && (0 == num_threads) &&
+                ParseUInt32Arg(argv[i + 1], &num_threads) && (num_threads > 0) )
+      {
+         i++;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidStatsUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   if ( 0 == num_inputs )
+   {
+      PrintErrMsg(InvalidStatsUsage);
+      return EXIT_FAILURE;
+   }
+
+   struct Stats_Summary_S * summary = malloc( sizeof(*summary) );
+   if ( NULL == summary )
+   {
+      PrintErrMsg(OutOfMemory);
+      return EXIT_FAILURE;
+   }
+   Stats_Init(summary);
+
+   enum LIN_PID_Result_E result = GoodResult;
+   for ( int i = 0; (GoodResult == result) && (i < num_inputs); i++ )
+   {
+      struct CAP_Reader_S reader;
+      result = CAP_Open(argv[first_input + i], &reader);
+      if ( GoodResult == result )
+      {
+         result = Stats_ProcessCapture(&reader, num_threads, summary);
+         CAP_Close(&reader);
+      }
+   }
+   if ( result != GoodResult )
+   {
+      free(summary);
+      PrintErrMsg(result);
+      return EXIT_FAILURE;
+   }
+
+   PrintIDStats(summary, quiet);
+   if ( !quiet )
+   {
+      fprintf(stdout, "\n%llu frames in %d captures\n\n", (unsigned long long)summary->frames, num_inputs);
+   }
+   free(summary);
+   return EXIT_SUCCESS;
+}
+
+/**
+ * @brief lin_pid --tp <capture> [--timeout <ms>] [--index] [--quiet | -q]
+ *
+ * Reassembles the diagnostic transport-layer messages on 0x3C/0x3D (see
+ * lin_tp.h) and prints each one, and anything that went wrong along the way,
+ * in stream order. --timeout is how long a message may wait for its next
+ * consecutive frame. With postings, only the diagnostic frames are read; as
+ * with --query, --index adds them to a capture that lacks them.
+ */
+static int TPMode( int argc, char * argv[] )
+{
+   const char * path = NULL;
+   uint32_t timeout_ms = 0;
+   bool add_postings = false;
+   bool quiet = false;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp("--tp", argv[i]) == 0) && ((i + 1) < argc) && (NULL == path) )
+      {
+         path = argv[++i];
+      }
+      else if ( (strcmp("--timeout", argv[i]) == 0) && ((i + 1) < argc) && (0 == timeout_ms) &&
+                ParseUInt32Arg(argv[i + 1], &timeout_ms) && (timeout_ms > 0) )
+      {
+         i++;
+      }
+      else if ( strcmp("--index", argv[i]) == 0 )
+      {
+         add_postings = true;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidTPUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   if ( NULL == path )
+   {
+      PrintErrMsg(InvalidTPUsage);
+      return EXIT_FAILURE;
+   }
+
+   enum LIN_PID_Result_E result = add_postings ? CAP_AddPostings(path) : GoodResult;
+   struct CAP_Reader_S reader;
+   if ( GoodResult == result )
+   {
+      result = CAP_Open(path, &reader);
+   }
+   if ( result != GoodResult )
+   {
+      PrintErrMsg(result);
+      return EXIT_FAILURE;
+   }
+
+   // Each session carries a whole message's worth of buffer, so not on the stack
+   struct TP_Reassembler_S * tp = malloc( sizeof(*tp) );
+   if ( NULL == tp )
+   {
+      CAP_Close(&reader);
+      PrintErrMsg(OutOfMemory);
+      return EXIT_FAILURE;
+   }
+   struct TP_Options_S options = { 0 };
+   options.timeout_us = (uint64_t)timeout_ms * 1000u;
+   options.on_message = PrintTPMessage;
+   options.on_error = PrintTPError;
+   options.ctx = &quiet;
+   TP_Init(tp, &options);
+
+   result = TP_ProcessCapture(tp, &reader);
+   CAP_Close(&reader);
+
+   if ( !quiet )
+   {
+      uint64_t errors = 0;
+      for ( size_t e = 0; e < NUM_OF_TP_ERRORS; e++ )
+      {
+         errors += tp->stats.errors[e];
+      }
+      fprintf(stdout, "\n%llu diagnostic frames: %llu messages, %s%llu errors\033[0m, %llu dropped for checksum, %llu sleep commands\n\n",
+              (unsigned long long)tp->stats.frames, (unsigned long long)tp->stats.messages,
+              (errors > 0) ? "\033[31m" : "", (unsigned long long)errors,
+              (unsigned long long)tp->stats.dropped, (unsigned long long)tp->stats.sleeps);
+   }
+   free(tp);
+
+   if ( result != GoodResult )
+   {
+      PrintErrMsg(result);
+      return EXIT_FAILURE;
+   }
+   return EXIT_SUCCESS;
+}
+
+/**
+ * @brief lin_pid --samples <dump> --rate <Hz> [--baud <bps>] [--classic] [--out <capture>] [--quiet | -q]
+ *
+ * Recovers the frames from a raw logic-analyzer dump of the LIN wire (see
+ * lin_la.h) sampled at --rate, and prints them as a CSV log like --dump, or
+ * writes them to a capture with --out. Without --baud, the baud rate is
+ * measured from each frame's sync field, which follows a drifting master.
+ * --classic checks every checksum as LIN 1.x classic.
+ */
+static int SamplesMode( int argc, char * argv[] )
+{
+   const char * path = NULL;
+   const char * out_path = NULL;
+   uint64_t rate = 0;
+   uint32_t baud = 0;
+   bool classic = false;
+   bool quiet = false;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp("--samples", argv[i]) == 0) && ((i + 1) < argc) && (NULL == path) )
+      {
+         path = argv[++i];
+      }
+      else if ( (strcmp("--rate", argv[i]) == 0) && ((i + 1) < argc) && (0 == rate) &&
+                ParseUInt64Arg(argv[i + 1], &rate) && (rate > 0) )
+      {
+         i++;
+      }
+      else if ( (strcmp("--baud", argv[i]) == 0) && ((i + 1) < argc) && (0 == baud) &&
+                ParseUInt32Arg(argv[i + 1], &baud) && (baud > 0) )
+      {
+         i++;
+      }
+      else if ( (strcmp("--out", argv[i]) == 0) && ((i + 1) < argc) && (NULL == out_path) )
+      {
+         out_path = argv[++i];
+      }
+      else if ( strcmp("--classic", argv[i]) == 0 )
+      {
+         classic = true;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidSamplesUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   if ( (NULL == path) || (0 == rate) || ((out_path != NULL) && (strcmp(out_path, path) == 0)) )
+   {
+      PrintErrMsg(InvalidSamplesUsage);
+      return EXIT_FAILURE;
+   }
+
+   enum LIN_PID_Result_E result = GoodResult;
+   struct SampledFrameSink_S sink = { NULL, GoodResult };
+   struct CAP_Writer_S writer;
+   FILE * out = NULL;
+   if ( out_path != NULL )
+   {
+      out = fopen(out_path, "wb");
+      result = ( out != NULL ) ? CAP_WriterOpen(&writer, out, 0) : CaptureFileUnwritable;
+      sink.writer = ( GoodResult == result ) ? &writer : NULL;
+   }
+   else if ( !quiet )
+   {
+      fprintf(stdout, "timestamp,channel,id,pid,data,checksum\n");
+   }
+
+   struct LA_Options_S options = { 0 };
+   options.sample_rate_hz = rate;
+   options.baud = baud;
+   options.checksum = classic ? LOG_CHECKSUM_CLASSIC : LOG_CHECKSUM_LIN2;
+   options.on_frame = TakeSampledFrame;
+   options.ctx = &sink;
+   struct LA_Stats_S stats;
+   if ( GoodResult == result )
+   {
+      result = LA_DecodeFile(path, &options, &stats);
+   }
+   result = ( GoodResult == result ) ? sink.result : result;
+
+   if ( sink.writer != NULL )
+   {
+      enum LIN_PID_Result_E close_result = CAP_WriterClose(&writer);
+      result = ( GoodResult == result ) ? close_result : result;
+   }
+   if ( (out != NULL) && (fclose(out) != 0) && (GoodResult == result) )
+   {
+      result = CaptureFileUnwritable;
+   }
+   if ( (result != GoodResult) && (out != NULL) )
+   {
+      (void)remove(out_path);
+   }
+   if ( result != GoodResult )
+   {
+      PrintErrMsg(result);
+      return EXIT_FAILURE;
+   }
+
+   if ( !quiet )
+   {
+      uint64_t errors = stats.sync_errors + stats.framing_errors + stats.pid_errors + stats.checksum_errors;
+      fprintf(stdout, "\n%llu frames from %.6f s of samples (%llu breaks)",
+              (unsigned long long)stats.frames, (double)stats.samples / (double)rate,
+              (unsigned long long)stats.breaks);
+      if ( baud > 0 )
+      {
+         fprintf(stdout, " at %u bit/s\n", (unsigned int)baud);
+      }
+      else if ( stats.baud > 0.0 )
+      {
+         fprintf(stdout, " at %.0f bit/s detected, %llu sync fields rejected\n",
+                 stats.baud, (unsigned long long)stats.sync_outliers);
+      }
+      else
+      {
+         fprintf(stdout, ", no sync field to detect the baud rate from\n");
+      }
+      fprintf(stdout, "%s%llu sync errors, %llu framing errors, %llu PID errors, %llu checksum errors\033[0m, %llu stray bytes\n\n",
+              (errors > 0) ? "\033[31m" : "\033[32m",
+              (unsigned long long)stats.sync_errors, (unsigned long long)stats.framing_errors,
+              (unsigned long long)stats.pid_errors, (unsigned long long)stats.checksum_errors,
+              (unsigned long long)stats.stray_bytes);
+   }
+   return EXIT_SUCCESS;
+}
+
+/**
+ * @brief lin_pid --node <ldf> (--master [--table <name>] [--cycles <n>] | --slave <node>) [--port <tty>] [--classic] [--quiet | -q]
+ *
+ * Takes part in a LIN bus over a pty (see lin_node.h), for testing gateway
+ * software without hardware. Without --port, a new pty is opened and its
+ * path printed for the software under test to open. As master, runs a
+ * schedule table (the first one unless --table says otherwise) for --cycles
+ * passes, or until interrupted; as slave, answers for the named node until
+ * the other end hangs up or it's interrupted. Either way it finishes with
+ * the counts and the response latencies' percentiles and histogram, which
+ * SIGUSR1 prints meanwhile too.
+ */
+static int NodeMode( int argc, char * argv[] )
+{
+   const char * path = NULL;
+   const char * table_name = NULL;
+   const char * node_name = NULL;
+   const char * port_path = NULL;
+   uint64_t cycles = 0;
+   bool master = false;
+   bool classic = false;
+   bool quiet = false;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( (strcmp("--node", argv[i]) == 0) && ((i + 1) < argc) && (NULL == path) )
+      {
+         path = argv[++i];
+      }
+      else if ( (strcmp("--master", argv[i]) == 0) && !master )
+      {
+         master = true;
+      }
+      else if ( (strcmp("--slave", argv[i]) == 0) && ((i + 1) < argc) && (NULL == node_name) )
+      {
+         node_name = argv[++i];
+      }
+      else if ( (strcmp("--table", argv[i]) == 0) && ((i + 1) < argc) && (NULL == table_name) )
+      {
+         table_name = argv[++i];
+      }
+      else if ( (strcmp("--cycles", argv[i]) == 0) && ((i + 1) < argc) && (0 == cycles) &&
+                ParseUInt64Arg(argv[i + 1], &cycles) && (cycles > 0) )
+      {
+         i++;
+      }
+      else if ( (strcmp("--port", argv[i]) == 0) && ((i + 1) < argc) && (NULL == port_path) )
+      {
+         port_path = argv[++i];
+      }
+      else if ( strcmp("--classic", argv[i]) == 0 )
+      {
+         classic = true;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidNodeUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   // Exactly one role, and the schedule options only for the master
+   if ( (NULL == path) || (master == (node_name != NULL)) ||
+        (!master && ((table_name != NULL) || (cycles != 0))) )
+   {
+      PrintErrMsg(InvalidNodeUsage);
+      return EXIT_FAILURE;
+   }
+
+   struct LDF_Database_S db;
+   if ( !LoadLDFForCLI(path, &db) )
+   {
+      return EXIT_FAILURE;
+   }
+
+   enum LIN_PID_Result_E result = NodeNotFound;
+   uint16_t node = LDF_NO_INDEX;
+   for ( size_t n = 0; n < db.num_nodes; n++ )
+   {
+      if ( master ? db.nodes[n].is_master : (!db.nodes[n].is_master && (strcmp(db.nodes[n].name, node_name) == 0)) )
+      {
+         node = (uint16_t)n;
+         result = GoodResult;
+         break;
+      }
+   }
+
+   size_t table_idx = 0;
+   if ( (GoodResult == result) && master && (table_name != NULL) )
+   {
+      table_idx = db.num_schedule_tables;
+      for ( size_t t = 0; t < db.num_schedule_tables; t++ )
+      {
+         if ( strcmp(db.schedule_tables[t].name, table_name) == 0 )
+         {
+            table_idx = t;
+         }
+      }
+   }
+   if ( (GoodResult == result) && master && (table_idx >= db.num_schedule_tables) )
+   {
+      result = ScheduleTableNotFound;
+   }
+
+   // Everything the node needs is copied out, so the LDF can go before the run
+   struct Node_Options_S * options = calloc( 1, sizeof(*options) );
+   struct Sched_Slot_S * slots = NULL;
+   result = ( (GoodResult == result) && (NULL == options) ) ? OutOfMemory : result;
+   if ( GoodResult == result )
+   {
+      options->role = master ? NODE_MASTER : NODE_SLAVE;
+      options->checksum = classic ? LOG_CHECKSUM_CLASSIC : LOG_CHECKSUM_LIN2;
+      options->cycles = cycles;
+      Node_ResponsesFromLDF(&db, node, options->responses);
+      if ( master )
+      {
+         result = Sched_SlotsFromLDF(&db, table_idx, &slots, &options->num_slots);
+         options->slots = slots;
+      }
+   }
+   LDF_Free(&db);
+
+   int port_fd = -1;
+   int held_fd = -1;
+   char pty_path[NODE_MAX_PATH_LEN];
+   if ( GoodResult == result )
+   {
+      result = ( port_path != NULL ) ? Node_OpenPort(port_path, &port_fd)
+                                     : Node_OpenPty(&port_fd, &held_fd, pty_path);
+   }
+   if ( GoodResult == result )
+   {
+      if ( NULL == port_path )
+      {
+         fprintf(stdout, quiet ? "%s\n" : "LIN bus on \033[36m%s\033[0m\n", pty_path);
+         fflush(stdout);
+      }
+      options->fd = port_fd;
+      struct NodeReport_S report = { options->role, quiet };
+      options->on_report = ReportNodeStats;
+      options->ctx = &report;
+
+      struct Node_Stats_S * stats = malloc( sizeof(*stats) );
+      result = ( stats != NULL ) ? Node_Run(options, stats) : OutOfMemory;
+      if ( GoodResult == result )
+      {
+         PrintNodeStats(stats, options->role, quiet);
+      }
+      free(stats);
+   }
+
+   Node_ClosePort(port_fd);
+   Node_ClosePort(held_fd);
+   free(slots);
+   free(options);
+   if ( result != GoodResult )
+   {
+      PrintErrMsg(result);
+      return EXIT_FAILURE;
+   }
+   return EXIT_SUCCESS;
+}
+
+/**
+ * @brief lin_pid --capture <tty>... [--baud <bps>] [--classic] [--out <capture>...] [--quiet | -q]
+ *
+ * Decodes the frames on several serial LIN interfaces at once (see
+ * lin_tty.h), the first tty being channel 1, until Ctrl+C or every tty hangs
+ * up. Frames are printed as a CSV log like --dump, or with --out, written to
+ * one capture per tty, to be interleaved later with --merge. --baud sets the
+ * ttys' baud rate, which otherwise stays as it is; --classic checks every
+ * checksum as LIN 1.x classic. Finishes with each channel's counts,
+ * dropped bytes among them.
+ */
+static int CaptureMode( int argc, char * argv[] )
+{
+   uint32_t baud = 0;
+   bool classic = false;
+   bool quiet = false;
+   int first_tty = 0;
+   int num_ttys = 0;
+   int first_out = 0;
+   int num_outs = 0;
+
+   for ( int i = 1; i < argc; i++ )
+   {
+      if ( ((strcmp("--capture", argv[i]) == 0) && (0 == first_tty)) ||
+           ((strcmp("--out", argv[i]) == 0) && (0 == first_out)) )
+      {
+         // Everything up to the next option is a tty, or a capture to write
+         bool ttys = ( strcmp("--capture", argv[i]) == 0 );
+         int * num = ttys ? &num_ttys : &num_outs;
+         *(ttys ? &first_tty : &first_out) = i + 1;
+         while ( ((i + 1) < argc) && (strncmp("--", argv[i + 1], 2) != 0) && (strcmp("-q", argv[i + 1]) != 0) )
+         {
+            (*num)++;
+            i++;
+         }
+      }
+      else if ( (strcmp("--baud", argv[i]) == 0) && ((i + 1) < argc) && (0 == baud) &&
+                ParseUInt32Arg(argv[i + 1], &baud) && (baud > 0) )
+      {
+         i++;
+      }
+      else if ( strcmp("--classic", argv[i]) == 0 )
+      {
+         classic = true;
+      }
+      else if ( (strcmp("--quiet", argv[i]) == 0) || (strcmp("-q", argv[i]) == 0) )
+      {
+         quiet = true;
+      }
+      else
+      {
+         PrintErrMsg(InvalidCaptureUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   if ( (num_ttys < 1) || ((size_t)num_ttys > TTY_MAX_CHANNELS) ||
+        ((first_out != 0) && (num_outs != num_ttys)) )
+   {
+      PrintErrMsg(InvalidCaptureUsage);
+      return EXIT_FAILURE;
+   }
+
+   int fds[TTY_MAX_CHANNELS];
+   struct SampledFrameSink_S sinks[TTY_MAX_CHANNELS];
+   FILE * outs[TTY_MAX_CHANNELS] = { NULL };
+   struct TTY_Stats_S stats[TTY_MAX_CHANNELS];
+   struct CAP_Writer_S * writers = calloc( (size_t)num_ttys, sizeof(*writers) );
+   enum LIN_PID_Result_E result = ( writers != NULL ) ? GoodResult : OutOfMemory;
+   for ( int c = 0; c < num_ttys; c++ )
+   {
+      sinks[c].writer = NULL;
+      sinks[c].result = GoodResult;
+   }
+   int num_open = 0;
+   while ( (GoodResult == result) && (num_open < num_ttys) )
+   {
+      result = TTY_Open(argv[first_tty + num_open], baud, &fds[num_open]);
+      if ( (GoodResult == result) && (num_outs > 0) )
+      {
+         const char * out_path = argv[first_out + num_open];
+         outs[num_open] = fopen(out_path, "wb");
+         result = ( outs[num_open] != NULL ) ? CAP_WriterOpen(&writers[num_open], outs[num_open], 0) : CaptureFileUnwritable;
+         sinks[num_open].writer = ( GoodResult == result ) ? &writers[num_open] : NULL;
+         if ( GoodResult != result )
+         {
+            TTY_Close(fds[num_open]);
+         }
+      }
+      num_open += ( GoodResult == result ) ? 1 : 0;
+   }
+
+   if ( GoodResult == result )
+   {
+      if ( !quiet && (0 == num_outs) )
+      {
+         fprintf(stdout, "timestamp,channel,id,pid,data,checksum\n");
+         fflush(stdout);
+      }
+
+      struct TTY_Options_S options = { 0 };
+      options.fds = fds;
+      options.num_channels = (size_t)num_ttys;
+      options.baud = baud;
+      options.checksum = classic ? LOG_CHECKSUM_CLASSIC : LOG_CHECKSUM_LIN2;
+      options.on_frame = TakeCapturedFrame;
+      options.ctx = sinks;
+      result = TTY_Capture(&options, stats);
+   }
+
+   for ( int c = 0; c < num_open; c++ )
+   {
+      result = ( GoodResult == result ) ? sinks[c].result : result;
+      TTY_Close(fds[c]);
+   }
+   for ( int c = 0; c < num_ttys; c++ )
+   {
+      if ( sinks[c].writer != NULL )
+      {
+         enum LIN_PID_Result_E close_result = CAP_WriterClose(sinks[c].writer);
+         result = ( GoodResult == result ) ? close_result : result;
+      }
+      if ( (outs[c] != NULL) && (fclose(outs[c]) != 0) && (GoodResult == result) )
+      {
+         result = CaptureFileUnwritable;
+      }
+   }
+   for ( int c = 0; (result != GoodResult) && (c < num_ttys); c++ )
+   {
+      if ( outs[c] != NULL )
+      {
+         (void)remove(argv[first_out + c]);
+      }
+   }
+   free(writers);
+   if ( result != GoodResult )
+   {
+      PrintErrMsg(result);
+      return EXIT_FAILURE;
+   }
+
+   for ( int c = 0; !quiet && (c < num_ttys); c++ )
+   {
+      const struct TTY_Stats_S * channel = &stats[c];
+      uint64_t errors = channel->sync_errors + channel->framing_errors + channel->pid_errors +
+                        channel->checksum_errors + channel->dropped_bytes;
+      fprintf(stdout, "%s%u %s: %llu frames from %llu bytes (%llu breaks)\n",
+              (0 == c) ? "\n" : "", (unsigned int)(c + 1), argv[first_tty + c],
+              (unsigned long long)channel->frames, (unsigned long long)channel->bytes,
+              (unsigned long long)channel->breaks);
+      fprintf(stdout, "   %s%llu dropped bytes, %llu sync errors, %llu framing errors, %llu PID errors, %llu checksum errors\033[0m, %llu stray bytes\n",
+              (errors > 0) ? "\033[31m" : "\033[32m",
+              (unsigned long long)channel->dropped_bytes, (unsigned long long)channel->sync_errors,
+              (unsigned long long)channel->framing_errors, (unsigned long long)channel->pid_errors,
+              (unsigned long long)channel->checksum_errors, (unsigned long long)channel->stray_bytes);
+   }
+   if ( !quiet )
+   {
+      fprintf(stdout, "\n");
+   }
+   return EXIT_SUCCESS;
+}
+
+/**
+ * @brief lin_pid (--emit-c | --emit-cpp) [--layout table | parity | mask] [--prefix <name>] [--out <header>]
+ *
+ * Writes a C99 (or C++14) header with the PID lookup in the chosen layout,
+ * table by default, and a checksum helper, to stdout unless --out names a
+ * file. The header starts with each layout's size and rough cycle cost; see
+ * lin_emit.h for the layouts themselves.
+ */
+static int EmitMode( int argc, char * argv[] )
+{
+   struct EMIT_Options_S options = { EMIT_C, EMIT_LAYOUT_TABLE, NULL };
+   options.language = ( strcmp("--emit-cpp", argv[1]) == 0 ) ? EMIT_CPP : EMIT_C;
+   bool layout_given = false;
+   const char * out_path = NULL;
+
+   for ( int i = 2; i < argc; i++ )
+   {
+      if ( (strcmp("--layout", argv[i]) == 0) && ((i + 1) < argc) && !layout_given &&
+           EMIT_LayoutFromName(argv[i + 1], &options.layout) )
+      {
+         layout_given = true;
+         i++;
+      }
+      else if ( (strcmp("--prefix", argv[i]) == 0) && ((i + 1) < argc) && (NULL == options.prefix) &&
+                EMIT_PrefixIsValid(argv[i + 1]) )
+      {
+         options.prefix = argv[++i];
+      }
+      else if ( (strcmp("--out", argv[i]) == 0) && ((i + 1) < argc) && (NULL == out_path) )
+      {
+         out_path = argv[++i];
+      }
+      else
+      {
+         PrintErrMsg(InvalidEmitUsage);
+         return EXIT_FAILURE;
+      }
+   }
+   options.prefix = ( options.prefix != NULL ) ? options.prefix : EMIT_DEFAULT_PREFIX;
+
+   FILE * out = ( out_path != NULL ) ? fopen(out_path, "w") : stdout;
+   enum LIN_PID_Result_E result = ( out != NULL ) ? EMIT_Header(out, &options) : EmitFileUnwritable;
+   if ( (out_path != NULL) && (out != NULL) && (fclose(out) != 0) && (GoodResult == result) )
+   {
+      result = EmitFileUnwritable;
+   }
+   if ( (result != GoodResult) && (out_path != NULL) && (out != NULL) )
+   {
+      (void)remove(out_path);
+   }
+   if ( result != GoodResult )
+   {
+      PrintErrMsg(result);
+      return EXIT_FAILURE;
+   }
+   return EXIT_SUCCESS;
+}
+
+/**
+ * @brief One row per ID seen. Quiet rows are the frame count, the periods in
+ *        ms, the error counts, and then every jitter bucket, space-separated.
+ */
+static void PrintIDStats( const struct Stats_Summary_S * summary, bool quiet )
+{
+   assert( summary != NULL );
+
+   if ( !quiet )
+   {
+      fprintf(stdout, "\n%-6s %-6s %-12s %-10s %-10s %-10s %-10s %-10s %-10s %s\n",
+              "ID", "PID", "Frames", "Min(ms)", "Mean(ms)", "Max(ms)", "ParityErrs", "CsumErrs", "NoResponse", "OutOfOrder");
+      fprintf(stdout, "----------------------------------------------------------------------------------------------------------\n");
+   }
+
+   for ( uint8_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      const struct Stats_ID_S * stats = &summary->per_id[id];
+      if ( 0 == stats->frames )
+      {
+         continue;
+      }
+      double min_ms = ( stats->periods > 0 ) ? ((double)stats->period_min_us / 1000.0) : 0.0;
+      double mean_ms = Stats_MeanPeriodUs(stats) / 1000.0;
+      double max_ms = (double)stats->period_max_us / 1000.0;
+
+      if ( quiet )
+      {
+         fprintf(stdout, "0x%02X 0x%02X %llu %.3f %.3f %.3f %llu %llu %llu %llu",
+                 (unsigned int)id, (unsigned int)REFERENCE_PID_TABLE[id],
+                 (unsigned long long)stats->frames, min_ms, mean_ms, max_ms,
+                 (unsigned long long)stats->parity_errors, (unsigned long long)stats->checksum_errors,
+                 (unsigned long long)stats->missing_responses, (unsigned long long)stats->out_of_order);
+         for ( size_t b = 0; b < STATS_JITTER_BUCKETS; b++ )
+         {
+            fprintf(stdout, " %llu", (unsigned long long)stats->jitter[b]);
+         }
+         fprintf(stdout, "\n");
+      }
+      else
+      {
+         bool errors = ( (stats->parity_errors + stats->checksum_errors + stats->missing_responses +
+                          stats->out_of_order) > 0 );
+         fprintf(stdout, "\033[36m0x%02X\033[0m   \033[32m0x%02X\033[0m   %-12llu %-10.3f %-10.3f %-10.3f %s%-10llu %-10llu %-10llu %llu\033[0m\n",
+                 (unsigned int)id, (unsigned int)REFERENCE_PID_TABLE[id],
+                 (unsigned long long)stats->frames, min_ms, mean_ms, max_ms, errors ? "\033[31m" : "",
+                 (unsigned long long)stats->parity_errors, (unsigned long long)stats->checksum_errors,
+                 (unsigned long long)stats->missing_responses, (unsigned long long)stats->out_of_order);
+      }
+   }
+
+   if ( quiet )
+   {
+      return;
+   }
+
+   // Bucket b >= 1 holds jitter under 2^b us
+   fprintf(stdout, "\nPeriod jitter (us), frames per bucket:\n%-6s %-7s", "ID", "0");
+   for ( size_t b = 1; b < (STATS_JITTER_BUCKETS - 1u); b++ )
+   {
+      char label[8];
+      unsigned long bound = 1ul << b;
+      (void)snprintf( label, sizeof(label), (bound >= 1024u) ? "<%luk" : "<%lu",
+                      (bound >= 1024u) ? (bound / 1024u) : bound );
+      fprintf(stdout, "%-7s", label);
+   }
+   fprintf(stdout, ">=%luk\n", (1ul << (STATS_JITTER_BUCKETS - 2u)) / 1024u);
+   for ( uint8_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      const struct Stats_ID_S * stats = &summary->per_id[id];
+      if ( 0 == stats->frames )
+      {
+         continue;
+      }
+      fprintf(stdout, "\033[36m0x%02X\033[0m  ", (unsigned int)id);
+      for ( size_t b = 0; b < STATS_JITTER_BUCKETS; b++ )
+      {
+         fprintf(stdout, ((b + 1u) < STATS_JITTER_BUCKETS) ? " %-6llu" : " %llu\n", (unsigned long long)stats->jitter[b]);
+      }
+   }
+}
+
+/**
+ * @brief One frame as a CSV log line (see lin_log.h).
+ */
+static void PrintCaptureFrame( const struct CAP_Frame_S * frame )
+{
+   assert( (frame != NULL) && (frame->length <= CAP_MAX_FRAME_LEN) );
+
+   // "XX XX ... XX"
+   char data[3u * CAP_MAX_FRAME_LEN] = { 0 };
+   for ( uint8_t i = 0; i < frame->length; i++ )
+   {
+      size_t pos = (3u * i) - ((i > 0) ? 1u : 0u);
+      (void)snprintf( &data[pos], sizeof(data) - pos, (i > 0) ? " %02X" : "%02X", (unsigned int)frame->data[i] );
+   }
+
+   fprintf(stdout, "%llu.%06llu,%u,0x%02X,0x%02X,%s,%02X\n",
+           (unsigned long long)(frame->timestamp_us / 1000000u),
+           (unsigned long long)(frame->timestamp_us % 1000000u),
+           (unsigned int)frame->channel, (unsigned int)frame->id, (unsigned int)frame->pid,
+           data, (unsigned int)frame->checksum);
+}
+
+/**
+ * @brief One line per message: when it started, NAD, direction, SID, and the
+ *        rest of its bytes. Quiet lines are just those fields, space-separated.
+ */
+static void PrintTPMessage( const struct TP_Message_S * message, void * ctx )
+{
+   assert( (message != NULL) && (ctx != NULL) && (message->length > 0) );
+
+   bool quiet = *(const bool *)ctx;
+   const char * direction = message->response ? "resp" : "req";
+
+   if ( quiet )
+   {
+      fprintf(stdout, "%llu.%06llu 0x%02X %s %u",
+              (unsigned long long)(message->first_us / 1000000u),
+              (unsigned long long)(message->first_us % 1000000u),
+              (unsigned int)message->nad, direction, (unsigned int)message->length);
+   }
+   else
+   {
+      bool negative = ( TP_SID_NEGATIVE_RESPONSE == message->data[0] ) && (message->length >= 3u);
+      fprintf(stdout, "%llu.%06llu  NAD \033[36m0x%02X\033[0m  %-4s  SID %s0x%02X\033[0m  %4u bytes",
+              (unsigned long long)(message->first_us / 1000000u),
+              (unsigned long long)(message->first_us % 1000000u),
+              (unsigned int)message->nad, direction, negative ? "\033[31m" : "\033[32m",
+              (unsigned int)message->data[0], (unsigned int)message->length);
+      if ( negative )
+      {
+         fprintf(stdout, "  \033[31mnegative response to 0x%02X, NRC 0x%02X\033[0m\n",
+                 (unsigned int)message->data[1], (unsigned int)message->data[2]);
+         return;
+      }
+      fprintf(stdout, ":");
+   }
+
+   for ( size_t i = quiet ? 0u : 1u; i < message->length; i++ )
+   {
+      fprintf(stdout, " %02X", (unsigned int)message->data[i]);
+   }
+   fprintf(stdout, "\n");
+}
+
+/**
+ * @brief Quiet lines carry the TP_Error_E value rather than its name, so every
+ *        field stays one word.
+ */
+static void PrintTPError( const struct TP_Error_S * error, void * ctx )
+{
+   assert( (error != NULL) && (ctx != NULL) );
+
+   bool quiet = *(const bool *)ctx;
+   const char * direction = error->response ? "resp" : "req";
+
+   if ( quiet )
+   {
+      fprintf(stdout, "%llu.%06llu 0x%02X %s error %d",
+              (unsigned long long)(error->timestamp_us / 1000000u),
+              (unsigned long long)(error->timestamp_us % 1000000u),
+              (unsigned int)error->nad, direction, (int)error->kind);
+   }
+   else
+   {
+      fprintf(stdout, "%llu.%06llu  NAD \033[36m0x%02X\033[0m  %-4s  \033[31m%s\033[0m",
+              (unsigned long long)(error->timestamp_us / 1000000u),
+              (unsigned long long)(error->timestamp_us % 1000000u),
+              (unsigned int)error->nad, direction, TP_ErrorName(error->kind));
+   }
+
+   if ( TP_ERROR_SEQUENCE == error->kind )
+   {
+      fprintf(stdout, quiet ? " %u %u" : ": expected SN %u, got %u",
+              (unsigned int)error->expected_sn, (unsigned int)error->sn);
+   }
+   if ( error->length > 0 )
+   {
+      fprintf(stdout, quiet ? " %u %u" : " (%u of %u bytes)",
+              (unsigned int)error->received, (unsigned int)error->length);
+   }
+   fprintf(stdout, "\n");
+}
+
+static void TakeSampledFrame( const struct CAP_Frame_S * frame, void * ctx )
+{
+   assert( (frame != NULL) && (ctx != NULL) );
+
+   struct SampledFrameSink_S * sink = (struct SampledFrameSink_S *)ctx;
+   if ( NULL == sink->writer )
+   {
+      PrintCaptureFrame(frame);
+   }
+   else if ( GoodResult == sink->result )
+   {
+      sink->result = CAP_WriteFrame(sink->writer, frame);
+   }
+}
+
+/**
+ * @brief Counts, then the latency percentiles and a histogram with one row
+ *        per power of 2 of ns that has any samples. Quiet is one line: the
+ *        counts, then latency samples and min, mean, p50, p90, p99, p99.9,
+ *        and max in ns.
+ */
+static void PrintNodeStats( const struct Node_Stats_S * stats, enum Node_Role_E role, bool quiet )
+{
+   assert( stats != NULL );
+
+   const struct Hist_S * latency = &stats->latency;
+   uint64_t min_ns = ( latency->count > 0 ) ? latency->min : 0u;
+   const double pcts[] = { 50.0, 90.0, 99.0, 99.9 };
+   uint64_t pct_ns[sizeof(pcts) / sizeof(pcts[0])];
+   for ( size_t p = 0; p < (sizeof(pcts) / sizeof(pcts[0])); p++ )
+   {
+      pct_ns[p] = Hist_Percentile(latency, pcts[p]);
+   }
+   if ( quiet )
+   {
+      fprintf(stdout, "%llu %llu %llu %llu %llu %llu %llu %llu %llu %llu %.0f %llu %llu %llu %llu %llu\n",
+              (unsigned long long)stats->headers, (unsigned long long)stats->responses,
+              (unsigned long long)stats->no_responses, (unsigned long long)stats->checksum_errors,
+              (unsigned long long)stats->pid_errors, (unsigned long long)stats->stray_bytes,
+              (unsigned long long)stats->late_slots, (unsigned long long)stats->dropped_writes,
+              (unsigned long long)latency->count, (unsigned long long)min_ns, Hist_Mean(latency),
+              (unsigned long long)pct_ns[0], (unsigned long long)pct_ns[1],
+              (unsigned long long)pct_ns[2], (unsigned long long)pct_ns[3],
+              (unsigned long long)latency->max);
+      return;
+   }
+
+   uint64_t errors = stats->checksum_errors + stats->pid_errors + stats->stray_bytes + stats->dropped_writes;
+   fprintf(stdout, "\n%llu headers %s, %llu responses, %llu unanswered\n",
+           (unsigned long long)stats->headers, (NODE_MASTER == role) ? "sent" : "seen",
+           (unsigned long long)stats->responses, (unsigned long long)stats->no_responses);
+   fprintf(stdout, "%s%llu checksum errors, %llu PID errors, %llu stray bytes, %llu dropped writes\033[0m, %llu late slots\n",
+           (errors > 0) ? "\033[31m" : "\033[32m",
+           (unsigned long long)stats->checksum_errors, (unsigned long long)stats->pid_errors,
+           (unsigned long long)stats->stray_bytes, (unsigned long long)stats->dropped_writes,
+           (unsigned long long)stats->late_slots);
+   fprintf(stdout, "\nResponse latency over %llu responses (us): min %.3f, mean %.3f, p50 %.3f, p90 %.3f, p99 %.3f, p99.9 %.3f, max %.3f\n",
+           (unsigned long long)latency->count, (double)min_ns / 1000.0, Hist_Mean(latency) / 1000.0,
+           (double)pct_ns[0] / 1000.0, (double)pct_ns[1] / 1000.0,
+           (double)pct_ns[2] / 1000.0, (double)pct_ns[3] / 1000.0,
+           (double)latency->max / 1000.0);
+
+   uint64_t rows[HIST_MAX_BITS + 1u];
+   uint64_t peak = 0;
+   for ( unsigned int k = 0; k <= HIST_MAX_BITS; k++ )
+   {
+      uint64_t low = ( 0 == k ) ? 0u : (UINT64_C(1) << (k - 1u));
+      uint64_t high = ( HIST_MAX_BITS == k ) ? UINT64_MAX : (UINT64_C(1) << k);
+      rows[k] = Hist_CountBetween(latency, low, high);
+      peak = ( rows[k] > peak ) ? rows[k] : peak;
+   }
+   for ( unsigned int k = 0; k <= HIST_MAX_BITS; k++ )
+   {
+      if ( 0 == rows[k] )
+      {
+         continue;
+      }
+      uint64_t low = ( 0 == k ) ? 0u : (UINT64_C(1) << (k - 1u));
+      unsigned int bar = (unsigned int)( (rows[k] * 40u + peak - 1u) / peak );
+      fprintf(stdout, "   %12.3f us  %10llu  \033[36m%.*s\033[0m\n",
+              (double)low / 1000.0, (unsigned long long)rows[k],
+              (int)bar, "########################################");
+   }
+   fprintf(stdout, "\n");
+}
+
+/**
+ * @brief On SIGUSR1, the stats so far, as they'd be printed at the end.
+ */
+static void ReportNodeStats( const struct Node_Stats_S * stats, void * ctx )
+{
+   assert( (stats != NULL) && (ctx != NULL) );
+
+   const struct NodeReport_S * report = (const struct NodeReport_S *)ctx;
+   PrintNodeStats(stats, report->role, report->quiet);
+   fflush(stdout);
+}
+
+static void TakeCapturedFrame( const struct CAP_Frame_S * frame, void * ctx )
+{
+   assert( (frame != NULL) && (ctx != NULL) && (frame->channel > 0) );
+
+   // One sink per channel, in channel order
+   struct SampledFrameSink_S * sinks = (struct SampledFrameSink_S *)ctx;
+   TakeSampledFrame(frame, &sinks[frame->channel - 1u]);
+}
+
+#ifndef NDEBUG
+
+STATIC int UInt8_Cmp( const void * a, const void * b )
+{
+   assert( (a != NULL) && (b != NULL) );
+
+   uint8_t * c = (uint8_t *)a;
+   uint8_t * d = (uint8_t *)b;
+
+   return ( *c - *d );
+}
+
+#endif
+
+/**
+ * @brief Determines the numeric format of the given string entry.
+ *
+ * This function analyzes the input string and identifies its numeric format,
+ * based on a list of supported formats.
+ * 
+ * @note str is assumed to be a valid ID entry! Do not call this function before
+ *       passing the string through GetID.
+ *
+ * @param str Pointer to the null-terminated string to be analyzed.
+ * @return NumericFormat_E enunm indicating the detected format.
+ */
+STATIC enum NumericFormat_E DetermineEntryFormat( const char * str,
+                                                  bool ishex,
+                                                  bool isdec )
+{
+   assert( (str != NULL) && (str[0] != '\0') );
+
+   // Let's try this /w regex, just for fun.
+   for ( int i = 0; i < NUM_OF_NUMERIC_FORMATS; i++ )
+   {
+      if ( (ishex && NumericFormats[i].isdec) || (isdec && NumericFormats[i].ishex) )
+      {
+         continue;
+      }
+#ifdef LIN_PID_FAST_START
+      if ( MatchFormatPattern( NumericFormats[i].regex_pattern, str ) )
+#else
+      int match_len; // don't care about this but tiny-regex-c expects it
+      if ( re_match( NumericFormats[i].regex_pattern, str, &match_len) != -1 )
+#endif
+      {
+         return (enum NumericFormat_E)i;
+      }
+   }
+
+   return INVALID_NUMERIC_FORMAT;
+}
+
+#if defined(LIN_PID_FAST_START) || defined(TEST)
+
+static bool MatchFormatPatternHere( const char * pattern, const char * str );
+
+/**
+ * @brief Regex-free stand-in for re_match() over the patterns in
+ *        lin_pid_supported_formats.h.
+ *
+ * Only the subset those patterns use is understood: the ^ and $ anchors,
+ * literal characters, [...] classes with ranges, and the ? quantifier. There
+ * is nothing to compile, so the fast-start build pays no regex set-up cost per
+ * pattern and doesn't need to link tiny-regex-c at all.
+ *
+ * @param pattern One of the regex patterns from lin_pid_supported_formats.h.
+ * @param str Null-terminated string to match.
+ * @return true if the whole of str matches pattern.
+ */
+STATIC bool MatchFormatPattern( const char * pattern, const char * str )
+{
+   assert( (pattern != NULL) && (str != NULL) );
+
+   if ( '^' == *pattern )
+   {
+      pattern++;
+   }
+
+   return MatchFormatPatternHere( pattern, str );
+}
+
+static bool MatchFormatPatternHere( const char * pattern, const char * str )
+{
+   if ( '\0' == *pattern )
+   {
+      return true;
+   }
+   else if ( ('$' == pattern[0]) && ('\0' == pattern[1]) )
+   {
+      return ( '\0' == *str );
+   }
+
+   // Figure out where this atom ends and whether the current char satisfies it
+   const char * atom_end = pattern + 1;
+   bool atom_matches = false;
+   if ( '[' == *pattern )
+   {
+      const char * p = pattern + 1;
+      while ( (*p != ']') && (*p != '\0') )
+      {
+         if ( ('-' == p[1]) && (p[2] != ']') && (p[2] != '\0') )
+         {
+            atom_matches = atom_matches || ( (*str >= p[0]) && (*str <= p[2]) );
+            p += 3;
+         }
+         else
+         {
+            atom_matches = atom_matches || (*str == *p);
+            p++;
+         }
+      }
+      assert( ']' == *p ); // Malformed class in lin_pid_supported_formats.h
+      atom_end = p + 1;
+   }
+   else
+   {
+      atom_matches = (*str == *pattern);
+   }
+   atom_matches = atom_matches && (*str != '\0');
+
+   if ( '?' == *atom_end )
+   {
+      return ( atom_matches && MatchFormatPatternHere(atom_end + 1, str + 1) ) ||
+             MatchFormatPatternHere(atom_end + 1, str);
+   }
+
+   return atom_matches && MatchFormatPatternHere(atom_end, str + 1);
+}
+
+#endif
+
+/**
+ * @brief Look a token up among every in-range spelling of an ID that a format
+ *        in lin_pid_supported_formats.h mirrors.
+ *
+ * The token's (at most four) bytes, with the --hex/--dec flag in bit 7 of the
+ * first two, make a 32-bit key, and lin_pid_id_spellings.h hashes every valid
+ * key to a slot of its own. So one probe gives the ID, the format to echo it
+ * in and GetID()'s hex/dec verdict, where GetID() and DetermineEntryFormat()
+ * would walk the state machine and then the regexes.
+ *
+ * @param str Null-terminated token.
+ * @param ishex Whether --hex was given.
+ * @param isdec Whether --dec was given.
+ * @return The spelling, or NULL if GetID() has to have a look at str: it's
+ *         malformed, out of range, padded with blanks, or one of the few
+ *         spellings no format mirrors.
+ */
+STATIC const struct IDSpelling_S * LookupIDSpelling( const char * str,
+                                                     bool ishex,
+                                                     bool isdec )
+{
+   assert( (str != NULL) && !(ishex && isdec) );
+
+   uint32_t key = 0;
+   size_t len = 0;
+   for ( ; str[len] != '\0'; len++ )
+   {
+      // Anything past ASCII would land on the flag bits, and no valid ID has it
+      if ( (len >= ID_SPELLING_MAX_LEN) ||
+           !CHAR_IS(str[len], CHAR_HEX_DIGIT | CHAR_HEX_SUFFIX | CHAR_DEC_SUFFIX) )
+      {
+         return NULL;
+      }
+      key |= (uint32_t)(unsigned char)str[len] << (8u * len);
+   }
+   if ( 0 == len )
+   {
+      return NULL; // Would otherwise match any empty slot
+   }
+
+   if ( ishex )
+   {
+      key |= ID_SPELLING_KEY_HEX;
+   }
+   else if ( isdec )
+   {
+      key |= ID_SPELLING_KEY_DEC;
+   }
+
+   return ProbeIDSpelling(key);
+}
+
+/**
+ * @brief Slot of a key in IDSpellings[]. Hash and displace: the key's bucket
+ *        picks a seed, chosen by scripts/gen_id_spellings.py so that every key
+ *        in the bucket lands in a slot nothing else uses. Keep the two in step.
+ */
+static inline uint32_t IDSpellingSlot( uint32_t key )
+{
+   uint32_t seed = IDSpellingSeeds[ (key * 0x9E3779B1u) >> (32u - ID_SPELLING_BUCKET_BITS) ];
+   uint32_t h = (key ^ seed) * 0x85EBCA6Bu;
+   h ^= h >> 13;
+   h *= 0xC2B2AE35u;
+   return h >> (32u - ID_SPELLING_SLOT_BITS);
+}
+
+static inline const struct IDSpelling_S * ProbeIDSpelling( uint32_t key )
+{
+   const struct IDSpelling_S * spelling = &IDSpellings[ IDSpellingSlot(key) ];
+   return ( spelling->key == key ) ? spelling : NULL;
+}
+
+/**
+ * @brief Bit 7 set in each byte of word that's a CHAR_TOKEN_DELIM: NUL, '\t'
+ *        to '\r', ' ' or ','.
+ *
+ * Plain 64-bit arithmetic, exact for every byte value: each compare is done
+ * on the low seven bits, where adding up to 0x80 can't carry into the next
+ * byte, and bytes past ASCII are masked off at the end.
+ */
+static inline uint64_t TokenDelimiters( uint64_t word )
+{
+   uint64_t low7 = word & SWAR_LOW7S;
+
+   // low7 + (0x80 - c) has bit 7 set where the byte is at least c...
+   uint64_t at_least_tab = low7 + ( SWAR_ONES * (0x80u - '\t') );
+   uint64_t past_cr = low7 + ( SWAR_ONES * (0x80u - '\r' - 1u) );
+
+   // ...and (low7 ^ c) + 0x7F has it clear where the byte is c
+   uint64_t not_nul = low7 + SWAR_LOW7S;
+   uint64_t not_space = ( low7 ^ (SWAR_ONES * (uint64_t)' ') ) + SWAR_LOW7S;
+   uint64_t not_comma = ( low7 ^ (SWAR_ONES * (uint64_t)',') ) + SWAR_LOW7S;
+
+   uint64_t delimiters = ( at_least_tab & ~past_cr ) | ~not_nul | ~not_space | ~not_comma;
+   return delimiters & ~word & SWAR_HIGHS;
+}
+
+/**
+ * @brief Eight bytes, the first in the low byte. Spelled out rather than
+ *        looped so that compilers see a single load where the byte order
+ *        allows (GCC 12 keeps a loop's eight loads).
+ */
+static inline uint64_t LoadWord( const char * src )
+{
+   const unsigned char * bytes = (const unsigned char *)src;
+   return   (uint64_t)bytes[0]          | ( (uint64_t)bytes[1] << 8 )  |
+          ( (uint64_t)bytes[2] << 16 )  | ( (uint64_t)bytes[3] << 24 ) |
+          ( (uint64_t)bytes[4] << 32 )  | ( (uint64_t)bytes[5] << 40 ) |
+          ( (uint64_t)bytes[6] << 48 )  | ( (uint64_t)bytes[7] << 56 );
+}
+
+/**
+ * @brief The first n bytes of a word, for the end of a buffer.
+ */
+static inline uint64_t LoadBytes( const char * src, size_t n )
+{
+   assert( n <= 8u );
+
+   uint64_t word = 0;
+   for ( size_t i = 0; i < n; i++ )
+   {
+      word |= (uint64_t)(unsigned char)src[i] << (8u * i);
+   }
+   return word;
+}
+
+/**
+ * @brief Which byte of a word is the first with bit 7 set in marks.
+ */
+static inline size_t FirstMarkedByte( uint64_t marks )
+{
+   assert( marks != 0u );
+
+#ifdef __GNUC__
+   return (size_t)__builtin_ctzll( (unsigned long long)marks ) / 8u;
+#else
+   size_t byte = 0;
+   for ( ; 0u == (marks & 0x80u); marks >>= 8 )
+   {
+      byte++;
+   }
+   return byte;
+#endif
+}
+
+/**
+ * @brief Index of the first byte from from on that is (or, for !delimiter,
+ *        isn't) a CHAR_TOKEN_DELIM; len if there isn't one.
+ */
+static size_t NextTokenEdge( const char * data, size_t from, size_t len, bool delimiter )
+{
+   uint64_t flip = delimiter ? 0u : SWAR_HIGHS;
+   for ( size_t pos = from; pos < len; pos += 8u )
+   {
+      size_t avail = len - pos;
+      uint64_t hits;
+      if ( avail >= 8u )
+      {
+         hits = TokenDelimiters( LoadWord(data + pos) ) ^ flip;
+      }
+      else
+      {
+         // The zeros loaded past the end would count as NULs
+         uint64_t in_data = ( UINT64_C(1) << (8u * avail) ) - 1u;
+         hits = ( TokenDelimiters( LoadBytes(data + pos, avail) ) ^ flip ) & in_data;
+      }
+
+      if ( hits != 0u )
+      {
+         return pos + FirstMarkedByte(hits);
+      }
+   }
+
+   return len;
+}
+
+/**
+ * @brief ParseID() of one token of ParseIDs(), which needn't be terminated.
+ *
+ * @param word The token's first bytes as LoadWord() has them, and maybe
+ *        some of what follows it.
+ */
+static inline enum LIN_PID_Result_E ParseIDToken( const char * token,
+                                                  size_t len,
+                                                  uint64_t word,
+                                                  bool ishex,
+                                                  bool isdec,
+                                                  uint8_t * id )
+{
+   assert( (token != NULL) && (len > 0) && (id != NULL) );
+
+   if ( len <= ID_SPELLING_MAX_LEN )
+   {
+      uint32_t key = (uint32_t)( word & ((UINT64_C(1) << (8u * len)) - 1u) );
+
+      // Bytes past ASCII would land on the flag bits, and no valid ID has one
+      if ( 0u == (key & 0x80808080u) )
+      {
+         if ( ishex )
+         {
+            key |= ID_SPELLING_KEY_HEX;
+         }
+         else if ( isdec )
+         {
+            key |= ID_SPELLING_KEY_DEC;
+         }
+
+         const struct IDSpelling_S * spelling = ProbeIDSpelling(key);
+         if ( spelling != NULL )
+         {
+            *id = spelling->id;
+            return GoodResult;
+         }
+      }
+   }
+
+   return ParseUnterminatedID( token, len, ishex, isdec, id );
+}
+
+/**
+ * @brief ParseID() of a token that isn't null-terminated, for the ones the
+ *        hash doesn't hold (errors, mostly), out of ParseIDToken()'s way.
+ */
+static enum LIN_PID_Result_E ParseUnterminatedID( const char * token,
+                                                  size_t len,
+                                                  bool ishex,
+                                                  bool isdec,
+                                                  uint8_t * id )
+{
+   // As much of the token as GetID() would read
+   char str[ID_TOKEN_PREFIX_LEN + 1];
+   size_t str_len = ( len < ID_TOKEN_PREFIX_LEN ) ? len : ID_TOKEN_PREFIX_LEN;
+   memcpy( str, token, str_len );
+   str[str_len] = '\0';
+   return ParseID( str, ishex, isdec, id );
+}
+
+/**
+ * @brief Render value as one of the formats in lin_pid_supported_formats.h
+ *        does, given that format's pieces. Each FormatNumber_<format>() passes
+ *        its own as constants, so once this is inlined there's no format left
+ *        to interpret: just the digit loop and a few stores.
+ *
+ * @param buf Output buffer of at least MAX_OUTPUT_LEN. Not null-terminated.
+ * @param value Number to render, at most UINT8_MAX.
+ * @param width Minimum number of digits, zero-padded.
+ * @param upper Uppercase hex digits.
+ * @return Number of characters written to buf.
+ */
+static inline size_t FormatNumber( char * buf,
+                                   unsigned int value,
+                                   const char * prefix,
+                                   size_t prefix_len,
+                                   size_t width,
+                                   unsigned int base,
+                                   bool upper,
+                                   const char * suffix,
+                                   size_t suffix_len )
+{
+   assert( (buf != NULL) && (value <= UINT8_MAX) && ((10u == base) || (16u == base)) );
+
+   const char * digit_chars = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+   char digits[3];      // UINT8_MAX in decimal
+   size_t num_digits = 0;
+   do
+   {
+      digits[num_digits++] = digit_chars[value % base];
+      value /= base;
+   } while ( (value > 0u) && (num_digits < sizeof(digits)) );
+   while ( (num_digits < width) && (num_digits < sizeof(digits)) )
+   {
+      digits[num_digits++] = '0';
+   }
+
+   memcpy( buf, prefix, prefix_len );
+   size_t len = prefix_len;
+   while ( num_digits > 0u )
+   {
+      buf[len++] = digits[--num_digits];
+   }
+   memcpy( buf + len, suffix, suffix_len );
+
+   return len + suffix_len;
+}
+
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd, pre, width, base, upper, suf ) \
+   static size_t FormatNumber_##enum( char * buf, unsigned int value )                          \
+   {                                                                                            \
+      return FormatNumber( buf, value, pre, sizeof(pre) - 1u, width, base, upper, suf, sizeof(suf) - 1u ); \
+   }
+
+#include "lin_pid_supported_formats.h"
+
+#undef LIN_PID_NUMERIC_FORMAT
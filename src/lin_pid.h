@@ -10,9 +10,17 @@
  * @copyright MIT License
  */
 
+#ifndef LIN_PID_H
+#define LIN_PID_H
+
 /* File Inclusions */
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /* Public Macro Definitions */
 #define LIN_2p0_MAX_ID  0x3Fu
@@ -36,15 +44,15 @@ enum LIN_PID_Result_E
 /**
  * @brief Print out the LIN 2.1 based Protected ID given an ID.
  *
- * This function is exposed for testing purposes. It simulates a main-like
- * function that takes command-line arguments, computes the LIN Protected ID,
- * and prints the result to the terminal.
+ * This function is exposed for testing and benchmarking purposes. It simulates
+ * a main-like function that takes command-line arguments, computes the LIN
+ * Protected ID, and prints the result to the terminal.
  *
  * @param[in] argc The number of command-line arguments.
  * @param[in] argv The array of command-line arguments.
  * @return Returns 0 on success, or a non-zero value on failure.
  */
-#ifdef TEST
+#if defined(TEST) || defined(BENCHMARK)
 int lin_pid_cli(int argc, char * argv[]);
 #endif
 
@@ -60,3 +68,57 @@ int lin_pid_cli(int argc, char * argv[]);
  */
 uint8_t ComputePID(uint8_t id);
 
+/**
+ * @brief Parse an ID token the same way the CLI parses its ID argument.
+ *
+ * Accepts every spelling in lin_pid_supported_formats.h (0x27, 27h, 39d, ...).
+ *
+ * @param[in] str Null-terminated token.
+ * @param[in] ishex Treat the token as hexadecimal, as with --hex.
+ * @param[in] isdec Treat the token as decimal, as with --dec.
+ * @param[out] id The parsed ID.
+ * @return GoodResult, or the exception describing why the token isn't a valid ID.
+ */
+enum LIN_PID_Result_E ParseID(const char * str, bool ishex, bool isdec, uint8_t * id);
+
+/**
+ * @brief ParseID() over every token in a buffer of them, e.g., a chunk of
+ *        IDs piped in on stdin.
+ *
+ * Tokens are separated by any run of whitespace, ',' or NUL. A token only
+ * counts once the delimiter after it is in the buffer, so one cut off at the
+ * end is left for the next call: pass data + *consumed again with more bytes
+ * after it, or with a delimiter once there are no more.
+ *
+ * @param[in] data Tokens; needn't be null-terminated.
+ * @param[in] len Bytes in data.
+ * @param[in] ishex Treat every token as hexadecimal, as with --hex.
+ * @param[in] isdec Treat every token as decimal, as with --dec.
+ * @param[out] ids The ID of each token; only meaningful where results[] is GoodResult.
+ * @param[out] results What ParseID() would return for each token.
+ * @param[in] max_ids Room in ids[] and results[].
+ * @param[out] consumed Bytes of data the returned tokens (and delimiters) took up.
+ * @return The number of tokens parsed.
+ */
+size_t ParseIDs( const char * data,
+                 size_t len,
+                 bool ishex,
+                 bool isdec,
+                 uint8_t * ids,
+                 enum LIN_PID_Result_E * results,
+                 size_t max_ids,
+                 size_t * consumed );
+
+/**
+ * @brief Look up the PID for an ID in the reference table.
+ *
+ * @param[in] id The 6-bit frame identifier (0x00 to 0x3F).
+ * @return The PID, or INVALID_PID if id is out of range.
+ */
+uint8_t ReferencePID(uint8_t id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LIN_PID_H
@@ -0,0 +1,635 @@
+/*!
+ * @file    lin_pid.hpp
+ * @brief   Header-only C++ API: PIDs computed, checked and parsed at compile
+ *          time, plus batch calls over whole buffers of IDs.
+ *
+ * Needs C++17. Everything is constexpr, so a PID or a parsed ID can be a
+ * compile-time constant:
+ *
+ *    static_assert( lin_pid::compute_pid(0x3C) == 0x3C );
+ *    static_assert( lin_pid::parse_id("27h").id == 0x27 );
+ *
+ * The batch calls take std::span under C++20 and a pointer and a length
+ * under C++17. Nothing here calls into the C library, so there's nothing to
+ * link; lin_pid.h is only included for its macros and LIN_PID_Result_E, and
+ * lin_char.h for the character classes.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_PID_HPP
+#define LIN_PID_HPP
+
+/* File Inclusions */
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#if __has_include(<version>)
+#include <version>
+#endif
+#ifdef __cpp_lib_span
+#include <span>
+#endif
+#include "lin_pid.h"
+#include "lin_char.h"
+
+namespace lin_pid
+{
+
+/* Public Datatypes */
+
+/**
+ * @brief What parse_id() makes of a token: GoodResult and the ID, or the
+ *        exception the CLI would have printed for it (and an ID of 0).
+ */
+struct parsed_id
+{
+   LIN_PID_Result_E result;
+   std::uint8_t id;
+};
+
+/* Public API */
+
+/**
+ * @brief The PID for an ID, from the parity equations in LIN 2.1 section
+ *        2.3.1.3 (P0 = ID0^ID1^ID2^ID4, P1 = !(ID1^ID3^ID4^ID5)).
+ *
+ * @return The PID, or INVALID_PID if id is past MAX_ID_ALLOWED.
+ */
+constexpr std::uint8_t compute_pid( std::uint8_t id ) noexcept
+{
+   if ( id > MAX_ID_ALLOWED )
+   {
+      return INVALID_PID;
+   }
+   const unsigned int bits = id;
+   const unsigned int p0 = ( bits ^ (bits >> 1) ^ (bits >> 2) ^ (bits >> 4) ) & 1u;
+   const unsigned int p1 = ~( (bits >> 1) ^ (bits >> 3) ^ (bits >> 4) ^ (bits >> 5) ) & 1u;
+   return static_cast<std::uint8_t>( bits | (p0 << 6) | (p1 << 7) );
+}
+
+/**
+ * @brief Whether a received PID's parity bits are right for its ID.
+ */
+constexpr bool validate_pid( std::uint8_t pid ) noexcept
+{
+   return compute_pid( static_cast<std::uint8_t>(pid & MAX_ID_ALLOWED) ) == pid;
+}
+
+namespace detail
+{
+
+constexpr std::array<std::uint8_t, MAX_ID_ALLOWED + 1u> make_pid_table() noexcept
+{
+   std::array<std::uint8_t, MAX_ID_ALLOWED + 1u> table {};
+   for ( std::size_t id = 0; id < table.size(); id++ )
+   {
+      table[id] = compute_pid( static_cast<std::uint8_t>(id) );
+   }
+   return table;
+}
+
+// The table lin_pid.c checks ComputePID() against
+constexpr std::array<std::uint8_t, MAX_ID_ALLOWED + 1u> reference_pid_table =
+{
+   #include "lin_pid_reference_table.h"
+};
+
+// std::array's == only became constexpr in C++20
+template <std::size_t N>
+constexpr bool tables_match( const std::array<std::uint8_t, N> & a,
+                             const std::array<std::uint8_t, N> & b ) noexcept
+{
+   for ( std::size_t i = 0; i < N; i++ )
+   {
+      if ( a[i] != b[i] )
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+// Char_Class[] from lin_char.c, as a compile-time constant
+constexpr std::array<std::uint16_t, 256> char_class =
+{
+   #include "lin_char_class_table.h"
+};
+
+constexpr bool char_is( char ch, unsigned int classes ) noexcept
+{
+   return ( char_class[static_cast<unsigned char>(ch)] & classes ) != 0u;
+}
+
+constexpr bool is_digit( char ch ) noexcept
+{
+   return char_is( ch, CHAR_DEC_DIGIT );
+}
+
+constexpr bool is_xdigit( char ch ) noexcept
+{
+   return char_is( ch, CHAR_HEX_DIGIT );
+}
+
+constexpr bool is_blank( char ch ) noexcept
+{
+   return char_is( ch, CHAR_BLANK );
+}
+
+constexpr bool is_hex_prefix( char ch ) noexcept
+{
+   return char_is( ch, CHAR_HEX_PREFIX );
+}
+
+constexpr bool is_hex_marker( char ch ) noexcept
+{
+   return char_is( ch, CHAR_HEX_SUFFIX );
+}
+
+constexpr bool is_dec_suffix( char ch ) noexcept
+{
+   return char_is( ch, CHAR_DEC_SUFFIX );
+}
+
+constexpr std::uint8_t digit_value( char ch ) noexcept
+{
+   return static_cast<std::uint8_t>( char_class[static_cast<unsigned char>(ch)] & CHAR_VALUE_MASK );
+}
+
+// Same bound the CLI puts on a token: strlen("0x3F") + 1
+constexpr std::size_t max_num_len = 5u;
+
+/**
+ * @brief GetID() from lin_pid.c, state for state, over a string_view. It and
+ *        get_id() in scripts/gen_id_spellings.py have to agree with GetID()
+ *        on every token, so change all three together.
+ *        test_parse_id_AgreesWithParseID (test_lin_pid_hpp.cpp) checks this
+ *        one against GetID().
+ */
+constexpr parsed_id get_id( std::string_view str, bool ishex, bool isdec ) noexcept
+{
+   std::size_t idx = 0;
+   auto at = [&str]( std::size_t i ) constexpr -> char
+   {
+      return ( i < str.size() ) ? str[i] : '\0';
+   };
+
+   // Skip over any leading whitespace
+   for ( std::size_t n = 0; (n <= (max_num_len * 2u)) && (at(idx) != '\0') && is_blank(at(idx)); n++ )
+   {
+      idx++;
+   }
+   if ( at(idx) == '\0' )
+   {
+      return { WhiteSpaceOnlyIDArg, 0 };
+   }
+
+   enum class state
+   {
+      init,
+      one_zero_in,
+      hex_prefix,
+      indeterminate_one_digit_in,
+      indeterminate_two_digits_in,
+      one_dec_digit,
+      two_dec_digits,
+      hex_digits,
+      two_hex_digits,
+      two_zeros_in,
+      two_digits_already_read,
+      preemptively_hex,
+      preemptively_dec,
+      preemptively_dec_one_zero_in,
+      preemptively_dec_two_zeros_in
+   };
+   state s = ishex ? state::preemptively_hex : ( isdec ? state::preemptively_dec : state::init );
+   LIN_PID_Result_E result = GoodResult;
+   std::size_t count = 0;
+   bool exit_loop = false;
+   char first_digit = '\0';
+   char second_digit = '\0';
+   bool assume_hex = ishex;
+   bool assume_dec = isdec;
+   bool hex_prefix_already_encountered = false;
+
+   auto fail = [&result, &exit_loop]( LIN_PID_Result_E e ) constexpr
+   {
+      result = e;
+      exit_loop = true;
+   };
+
+   while ( (count <= max_num_len) && (at(idx) != '\0') && !exit_loop )
+   {
+      const char ch = at(idx);
+      switch ( s )
+      {
+         case state::init:
+            if ( '0' == ch )
+            {
+               first_digit = ch;
+               s = state::one_zero_in;
+            }
+            else if ( is_xdigit(ch) )
+            {
+               if ( is_digit(ch) )
+               {
+                  s = state::indeterminate_one_digit_in;
+               }
+               else
+               {
+                  assume_hex = true;
+                  s = state::hex_digits;
+               }
+               first_digit = ch;
+            }
+            else if ( is_hex_prefix(ch) )
+            {
+               assume_hex = true;
+               hex_prefix_already_encountered = true;
+               s = state::hex_prefix;
+            }
+            else
+            {
+               fail( InvalidCharacterEncountered_FirstChar );
+            }
+            break;
+
+         case state::one_zero_in:
+            if ( '0' == ch )
+            {
+               second_digit = ch;
+               s = state::two_zeros_in;
+            }
+            else if ( is_hex_prefix(ch) )
+            {
+               assume_hex = true;
+               hex_prefix_already_encountered = true;
+               s = state::hex_prefix;
+            }
+            else if ( is_xdigit(ch) )
+            {
+               if ( !is_digit(ch) )
+               {
+                  assume_hex = true;
+                  s = state::two_hex_digits;
+               }
+               else
+               {
+                  s = state::indeterminate_two_digits_in;
+               }
+               first_digit = ch;
+            }
+            else if ( is_hex_marker(ch) )
+            {
+               assume_hex = true;
+               s = state::two_digits_already_read;
+            }
+            else
+            {
+               fail( InvalidDigitEncountered_SecondDigit );
+            }
+            break;
+
+         case state::hex_prefix:
+            if ( is_xdigit(ch) )
+            {
+               first_digit = ch;
+               s = state::hex_digits;
+            }
+            else
+            {
+               fail( InvalidDigitEncountered_FirstDigit );
+            }
+            break;
+
+         case state::indeterminate_one_digit_in:
+            if ( is_xdigit(ch) )
+            {
+               if ( is_digit(ch) )
+               {
+                  s = state::indeterminate_two_digits_in;
+               }
+               else
+               {
+                  assume_hex = true;
+                  s = state::two_hex_digits;
+               }
+               second_digit = ch;
+            }
+            else if ( is_hex_marker(ch) )
+            {
+               assume_hex = true;
+               s = state::two_digits_already_read;
+            }
+            else
+            {
+               fail( InvalidDigitEncountered_SecondDigit );
+            }
+            break;
+
+         case state::indeterminate_two_digits_in:
+            if ( !assume_dec && is_hex_marker(ch) )
+            {
+               assume_hex = true;
+               s = state::two_digits_already_read;
+            }
+            else if ( !assume_hex && is_dec_suffix(ch) )
+            {
+               assume_dec = true;
+               s = state::two_digits_already_read;
+            }
+            else
+            {
+               fail( TooManyDigitsEntered );
+            }
+            break;
+
+         case state::one_dec_digit:
+            if ( is_digit(ch) )
+            {
+               second_digit = ch;
+               s = state::two_dec_digits;
+            }
+            else
+            {
+               fail( InvalidDigitEncountered_SecondDigit );
+            }
+            break;
+
+         case state::two_dec_digits:
+            if ( is_dec_suffix(ch) )
+            {
+               s = state::two_digits_already_read;
+            }
+            else
+            {
+               fail( InvalidDecimalSuffixEncountered );
+            }
+            break;
+
+         case state::hex_digits:
+            if ( is_xdigit(ch) )
+            {
+               second_digit = ch;
+               s = state::two_hex_digits;
+            }
+            else if ( is_hex_marker(ch) )
+            {
+               if ( hex_prefix_already_encountered )
+               {
+                  fail( HexPrefixAndSuffixEncountered );
+               }
+               else
+               {
+                  assume_hex = true;
+                  s = state::two_digits_already_read;
+               }
+            }
+            else
+            {
+               fail( InvalidDigitEncountered_SecondDigit );
+            }
+            break;
+
+         case state::two_hex_digits:
+            if ( is_hex_marker(ch) && hex_prefix_already_encountered )
+            {
+               fail( HexPrefixAndSuffixEncountered );
+            }
+            else if ( is_hex_marker(ch) )
+            {
+               s = state::two_digits_already_read;
+            }
+            else
+            {
+               fail( InvalidDecimalSuffixEncountered );
+            }
+            break;
+
+         case state::two_zeros_in:
+            if ( !assume_dec && is_hex_marker(ch) )
+            {
+               assume_hex = true;
+               s = state::two_digits_already_read;
+            }
+            else if ( !assume_hex && is_dec_suffix(ch) )
+            {
+               assume_dec = true;
+               s = state::two_digits_already_read;
+            }
+            else
+            {
+               fail( TooManyDigitsEntered );
+            }
+            break;
+
+         case state::two_digits_already_read:
+            fail( TooManyDigitsEntered );
+            break;
+
+         case state::preemptively_hex:
+            if ( is_hex_prefix(ch) )
+            {
+               hex_prefix_already_encountered = true;
+               s = state::hex_prefix;
+            }
+            else if ( '0' == ch )
+            {
+               first_digit = ch;
+               s = state::one_zero_in;
+            }
+            else if ( is_xdigit(ch) )
+            {
+               first_digit = ch;
+               s = state::hex_digits;
+            }
+            else
+            {
+               fail( InvalidCharacterEncountered_FirstChar );
+            }
+            break;
+
+         case state::preemptively_dec:
+            if ( is_hex_prefix(ch) || (is_xdigit(ch) && !is_digit(ch)) )
+            {
+               fail( HexDigitEncounteredUnderDecSetting_FirstDigit );
+            }
+            else if ( '0' == ch )
+            {
+               first_digit = ch;
+               s = state::preemptively_dec_one_zero_in;
+            }
+            else if ( is_digit(ch) )
+            {
+               first_digit = ch;
+               s = state::one_dec_digit;
+            }
+            else
+            {
+               fail( InvalidCharacterEncountered_FirstChar );
+            }
+            break;
+
+         case state::preemptively_dec_one_zero_in:
+            if ( is_hex_prefix(ch) || (is_xdigit(ch) && !is_digit(ch)) )
+            {
+               fail( HexDigitEncounteredUnderDecSetting_SecondDigit );
+            }
+            else if ( '0' == ch )
+            {
+               s = state::preemptively_dec_two_zeros_in;
+            }
+            else if ( is_digit(ch) )
+            {
+               first_digit = ch;
+               s = state::two_dec_digits;
+            }
+            else
+            {
+               fail( InvalidCharacterEncountered_SecondChar );
+            }
+            break;
+
+         case state::preemptively_dec_two_zeros_in:
+            if ( is_dec_suffix(ch) )
+            {
+               s = state::two_digits_already_read;
+            }
+            else
+            {
+               fail( InvalidDecimalSuffixEncountered );
+            }
+            break;
+
+         default:
+            assert(false);
+            break;
+      }
+
+      if ( exit_loop )
+      {
+         break;
+      }
+      idx++;
+      count++;
+   }
+
+   if ( count >= max_num_len )
+   {
+      return { TooManyDigitsEntered, 0 };
+   }
+   if ( exit_loop )
+   {
+      return { result, 0 };
+   }
+   if ( (assume_hex || assume_dec) && ('\0' == first_digit) && ('\0' == second_digit) )
+   {
+      return { NoNumericalDigitsEnteredWithFormat, 0 };
+   }
+   std::uint8_t msd = 0;
+   std::uint8_t lsd = digit_value(first_digit);
+   if ( second_digit != '\0' )
+   {
+      msd = lsd;
+      lsd = digit_value(second_digit);
+   }
+   const unsigned int base = ( assume_hex || !assume_dec ) ? 0x10u : 10u;
+   return { GoodResult, static_cast<std::uint8_t>( (msd * base) + lsd ) };
+}
+
+} // namespace detail
+
+/**
+ * @brief The PID for every ID, indexed by ID, built at compile time.
+ */
+inline constexpr std::array<std::uint8_t, MAX_ID_ALLOWED + 1u> pid_table = detail::make_pid_table();
+
+static_assert( detail::tables_match(pid_table, detail::reference_pid_table),
+               "compute_pid() disagrees with the reference PID table" );
+static_assert( !validate_pid(INVALID_PID), "INVALID_PID must never pass as a PID" );
+
+/**
+ * @brief Parse an ID token the same way the CLI parses its ID argument, and
+ *        ParseID() in the C API.
+ *
+ * @param[in] str The token; it ends at the first '\0' or the end of the view.
+ * @param[in] ishex Treat the token as hexadecimal, as with --hex.
+ * @param[in] isdec Treat the token as decimal, as with --dec.
+ */
+constexpr parsed_id parse_id( std::string_view str, bool ishex = false, bool isdec = false ) noexcept
+{
+   assert( !(ishex && isdec) );
+   parsed_id parsed = detail::get_id( str, ishex, isdec );
+   if ( (GoodResult == parsed.result) && (parsed.id > MAX_ID_ALLOWED) )
+   {
+      return { ID_OOR, 0 };
+   }
+   return parsed;
+}
+
+/**
+ * @brief The PID of each of count IDs into pids, INVALID_PID for any ID out
+ *        of range.
+ *
+ * @return How many of the IDs were out of range.
+ */
+constexpr std::size_t compute_pids( const std::uint8_t * ids, std::size_t count, std::uint8_t * pids ) noexcept
+{
+   assert( ((ids != nullptr) && (pids != nullptr)) || (0u == count) );
+   std::size_t invalid = 0;
+   for ( std::size_t i = 0; i < count; i++ )
+   {
+      const std::uint8_t id = ids[i];
+      const bool in_range = ( id <= MAX_ID_ALLOWED );
+      pids[i] = in_range ? pid_table[id] : static_cast<std::uint8_t>(INVALID_PID);
+      invalid += in_range ? 0u : 1u;
+   }
+   return invalid;
+}
+
+/**
+ * @brief Whether each of count PIDs is valid, into valid.
+ *
+ * @return How many of them were.
+ */
+constexpr std::size_t validate_pids( const std::uint8_t * pids, std::size_t count, bool * valid ) noexcept
+{
+   assert( ((pids != nullptr) && (valid != nullptr)) || (0u == count) );
+   std::size_t n = 0;
+   for ( std::size_t i = 0; i < count; i++ )
+   {
+      valid[i] = ( pid_table[pids[i] & MAX_ID_ALLOWED] == pids[i] );
+      n += valid[i] ? 1u : 0u;
+   }
+   return n;
+}
+
+#ifdef __cpp_lib_span
+
+/**
+ * @brief compute_pids() over spans; pids must be at least as long as ids.
+ */
+constexpr std::size_t compute_pids( std::span<const std::uint8_t> ids, std::span<std::uint8_t> pids ) noexcept
+{
+   assert( pids.size() >= ids.size() );
+   return compute_pids( ids.data(), ids.size(), pids.data() );
+}
+
+/**
+ * @brief validate_pids() over spans; valid must be at least as long as pids.
+ */
+constexpr std::size_t validate_pids( std::span<const std::uint8_t> pids, std::span<bool> valid ) noexcept
+{
+   assert( valid.size() >= pids.size() );
+   return validate_pids( pids.data(), pids.size(), valid.data() );
+}
+
+#endif // __cpp_lib_span
+
+} // namespace lin_pid
+
+#endif // LIN_PID_HPP
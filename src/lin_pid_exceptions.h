@@ -28,3 +28,42 @@ LIN_PID_EXCEPTION( CantUseNoNewLineWithoutQuiet,                    "Can't use -
 LIN_PID_EXCEPTION( PrematureTerminatingCharEncounted,               "Premature terminating character encountered when a digit was expected." )
 LIN_PID_EXCEPTION( NoNumericalDigitsEnteredWithFormat,              "No numerical digits entered wit." )
 LIN_PID_EXCEPTION( HexPrefixAndSuffixEncountered,                   "Hexadecimal prefix and suffix encountered. That is not allowed." )
+LIN_PID_EXCEPTION( OutOfMemory,                                     "Out of memory." )
+LIN_PID_EXCEPTION( LDFFileUnreadable,                               "Could not open or read the LDF file." )
+LIN_PID_EXCEPTION( LDFSyntaxError,                                  "LDF syntax error." )
+LIN_PID_EXCEPTION( LDFUndefinedReference,                           "LDF refers to a node, signal, or frame that was never defined." )
+LIN_PID_EXCEPTION( LDFDuplicateDefinition,                          "LDF defines the same name or frame ID more than once." )
+LIN_PID_EXCEPTION( LDFValueOutOfRange,                              "LDF value out of range (frame ID, frame length, signal size, or signal offset)." )
+LIN_PID_EXCEPTION( LDFFrameNotFound,                                "Frame not found in the LDF." )
+LIN_PID_EXCEPTION( InvalidLDFUsage,                                 "Invalid usage. Expected: lin_pid --ldf <file> [--frame <name>] [--quiet | -q]" )
+LIN_PID_EXCEPTION( ScheduleTableNotFound,                           "Schedule table not found in the LDF." )
+LIN_PID_EXCEPTION( NoBaudRate,                                      "No baud rate. The LDF has no LIN_speed, so pass --baud <bps>." )
+LIN_PID_EXCEPTION( InvalidScheduleUsage,                            "Invalid usage. Expected: lin_pid --schedule <file> [--table <name>] [--baud <bps> | --sweep <from>:<to>:<step> [--threads <n>]] [--quiet | -q]" )
+LIN_PID_EXCEPTION( LogFileUnreadable,                               "Could not open or read the log file." )
+LIN_PID_EXCEPTION( InvalidLogUsage,                                 "Invalid usage. Expected: lin_pid --log <file | -> [--format csv | asc] [--classic] [--threads <n>] [--summary] [--quiet | -q]" )
+LIN_PID_EXCEPTION( CaptureFileUnreadable,                           "Could not open or read the capture file." )
+LIN_PID_EXCEPTION( CaptureFileUnwritable,                           "Could not write the capture file." )
+LIN_PID_EXCEPTION( CaptureFileCorrupt,                              "Not a lin_pid capture file, or it is corrupt." )
+LIN_PID_EXCEPTION( CaptureTimestampsOutOfOrder,                     "Log timestamps go backwards. Captures need frames in time order." )
+LIN_PID_EXCEPTION( CaptureChannelOOR,                               "Channel out of range. Captures hold channels 0 to 15." )
+LIN_PID_EXCEPTION( InvalidConvertUsage,                             "Invalid usage. Expected: lin_pid --convert <log | -> <capture> [--format csv | asc] [--classic] [--threads <n>] [--block-frames <n>] [--quiet | -q]" )
+LIN_PID_EXCEPTION( InvalidDumpUsage,                                "Invalid usage. Expected: lin_pid --dump <capture> [--frame <n> | --from <seconds>] [--to <seconds>] [--count <n>] [--quiet | -q]" )
+LIN_PID_EXCEPTION( InvalidQueryUsage,                               "Invalid usage. Expected: lin_pid --query id=<ID> <capture> [--from <seconds>] [--to <seconds>] [--count <n>] [--index] [--quiet | -q]" )
+LIN_PID_EXCEPTION( FollowUnsupported,                               "Following a log needs a POSIX system." )
+LIN_PID_EXCEPTION( InvalidFollowUsage,                              "Invalid usage. Expected: lin_pid --follow <log> [--format csv | asc] [--classic] [--summary] [--quiet | -q]" )
+LIN_PID_EXCEPTION( InvalidMergeUsage,                               "Invalid usage. Expected: lin_pid --merge <capture>... [--out <capture>] [--retag] [--block-frames <n>] [--quiet | -q]" )
+LIN_PID_EXCEPTION( InvalidStatsUsage,                               "Invalid usage. Expected: lin_pid --stats-by-id <capture>... [--threads <n>] [--quiet | -q]" )
+LIN_PID_EXCEPTION( InvalidTPUsage,                                  "Invalid usage. Expected: lin_pid --tp <capture> [--timeout <ms>] [--index] [--quiet | -q]" )
+LIN_PID_EXCEPTION( SampleFileUnreadable,                            "Could not open or read the sample dump." )
+LIN_PID_EXCEPTION( SampleRateTooLow,                                "Sample rate too low. Decoding needs at least 4 samples per bit at the baud rate." )
+LIN_PID_EXCEPTION( InvalidSamplesUsage,                             "Invalid usage. Expected: lin_pid --samples <dump> --rate <Hz> [--baud <bps>] [--classic] [--out <capture>] [--quiet | -q]" )
+LIN_PID_EXCEPTION( NodeUnsupported,                                 "Node emulation needs Linux (epoll and timerfd)." )
+LIN_PID_EXCEPTION( NodePortUnusable,                                "Could not open, set up, or keep using the pty or serial port." )
+LIN_PID_EXCEPTION( NodeNotFound,                                    "Node not found in the LDF." )
+LIN_PID_EXCEPTION( InvalidNodeUsage,                                "Invalid usage. Expected: lin_pid --node <ldf> (--master [--table <name>] [--cycles <n>] | --slave <node>) [--port <tty>] [--classic] [--quiet | -q]" )
+LIN_PID_EXCEPTION( TTYUnsupported,                                  "Serial capture needs Linux (epoll and termios)." )
+LIN_PID_EXCEPTION( TTYUnusable,                                     "Could not open, set up, or keep reading a serial port." )
+LIN_PID_EXCEPTION( TTYBaudUnsupported,                              "Baud rate not settable through termios. Set it with stty and leave out --baud." )
+LIN_PID_EXCEPTION( InvalidCaptureUsage,                             "Invalid usage. Expected: lin_pid --capture <tty>... [--baud <bps>] [--classic] [--out <capture>...] [--quiet | -q]" )
+LIN_PID_EXCEPTION( EmitFileUnwritable,                              "Could not write the header file." )
+LIN_PID_EXCEPTION( InvalidEmitUsage,                                "Invalid usage. Expected: lin_pid (--emit-c | --emit-cpp) [--layout table | parity | mask] [--prefix <name>] [--out <header>]" )
@@ -0,0 +1,4189 @@
+/**
+ * @file lin_pid_id_spellings.h
+ * @brief Perfect hash of every ID spelling lin_pid takes, for LookupIDSpelling().
+ *
+ * @note Generated by scripts/gen_id_spellings.py from
+ *       lin_pid_supported_formats.h; don't edit it by hand.
+ */
+
+#ifndef LIN_PID_ID_SPELLINGS_H
+#define LIN_PID_ID_SPELLINGS_H
+
+#define ID_SPELLING_BUCKET_BITS        9u
+#define ID_SPELLING_SLOT_BITS          12u
+#define NUM_OF_ID_SPELLINGS            2090u
+
+// A key is the token's bytes, first in the low byte, and the flag it came with
+#define ID_SPELLING_MAX_LEN            4u
+#define ID_SPELLING_KEY_HEX            0x00000080u
+#define ID_SPELLING_KEY_DEC            0x00008000u
+
+static const uint16_t IDSpellingSeeds[1u << ID_SPELLING_BUCKET_BITS] =
+{
+   0x000B, 0x0000, 0x0003, 0x0005, 0x0000, 0x0000, 0x0002, 0x0000,
+   0x0002, 0x000B, 0x0001, 0x0003, 0x0009, 0x0001, 0x0001, 0x0009,
+   0x0000, 0x0013, 0x0002, 0x0000, 0x0002, 0x0001, 0x000A, 0x0000,
+   0x0005, 0x000A, 0x0008, 0x0001, 0x000B, 0x0010, 0x0000, 0x0000,
+   0x0000, 0x000A, 0x0010, 0x0000, 0x0000, 0x0010, 0x0000, 0x0008,
+   0x0004, 0x0002, 0x0000, 0x0004, 0x0006, 0x0002, 0x0005, 0x0006,
+   0x000A, 0x0000, 0x0004, 0x000E, 0x000B, 0x0007, 0x0007, 0x0002,
+   0x0007, 0x0002, 0x0004, 0x0000, 0x0001, 0x0004, 0x0001, 0x0004,
+   0x0004, 0x0006, 0x0006, 0x0009, 0x0001, 0x0008, 0x0005, 0x0008,
+   0x0013, 0x0009, 0x0008, 0x0003, 0x0000, 0x0005, 0x0004, 0x0005,
+   0x0002, 0x0004, 0x0002, 0x0008, 0x0002, 0x0008, 0x0005, 0x0010,
+   0x0003, 0x0002, 0x0000, 0x0001, 0x0004, 0x0001, 0x0008, 0x0008,
+   0x0001, 0x0000, 0x0000, 0x0000, 0x0009, 0x0001, 0x0005, 0x0013,
+   0x000E, 0x0000, 0x0013, 0x000D, 0x0006, 0x0005, 0x0003, 0x0005,
+   0x0000, 0x0000, 0x0005, 0x000C, 0x0000, 0x0001, 0x0000, 0x0006,
+   0x0005, 0x0016, 0x0000, 0x0009, 0x0006, 0x0009, 0x0008, 0x0000,
+   0x000B, 0x0003, 0x0001, 0x0000, 0x0000, 0x0000, 0x000C, 0x0002,
+   0x0002, 0x0010, 0x0000, 0x0006, 0x0005, 0x0016, 0x0008, 0x0003,
+   0x0004, 0x000A, 0x0001, 0x0000, 0x0000, 0x0001, 0x0009, 0x0001,
+   0x0001, 0x000A, 0x0005, 0x0004, 0x0001, 0x0005, 0x0000, 0x0005,
+   0x0005, 0x0004, 0x0002, 0x0006, 0x000D, 0x0001, 0x0002, 0x0008,
+   0x0002, 0x0002, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x000C,
+   0x0001, 0x0001, 0x0000, 0x0012, 0x000A, 0x0001, 0x000B, 0x000A,
+   0x0008, 0x000B, 0x000B, 0x0000, 0x0001, 0x0000, 0x0001, 0x0009,
+   0x0008, 0x0001, 0x0006, 0x0002, 0x0002, 0x0000, 0x0001, 0x0004,
+   0x0000, 0x000C, 0x0004, 0x0001, 0x000B, 0x0005, 0x0001, 0x0005,
+   0x0000, 0x0002, 0x0002, 0x0003, 0x0002, 0x000B, 0x0013, 0x0003,
+   0x0008, 0x0008, 0x0008, 0x0006, 0x0017, 0x0001, 0x0017, 0x0010,
+   0x0000, 0x0012, 0x0006, 0x0005, 0x0000, 0x0001, 0x0013, 0x0005,
+   0x0002, 0x0001, 0x0008, 0x0000, 0x000A, 0x0011, 0x000A, 0x0014,
+   0x0001, 0x0001, 0x0016, 0x0000, 0x0013, 0x000D, 0x0000, 0x0000,
+   0x0000, 0x0000, 0x0002, 0x0000, 0x0011, 0x0001, 0x0001, 0x0012,
+   0x0003, 0x0004, 0x0016, 0x0004, 0x0001, 0x0001, 0x0000, 0x0000,
+   0x0000, 0x0007, 0x0000, 0x0002, 0x0008, 0x0007, 0x0009, 0x000C,
+   0x000D, 0x001A, 0x0006, 0x000A, 0x0007, 0x0001, 0x0005, 0x0000,
+   0x0005, 0x0005, 0x000B, 0x000D, 0x0007, 0x0008, 0x0000, 0x0005,
+   0x0002, 0x000D, 0x0007, 0x0010, 0x0006, 0x0008, 0x0000, 0x0005,
+   0x0001, 0x0001, 0x0002, 0x0006, 0x0000, 0x0013, 0x0001, 0x0001,
+   0x0000, 0x0003, 0x001F, 0x0014, 0x0008, 0x0008, 0x000B, 0x0002,
+   0x000D, 0x000B, 0x0010, 0x0002, 0x0001, 0x0004, 0x0005, 0x0005,
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0001, 0x0004, 0x0005,
+   0x0003, 0x000C, 0x0006, 0x0002, 0x0000, 0x0002, 0x000B, 0x000F,
+   0x0005, 0x0002, 0x0001, 0x0000, 0x0002, 0x0000, 0x0002, 0x000C,
+   0x0004, 0x0001, 0x0009, 0x0012, 0x0002, 0x0002, 0x0008, 0x000E,
+   0x0009, 0x0006, 0x0000, 0x0003, 0x0000, 0x0000, 0x0003, 0x0009,
+   0x000F, 0x0001, 0x0005, 0x000C, 0x0001, 0x000A, 0x000C, 0x0016,
+   0x0001, 0x001B, 0x0010, 0x0001, 0x000B, 0x0012, 0x0000, 0x000C,
+   0x0002, 0x0007, 0x0019, 0x0006, 0x000D, 0x0000, 0x0000, 0x000E,
+   0x000F, 0x0012, 0x000D, 0x0007, 0x0000, 0x0023, 0x0000, 0x0005,
+   0x0005, 0x000E, 0x0000, 0x000A, 0x0000, 0x0007, 0x000C, 0x0009,
+   0x0002, 0x0001, 0x0000, 0x0000, 0x0002, 0x0009, 0x0004, 0x0000,
+   0x0001, 0x0009, 0x0001, 0x0008, 0x000D, 0x000E, 0x000F, 0x0000,
+   0x0006, 0x0000, 0x0015, 0x000A, 0x0013, 0x0002, 0x0008, 0x0000,
+   0x0004, 0x0005, 0x0000, 0x0003, 0x0002, 0x000D, 0x0005, 0x0004,
+   0x000C, 0x0001, 0x0000, 0x0006, 0x0001, 0x0001, 0x000A, 0x000C,
+   0x0003, 0x0008, 0x0000, 0x0007, 0x0010, 0x000D, 0x000C, 0x000B,
+   0x000E, 0x0008, 0x0003, 0x0010, 0x0001, 0x0004, 0x0004, 0x0000,
+   0x0002, 0x0005, 0x0010, 0x0000, 0x0006, 0x0005, 0x0002, 0x000C,
+   0x0000, 0x0009, 0x0010, 0x0007, 0x0001, 0x0001, 0x000A, 0x0002,
+   0x0004, 0x0002, 0x0009, 0x000B, 0x0005, 0x000E, 0x0011, 0x0000,
+   0x0003, 0x000F, 0x0008, 0x0000, 0x0015, 0x000B, 0x0006, 0x0008,
+   0x0006, 0x0002, 0x0005, 0x000C, 0x0001, 0x000B, 0x0005, 0x000D,
+   0x0024, 0x0008, 0x0003, 0x000F, 0x0000, 0x000E, 0x0014, 0x0004,
+   0x0004, 0x0002, 0x0006, 0x000D, 0x000A, 0x0001, 0x0003, 0x0000,
+};
+
+static const struct IDSpelling_S IDSpellings[1u << ID_SPELLING_SLOT_BITS] =
+{
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643732u, 0x1Bu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "27d"
+   { 0x000061F8u, 0x0Au, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "xa" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005861B0u, 0x0Au, UppercaseXSuffix_LeadingZeros_Lowercase, true, false },            // "0aX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443933u, 0x27u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "39D"
+   { 0x00443058u, 0x0Du, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0D"
+   { 0x006830B2u, 0x20u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "20h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783432u, 0x24u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "24x"
+   { 0x003233F8u, 0x32u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x32" --hex
+   { 0x0000B933u, 0x27u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "39" --dec
+   { 0x00443535u, 0x37u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "55D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007866B3u, 0x3Fu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "3fx" --hex
+   { 0x00683131u, 0x11u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "11h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00584232u, 0x2Bu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2BX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643730u, 0x07u, LowercasedSuffix_LeadingZeros, false, true },                      // "07d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006558u, 0x0Eu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "Xe"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003132F8u, 0x21u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x21" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00393058u, 0x09u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X09"
+   { 0x00007841u, 0x0Au, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "Ax"
+   { 0x00583031u, 0x10u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "10X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00323378u, 0x32u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x32"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003278u, 0x02u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2"
+   { 0x0064B231u, 0x0Cu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "12d" --dec
+   { 0x64317830u, 0x1Du, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x1d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006132D8u, 0x2Au, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X2a" --hex
+   { 0x43317830u, 0x1Cu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1C"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00653158u, 0x1Eu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X1e"
+   { 0x000068E2u, 0x0Bu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "bh" --hex
+   { 0x33307830u, 0x03u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x03"
+   { 0x007838B2u, 0x28u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "28x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00657830u, 0x0Eu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0xe"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000058C5u, 0x0Eu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "EX" --hex
+   { 0x007843B1u, 0x1Cu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Cx" --hex
+   { 0x000048B8u, 0x08u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "8H" --hex
+   { 0x38337830u, 0x38u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x38"
+   { 0x00303358u, 0x30u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X30"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00786333u, 0x3Cu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "3cx"
+   { 0x000048C4u, 0x0Du, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "DH" --hex
+   { 0x453378B0u, 0x3Eu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3E" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x37337830u, 0x37u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x37"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005831B3u, 0x31u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "31X" --hex
+   { 0x0044B332u, 0x17u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "23D" --dec
+   { 0x007837B2u, 0x27u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "27x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00383078u, 0x08u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x08"
+   { 0x000078E6u, 0x0Fu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "fx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005845B1u, 0x1Eu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1EX" --hex
+   { 0x00686531u, 0x1Eu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "1eh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B033u, 0x1Eu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "30D" --dec
+   { 0x004836B0u, 0x06u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "06H" --hex
+   { 0x0000B833u, 0x26u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "38" --dec
+   { 0x00007845u, 0x0Eu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "Ex"
+   { 0x00584230u, 0x0Bu, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0BX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443530u, 0x05u, UppercaseDSuffix_LeadingZeros, false, true },                      // "05D"
+   { 0x0000B533u, 0x23u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "35" --dec
+   { 0x00643731u, 0x11u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "17d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x65307830u, 0x0Eu, ClassicHexPrefix_LeadingZeros_Lowercase, true, false },            // "0x0e"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483132u, 0x21u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "21H"
+   { 0x006845B0u, 0x0Eu, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0Eh" --hex
+   { 0x00784532u, 0x2Eu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Ex"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007861B1u, 0x1Au, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "1ax" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783831u, 0x18u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "18x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006430F8u, 0x0Du, LowercasexPrefix_LeadingZeros_Lowercase, true, false },            // "x0d" --hex
+   { 0x00006433u, 0x3Du, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "3d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683532u, 0x25u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "25h"
+   { 0x00784133u, 0x3Au, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Ax"
+   { 0x00363358u, 0x36u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X36"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000000B2u, 0x02u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005832B1u, 0x12u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "12X" --hex
+   { 0x004631D8u, 0x1Fu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1F" --hex
+   { 0x004532F8u, 0x2Eu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2E" --hex
+   { 0x007862B1u, 0x1Bu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "1bx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x423178B0u, 0x1Bu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1B" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B034u, 0x28u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "40D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000078E3u, 0x0Cu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "cx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000030D8u, 0x00u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0" --hex
+   { 0x000078E1u, 0x0Au, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "ax" --hex
+   { 0x005864B1u, 0x1Du, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "1dX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x433378B0u, 0x3Cu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3C" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005838B0u, 0x08u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "08X" --hex
+   { 0x63327830u, 0x2Cu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x2c"
+   { 0x00583530u, 0x05u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "05X"
+   { 0x00583932u, 0x29u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "29X"
+   { 0x000078B6u, 0x06u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "6x" --hex
+   { 0x00443230u, 0x02u, UppercaseDSuffix_LeadingZeros, false, true },                      // "02D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B030u, 0x00u, DecNoPrefixOrSuffix_LeadingZeros, false, true },                   // "00" --dec
+   { 0x000065B0u, 0x0Eu, HexNoPrefixOrSuffix_LeadingZeros_Lowercase, true, false },         // "0e" --hex
+   { 0x00007830u, 0x00u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003731u, 0x17u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "17"
+   { 0x343078B0u, 0x04u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x04" --hex
+   { 0x004131F8u, 0x1Au, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1A" --hex
+   { 0x0000B234u, 0x2Au, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "42" --dec
+   { 0x007838B3u, 0x38u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "38x" --hex
+   { 0x643078B0u, 0x0Du, ClassicHexPrefix_LeadingZeros_Lowercase, true, false },            // "0x0d" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00453158u, 0x1Eu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1E"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004841B2u, 0x2Au, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2AH" --hex
+   { 0x00786432u, 0x2Du, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "2dx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006478u, 0x0Du, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "xd"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00786132u, 0x2Au, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "2ax"
+   { 0x0044B235u, 0x34u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "52D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006532u, 0x2Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "2e"
+   { 0x00004530u, 0x0Eu, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0E"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004835B0u, 0x05u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "05H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000065F8u, 0x0Eu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "xe" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005838B3u, 0x38u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "38X" --hex
+   { 0x00006833u, 0x03u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006331D8u, 0x1Cu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X1c" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00353258u, 0x25u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X25"
+   { 0x453278B0u, 0x2Eu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2E" --hex
+   { 0x0000B830u, 0x08u, DecNoPrefixOrSuffix_LeadingZeros, false, true },                   // "08" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00313178u, 0x11u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x11"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643336u, 0x3Fu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "63d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00005830u, 0x00u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0X"
+   { 0x000078E2u, 0x0Bu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "bx" --hex
+   { 0x006843B2u, 0x2Cu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Ch" --hex
+   { 0x005839B0u, 0x09u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "09X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443434u, 0x2Cu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "44D"
+   { 0x00584130u, 0x0Au, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0AX"
+   { 0x33337830u, 0x33u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x33"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005862B3u, 0x3Bu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "3bX" --hex
+   { 0x00423078u, 0x0Bu, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0B"
+   { 0x004841B1u, 0x1Au, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1AH" --hex
+   { 0x00483931u, 0x19u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "19H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x353078B0u, 0x05u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x05" --hex
+   { 0x007862B0u, 0x0Bu, LowercasexSuffix_LeadingZeros_Lowercase, true, false },            // "0bx" --hex
+   { 0x003578B0u, 0x05u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x5" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000048C5u, 0x0Eu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "EH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x34327830u, 0x24u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x24"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B732u, 0x1Bu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "27D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443231u, 0x0Cu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "12D"
+   { 0x00003378u, 0x03u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00686133u, 0x3Au, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "3ah"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783733u, 0x37u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "37x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003631D8u, 0x16u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X16" --hex
+   { 0x633278B0u, 0x2Cu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x2c" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B930u, 0x09u, DecNoPrefixOrSuffix_LeadingZeros, false, true },                   // "09" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000048B4u, 0x04u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "4H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00007836u, 0x06u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "6x"
+   { 0x00000033u, 0x03u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "3"
+   { 0x62327830u, 0x2Bu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x2b"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B031u, 0x0Au, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "10D" --dec
+   { 0x0044B834u, 0x30u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "48D" --dec
+   { 0x00004842u, 0x0Bu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "BH"
+   { 0x00006831u, 0x01u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1h"
+   { 0x00004133u, 0x3Au, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3A"
+   { 0x003533D8u, 0x35u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X35" --hex
+   { 0x00005845u, 0x0Eu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "EX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004132D8u, 0x2Au, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2A" --hex
+   { 0x00486631u, 0x1Fu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "1fH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643333u, 0x21u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "33d"
+   { 0x000032D8u, 0x02u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2" --hex
+   { 0x000058E5u, 0x0Eu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "eX" --hex
+   { 0x00786332u, 0x2Cu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "2cx"
+   { 0x000000B6u, 0x06u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "6" --hex
+   { 0x0000B631u, 0x10u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "16" --dec
+   { 0x003632F8u, 0x26u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x26" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784630u, 0x0Fu, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0Fx"
+   { 0x00000061u, 0x0Au, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "a"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B831u, 0x12u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "18D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003932D8u, 0x29u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X29" --hex
+   { 0x000064B0u, 0x0Du, HexNoPrefixOrSuffix_LeadingZeros_Lowercase, true, false },         // "0d" --hex
+   { 0x005865B3u, 0x3Eu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "3eX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00313358u, 0x31u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X31"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583830u, 0x08u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "08X"
+   { 0x00005861u, 0x0Au, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "aX"
+   { 0x00443036u, 0x3Cu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "60D"
+   { 0x007836B0u, 0x06u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "06x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004330u, 0x0Cu, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0C"
+   { 0x65337830u, 0x3Eu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x3e"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783031u, 0x10u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "10x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x343178B0u, 0x14u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x14" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000035u, 0x05u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "5"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443332u, 0x17u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "23D"
+   { 0x007839B0u, 0x09u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "09x" --hex
+   { 0x000039B2u, 0x29u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "29" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443730u, 0x07u, UppercaseDSuffix_LeadingZeros, false, true },                      // "07D"
+   { 0x007837B1u, 0x17u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "17x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x30307830u, 0x00u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x00"
+   { 0x39337830u, 0x39u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x39"
+   { 0x000048E2u, 0x0Bu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "bH" --hex
+   { 0x00683330u, 0x03u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "03h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004378B0u, 0x0Cu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0xC" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007862B2u, 0x2Bu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "2bx" --hex
+   { 0x00003058u, 0x00u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0"
+   { 0x00613258u, 0x2Au, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X2a"
+   { 0x00583330u, 0x03u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "03X"
+   { 0x003130F8u, 0x01u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x01" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003333F8u, 0x33u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x33" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784230u, 0x0Bu, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0Bx"
+   { 0x0064B734u, 0x2Fu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "47d" --dec
+   { 0x00006678u, 0x0Fu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "xf"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00484433u, 0x3Du, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3DH"
+   { 0x003232F8u, 0x22u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x22" --hex
+   { 0x00613158u, 0x1Au, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X1a"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B434u, 0x2Cu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "44" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x66317830u, 0x1Fu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x1f"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004231u, 0x1Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1B"
+   { 0x00003932u, 0x29u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "29"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443433u, 0x22u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "34D"
+   { 0x000042B1u, 0x1Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1B" --hex
+   { 0x003133D8u, 0x31u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X31" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x64307830u, 0x0Du, ClassicHexPrefix_LeadingZeros_Lowercase, true, false },            // "0x0d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003230u, 0x02u, DecNoPrefixOrSuffix_LeadingZeros, false, false },                  // "02"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005833B1u, 0x13u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "13X" --hex
+   { 0x003530D8u, 0x05u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X05" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004578B0u, 0x0Eu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0xE" --hex
+   { 0x00007866u, 0x0Fu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "fx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483630u, 0x06u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "06H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00486232u, 0x2Bu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "2bH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000000C2u, 0x0Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "B" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004845B0u, 0x0Eu, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0EH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483531u, 0x15u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "15H"
+   { 0x00383178u, 0x18u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x18"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004845u, 0x0Eu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "EH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00303278u, 0x20u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x20"
+   { 0x004433D8u, 0x3Du, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3D" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00633158u, 0x1Cu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X1c"
+   { 0x00443278u, 0x2Du, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583533u, 0x35u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "35X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443031u, 0x0Au, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "10D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007863B2u, 0x2Cu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "2cx" --hex
+   { 0x00483030u, 0x00u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "00H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483833u, 0x38u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "38H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x66327830u, 0x2Fu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x2f"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00486530u, 0x0Eu, UppercaseHSuffix_LeadingZeros_Lowercase, true, false },            // "0eH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00663378u, 0x3Fu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x3f"
+   { 0x007845B1u, 0x1Eu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Ex" --hex
+   { 0x383278B0u, 0x28u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x28" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004833B0u, 0x03u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "03H" --hex
+   { 0x0064B835u, 0x3Au, LowercasedSuffix_NoLeadingZeros, false, true },                    // "58d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443232u, 0x16u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "22D"
+   { 0x000042B0u, 0x0Bu, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0B" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B135u, 0x33u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "51" --dec
+   { 0x00683833u, 0x38u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "38h"
+   { 0x0000B735u, 0x39u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "57" --dec
+   { 0x004846B1u, 0x1Fu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1FH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006836B2u, 0x26u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "26h" --hex
+   { 0x00683430u, 0x04u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "04h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00333278u, 0x23u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x23"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x313378B0u, 0x31u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x31" --hex
+   { 0x00663158u, 0x1Fu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X1f"
+   { 0x005838B1u, 0x18u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "18X" --hex
+   { 0x00633078u, 0x0Cu, LowercasexPrefix_LeadingZeros_Lowercase, true, false },            // "x0c"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00343178u, 0x14u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x14"
+   { 0x005845B3u, 0x3Eu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3EX" --hex
+   { 0x004231D8u, 0x1Bu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1B" --hex
+   { 0x0000B032u, 0x14u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "20" --dec
+   { 0x00486132u, 0x2Au, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "2aH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443330u, 0x03u, UppercaseDSuffix_LeadingZeros, false, true },                      // "03D"
+   { 0x000034B0u, 0x04u, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "04" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006845u, 0x0Eu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "Eh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007844B3u, 0x3Du, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Dx" --hex
+   { 0x00433358u, 0x3Cu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3C"
+   { 0x00007846u, 0x0Fu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "Fx"
+   { 0x00006839u, 0x09u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "9h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003832D8u, 0x28u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X28" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x37327830u, 0x27u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x27"
+   { 0x004533D8u, 0x3Eu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3E" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643033u, 0x1Eu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "30d"
+   { 0x00413058u, 0x0Au, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0A"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000042B3u, 0x3Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3B" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003478u, 0x04u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x4"
+   { 0x004837B1u, 0x17u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "17H" --hex
+   { 0x00004332u, 0x2Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2C"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000000E1u, 0x0Au, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "a" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00623258u, 0x2Bu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X2b"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B235u, 0x34u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "52" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006846B1u, 0x1Fu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Fh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005862B2u, 0x2Bu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "2bX" --hex
+   { 0x000032B0u, 0x02u, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "02" --hex
+   { 0x00484331u, 0x1Cu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1CH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B932u, 0x1Du, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "29D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005863B1u, 0x1Cu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "1cX" --hex
+   { 0x00683231u, 0x12u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "12h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00486432u, 0x2Du, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "2dH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006632D8u, 0x2Fu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X2f" --hex
+   { 0x00006158u, 0x0Au, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "Xa"
+   { 0x0064B635u, 0x38u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "56d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004838B1u, 0x18u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "18H" --hex
+   { 0x00586230u, 0x0Bu, UppercaseXSuffix_LeadingZeros_Lowercase, true, false },            // "0bX"
+   { 0x004831B2u, 0x21u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "21H" --hex
+   { 0x00000031u, 0x01u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "1"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00663358u, 0x3Fu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X3f"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x353178B0u, 0x15u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x15" --hex
+   { 0x006837B3u, 0x37u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "37h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443431u, 0x0Eu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "14D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00413358u, 0x3Au, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3A"
+   { 0x00486532u, 0x2Eu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "2eH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003032D8u, 0x20u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X20" --hex
+   { 0x000033B2u, 0x23u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "23" --hex
+   { 0x004232D8u, 0x2Bu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2B" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643532u, 0x19u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "25d"
+   { 0x00367830u, 0x06u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x6"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000045B3u, 0x3Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3E" --hex
+   { 0x006231F8u, 0x1Bu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x1b" --hex
+   { 0x00443035u, 0x32u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "50D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00584132u, 0x2Au, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2AX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000044D8u, 0x0Du, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "XD" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00005842u, 0x0Bu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "BX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784130u, 0x0Au, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0Ax"
+   { 0x00643530u, 0x05u, LowercasedSuffix_LeadingZeros, false, true },                      // "05d"
+   { 0x000000B7u, 0x07u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "7" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005838B2u, 0x28u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "28X" --hex
+   { 0x006433F8u, 0x3Du, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x3d" --hex
+   { 0x000030F8u, 0x00u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0" --hex
+   { 0x00613278u, 0x2Au, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x2a"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006836B1u, 0x16u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "16h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x623378B0u, 0x3Bu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x3b" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004864B2u, 0x2Du, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "2dH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006838B3u, 0x38u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "38h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00393258u, 0x29u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X29"
+   { 0x00004378u, 0x0Cu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "xC"
+   { 0x00583331u, 0x13u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "13X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004834B0u, 0x04u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "04H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00463158u, 0x1Fu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1F"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000048B5u, 0x05u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "5H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B336u, 0x3Fu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "63D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00684431u, 0x1Du, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Dh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443631u, 0x10u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "16D"
+   { 0x003031F8u, 0x10u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x10" --hex
+   { 0x005842B0u, 0x0Bu, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0BX" --hex
+   { 0x005861B3u, 0x3Au, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "3aX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B933u, 0x27u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "39d" --dec
+   { 0x00003578u, 0x05u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x5"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B435u, 0x36u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "54" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003930D8u, 0x09u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X09" --hex
+   { 0x00353378u, 0x35u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x35"
+   { 0x00443030u, 0x00u, UppercaseDSuffix_LeadingZeros, false, true },                      // "00D"
+   { 0x003733D8u, 0x37u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X37" --hex
+   { 0x00006430u, 0x0Du, HexNoPrefixOrSuffix_LeadingZeros_Lowercase, true, false },         // "0d"
+   { 0x00006834u, 0x04u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "4h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00584432u, 0x2Du, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2DX"
+   { 0x00684330u, 0x0Cu, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0Ch"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B334u, 0x2Bu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "43D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003933D8u, 0x39u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X39" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x34307830u, 0x04u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x04"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00005834u, 0x04u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "4X"
+   { 0x00008038u, 0x08u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "8" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483633u, 0x36u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "36H"
+   { 0x007842B3u, 0x3Bu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Bx" --hex
+   { 0x007865B2u, 0x2Eu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "2ex" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00484233u, 0x3Bu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3BH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003678u, 0x06u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x6"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000063B3u, 0x3Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "3c" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004842B0u, 0x0Bu, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0BH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B236u, 0x3Eu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "62" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000064B1u, 0x1Du, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "1d" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443533u, 0x23u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "35D"
+   { 0x004830B3u, 0x30u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "30H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643334u, 0x2Bu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "43d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006839B2u, 0x29u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "29h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00333058u, 0x03u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X03"
+   { 0x0064B934u, 0x31u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "49d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004832B1u, 0x12u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "12H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00786433u, 0x3Du, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "3dx"
+   { 0x003732D8u, 0x27u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X27" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004839u, 0x09u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "9H"
+   { 0x663378B0u, 0x3Fu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x3f" --hex
+   { 0x363178B0u, 0x16u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x16" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B630u, 0x06u, UppercaseDSuffix_LeadingZeros, false, true },                      // "06D" --dec
+   { 0x00483333u, 0x33u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "33H"
+   { 0x0064B731u, 0x11u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "17d" --dec
+   { 0x000062B0u, 0x0Bu, HexNoPrefixOrSuffix_LeadingZeros_Lowercase, true, false },         // "0b" --hex
+   { 0x00783631u, 0x16u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "16x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00653358u, 0x3Eu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X3e"
+   { 0x00303258u, 0x20u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X20"
+   { 0x00684631u, 0x1Fu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Fh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x303278B0u, 0x20u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x20" --hex
+   { 0x00004658u, 0x0Fu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "XF"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004531u, 0x1Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1E"
+   { 0x00653058u, 0x0Eu, UppercaseXPrefix_LeadingZeros_Lowercase, true, false },            // "X0e"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00353058u, 0x05u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X05"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783330u, 0x03u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "03x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007836B3u, 0x36u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "36x" --hex
+   { 0x007843B0u, 0x0Cu, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0Cx" --hex
+   { 0x005844B0u, 0x0Du, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0DX" --hex
+   { 0x000062D8u, 0x0Bu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "Xb" --hex
+   { 0x006862B3u, 0x3Bu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "3bh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007831B3u, 0x31u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "31x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443334u, 0x2Bu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "43D"
+   { 0x004333D8u, 0x3Cu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3C" --hex
+   { 0x000048C6u, 0x0Fu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "FH" --hex
+   { 0x0064B133u, 0x1Fu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "31d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783633u, 0x36u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "36x"
+   { 0x00583132u, 0x21u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "21X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004835B3u, 0x35u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "35H" --hex
+   { 0x00584330u, 0x0Cu, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0CX"
+   { 0x0064B136u, 0x3Du, LowercasedSuffix_NoLeadingZeros, false, true },                    // "61d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B730u, 0x07u, UppercaseDSuffix_LeadingZeros, false, true },                      // "07D" --dec
+   { 0x363278B0u, 0x26u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x26" --hex
+   { 0x00004131u, 0x1Au, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1A"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004861B3u, 0x3Au, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "3aH" --hex
+   { 0x006330D8u, 0x0Cu, UppercaseXPrefix_LeadingZeros_Lowercase, true, false },            // "X0c" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B532u, 0x19u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "25" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005841B0u, 0x0Au, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0AX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B633u, 0x24u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "36d" --dec
+   { 0x000043D8u, 0x0Cu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "XC" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x323378B0u, 0x32u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x32" --hex
+   { 0x00683831u, 0x18u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "18h"
+   { 0x003278B0u, 0x02u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B630u, 0x06u, LowercasedSuffix_LeadingZeros, false, true },                      // "06d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004678B0u, 0x0Fu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0xF" --hex
+   { 0x00484631u, 0x1Fu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1FH"
+   { 0x00643035u, 0x32u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "50d"
+   { 0x00686431u, 0x1Du, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "1dh"
+   { 0x00000046u, 0x0Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "F"
+   { 0x00463178u, 0x1Fu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1F"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004841B0u, 0x0Au, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0AH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B232u, 0x16u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "22d" --dec
+   { 0x00684432u, 0x2Du, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Dh"
+   { 0x00004678u, 0x0Fu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "xF"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00313078u, 0x01u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x01"
+   { 0x0064B134u, 0x29u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "41d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00613178u, 0x1Au, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x1a"
+   { 0x0044B531u, 0x0Fu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "15D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B833u, 0x26u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "38D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00423258u, 0x2Bu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2B"
+   { 0x003433F8u, 0x34u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x34" --hex
+   { 0x00006132u, 0x2Au, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "2a"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B032u, 0x14u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "20d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583631u, 0x16u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "16X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000058E6u, 0x0Fu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "fX" --hex
+   { 0x00006358u, 0x0Cu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "Xc"
+   { 0x006130F8u, 0x0Au, LowercasexPrefix_LeadingZeros_Lowercase, true, false },            // "x0a" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643135u, 0x33u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "51d"
+   { 0x0064B831u, 0x12u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "18d" --dec
+   { 0x35337830u, 0x35u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x35"
+   { 0x00483232u, 0x22u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "22H"
+   { 0x007843B2u, 0x2Cu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Cx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x36307830u, 0x06u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x06"
+   { 0x00643433u, 0x22u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "34d"
+   { 0x000048C3u, 0x0Cu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "CH" --hex
+   { 0x00583832u, 0x28u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "28X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483732u, 0x27u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "27H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B033u, 0x1Eu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "30d" --dec
+   { 0x004842B2u, 0x2Bu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2BH" --hex
+   { 0x31307830u, 0x01u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x01"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000031D8u, 0x01u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1" --hex
+   { 0x005864B0u, 0x0Du, UppercaseXSuffix_LeadingZeros_Lowercase, true, false },            // "0dX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006132F8u, 0x2Au, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x2a" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00313058u, 0x01u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X01"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x30327830u, 0x20u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x20"
+   { 0x00783331u, 0x13u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "13x"
+   { 0x0044B733u, 0x25u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "37D" --dec
+   { 0x000061B1u, 0x1Au, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "1a" --hex
+   { 0x004844B3u, 0x3Du, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3DH" --hex
+   { 0x00783833u, 0x38u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "38x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783030u, 0x00u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "00x"
+   { 0x00584433u, 0x3Du, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3DX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000032F8u, 0x02u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2" --hex
+   { 0x00005835u, 0x05u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "5X"
+   { 0x00004866u, 0x0Fu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "fH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00307830u, 0x00u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0"
+   { 0x66307830u, 0x0Fu, ClassicHexPrefix_LeadingZeros_Lowercase, true, false },            // "0x0f"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683233u, 0x32u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "32h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007830B2u, 0x20u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "20x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B430u, 0x04u, LowercasedSuffix_LeadingZeros, false, true },                      // "04d" --dec
+   { 0x000063B0u, 0x0Cu, HexNoPrefixOrSuffix_LeadingZeros_Lowercase, true, false },         // "0c" --hex
+   { 0x00483133u, 0x31u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "31H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x64337830u, 0x3Du, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x3d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006863u, 0x0Cu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "ch"
+   { 0x41307830u, 0x0Au, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0A"
+   { 0x00483932u, 0x29u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "29H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000048B1u, 0x01u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000048C2u, 0x0Bu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "BH" --hex
+   { 0x003431D8u, 0x14u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X14" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003431u, 0x14u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "14"
+   { 0x0044B131u, 0x0Bu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "11D" --dec
+   { 0x0064B434u, 0x2Cu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "44d" --dec
+   { 0x00393358u, 0x39u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X39"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000000E6u, 0x0Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "f" --hex
+   { 0x00633258u, 0x2Cu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X2c"
+   { 0x00443630u, 0x06u, UppercaseDSuffix_LeadingZeros, false, true },                      // "06D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00005839u, 0x09u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "9X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000032B1u, 0x12u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "12" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00423158u, 0x1Bu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1B"
+   { 0x0044B234u, 0x2Au, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "42D" --dec
+   { 0x000058B2u, 0x02u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006866B3u, 0x3Fu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "3fh" --hex
+   { 0x000043B1u, 0x1Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1C" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B431u, 0x0Eu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "14D" --dec
+   { 0x0044B931u, 0x13u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "19D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643278u, 0x2Du, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x2d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B430u, 0x04u, DecNoPrefixOrSuffix_LeadingZeros, false, true },                   // "04" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483330u, 0x03u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "03H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00007865u, 0x0Eu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "ex"
+   { 0x653178B0u, 0x1Eu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x1e" --hex
+   { 0x003833D8u, 0x38u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X38" --hex
+   { 0x005833B2u, 0x23u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "23X" --hex
+   { 0x000030B1u, 0x10u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "10" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000032u, 0x02u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "2"
+   { 0x00786233u, 0x3Bu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "3bx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00786533u, 0x3Eu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "3ex"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003531D8u, 0x15u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X15" --hex
+   { 0x0064B833u, 0x26u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "38d" --dec
+   { 0x005839B1u, 0x19u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "19X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B031u, 0x0Au, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "10" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00453058u, 0x0Eu, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0E"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x66337830u, 0x3Fu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x3f"
+   { 0x003078B0u, 0x00u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003031u, 0x10u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "10"
+   { 0x004331D8u, 0x1Cu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1C" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000041B3u, 0x3Au, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3A" --hex
+   { 0x00343158u, 0x14u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X14"
+   { 0x00484630u, 0x0Fu, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0FH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006530F8u, 0x0Eu, LowercasexPrefix_LeadingZeros_Lowercase, true, false },            // "x0e" --hex
+   { 0x000063F8u, 0x0Cu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "xc" --hex
+   { 0x00004533u, 0x3Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3E"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004846B0u, 0x0Fu, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0FH" --hex
+   { 0x0044B935u, 0x3Bu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "59D" --dec
+   { 0x00343278u, 0x24u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x24"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006531u, 0x1Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "1e"
+   { 0x000062B1u, 0x1Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "1b" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005846B1u, 0x1Fu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1FX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B132u, 0x15u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "21d" --dec
+   { 0x005863B2u, 0x2Cu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "2cX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004865B3u, 0x3Eu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "3eH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004844u, 0x0Du, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "DH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005830B1u, 0x10u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "10X" --hex
+   { 0x00004278u, 0x0Bu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "xB"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003030u, 0x00u, DecNoPrefixOrSuffix_LeadingZeros, false, false },                  // "00"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006837B2u, 0x27u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "27h" --hex
+   { 0x00586131u, 0x1Au, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "1aX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000044B1u, 0x1Du, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1D" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003432D8u, 0x24u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X24" --hex
+   { 0x00586331u, 0x1Cu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "1cX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B233u, 0x20u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "32d" --dec
+   { 0x00003632u, 0x26u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "26"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00584530u, 0x0Eu, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0EX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643832u, 0x1Cu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "28d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006632u, 0x2Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "2f"
+   { 0x00005846u, 0x0Fu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "FX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000068B0u, 0x00u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0h" --hex
+   { 0x004835B1u, 0x15u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "15H" --hex
+   { 0x00443432u, 0x18u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "24D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006846B2u, 0x2Fu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Fh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B230u, 0x02u, UppercaseDSuffix_LeadingZeros, false, true },                      // "02D" --dec
+   { 0x004478B0u, 0x0Du, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0xD" --hex
+   { 0x00006865u, 0x0Eu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "eh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004230D8u, 0x0Bu, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0B" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583633u, 0x36u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "36X"
+   { 0x004865B0u, 0x0Eu, UppercaseHSuffix_LeadingZeros_Lowercase, true, false },            // "0eH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006835B2u, 0x25u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "25h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006831B3u, 0x31u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "31h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443732u, 0x1Bu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "27D"
+   { 0x004864B1u, 0x1Du, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "1dH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x30337830u, 0x30u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x30"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x303378B0u, 0x30u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x30" --hex
+   { 0x004865B1u, 0x1Eu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "1eH" --hex
+   { 0x00643534u, 0x2Du, LowercasedSuffix_NoLeadingZeros, false, true },                    // "45d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005839B2u, 0x29u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "29X" --hex
+   { 0x00643034u, 0x28u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "40d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583731u, 0x17u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "17X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00453378u, 0x3Eu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3E"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00686330u, 0x0Cu, LowercasehSuffix_LeadingZeros_Lowercase, true, false },            // "0ch"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004836u, 0x06u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "6H"
+   { 0x00586430u, 0x0Du, UppercaseXSuffix_LeadingZeros_Lowercase, true, false },            // "0dX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443131u, 0x0Bu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "11D"
+   { 0x00583931u, 0x19u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "19X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004863u, 0x0Cu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "cH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004865B2u, 0x2Eu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "2eH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000065B1u, 0x1Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "1e" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007841B3u, 0x3Au, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Ax" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00323158u, 0x12u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X12"
+   { 0x00483933u, 0x39u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "39H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000065D8u, 0x0Eu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "Xe" --hex
+   { 0x00486330u, 0x0Cu, UppercaseHSuffix_LeadingZeros_Lowercase, true, false },            // "0cH"
+   { 0x00584133u, 0x3Au, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3AX"
+   { 0x00453278u, 0x2Eu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2E"
+   { 0x453178B0u, 0x1Eu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1E" --hex
+   { 0x373278B0u, 0x27u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x27" --hex
+   { 0x003031D8u, 0x10u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X10" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003131D8u, 0x11u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X11" --hex
+   { 0x00584331u, 0x1Cu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1CX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003732F8u, 0x27u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x27" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000045D8u, 0x0Eu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "XE" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006833B3u, 0x33u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "33h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003231F8u, 0x12u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x12" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006230D8u, 0x0Bu, UppercaseXPrefix_LeadingZeros_Lowercase, true, false },            // "X0b" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443378u, 0x3Du, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B432u, 0x18u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "24" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683531u, 0x15u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "15h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006862B2u, 0x2Bu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "2bh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B532u, 0x19u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "25D" --dec
+   { 0x007833B3u, 0x33u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "33x" --hex
+   { 0x00313258u, 0x21u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X21"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006131u, 0x1Au, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "1a"
+   { 0x00643735u, 0x39u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "57d"
+   { 0x000046B2u, 0x2Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2F" --hex
+   { 0x00003531u, 0x15u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "15"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B330u, 0x03u, DecNoPrefixOrSuffix_LeadingZeros, false, true },                   // "03" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x343278B0u, 0x24u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x24" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006532D8u, 0x2Eu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X2e" --hex
+   { 0x00423278u, 0x2Bu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2B"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007866B1u, 0x1Fu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "1fx" --hex
+   { 0x007834B2u, 0x24u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "24x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007834B3u, 0x34u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "34x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004845B1u, 0x1Eu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1EH" --hex
+   { 0x00783632u, 0x26u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "26x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006630F8u, 0x0Fu, LowercasexPrefix_LeadingZeros_Lowercase, true, false },            // "x0f" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000041B1u, 0x1Au, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1A" --hex
+   { 0x00643635u, 0x38u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "56d"
+   { 0x000041F8u, 0x0Au, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "xA" --hex
+   { 0x00463378u, 0x3Fu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3F"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00383278u, 0x28u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x28"
+   { 0x000036B0u, 0x06u, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "06" --hex
+   { 0x006861B2u, 0x2Au, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "2ah" --hex
+   { 0x00686530u, 0x0Eu, LowercasehSuffix_LeadingZeros_Lowercase, true, false },            // "0eh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000038F8u, 0x08u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x8" --hex
+   { 0x003331F8u, 0x13u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x13" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443633u, 0x24u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "36D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00584533u, 0x3Eu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3EX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00008036u, 0x06u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "6" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B533u, 0x23u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "35d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006232F8u, 0x2Bu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x2b" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783532u, 0x25u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "25x"
+   { 0x000033F8u, 0x03u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004843u, 0x0Cu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "CH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643634u, 0x2Eu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "46d"
+   { 0x000043B0u, 0x0Cu, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0C" --hex
+   { 0x00005836u, 0x06u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "6X"
+   { 0x0064B034u, 0x28u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "40d" --dec
+   { 0x46317830u, 0x1Fu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1F"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783233u, 0x32u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "32x"
+   { 0x000058C6u, 0x0Fu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "FX" --hex
+   { 0x000042D8u, 0x0Bu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "XB" --hex
+   { 0x00443932u, 0x1Du, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "29D"
+   { 0x000068E3u, 0x0Cu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "ch" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00786130u, 0x0Au, LowercasexSuffix_LeadingZeros_Lowercase, true, false },            // "0ax"
+   { 0x00483130u, 0x01u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "01H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005833B3u, 0x33u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "33X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00453178u, 0x1Eu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1E"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007866B2u, 0x2Fu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "2fx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007846B2u, 0x2Fu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Fx" --hex
+   { 0x00003133u, 0x31u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "31"
+   { 0x00686532u, 0x2Eu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "2eh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00684632u, 0x2Fu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Fh"
+   { 0x00653378u, 0x3Eu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x3e"
+   { 0x006431D8u, 0x1Du, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X1d" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x413378B0u, 0x3Au, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3A" --hex
+   { 0x003630D8u, 0x06u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X06" --hex
+   { 0x00006530u, 0x0Eu, HexNoPrefixOrSuffix_LeadingZeros_Lowercase, true, false },         // "0e"
+   { 0x005834B2u, 0x24u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "24X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004838B2u, 0x28u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "28H" --hex
+   { 0x007863B1u, 0x1Cu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "1cx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B533u, 0x23u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "35D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004844B2u, 0x2Du, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2DH" --hex
+   { 0x003830D8u, 0x08u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X08" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443634u, 0x2Eu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "46D"
+   { 0x00684433u, 0x3Du, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Dh"
+   { 0x00643833u, 0x26u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "38d"
+   { 0x0044B132u, 0x15u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "21D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00303058u, 0x00u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X00"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004532u, 0x2Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2E"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007841B2u, 0x2Au, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Ax" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006831B2u, 0x21u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "21h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643734u, 0x2Fu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "47d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006332F8u, 0x2Cu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x2c" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003430F8u, 0x04u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x04" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00373058u, 0x07u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X07"
+   { 0x004844B0u, 0x0Du, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0DH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00303158u, 0x10u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X10"
+   { 0x00363278u, 0x26u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x26"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643835u, 0x3Au, LowercasedSuffix_NoLeadingZeros, false, true },                    // "58d"
+   { 0x004230F8u, 0x0Bu, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0B" --hex
+   { 0x00004841u, 0x0Au, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "AH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006864B2u, 0x2Du, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "2dh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006232D8u, 0x2Bu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X2b" --hex
+   { 0x00343058u, 0x04u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X04"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00486433u, 0x3Du, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "3dH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483831u, 0x18u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "18H"
+   { 0x000068C1u, 0x0Au, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "Ah" --hex
+   { 0x000078B1u, 0x01u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1x" --hex
+   { 0x005834B0u, 0x04u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "04X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00007833u, 0x03u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000039D8u, 0x09u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X9" --hex
+   { 0x463278B0u, 0x2Fu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2F" --hex
+   { 0x00643258u, 0x2Du, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X2d"
+   { 0x007863B3u, 0x3Cu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "3cx" --hex
+   { 0x000039B0u, 0x09u, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "09" --hex
+   { 0x00684430u, 0x0Du, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0Dh"
+   { 0x000031B3u, 0x31u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "31" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003130D8u, 0x01u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X01" --hex
+   { 0x00008033u, 0x03u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "3" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000061D8u, 0x0Au, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "Xa" --hex
+   { 0x000031F8u, 0x01u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006842B2u, 0x2Bu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Bh" --hex
+   { 0x000068C4u, 0x0Du, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "Dh" --hex
+   { 0x30317830u, 0x10u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x10"
+   { 0x006432D8u, 0x2Du, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X2d" --hex
+   { 0x353278B0u, 0x25u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x25" --hex
+   { 0x00363178u, 0x16u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x16"
+   { 0x32327830u, 0x22u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x22"
+   { 0x373178B0u, 0x17u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x17" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683432u, 0x24u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "24h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005843B0u, 0x0Cu, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0CX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B530u, 0x05u, LowercasedSuffix_LeadingZeros, false, true },                      // "05d" --dec
+   { 0x00663058u, 0x0Fu, UppercaseXPrefix_LeadingZeros_Lowercase, true, false },            // "X0f"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784331u, 0x1Cu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Cx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00786131u, 0x1Au, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "1ax"
+   { 0x004631F8u, 0x1Fu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1F" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000063D8u, 0x0Cu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "Xc" --hex
+   { 0x006678B0u, 0x0Fu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0xf" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000044B2u, 0x2Du, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2D" --hex
+   { 0x00484633u, 0x3Fu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3FH"
+   { 0x006845B3u, 0x3Eu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Eh" --hex
+   { 0x007842B1u, 0x1Bu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Bx" --hex
+   { 0x00584532u, 0x2Eu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2EX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00363058u, 0x06u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X06"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483433u, 0x34u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "34H"
+   { 0x00643332u, 0x17u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "23d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006631D8u, 0x1Fu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X1f" --hex
+   { 0x000038D8u, 0x08u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X8" --hex
+   { 0x00683932u, 0x29u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "29h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000078B8u, 0x08u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "8x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B731u, 0x11u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "17" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x37307830u, 0x07u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x07"
+   { 0x42327830u, 0x2Bu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2B"
+   { 0x00643136u, 0x3Du, LowercasedSuffix_NoLeadingZeros, false, true },                    // "61d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583833u, 0x38u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "38X"
+   { 0x00427830u, 0x0Bu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0xB"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00413178u, 0x1Au, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1A"
+   { 0x000039F8u, 0x09u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x9" --hex
+   { 0x003131F8u, 0x11u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x11" --hex
+   { 0x00003878u, 0x08u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x8"
+   { 0x006333F8u, 0x3Cu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x3c" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00333358u, 0x33u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X33"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x44337830u, 0x3Du, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3D"
+   { 0x00643831u, 0x12u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "18d"
+   { 0x00353158u, 0x15u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X15"
+   { 0x00004862u, 0x0Bu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "bH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006862B0u, 0x0Bu, LowercasehSuffix_LeadingZeros_Lowercase, true, false },            // "0bh" --hex
+   { 0x000078C2u, 0x0Bu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "Bx" --hex
+   { 0x000034F8u, 0x04u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x4" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003232D8u, 0x22u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X22" --hex
+   { 0x00584332u, 0x2Cu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2CX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443834u, 0x30u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "48D"
+   { 0x00007831u, 0x01u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1x"
+   { 0x004862B3u, 0x3Bu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "3bH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00586530u, 0x0Eu, UppercaseXSuffix_LeadingZeros_Lowercase, true, false },            // "0eX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000033B0u, 0x03u, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "03" --hex
+   { 0x00003330u, 0x03u, DecNoPrefixOrSuffix_LeadingZeros, false, false },                  // "03"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00413078u, 0x0Au, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0A"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583130u, 0x01u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "01X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783232u, 0x22u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "22x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004863B3u, 0x3Cu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "3cH" --hex
+   { 0x00784632u, 0x2Fu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Fx"
+   { 0x00786330u, 0x0Cu, LowercasexSuffix_LeadingZeros_Lowercase, true, false },            // "0cx"
+   { 0x004836B2u, 0x26u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "26H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004834B2u, 0x24u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "24H" --hex
+   { 0x003633F8u, 0x36u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x36" --hex
+   { 0x00484532u, 0x2Eu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2EH"
+   { 0x006837B0u, 0x07u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "07h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x463078B0u, 0x0Fu, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0F" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003232u, 0x22u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "22"
+   { 0x00443733u, 0x25u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "37D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000046F8u, 0x0Fu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "xF" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643931u, 0x13u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "19d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x393078B0u, 0x09u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x09" --hex
+   { 0x00007862u, 0x0Bu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "bx"
+   { 0x00783730u, 0x07u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "07x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000064u, 0x0Du, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00303078u, 0x00u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x00"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683931u, 0x19u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "19h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00637830u, 0x0Cu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0xc"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004178B0u, 0x0Au, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0xA" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000037u, 0x07u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "7"
+   { 0x000068C3u, 0x0Cu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "Ch" --hex
+   { 0x003978B0u, 0x09u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x9" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B734u, 0x2Fu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "47D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006844B3u, 0x3Du, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Dh" --hex
+   { 0x00643431u, 0x0Eu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "14d"
+   { 0x00003130u, 0x01u, DecNoPrefixOrSuffix_LeadingZeros, false, false },                  // "01"
+   { 0x00784233u, 0x3Bu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Bx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004833u, 0x03u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3H"
+   { 0x00006633u, 0x3Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "3f"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x463178B0u, 0x1Fu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1F" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00463258u, 0x2Fu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2F"
+   { 0x0044B032u, 0x14u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "20D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007832B1u, 0x12u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "12x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006832B1u, 0x12u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "12h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000048E4u, 0x0Du, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "dH" --hex
+   { 0x00486531u, 0x1Eu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "1eH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x303178B0u, 0x10u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x10" --hex
+   { 0x000061B3u, 0x3Au, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "3a" --hex
+   { 0x000030B3u, 0x30u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "30" --hex
+   { 0x00383058u, 0x08u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X08"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004832B3u, 0x32u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "32H" --hex
+   { 0x005861B2u, 0x2Au, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "2aX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000068B2u, 0x02u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2h" --hex
+   { 0x0044B432u, 0x18u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "24D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006861u, 0x0Au, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "ah"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005832B3u, 0x32u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "32X" --hex
+   { 0x393378B0u, 0x39u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x39" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643935u, 0x3Bu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "59d"
+   { 0x00433278u, 0x2Cu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2C"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003632D8u, 0x26u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X26" --hex
+   { 0x0000B733u, 0x25u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "37" --dec
+   { 0x0064B730u, 0x07u, LowercasedSuffix_LeadingZeros, false, true },                      // "07d" --dec
+   { 0x000031B2u, 0x21u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "21" --hex
+   { 0x00786531u, 0x1Eu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "1ex"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006578B0u, 0x0Eu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0xe" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x63317830u, 0x1Cu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x1c"
+   { 0x000043F8u, 0x0Cu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "xC" --hex
+   { 0x00584131u, 0x1Au, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1AX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00005833u, 0x03u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007843B3u, 0x3Cu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Cx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443335u, 0x35u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "53D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B634u, 0x2Eu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "46" --dec
+   { 0x006231D8u, 0x1Bu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X1b" --hex
+   { 0x00633178u, 0x1Cu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x1c"
+   { 0x333078B0u, 0x03u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x03" --hex
+   { 0x00783731u, 0x17u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "17x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003730D8u, 0x07u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X07" --hex
+   { 0x643278B0u, 0x2Du, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x2d" --hex
+   { 0x00447830u, 0x0Du, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0xD"
+   { 0x006841B1u, 0x1Au, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Ah" --hex
+   { 0x000034B1u, 0x14u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "14" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00486533u, 0x3Eu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "3eH"
+   { 0x0000B331u, 0x0Du, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "13" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004431D8u, 0x1Du, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1D" --hex
+   { 0x00483032u, 0x20u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "20H"
+   { 0x006331F8u, 0x1Cu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x1c" --hex
+   { 0x62307830u, 0x0Bu, ClassicHexPrefix_LeadingZeros_Lowercase, true, false },            // "0x0b"
+   { 0x00643378u, 0x3Du, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x3d"
+   { 0x00486630u, 0x0Fu, UppercaseHSuffix_LeadingZeros_Lowercase, true, false },            // "0fH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004864u, 0x0Du, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "dH"
+   { 0x00004458u, 0x0Du, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "XD"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B730u, 0x07u, DecNoPrefixOrSuffix_LeadingZeros, false, true },                   // "07" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000078B7u, 0x07u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "7x" --hex
+   { 0x000078B4u, 0x04u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "4x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00684231u, 0x1Bu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Bh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006836B0u, 0x06u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "06h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B134u, 0x29u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "41D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005842B3u, 0x3Bu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3BX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004863B2u, 0x2Cu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "2cH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004839B2u, 0x29u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "29H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004866B3u, 0x3Fu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "3fH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683133u, 0x31u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "31h"
+   { 0x007861B0u, 0x0Au, LowercasexSuffix_LeadingZeros_Lowercase, true, false },            // "0ax" --hex
+   { 0x004430D8u, 0x0Du, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0D" --hex
+   { 0x005841B3u, 0x3Au, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3AX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00633278u, 0x2Cu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x2c"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006633F8u, 0x3Fu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x3f" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B832u, 0x1Cu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "28D" --dec
+   { 0x0064B432u, 0x18u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "24d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00584333u, 0x3Cu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3CX"
+   { 0x007865B1u, 0x1Eu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "1ex" --hex
+   { 0x00647830u, 0x0Du, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0xd"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00383158u, 0x18u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X18"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443534u, 0x2Du, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "45D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004838u, 0x08u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "8H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004332F8u, 0x2Cu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2C" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00353278u, 0x25u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x25"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006837B1u, 0x17u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "17h" --hex
+   { 0x45337830u, 0x3Eu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3E"
+   { 0x003831F8u, 0x18u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x18" --hex
+   { 0x000030B2u, 0x20u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "20" --hex
+   { 0x003378B0u, 0x03u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3" --hex
+   { 0x004433F8u, 0x3Du, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3D" --hex
+   { 0x39327830u, 0x29u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x29"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B831u, 0x12u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "18" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003033u, 0x30u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "30"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004830B0u, 0x00u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "00H" --hex
+   { 0x00443734u, 0x2Fu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "47D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000037B3u, 0x37u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "37" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006832u, 0x02u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643236u, 0x3Eu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "62d"
+   { 0x0064B931u, 0x13u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "19d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003033F8u, 0x30u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x30" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003331D8u, 0x13u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X13" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006837u, 0x07u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "7h"
+   { 0x000068B3u, 0x03u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x63307830u, 0x0Cu, ClassicHexPrefix_LeadingZeros_Lowercase, true, false },            // "0x0c"
+   { 0x00643058u, 0x0Du, UppercaseXPrefix_LeadingZeros_Lowercase, true, false },            // "X0d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784433u, 0x3Du, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Dx"
+   { 0x00443632u, 0x1Au, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "26D"
+   { 0x00007842u, 0x0Bu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "Bx"
+   { 0x00786630u, 0x0Fu, LowercasexSuffix_LeadingZeros_Lowercase, true, false },            // "0fx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x633178B0u, 0x1Cu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x1c" --hex
+   { 0x32307830u, 0x02u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x02"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005831B1u, 0x11u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "11X" --hex
+   { 0x00443034u, 0x28u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "40D"
+   { 0x00684532u, 0x2Eu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Eh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00397830u, 0x09u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x9"
+   { 0x00583131u, 0x11u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "11X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00484530u, 0x0Eu, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0EH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004133D8u, 0x3Au, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3A" --hex
+   { 0x005841B1u, 0x1Au, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1AX" --hex
+   { 0x00583531u, 0x15u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "15X"
+   { 0x00583231u, 0x12u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "12X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00413158u, 0x1Au, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1A"
+   { 0x00003331u, 0x13u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "13"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B830u, 0x08u, LowercasedSuffix_LeadingZeros, false, true },                      // "08d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x653078B0u, 0x0Eu, ClassicHexPrefix_LeadingZeros_Lowercase, true, false },            // "0x0e" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006278u, 0x0Bu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "xb"
+   { 0x00393158u, 0x19u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X19"
+   { 0x007845B2u, 0x2Eu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Ex" --hex
+   { 0x00007843u, 0x0Cu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "Cx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000000B4u, 0x04u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "4" --hex
+   { 0x0044B835u, 0x3Au, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "58D" --dec
+   { 0x00483231u, 0x12u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "12H"
+   { 0x003930F8u, 0x09u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x09" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00584531u, 0x1Eu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1EX"
+   { 0x000062F8u, 0x0Bu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "xb" --hex
+   { 0x000035F8u, 0x05u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x5" --hex
+   { 0x005839B3u, 0x39u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "39X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004834u, 0x04u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "4H"
+   { 0x00003178u, 0x01u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1"
+   { 0x006844B0u, 0x0Du, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0Dh" --hex
+   { 0x00683132u, 0x21u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "21h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B530u, 0x05u, DecNoPrefixOrSuffix_LeadingZeros, false, true },                   // "05" --dec
+   { 0x007866B0u, 0x0Fu, LowercasexSuffix_LeadingZeros_Lowercase, true, false },            // "0fx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000078B9u, 0x09u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "9x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004258u, 0x0Bu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "XB"
+   { 0x00683031u, 0x10u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "10h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x44317830u, 0x1Du, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005845B0u, 0x0Eu, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0EX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B130u, 0x01u, UppercaseDSuffix_LeadingZeros, false, true },                      // "01D" --dec
+   { 0x003731F8u, 0x17u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x17" --hex
+   { 0x00486131u, 0x1Au, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "1aH"
+   { 0x00000065u, 0x0Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "e"
+   { 0x0000B732u, 0x1Bu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "27" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006866B0u, 0x0Fu, LowercasehSuffix_LeadingZeros_Lowercase, true, false },            // "0fh" --hex
+   { 0x00686432u, 0x2Du, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "2dh"
+   { 0x423278B0u, 0x2Bu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2B" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007842B0u, 0x0Bu, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0Bx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B835u, 0x3Au, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "58" --dec
+   { 0x00000043u, 0x0Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "C"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000062u, 0x0Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "b"
+   { 0x0000B431u, 0x0Eu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "14" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783530u, 0x05u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "05x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643633u, 0x24u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "36d"
+   { 0x00486130u, 0x0Au, UppercaseHSuffix_LeadingZeros_Lowercase, true, false },            // "0aH"
+   { 0x007839B1u, 0x19u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "19x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007836B1u, 0x16u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "16x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443830u, 0x08u, UppercaseDSuffix_LeadingZeros, false, true },                      // "08D"
+   { 0x0064B135u, 0x33u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "51d" --dec
+   { 0x00363078u, 0x06u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x06"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007832B0u, 0x02u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "02x" --hex
+   { 0x00003432u, 0x24u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "24"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00007838u, 0x08u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "8x"
+   { 0x006633D8u, 0x3Fu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X3f" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x363378B0u, 0x36u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x36" --hex
+   { 0x00000036u, 0x06u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "6"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007832B3u, 0x32u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "32x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x413078B0u, 0x0Au, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0A" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x38307830u, 0x08u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x08"
+   { 0x00004432u, 0x2Du, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683433u, 0x34u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "34h"
+   { 0x00000038u, 0x08u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "8"
+   { 0x006862B1u, 0x1Bu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "1bh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005866B2u, 0x2Fu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "2fX" --hex
+   { 0x004332D8u, 0x2Cu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2C" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003678B0u, 0x06u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x6" --hex
+   { 0x00423178u, 0x1Bu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1B"
+   { 0x00004861u, 0x0Au, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "aH"
+   { 0x00484432u, 0x2Du, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2DH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643430u, 0x04u, LowercasedSuffix_LeadingZeros, false, true },                      // "04d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00413378u, 0x3Au, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3A"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00484133u, 0x3Au, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3AH"
+   { 0x00653258u, 0x2Eu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X2e"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000032B2u, 0x22u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "22" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443635u, 0x38u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "56D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00313278u, 0x21u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x21"
+   { 0x000068C2u, 0x0Bu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "Bh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000064F8u, 0x0Du, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "xd" --hex
+   { 0x000064B3u, 0x3Du, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "3d" --hex
+   { 0x004530F8u, 0x0Eu, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0E" --hex
+   { 0x006533F8u, 0x3Eu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x3e" --hex
+   { 0x00443234u, 0x2Au, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "42D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B333u, 0x21u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "33d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004130u, 0x0Au, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0A"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00486430u, 0x0Du, UppercaseHSuffix_LeadingZeros_Lowercase, true, false },            // "0dH"
+   { 0x000038B3u, 0x38u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "38" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B335u, 0x35u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "53d" --dec
+   { 0x0000B036u, 0x3Cu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "60" --dec
+   { 0x00643934u, 0x31u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "49d"
+   { 0x00583930u, 0x09u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "09X"
+   { 0x00443831u, 0x12u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "18D"
+   { 0x000046B0u, 0x0Fu, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0F" --hex
+   { 0x000033B1u, 0x13u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "13" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005844B1u, 0x1Du, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1DX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000058C4u, 0x0Du, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "DX" --hex
+   { 0x000048E5u, 0x0Eu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "eH" --hex
+   { 0x00686233u, 0x3Bu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "3bh"
+   { 0x00643234u, 0x2Au, LowercasedSuffix_NoLeadingZeros, false, true },                    // "42d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00484431u, 0x1Du, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1DH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443130u, 0x01u, UppercaseDSuffix_LeadingZeros, false, true },                      // "01D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B633u, 0x24u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "36" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000064D8u, 0x0Du, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "Xd" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003558u, 0x05u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X5"
+   { 0x00006431u, 0x1Du, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "1d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004837B3u, 0x37u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "37H" --hex
+   { 0x00000063u, 0x0Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "c"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00586531u, 0x1Eu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "1eX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004431F8u, 0x1Du, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1D" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006378B0u, 0x0Cu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0xc" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000068B9u, 0x09u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "9h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B232u, 0x16u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "22" --dec
+   { 0x006831B0u, 0x01u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "01h" --hex
+   { 0x00004837u, 0x07u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "7H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00586633u, 0x3Fu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "3fX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003831u, 0x18u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "18"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004358u, 0x0Cu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "XC"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x363078B0u, 0x06u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x06" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483632u, 0x26u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "26H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583230u, 0x02u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "02X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B133u, 0x1Fu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "31" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000046D8u, 0x0Fu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "XF" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443336u, 0x3Fu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "63D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006838B1u, 0x18u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "18h" --hex
+   { 0x00006378u, 0x0Cu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "xc"
+   { 0x413278B0u, 0x2Au, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2A" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00393278u, 0x29u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x29"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005863B0u, 0x0Cu, UppercaseXSuffix_LeadingZeros_Lowercase, true, false },            // "0cX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x65327830u, 0x2Eu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x2e"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00653178u, 0x1Eu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x1e"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004836B3u, 0x36u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "36H" --hex
+   { 0x000068C6u, 0x0Fu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "Fh" --hex
+   { 0x00433378u, 0x3Cu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3C"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643435u, 0x36u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "54d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000068E1u, 0x0Au, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "ah" --hex
+   { 0x00653278u, 0x2Eu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x2e"
+   { 0x0000B834u, 0x30u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "48" --dec
+   { 0x000062B3u, 0x3Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "3b" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005864B2u, 0x2Du, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "2dX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x423078B0u, 0x0Bu, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0B" --hex
+   { 0x006832B0u, 0x02u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "02h" --hex
+   { 0x003778B0u, 0x07u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x7" --hex
+   { 0x005866B1u, 0x1Fu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "1fX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443935u, 0x3Bu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "59D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B036u, 0x3Cu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "60D" --dec
+   { 0x003730F8u, 0x07u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x07" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x433178B0u, 0x1Cu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1C" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00486230u, 0x0Bu, UppercaseHSuffix_LeadingZeros_Lowercase, true, false },            // "0bH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683632u, 0x26u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "26h"
+   { 0x007865B3u, 0x3Eu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "3ex" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443032u, 0x14u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "20D"
+   { 0x43307830u, 0x0Cu, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0C"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003732u, 0x27u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "27"
+   { 0x00443430u, 0x04u, UppercaseDSuffix_LeadingZeros, false, true },                      // "04D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005861B1u, 0x1Au, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "1aX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005830B0u, 0x00u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "00X" --hex
+   { 0x006834B3u, 0x34u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "34h" --hex
+   { 0x00623378u, 0x3Bu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x3b"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643133u, 0x1Fu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "31d"
+   { 0x00586332u, 0x2Cu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "2cX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x34317830u, 0x14u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x14"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B832u, 0x1Cu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "28d" --dec
+   { 0x000038B2u, 0x28u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "28" --hex
+   { 0x00000039u, 0x09u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "9"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B035u, 0x32u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "50D" --dec
+   { 0x00643531u, 0x0Fu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "15d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683930u, 0x09u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "09h"
+   { 0x0044B433u, 0x22u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "34D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000058B9u, 0x09u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "9X" --hex
+   { 0x0000B333u, 0x21u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "33" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683032u, 0x20u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "20h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000065B2u, 0x2Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "2e" --hex
+   { 0x00584233u, 0x3Bu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3BX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004864B3u, 0x3Du, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "3dH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443236u, 0x3Eu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "62D"
+   { 0x000044F8u, 0x0Du, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "xD" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004841B3u, 0x3Au, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3AH" --hex
+   { 0x004837B2u, 0x27u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "27H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006841B0u, 0x0Au, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0Ah" --hex
+   { 0x000061B2u, 0x2Au, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "2a" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00005844u, 0x0Du, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "DX"
+   { 0x007835B2u, 0x25u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "25x" --hex
+   { 0x005844B2u, 0x2Du, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2DX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00786133u, 0x3Au, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "3ax"
+   { 0x0044B930u, 0x09u, UppercaseDSuffix_LeadingZeros, false, true },                      // "09D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000058B8u, 0x08u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "8X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000033D8u, 0x03u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3" --hex
+   { 0x004432D8u, 0x2Du, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2D" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000078E5u, 0x0Eu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "ex" --hex
+   { 0x00006631u, 0x1Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "1f"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004230u, 0x0Bu, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0B"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003332F8u, 0x23u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x23" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000068E6u, 0x0Fu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "fh" --hex
+   { 0x00004630u, 0x0Fu, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0F"
+   { 0x006865B0u, 0x0Eu, LowercasehSuffix_LeadingZeros_Lowercase, true, false },            // "0eh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00008032u, 0x02u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "2" --dec
+   { 0x00684131u, 0x1Au, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Ah"
+   { 0x00686232u, 0x2Bu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "2bh"
+   { 0x00463278u, 0x2Fu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2F"
+   { 0x003931D8u, 0x19u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X19" --hex
+   { 0x00583933u, 0x39u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "39X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000078E4u, 0x0Du, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "dx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004330D8u, 0x0Cu, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0C" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000048B7u, 0x07u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "7H" --hex
+   { 0x00486632u, 0x2Fu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "2fH"
+   { 0x00586232u, 0x2Bu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "2bX"
+   { 0x00357830u, 0x05u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x5"
+   { 0x0064B930u, 0x09u, LowercasedSuffix_LeadingZeros, false, true },                      // "09d" --dec
+   { 0x00373078u, 0x07u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x07"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004843B2u, 0x2Cu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2CH" --hex
+   { 0x00783930u, 0x09u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "09x"
+   { 0x004430F8u, 0x0Du, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0D" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583630u, 0x06u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "06X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004833B1u, 0x13u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "13H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000000B5u, 0x05u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "5" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000065B3u, 0x3Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "3e" --hex
+   { 0x00633358u, 0x3Cu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X3c"
+   { 0x006432F8u, 0x2Du, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x2d" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003230F8u, 0x02u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x02" --hex
+   { 0x00005832u, 0x02u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2X"
+   { 0x0044B233u, 0x20u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "32D" --dec
+   { 0x00003078u, 0x00u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0"
+   { 0x0044B934u, 0x31u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "49D" --dec
+   { 0x0064B130u, 0x01u, LowercasedSuffix_LeadingZeros, false, true },                      // "01d" --dec
+   { 0x007839B2u, 0x29u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "29x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00684331u, 0x1Cu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Ch"
+   { 0x00006178u, 0x0Au, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "xa"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00686630u, 0x0Fu, LowercasehSuffix_LeadingZeros_Lowercase, true, false },            // "0fh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B531u, 0x0Fu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "15d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000036F8u, 0x06u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x6" --hex
+   { 0x0000B433u, 0x22u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "34" --dec
+   { 0x006864B3u, 0x3Du, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "3dh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004158u, 0x0Au, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "XA"
+   { 0x005836B1u, 0x16u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "16X" --hex
+   { 0x006833B1u, 0x13u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "13h" --hex
+   { 0x00584630u, 0x0Fu, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0FX"
+   { 0x00005865u, 0x0Eu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "eX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000041D8u, 0x0Au, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "XA" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00007844u, 0x0Du, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "Dx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000078B0u, 0x00u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B535u, 0x37u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "55d" --dec
+   { 0x00786631u, 0x1Fu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "1fx"
+   { 0x006835B1u, 0x15u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "15h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006230u, 0x0Bu, HexNoPrefixOrSuffix_LeadingZeros_Lowercase, true, false },         // "0b"
+   { 0x00003158u, 0x01u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1"
+   { 0x003330D8u, 0x03u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X03" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483230u, 0x02u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "02H"
+   { 0x005864B3u, 0x3Du, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "3dX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006846B0u, 0x0Fu, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0Fh" --hex
+   { 0x00004333u, 0x3Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3C"
+   { 0x000045B0u, 0x0Eu, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0E" --hex
+   { 0x0064B932u, 0x1Du, LowercasedSuffix_NoLeadingZeros, false, true },                    // "29d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00327830u, 0x02u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2"
+   { 0x00004830u, 0x00u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B134u, 0x29u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "41" --dec
+   { 0x005837B2u, 0x27u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "27X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443835u, 0x3Au, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "58D"
+   { 0x00486633u, 0x3Fu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "3fH"
+   { 0x00683230u, 0x02u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "02h"
+   { 0x00443833u, 0x26u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "38D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00586432u, 0x2Du, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "2dX"
+   { 0x004843B1u, 0x1Cu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1CH" --hex
+   { 0x00484632u, 0x2Fu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2FH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00786431u, 0x1Du, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "1dx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00686132u, 0x2Au, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "2ah"
+   { 0x004233F8u, 0x3Bu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3B" --hex
+   { 0x003731D8u, 0x17u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X17" --hex
+   { 0x00683331u, 0x13u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "13h"
+   { 0x004832B0u, 0x02u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "02H" --hex
+   { 0x00643178u, 0x1Du, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x1d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007833B1u, 0x13u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "13x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003333D8u, 0x33u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X33" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643032u, 0x14u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "20d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00323278u, 0x22u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x22"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B233u, 0x20u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "32" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004862B1u, 0x1Bu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "1bH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x36337830u, 0x36u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x36"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00484132u, 0x2Au, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2AH"
+   { 0x004831B1u, 0x11u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "11H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00586330u, 0x0Cu, UppercaseXSuffix_LeadingZeros_Lowercase, true, false },            // "0cX"
+   { 0x41337830u, 0x3Au, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3A"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x443178B0u, 0x1Du, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1D" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004831B0u, 0x01u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "01H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006233F8u, 0x3Bu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x3b" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00463358u, 0x3Fu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3F"
+   { 0x00483532u, 0x25u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "25H"
+   { 0x005836B3u, 0x36u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "36X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00686231u, 0x1Bu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "1bh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B335u, 0x35u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "53" --dec
+   { 0x006833B2u, 0x23u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "23h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643434u, 0x2Cu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "44d"
+   { 0x004830B2u, 0x20u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "20H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x38317830u, 0x18u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x18"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00323058u, 0x02u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X02"
+   { 0x006844B2u, 0x2Du, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Dh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784333u, 0x3Cu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Cx"
+   { 0x00003978u, 0x09u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x9"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003831D8u, 0x18u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X18" --hex
+   { 0x00483131u, 0x11u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "11H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000000B1u, 0x01u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00005837u, 0x07u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "7X"
+   { 0x433278B0u, 0x2Cu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2C" --hex
+   { 0x00583333u, 0x33u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "33X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004842B3u, 0x3Bu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3BH" --hex
+   { 0x00483331u, 0x13u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "13H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00684531u, 0x1Eu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Eh"
+   { 0x00003332u, 0x23u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "23"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x61337830u, 0x3Au, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x3a"
+   { 0x000035D8u, 0x05u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X5" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x323078B0u, 0x02u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x02" --hex
+   { 0x00643358u, 0x3Du, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X3d"
+   { 0x613278B0u, 0x2Au, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x2a" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005846B0u, 0x0Fu, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0FX" --hex
+   { 0x00004178u, 0x0Au, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "xA"
+   { 0x00004633u, 0x3Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3F"
+   { 0x00313158u, 0x11u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X11"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005841B2u, 0x2Au, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2AX" --hex
+   { 0x00007839u, 0x09u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "9x"
+   { 0x006844B1u, 0x1Du, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Dh" --hex
+   { 0x005863B3u, 0x3Cu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "3cX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00617830u, 0x0Au, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0xa"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B330u, 0x03u, UppercaseDSuffix_LeadingZeros, false, true },                      // "03D" --dec
+   { 0x00683933u, 0x39u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "39h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643030u, 0x00u, LowercasedSuffix_LeadingZeros, false, true },                      // "00d"
+   { 0x00006866u, 0x0Fu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "fh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000078C1u, 0x0Au, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "Ax" --hex
+   { 0x00313378u, 0x31u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x31"
+   { 0x00453258u, 0x2Eu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2E"
+   { 0x00786331u, 0x1Cu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "1cx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x45317830u, 0x1Eu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1E"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004845B2u, 0x2Eu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2EH" --hex
+   { 0x004861B1u, 0x1Au, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "1aH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006863B2u, 0x2Cu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "2ch" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443178u, 0x1Du, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1D"
+   { 0x00003730u, 0x07u, DecNoPrefixOrSuffix_LeadingZeros, false, false },                  // "07"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B933u, 0x27u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "39D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B433u, 0x22u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "34d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005836B0u, 0x06u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "06X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00343258u, 0x24u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X24"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B336u, 0x3Fu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "63" --dec
+   { 0x00005838u, 0x08u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "8X"
+   { 0x00004331u, 0x1Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1C"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005862B1u, 0x1Bu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "1bX" --hex
+   { 0x005843B2u, 0x2Cu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2CX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000058B6u, 0x06u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "6X" --hex
+   { 0x005843B1u, 0x1Cu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1CX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007863B0u, 0x0Cu, LowercasexSuffix_LeadingZeros_Lowercase, true, false },            // "0cx" --hex
+   { 0x000039B1u, 0x19u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "19" --hex
+   { 0x000078C4u, 0x0Du, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "Dx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784430u, 0x0Du, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0Dx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00486133u, 0x3Au, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "3aH"
+   { 0x0044B731u, 0x11u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "17D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00007837u, 0x07u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "7x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004433u, 0x3Du, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3D"
+   { 0x007831B1u, 0x11u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "11x" --hex
+   { 0x00443158u, 0x1Du, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007830B1u, 0x10u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "10x" --hex
+   { 0x005830B3u, 0x30u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "30X" --hex
+   { 0x006630D8u, 0x0Fu, UppercaseXPrefix_LeadingZeros_Lowercase, true, false },            // "X0f" --hex
+   { 0x663278B0u, 0x2Fu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x2f" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x32317830u, 0x12u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x12"
+   { 0x00004632u, 0x2Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2F"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B430u, 0x04u, UppercaseDSuffix_LeadingZeros, false, true },                      // "04D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643834u, 0x30u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "48d"
+   { 0x000034B2u, 0x24u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "24" --hex
+   { 0x005830B2u, 0x20u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "20X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443333u, 0x21u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "33D"
+   { 0x00683733u, 0x37u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "37h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004233u, 0x3Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3B"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006862u, 0x0Bu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "bh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783131u, 0x11u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "11x"
+   { 0x000048C1u, 0x0Au, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "AH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006841B2u, 0x2Au, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Ah" --hex
+   { 0x00584431u, 0x1Du, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1DX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x37317830u, 0x17u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x17"
+   { 0x000000E3u, 0x0Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "c" --hex
+   { 0x00783630u, 0x06u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "06x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643134u, 0x29u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "41d"
+   { 0x00453358u, 0x3Eu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3E"
+   { 0x0044B830u, 0x08u, UppercaseDSuffix_LeadingZeros, false, true },                      // "08D" --dec
+   { 0x000000B3u, 0x03u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3" --hex
+   { 0x00686331u, 0x1Cu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "1ch"
+   { 0x00003778u, 0x07u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x7"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005837B1u, 0x17u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "17X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x383378B0u, 0x38u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x38" --hex
+   { 0x00643335u, 0x35u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "53d"
+   { 0x006632F8u, 0x2Fu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x2f" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x383078B0u, 0x08u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x08" --hex
+   { 0x000043B2u, 0x2Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2C" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006231u, 0x1Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "1b"
+   { 0x00003930u, 0x09u, DecNoPrefixOrSuffix_LeadingZeros, false, false },                  // "09"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784530u, 0x0Eu, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0Ex"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B633u, 0x24u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "36D" --dec
+   { 0x0064B735u, 0x39u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "57d" --dec
+   { 0x423378B0u, 0x3Bu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3B" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004861B2u, 0x2Au, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "2aH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005834B1u, 0x14u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "14X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007846B0u, 0x0Fu, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0Fx" --hex
+   { 0x0044B435u, 0x36u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "54D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000068E5u, 0x0Eu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "eh" --hex
+   { 0x62337830u, 0x3Bu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x3b"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000048B9u, 0x09u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "9H" --hex
+   { 0x0000B934u, 0x31u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "49" --dec
+   { 0x0000B332u, 0x17u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "23" --dec
+   { 0x00783333u, 0x33u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "33x"
+   { 0x0000B630u, 0x06u, DecNoPrefixOrSuffix_LeadingZeros, false, true },                   // "06" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000078C5u, 0x0Eu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "Ex" --hex
+   { 0x0044B335u, 0x35u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "53D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443134u, 0x29u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "41D"
+   { 0x004131D8u, 0x1Au, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1A" --hex
+   { 0x005866B0u, 0x0Fu, UppercaseXSuffix_LeadingZeros_Lowercase, true, false },            // "0fX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643231u, 0x0Cu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "12d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x38327830u, 0x28u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x28"
+   { 0x000078C3u, 0x0Cu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "Cx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004834B3u, 0x34u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "34H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683030u, 0x00u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "00h"
+   { 0x00633058u, 0x0Cu, UppercaseXPrefix_LeadingZeros_Lowercase, true, false },            // "X0c"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004843B3u, 0x3Cu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3CH" --hex
+   { 0x000058C2u, 0x0Bu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "BX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x393278B0u, 0x29u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x29" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006842B0u, 0x0Bu, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0Bh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005832B2u, 0x22u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "22X" --hex
+   { 0x00683633u, 0x36u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "36h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006866B2u, 0x2Fu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "2fh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005834B3u, 0x34u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "34X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000048B6u, 0x06u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "6H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483631u, 0x16u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "16H"
+   { 0x00583433u, 0x34u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "34X"
+   { 0x00373178u, 0x17u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x17"
+   { 0x00783830u, 0x08u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "08x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00413258u, 0x2Au, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2A"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006839B0u, 0x09u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "09h" --hex
+   { 0x00004835u, 0x05u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "5H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005835B2u, 0x25u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "25X" --hex
+   { 0x000058E2u, 0x0Bu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "bX" --hex
+   { 0x00584430u, 0x0Du, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0DX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783133u, 0x31u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "31x"
+   { 0x00783332u, 0x23u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "23x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003032F8u, 0x20u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x20" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004232F8u, 0x2Bu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2B" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00008039u, 0x09u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "9" --dec
+   { 0x00483031u, 0x10u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "10H"
+   { 0x0000B130u, 0x01u, DecNoPrefixOrSuffix_LeadingZeros, false, true },                   // "01" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x443078B0u, 0x0Du, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0D" --hex
+   { 0x00783430u, 0x04u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "04x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007830B3u, 0x30u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "30x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783130u, 0x01u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "01x"
+   { 0x0044B331u, 0x0Du, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "13D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004578u, 0x0Eu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "xE"
+   { 0x000046B3u, 0x3Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3F" --hex
+   { 0x000078C6u, 0x0Fu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "Fx" --hex
+   { 0x006864B0u, 0x0Du, LowercasehSuffix_LeadingZeros_Lowercase, true, false },            // "0dh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003532F8u, 0x25u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x25" --hex
+   { 0x00783132u, 0x21u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "21x"
+   { 0x0044B030u, 0x00u, UppercaseDSuffix_LeadingZeros, false, true },                      // "00D" --dec
+   { 0x00463078u, 0x0Fu, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0F"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006838u, 0x08u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "8h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007862B3u, 0x3Bu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "3bx" --hex
+   { 0x00684232u, 0x2Bu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Bh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003832F8u, 0x28u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x28" --hex
+   { 0x003431F8u, 0x14u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x14" --hex
+   { 0x00484330u, 0x0Cu, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0CH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004842B1u, 0x1Bu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1BH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784432u, 0x2Du, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Dx"
+   { 0x000058B4u, 0x04u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "4X" --hex
+   { 0x00343078u, 0x04u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x04"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00005866u, 0x0Fu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "fX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00383378u, 0x38u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x38"
+   { 0x31337830u, 0x31u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x31"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005845B2u, 0x2Eu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2EX" --hex
+   { 0x0064B330u, 0x03u, LowercasedSuffix_LeadingZeros, false, true },                      // "03d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00586231u, 0x1Bu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "1bX"
+   { 0x323278B0u, 0x22u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x22" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006658u, 0x0Fu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "Xf"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483830u, 0x08u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "08H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00303178u, 0x10u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x10"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483530u, 0x05u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "05H"
+   { 0x00486333u, 0x3Cu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "3cH"
+   { 0x00005863u, 0x0Cu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "cX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006478B0u, 0x0Du, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0xd" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00005862u, 0x0Bu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "bX"
+   { 0x007839B3u, 0x39u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "39x" --hex
+   { 0x004839B3u, 0x39u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "39H" --hex
+   { 0x000046B1u, 0x1Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1F" --hex
+   { 0x004630D8u, 0x0Fu, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0F" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B231u, 0x0Cu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "12D" --dec
+   { 0x0064B435u, 0x36u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "54d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007841B1u, 0x1Au, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Ax" --hex
+   { 0x00007835u, 0x05u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "5x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B631u, 0x10u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "16D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005835B3u, 0x35u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "35X" --hex
+   { 0x46327830u, 0x2Fu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2F"
+   { 0x00006830u, 0x00u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783431u, 0x14u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "14x"
+   { 0x000041B2u, 0x2Au, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2A" --hex
+   { 0x004862B2u, 0x2Bu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "2bH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00623178u, 0x1Bu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x1b"
+   { 0x00643331u, 0x0Du, LowercasedSuffix_NoLeadingZeros, false, true },                    // "13d"
+   { 0x46337830u, 0x3Fu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3F"
+   { 0x0000B734u, 0x2Fu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "47" --dec
+   { 0x000000C6u, 0x0Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "F" --hex
+   { 0x00333178u, 0x13u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x13"
+   { 0x006838B2u, 0x28u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "28h" --hex
+   { 0x004836B1u, 0x16u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "16H" --hex
+   { 0x00586133u, 0x3Au, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "3aX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003530F8u, 0x05u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x05" --hex
+   { 0x003133F8u, 0x31u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x31" --hex
+   { 0x00784332u, 0x2Cu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Cx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006830B1u, 0x10u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "10h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00484131u, 0x1Au, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1AH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x623078B0u, 0x0Bu, ClassicHexPrefix_LeadingZeros_Lowercase, true, false },            // "0x0b" --hex
+   { 0x004844B1u, 0x1Du, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1DH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007832B2u, 0x22u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "22x" --hex
+   { 0x007838B1u, 0x18u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "18x" --hex
+   { 0x000035B3u, 0x35u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "35" --hex
+   { 0x0044B136u, 0x3Du, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "61D" --dec
+   { 0x00486332u, 0x2Cu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "2cH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000043B3u, 0x3Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3C" --hex
+   { 0x00584631u, 0x1Fu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1FX"
+   { 0x00783732u, 0x27u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "27x"
+   { 0x004845B3u, 0x3Eu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3EH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00686433u, 0x3Du, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "3dh"
+   { 0x005842B1u, 0x1Bu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1BX" --hex
+   { 0x000068E4u, 0x0Du, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "dh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005846B3u, 0x3Fu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3FX" --hex
+   { 0x007837B0u, 0x07u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "07x" --hex
+   { 0x00586333u, 0x3Cu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "3cX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784631u, 0x1Fu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Fx"
+   { 0x000064B2u, 0x2Du, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "2d" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006842u, 0x0Bu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "Bh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643158u, 0x1Du, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X1d"
+   { 0x39317830u, 0x19u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x19"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005865B1u, 0x1Eu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "1eX" --hex
+   { 0x00443233u, 0x20u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "32D"
+   { 0x633078B0u, 0x0Cu, ClassicHexPrefix_LeadingZeros_Lowercase, true, false },            // "0x0c" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00684630u, 0x0Fu, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0Fh"
+   { 0x000037B1u, 0x17u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "17" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004838B0u, 0x08u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "08H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B231u, 0x0Cu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "12" --dec
+   { 0x00683730u, 0x07u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "07h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000058E4u, 0x0Du, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "dX" --hex
+   { 0x004866B2u, 0x2Fu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "2fH" --hex
+   { 0x00686332u, 0x2Cu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "2ch"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004330F8u, 0x0Cu, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0C" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00353178u, 0x15u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x15"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00383358u, 0x38u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X38"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00786530u, 0x0Eu, LowercasexSuffix_LeadingZeros_Lowercase, true, false },            // "0ex"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B735u, 0x39u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "57D" --dec
+   { 0x000058C1u, 0x0Au, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "AX" --hex
+   { 0x00684130u, 0x0Au, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0Ah"
+   { 0x00006864u, 0x0Du, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "dh"
+   { 0x00784231u, 0x1Bu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Bx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x42307830u, 0x0Bu, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0B"
+   { 0x00643230u, 0x02u, LowercasedSuffix_LeadingZeros, false, true },                      // "02d"
+   { 0x00783932u, 0x29u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "29x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00684133u, 0x3Au, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Ah"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583632u, 0x26u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "26X"
+   { 0x00683631u, 0x16u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "16h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683033u, 0x30u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "30h"
+   { 0x00363378u, 0x36u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x36"
+   { 0x006131D8u, 0x1Au, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X1a" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006843B1u, 0x1Cu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Ch" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583733u, 0x37u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "37X"
+   { 0x000063B1u, 0x1Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "1c" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443258u, 0x2Du, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583032u, 0x20u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "20X"
+   { 0x006843B3u, 0x3Cu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Ch" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004863B1u, 0x1Cu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "1cH" --hex
+   { 0x004832B2u, 0x22u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "22H" --hex
+   { 0x003531F8u, 0x15u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x15" --hex
+   { 0x00586431u, 0x1Du, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "1dX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007846B3u, 0x3Fu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Fx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000058B7u, 0x07u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "7X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007833B2u, 0x23u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "23x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443531u, 0x0Fu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "15D"
+   { 0x00667830u, 0x0Fu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0xf"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00333078u, 0x03u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x03"
+   { 0x007842B2u, 0x2Bu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Bx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004278B0u, 0x0Bu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0xB" --hex
+   { 0x006863B3u, 0x3Cu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "3ch" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003931u, 0x19u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "19"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B131u, 0x0Bu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "11d" --dec
+   { 0x00786632u, 0x2Fu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "2fx"
+   { 0x303078B0u, 0x00u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x00" --hex
+   { 0x00443735u, 0x39u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "57D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B632u, 0x1Au, LowercasedSuffix_NoLeadingZeros, false, true },                    // "26d" --dec
+   { 0x003231D8u, 0x12u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X12" --hex
+   { 0x00008031u, 0x01u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "1" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003458u, 0x04u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X4"
+   { 0x613178B0u, 0x1Au, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x1a" --hex
+   { 0x004633F8u, 0x3Fu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3F" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00586130u, 0x0Au, UppercaseXSuffix_LeadingZeros_Lowercase, true, false },            // "0aX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643233u, 0x20u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "32d"
+   { 0x00003533u, 0x35u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "35"
+   { 0x00003758u, 0x07u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X7"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000037B2u, 0x27u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "27" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006131F8u, 0x1Au, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x1a" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006834B1u, 0x14u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "14h" --hex
+   { 0x004834B1u, 0x14u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "14H" --hex
+   { 0x61307830u, 0x0Au, ClassicHexPrefix_LeadingZeros_Lowercase, true, false },            // "0x0a"
+   { 0x00786633u, 0x3Fu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "3fx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B135u, 0x33u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "51D" --dec
+   { 0x0000B635u, 0x38u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "56" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004132u, 0x2Au, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2A"
+   { 0x00684233u, 0x3Bu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Bh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003432F8u, 0x24u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x24" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006839B3u, 0x39u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "39h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000042F8u, 0x0Bu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "xB" --hex
+   { 0x006830B0u, 0x00u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "00h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643733u, 0x25u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "37d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683731u, 0x17u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "17h"
+   { 0x000030B0u, 0x00u, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "00" --hex
+   { 0x000048B0u, 0x00u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B332u, 0x17u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "23d" --dec
+   { 0x00006233u, 0x3Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "3b"
+   { 0x00003032u, 0x20u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "20"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00373378u, 0x37u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x37"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006836B3u, 0x36u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "36h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003033D8u, 0x30u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X30" --hex
+   { 0x000068B7u, 0x07u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "7h" --hex
+   { 0x006133F8u, 0x3Au, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x3a" --hex
+   { 0x00643932u, 0x1Du, LowercasedSuffix_NoLeadingZeros, false, true },                    // "29d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00007861u, 0x0Au, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "ax"
+   { 0x006133D8u, 0x3Au, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X3a" --hex
+   { 0x00000041u, 0x0Au, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "A"
+   { 0x007835B3u, 0x35u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "35x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003178B0u, 0x01u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443033u, 0x1Eu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "30D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683830u, 0x08u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "08h"
+   { 0x0000B230u, 0x02u, DecNoPrefixOrSuffix_LeadingZeros, false, true },                   // "02" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443435u, 0x36u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "54D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643130u, 0x01u, LowercasedSuffix_LeadingZeros, false, true },                      // "01d"
+   { 0x004233D8u, 0x3Bu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3B" --hex
+   { 0x41317830u, 0x1Au, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1A"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006431F8u, 0x1Du, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x1d" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00433078u, 0x0Cu, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0C"
+   { 0x000036D8u, 0x06u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X6" --hex
+   { 0x42337830u, 0x3Bu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3B"
+   { 0x006834B0u, 0x04u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "04h" --hex
+   { 0x00623278u, 0x2Bu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x2b"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004633D8u, 0x3Fu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3F" --hex
+   { 0x007864B3u, 0x3Du, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "3dx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583432u, 0x24u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "24X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683732u, 0x27u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "27h"
+   { 0x006833B0u, 0x03u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "03h" --hex
+   { 0x00484232u, 0x2Bu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2BH"
+   { 0x000066B3u, 0x3Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "3f" --hex
+   { 0x00783230u, 0x02u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "02x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007844B2u, 0x2Du, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Dx" --hex
+   { 0x006861B0u, 0x0Au, LowercasehSuffix_LeadingZeros_Lowercase, true, false },            // "0ah" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004846B3u, 0x3Fu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3FH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004835B2u, 0x25u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "25H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00387830u, 0x08u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x8"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B336u, 0x3Fu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "63d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00584632u, 0x2Fu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2FX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006530D8u, 0x0Eu, UppercaseXPrefix_LeadingZeros_Lowercase, true, false },            // "X0e" --hex
+   { 0x000068C5u, 0x0Eu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "Eh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003030F8u, 0x00u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x00" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00486231u, 0x1Bu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "1bH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007831B0u, 0x01u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "01x" --hex
+   { 0x004130D8u, 0x0Au, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0A" --hex
+   { 0x00006630u, 0x0Fu, HexNoPrefixOrSuffix_LeadingZeros_Lowercase, true, false },         // "0f"
+   { 0x007865B0u, 0x0Eu, LowercasexSuffix_LeadingZeros_Lowercase, true, false },            // "0ex" --hex
+   { 0x00003532u, 0x25u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "25"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000048B3u, 0x03u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483731u, 0x17u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "17H"
+   { 0x00443731u, 0x11u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "17D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00008037u, 0x07u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "7" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000000E2u, 0x0Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "b" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x623278B0u, 0x2Bu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x2b" --hex
+   { 0x000000B0u, 0x00u, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00323178u, 0x12u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x12"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006838B0u, 0x08u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "08h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583332u, 0x23u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "23X"
+   { 0x00653078u, 0x0Eu, LowercasexPrefix_LeadingZeros_Lowercase, true, false },            // "x0e"
+   { 0x00613078u, 0x0Au, LowercasexPrefix_LeadingZeros_Lowercase, true, false },            // "x0a"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443532u, 0x19u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "25D"
+   { 0x005865B2u, 0x2Eu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "2eX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006230F8u, 0x0Bu, LowercasexPrefix_LeadingZeros_Lowercase, true, false },            // "x0b" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00786430u, 0x0Du, LowercasexSuffix_LeadingZeros_Lowercase, true, false },            // "0dx"
+   { 0x000066B1u, 0x1Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "1f" --hex
+   { 0x00004478u, 0x0Du, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "xD"
+   { 0x004861B0u, 0x0Au, UppercaseHSuffix_LeadingZeros_Lowercase, true, false },            // "0aH" --hex
+   { 0x413178B0u, 0x1Au, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1A" --hex
+   { 0x00004232u, 0x2Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2B"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006864B1u, 0x1Du, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "1dh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B534u, 0x2Du, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "45" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00613358u, 0x3Au, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X3a"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000036B1u, 0x16u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "16" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B031u, 0x0Au, LowercasedSuffix_NoLeadingZeros, false, true },                    // "10d" --dec
+   { 0x000041B0u, 0x0Au, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0A" --hex
+   { 0x353378B0u, 0x35u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x35" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007834B0u, 0x04u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "04x" --hex
+   { 0x00003333u, 0x33u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "33"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00786231u, 0x1Bu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "1bx"
+   { 0x00004430u, 0x0Du, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x31317830u, 0x11u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x11"
+   { 0x000048E1u, 0x0Au, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "aH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x33327830u, 0x23u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x23"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x663078B0u, 0x0Fu, ClassicHexPrefix_LeadingZeros_Lowercase, true, false },            // "0x0f" --hex
+   { 0x00393378u, 0x39u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x39"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000035B2u, 0x25u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "25" --hex
+   { 0x000031B0u, 0x01u, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "01" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003633u, 0x36u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "36"
+   { 0x005844B3u, 0x3Du, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3DX" --hex
+   { 0x00443331u, 0x0Du, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "13D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005836B2u, 0x26u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "26X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443078u, 0x0Du, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x613078B0u, 0x0Au, ClassicHexPrefix_LeadingZeros_Lowercase, true, false },            // "0x0a" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00423378u, 0x3Bu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3B"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000042B2u, 0x2Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2B" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783933u, 0x39u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "39x"
+   { 0x00486331u, 0x1Cu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "1cH"
+   { 0x313178B0u, 0x11u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x11" --hex
+   { 0x00006844u, 0x0Du, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "Dh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x613378B0u, 0x3Au, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x3a" --hex
+   { 0x000068B6u, 0x06u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "6h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00467830u, 0x0Fu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0xF"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00008030u, 0x00u, DecNoPrefixOrSuffix_LeadingZeros, false, true },                   // "0" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006233D8u, 0x3Bu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X3b" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00347830u, 0x04u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x4"
+   { 0x006278B0u, 0x0Bu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0xb" --hex
+   { 0x004530D8u, 0x0Eu, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0E" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004832u, 0x02u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2H"
+   { 0x00003530u, 0x05u, DecNoPrefixOrSuffix_LeadingZeros, false, false },                  // "05"
+   { 0x0064B331u, 0x0Du, LowercasedSuffix_NoLeadingZeros, false, true },                    // "13d" --dec
+   { 0x333178B0u, 0x13u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x13" --hex
+   { 0x00484130u, 0x0Au, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0AH"
+   { 0x00684332u, 0x2Cu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Ch"
+   { 0x003532D8u, 0x25u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X25" --hex
+   { 0x00683630u, 0x06u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "06h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B033u, 0x1Eu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "30" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00303378u, 0x30u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x30"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643031u, 0x0Au, LowercasedSuffix_NoLeadingZeros, false, true },                    // "10d"
+   { 0x007838B0u, 0x08u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "08x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00005831u, 0x01u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583233u, 0x32u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "32X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x44327830u, 0x2Du, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2D"
+   { 0x00684533u, 0x3Eu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Eh"
+   { 0x00003833u, 0x38u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "38"
+   { 0x007844B0u, 0x0Du, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0Dx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004862B0u, 0x0Bu, UppercaseHSuffix_LeadingZeros_Lowercase, true, false },            // "0bH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006865B3u, 0x3Eu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "3eh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003233u, 0x32u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "32"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007845B0u, 0x0Eu, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0Ex" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003231u, 0x12u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "12"
+   { 0x00686633u, 0x3Fu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "3fh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003478B0u, 0x04u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x4" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004333F8u, 0x3Cu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3C" --hex
+   { 0x00484533u, 0x3Eu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3EH"
+   { 0x0044B632u, 0x1Au, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "26D" --dec
+   { 0x00633378u, 0x3Cu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x3c"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006846B3u, 0x3Fu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Fh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x323178B0u, 0x12u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x12" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003858u, 0x08u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X8"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000035B1u, 0x15u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "15" --hex
+   { 0x006831B1u, 0x11u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "11h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000058B5u, 0x05u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "5X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683533u, 0x35u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "35h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x43337830u, 0x3Cu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3C"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000044u, 0x0Du, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "D"
+   { 0x00323078u, 0x02u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x02"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x653278B0u, 0x2Eu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x2e" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00333378u, 0x33u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x33"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003933u, 0x39u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "39"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784131u, 0x1Au, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Ax"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000058B0u, 0x00u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "0X" --hex
+   { 0x00005864u, 0x0Du, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "dX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x41327830u, 0x2Au, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2A"
+   { 0x39307830u, 0x09u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x09"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x63337830u, 0x3Cu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x3c"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000068B4u, 0x04u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "4h" --hex
+   { 0x007830B0u, 0x00u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "00x" --hex
+   { 0x006865B1u, 0x1Eu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "1eh" --hex
+   { 0x393178B0u, 0x19u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x19" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006578u, 0x0Eu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "xe"
+   { 0x653378B0u, 0x3Eu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x3e" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B236u, 0x3Eu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "62D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B732u, 0x1Bu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "27d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x463378B0u, 0x3Fu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3F" --hex
+   { 0x000078B3u, 0x03u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3x" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003931F8u, 0x19u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x19" --hex
+   { 0x004533F8u, 0x3Eu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3E" --hex
+   { 0x005843B3u, 0x3Cu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3CX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00423358u, 0x3Bu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3B"
+   { 0x000034B3u, 0x34u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "34" --hex
+   { 0x000058B1u, 0x01u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643631u, 0x10u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "16d"
+   { 0x61317830u, 0x1Au, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x1a"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483430u, 0x04u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "04H"
+   { 0x00006331u, 0x1Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "1c"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B733u, 0x25u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "37d" --dec
+   { 0x006866B1u, 0x1Fu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "1fh" --hex
+   { 0x00003958u, 0x09u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X9"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B530u, 0x05u, UppercaseDSuffix_LeadingZeros, false, true },                      // "05D" --dec
+   { 0x0064B634u, 0x2Eu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "46d" --dec
+   { 0x35317830u, 0x15u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x15"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B236u, 0x3Eu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "62d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000045u, 0x0Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "E"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000000C5u, 0x0Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "E" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000036B3u, 0x36u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "36" --hex
+   { 0x003933F8u, 0x39u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x39" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000037D8u, 0x07u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X7" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006330F8u, 0x0Cu, LowercasexPrefix_LeadingZeros_Lowercase, true, false },            // "x0c" --hex
+   { 0x0064B334u, 0x2Bu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "43d" --dec
+   { 0x007841B0u, 0x0Au, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0Ax" --hex
+   { 0x643378B0u, 0x3Du, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x3d" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00663178u, 0x1Fu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x1f"
+   { 0x005842B2u, 0x2Bu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2BX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643078u, 0x0Du, LowercasexPrefix_LeadingZeros_Lowercase, true, false },            // "x0d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004846u, 0x0Fu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "FH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683431u, 0x14u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "14h"
+   { 0x00433258u, 0x2Cu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2C"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443132u, 0x15u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "21D"
+   { 0x00686333u, 0x3Cu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "3ch"
+   { 0x005835B1u, 0x15u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "15X" --hex
+   { 0x00683130u, 0x01u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "01h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000038B1u, 0x18u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "18" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483431u, 0x14u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "14H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006631F8u, 0x1Fu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x1f" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443358u, 0x3Du, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3D"
+   { 0x004833B3u, 0x33u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "33H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B534u, 0x2Du, LowercasedSuffix_NoLeadingZeros, false, true },                    // "45d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000066F8u, 0x0Fu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "xf" --hex
+   { 0x00623158u, 0x1Bu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X1b"
+   { 0x00333158u, 0x13u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X13"
+   { 0x00583030u, 0x00u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "00X"
+   { 0x000068B1u, 0x01u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006835B3u, 0x35u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "35h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00337830u, 0x03u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3"
+   { 0x000031B1u, 0x11u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "11" --hex
+   { 0x00686130u, 0x0Au, LowercasehSuffix_LeadingZeros_Lowercase, true, false },            // "0ah"
+   { 0x00003733u, 0x37u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "37"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00413278u, 0x2Au, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2A"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x663178B0u, 0x1Fu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x1f" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683530u, 0x05u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "05h"
+   { 0x004432F8u, 0x2Du, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2D" --hex
+   { 0x004133F8u, 0x3Au, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x3A" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007831B2u, 0x21u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "21x" --hex
+   { 0x00784431u, 0x1Du, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Dx"
+   { 0x00786532u, 0x2Eu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "2ex"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B431u, 0x0Eu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "14d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000045B2u, 0x2Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "2E" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00586631u, 0x1Fu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "1fX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00686430u, 0x0Du, LowercasehSuffix_LeadingZeros_Lowercase, true, false },            // "0dh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00584633u, 0x3Fu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3FX"
+   { 0x006865B2u, 0x2Eu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "2eh" --hex
+   { 0x000061B0u, 0x0Au, HexNoPrefixOrSuffix_LeadingZeros_Lowercase, true, false },         // "0a" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683232u, 0x22u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "22h"
+   { 0x00373278u, 0x27u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x27"
+   { 0x000058C3u, 0x0Cu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "CX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00627830u, 0x0Bu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0xb"
+   { 0x000000E5u, 0x0Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "e" --hex
+   { 0x00006432u, 0x2Du, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "2d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000000B9u, 0x09u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "9" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x373378B0u, 0x37u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x37" --hex
+   { 0x00003131u, 0x11u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "11"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004866B1u, 0x1Fu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "1fH" --hex
+   { 0x006843B0u, 0x0Cu, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0Ch" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00684230u, 0x0Bu, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0Bh"
+   { 0x0044B133u, 0x1Fu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "31D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784232u, 0x2Bu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Bx"
+   { 0x000058B3u, 0x03u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "3X" --hex
+   { 0x0044B535u, 0x37u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "55D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005865B0u, 0x0Eu, UppercaseXSuffix_LeadingZeros_Lowercase, true, false },            // "0eX" --hex
+   { 0x35327830u, 0x25u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x25"
+   { 0x00483832u, 0x28u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "28H"
+   { 0x00004558u, 0x0Eu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "XE"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000058E1u, 0x0Au, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "aX" --hex
+   { 0x00343358u, 0x34u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X34"
+   { 0x00006843u, 0x0Cu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "Ch"
+   { 0x003330F8u, 0x03u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x03" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B834u, 0x30u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "48d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B631u, 0x10u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "16d" --dec
+   { 0x00643632u, 0x1Au, LowercasedSuffix_NoLeadingZeros, false, true },                    // "26d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x433078B0u, 0x0Cu, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0C" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x643178B0u, 0x1Du, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x1d" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004531F8u, 0x1Eu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1E" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00373258u, 0x27u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X27"
+   { 0x00443133u, 0x1Fu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "31D"
+   { 0x43327830u, 0x2Cu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2C"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483533u, 0x35u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "35H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007846B1u, 0x1Fu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Fx" --hex
+   { 0x007844B1u, 0x1Du, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Dx" --hex
+   { 0x0000B832u, 0x1Cu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "28" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643930u, 0x09u, LowercasedSuffix_LeadingZeros, false, true },                      // "09d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583232u, 0x22u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "22X"
+   { 0x006531F8u, 0x1Eu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x1e" --hex
+   { 0x00583532u, 0x25u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "25X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004863B0u, 0x0Cu, UppercaseHSuffix_LeadingZeros_Lowercase, true, false },            // "0cH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00623058u, 0x0Bu, UppercaseXPrefix_LeadingZeros_Lowercase, true, false },            // "X0b"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00433058u, 0x0Cu, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0C"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x44307830u, 0x0Du, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0D"
+   { 0x000036B2u, 0x26u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "26" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006845B1u, 0x1Eu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Eh" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643131u, 0x0Bu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "11d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006333u, 0x3Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "3c"
+   { 0x00005843u, 0x0Cu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "CX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007834B1u, 0x14u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "14x" --hex
+   { 0x000037B0u, 0x07u, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "07" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00008035u, 0x05u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "5" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00373358u, 0x37u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X37"
+   { 0x00784533u, 0x3Eu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Ex"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443934u, 0x31u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "49D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B434u, 0x2Cu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "44D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006835u, 0x05u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "5h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003633D8u, 0x36u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X36" --hex
+   { 0x007864B1u, 0x1Du, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "1dx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00684633u, 0x3Fu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Fh"
+   { 0x006130D8u, 0x0Au, UppercaseXPrefix_LeadingZeros_Lowercase, true, false },            // "X0a" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483930u, 0x09u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "09H"
+   { 0x0064B230u, 0x02u, LowercasedSuffix_LeadingZeros, false, true },                      // "02d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00484230u, 0x0Bu, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0BH"
+   { 0x00007832u, 0x02u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005837B3u, 0x37u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "37X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006839B1u, 0x19u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "19h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483332u, 0x23u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "23H"
+   { 0x00443136u, 0x3Du, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "61D"
+   { 0x000048E3u, 0x0Cu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "cH" --hex
+   { 0x00623078u, 0x0Bu, LowercasexPrefix_LeadingZeros_Lowercase, true, false },            // "x0b"
+   { 0x006832B2u, 0x22u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "22h" --hex
+   { 0x004632F8u, 0x2Fu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2F" --hex
+   { 0x004632D8u, 0x2Fu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2F" --hex
+   { 0x00683832u, 0x28u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "28h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00423058u, 0x0Bu, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0B"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x343378B0u, 0x34u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x34" --hex
+   { 0x0044B634u, 0x2Eu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "46D" --dec
+   { 0x00623358u, 0x3Bu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X3b"
+   { 0x000063B2u, 0x2Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "2c" --hex
+   { 0x00457830u, 0x0Eu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0xE"
+   { 0x00417830u, 0x0Au, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0xA"
+   { 0x00586632u, 0x2Fu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "2fX"
+   { 0x00484333u, 0x3Cu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "3CH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006842B3u, 0x3Bu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Bh" --hex
+   { 0x00003358u, 0x03u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X3"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006133u, 0x3Au, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "3a"
+   { 0x00643933u, 0x27u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "39d"
+   { 0x00583431u, 0x14u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "14X"
+   { 0x006863B1u, 0x1Cu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "1ch" --hex
+   { 0x00583730u, 0x07u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "07X"
+   { 0x00663278u, 0x2Fu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x2f"
+   { 0x33317830u, 0x13u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x13"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643630u, 0x06u, LowercasedSuffix_LeadingZeros, false, true },                      // "06d"
+   { 0x003631F8u, 0x16u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x16" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683332u, 0x23u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "23h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003832u, 0x28u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "28"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783231u, 0x12u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "12x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00684530u, 0x0Eu, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "0Eh"
+   { 0x00686632u, 0x2Fu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "2fh"
+   { 0x004830B1u, 0x10u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "10H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007835B1u, 0x15u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "15x" --hex
+   { 0x00583831u, 0x18u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "18X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00393078u, 0x09u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x09"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006332u, 0x2Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "2c"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000038B0u, 0x08u, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "08" --hex
+   { 0x00784330u, 0x0Cu, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "0Cx"
+   { 0x004831B3u, 0x31u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "31H" --hex
+   { 0x003733F8u, 0x37u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x37" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00586533u, 0x3Eu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "3eX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006832B3u, 0x32u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "32h" --hex
+   { 0x00000042u, 0x0Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "B"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B132u, 0x15u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "21" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00453078u, 0x0Eu, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0E"
+   { 0x006834B2u, 0x24u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "24h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006842B1u, 0x1Bu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Bh" --hex
+   { 0x00353078u, 0x05u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x05"
+   { 0x000068B5u, 0x05u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "5h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00317830u, 0x01u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1"
+   { 0x00484430u, 0x0Du, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0DH"
+   { 0x00006330u, 0x0Cu, HexNoPrefixOrSuffix_LeadingZeros_Lowercase, true, false },         // "0c"
+   { 0x003932F8u, 0x29u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x29" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00007834u, 0x04u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "4x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x333278B0u, 0x23u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x23" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005835B0u, 0x05u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "05X" --hex
+   { 0x000048E6u, 0x0Fu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "fH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000034D8u, 0x04u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X4" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006333D8u, 0x3Cu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X3c" --hex
+   { 0x005831B2u, 0x21u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "21X" --hex
+   { 0x00663078u, 0x0Fu, LowercasexPrefix_LeadingZeros_Lowercase, true, false },            // "x0f"
+   { 0x0000B531u, 0x0Fu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "15" --dec
+   { 0x00783931u, 0x19u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "19x"
+   { 0x000037F8u, 0x07u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x7" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483730u, 0x07u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "07H"
+   { 0x004532D8u, 0x2Eu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2E" --hex
+   { 0x004231F8u, 0x1Bu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1B" --hex
+   { 0x00007864u, 0x0Du, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "dx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x46307830u, 0x0Fu, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0F"
+   { 0x0064B030u, 0x00u, LowercasedSuffix_LeadingZeros, false, true },                      // "00d" --dec
+   { 0x000039B3u, 0x39u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "39" --hex
+   { 0x00003430u, 0x04u, DecNoPrefixOrSuffix_LeadingZeros, false, false },                  // "04"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B532u, 0x19u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "25d" --dec
+   { 0x000048B2u, 0x02u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006846u, 0x0Fu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "Fh"
+   { 0x00613378u, 0x3Au, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x3a"
+   { 0x007835B0u, 0x05u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "05x" --hex
+   { 0x36327830u, 0x26u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x26"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005831B0u, 0x01u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "01X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007837B3u, 0x37u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "37x" --hex
+   { 0x0044B534u, 0x2Du, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "45D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00686533u, 0x3Eu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "3eh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006836u, 0x06u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "6h"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643432u, 0x18u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "24d"
+   { 0x000058E3u, 0x0Cu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "cX" --hex
+   { 0x004531D8u, 0x1Eu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1E" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007864B0u, 0x0Du, LowercasexSuffix_LeadingZeros_Lowercase, true, false },            // "0dx" --hex
+   { 0x00363258u, 0x26u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X26"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003433D8u, 0x34u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X34" --hex
+   { 0x004833B2u, 0x23u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "23H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00005841u, 0x0Au, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "AX"
+   { 0x00006130u, 0x0Au, HexNoPrefixOrSuffix_LeadingZeros_Lowercase, true, false },         // "0a"
+   { 0x005832B0u, 0x02u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "02X" --hex
+   { 0x00684132u, 0x2Au, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Ah"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004132F8u, 0x2Au, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x2A" --hex
+   { 0x443278B0u, 0x2Du, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2D" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x313278B0u, 0x21u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x21" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006533D8u, 0x3Eu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X3e" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B136u, 0x3Du, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "61" --dec
+   { 0x00583430u, 0x04u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "04X"
+   { 0x006532F8u, 0x2Eu, LowercasexPrefix_NoLeadingZeros_Lowercase, true, false },          // "x2e" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000044B0u, 0x0Du, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "0D" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00437830u, 0x0Cu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0xC"
+   { 0x003430D8u, 0x04u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X04" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583732u, 0x27u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "27X"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583133u, 0x31u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "31X"
+   { 0x006863B0u, 0x0Cu, LowercasehSuffix_LeadingZeros_Lowercase, true, false },            // "0ch" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643232u, 0x16u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "22d"
+   { 0x004864B0u, 0x0Du, UppercaseHSuffix_LeadingZeros_Lowercase, true, false },            // "0dH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006430D8u, 0x0Du, UppercaseXPrefix_LeadingZeros_Lowercase, true, false },            // "X0d" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00486233u, 0x3Bu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "3bH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004630F8u, 0x0Fu, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0F" --hex
+   { 0x0064B234u, 0x2Au, LowercasedSuffix_NoLeadingZeros, false, true },                    // "42d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483233u, 0x32u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "32H"
+   { 0x00443930u, 0x09u, UppercaseDSuffix_LeadingZeros, false, true },                      // "09D"
+   { 0x00783531u, 0x15u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "15x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783033u, 0x30u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "30x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B632u, 0x1Au, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "26" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643036u, 0x3Cu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "60d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006830B3u, 0x30u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "30h" --hex
+   { 0x007864B2u, 0x2Du, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "2dx" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00383258u, 0x28u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X28"
+   { 0x00586630u, 0x0Fu, UppercaseXSuffix_LeadingZeros_Lowercase, true, false },            // "0fX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00583033u, 0x30u, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "30X"
+   { 0x00006841u, 0x0Au, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "Ah"
+   { 0x00000034u, 0x04u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "4"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000068B8u, 0x08u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "8h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000035B0u, 0x05u, HexNoPrefixOrSuffix_LeadingZeros_Uppercase, true, false },         // "05" --hex
+   { 0x00484332u, 0x2Cu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2CH"
+   { 0x00343378u, 0x34u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x34"
+   { 0x00643533u, 0x23u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "35d"
+   { 0x00643535u, 0x37u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "55d"
+   { 0x00006458u, 0x0Du, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "Xd"
+   { 0x0064B935u, 0x3Bu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "59d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00786230u, 0x0Bu, LowercasexSuffix_LeadingZeros_Lowercase, true, false },            // "0bx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00443235u, 0x34u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "52D"
+   { 0x00363158u, 0x16u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X16"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483733u, 0x37u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "37H"
+   { 0x00323258u, 0x22u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X22"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004865u, 0x0Eu, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "eH"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006332D8u, 0x2Cu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X2c" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000045B1u, 0x1Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1E" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00433178u, 0x1Cu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1C"
+   { 0x00586233u, 0x3Bu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "3bX"
+   { 0x383178B0u, 0x18u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x18" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00006533u, 0x3Eu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "3e"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B935u, 0x3Bu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "59" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B235u, 0x34u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "52d" --dec
+   { 0x00643830u, 0x08u, LowercasedSuffix_LeadingZeros, false, true },                      // "08d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007833B0u, 0x03u, LowercasexSuffix_LeadingZeros_Uppercase, true, false },            // "03x" --hex
+   { 0x00484231u, 0x1Bu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1BH"
+   { 0x00584231u, 0x1Bu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "1BX"
+   { 0x0044B333u, 0x21u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "33D" --dec
+   { 0x45327830u, 0x2Eu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x2E"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000078B5u, 0x05u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "5x" --hex
+   { 0x00323358u, 0x32u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X32"
+   { 0x00784531u, 0x1Eu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "1Ex"
+   { 0x003233D8u, 0x32u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X32" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B932u, 0x1Du, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "29" --dec
+   { 0x000045F8u, 0x0Eu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "xE" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003132D8u, 0x21u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X21" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00353358u, 0x35u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X35"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006433D8u, 0x3Du, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X3d" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x64327830u, 0x2Du, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x2d"
+   { 0x00373158u, 0x17u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X17"
+   { 0x00783433u, 0x34u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "34x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003630F8u, 0x06u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x06" --hex
+   { 0x00333258u, 0x23u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X23"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00683333u, 0x33u, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "33h"
+   { 0x00003631u, 0x16u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "16"
+   { 0x453078B0u, 0x0Eu, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0E" --hex
+   { 0x0000B931u, 0x13u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "19" --dec
+   { 0x000000B8u, 0x08u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "8" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003658u, 0x06u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X6"
+   { 0x00686631u, 0x1Fu, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "1fh"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x005837B0u, 0x07u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "07X" --hex
+   { 0x000033B3u, 0x33u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "33" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00433158u, 0x1Cu, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X1C"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003132u, 0x21u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "21"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x633378B0u, 0x3Cu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x3c" --hex
+   { 0x006845B2u, 0x2Eu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Eh" --hex
+   { 0x00443931u, 0x13u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "19D"
+   { 0x00783533u, 0x35u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "35x"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006178B0u, 0x0Au, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0xa" --hex
+   { 0x006861B3u, 0x3Au, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "3ah" --hex
+   { 0x000000C1u, 0x0Au, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "A" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x45307830u, 0x0Eu, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x0E"
+   { 0x0000B334u, 0x2Bu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "43" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003258u, 0x02u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X2"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000066B2u, 0x2Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "2f" --hex
+   { 0x31327830u, 0x21u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x21"
+   { 0x00006258u, 0x0Bu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "Xb"
+   { 0x00786232u, 0x2Bu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "2bx"
+   { 0x42317830u, 0x1Bu, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x1B"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004846B2u, 0x2Fu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "2FH" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007845B3u, 0x3Eu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Ex" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00486431u, 0x1Du, UppercaseHSuffix_NoLeadingZeros_Lowercase, true, false },          // "1dH"
+   { 0x007836B2u, 0x26u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "26x" --hex
+   { 0x00586132u, 0x2Au, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "2aX"
+   { 0x006835B0u, 0x05u, LowercasehSuffix_LeadingZeros_Uppercase, true, false },            // "05h" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00483432u, 0x24u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "24H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003433u, 0x34u, DecNoPrefixOrSuffix_NoLeadingZeros, false, false },                // "34"
+   { 0x62317830u, 0x1Bu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x1b"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00684333u, 0x3Cu, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Ch"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B034u, 0x28u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "40" --dec
+   { 0x313078B0u, 0x01u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x01" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00586433u, 0x3Du, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "3dX"
+   { 0x00686131u, 0x1Au, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "1ah"
+   { 0x623178B0u, 0x1Bu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x1b" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00784132u, 0x2Au, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2Ax"
+   { 0x004839B0u, 0x09u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "09H" --hex
+   { 0x00393178u, 0x19u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x19"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006861B1u, 0x1Au, LowercasehSuffix_NoLeadingZeros_Lowercase, true, false },          // "1ah" --hex
+   { 0x004331F8u, 0x1Cu, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x1C" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x006531D8u, 0x1Eu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X1e" --hex
+   { 0x003830F8u, 0x08u, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x08" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00586532u, 0x2Eu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "2eX"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004837B0u, 0x07u, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "07H" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004130F8u, 0x0Au, LowercasexPrefix_LeadingZeros_Uppercase, true, false },            // "x0A" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000078B2u, 0x02u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "2x" --hex
+   { 0x35307830u, 0x05u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x05"
+   { 0x00463058u, 0x0Fu, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X0F"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000032B3u, 0x32u, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "32" --hex
+   { 0x006841B3u, 0x3Au, LowercasehSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Ah" --hex
+   { 0x00004831u, 0x01u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000000E4u, 0x0Du, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "d" --hex
+   { 0x00008034u, 0x04u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "4" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007861B2u, 0x2Au, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "2ax" --hex
+   { 0x00484531u, 0x1Eu, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "1EH"
+   { 0x0064B035u, 0x32u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "50d" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00613058u, 0x0Au, UppercaseXPrefix_LeadingZeros_Lowercase, true, false },            // "X0a"
+   { 0x00643330u, 0x03u, LowercasedSuffix_LeadingZeros, false, true },                      // "03d"
+   { 0x00003830u, 0x08u, DecNoPrefixOrSuffix_LeadingZeros, false, false },                  // "08"
+   { 0x005833B0u, 0x03u, UppercaseXSuffix_LeadingZeros_Uppercase, true, false },            // "03X" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B535u, 0x37u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "55" --dec
+   { 0x00006232u, 0x2Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "2b"
+   { 0x443378B0u, 0x3Du, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x3D" --hex
+   { 0x003230D8u, 0x02u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X02" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004631u, 0x1Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1F"
+   { 0x000066D8u, 0x0Fu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "Xf" --hex
+   { 0x005862B0u, 0x0Bu, UppercaseXSuffix_LeadingZeros_Lowercase, true, false },            // "0bX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x000066B0u, 0x0Fu, HexNoPrefixOrSuffix_LeadingZeros_Lowercase, true, false },         // "0f" --hex
+   { 0x005866B3u, 0x3Fu, UppercaseXSuffix_NoLeadingZeros_Lowercase, true, false },          // "3fX" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00643132u, 0x15u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "21d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0064B036u, 0x3Cu, LowercasedSuffix_NoLeadingZeros, false, true },                    // "60d" --dec
+   { 0x004839B1u, 0x19u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "19H" --hex
+   { 0x000062B2u, 0x2Bu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "2b" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x65317830u, 0x1Eu, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x1e"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00783832u, 0x28u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "28x"
+   { 0x00443135u, 0x33u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "51D"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004838B3u, 0x38u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "38H" --hex
+   { 0x00784633u, 0x3Fu, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "3Fx"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00377830u, 0x07u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x7"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x333378B0u, 0x33u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x33" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00003630u, 0x06u, DecNoPrefixOrSuffix_LeadingZeros, false, false },                  // "06"
+   { 0x00686230u, 0x0Bu, LowercasehSuffix_LeadingZeros_Lowercase, true, false },            // "0bh"
+   { 0x000000C4u, 0x0Du, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "D" --hex
+   { 0x00783032u, 0x20u, LowercasexSuffix_NoLeadingZeros_Uppercase, true, false },          // "20x"
+   { 0x0000B035u, 0x32u, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "50" --dec
+   { 0x00643235u, 0x34u, LowercasedSuffix_NoLeadingZeros, false, true },                    // "52d"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x007861B3u, 0x3Au, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "3ax" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00007863u, 0x0Cu, LowercasexSuffix_NoLeadingZeros_Lowercase, true, false },          // "cx"
+   { 0x00483033u, 0x30u, UppercaseHSuffix_NoLeadingZeros_Uppercase, true, false },          // "30H"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003332D8u, 0x23u, UppercaseXPrefix_NoLeadingZeros_Uppercase, true, false },          // "X23" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003030D8u, 0x00u, UppercaseXPrefix_LeadingZeros_Uppercase, true, false },            // "X00" --hex
+   { 0x00000066u, 0x0Fu, HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase, true, false },       // "f"
+   { 0x005846B2u, 0x2Fu, UppercaseXSuffix_NoLeadingZeros_Uppercase, true, false },          // "2FX" --hex
+   { 0x32337830u, 0x32u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x32"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003833F8u, 0x38u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x38" --hex
+   { 0x61327830u, 0x2Au, ClassicHexPrefix_NoLeadingZeros_Lowercase, true, false },          // "0x2a"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0044B635u, 0x38u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "56D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x004843B0u, 0x0Cu, UppercaseHSuffix_LeadingZeros_Uppercase, true, false },            // "0CH" --hex
+   { 0x0044B232u, 0x16u, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "22D" --dec
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000030u, 0x00u, DecNoPrefixOrSuffix_LeadingZeros, false, false },                  // "0"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003533F8u, 0x35u, LowercasexPrefix_NoLeadingZeros_Uppercase, true, false },          // "x35" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x003878B0u, 0x08u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x8" --hex
+   { 0x36317830u, 0x16u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x16"
+   { 0x34337830u, 0x34u, ClassicHexPrefix_NoLeadingZeros_Uppercase, true, false },          // "0x34"
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00004431u, 0x1Du, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "1D"
+   { 0x373078B0u, 0x07u, ClassicHexPrefix_LeadingZeros_Uppercase, true, false },            // "0x07" --hex
+   { 0x00443832u, 0x1Cu, UppercaseDSuffix_NoLeadingZeros, false, true },                    // "28D"
+   { 0x004866B0u, 0x0Fu, UppercaseHSuffix_LeadingZeros_Lowercase, true, false },            // "0fH" --hex
+   { 0x000000C3u, 0x0Cu, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "C" --hex
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x00000000u, 0x00u, 0u, false, false },
+   { 0x0000B131u, 0x0Bu, DecNoPrefixOrSuffix_NoLeadingZeros, false, true },                 // "11" --dec
+   { 0x000044B3u, 0x3Du, HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase, true, false },       // "3D" --hex
+   { 0x00663258u, 0x2Fu, UppercaseXPrefix_NoLeadingZeros_Lowercase, true, false },          // "X2f"
+};
+
+#endif // LIN_PID_ID_SPELLINGS_H
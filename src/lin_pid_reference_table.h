@@ -0,0 +1,24 @@
+/**
+ * @file lin_pid_reference_table.h
+ * @brief The PID for every ID from 0x00 to 0x3F, in ID order.
+ *
+ * Just the initializer list, so the C table in lin_pid.c and the compile-time
+ * checks in lin_pid.hpp come from the same 64 bytes:
+ *
+ *    static const uint8_t TABLE[] = {
+ *       #include "lin_pid_reference_table.h"
+ *    };
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+0x80, 0xC1, 0x42, 0x03, 0xC4, 0x85, 0x06, 0x47,
+0x08, 0x49, 0xCA, 0x8B, 0x4C, 0x0D, 0x8E, 0xCF,
+0x50, 0x11, 0x92, 0xD3, 0x14, 0x55, 0xD6, 0x97,
+0xD8, 0x99, 0x1A, 0x5B, 0x9C, 0xDD, 0x5E, 0x1F,
+0x20, 0x61, 0xE2, 0xA3, 0x64, 0x25, 0xA6, 0xE7,
+0xA8, 0xE9, 0x6A, 0x2B, 0xEC, 0xAD, 0x2E, 0x6F,
+0xF0, 0xB1, 0x32, 0x73, 0xB4, 0xF5, 0x76, 0x37,
+0x78, 0x39, 0xBA, 0xFB, 0x3C, 0x7D, 0xFE, 0xBF
@@ -0,0 +1,269 @@
+/*!
+ * @file    lin_sched.c
+ * @brief   Schedule-table slot timing, bus utilization, and a multi-threaded
+ *          sweep over candidate schedules and baud rates.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <float.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "lin_pid.h"
+#include "lin_ldf.h"
+#include "lin_sched.h"
+
+/* Local Macro Definitions */
+#define MS_PER_SEC            1000.0
+#define MAX_SWEEP_THREADS     256u
+
+/* Datatypes */
+
+struct SweepChunk_S
+{
+   const struct Sched_Candidate_S * candidates;
+   struct Sched_Summary_S * summaries;
+   size_t count;
+};
+
+/* Private Function Prototypes */
+static double BitTimeMs( uint32_t baud_rate );
+static void RunSweepChunk( const struct SweepChunk_S * chunk );
+#ifndef _WIN32
+static void * SweepThread( void * arg );
+static unsigned int NumOfOnlineCores( void );
+#endif
+
+/* Public Function Implementations */
+
+double Sched_FrameTimeNominalMs( uint8_t length, uint32_t baud_rate )
+{
+   assert( baud_rate > 0 );
+   unsigned int bits = SCHED_HEADER_BITS + ( SCHED_BITS_PER_BYTE_FIELD * ((unsigned int)length + 1u) );
+   return (double)bits * BitTimeMs(baud_rate);
+}
+
+double Sched_FrameTimeMaxMs( uint8_t length, uint32_t baud_rate )
+{
+   return SCHED_TFRAME_MAX_FACTOR * Sched_FrameTimeNominalMs(length, baud_rate);
+}
+
+void Sched_Simulate( const struct Sched_Slot_S * slots,
+                     size_t num_slots,
+                     uint32_t baud_rate,
+                     struct Sched_SlotTiming_S * timings,
+                     struct Sched_Summary_S * summary )
+{
+   assert( (slots != NULL) || (0 == num_slots) );
+   assert( summary != NULL );
+   assert( baud_rate > 0 );
+
+   memset( summary, 0, sizeof(*summary) );
+   summary->baud_rate = baud_rate;
+   summary->min_headroom_ms = ( num_slots > 0 ) ? DBL_MAX : 0.0;
+
+   // Frame time is linear in length, so only the 9 possible lengths need working out
+   double nominal_by_len[LDF_MAX_FRAME_LEN + 1];
+   for ( uint8_t len = 0; len <= LDF_MAX_FRAME_LEN; len++ )
+   {
+      nominal_by_len[len] = Sched_FrameTimeNominalMs(len, baud_rate);
+   }
+
+   double start_ms = 0.0;
+   for ( size_t i = 0; i < num_slots; i++ )
+   {
+      const struct Sched_Slot_S * slot = &slots[i];
+      uint8_t length = ( (SCHED_NO_ID == slot->id) || (slot->length > LDF_MAX_FRAME_LEN) )
+                       ? LDF_MAX_FRAME_LEN : slot->length;
+
+      double nominal_ms = nominal_by_len[length];
+      double max_ms = SCHED_TFRAME_MAX_FACTOR * nominal_ms;
+      double headroom_ms = slot->slot_ms - max_ms;
+      bool overrun = ( headroom_ms < 0.0 );
+
+      if ( timings != NULL )
+      {
+         timings[i].start_ms = start_ms;
+         timings[i].nominal_ms = nominal_ms;
+         timings[i].max_ms = max_ms;
+         timings[i].headroom_ms = headroom_ms;
+         timings[i].id = slot->id;
+         timings[i].pid = ComputePID(slot->id);
+         timings[i].length = length;
+         timings[i].overrun = overrun;
+      }
+
+      summary->busy_nominal_ms += nominal_ms;
+      summary->busy_max_ms += max_ms;
+      if ( headroom_ms < summary->min_headroom_ms )
+      {
+         summary->min_headroom_ms = headroom_ms;
+         summary->worst_slot = i;
+      }
+      if ( overrun )
+      {
+         summary->num_overruns++;
+      }
+      start_ms += slot->slot_ms;
+   }
+
+   summary->cycle_ms = start_ms;
+   if ( start_ms > 0.0 )
+   {
+      summary->utilization = summary->busy_nominal_ms / start_ms;
+      summary->worst_case_utilization = summary->busy_max_ms / start_ms;
+   }
+}
+
+enum LIN_PID_Result_E Sched_SlotsFromLDF( const struct LDF_Database_S * db,
+                                          size_t table,
+                                          struct Sched_Slot_S ** slots,
+                                          size_t * num_slots )
+{
+   assert( (db != NULL) && (slots != NULL) && (num_slots != NULL) );
+   assert( table < db->num_schedule_tables );
+
+   const struct LDF_ScheduleTable_S * sched = &db->schedule_tables[table];
+
+   *slots = NULL;
+   *num_slots = 0;
+   if ( 0 == sched->num_entries )
+   {
+      return GoodResult;
+   }
+
+   struct Sched_Slot_S * out = malloc( sched->num_entries * sizeof(*out) );
+   if ( NULL == out )
+   {
+      return OutOfMemory;
+   }
+
+   for ( uint16_t i = 0; i < sched->num_entries; i++ )
+   {
+      const struct LDF_ScheduleEntry_S * entry = &db->schedule_entries[sched->first_entry + i];
+      out[i].slot_ms = entry->delay_ms;
+      if ( LDF_NO_INDEX == entry->frame )
+      {
+         out[i].id = SCHED_NO_ID;
+         out[i].length = LDF_MAX_FRAME_LEN;
+      }
+      else
+      {
+         out[i].id = db->frames[entry->frame].id;
+         out[i].length = db->frames[entry->frame].length;
+      }
+   }
+
+   *slots = out;
+   *num_slots = sched->num_entries;
+   return GoodResult;
+}
+
+void Sched_Sweep( const struct Sched_Candidate_S * candidates,
+                  size_t num_candidates,
+                  struct Sched_Summary_S * summaries,
+                  unsigned int num_threads )
+{
+   assert( ((candidates != NULL) && (summaries != NULL)) || (0 == num_candidates) );
+
+#ifdef _WIN32
+   (void)num_threads;
+   struct SweepChunk_S all = { candidates, summaries, num_candidates };
+   RunSweepChunk(&all);
+#else
+   if ( 0 == num_threads )
+   {
+      num_threads = NumOfOnlineCores();
+   }
+   if ( num_threads > MAX_SWEEP_THREADS )
+   {
+      num_threads = MAX_SWEEP_THREADS;
+   }
+   if ( num_threads > num_candidates )
+   {
+      num_threads = ( num_candidates > 0 ) ? (unsigned int)num_candidates : 1u;
+   }
+
+   pthread_t threads[MAX_SWEEP_THREADS];
+   struct SweepChunk_S chunks[MAX_SWEEP_THREADS];
+   bool started[MAX_SWEEP_THREADS] = { false };
+
+   // Contiguous chunks, the first (num_candidates % num_threads) one bigger
+   size_t per_thread = num_candidates / num_threads;
+   size_t extra = num_candidates % num_threads;
+   size_t next = 0;
+   for ( unsigned int t = 0; t < num_threads; t++ )
+   {
+      size_t count = per_thread + ( (t < extra) ? 1u : 0u );
+      chunks[t].candidates = &candidates[next];
+      chunks[t].summaries = &summaries[next];
+      chunks[t].count = count;
+      next += count;
+   }
+   assert( next == num_candidates );
+
+   // The calling thread takes chunk 0. If a thread can't be started, its
+   // chunk is run here too, so the sweep always completes.
+   for ( unsigned int t = 1; t < num_threads; t++ )
+   {
+      started[t] = ( pthread_create(&threads[t], NULL, SweepThread, &chunks[t]) == 0 );
+   }
+   RunSweepChunk(&chunks[0]);
+   for ( unsigned int t = 1; t < num_threads; t++ )
+   {
+      if ( started[t] )
+      {
+         (void)pthread_join(threads[t], NULL);
+      }
+      else
+      {
+         RunSweepChunk(&chunks[t]);
+      }
+   }
+#endif
+}
+
+/* Private Function Implementations */
+
+static double BitTimeMs( uint32_t baud_rate )
+{
+   return MS_PER_SEC / (double)baud_rate;
+}
+
+static void RunSweepChunk( const struct SweepChunk_S * chunk )
+{
+   for ( size_t i = 0; i < chunk->count; i++ )
+   {
+      const struct Sched_Candidate_S * candidate = &chunk->candidates[i];
+      Sched_Simulate( candidate->slots, candidate->num_slots, candidate->baud_rate,
+                      NULL, &chunk->summaries[i] );
+   }
+}
+
+#ifndef _WIN32
+static void * SweepThread( void * arg )
+{
+   RunSweepChunk( (const struct SweepChunk_S *)arg );
+   return NULL;
+}
+
+static unsigned int NumOfOnlineCores( void )
+{
+   long cores = sysconf(_SC_NPROCESSORS_ONLN);
+   return ( cores > 0 ) ? (unsigned int)cores : 1u;
+}
+#endif
@@ -0,0 +1,125 @@
+/*!
+ * @file    lin_sched.h
+ * @brief   LIN schedule-table timing simulator for bus-capacity planning.
+ *
+ * Works out where every slot of a schedule table starts, how long its frame
+ * takes nominally and in the worst case, and how much of the bus the table
+ * uses. Worst-case frame times follow the LIN 2.x budget:
+ *
+ *    THeader_Nominal   = 34 * Tbit                (break + delimiter + sync + PID)
+ *    TResponse_Nominal = 10 * (N + 1) * Tbit      (N data bytes + checksum)
+ *    TFrame_Max        = 1.4 * (THeader_Nominal + TResponse_Nominal)
+ *
+ * Sched_Sweep() runs many (schedule, baud rate) candidates across all cores
+ * for design-space exploration.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_SCHED_H
+#define LIN_SCHED_H
+
+/* File Inclusions */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "lin_pid.h"
+#include "lin_ldf.h"
+
+/* Public Macro Definitions */
+#define SCHED_HEADER_BITS           34u
+#define SCHED_BITS_PER_BYTE_FIELD   10u   // Start bit + 8 data bits + stop bit
+#define SCHED_TFRAME_MAX_FACTOR     1.4
+#define SCHED_NO_ID                 UINT8_MAX   // Slot whose frame the LDF doesn't model
+
+/* Public Datatypes */
+
+struct Sched_Slot_S
+{
+   double slot_ms;         // Time until the next slot starts
+   uint8_t id;             // SCHED_NO_ID if unknown; the slot is then sized as an 8-byte frame
+   uint8_t length;         // Data bytes
+};
+
+struct Sched_SlotTiming_S
+{
+   double start_ms;        // Offset from the start of the table
+   double nominal_ms;      // THeader_Nominal + TResponse_Nominal
+   double max_ms;          // TFrame_Max
+   double headroom_ms;     // slot_ms - max_ms. Negative means the slot can overrun.
+   uint8_t id;
+   uint8_t pid;            // What goes out in the header; 0 for SCHED_NO_ID
+   uint8_t length;
+   bool overrun;
+};
+
+struct Sched_Summary_S
+{
+   double cycle_ms;                 // Sum of all slot times
+   double busy_nominal_ms;          // Sum of nominal frame times
+   double busy_max_ms;              // Sum of worst-case frame times
+   double utilization;              // busy_nominal_ms / cycle_ms
+   double worst_case_utilization;   // busy_max_ms / cycle_ms
+   double min_headroom_ms;          // Smallest headroom over all slots
+   size_t worst_slot;               // Slot with min_headroom_ms
+   size_t num_overruns;             // Slots whose TFrame_Max doesn't fit
+   uint32_t baud_rate;
+};
+
+struct Sched_Candidate_S
+{
+   const struct Sched_Slot_S * slots;
+   size_t num_slots;
+   uint32_t baud_rate;
+};
+
+/* Public API */
+
+/**
+ * @brief Nominal time (header + response) of a frame with length data bytes.
+ */
+double Sched_FrameTimeNominalMs( uint8_t length, uint32_t baud_rate );
+
+/**
+ * @brief TFrame_Max of a frame with length data bytes.
+ */
+double Sched_FrameTimeMaxMs( uint8_t length, uint32_t baud_rate );
+
+/**
+ * @brief Simulate one pass through a schedule table.
+ *
+ * @param[out] timings One entry per slot, or NULL if only the summary is wanted.
+ * @param[out] summary
+ */
+void Sched_Simulate( const struct Sched_Slot_S * slots,
+                     size_t num_slots,
+                     uint32_t baud_rate,
+                     struct Sched_SlotTiming_S * timings,
+                     struct Sched_Summary_S * summary );
+
+/**
+ * @brief Turn one of db's schedule tables into slots.
+ *
+ * @param[out] slots Allocated here; release with free().
+ * @return GoodResult, or OutOfMemory.
+ */
+enum LIN_PID_Result_E Sched_SlotsFromLDF( const struct LDF_Database_S * db,
+                                          size_t table,
+                                          struct Sched_Slot_S ** slots,
+                                          size_t * num_slots );
+
+/**
+ * @brief Simulate every candidate, summaries[i] getting candidates[i]'s result.
+ *
+ * Candidates are split into contiguous chunks, one per thread.
+ *
+ * @param[in] num_threads 0 for one per online core.
+ */
+void Sched_Sweep( const struct Sched_Candidate_S * candidates,
+                  size_t num_candidates,
+                  struct Sched_Summary_S * summaries,
+                  unsigned int num_threads );
+
+#endif // LIN_SCHED_H
@@ -0,0 +1,338 @@
+/*!
+ * @file    lin_stats.c
+ * @brief   Per-ID period, jitter, and error statistics over captures, with
+ *          per-thread accumulators stitched together at the end.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "lin_pid.h"
+#include "lin_cap.h"
+#include "lin_stats.h"
+
+/* Local Macro Definitions */
+#define MAX_STATS_THREADS        256u
+#define MIN_FRAMES_PER_THREAD    16384u   // Below this a thread costs more than it saves
+
+/* Datatypes */
+
+struct StatsRange_S
+{
+   struct Stats_Summary_S summary;
+   const struct CAP_Reader_S * reader;
+   uint64_t first_frame;
+   uint64_t num_frames;
+   bool complete;                   // Every frame in the range was read
+};
+
+/* Private Function Prototypes */
+static void AddPeriod( struct Stats_ID_S * stats, uint64_t period_us );
+static unsigned int JitterBucket( uint64_t jitter_us );
+static void AddCounts( struct Stats_ID_S * stats, const struct Stats_ID_S * other );
+static void RunRange( struct StatsRange_S * range );
+#ifndef _WIN32
+static void * RangeThread( void * arg );
+static unsigned int NumOfOnlineCores( void );
+#endif
+
+/* Public Function Implementations */
+
+void Stats_Init( struct Stats_Summary_S * summary )
+{
+   assert( summary != NULL );
+
+   memset( summary, 0, sizeof(*summary) );
+   for ( size_t i = 0; i < CAP_NUM_OF_IDS; i++ )
+   {
+      summary->per_id[i].period_min_us = UINT64_MAX;
+   }
+}
+
+void Stats_AddFrame( struct Stats_Summary_S * summary, const struct CAP_Frame_S * frame )
+{
+   assert( (summary != NULL) && (frame != NULL) && (frame->id <= MAX_ID_ALLOWED) );
+
+   struct Stats_ID_S * stats = &summary->per_id[frame->id];
+   if ( (stats->frames > 0) && (frame->timestamp_us < stats->last_us) )
+   {
+      // Only a corrupted capture gets here, and a negative period would wreck every other count
+      stats->out_of_order++;
+      return;
+   }
+   if ( stats->frames > 0 )
+   {
+      AddPeriod( stats, frame->timestamp_us - stats->last_us );
+   }
+   else
+   {
+      stats->first_us = frame->timestamp_us;
+   }
+   stats->last_us = frame->timestamp_us;
+   stats->frames++;
+   stats->parity_errors += ( (frame->flags & CAP_FLAG_PID_ERROR) != 0u ) ? 1u : 0u;
+   stats->checksum_errors += ( (frame->flags & CAP_FLAG_CHECKSUM_ERROR) != 0u ) ? 1u : 0u;
+   stats->missing_responses += ( 0u == frame->length ) ? 1u : 0u;
+   summary->frames++;
+}
+
+void Stats_Append( struct Stats_Summary_S * summary, const struct Stats_Summary_S * next )
+{
+   assert( (summary != NULL) && (next != NULL) );
+
+   summary->frames += next->frames;
+   for ( size_t i = 0; i < CAP_NUM_OF_IDS; i++ )
+   {
+      struct Stats_ID_S * stats = &summary->per_id[i];
+      const struct Stats_ID_S * later = &next->per_id[i];
+      if ( 0 == later->frames )
+      {
+         continue;
+      }
+      if ( 0 == stats->frames )
+      {
+         *stats = *later;
+         continue;
+      }
+
+      if ( later->first_us < stats->last_us )
+      {
+         stats->out_of_order++;
+         AddCounts(stats, later);
+         stats->last_us = ( later->last_us > stats->last_us ) ? later->last_us : stats->last_us;
+         continue;
+      }
+
+      // The gap across the join is a period like any other, and its jitter
+      // against the first period on the far side is one more sample
+      uint64_t join_us = later->first_us - stats->last_us;
+      AddPeriod(stats, join_us);
+      if ( later->periods > 0 )
+      {
+         uint64_t jitter_us = ( later->first_period_us > join_us ) ? (later->first_period_us - join_us)
+                                                                   : (join_us - later->first_period_us);
+         stats->jitter[JitterBucket(jitter_us)]++;
+         stats->last_period_us = later->last_period_us;
+      }
+      AddCounts(stats, later);
+      stats->last_us = later->last_us;
+   }
+}
+
+void Stats_Combine( struct Stats_Summary_S * summary, const struct Stats_Summary_S * other )
+{
+   assert( (summary != NULL) && (other != NULL) );
+
+   summary->frames += other->frames;
+   for ( size_t i = 0; i < CAP_NUM_OF_IDS; i++ )
+   {
+      if ( 0 == summary->per_id[i].frames )
+      {
+         summary->per_id[i] = other->per_id[i];
+      }
+      else
+      {
+         AddCounts( &summary->per_id[i], &other->per_id[i] );
+      }
+   }
+}
+
+enum LIN_PID_Result_E Stats_ProcessCapture( const struct CAP_Reader_S * reader,
+                                            unsigned int num_threads,
+                                            struct Stats_Summary_S * summary )
+{
+   assert( (reader != NULL) && (summary != NULL) );
+
+#ifdef _WIN32
+   num_threads = 1u;
+#else
+   if ( 0 == num_threads )
+   {
+      num_threads = NumOfOnlineCores();
+   }
+#endif
+   if ( num_threads > MAX_STATS_THREADS )
+   {
+      num_threads = MAX_STATS_THREADS;
+   }
+   uint64_t most_threads = reader->num_frames / MIN_FRAMES_PER_THREAD;
+   if ( num_threads > most_threads )
+   {
+      num_threads = ( most_threads > 0 ) ? (unsigned int)most_threads : 1u;
+   }
+
+   struct StatsRange_S * ranges = malloc( num_threads * sizeof(*ranges) );
+   if ( NULL == ranges )
+   {
+      return OutOfMemory;
+   }
+
+   // Contiguous ranges, the first (num_frames % num_threads) one frame longer
+   uint64_t per_thread = reader->num_frames / num_threads;
+   uint64_t extra = reader->num_frames % num_threads;
+   uint64_t next = 0;
+   for ( unsigned int t = 0; t < num_threads; t++ )
+   {
+      ranges[t].reader = reader;
+      ranges[t].first_frame = next;
+      ranges[t].num_frames = per_thread + ( (t < extra) ? 1u : 0u );
+      next += ranges[t].num_frames;
+   }
+   assert( next == reader->num_frames );
+
+#ifdef _WIN32
+   RunRange(&ranges[0]);
+#else
+   pthread_t threads[MAX_STATS_THREADS];
+   bool started[MAX_STATS_THREADS] = { false };
+
+   // Same arrangement as Sched_Sweep(): range 0 runs here, and a range whose
+   // thread couldn't be started runs here afterwards.
+   for ( unsigned int t = 1; t < num_threads; t++ )
+   {
+      started[t] = ( pthread_create(&threads[t], NULL, RangeThread, &ranges[t]) == 0 );
+   }
+   RunRange(&ranges[0]);
+   for ( unsigned int t = 1; t < num_threads; t++ )
+   {
+      if ( started[t] )
+      {
+         (void)pthread_join(threads[t], NULL);
+      }
+      else
+      {
+         RunRange(&ranges[t]);
+      }
+   }
+#endif
+
+   // Stitch the ranges back into one stream, in order
+   bool complete = ranges[0].complete;
+   for ( unsigned int t = 1; t < num_threads; t++ )
+   {
+      Stats_Append( &ranges[0].summary, &ranges[t].summary );
+      complete = complete && ranges[t].complete;
+   }
+   Stats_Combine( summary, &ranges[0].summary );
+   free(ranges);
+
+   return complete ? GoodResult : CaptureFileCorrupt;
+}
+
+double Stats_MeanPeriodUs( const struct Stats_ID_S * stats )
+{
+   assert( stats != NULL );
+   return ( stats->periods > 0 ) ? ((double)stats->period_sum_us / (double)stats->periods) : 0.0;
+}
+
+/* Private Function Implementations */
+
+static void AddPeriod( struct Stats_ID_S * stats, uint64_t period_us )
+{
+   if ( stats->periods > 0 )
+   {
+      uint64_t jitter_us = ( period_us > stats->last_period_us ) ? (period_us - stats->last_period_us)
+                                                                 : (stats->last_period_us - period_us);
+      stats->jitter[JitterBucket(jitter_us)]++;
+   }
+   else
+   {
+      stats->first_period_us = period_us;
+   }
+   stats->last_period_us = period_us;
+   stats->periods++;
+   stats->period_sum_us += period_us;
+   stats->period_min_us = ( period_us < stats->period_min_us ) ? period_us : stats->period_min_us;
+   stats->period_max_us = ( period_us > stats->period_max_us ) ? period_us : stats->period_max_us;
+}
+
+/**
+ * @brief 0 for 0 us, otherwise one more than the index of the top set bit,
+ *        capped at the last bucket.
+ */
+static unsigned int JitterBucket( uint64_t jitter_us )
+{
+   if ( 0u == jitter_us )
+   {
+      return 0u;
+   }
+#ifdef __GNUC__
+   unsigned int bucket = 64u - (unsigned int)__builtin_clzll( (unsigned long long)jitter_us );
+#else
+   unsigned int bucket = 0u;
+   for ( uint64_t rest = jitter_us; rest > 0u; rest >>= 1 )
+   {
+      bucket++;
+   }
+#endif
+   return ( bucket < STATS_JITTER_BUCKETS ) ? bucket : (STATS_JITTER_BUCKETS - 1u);
+}
+
+/**
+ * @brief Everything but the stream ends, which only the caller knows how to join.
+ */
+static void AddCounts( struct Stats_ID_S * stats, const struct Stats_ID_S * other )
+{
+   stats->frames += other->frames;
+   stats->parity_errors += other->parity_errors;
+   stats->checksum_errors += other->checksum_errors;
+   stats->missing_responses += other->missing_responses;
+   stats->out_of_order += other->out_of_order;
+   stats->periods += other->periods;
+   stats->period_sum_us += other->period_sum_us;
+   stats->period_min_us = ( other->period_min_us < stats->period_min_us ) ? other->period_min_us : stats->period_min_us;
+   stats->period_max_us = ( other->period_max_us > stats->period_max_us ) ? other->period_max_us : stats->period_max_us;
+   for ( size_t b = 0; b < STATS_JITTER_BUCKETS; b++ )
+   {
+      stats->jitter[b] += other->jitter[b];
+   }
+}
+
+static void RunRange( struct StatsRange_S * range )
+{
+   Stats_Init(&range->summary);
+   range->complete = ( 0u == range->num_frames );
+
+   struct CAP_Cursor_S cursor;
+   struct CAP_Frame_S frame;
+   if ( (0u == range->num_frames) || !CAP_SeekFrame(range->reader, range->first_frame, &cursor) )
+   {
+      return;
+   }
+   uint64_t n = 0;
+   while ( (n < range->num_frames) && CAP_Next(range->reader, &cursor, &frame) )
+   {
+      Stats_AddFrame(&range->summary, &frame);
+      n++;
+   }
+   range->complete = ( n == range->num_frames );
+}
+
+#ifndef _WIN32
+static void * RangeThread( void * arg )
+{
+   RunRange( (struct StatsRange_S *)arg );
+   return NULL;
+}
+
+static unsigned int NumOfOnlineCores( void )
+{
+   long cores = sysconf(_SC_NPROCESSORS_ONLN);
+   return ( cores > 0 ) ? (unsigned int)cores : 1u;
+}
+#endif
@@ -0,0 +1,107 @@
+/*!
+ * @file    lin_stats.h
+ * @brief   Per-ID timing and error statistics over binary captures.
+ *
+ * For each of the 64 IDs: how many frames went by, the period between
+ * consecutive frames with that ID (min/mean/max), a histogram of period
+ * jitter, and how many frames had a PID parity error, a checksum error, or no
+ * response at all. A frame stamped before the one ahead of it is counted as
+ * out of order and otherwise left out. Jitter here is cycle-to-cycle: how far
+ * each period is from the one before it. Bucket 0 counts exact repeats and
+ * bucket k (k >= 1) counts differences in [2^(k-1), 2^k) us, with the last
+ * bucket open-ended.
+ *
+ * Everything lives in a fixed array indexed by ID, so a whole summary stays in
+ * L1 while frames stream past. Stats_ProcessCapture() splits a capture into
+ * contiguous frame ranges, one per thread, and stitches the ranges' summaries
+ * back together in order, so the result doesn't depend on the thread count.
+ *
+ * A frame with no data bytes is taken as a header nobody answered.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_STATS_H
+#define LIN_STATS_H
+
+/* File Inclusions */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "lin_pid.h"
+#include "lin_cap.h"
+
+/* Public Macro Definitions */
+#define STATS_JITTER_BUCKETS     16u
+
+/* Public Datatypes */
+
+struct Stats_ID_S
+{
+   uint64_t frames;
+   uint64_t parity_errors;          // PID didn't match the ID
+   uint64_t checksum_errors;
+   uint64_t missing_responses;
+   uint64_t out_of_order;           // Stamped before the last frame; not in any other count
+   uint64_t periods;                // Gaps between consecutive frames; frames - 1 per stream
+   uint64_t period_sum_us;
+   uint64_t period_min_us;          // UINT64_MAX until there's a period
+   uint64_t period_max_us;
+   uint64_t jitter[STATS_JITTER_BUCKETS];
+
+   // Ends of the stream so far, for stitching on the next range
+   uint64_t first_us;
+   uint64_t last_us;
+   uint64_t first_period_us;
+   uint64_t last_period_us;
+};
+
+struct Stats_Summary_S
+{
+   uint64_t frames;
+   struct Stats_ID_S per_id[CAP_NUM_OF_IDS];
+};
+
+/* Public API */
+
+void Stats_Init( struct Stats_Summary_S * summary );
+
+/**
+ * @brief Account for one frame. One stamped before the last frame with its ID
+ *        is only counted as out of order.
+ */
+void Stats_AddFrame( struct Stats_Summary_S * summary, const struct CAP_Frame_S * frame );
+
+/**
+ * @brief Fold in the summary of the frames that came right after summary's,
+ *        counting the periods across the join. An ID whose later frames start
+ *        before its earlier ones end gets no period across the join, and the
+ *        join is counted as out of order.
+ */
+void Stats_Append( struct Stats_Summary_S * summary, const struct Stats_Summary_S * next );
+
+/**
+ * @brief Fold in the summary of an unrelated stream (another capture, say).
+ *        No periods are counted between the two.
+ */
+void Stats_Combine( struct Stats_Summary_S * summary, const struct Stats_Summary_S * other );
+
+/**
+ * @brief Add every frame of a capture to summary as a stream of its own.
+ *
+ * @param[in] num_threads 0 for one per online core.
+ * @return GoodResult, CaptureFileCorrupt if the frames run out early, or
+ *         OutOfMemory.
+ */
+enum LIN_PID_Result_E Stats_ProcessCapture( const struct CAP_Reader_S * reader,
+                                            unsigned int num_threads,
+                                            struct Stats_Summary_S * summary );
+
+/**
+ * @brief Mean period in microseconds, or 0 if there was none.
+ */
+double Stats_MeanPeriodUs( const struct Stats_ID_S * stats );
+
+#endif // LIN_STATS_H
@@ -0,0 +1,374 @@
+/*!
+ * @file    lin_tp.c
+ * @brief   LIN diagnostic transport-layer reassembler: single, first, and
+ *          consecutive frames on 0x3C/0x3D into complete messages per NAD.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "lin_pid.h"
+#include "lin_cap.h"
+#include "lin_tp.h"
+
+/* Local Macro Definitions */
+#define PCI_TYPE_SHIFT           4u
+#define PCI_LOW_MASK             0x0Fu
+#define PCI_TYPE_SF              0x0u
+#define PCI_TYPE_FF              0x1u
+#define PCI_TYPE_CF              0x2u
+#define SN_MASK                  0x0Fu
+
+/* Private Function Prototypes */
+static struct TP_Session_S * FindSession( struct TP_Reassembler_S * tp, uint8_t nad, bool response );
+static struct TP_Session_S * FreeSession( struct TP_Reassembler_S * tp );
+static void EndSession( struct TP_Reassembler_S * tp, struct TP_Session_S * session );
+static void ExpireSessions( struct TP_Reassembler_S * tp, uint64_t now_us );
+static void DeliverSession( struct TP_Reassembler_S * tp, struct TP_Session_S * session );
+static void ReportError( struct TP_Reassembler_S * tp,
+                         enum TP_Error_E kind,
+                         uint64_t timestamp_us,
+                         uint8_t nad,
+                         bool response,
+                         const struct TP_Session_S * session,
+                         uint8_t sn );
+
+/* Public Function Implementations */
+
+void TP_Init( struct TP_Reassembler_S * tp, const struct TP_Options_S * options )
+{
+   assert( (tp != NULL) && (options != NULL) );
+
+   memset( tp, 0, sizeof(*tp) );
+   tp->options = *options;
+   if ( 0 == tp->options.timeout_us )
+   {
+      tp->options.timeout_us = TP_DEFAULT_TIMEOUT_US;
+   }
+}
+
+void TP_Feed( struct TP_Reassembler_S * tp, const struct CAP_Frame_S * frame )
+{
+   assert( (tp != NULL) && (frame != NULL) );
+
+   if ( (frame->id != TP_MASTER_REQUEST_ID) && (frame->id != TP_SLAVE_RESPONSE_ID) )
+   {
+      return;
+   }
+   tp->stats.frames++;
+   bool response = ( TP_SLAVE_RESPONSE_ID == frame->id );
+   uint64_t now_us = frame->timestamp_us;
+
+   if ( tp->num_active > 0 )
+   {
+      ExpireSessions(tp, now_us);
+   }
+   if ( (frame->flags & CAP_FLAG_CHECKSUM_ERROR) != 0u )
+   {
+      tp->stats.dropped++;
+      return;
+   }
+   if ( frame->length != TP_FRAME_LEN )
+   {
+      ReportError( tp, TP_ERROR_BAD_FRAME, now_us, (frame->length > 0) ? frame->data[0] : 0u, response, NULL, 0 );
+      return;
+   }
+
+   uint8_t nad = frame->data[0];
+   uint8_t pci = frame->data[1];
+   if ( !response && (TP_NAD_SLEEP == nad) )
+   {
+      tp->stats.sleeps++;
+      return;
+   }
+
+   struct TP_Session_S * session = FindSession(tp, nad, response);
+   unsigned int type = (unsigned int)pci >> PCI_TYPE_SHIFT;
+   uint16_t length;
+   switch ( type )
+   {
+      case PCI_TYPE_SF:
+         length = pci & PCI_LOW_MASK;
+         if ( (0u == length) || (length > TP_MAX_SF_LEN) )
+         {
+            ReportError(tp, TP_ERROR_BAD_FRAME, now_us, nad, response, NULL, 0);
+            break;
+         }
+         if ( session != NULL )
+         {
+            ReportError(tp, TP_ERROR_INTERRUPTED, now_us, nad, response, session, 0);
+            EndSession(tp, session);
+         }
+         {
+            // Nothing to buffer; the message is handed out straight from the frame
+            struct TP_Message_S message;
+            message.first_us = now_us;
+            message.last_us = now_us;
+            message.data = &frame->data[2];
+            message.length = length;
+            message.frames = 1;
+            message.nad = nad;
+            message.response = response;
+            tp->stats.messages++;
+            if ( tp->options.on_message != NULL )
+            {
+               tp->options.on_message( &message, tp->options.ctx );
+            }
+         }
+         break;
+
+      case PCI_TYPE_FF:
+         length = (uint16_t)( ((unsigned int)(pci & PCI_LOW_MASK) << 8) | frame->data[2] );
+         if ( length <= TP_MAX_SF_LEN )
+         {
+            // Would have fit in a single frame
+            ReportError(tp, TP_ERROR_BAD_FRAME, now_us, nad, response, NULL, 0);
+            break;
+         }
+         if ( session != NULL )
+         {
+            ReportError(tp, TP_ERROR_INTERRUPTED, now_us, nad, response, session, 0);
+         }
+         else
+         {
+            session = FreeSession(tp);
+            if ( NULL == session )
+            {
+               ReportError(tp, TP_ERROR_NO_SESSION, now_us, nad, response, NULL, 0);
+               break;
+            }
+            tp->num_active++;
+         }
+         session->active = true;
+         session->nad = nad;
+         session->response = response;
+         session->first_us = now_us;
+         session->last_us = now_us;
+         session->length = length;
+         session->received = TP_FF_DATA_LEN;
+         session->frames = 1;
+         session->next_sn = 1;
+         memcpy( session->buf, &frame->data[3], TP_FF_DATA_LEN );
+         break;
+
+      case PCI_TYPE_CF:
+         if ( NULL == session )
+         {
+            ReportError(tp, TP_ERROR_UNEXPECTED_CF, now_us, nad, response, NULL, 0);
+            break;
+         }
+         if ( (pci & SN_MASK) != session->next_sn )
+         {
+            ReportError(tp, TP_ERROR_SEQUENCE, now_us, nad, response, session, (uint8_t)(pci & SN_MASK));
+            EndSession(tp, session);
+            break;
+         }
+         {
+            uint16_t left = (uint16_t)(session->length - session->received);
+            uint16_t n = ( left < TP_CF_DATA_LEN ) ? left : (uint16_t)TP_CF_DATA_LEN;
+            memcpy( &session->buf[session->received], &frame->data[2], n );
+            session->received = (uint16_t)(session->received + n);
+         }
+         session->frames++;
+         session->last_us = now_us;
+         session->next_sn = (uint8_t)((session->next_sn + 1u) & SN_MASK);
+         if ( session->received == session->length )
+         {
+            DeliverSession(tp, session);
+            EndSession(tp, session);
+         }
+         break;
+
+      default:
+         ReportError(tp, TP_ERROR_BAD_FRAME, now_us, nad, response, NULL, 0);
+         break;
+   }
+}
+
+void TP_Flush( struct TP_Reassembler_S * tp )
+{
+   assert( tp != NULL );
+
+   for ( size_t i = 0; (tp->num_active > 0) && (i < TP_MAX_SESSIONS); i++ )
+   {
+      struct TP_Session_S * session = &tp->sessions[i];
+      if ( session->active )
+      {
+         ReportError(tp, TP_ERROR_INCOMPLETE, session->last_us, session->nad, session->response, session, 0 );
+         EndSession(tp, session);
+      }
+   }
+}
+
+enum LIN_PID_Result_E TP_ProcessCapture( struct TP_Reassembler_S * tp, const struct CAP_Reader_S * reader )
+{
+   assert( (tp != NULL) && (reader != NULL) );
+
+   struct CAP_Postings_S requests;
+   struct CAP_Postings_S responses;
+   bool complete;
+   if ( CAP_PostingsOpen(reader, TP_MASTER_REQUEST_ID, &requests) &&
+        CAP_PostingsOpen(reader, TP_SLAVE_RESPONSE_ID, &responses) )
+   {
+      // Two-way merge of the lists. Records are in time order, so their
+      // offsets are too, and break ties between equal timestamps exactly.
+      struct CAP_Frame_S request;
+      struct CAP_Frame_S response;
+      bool have_request = CAP_NextPosting(reader, &requests, &request);
+      bool have_response = CAP_NextPosting(reader, &responses, &response);
+      while ( have_request || have_response )
+      {
+         if ( have_request && (!have_response || (requests.offset < responses.offset)) )
+         {
+            TP_Feed(tp, &request);
+            have_request = CAP_NextPosting(reader, &requests, &request);
+         }
+         else
+         {
+            TP_Feed(tp, &response);
+            have_response = CAP_NextPosting(reader, &responses, &response);
+         }
+      }
+      complete = ( 0u == requests.remaining ) && ( 0u == responses.remaining );
+   }
+   else
+   {
+      struct CAP_Cursor_S cursor = { 0 };
+      struct CAP_Frame_S frame;
+      bool more = CAP_SeekFrame(reader, 0, &cursor);
+      while ( more && CAP_Next(reader, &cursor, &frame) )
+      {
+         TP_Feed(tp, &frame);
+      }
+      complete = ( cursor.frame == reader->num_frames );
+   }
+
+   TP_Flush(tp);
+   return complete ? GoodResult : CaptureFileCorrupt;
+}
+
+const char * TP_ErrorName( enum TP_Error_E kind )
+{
+   static const char * const names[NUM_OF_TP_ERRORS] =
+   {
+      "bad frame",
+      "unexpected consecutive frame",
+      "sequence error",
+      "interrupted",
+      "timeout",
+      "no free session",
+      "incomplete"
+   };
+
+   assert( kind < NUM_OF_TP_ERRORS );
+   return names[kind];
+}
+
+/* Private Function Implementations */
+
+static struct TP_Session_S * FindSession( struct TP_Reassembler_S * tp, uint8_t nad, bool response )
+{
+   for ( size_t i = 0; (tp->num_active > 0) && (i < TP_MAX_SESSIONS); i++ )
+   {
+      struct TP_Session_S * session = &tp->sessions[i];
+      if ( session->active && (session->nad == nad) && (session->response == response) )
+      {
+         return session;
+      }
+   }
+   return NULL;
+}
+
+static struct TP_Session_S * FreeSession( struct TP_Reassembler_S * tp )
+{
+   for ( size_t i = 0; i < TP_MAX_SESSIONS; i++ )
+   {
+      if ( !tp->sessions[i].active )
+      {
+         return &tp->sessions[i];
+      }
+   }
+   return NULL;
+}
+
+static void EndSession( struct TP_Reassembler_S * tp, struct TP_Session_S * session )
+{
+   assert( session->active && (tp->num_active > 0) );
+   session->active = false;
+   tp->num_active--;
+}
+
+/**
+ * @brief Time out every message whose next consecutive frame is overdue.
+ */
+static void ExpireSessions( struct TP_Reassembler_S * tp, uint64_t now_us )
+{
+   for ( size_t i = 0; (tp->num_active > 0) && (i < TP_MAX_SESSIONS); i++ )
+   {
+      struct TP_Session_S * session = &tp->sessions[i];
+      if ( session->active && ((now_us - session->last_us) > tp->options.timeout_us) )
+      {
+         ReportError( tp, TP_ERROR_TIMEOUT, session->last_us + tp->options.timeout_us,
+                      session->nad, session->response, session, 0 );
+         EndSession(tp, session);
+      }
+   }
+}
+
+static void DeliverSession( struct TP_Reassembler_S * tp, struct TP_Session_S * session )
+{
+   struct TP_Message_S message;
+   message.first_us = session->first_us;
+   message.last_us = session->last_us;
+   message.data = session->buf;
+   message.length = session->length;
+   message.frames = session->frames;
+   message.nad = session->nad;
+   message.response = session->response;
+   tp->stats.messages++;
+   if ( tp->options.on_message != NULL )
+   {
+      tp->options.on_message( &message, tp->options.ctx );
+   }
+}
+
+/**
+ * @brief session, if given, is the message in progress that the error is
+ *        about. sn is the sequence number that arrived, for TP_ERROR_SEQUENCE.
+ */
+static void ReportError( struct TP_Reassembler_S * tp,
+                         enum TP_Error_E kind,
+                         uint64_t timestamp_us,
+                         uint8_t nad,
+                         bool response,
+                         const struct TP_Session_S * session,
+                         uint8_t sn )
+{
+   tp->stats.errors[kind]++;
+   if ( NULL == tp->options.on_error )
+   {
+      return;
+   }
+
+   struct TP_Error_S error = { 0 };
+   error.timestamp_us = timestamp_us;
+   error.kind = kind;
+   error.nad = nad;
+   error.response = response;
+   if ( session != NULL )
+   {
+      error.received = session->received;
+      error.length = session->length;
+      error.expected_sn = session->next_sn;
+   }
+   error.sn = sn;
+   tp->options.on_error( &error, tp->options.ctx );
+}
@@ -0,0 +1,158 @@
+/*!
+ * @file    lin_tp.h
+ * @brief   Streaming reassembly of LIN diagnostic transport-layer messages.
+ *
+ * Diagnostics ride on the reserved IDs 0x3C (master request frame) and 0x3D
+ * (slave response frame). Each is an 8-byte frame laid out as:
+ *
+ *    byte 0   NAD: node address (0x00 on 0x3C is the go-to-sleep command)
+ *    byte 1   PCI: type in the high nibble
+ *                0 Single frame       length (1-6) in the low nibble;
+ *                                     bytes 2-7 hold SID and data
+ *                1 First frame        length bits 11-8 in the low nibble,
+ *                                     bits 7-0 in byte 2; bytes 3-7 hold
+ *                                     SID and the first 4 data bytes
+ *                2 Consecutive frame  sequence number (1, 2, ... 15, 0, ...)
+ *                                     in the low nibble; bytes 2-7 hold data
+ *
+ * A message is the SID and its data, up to TP_MAX_MESSAGE_LEN bytes. Requests
+ * and responses are reassembled separately for each NAD, in a small fixed
+ * table of sessions. A session is only taken by a first frame, since single
+ * frames complete at once.
+ *
+ * Frames flagged with a checksum error are dropped, as a node would drop them,
+ * so whatever they belonged to usually shows up as a sequence error next.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_TP_H
+#define LIN_TP_H
+
+/* File Inclusions */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "lin_pid.h"
+#include "lin_cap.h"
+
+/* Public Macro Definitions */
+#define TP_MASTER_REQUEST_ID     0x3Cu
+#define TP_SLAVE_RESPONSE_ID     0x3Du
+#define TP_FRAME_LEN             8u
+#define TP_MAX_MESSAGE_LEN       4095u
+#define TP_MAX_SF_LEN            6u
+#define TP_FF_DATA_LEN           5u
+#define TP_CF_DATA_LEN           6u
+#define TP_MAX_SESSIONS          16u
+#define TP_DEFAULT_TIMEOUT_US    1000000u   // N_Cr: 1 s between consecutive frames
+#define TP_NAD_SLEEP             0x00u
+#define TP_SID_NEGATIVE_RESPONSE 0x7Fu
+
+/* Public Datatypes */
+
+enum TP_Error_E
+{
+   TP_ERROR_BAD_FRAME,        // Not 8 bytes, or a PCI type or length that can't be right
+   TP_ERROR_UNEXPECTED_CF,    // Consecutive frame with no message in progress
+   TP_ERROR_SEQUENCE,         // Consecutive frame out of order; the message is dropped
+   TP_ERROR_INTERRUPTED,      // New message started before the last one finished
+   TP_ERROR_TIMEOUT,          // No consecutive frame within the timeout
+   TP_ERROR_NO_SESSION,       // Every session was busy, so a first frame was dropped
+   TP_ERROR_INCOMPLETE,       // Still in progress when the stream ended (TP_Flush())
+   NUM_OF_TP_ERRORS
+};
+
+struct TP_Message_S
+{
+   uint64_t first_us;         // Timestamp of the single or first frame
+   uint64_t last_us;          // ...and of the frame that completed it
+   const uint8_t * data;      // SID, then its data; valid until the next TP_Feed()
+   uint16_t length;           // Including the SID
+   uint16_t frames;
+   uint8_t nad;
+   bool response;             // Came on TP_SLAVE_RESPONSE_ID
+};
+
+struct TP_Error_S
+{
+   uint64_t timestamp_us;     // Of the frame that gave it away; for a timeout, when it ran out
+   enum TP_Error_E kind;
+   uint8_t nad;
+   bool response;
+   uint16_t received;         // Bytes of the message so far
+   uint16_t length;           // Bytes it should have had
+   uint8_t expected_sn;       // For TP_ERROR_SEQUENCE
+   uint8_t sn;
+};
+
+struct TP_Options_S
+{
+   uint64_t timeout_us;       // 0 for TP_DEFAULT_TIMEOUT_US
+
+   // Called for every complete message and every error, in stream order. May be NULL.
+   void (*on_message)( const struct TP_Message_S * message, void * ctx );
+   void (*on_error)( const struct TP_Error_S * error, void * ctx );
+   void * ctx;
+};
+
+struct TP_Session_S
+{
+   uint64_t first_us;
+   uint64_t last_us;
+   uint16_t length;
+   uint16_t received;
+   uint16_t frames;
+   uint8_t nad;
+   uint8_t next_sn;
+   bool response;
+   bool active;
+   uint8_t buf[TP_MAX_MESSAGE_LEN];
+};
+
+struct TP_Stats_S
+{
+   uint64_t frames;           // Diagnostic frames fed in
+   uint64_t dropped;          // ...of which had a checksum error
+   uint64_t sleeps;           // Go-to-sleep commands
+   uint64_t messages;
+   uint64_t errors[NUM_OF_TP_ERRORS];
+};
+
+struct TP_Reassembler_S
+{
+   struct TP_Options_S options;
+   struct TP_Stats_S stats;
+   unsigned int num_active;
+   struct TP_Session_S sessions[TP_MAX_SESSIONS];
+};
+
+/* Public API */
+
+void TP_Init( struct TP_Reassembler_S * tp, const struct TP_Options_S * options );
+
+/**
+ * @brief Take the next frame of the stream. Anything but 0x3C/0x3D is ignored,
+ *        so a whole capture can be fed in. Frames must come in time order.
+ */
+void TP_Feed( struct TP_Reassembler_S * tp, const struct CAP_Frame_S * frame );
+
+/**
+ * @brief End of stream: report every message still in progress as
+ *        TP_ERROR_INCOMPLETE and free its session.
+ */
+void TP_Flush( struct TP_Reassembler_S * tp );
+
+/**
+ * @brief Feed every diagnostic frame of a capture through, then flush. With
+ *        posting lists, only the 0x3C/0x3D records are read.
+ *
+ * @return GoodResult, or CaptureFileCorrupt if the frames run out early.
+ */
+enum LIN_PID_Result_E TP_ProcessCapture( struct TP_Reassembler_S * tp, const struct CAP_Reader_S * reader );
+
+const char * TP_ErrorName( enum TP_Error_E kind );
+
+#endif // LIN_TP_H
@@ -0,0 +1,721 @@
+/*!
+ * @file    lin_tty.c
+ * @brief   Multi-channel capture from serial LIN interfaces or ptys.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <termios.h>
+#include <time.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+
+#include "lin_pid.h"
+#include "lin_log.h"
+#include "lin_cap.h"
+#include "lin_tty.h"
+
+/* Local Macro Definitions */
+#define ID_MASK                  0x3Fu
+#define FIRST_CLASSIC_ONLY_ID    0x3Cu
+#define SYNC_BYTE                0x55u
+#define MARK_BYTE                0xFFu    // Starts a PARMRK mark, or is doubled
+#define BITS_PER_BYTE            10u      // Start bit, 8 data bits, stop bit
+#define NS_PER_US                1000u
+#define NS_PER_SEC               1000000000u
+#define RING_MASK                ( TTY_RING_CHUNKS - 1u )
+
+#if ( TTY_RING_CHUNKS & (TTY_RING_CHUNKS - 1u) ) != 0
+#error "TTY_RING_CHUNKS must be a power of 2"
+#endif
+
+// The rings' indices are handed between the two threads with acquire/release
+// ordering; C99 has no atomics of its own.
+#ifdef __GNUC__
+#define LOAD_ACQUIRE(ptr)        __atomic_load_n( (ptr), __ATOMIC_ACQUIRE )
+#define STORE_RELEASE(ptr, val)  __atomic_store_n( (ptr), (val), __ATOMIC_RELEASE )
+#else
+#error "The capture rings need GCC or Clang __atomic builtins"
+#endif
+
+/* Datatypes */
+
+#ifdef __linux__
+struct Channel_S
+{
+   int fd;
+   uint64_t dropped_bytes;          // Producer's count
+   uint32_t dropped_pending;        // Not yet passed on in a chunk
+   struct TTY_Ring_S ring;
+   struct TTY_Decoder_S decoder;    // Consumer's
+};
+
+struct Capture_S
+{
+   struct Channel_S * channels;
+   size_t num_channels;
+   int event_fd;                    // Producer to consumer: there are new chunks
+   int done;                        // No more chunks are coming
+};
+#endif
+
+/* Private Function Prototypes */
+static void TakeByte( struct TTY_Decoder_S * decoder, uint8_t value, bool framing_ok, uint64_t at_ns );
+static void AppendResponse( struct TTY_Decoder_S * decoder, uint8_t value, bool framing_ok );
+static void ReleaseHeld( struct TTY_Decoder_S * decoder );
+static void StartFrame( struct TTY_Decoder_S * decoder, uint64_t at_ns );
+static void EndFrame( struct TTY_Decoder_S * decoder );
+#ifdef __linux__
+static bool BaudToSpeed( uint32_t baud, speed_t * speed );
+static uint64_t NowNs( void );
+static void * ConsumerThread( void * arg );
+static void ReadPort( struct Channel_S * channel, ssize_t * last_read );
+static void StopCapturing( int sig );
+#endif
+
+/* Local Variables */
+#ifdef __linux__
+static volatile sig_atomic_t CaptureStop = 0;   // Set by SIGINT/SIGTERM while TTY_Capture() runs
+
+static const struct
+{
+   uint32_t baud;
+   speed_t speed;
+} Speeds[] =
+{
+   { 1200u, B1200 },
+   { 2400u, B2400 },
+   { 4800u, B4800 },
+   { 9600u, B9600 },
+   { 19200u, B19200 },
+   { 38400u, B38400 },
+   { 57600u, B57600 },
+   { 115200u, B115200 },
+};
+#endif
+
+/* Public Function Implementations */
+
+enum LIN_PID_Result_E TTY_Open( const char * path, uint32_t baud, int * fd )
+{
+   assert( (path != NULL) && (fd != NULL) );
+
+#ifdef __linux__
+   speed_t speed = B0;
+   if ( (baud > 0) && !BaudToSpeed(baud, &speed) )
+   {
+      return TTYBaudUnsupported;
+   }
+
+   int port = open(path, O_RDWR | O_NOCTTY);
+   struct termios tio;
+   if ( (port < 0) || (tcgetattr(port, &tio) != 0) )
+   {
+      TTY_Close(port);
+      return TTYUnusable;
+   }
+
+   // Raw, except that the line discipline marks breaks and bad bytes
+   tio.c_iflag &= ~(tcflag_t)(IGNBRK | BRKINT | IGNPAR | ISTRIP | INLCR | IGNCR | ICRNL | IXON | IXOFF);
+   tio.c_iflag |= (tcflag_t)(PARMRK | INPCK);
+   tio.c_oflag &= ~(tcflag_t)OPOST;
+   tio.c_lflag &= ~(tcflag_t)(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+   tio.c_cflag &= ~(tcflag_t)(CSIZE | PARENB | CSTOPB);
+   tio.c_cflag |= (tcflag_t)(CS8 | CLOCAL | CREAD);
+   tio.c_cc[VMIN] = 1;
+   tio.c_cc[VTIME] = 0;
+   bool set = ( (B0 == speed) || ((cfsetispeed(&tio, speed) == 0) && (cfsetospeed(&tio, speed) == 0)) ) &&
+              ( tcsetattr(port, TCSANOW, &tio) == 0 );
+   if ( !set )
+   {
+      TTY_Close(port);
+      return TTYUnusable;
+   }
+   *fd = port;
+   return GoodResult;
+#else
+   (void)path;
+   (void)baud;
+   (void)fd;
+   return TTYUnsupported;
+#endif
+}
+
+void TTY_Close( int fd )
+{
+#ifdef __linux__
+   if ( fd >= 0 )
+   {
+      (void)close(fd);
+   }
+#else
+   (void)fd;
+#endif
+}
+
+enum LIN_PID_Result_E TTY_Capture( const struct TTY_Options_S * options, struct TTY_Stats_S * stats )
+{
+   assert( (options != NULL) && (stats != NULL) && (options->fds != NULL) );
+   assert( (options->num_channels > 0) && (options->num_channels <= TTY_MAX_CHANNELS) );
+
+#ifdef __linux__
+   struct Capture_S capture;
+   memset( &capture, 0, sizeof(capture) );
+   capture.num_channels = options->num_channels;
+   capture.channels = calloc( options->num_channels, sizeof(capture.channels[0]) );
+   if ( NULL == capture.channels )
+   {
+      return OutOfMemory;
+   }
+
+   uint64_t start_ns = NowNs();
+   int saved_flags[TTY_MAX_CHANNELS];
+   capture.event_fd = eventfd(0, EFD_CLOEXEC);
+   int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+   bool set_up = ( capture.event_fd >= 0 ) && ( epoll_fd >= 0 );
+   size_t num_set_up = 0;
+   for ( ; set_up && (num_set_up < options->num_channels); num_set_up++ )
+   {
+      struct Channel_S * channel = &capture.channels[num_set_up];
+      channel->fd = options->fds[num_set_up];
+      TTY_RingInit(&channel->ring);
+      TTY_DecoderInit(&channel->decoder, (uint8_t)(num_set_up + 1u), options->checksum, start_ns);
+      channel->decoder.byte_ns = ( options->baud > 0 ) ? ((uint64_t)BITS_PER_BYTE * NS_PER_SEC / options->baud) : 0u;
+      channel->decoder.on_frame = options->on_frame;
+      channel->decoder.ctx = options->ctx;
+
+      struct epoll_event event = { .events = EPOLLIN, .data = { .u32 = (uint32_t)num_set_up } };
+      saved_flags[num_set_up] = fcntl(channel->fd, F_GETFL);
+      set_up = ( saved_flags[num_set_up] >= 0 ) &&
+               ( fcntl(channel->fd, F_SETFL, saved_flags[num_set_up] | O_NONBLOCK) == 0 ) &&
+               ( epoll_ctl(epoll_fd, EPOLL_CTL_ADD, channel->fd, &event) == 0 );
+   }
+
+   // SIGINT and SIGTERM stay blocked except while waiting, as in LOG_Follow().
+   // The consumer thread inherits the blocked mask, so it never takes them.
+   sigset_t stop_set;
+   sigset_t saved_mask;
+   sigset_t wait_mask;
+   (void)sigemptyset(&stop_set);
+   (void)sigaddset(&stop_set, SIGINT);
+   (void)sigaddset(&stop_set, SIGTERM);
+   (void)pthread_sigmask(SIG_BLOCK, &stop_set, &saved_mask);
+   wait_mask = saved_mask;
+   (void)sigdelset(&wait_mask, SIGINT);
+   (void)sigdelset(&wait_mask, SIGTERM);
+
+   struct sigaction action;
+   struct sigaction saved_int;
+   struct sigaction saved_term;
+   memset( &action, 0, sizeof(action) );
+   action.sa_handler = StopCapturing;
+   (void)sigemptyset(&action.sa_mask);
+   (void)sigaction(SIGINT, &action, &saved_int);
+   (void)sigaction(SIGTERM, &action, &saved_term);
+   CaptureStop = 0;
+
+   enum LIN_PID_Result_E result = set_up ? GoodResult : TTYUnusable;
+   pthread_t consumer;
+   bool started = set_up && ( pthread_create(&consumer, NULL, ConsumerThread, &capture) == 0 );
+   result = ( set_up && !started ) ? OutOfMemory : result;
+
+   size_t num_open = options->num_channels;
+   while ( started && (GoodResult == result) && (num_open > 0) && !CaptureStop )
+   {
+      struct epoll_event events[TTY_MAX_CHANNELS];
+      int num_events = epoll_pwait(epoll_fd, events, (int)TTY_MAX_CHANNELS, -1, &wait_mask);
+      if ( num_events < 0 )
+      {
+         result = ( EINTR == errno ) ? GoodResult : TTYUnusable;
+         continue;
+      }
+
+      for ( int e = 0; (GoodResult == result) && (e < num_events); e++ )
+      {
+         struct Channel_S * channel = &capture.channels[events[e].data.u32];
+         ssize_t n;
+         ReadPort(channel, &n);
+         bool hung_up = ( 0 == n ) || ( (events[e].events & EPOLLHUP) != 0u );
+         if ( (n < 0) && (errno != EAGAIN) && (errno != EINTR) )
+         {
+            // A pty's slave end reads EIO once the master end has closed
+            hung_up = ( EIO == errno );
+            result = hung_up ? GoodResult : TTYUnusable;
+         }
+         if ( hung_up )
+         {
+            (void)epoll_ctl(epoll_fd, EPOLL_CTL_DEL, channel->fd, NULL);
+            num_open--;
+         }
+      }
+
+      // One wake-up for the whole round
+      uint64_t one = 1;
+      (void)write(capture.event_fd, &one, sizeof(one));
+   }
+
+   if ( started )
+   {
+      uint64_t one = 1;
+      STORE_RELEASE(&capture.done, 1);
+      (void)write(capture.event_fd, &one, sizeof(one));
+      (void)pthread_join(consumer, NULL);
+   }
+
+   (void)sigaction(SIGINT, &saved_int, NULL);
+   (void)sigaction(SIGTERM, &saved_term, NULL);
+   (void)pthread_sigmask(SIG_SETMASK, &saved_mask, NULL);
+   for ( size_t c = 0; c < num_set_up; c++ )
+   {
+      if ( saved_flags[c] >= 0 )
+      {
+         (void)fcntl(capture.channels[c].fd, F_SETFL, saved_flags[c]);
+      }
+   }
+   if ( epoll_fd >= 0 )
+   {
+      (void)close(epoll_fd);
+   }
+   if ( capture.event_fd >= 0 )
+   {
+      (void)close(capture.event_fd);
+   }
+
+   for ( size_t c = 0; c < options->num_channels; c++ )
+   {
+      stats[c] = capture.channels[c].decoder.stats;
+      stats[c].dropped_bytes = capture.channels[c].dropped_bytes;
+   }
+   free(capture.channels);
+   return result;
+#else
+   memset( stats, 0, options->num_channels * sizeof(stats[0]) );
+   return TTYUnsupported;
+#endif
+}
+
+void TTY_RingInit( struct TTY_Ring_S * ring )
+{
+   assert( ring != NULL );
+   ring->head = 0;
+   ring->tail = 0;
+}
+
+struct TTY_Chunk_S * TTY_RingClaim( struct TTY_Ring_S * ring )
+{
+   assert( ring != NULL );
+   size_t tail = LOAD_ACQUIRE(&ring->tail);
+   return ( (ring->head - tail) < TTY_RING_CHUNKS ) ? &ring->chunks[ring->head & RING_MASK] : NULL;
+}
+
+void TTY_RingPublish( struct TTY_Ring_S * ring )
+{
+   assert( ring != NULL );
+   STORE_RELEASE(&ring->head, ring->head + 1u);
+}
+
+const struct TTY_Chunk_S * TTY_RingPeek( const struct TTY_Ring_S * ring )
+{
+   assert( ring != NULL );
+   size_t head = LOAD_ACQUIRE(&ring->head);
+   return ( head != ring->tail ) ? &ring->chunks[ring->tail & RING_MASK] : NULL;
+}
+
+void TTY_RingRelease( struct TTY_Ring_S * ring )
+{
+   assert( ring != NULL );
+   STORE_RELEASE(&ring->tail, ring->tail + 1u);
+}
+
+void TTY_DecoderInit( struct TTY_Decoder_S * decoder,
+                      uint8_t channel,
+                      enum LOG_Checksum_E checksum,
+                      uint64_t start_ns )
+{
+   assert( (decoder != NULL) && (channel <= TTY_MAX_CHANNELS) );
+
+   memset( decoder, 0, sizeof(*decoder) );
+   decoder->channel = channel;
+   decoder->checksum = checksum;
+   decoder->start_ns = start_ns;
+   decoder->prev_ns = start_ns;
+   decoder->escape = TTY_ESCAPE_NONE;
+   decoder->state = TTY_IDLE;
+}
+
+void TTY_DecoderFeed( struct TTY_Decoder_S * decoder, const uint8_t * bytes, size_t len, uint64_t timestamp_ns )
+{
+   assert( (decoder != NULL) && ((bytes != NULL) || (0 == len)) );
+
+   decoder->stats.bytes += len;
+   for ( size_t i = 0; i < len; i++ )
+   {
+      // The read returned with the last byte; the ones before it came in a
+      // byte time apart, or near enough
+      uint64_t back_ns = (uint64_t)(len - 1u - i) * decoder->byte_ns;
+      uint64_t at_ns = ( back_ns < timestamp_ns ) ? (timestamp_ns - back_ns) : 0u;
+      at_ns = ( at_ns > decoder->prev_ns ) ? at_ns : decoder->prev_ns;
+      decoder->prev_ns = at_ns;
+
+      uint8_t value = bytes[i];
+      switch ( decoder->escape )
+      {
+         case TTY_ESCAPE_FF:
+            decoder->escape = TTY_ESCAPE_NONE;
+            if ( 0x00u == value )
+            {
+               decoder->escape = TTY_ESCAPE_FF00;
+            }
+            else
+            {
+               // FF FF is a 0xFF data byte; anything else can't come from
+               // PARMRK without ISTRIP, but is taken as it stands
+               TakeByte(decoder, MARK_BYTE, true, at_ns);
+               if ( value != MARK_BYTE )
+               {
+                  TakeByte(decoder, value, true, at_ns);
+               }
+            }
+            break;
+
+         case TTY_ESCAPE_FF00:
+            decoder->escape = TTY_ESCAPE_NONE;
+            if ( 0x00u == value )
+            {
+               decoder->marked_breaks = true;
+               StartFrame(decoder, at_ns);
+            }
+            else
+            {
+               TakeByte(decoder, value, false, at_ns);
+            }
+            break;
+
+         case TTY_ESCAPE_NONE:
+         default:
+            if ( MARK_BYTE == value )
+            {
+               decoder->escape = TTY_ESCAPE_FF;
+            }
+            else
+            {
+               TakeByte(decoder, value, true, at_ns);
+            }
+            break;
+      }
+   }
+}
+
+void TTY_DecoderResync( struct TTY_Decoder_S * decoder )
+{
+   assert( decoder != NULL );
+   decoder->escape = TTY_ESCAPE_NONE;
+   decoder->state = TTY_IDLE;
+   decoder->held_len = 0;
+}
+
+void TTY_DecoderFlush( struct TTY_Decoder_S * decoder )
+{
+   assert( decoder != NULL );
+   decoder->escape = TTY_ESCAPE_NONE;
+   EndFrame(decoder);
+}
+
+/* Private Function Implementations */
+
+static void TakeByte( struct TTY_Decoder_S * decoder, uint8_t value, bool framing_ok, uint64_t at_ns )
+{
+   struct TTY_Stats_S * stats = &decoder->stats;
+   if ( !framing_ok )
+   {
+      stats->framing_errors++;
+   }
+   bool bare_zero = framing_ok && ( 0x00u == value ) && !decoder->marked_breaks;
+
+   // A bare 0x00 in a response, maybe with 0x55 after it, is a header only if
+   // a valid PID comes next
+   if ( decoder->held_len > 0 )
+   {
+      if ( framing_ok && (1u == decoder->held_len) && (SYNC_BYTE == value) )
+      {
+         decoder->held[decoder->held_len++] = value;
+         return;
+      }
+      if ( framing_ok && (2u == decoder->held_len) && (ReferencePID(value & ID_MASK) == value) )
+      {
+         decoder->held_len = 0;
+         StartFrame(decoder, decoder->held_ns);
+         decoder->state = TTY_PID;
+      }
+      else
+      {
+         ReleaseHeld(decoder);
+      }
+   }
+
+   if ( bare_zero && (decoder->state != TTY_RESPONSE) )
+   {
+      StartFrame(decoder, at_ns);
+      return;
+   }
+
+   switch ( decoder->state )
+   {
+      case TTY_SYNC:
+         if ( framing_ok && (SYNC_BYTE == value) )
+         {
+            decoder->state = TTY_PID;
+         }
+         else
+         {
+            stats->sync_errors++;
+            decoder->state = TTY_IDLE;
+         }
+         break;
+
+      case TTY_PID:
+         if ( !framing_ok )
+         {
+            decoder->state = TTY_IDLE;
+            break;
+         }
+         decoder->frame.pid = value;
+         decoder->frame.id = (uint8_t)(value & ID_MASK);
+         if ( ReferencePID(decoder->frame.id) != value )
+         {
+            decoder->frame.flags |= CAP_FLAG_PID_ERROR;
+         }
+         decoder->response_len = 0;
+         decoder->response_bad = false;
+         decoder->state = TTY_RESPONSE;
+         break;
+
+      case TTY_RESPONSE:
+         if ( bare_zero && (decoder->response_len < TTY_MAX_RESPONSE_LEN) )
+         {
+            decoder->held[0] = value;
+            decoder->held_len = 1;
+            decoder->held_ns = at_ns;
+         }
+         else if ( bare_zero )
+         {
+            // No room for it in the response, so it can only be a break
+            StartFrame(decoder, at_ns);
+         }
+         else
+         {
+            AppendResponse(decoder, value, framing_ok);
+         }
+         break;
+
+      case TTY_IDLE:
+      default:
+         stats->stray_bytes++;
+         break;
+   }
+}
+
+static void AppendResponse( struct TTY_Decoder_S * decoder, uint8_t value, bool framing_ok )
+{
+   if ( decoder->response_len < TTY_MAX_RESPONSE_LEN )
+   {
+      decoder->response[decoder->response_len++] = value;
+      decoder->response_bad = decoder->response_bad || !framing_ok;
+   }
+   else
+   {
+      decoder->stats.stray_bytes++;
+   }
+}
+
+/**
+ * @brief What was held back as a possible header is response data after all.
+ */
+static void ReleaseHeld( struct TTY_Decoder_S * decoder )
+{
+   uint8_t held_len = decoder->held_len;
+   decoder->held_len = 0;
+   for ( uint8_t i = 0; i < held_len; i++ )
+   {
+      AppendResponse(decoder, decoder->held[i], true);
+   }
+}
+
+/**
+ * @brief A break: hand out the frame before it and start the next at at_ns.
+ */
+static void StartFrame( struct TTY_Decoder_S * decoder, uint64_t at_ns )
+{
+   EndFrame(decoder);
+   decoder->stats.breaks++;
+   memset( &decoder->frame, 0, sizeof(decoder->frame) );
+   decoder->frame.channel = decoder->channel;
+   decoder->frame.timestamp_us = ( at_ns > decoder->start_ns ) ? ((at_ns - decoder->start_ns) / NS_PER_US) : 0u;
+   decoder->state = TTY_SYNC;
+}
+
+/**
+ * @brief Hand out the frame in progress, if its header got as far as a PID.
+ */
+static void EndFrame( struct TTY_Decoder_S * decoder )
+{
+   ReleaseHeld(decoder);
+   if ( decoder->state != TTY_RESPONSE )
+   {
+      decoder->state = TTY_IDLE;
+      return;
+   }
+   decoder->state = TTY_IDLE;
+
+   struct CAP_Frame_S * frame = &decoder->frame;
+   if ( decoder->response_len > 0 )
+   {
+      frame->length = (uint8_t)(decoder->response_len - 1u);
+      memcpy( frame->data, decoder->response, frame->length );
+      frame->checksum = decoder->response[frame->length];
+
+      bool enhanced = ( LOG_CHECKSUM_LIN2 == decoder->checksum ) && ( frame->id < FIRST_CLASSIC_ONLY_ID );
+      if ( decoder->response_bad ||
+           (LOG_Checksum(frame->pid, frame->data, frame->length, enhanced) != frame->checksum) )
+      {
+         frame->flags |= CAP_FLAG_CHECKSUM_ERROR;
+      }
+   }
+
+   decoder->stats.frames++;
+   decoder->stats.pid_errors += ( (frame->flags & CAP_FLAG_PID_ERROR) != 0u ) ? 1u : 0u;
+   decoder->stats.checksum_errors += ( (frame->flags & CAP_FLAG_CHECKSUM_ERROR) != 0u ) ? 1u : 0u;
+   if ( decoder->on_frame != NULL )
+   {
+      decoder->on_frame( frame, decoder->ctx );
+   }
+}
+
+#ifdef __linux__
+
+static bool BaudToSpeed( uint32_t baud, speed_t * speed )
+{
+   for ( size_t i = 0; i < (sizeof(Speeds) / sizeof(Speeds[0])); i++ )
+   {
+      if ( Speeds[i].baud == baud )
+      {
+         *speed = Speeds[i].speed;
+         return true;
+      }
+   }
+   return false;
+}
+
+static uint64_t NowNs( void )
+{
+   struct timespec now;
+   (void)clock_gettime(CLOCK_MONOTONIC, &now);
+   return ( (uint64_t)now.tv_sec * NS_PER_SEC ) + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Drain every ring whenever the producer says there's more, and once
+ *        it's done, flush every channel's last frame.
+ */
+static void * ConsumerThread( void * arg )
+{
+   struct Capture_S * capture = (struct Capture_S *)arg;
+
+   for ( ;; )
+   {
+      // Read before draining: whatever was published before done was set is
+      // then sure to be drained on this pass
+      bool done = ( LOAD_ACQUIRE(&capture->done) != 0 );
+      for ( size_t c = 0; c < capture->num_channels; c++ )
+      {
+         struct Channel_S * channel = &capture->channels[c];
+         const struct TTY_Chunk_S * chunk;
+         while ( (chunk = TTY_RingPeek(&channel->ring)) != NULL )
+         {
+            if ( chunk->dropped_before > 0 )
+            {
+               TTY_DecoderResync(&channel->decoder);
+            }
+            TTY_DecoderFeed(&channel->decoder, chunk->bytes, chunk->len, chunk->timestamp_ns);
+            TTY_RingRelease(&channel->ring);
+         }
+      }
+      if ( done )
+      {
+         break;
+      }
+
+      uint64_t wake_ups;
+      (void)read(capture->event_fd, &wake_ups, sizeof(wake_ups));
+   }
+
+   for ( size_t c = 0; c < capture->num_channels; c++ )
+   {
+      TTY_DecoderFlush(&capture->channels[c].decoder);
+   }
+   return NULL;
+}
+
+/**
+ * @brief Read the port dry, straight into its ring, or into scratch space and
+ *        counted as dropped while the ring is full.
+ *
+ * @param[out] last_read What the last read() returned, errno intact.
+ */
+static void ReadPort( struct Channel_S * channel, ssize_t * last_read )
+{
+   uint8_t scratch[TTY_CHUNK_LEN];
+   ssize_t n;
+   for ( ;; )
+   {
+      struct TTY_Chunk_S * chunk = TTY_RingClaim(&channel->ring);
+      n = read(channel->fd, (chunk != NULL) ? chunk->bytes : scratch, TTY_CHUNK_LEN);
+      if ( n <= 0 )
+      {
+         break;
+      }
+
+      if ( chunk != NULL )
+      {
+         chunk->timestamp_ns = NowNs();
+         chunk->dropped_before = channel->dropped_pending;
+         chunk->len = (uint16_t)n;
+         channel->dropped_pending = 0;
+         TTY_RingPublish(&channel->ring);
+      }
+      else
+      {
+         channel->dropped_bytes += (uint64_t)n;
+         channel->dropped_pending = ( channel->dropped_pending < (UINT32_MAX - TTY_CHUNK_LEN) ) ?
+                                    (channel->dropped_pending + (uint32_t)n) : UINT32_MAX;
+      }
+   }
+   *last_read = n;
+}
+
+static void StopCapturing( int sig )
+{
+   (void)sig;
+   CaptureStop = 1;
+}
+
+#endif // __linux__
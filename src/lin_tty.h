@@ -0,0 +1,196 @@
+/*!
+ * @file    lin_tty.h
+ * @brief   Capture from several serial LIN interfaces (or pty stand-ins) at
+ *          once.
+ *
+ * Each tty is put in raw mode with PARMRK set, so the line discipline marks
+ * what the UART flagged in-band: a break (or a 0x00 with a framing error,
+ * which is what a LIN break reads as) arrives as FF 00 00, a byte X that had
+ * a framing or parity error as FF 00 X, and a real 0xFF data byte as FF FF.
+ * VMIN is 1 and VTIME 0, so epoll reports a port as soon as one byte is in
+ * and each read gets the bytes as close to their arrival as the scheduler
+ * allows; the read then takes everything pending.
+ *
+ * A pty can't carry a break, so lin_node.h sends it as a bare 0x00. A channel
+ * that has never shown a marked break takes a bare 0x00 outside a response
+ * as a break too, and inside one only when 0x55 and a valid PID follow. The
+ * first marked break switches that off for the channel, since a real UART
+ * marks every break and a bare 0x00 is then always data.
+ *
+ * TTY_Capture() runs one epoll loop over every port, reading each straight
+ * into its channel's ring of timestamped chunks (CLOCK_MONOTONIC, taken when
+ * the read returns). A consumer thread drains the rings and decodes frames,
+ * checking PIDs and checksums. The rings are single-producer,
+ * single-consumer and lock-free; when one is full, what's read is counted as
+ * dropped and the frame in progress on that channel is abandoned. Linux only.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_TTY_H
+#define LIN_TTY_H
+
+/* File Inclusions */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "lin_pid.h"
+#include "lin_log.h"
+#include "lin_cap.h"
+
+/* Public Macro Definitions */
+#define TTY_MAX_CHANNELS         15u      // Channels are numbered from 1, and a capture has 4 bits for them
+#define TTY_RING_CHUNKS          1024u    // Per channel; a power of 2
+#define TTY_CHUNK_LEN            64u
+#define TTY_MAX_RESPONSE_LEN     ( CAP_MAX_FRAME_LEN + 1u )   // Data and checksum
+
+/* Public Datatypes */
+
+enum TTY_Escape_E
+{
+   TTY_ESCAPE_NONE,
+   TTY_ESCAPE_FF,                   // 0xFF read: a mark, or the first of a doubled 0xFF
+   TTY_ESCAPE_FF00                  // FF 00 read: the next byte is the one marked
+};
+
+enum TTY_State_E
+{
+   TTY_IDLE,                        // Waiting for a break
+   TTY_SYNC,
+   TTY_PID,
+   TTY_RESPONSE
+};
+
+struct TTY_Chunk_S
+{
+   uint64_t timestamp_ns;           // CLOCK_MONOTONIC when the read returned
+   uint32_t dropped_before;         // Bytes lost to a full ring just before this chunk
+   uint16_t len;
+   uint8_t bytes[TTY_CHUNK_LEN];
+};
+
+struct TTY_Ring_S
+{
+   size_t head;                     // Written by the producer only
+   size_t tail;                     // Written by the consumer only
+   struct TTY_Chunk_S chunks[TTY_RING_CHUNKS];
+};
+
+struct TTY_Stats_S
+{
+   uint64_t bytes;                  // As read, PARMRK marks included
+   uint64_t dropped_bytes;          // Read while the channel's ring was full
+   uint64_t breaks;
+   uint64_t frames;
+   uint64_t sync_errors;            // A break not followed by 0x55
+   uint64_t framing_errors;         // Bytes the UART marked bad
+   uint64_t pid_errors;
+   uint64_t checksum_errors;
+   uint64_t stray_bytes;            // Outside any frame, or past the longest response
+};
+
+/**
+ * @brief One channel's frame decoder. Public so tests can feed it directly.
+ */
+struct TTY_Decoder_S
+{
+   uint8_t channel;
+   enum LOG_Checksum_E checksum;
+   uint64_t start_ns;               // Frame timestamps are from here
+   uint64_t byte_ns;                // Time per byte on the wire, to date each byte in a chunk; 0 to not
+   void (*on_frame)( const struct CAP_Frame_S * frame, void * ctx );
+   void * ctx;
+   struct TTY_Stats_S stats;
+
+   // Decoding state
+   enum TTY_Escape_E escape;
+   enum TTY_State_E state;
+   bool marked_breaks;              // The port marks breaks, so a bare 0x00 is data
+   uint64_t prev_ns;                // Keeps the byte times from going backwards
+   struct CAP_Frame_S frame;
+   uint8_t response[TTY_MAX_RESPONSE_LEN];
+   uint8_t response_len;
+   bool response_bad;
+   uint8_t held[2];                 // A bare 0x00 (and 0x55) in a response that may be a header
+   uint8_t held_len;
+   uint64_t held_ns;
+};
+
+struct TTY_Options_S
+{
+   const int * fds;                 // From TTY_Open(); fds[i] is channel i + 1
+   size_t num_channels;             // 1 to TTY_MAX_CHANNELS
+   uint32_t baud;                   // The ports' baud rate, to date bytes within a read; 0 if unknown
+   enum LOG_Checksum_E checksum;
+
+   // Called from the consumer thread for every frame, in order within a
+   // channel. Timestamps are from the start of the capture. May be NULL.
+   void (*on_frame)( const struct CAP_Frame_S * frame, void * ctx );
+   void * ctx;
+};
+
+/* Public API */
+
+/**
+ * @brief Open a tty (or pty slave) raw, with PARMRK, VMIN 1 and VTIME 0.
+ *
+ * @param[in] baud Set the port to this standard termios rate; 0 to leave the
+ *                 port's rate as it is.
+ * @return GoodResult, TTYUnusable, TTYBaudUnsupported, or TTYUnsupported.
+ */
+enum LIN_PID_Result_E TTY_Open( const char * path, uint32_t baud, int * fd );
+
+/**
+ * @brief Close a port from TTY_Open(). Does nothing for a negative fd.
+ */
+void TTY_Close( int fd );
+
+/**
+ * @brief Capture until every port hangs up or SIGINT/SIGTERM comes in.
+ *
+ * @param[out] stats One per channel.
+ * @return GoodResult, TTYUnusable if a port can't be read, OutOfMemory, or
+ *         TTYUnsupported.
+ */
+enum LIN_PID_Result_E TTY_Capture( const struct TTY_Options_S * options, struct TTY_Stats_S * stats );
+
+void TTY_RingInit( struct TTY_Ring_S * ring );
+
+/**
+ * @brief Producer side: the next free chunk, or NULL if the ring is full.
+ *        Fill it in, then TTY_RingPublish().
+ */
+struct TTY_Chunk_S * TTY_RingClaim( struct TTY_Ring_S * ring );
+void TTY_RingPublish( struct TTY_Ring_S * ring );
+
+/**
+ * @brief Consumer side: the oldest published chunk, or NULL if there's none.
+ *        Done with it once TTY_RingRelease() is called.
+ */
+const struct TTY_Chunk_S * TTY_RingPeek( const struct TTY_Ring_S * ring );
+void TTY_RingRelease( struct TTY_Ring_S * ring );
+
+void TTY_DecoderInit( struct TTY_Decoder_S * decoder,
+                      uint8_t channel,
+                      enum LOG_Checksum_E checksum,
+                      uint64_t start_ns );
+
+/**
+ * @brief Decode bytes as read from a PARMRK port, timestamp_ns being when the
+ *        last of them came in.
+ */
+void TTY_DecoderFeed( struct TTY_Decoder_S * decoder, const uint8_t * bytes, size_t len, uint64_t timestamp_ns );
+
+/**
+ * @brief Bytes went missing: drop the frame in progress without handing it out.
+ */
+void TTY_DecoderResync( struct TTY_Decoder_S * decoder );
+
+/**
+ * @brief Hand out the frame in progress, if any. Call once the input ends.
+ */
+void TTY_DecoderFlush( struct TTY_Decoder_S * decoder );
+
+#endif // LIN_TTY_H
@@ -0,0 +1,301 @@
+/*!
+ * @file    test_lin_async.cpp
+ * @brief   Test file for the coroutine decoding pipeline
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_async.hpp"
+
+// See lin_async.hpp: GCC before 14 warns about each coroutine's own switch
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 14)
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#endif
+
+/* Local Macro Definitions */
+#define NUM_OF_STREAMS     200u
+#define FRAMES_PER_STREAM  50u
+
+/* Datatypes */
+
+struct Stream_S
+{
+   int fds[2];                         // Read end, write end
+   std::vector<uint8_t> bytes;
+   std::vector<CAP_Frame_S> frames;
+   lin_pid::DecoderStats stats;
+};
+
+/* Local Variables */
+static std::vector<Stream_S> Streams;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static void BuildStream( Stream_S & stream, uint32_t seed );
+static bool OpenStream( Stream_S & stream );
+static void WriteAll( int fd, const uint8_t * bytes, size_t len );
+static lin_pid::Task Collect( lin_pid::IoExecutor & executor, Stream_S & stream );
+static std::vector<CAP_Frame_S> DecodeAtOnce( const std::vector<uint8_t> & bytes );
+static bool SameFrames( const std::vector<CAP_Frame_S> & x, const std::vector<CAP_Frame_S> & y );
+
+/* IoExecutor / decode_frames */
+void test_decode_frames_ManyStreamsAtOnce(void);
+void test_decode_frames_ResumesAsBytesArrive(void);
+void test_decode_frames_EmptyStream(void);
+void test_CoroutineFramePool_ReusesFrames(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* IoExecutor / decode_frames */
+
+   RUN_TEST(test_decode_frames_ManyStreamsAtOnce);
+   RUN_TEST(test_decode_frames_ResumesAsBytesArrive);
+   RUN_TEST(test_decode_frames_EmptyStream);
+   RUN_TEST(test_CoroutineFramePool_ReusesFrames);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   Streams.clear();
+}
+
+void tearDown(void)
+{
+   for ( Stream_S & stream : Streams )
+   {
+      for ( int fd : stream.fds )
+      {
+         if ( fd >= 0 )
+         {
+            (void)close(fd);
+         }
+      }
+   }
+   Streams.clear();
+}
+
+/* Helpers */
+
+/**
+ * @brief FRAMES_PER_STREAM frames, some with a bad PID or checksum.
+ */
+static void BuildStream( Stream_S & stream, uint32_t seed )
+{
+   uint32_t x = seed | 1u;
+   for ( size_t f = 0; f < FRAMES_PER_STREAM; f++ )
+   {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      uint8_t id = static_cast<uint8_t>( x & MAX_ID_ALLOWED );
+      uint8_t pid = lin_pid::compute_pid(id);
+      uint8_t data[CAP_MAX_FRAME_LEN];
+      size_t len = 1u + ( (x >> 6) % CAP_MAX_FRAME_LEN );
+      for ( size_t i = 0; i < len; i++ )
+      {
+         data[i] = static_cast<uint8_t>( (x >> i) | 1u );
+      }
+      uint8_t checksum = lin_pid::checksum( pid, data, len, lin_pid::Lin2Checksum::enhanced(id) );
+      if ( 0u == ((x >> 24) & 7u) )
+      {
+         pid ^= 0x40;
+      }
+      else if ( 1u == ((x >> 24) & 7u) )
+      {
+         checksum ^= 0x01;
+      }
+
+      stream.bytes.push_back(0x00);
+      stream.bytes.push_back(lin_pid::frame_sync_byte);
+      stream.bytes.push_back(pid);
+      stream.bytes.insert(stream.bytes.end(), data, data + len);
+      stream.bytes.push_back(checksum);
+   }
+}
+
+static bool OpenStream( Stream_S & stream )
+{
+   stream.fds[0] = -1;
+   stream.fds[1] = -1;
+   return ( pipe2(stream.fds, O_NONBLOCK | O_CLOEXEC) == 0 );
+}
+
+static void WriteAll( int fd, const uint8_t * bytes, size_t len )
+{
+   while ( len > 0u )
+   {
+      ssize_t num_written = write( fd, bytes, len );
+      TEST_ASSERT_TRUE( num_written > 0 );
+      bytes += num_written;
+      len -= static_cast<size_t>(num_written);
+   }
+}
+
+static lin_pid::Task Collect( lin_pid::IoExecutor & executor, Stream_S & stream )
+{
+   lin_pid::AsyncGenerator<CAP_Frame_S> frames = lin_pid::decode_frames( executor, stream.fds[0], &stream.stats );
+   while ( const CAP_Frame_S * frame = co_await frames.next() )
+   {
+      stream.frames.push_back(*frame);
+   }
+}
+
+static std::vector<CAP_Frame_S> DecodeAtOnce( const std::vector<uint8_t> & bytes )
+{
+   std::vector<CAP_Frame_S> frames;
+   auto sink = [&frames]( const CAP_Frame_S & frame ) { frames.push_back(frame); };
+   lin_pid::FrameDecoder<lin_pid::Lin2Checksum, lin_pid::StrictResync, decltype(sink)> decoder( sink );
+   decoder.feed( bytes.data(), bytes.size() );
+   decoder.flush();
+   return frames;
+}
+
+static bool SameFrames( const std::vector<CAP_Frame_S> & x, const std::vector<CAP_Frame_S> & y )
+{
+   return ( x.size() == y.size() ) &&
+          ( memcmp(x.data(), y.data(), x.size() * sizeof(CAP_Frame_S)) == 0 );
+}
+
+/* IoExecutor / decode_frames */
+/******************************************************************************/
+
+void test_decode_frames_ManyStreamsAtOnce(void)
+{
+   lin_pid::IoExecutor executor;
+   TEST_ASSERT_TRUE( executor.ok() );
+
+   Streams.resize(NUM_OF_STREAMS);
+   for ( size_t s = 0; s < NUM_OF_STREAMS; s++ )
+   {
+      TEST_ASSERT_TRUE( OpenStream(Streams[s]) );
+      BuildStream( Streams[s], static_cast<uint32_t>(s * 2654435761u) );
+      executor.spawn( Collect(executor, Streams[s]) );
+   }
+   TEST_ASSERT_EQUAL_size_t( NUM_OF_STREAMS, executor.live_tasks() );
+
+   // Every stream arrives in two halves, all of them waiting in between
+   for ( Stream_S & stream : Streams )
+   {
+      WriteAll( stream.fds[1], stream.bytes.data(), stream.bytes.size() / 2u );
+   }
+   TEST_ASSERT_TRUE( executor.run_once(0) );
+   for ( Stream_S & stream : Streams )
+   {
+      WriteAll( stream.fds[1], stream.bytes.data() + (stream.bytes.size() / 2u),
+                stream.bytes.size() - (stream.bytes.size() / 2u) );
+      (void)close( stream.fds[1] );
+      stream.fds[1] = -1;
+   }
+   TEST_ASSERT_TRUE( executor.run() );
+   TEST_ASSERT_EQUAL_size_t( 0, executor.live_tasks() );
+
+   for ( const Stream_S & stream : Streams )
+   {
+      TEST_ASSERT_TRUE( SameFrames(DecodeAtOnce(stream.bytes), stream.frames) );
+      TEST_ASSERT_EQUAL_UINT64( stream.bytes.size(), stream.stats.bytes );
+      TEST_ASSERT_EQUAL_UINT64( stream.frames.size(), stream.stats.frames );
+   }
+}
+
+void test_decode_frames_ResumesAsBytesArrive(void)
+{
+   lin_pid::IoExecutor executor;
+   Streams.resize(1);
+   Stream_S & stream = Streams[0];
+   TEST_ASSERT_TRUE( OpenStream(stream) );
+   BuildStream( stream, 0xC0FFEEu );
+   executor.spawn( Collect(executor, stream) );
+
+   // A byte at a time: a frame comes out once the break after it shows up
+   size_t frames_seen = 0;
+   for ( size_t i = 0; i < stream.bytes.size(); i++ )
+   {
+      WriteAll( stream.fds[1], &stream.bytes[i], 1 );
+      TEST_ASSERT_TRUE( executor.run_once(-1) );
+      TEST_ASSERT_TRUE( stream.frames.size() >= frames_seen );
+      frames_seen = stream.frames.size();
+   }
+   TEST_ASSERT_EQUAL_size_t( 1, executor.live_tasks() );
+   TEST_ASSERT_EQUAL_size_t( DecodeAtOnce(stream.bytes).size() - 1u, stream.frames.size() );
+
+   (void)close( stream.fds[1] );
+   stream.fds[1] = -1;
+   TEST_ASSERT_TRUE( executor.run() );
+   TEST_ASSERT_TRUE( SameFrames(DecodeAtOnce(stream.bytes), stream.frames) );
+}
+
+void test_decode_frames_EmptyStream(void)
+{
+   lin_pid::IoExecutor executor;
+   Streams.resize(1);
+   TEST_ASSERT_TRUE( OpenStream(Streams[0]) );
+   (void)close( Streams[0].fds[1] );
+   Streams[0].fds[1] = -1;
+
+   executor.spawn( Collect(executor, Streams[0]) );
+   TEST_ASSERT_EQUAL_size_t( 0, executor.live_tasks() );    // Done before it ever waited
+   TEST_ASSERT_EQUAL_size_t( 0, Streams[0].frames.size() );
+   TEST_ASSERT_TRUE( executor.run() );
+}
+
+void test_CoroutineFramePool_ReusesFrames(void)
+{
+   lin_pid::IoExecutor executor;
+   Streams.resize(NUM_OF_STREAMS);
+
+   size_t blocks = 0;
+   for ( int pass = 0; pass < 3; pass++ )
+   {
+      for ( Stream_S & stream : Streams )
+      {
+         if ( 0 == pass )
+         {
+            BuildStream( stream, 0x1234u );
+         }
+         stream.frames.clear();
+         TEST_ASSERT_TRUE( OpenStream(stream) );
+         WriteAll( stream.fds[1], stream.bytes.data(), stream.bytes.size() );
+         (void)close( stream.fds[1] );
+         stream.fds[1] = -1;
+         executor.spawn( Collect(executor, stream) );
+      }
+      TEST_ASSERT_TRUE( executor.run() );
+      for ( Stream_S & stream : Streams )
+      {
+         TEST_ASSERT_TRUE( SameFrames(DecodeAtOnce(stream.bytes), stream.frames) );
+         (void)close( stream.fds[0] );
+         stream.fds[0] = -1;
+      }
+
+      // Later passes run entirely on the frames the first one left behind
+      if ( 0 == pass )
+      {
+         blocks = lin_pid::detail::frame_pool().blocks();
+      }
+      TEST_ASSERT_EQUAL_size_t( blocks, lin_pid::detail::frame_pool().blocks() );
+   }
+}
@@ -0,0 +1,153 @@
+/*!
+ * @file    test_lin_baud.c
+ * @brief   Test file for the baud-rate estimator
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "lin_baud.h"
+
+/* Local Macro Definitions */
+#define BIT_TIME                 52.08    // 19200 baud in 1 MHz samples
+
+/* Local Variables */
+static struct Baud_Estimator_S Estimator;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static void Seed( double bit_time );
+
+/* Baud_Add */
+void test_Baud_Add_SeedIgnoresOutliers(void);
+void test_Baud_Add_TracksDrift(void);
+void test_Baud_Add_RejectsOutliers(void);
+void test_Baud_Add_ReseedsAfterSpeedChange(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* Baud_Add */
+
+   RUN_TEST(test_Baud_Add_SeedIgnoresOutliers);
+   RUN_TEST(test_Baud_Add_TracksDrift);
+   RUN_TEST(test_Baud_Add_RejectsOutliers);
+   RUN_TEST(test_Baud_Add_ReseedsAfterSpeedChange);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   Baud_Init(&Estimator);
+}
+
+void tearDown(void)
+{
+}
+
+/* Helpers */
+
+static void Seed( double bit_time )
+{
+   for ( unsigned int i = 0; i < BAUD_WINDOW; i++ )
+   {
+      TEST_ASSERT_TRUE( Baud_Add(&Estimator, bit_time) );
+   }
+   TEST_ASSERT_TRUE( Estimator.seeded );
+}
+
+/* Baud_Add */
+/******************************************************************************/
+
+void test_Baud_Add_SeedIgnoresOutliers(void)
+{
+   TEST_ASSERT_DOUBLE_WITHIN( 0.5, 0.0, Baud_Rate(&Estimator, 1e6) );
+
+   // Three wild measurements out of eight can't move the median
+   const double seed[BAUD_WINDOW] = { BIT_TIME, 3.0 * BIT_TIME, BIT_TIME - 0.1, BIT_TIME + 0.1,
+                                      0.2 * BIT_TIME, BIT_TIME, 9.0 * BIT_TIME, BIT_TIME };
+   for ( unsigned int i = 0; i < BAUD_WINDOW; i++ )
+   {
+      TEST_ASSERT_TRUE( Baud_Add(&Estimator, seed[i]) );
+   }
+   TEST_ASSERT_DOUBLE_WITHIN( 0.01, BIT_TIME, Estimator.bit_time );
+   TEST_ASSERT_DOUBLE_WITHIN( 1.0, 1e6 / BIT_TIME, Baud_Rate(&Estimator, 1e6) );
+   TEST_ASSERT_EQUAL_UINT64( BAUD_WINDOW, Estimator.accepted );
+}
+
+void test_Baud_Add_TracksDrift(void)
+{
+   Seed(BIT_TIME);
+
+   // 1% slower over 100 headers
+   double bit_time = BIT_TIME;
+   for ( unsigned int i = 0; i < 100u; i++ )
+   {
+      bit_time += 0.01 * BIT_TIME / 100.0;
+      TEST_ASSERT_TRUE( Baud_Add(&Estimator, bit_time) );
+   }
+   TEST_ASSERT_DOUBLE_WITHIN( 0.002 * BIT_TIME, bit_time, Estimator.bit_time );
+   TEST_ASSERT_EQUAL_UINT64( 0, Estimator.rejected );
+}
+
+void test_Baud_Add_RejectsOutliers(void)
+{
+   Seed(BIT_TIME);
+
+   TEST_ASSERT_FALSE( Baud_Add(&Estimator, 1.2 * BIT_TIME) );
+   TEST_ASSERT_FALSE( Baud_Add(&Estimator, 0.5 * BIT_TIME) );
+   TEST_ASSERT_TRUE( Baud_Add(&Estimator, 1.04 * BIT_TIME) );
+   TEST_ASSERT_DOUBLE_WITHIN( 0.01 * BIT_TIME, BIT_TIME, Estimator.bit_time );
+   TEST_ASSERT_EQUAL_UINT64( 2, Estimator.rejected );
+
+   // Rejects that disagree with each other never take over
+   for ( unsigned int i = 0; i < 4u * BAUD_WINDOW; i++ )
+   {
+      TEST_ASSERT_FALSE( Baud_Add(&Estimator, ((i % 2u) ? 1.5 : 2.0) * BIT_TIME) );
+   }
+   TEST_ASSERT_DOUBLE_WITHIN( 0.01 * BIT_TIME, BIT_TIME, Estimator.bit_time );
+}
+
+void test_Baud_Add_ReseedsAfterSpeedChange(void)
+{
+   Seed(BIT_TIME);
+
+   // The bus drops to 9600: a window's worth of rejects that agree
+   for ( unsigned int i = 0; i < BAUD_WINDOW; i++ )
+   {
+      TEST_ASSERT_FALSE( Baud_Add(&Estimator, 2.0 * BIT_TIME + ((i % 3u) * 0.1)) );
+   }
+   TEST_ASSERT_DOUBLE_WITHIN( 0.2, 2.0 * BIT_TIME, Estimator.bit_time );
+   TEST_ASSERT_TRUE( Baud_Add(&Estimator, 2.0 * BIT_TIME) );
+
+   // An accepted measurement in between starts the run of rejects over
+   Baud_Init(&Estimator);
+   Seed(BIT_TIME);
+   for ( unsigned int i = 0; i < (BAUD_WINDOW - 1u); i++ )
+   {
+      TEST_ASSERT_FALSE( Baud_Add(&Estimator, 2.0 * BIT_TIME) );
+   }
+   TEST_ASSERT_TRUE( Baud_Add(&Estimator, BIT_TIME) );
+   TEST_ASSERT_FALSE( Baud_Add(&Estimator, 2.0 * BIT_TIME) );
+   TEST_ASSERT_DOUBLE_WITHIN( 0.01 * BIT_TIME, BIT_TIME, Estimator.bit_time );
+}
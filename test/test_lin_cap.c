@@ -0,0 +1,811 @@
+/*!
+ * @file    test_lin_cap.c
+ * @brief   Test file for the binary capture writer, converter, and reader
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_log.h"
+#include "lin_cap.h"
+
+/* Local Macro Definitions */
+#define SAMPLE_CSV_PATH          "test/sample.csv"
+#define CAPTURE_PATH             "test_lin_cap.lincap"
+#define MAX_CAPTURE_LEN          (256u * 1024u)
+#define NUM_OF_GENERATED_FRAMES  1000u
+#define SMALL_BLOCK_FRAMES       7u
+#define FRAME_PERIOD_US          1250u
+#define NUM_OF_MERGE_INPUTS      3u
+
+/* Local Variables */
+static uint8_t Capture[MAX_CAPTURE_LEN];
+static size_t CaptureLen;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static struct CAP_Frame_S GeneratedFrame( uint32_t n );
+static void WriteGeneratedCapture( uint32_t num_frames, uint32_t block_frames );
+static void SlurpCapture( FILE * fp );
+static size_t WriteCaptureOf( const struct CAP_Frame_S * frames, size_t num_frames, uint8_t * buf, size_t buf_len );
+static void AssertFramesEqual( const struct CAP_Frame_S * expected, const struct CAP_Frame_S * actual );
+
+/* Writer/Reader */
+void test_CAP_RoundTripsEveryFrame(void);
+void test_CAP_EmptyCapture(void);
+void test_CAP_LargeGapStartsNewBlock(void);
+void test_CAP_WriteFrame_RejectsBackwardsTimestamps(void);
+void test_CAP_WriteFrame_RejectsChannelOOR(void);
+void test_CAP_OpenMemory_RejectsCorruptHeader(void);
+void test_CAP_OpenMemory_RejectsCorruptIndex(void);
+void test_CAP_Next_StopsAtTruncatedRecord(void);
+void test_CAP_Next_StopsAtBlockStartingBeforeLastOneEnds(void);
+void test_CAP_Open_MapsFile(void);
+
+/* Seeking */
+void test_CAP_SeekFrame_AcrossBlocks(void);
+void test_CAP_SeekTime_AcrossBlocks(void);
+
+/* Postings */
+void test_CAP_Postings_ListEveryFrameWithID(void);
+void test_CAP_NextPosting_RejectsCorruptList(void);
+void test_CAP_AddPostings_RebuildsStrippedPostings(void);
+
+/* Merging */
+void test_CAP_Merge_InterleavesInTimestampOrder(void);
+void test_CAP_Merge_RetagsAndRechecksPIDs(void);
+void test_CAP_MergeOpen_RetagNeedsAChannelPerInput(void);
+
+/* CAP_ConvertLog */
+void test_CAP_ConvertLog_SampleCSV(void);
+void test_CAP_SecondsToUs_Rounds(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* Writer/Reader */
+
+   RUN_TEST(test_CAP_RoundTripsEveryFrame);
+   RUN_TEST(test_CAP_EmptyCapture);
+   RUN_TEST(test_CAP_LargeGapStartsNewBlock);
+   RUN_TEST(test_CAP_WriteFrame_RejectsBackwardsTimestamps);
+   RUN_TEST(test_CAP_WriteFrame_RejectsChannelOOR);
+   RUN_TEST(test_CAP_OpenMemory_RejectsCorruptHeader);
+   RUN_TEST(test_CAP_OpenMemory_RejectsCorruptIndex);
+   RUN_TEST(test_CAP_Next_StopsAtTruncatedRecord);
+   RUN_TEST(test_CAP_Next_StopsAtBlockStartingBeforeLastOneEnds);
+   RUN_TEST(test_CAP_Open_MapsFile);
+
+   /* Seeking */
+
+   RUN_TEST(test_CAP_SeekFrame_AcrossBlocks);
+   RUN_TEST(test_CAP_SeekTime_AcrossBlocks);
+
+   /* Postings */
+
+   RUN_TEST(test_CAP_Postings_ListEveryFrameWithID);
+   RUN_TEST(test_CAP_NextPosting_RejectsCorruptList);
+   RUN_TEST(test_CAP_AddPostings_RebuildsStrippedPostings);
+
+   /* Merging */
+
+   RUN_TEST(test_CAP_Merge_InterleavesInTimestampOrder);
+   RUN_TEST(test_CAP_Merge_RetagsAndRechecksPIDs);
+   RUN_TEST(test_CAP_MergeOpen_RetagNeedsAChannelPerInput);
+
+   /* CAP_ConvertLog */
+
+   RUN_TEST(test_CAP_ConvertLog_SampleCSV);
+   RUN_TEST(test_CAP_SecondsToUs_Rounds);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   memset( Capture, 0, sizeof(Capture) );
+   CaptureLen = 0;
+}
+
+void tearDown(void)
+{
+   (void)remove(CAPTURE_PATH);
+}
+
+/* Helpers */
+
+/**
+ * @brief Frame n of a made-up bus: IDs and lengths cycle, some frames flagged.
+ */
+static struct CAP_Frame_S GeneratedFrame( uint32_t n )
+{
+   struct CAP_Frame_S frame = { 0 };
+   frame.timestamp_us = 1000000u + ((uint64_t)n * FRAME_PERIOD_US);
+   frame.id = (uint8_t)(n % (MAX_ID_ALLOWED + 1u));
+   frame.pid = ReferencePID(frame.id);
+   frame.length = (uint8_t)(n % (CAP_MAX_FRAME_LEN + 1u));
+   frame.channel = (uint8_t)(n % (CAP_MAX_CHANNEL + 1u));
+   frame.flags = ( 0 == (n % 13u) ) ? CAP_FLAG_CHECKSUM_ERROR : 0u;
+   for ( uint8_t i = 0; i < frame.length; i++ )
+   {
+      frame.data[i] = (uint8_t)(n + i);
+   }
+   frame.checksum = (uint8_t)~n;
+   return frame;
+}
+
+static void WriteGeneratedCapture( uint32_t num_frames, uint32_t block_frames )
+{
+   FILE * fp = tmpfile();
+   TEST_ASSERT_NOT_NULL(fp);
+
+   struct CAP_Writer_S writer;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterOpen(&writer, fp, block_frames) );
+   for ( uint32_t n = 0; n < num_frames; n++ )
+   {
+      struct CAP_Frame_S frame = GeneratedFrame(n);
+      TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriteFrame(&writer, &frame) );
+   }
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterClose(&writer) );
+
+   SlurpCapture(fp);
+   fclose(fp);
+}
+
+static void SlurpCapture( FILE * fp )
+{
+   rewind(fp);
+   CaptureLen = fread(Capture, 1, sizeof(Capture), fp);
+   TEST_ASSERT_TRUE( CaptureLen < sizeof(Capture) );
+}
+
+static size_t WriteCaptureOf( const struct CAP_Frame_S * frames, size_t num_frames, uint8_t * buf, size_t buf_len )
+{
+   FILE * fp = tmpfile();
+   TEST_ASSERT_NOT_NULL(fp);
+
+   struct CAP_Writer_S writer;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterOpen(&writer, fp, SMALL_BLOCK_FRAMES) );
+   for ( size_t i = 0; i < num_frames; i++ )
+   {
+      TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriteFrame(&writer, &frames[i]) );
+   }
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterClose(&writer) );
+
+   rewind(fp);
+   size_t len = fread(buf, 1, buf_len, fp);
+   TEST_ASSERT_TRUE( len < buf_len );
+   fclose(fp);
+   return len;
+}
+
+static void AssertFramesEqual( const struct CAP_Frame_S * expected, const struct CAP_Frame_S * actual )
+{
+   TEST_ASSERT_EQUAL_UINT64( expected->timestamp_us, actual->timestamp_us );
+   TEST_ASSERT_EQUAL_HEX8( expected->id, actual->id );
+   TEST_ASSERT_EQUAL_HEX8( expected->pid, actual->pid );
+   TEST_ASSERT_EQUAL_HEX8( expected->checksum, actual->checksum );
+   TEST_ASSERT_EQUAL_UINT8( expected->length, actual->length );
+   TEST_ASSERT_EQUAL_UINT8( expected->channel, actual->channel );
+   TEST_ASSERT_EQUAL_HEX8( expected->flags, actual->flags );
+   TEST_ASSERT_EQUAL_HEX8_ARRAY( expected->data, actual->data, CAP_MAX_FRAME_LEN );
+}
+
+/* Writer/Reader */
+/******************************************************************************/
+
+void test_CAP_RoundTripsEveryFrame(void)
+{
+   WriteGeneratedCapture(NUM_OF_GENERATED_FRAMES, SMALL_BLOCK_FRAMES);
+
+   struct CAP_Reader_S reader;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   TEST_ASSERT_EQUAL_UINT64( NUM_OF_GENERATED_FRAMES, reader.num_frames );
+   TEST_ASSERT_EQUAL_UINT64( (NUM_OF_GENERATED_FRAMES + SMALL_BLOCK_FRAMES - 1u) / SMALL_BLOCK_FRAMES, reader.num_blocks );
+   TEST_ASSERT_EQUAL_UINT32( SMALL_BLOCK_FRAMES, reader.block_frames );
+   TEST_ASSERT_EQUAL_UINT64( GeneratedFrame(NUM_OF_GENERATED_FRAMES - 1u).timestamp_us, reader.last_us );
+
+   struct CAP_Cursor_S cursor;
+   struct CAP_Frame_S frame;
+   TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, 0, &cursor) );
+   for ( uint32_t n = 0; n < NUM_OF_GENERATED_FRAMES; n++ )
+   {
+      struct CAP_Frame_S expected = GeneratedFrame(n);
+      TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+      AssertFramesEqual(&expected, &frame);
+   }
+   TEST_ASSERT_FALSE( CAP_Next(&reader, &cursor, &frame) );
+
+   CAP_Close(&reader);
+}
+
+void test_CAP_EmptyCapture(void)
+{
+   WriteGeneratedCapture(0, 0);
+   TEST_ASSERT_EQUAL_size_t( CAP_HEADER_LEN + CAP_POSTINGS_DIR_LEN, CaptureLen );
+
+   struct CAP_Reader_S reader;
+   struct CAP_Cursor_S cursor;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   TEST_ASSERT_EQUAL_UINT64( 0, reader.num_frames );
+   TEST_ASSERT_EQUAL_UINT32( CAP_DEFAULT_BLOCK_FRAMES, reader.block_frames );
+   TEST_ASSERT_FALSE( CAP_SeekFrame(&reader, 0, &cursor) );
+   TEST_ASSERT_FALSE( CAP_SeekTime(&reader, 0, &cursor) );
+
+   struct CAP_Postings_S postings;
+   struct CAP_Frame_S frame;
+   TEST_ASSERT_TRUE( CAP_PostingsOpen(&reader, 0x22, &postings) );
+   TEST_ASSERT_EQUAL_UINT64( 0, postings.remaining );
+   TEST_ASSERT_FALSE( CAP_NextPosting(&reader, &postings, &frame) );
+   CAP_Close(&reader);
+}
+
+void test_CAP_LargeGapStartsNewBlock(void)
+{
+   FILE * fp = tmpfile();
+   TEST_ASSERT_NOT_NULL(fp);
+
+   // A delta of UINT32_MAX still fits; one more microsecond doesn't
+   struct CAP_Frame_S frames[4] = { GeneratedFrame(0), GeneratedFrame(1), GeneratedFrame(2), GeneratedFrame(3) };
+   frames[1].timestamp_us = frames[0].timestamp_us + UINT32_MAX;
+   frames[2].timestamp_us = frames[1].timestamp_us + UINT32_MAX + 1u;
+   frames[3].timestamp_us = frames[2].timestamp_us;
+
+   struct CAP_Writer_S writer;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterOpen(&writer, fp, 0) );
+   for ( size_t i = 0; i < 4u; i++ )
+   {
+      TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriteFrame(&writer, &frames[i]) );
+   }
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterClose(&writer) );
+   SlurpCapture(fp);
+   fclose(fp);
+
+   struct CAP_Reader_S reader;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   TEST_ASSERT_EQUAL_UINT64( 2, reader.num_blocks );
+
+   struct CAP_Cursor_S cursor;
+   struct CAP_Frame_S frame;
+   TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, 0, &cursor) );
+   for ( size_t i = 0; i < 4u; i++ )
+   {
+      TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+      AssertFramesEqual(&frames[i], &frame);
+   }
+
+   TEST_ASSERT_TRUE( CAP_SeekTime(&reader, frames[1].timestamp_us + 1u, &cursor) );
+   TEST_ASSERT_EQUAL_UINT64( 2, cursor.frame );
+   CAP_Close(&reader);
+}
+
+void test_CAP_WriteFrame_RejectsBackwardsTimestamps(void)
+{
+   FILE * fp = tmpfile();
+   TEST_ASSERT_NOT_NULL(fp);
+
+   struct CAP_Frame_S first = GeneratedFrame(1);
+   struct CAP_Frame_S earlier = GeneratedFrame(0);
+   struct CAP_Writer_S writer;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterOpen(&writer, fp, 0) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriteFrame(&writer, &first) );
+   TEST_ASSERT_EQUAL_INT( CaptureTimestampsOutOfOrder, CAP_WriteFrame(&writer, &earlier) );
+
+   // Equal timestamps are fine
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriteFrame(&writer, &first) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterClose(&writer) );
+   fclose(fp);
+}
+
+void test_CAP_WriteFrame_RejectsChannelOOR(void)
+{
+   FILE * fp = tmpfile();
+   TEST_ASSERT_NOT_NULL(fp);
+
+   struct CAP_Frame_S frame = GeneratedFrame(0);
+   frame.channel = CAP_MAX_CHANNEL + 1u;
+   struct CAP_Writer_S writer;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterOpen(&writer, fp, 0) );
+   TEST_ASSERT_EQUAL_INT( CaptureChannelOOR, CAP_WriteFrame(&writer, &frame) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterClose(&writer) );
+   fclose(fp);
+}
+
+void test_CAP_OpenMemory_RejectsCorruptHeader(void)
+{
+   struct CAP_Reader_S reader;
+   WriteGeneratedCapture(20, SMALL_BLOCK_FRAMES);
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+
+   // Too short, bad magic, unknown version
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, CAP_OpenMemory(Capture, CAP_HEADER_LEN - 1u, &reader) );
+   Capture[0] = 'X';
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   Capture[0] = 'L';
+   Capture[6] = CAP_VERSION + 1u;
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   Capture[6] = CAP_VERSION;
+
+   // Index claims more blocks than the file holds
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, CAP_OpenMemory(Capture, CaptureLen - 1u, &reader) );
+   Capture[24]++;
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   Capture[24]--;
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+}
+
+void test_CAP_OpenMemory_RejectsCorruptIndex(void)
+{
+   struct CAP_Reader_S reader;
+   WriteGeneratedCapture(20, SMALL_BLOCK_FRAMES);
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   uint8_t * second_entry = &Capture[reader.index_offset + CAP_INDEX_ENTRY_LEN];
+
+   // First frame number out of order
+   second_entry[0] = 0;
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   second_entry[0] = SMALL_BLOCK_FRAMES;
+
+   // Record offset pointing into the index
+   second_entry[17] = 0xFF;
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   second_entry[17] = 0;
+
+   // Start time going backwards
+   second_entry[8] = 0;
+   second_entry[9] = 0;
+   second_entry[10] = 0;
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+}
+
+void test_CAP_Next_StopsAtTruncatedRecord(void)
+{
+   struct CAP_Reader_S reader;
+   struct CAP_Cursor_S cursor;
+   struct CAP_Frame_S frame;
+   WriteGeneratedCapture(3, 0);
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+
+   // Frame 2 claims 8 data bytes that would run into the index
+   size_t third_record = CAP_HEADER_LEN + (2u * CAP_RECORD_HEADER_LEN) + 0u + 1u;
+   Capture[third_record + 5u] = (uint8_t)((Capture[third_record + 5u] & 0xF0u) | CAP_MAX_FRAME_LEN);
+
+   TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, 0, &cursor) );
+   TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+   TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+   TEST_ASSERT_FALSE( CAP_Next(&reader, &cursor, &frame) );
+   TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, 2, &cursor) );
+   TEST_ASSERT_FALSE( CAP_Next(&reader, &cursor, &frame) );
+}
+
+void test_CAP_Next_StopsAtBlockStartingBeforeLastOneEnds(void)
+{
+   struct CAP_Reader_S reader;
+   struct CAP_Cursor_S cursor;
+   struct CAP_Frame_S frame;
+   WriteGeneratedCapture(20, SMALL_BLOCK_FRAMES);
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+
+   // Exactly when the second block starts is fine
+   TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, SMALL_BLOCK_FRAMES - 1u, &cursor) );
+   size_t last_record = (size_t)cursor.offset;
+   Capture[last_record + 0u] = (uint8_t)(2u * FRAME_PERIOD_US);
+   Capture[last_record + 1u] = (uint8_t)((2u * FRAME_PERIOD_US) >> 8);
+   TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, SMALL_BLOCK_FRAMES - 2u, &cursor) );
+   TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+   TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+   TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+
+   // Last frame of the first block 2 ms late, after the second block starts.
+   // Opening only checks the index, so it's the step across that stops.
+   Capture[last_record + 0u] = (uint8_t)(FRAME_PERIOD_US + 2000u);
+   Capture[last_record + 1u] = (uint8_t)((FRAME_PERIOD_US + 2000u) >> 8);
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+
+   TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, 0, &cursor) );
+   for ( uint32_t n = 0; n < SMALL_BLOCK_FRAMES; n++ )
+   {
+      TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+   }
+   TEST_ASSERT_FALSE( CAP_Next(&reader, &cursor, &frame) );
+
+   // Seeking straight into the next block still works
+   TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, SMALL_BLOCK_FRAMES, &cursor) );
+   TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+   struct CAP_Frame_S expected = GeneratedFrame(SMALL_BLOCK_FRAMES);
+   AssertFramesEqual(&expected, &frame);
+}
+
+void test_CAP_Open_MapsFile(void)
+{
+   TEST_ASSERT_EQUAL_INT( CaptureFileUnreadable, CAP_Open(CAPTURE_PATH, &(struct CAP_Reader_S){ 0 }) );
+
+   WriteGeneratedCapture(NUM_OF_GENERATED_FRAMES, 0);
+   FILE * fp = fopen(CAPTURE_PATH, "wb");
+   TEST_ASSERT_NOT_NULL(fp);
+   TEST_ASSERT_EQUAL_size_t( CaptureLen, fwrite(Capture, 1, CaptureLen, fp) );
+   fclose(fp);
+
+   struct CAP_Reader_S reader;
+   struct CAP_Cursor_S cursor;
+   struct CAP_Frame_S frame;
+   struct CAP_Frame_S expected = GeneratedFrame(NUM_OF_GENERATED_FRAMES - 1u);
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_Open(CAPTURE_PATH, &reader) );
+   TEST_ASSERT_TRUE( reader.owned );
+   TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, NUM_OF_GENERATED_FRAMES - 1u, &cursor) );
+   TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+   AssertFramesEqual(&expected, &frame);
+   CAP_Close(&reader);
+
+   // Not a capture at all
+   fp = fopen(CAPTURE_PATH, "wb");
+   TEST_ASSERT_NOT_NULL(fp);
+   fputs( "timestamp,channel,id,pid,data,checksum\n0.010000,1,0x27,0xE7,01 02 03 04,0E\n", fp );
+   fclose(fp);
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, CAP_Open(CAPTURE_PATH, &reader) );
+}
+
+/* Seeking */
+/******************************************************************************/
+
+void test_CAP_SeekFrame_AcrossBlocks(void)
+{
+   WriteGeneratedCapture(NUM_OF_GENERATED_FRAMES, SMALL_BLOCK_FRAMES);
+
+   struct CAP_Reader_S reader;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+
+   // Block boundaries, the frames either side of them, and the very end
+   const uint32_t wanted[] = { 0, 1, SMALL_BLOCK_FRAMES - 1u, SMALL_BLOCK_FRAMES, SMALL_BLOCK_FRAMES + 1u,
+                               500, NUM_OF_GENERATED_FRAMES - 1u };
+   for ( size_t i = 0; i < (sizeof(wanted) / sizeof(wanted[0])); i++ )
+   {
+      struct CAP_Cursor_S cursor;
+      struct CAP_Frame_S frame;
+      struct CAP_Frame_S expected = GeneratedFrame(wanted[i]);
+      TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, wanted[i], &cursor) );
+      TEST_ASSERT_EQUAL_UINT64( wanted[i], cursor.frame );
+      TEST_ASSERT_EQUAL_UINT64( wanted[i] / SMALL_BLOCK_FRAMES, cursor.block );
+      TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+      AssertFramesEqual(&expected, &frame);
+   }
+
+   struct CAP_Cursor_S cursor;
+   TEST_ASSERT_FALSE( CAP_SeekFrame(&reader, NUM_OF_GENERATED_FRAMES, &cursor) );
+   CAP_Close(&reader);
+}
+
+void test_CAP_SeekTime_AcrossBlocks(void)
+{
+   WriteGeneratedCapture(NUM_OF_GENERATED_FRAMES, SMALL_BLOCK_FRAMES);
+
+   struct CAP_Reader_S reader;
+   struct CAP_Cursor_S cursor;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+
+   // Before the first frame
+   TEST_ASSERT_TRUE( CAP_SeekTime(&reader, 0, &cursor) );
+   TEST_ASSERT_EQUAL_UINT64( 0, cursor.frame );
+
+   // Exactly on a frame, and just after one (including the last of a block)
+   for ( uint32_t n = 1; n < NUM_OF_GENERATED_FRAMES; n += 37u )
+   {
+      uint64_t t = GeneratedFrame(n).timestamp_us;
+      TEST_ASSERT_TRUE( CAP_SeekTime(&reader, t, &cursor) );
+      TEST_ASSERT_EQUAL_UINT64( n, cursor.frame );
+      TEST_ASSERT_TRUE( CAP_SeekTime(&reader, t - 1u, &cursor) );
+      TEST_ASSERT_EQUAL_UINT64( n, cursor.frame );
+   }
+   TEST_ASSERT_TRUE( CAP_SeekTime(&reader, GeneratedFrame(SMALL_BLOCK_FRAMES - 1u).timestamp_us + 1u, &cursor) );
+   TEST_ASSERT_EQUAL_UINT64( SMALL_BLOCK_FRAMES, cursor.frame );
+
+   // After the last frame
+   TEST_ASSERT_FALSE( CAP_SeekTime(&reader, reader.last_us + 1u, &cursor) );
+   CAP_Close(&reader);
+}
+
+/* Postings */
+/******************************************************************************/
+
+void test_CAP_Postings_ListEveryFrameWithID(void)
+{
+   WriteGeneratedCapture(NUM_OF_GENERATED_FRAMES, SMALL_BLOCK_FRAMES);
+
+   struct CAP_Reader_S reader;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   TEST_ASSERT_NOT_NULL( reader.postings );
+
+   // Frame n has ID n % 64
+   uint64_t total = 0;
+   for ( uint8_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      struct CAP_Postings_S postings;
+      struct CAP_Frame_S frame;
+      TEST_ASSERT_TRUE( CAP_PostingsOpen(&reader, id, &postings) );
+      TEST_ASSERT_EQUAL_UINT64( (NUM_OF_GENERATED_FRAMES - id + MAX_ID_ALLOWED) / CAP_NUM_OF_IDS, postings.remaining );
+      for ( uint32_t n = id; n < NUM_OF_GENERATED_FRAMES; n += CAP_NUM_OF_IDS )
+      {
+         struct CAP_Frame_S expected = GeneratedFrame(n);
+         TEST_ASSERT_TRUE( CAP_NextPosting(&reader, &postings, &frame) );
+         AssertFramesEqual(&expected, &frame);
+         total++;
+      }
+      TEST_ASSERT_FALSE( CAP_NextPosting(&reader, &postings, &frame) );
+   }
+   TEST_ASSERT_EQUAL_UINT64( NUM_OF_GENERATED_FRAMES, total );
+   CAP_Close(&reader);
+}
+
+void test_CAP_NextPosting_RejectsCorruptList(void)
+{
+   struct CAP_Reader_S reader;
+   struct CAP_Postings_S postings;
+   struct CAP_Frame_S frame;
+   WriteGeneratedCapture(200, 0);
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+
+   // Point ID 5's first entry at frame 0's record (ID 0). Its offset is
+   // small enough to be a one-byte varint either way.
+   TEST_ASSERT_TRUE( CAP_PostingsOpen(&reader, 5, &postings) );
+   uint8_t * list = (uint8_t *)(uintptr_t)postings.pos;
+   TEST_ASSERT_LESS_THAN( 0x80, list[0] );
+   list[0] = CAP_HEADER_LEN;
+   TEST_ASSERT_FALSE( CAP_NextPosting(&reader, &postings, &frame) );
+
+   // A list entry with no end
+   TEST_ASSERT_TRUE( CAP_PostingsOpen(&reader, 6, &postings) );
+   list = (uint8_t *)(uintptr_t)postings.pos;
+   memset( list, 0xFF, (size_t)(postings.end - postings.pos) );
+   TEST_ASSERT_FALSE( CAP_NextPosting(&reader, &postings, &frame) );
+
+   // A list running past the end of the file
+   uint8_t * entry = (uint8_t *)(uintptr_t)&reader.postings[7u * CAP_POSTINGS_DIR_ENTRY_LEN];
+   entry[16] = 0xFF;
+   entry[17] = 0xFF;
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+}
+
+void test_CAP_AddPostings_RebuildsStrippedPostings(void)
+{
+   WriteGeneratedCapture(NUM_OF_GENERATED_FRAMES, SMALL_BLOCK_FRAMES);
+
+   struct CAP_Reader_S reader;
+   struct CAP_Postings_S postings;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   size_t postings_offset = (size_t)(reader.postings - Capture);
+
+   // Same capture with the postings cut off and the header not pointing at them
+   uint8_t header[CAP_HEADER_LEN];
+   memcpy( header, Capture, sizeof(header) );
+   memset( &header[48], 0, 8 );
+   FILE * fp = fopen(CAPTURE_PATH, "wb");
+   TEST_ASSERT_NOT_NULL(fp);
+   TEST_ASSERT_EQUAL_size_t( sizeof(header), fwrite(header, 1, sizeof(header), fp) );
+   TEST_ASSERT_EQUAL_size_t( postings_offset - sizeof(header),
+                             fwrite(&Capture[sizeof(header)], 1, postings_offset - sizeof(header), fp) );
+   fclose(fp);
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_Open(CAPTURE_PATH, &reader) );
+   TEST_ASSERT_NULL( reader.postings );
+   TEST_ASSERT_FALSE( CAP_PostingsOpen(&reader, 0, &postings) );
+   CAP_Close(&reader);
+
+   // Rebuilt from the records, they come out byte for byte the same
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_AddPostings(CAPTURE_PATH) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_Open(CAPTURE_PATH, &reader) );
+   TEST_ASSERT_EQUAL_size_t( CaptureLen, reader.size );
+   TEST_ASSERT_EQUAL_MEMORY( Capture, reader.base, CaptureLen );
+   CAP_Close(&reader);
+
+   // Already there: nothing changes
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_AddPostings(CAPTURE_PATH) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_Open(CAPTURE_PATH, &reader) );
+   TEST_ASSERT_EQUAL_size_t( CaptureLen, reader.size );
+   CAP_Close(&reader);
+
+   TEST_ASSERT_EQUAL_INT( CaptureFileUnreadable, CAP_AddPostings("no/such/capture.lincap") );
+}
+
+/* Merging */
+/******************************************************************************/
+
+void test_CAP_Merge_InterleavesInTimestampOrder(void)
+{
+   // Deal the generated bus out to the inputs round robin, then put it back together
+   static struct CAP_Frame_S frames[NUM_OF_MERGE_INPUTS][NUM_OF_GENERATED_FRAMES];
+   size_t num_frames[NUM_OF_MERGE_INPUTS] = { 0 };
+   for ( uint32_t n = 0; n < NUM_OF_GENERATED_FRAMES; n++ )
+   {
+      uint32_t input = n % NUM_OF_MERGE_INPUTS;
+      frames[input][num_frames[input]++] = GeneratedFrame(n);
+   }
+
+   uint8_t * bufs[NUM_OF_MERGE_INPUTS];
+   struct CAP_Reader_S readers[NUM_OF_MERGE_INPUTS];
+   for ( size_t i = 0; i < NUM_OF_MERGE_INPUTS; i++ )
+   {
+      bufs[i] = malloc(MAX_CAPTURE_LEN);
+      TEST_ASSERT_NOT_NULL(bufs[i]);
+      size_t len = WriteCaptureOf(frames[i], num_frames[i], bufs[i], MAX_CAPTURE_LEN);
+      TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(bufs[i], len, &readers[i]) );
+   }
+
+   struct CAP_Merge_S merge;
+   struct CAP_Frame_S frame;
+   size_t input = 0;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_MergeOpen(&merge, readers, NUM_OF_MERGE_INPUTS, false) );
+   for ( uint32_t n = 0; n < NUM_OF_GENERATED_FRAMES; n++ )
+   {
+      struct CAP_Frame_S expected = GeneratedFrame(n);
+      TEST_ASSERT_TRUE( CAP_MergeNext(&merge, &frame, &input) );
+      AssertFramesEqual(&expected, &frame);
+      TEST_ASSERT_EQUAL_size_t( n % NUM_OF_MERGE_INPUTS, input );
+   }
+   TEST_ASSERT_FALSE( CAP_MergeNext(&merge, &frame, &input) );
+   TEST_ASSERT_FALSE( merge.corrupt );
+   TEST_ASSERT_EQUAL_UINT64( NUM_OF_GENERATED_FRAMES, merge.frames );
+   TEST_ASSERT_EQUAL_UINT64( 0, merge.pid_errors );
+   CAP_MergeClose(&merge);
+
+   // An input that runs out before the frame count in its header says it was cut short
+   readers[1].num_frames++;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_MergeOpen(&merge, readers, NUM_OF_MERGE_INPUTS, false) );
+   while ( CAP_MergeNext(&merge, &frame, NULL) )
+   {
+   }
+   TEST_ASSERT_TRUE( merge.corrupt );
+   TEST_ASSERT_EQUAL_UINT64( NUM_OF_GENERATED_FRAMES, merge.frames );
+   CAP_MergeClose(&merge);
+
+   for ( size_t i = 0; i < NUM_OF_MERGE_INPUTS; i++ )
+   {
+      CAP_Close(&readers[i]);
+      free(bufs[i]);
+   }
+}
+
+void test_CAP_Merge_RetagsAndRechecksPIDs(void)
+{
+   // Two captures of the same channel, with a shared timestamp and a PID gone wrong
+   struct CAP_Frame_S first[2] = { GeneratedFrame(0), GeneratedFrame(2) };
+   struct CAP_Frame_S second[2] = { GeneratedFrame(1), GeneratedFrame(2) };
+   first[0].channel = 1;
+   first[1].channel = 1;
+   second[0].channel = 1;
+   second[1].channel = 1;
+   second[1].id = 0x22;
+   second[1].pid = ReferencePID(0x23);
+   first[1].flags = CAP_FLAG_PID_ERROR;   // Flagged, but the PID is actually right
+
+   static uint8_t other[MAX_CAPTURE_LEN];
+   struct CAP_Reader_S readers[2];
+   CaptureLen = WriteCaptureOf(first, 2, Capture, sizeof(Capture));
+   size_t other_len = WriteCaptureOf(second, 2, other, sizeof(other));
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &readers[0]) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(other, other_len, &readers[1]) );
+
+   struct CAP_Merge_S merge;
+   struct CAP_Frame_S frame;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_MergeOpen(&merge, readers, 2, true) );
+
+   const uint8_t expected_ids[] = { first[0].id, second[0].id, first[1].id, 0x22 };
+   const uint8_t expected_channels[] = { 1, 2, 1, 2 };
+   const uint8_t expected_flags[] = { first[0].flags, second[0].flags, 0u, CAP_FLAG_PID_ERROR };
+   for ( size_t i = 0; i < sizeof(expected_ids); i++ )
+   {
+      TEST_ASSERT_TRUE( CAP_MergeNext(&merge, &frame, NULL) );
+      TEST_ASSERT_EQUAL_HEX8( expected_ids[i], frame.id );
+      TEST_ASSERT_EQUAL_UINT8( expected_channels[i], frame.channel );
+      TEST_ASSERT_EQUAL_HEX8( expected_flags[i], frame.flags & (CAP_FLAG_PID_ERROR | CAP_FLAG_CHECKSUM_ERROR) );
+   }
+   TEST_ASSERT_FALSE( CAP_MergeNext(&merge, &frame, NULL) );
+   TEST_ASSERT_EQUAL_UINT64( 1, merge.pid_errors );
+   CAP_MergeClose(&merge);
+}
+
+void test_CAP_MergeOpen_RetagNeedsAChannelPerInput(void)
+{
+   WriteGeneratedCapture(10, 0);
+
+   struct CAP_Reader_S readers[CAP_MAX_CHANNEL + 1u];
+   for ( size_t i = 0; i < (CAP_MAX_CHANNEL + 1u); i++ )
+   {
+      TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &readers[i]) );
+   }
+
+   struct CAP_Merge_S merge;
+   TEST_ASSERT_EQUAL_INT( CaptureChannelOOR, CAP_MergeOpen(&merge, readers, CAP_MAX_CHANNEL + 1u, true) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_MergeOpen(&merge, readers, CAP_MAX_CHANNEL + 1u, false) );
+   TEST_ASSERT_EQUAL_size_t( CAP_MAX_CHANNEL + 1u, merge.heap_len );
+   CAP_MergeClose(&merge);
+
+   // Nothing to merge is fine too
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_MergeOpen(&merge, readers, 0, true) );
+   struct CAP_Frame_S frame;
+   TEST_ASSERT_FALSE( CAP_MergeNext(&merge, &frame, NULL) );
+   CAP_MergeClose(&merge);
+}
+
+/* CAP_ConvertLog */
+/******************************************************************************/
+
+void test_CAP_ConvertLog_SampleCSV(void)
+{
+   FILE * in = fopen(SAMPLE_CSV_PATH, "rb");
+   FILE * out = tmpfile();
+   TEST_ASSERT_NOT_NULL(in);
+   TEST_ASSERT_NOT_NULL(out);
+
+   struct LOG_Options_S options = { 0 };
+   options.format = LOG_FORMAT_CSV;
+   options.checksum = LOG_CHECKSUM_LIN2;
+   struct CAP_ConvertStats_S stats;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_ConvertLog(in, out, &options, 2, &stats) );
+   fclose(in);
+   SlurpCapture(out);
+   fclose(out);
+
+   // The bad ID, overlong, and truncated lines can't be stored
+   TEST_ASSERT_EQUAL_UINT64( 13, stats.lines );
+   TEST_ASSERT_EQUAL_UINT64( 7, stats.frames );
+   TEST_ASSERT_EQUAL_UINT64( 3, stats.skipped );
+   TEST_ASSERT_EQUAL_UINT64( 4, stats.blocks );
+
+   struct CAP_Reader_S reader;
+   struct CAP_Cursor_S cursor;
+   struct CAP_Frame_S frame;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   TEST_ASSERT_EQUAL_UINT64( 7, reader.num_frames );
+
+   const uint8_t ids[] = { 0x27, 0x10, 0x3C, 0x22, 0x27, 0x27, 0x10 };
+   const uint8_t flags[] = { 0, 0, 0, 0, CAP_FLAG_PID_ERROR, CAP_FLAG_CHECKSUM_ERROR, 0 };
+   const uint64_t timestamps[] = { 10000, 20000, 30000, 40000, 50000, 60000, 100000 };
+   TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, 0, &cursor) );
+   for ( size_t i = 0; i < sizeof(ids); i++ )
+   {
+      TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+      TEST_ASSERT_EQUAL_HEX8( ids[i], frame.id );
+      TEST_ASSERT_EQUAL_HEX8( flags[i], frame.flags );
+      TEST_ASSERT_EQUAL_UINT64( timestamps[i], frame.timestamp_us );
+      TEST_ASSERT_EQUAL_UINT8( 1, frame.channel );
+   }
+
+   // The PID left out of the log is filled in; the wrong one is kept as logged
+   TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, 3, &cursor) );
+   TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+   TEST_ASSERT_EQUAL_HEX8( ReferencePID(0x22), frame.pid );
+   TEST_ASSERT_EQUAL_UINT8( 3, frame.length );
+   TEST_ASSERT_TRUE( CAP_Next(&reader, &cursor, &frame) );
+   TEST_ASSERT_EQUAL_HEX8( 0xE8, frame.pid );
+   TEST_ASSERT_EQUAL_HEX8( 0x0E, frame.checksum );
+}
+
+void test_CAP_SecondsToUs_Rounds(void)
+{
+   TEST_ASSERT_EQUAL_UINT64( 0, CAP_SecondsToUs(-1.0) );
+   TEST_ASSERT_EQUAL_UINT64( 0, CAP_SecondsToUs(0.0) );
+   TEST_ASSERT_EQUAL_UINT64( 10000, CAP_SecondsToUs(0.01) );
+   TEST_ASSERT_EQUAL_UINT64( 1234567, CAP_SecondsToUs(1.2345671) );
+   TEST_ASSERT_EQUAL_UINT64( 1234568, CAP_SecondsToUs(1.2345675) );
+}
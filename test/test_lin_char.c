@@ -0,0 +1,201 @@
+/*!
+ * @file    test_lin_char.c
+ * @brief   Test file for the character class table
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <locale.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_char.h"
+
+/* Local Macro Definitions */
+
+/* Local Variables */
+
+// Locales whose idea of a letter or a digit reaches past ASCII, if installed
+static const char * const OtherLocales[] =
+{
+   "en_US.ISO-8859-1", "de_DE.ISO-8859-1", "fr_FR.ISO-8859-1", "en_US.UTF-8", "C.UTF-8", ""
+};
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static bool In( int ch, const char * set );
+static uint16_t ExpectedClass( int ch );
+static bool SetOtherLocale(void);
+
+/* Char_Class */
+void test_Char_Class_EveryByte(void);
+void test_Char_Class_AgreesWithCtypeInTheCLocale(void);
+void test_Char_Class_DigitValues(void);
+void test_ParseID_SameUnderAnyLocale(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* Char_Class */
+
+   RUN_TEST(test_Char_Class_EveryByte);
+   RUN_TEST(test_Char_Class_AgreesWithCtypeInTheCLocale);
+   RUN_TEST(test_Char_Class_DigitValues);
+   RUN_TEST(test_ParseID_SameUnderAnyLocale);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   (void)setlocale(LC_ALL, "C");
+}
+
+void tearDown(void)
+{
+   (void)setlocale(LC_ALL, "C");
+}
+
+/* Helpers */
+
+static bool In( int ch, const char * set )
+{
+   return ( ch != '\0' ) && ( strchr(set, ch) != NULL );
+}
+
+/**
+ * @brief Char_Class[ch] worked out from the classes' definitions in lin_char.h.
+ */
+static uint16_t ExpectedClass( int ch )
+{
+   static const char * const LOWER = "abcdefghijklmnopqrstuvwxyz";
+   static const char * const UPPER = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+   static const char * const DEC = "0123456789";
+   static const char * const HEX_LOWER = "0123456789abcdef";
+   static const char * const HEX_UPPER = "0123456789ABCDEF";
+
+   unsigned int expected = 0;
+   if ( In(ch, DEC) )                  expected |= CHAR_DEC_DIGIT;
+   if ( In(ch, HEX_LOWER) )            expected |= CHAR_HEX_DIGIT | (unsigned int)(strchr(HEX_LOWER, ch) - HEX_LOWER);
+   else if ( In(ch, HEX_UPPER) )       expected |= CHAR_HEX_DIGIT | (unsigned int)(strchr(HEX_UPPER, ch) - HEX_UPPER);
+   if ( In(ch, "xX") )                 expected |= CHAR_HEX_PREFIX;
+   if ( In(ch, "hHxX") )               expected |= CHAR_HEX_SUFFIX;
+   if ( In(ch, "dD") )                 expected |= CHAR_DEC_SUFFIX;
+   if ( In(ch, " \t") )                expected |= CHAR_BLANK;
+   if ( In(ch, " \t\r\f\v") )          expected |= CHAR_SPACE;
+   if ( In(ch, " \t\n\r\f\v,") || ('\0' == ch) ) expected |= CHAR_TOKEN_DELIM;
+   if ( In(ch, LOWER) )                expected |= CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT;
+   if ( In(ch, UPPER) )                expected |= CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT;
+   if ( '_' == ch )                    expected |= CHAR_IDENT_START | CHAR_IDENT;
+   if ( In(ch, DEC) )                  expected |= CHAR_IDENT;
+   return (uint16_t)expected;
+}
+
+static bool SetOtherLocale(void)
+{
+   for ( size_t i = 0; i < (sizeof(OtherLocales) / sizeof(OtherLocales[0])); i++ )
+   {
+      if ( setlocale(LC_ALL, OtherLocales[i]) != NULL )
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+/* Char_Class */
+/******************************************************************************/
+
+void test_Char_Class_EveryByte(void)
+{
+   for ( int ch = 0; ch < 256; ch++ )
+   {
+      TEST_ASSERT_EQUAL_HEX16( ExpectedClass(ch), Char_Class[ch] );
+   }
+
+   // Past ASCII nothing has a class, and a negative char indexes the same entry
+   for ( int ch = 0x80; ch < 256; ch++ )
+   {
+      TEST_ASSERT_EQUAL_HEX16( 0, CHAR_CLASS( (char)ch ) );
+   }
+}
+
+void test_Char_Class_AgreesWithCtypeInTheCLocale(void)
+{
+   for ( int ch = 0; ch < 128; ch++ )
+   {
+      TEST_ASSERT_EQUAL( isdigit(ch) != 0,  CHAR_IS(ch, CHAR_DEC_DIGIT) );
+      TEST_ASSERT_EQUAL( isxdigit(ch) != 0, CHAR_IS(ch, CHAR_HEX_DIGIT) );
+      TEST_ASSERT_EQUAL( isblank(ch) != 0,  CHAR_IS(ch, CHAR_BLANK) );
+      TEST_ASSERT_EQUAL( isalpha(ch) != 0,  CHAR_IS(ch, CHAR_ALPHA) );
+      TEST_ASSERT_EQUAL( (isspace(ch) != 0) && (ch != '\n'), CHAR_IS(ch, CHAR_SPACE) );
+   }
+}
+
+void test_Char_Class_DigitValues(void)
+{
+   static const char * const HEX_LOWER = "0123456789abcdef";
+   static const char * const HEX_UPPER = "0123456789ABCDEF";
+
+   for ( uint8_t value = 0; value < 16; value++ )
+   {
+      TEST_ASSERT_EQUAL_UINT8( value, CHAR_DIGIT_VALUE(HEX_LOWER[value]) );
+      TEST_ASSERT_EQUAL_UINT8( value, CHAR_DIGIT_VALUE(HEX_UPPER[value]) );
+   }
+   TEST_ASSERT_EQUAL_UINT8( 0, CHAR_DIGIT_VALUE('g') );
+   TEST_ASSERT_EQUAL_UINT8( 0, CHAR_DIGIT_VALUE('x') );
+}
+
+void test_ParseID_SameUnderAnyLocale(void)
+{
+   static const char * const TOKENS[] = { "0x1A", "1a", "1Ah", "X3f", "27d", " 3C", "0x3G" };
+   enum LIN_PID_Result_E c_results[sizeof(TOKENS) / sizeof(TOKENS[0])];
+   uint8_t c_ids[sizeof(TOKENS) / sizeof(TOKENS[0])];
+
+   for ( size_t i = 0; i < (sizeof(TOKENS) / sizeof(TOKENS[0])); i++ )
+   {
+      c_ids[i] = 0xFF;
+      c_results[i] = ParseID( TOKENS[i], false, false, &c_ids[i] );
+   }
+
+   if ( !SetOtherLocale() )
+   {
+      TEST_IGNORE_MESSAGE("No locale other than C is installed");
+   }
+
+   for ( size_t i = 0; i < (sizeof(TOKENS) / sizeof(TOKENS[0])); i++ )
+   {
+      uint8_t id = 0xFF;
+      TEST_ASSERT_EQUAL_INT_MESSAGE( c_results[i], ParseID(TOKENS[i], false, false, &id), TOKENS[i] );
+      TEST_ASSERT_EQUAL_HEX8_MESSAGE( c_ids[i], id, TOKENS[i] );
+   }
+
+   // Bytes a Latin-1 locale calls letters (or blanks) are still no part of an ID
+   for ( int ch = 0x80; ch < 256; ch++ )
+   {
+      const char token[] = { '1', (char)ch, '\0' };
+      const char leading[] = { (char)ch, '1', '\0' };
+      uint8_t id = 0xFF;
+      TEST_ASSERT_NOT_EQUAL( GoodResult, ParseID(token, false, false, &id) );
+      TEST_ASSERT_NOT_EQUAL( GoodResult, ParseID(leading, false, false, &id) );
+   }
+}
@@ -0,0 +1,418 @@
+/*!
+ * @file    test_lin_decode.c
+ * @brief   Test file for the compiled signal decoder
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_ldf.h"
+#include "lin_decode.h"
+
+/* Local Macro Definitions */
+#define SAMPLE_LDF_PATH       "test/sample.ldf"
+#define PARSE_STR(str, db)    LDF_Parse( (str), strlen(str), (db) )
+#define RANDOM_BATCH_SIZE     512u
+
+/* Local Variables */
+static struct LDF_Database_S DB;
+static struct LDF_DecodePlan_S Plan;
+static struct LDF_SignalColumns_S Cols;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static size_t SignalIndex( const char * name );
+static uint64_t ReferenceExtract( const uint8_t * data, uint8_t bit_offset, uint8_t size_bits );
+
+/* LDF_CompileDecodePlan */
+void test_LDF_CompileDecodePlan_OpsGroupedByID(void);
+void test_LDF_CompileDecodePlan_ShiftsAndMasks(void);
+void test_LDF_CompileDecodePlan_ColumnsCarryScaling(void);
+void test_LDF_CompileDecodePlan_EmptyDatabase(void);
+
+/* LDF_DecodeBatch */
+void test_LDF_DecodeBatch_SubByteSignals(void);
+void test_LDF_DecodeBatch_SignalSpanningBytes(void);
+void test_LDF_DecodeBatch_SixtyFourBitSignal(void);
+void test_LDF_DecodeBatch_UnknownIDAndWrongLength_Skipped(void);
+void test_LDF_DecodeBatch_StopsWhenFull(void);
+void test_LDF_DecodeBatch_MatchesBitByBitReference(void);
+
+/* LDF_ScaleColumn */
+void test_LDF_ScaleColumn_AppliesEncoding(void);
+void test_LDF_ScaleColumn_UnencodedIsRaw(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* LDF_CompileDecodePlan */
+
+   RUN_TEST(test_LDF_CompileDecodePlan_OpsGroupedByID);
+   RUN_TEST(test_LDF_CompileDecodePlan_ShiftsAndMasks);
+   RUN_TEST(test_LDF_CompileDecodePlan_ColumnsCarryScaling);
+   RUN_TEST(test_LDF_CompileDecodePlan_EmptyDatabase);
+
+   /* LDF_DecodeBatch */
+
+   RUN_TEST(test_LDF_DecodeBatch_SubByteSignals);
+   RUN_TEST(test_LDF_DecodeBatch_SignalSpanningBytes);
+   RUN_TEST(test_LDF_DecodeBatch_SixtyFourBitSignal);
+   RUN_TEST(test_LDF_DecodeBatch_UnknownIDAndWrongLength_Skipped);
+   RUN_TEST(test_LDF_DecodeBatch_StopsWhenFull);
+   RUN_TEST(test_LDF_DecodeBatch_MatchesBitByBitReference);
+
+   /* LDF_ScaleColumn */
+
+   RUN_TEST(test_LDF_ScaleColumn_AppliesEncoding);
+   RUN_TEST(test_LDF_ScaleColumn_UnencodedIsRaw);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset( &DB, 0, sizeof(DB) );
+   memset( &Plan, 0, sizeof(Plan) );
+   memset( &Cols, 0, sizeof(Cols) );
+}
+void tearDown(void)
+{
+   LDF_FreeColumns(&Cols);
+   LDF_FreeDecodePlan(&Plan);
+   LDF_Free(&DB);
+}
+
+/* Helpers */
+
+/******************************************************************************/
+
+static size_t SignalIndex( const char * name )
+{
+   for ( size_t i = 0; i < DB.num_signals; i++ )
+   {
+      if ( strcmp(DB.signals[i].name, name) == 0 )
+      {
+         return i;
+      }
+   }
+   TEST_FAIL_MESSAGE( "Signal not in the LDF" );
+   return 0;
+}
+
+// Pull a signal out one bit at a time, straight from the LIN bit numbering
+static uint64_t ReferenceExtract( const uint8_t * data, uint8_t bit_offset, uint8_t size_bits )
+{
+   uint64_t value = 0;
+   for ( uint8_t b = 0; b < size_bits; b++ )
+   {
+      unsigned int bit = bit_offset + b;
+      if ( data[bit / 8u] & (1u << (bit % 8u)) )
+      {
+         value |= UINT64_C(1) << b;
+      }
+   }
+   return value;
+}
+
+/* LDF_CompileDecodePlan */
+
+/******************************************************************************/
+
+void test_LDF_CompileDecodePlan_OpsGroupedByID(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_CompileDecodePlan(&DB, &Plan) );
+
+   TEST_ASSERT_EQUAL_size_t( DB.num_frame_signals, Plan.num_ops );
+   TEST_ASSERT_EQUAL_size_t( DB.num_signals, Plan.num_columns );
+   TEST_ASSERT_EQUAL_UINT32( 0, Plan.ops_start[0] );
+   TEST_ASSERT_EQUAL_UINT32( Plan.num_ops, Plan.ops_start[MAX_ID_ALLOWED + 1] );
+
+   for ( uint8_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      const struct LDF_Frame_S * frame = LDF_FrameByID(&DB, id);
+      uint32_t num_ops = Plan.ops_start[id + 1] - Plan.ops_start[id];
+      if ( NULL == frame )
+      {
+         TEST_ASSERT_EQUAL_UINT8( 0, Plan.frame_len[id] );
+         TEST_ASSERT_EQUAL_UINT32( 0, num_ops );
+      }
+      else
+      {
+         TEST_ASSERT_EQUAL_UINT8( frame->length, Plan.frame_len[id] );
+         TEST_ASSERT_EQUAL_UINT32( frame->num_signals, num_ops );
+      }
+   }
+}
+
+void test_LDF_CompileDecodePlan_ShiftsAndMasks(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_CompileDecodePlan(&DB, &Plan) );
+
+   // LSM_Frm2: LSMerror (1 bit) at 0, IgnitionKeyPos (3 bits) at 5
+   const struct LDF_SignalOp_S * ops = &Plan.ops[ Plan.ops_start[0x03] ];
+   TEST_ASSERT_EQUAL_UINT32( 2, Plan.ops_start[0x04] - Plan.ops_start[0x03] );
+   TEST_ASSERT_EQUAL_UINT16( SignalIndex("LSMerror"), ops[0].column );
+   TEST_ASSERT_EQUAL_UINT8( 0, ops[0].shift );
+   TEST_ASSERT_EQUAL_HEX64( 0x1, ops[0].mask );
+   TEST_ASSERT_EQUAL_UINT16( SignalIndex("IgnitionKeyPos"), ops[1].column );
+   TEST_ASSERT_EQUAL_UINT8( 5, ops[1].shift );
+   TEST_ASSERT_EQUAL_HEX64( 0x7, ops[1].mask );
+
+   // MotorStatus: MotorSpeed (16 bits) at 16
+   ops = &Plan.ops[ Plan.ops_start[0x27] ];
+   TEST_ASSERT_EQUAL_UINT16( SignalIndex("MotorSpeed"), ops[0].column );
+   TEST_ASSERT_EQUAL_UINT8( 16, ops[0].shift );
+   TEST_ASSERT_EQUAL_HEX64( 0xFFFF, ops[0].mask );
+}
+
+void test_LDF_CompileDecodePlan_ColumnsCarryScaling(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_CompileDecodePlan(&DB, &Plan) );
+
+   const struct LDF_DecodeColumn_S * column = &Plan.columns[ SignalIndex("MotorSpeed") ];
+   TEST_ASSERT_EQUAL_STRING( "MotorSpeed", column->name );
+   TEST_ASSERT_EQUAL_STRING( "rpm", column->unit );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 0.5, column->scale );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, -100.0, column->offset );
+   TEST_ASSERT_EQUAL_UINT8( 16, column->size_bits );
+
+   // Logical-only encoding: unscaled
+   column = &Plan.columns[ SignalIndex("InternalLightsRequest") ];
+   TEST_ASSERT_NULL( column->unit );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 1.0, column->scale );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 0.0, column->offset );
+}
+
+void test_LDF_CompileDecodePlan_EmptyDatabase(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, PARSE_STR("", &DB) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_CompileDecodePlan(&DB, &Plan) );
+   TEST_ASSERT_EQUAL_size_t( 0, Plan.num_ops );
+   TEST_ASSERT_EQUAL_size_t( 0, Plan.num_columns );
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_InitColumns(&Plan, 4, &Cols) );
+   const struct LIN_Frame_S frames[2] = { { .id = 0x01, .length = 1 }, { .id = 0x3C, .length = 8 } };
+   TEST_ASSERT_EQUAL_size_t( 2, LDF_DecodeBatch(&Plan, frames, 2, &Cols) );
+   TEST_ASSERT_EQUAL_size_t( 2, Cols.frames_skipped );
+}
+
+/* LDF_DecodeBatch */
+
+/******************************************************************************/
+
+void test_LDF_DecodeBatch_SubByteSignals(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_CompileDecodePlan(&DB, &Plan) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_InitColumns(&Plan, 8, &Cols) );
+
+   // LSM_Frm2 = 0b101x_xxx1 -> LSMerror = 1, IgnitionKeyPos = 5
+   // CEM_Frm1 = 0bxxxx_xx10 -> InternalLightsRequest = 2
+   const struct LIN_Frame_S frames[] =
+   {
+      { .id = 0x03, .length = 1, .data = { 0xA1 } },
+      { .id = 0x01, .length = 1, .data = { 0xFE } },
+      { .id = 0x03, .length = 1, .data = { 0x40 } },
+   };
+   TEST_ASSERT_EQUAL_size_t( 3, LDF_DecodeBatch(&Plan, frames, 3, &Cols) );
+   TEST_ASSERT_EQUAL_size_t( 3, Cols.num_rows );
+   TEST_ASSERT_EQUAL_size_t( 0, Cols.frames_skipped );
+
+   size_t err = SignalIndex("LSMerror");
+   size_t key = SignalIndex("IgnitionKeyPos");
+   size_t lights = SignalIndex("InternalLightsRequest");
+
+   TEST_ASSERT_EQUAL_size_t( 2, Cols.counts[err] );
+   TEST_ASSERT_EQUAL_UINT64( 1, Cols.values[err][0] );
+   TEST_ASSERT_EQUAL_UINT64( 0, Cols.values[err][1] );
+   TEST_ASSERT_EQUAL_size_t( 2, Cols.counts[key] );
+   TEST_ASSERT_EQUAL_UINT64( 5, Cols.values[key][0] );
+   TEST_ASSERT_EQUAL_UINT64( 2, Cols.values[key][1] );
+   TEST_ASSERT_EQUAL_UINT32( 0, Cols.rows[key][0] );
+   TEST_ASSERT_EQUAL_UINT32( 2, Cols.rows[key][1] );
+
+   TEST_ASSERT_EQUAL_size_t( 1, Cols.counts[lights] );
+   TEST_ASSERT_EQUAL_UINT64( 2, Cols.values[lights][0] );
+   TEST_ASSERT_EQUAL_UINT32( 1, Cols.rows[lights][0] );
+}
+
+void test_LDF_DecodeBatch_SignalSpanningBytes(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_CompileDecodePlan(&DB, &Plan) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_InitColumns(&Plan, 1, &Cols) );
+
+   const struct LIN_Frame_S frame = { .id = 0x27, .length = 4, .data = { 0xFF, 0xFF, 0x34, 0x12 } };
+   TEST_ASSERT_EQUAL_size_t( 1, LDF_DecodeBatch(&Plan, &frame, 1, &Cols) );
+
+   size_t speed = SignalIndex("MotorSpeed");
+   TEST_ASSERT_EQUAL_size_t( 1, Cols.counts[speed] );
+   TEST_ASSERT_EQUAL_HEX64( 0x1234, Cols.values[speed][0] );
+}
+
+void test_LDF_DecodeBatch_SixtyFourBitSignal(void)
+{
+   const char * ldf =
+      "Nodes { Master: M, 5 ms, 0 ms; }\n"
+      "Signals { Wide: 64, 0, M; }\n"
+      "Frames { F: 0x30, M, 8 { Wide, 0; } }\n";
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, PARSE_STR(ldf, &DB) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_CompileDecodePlan(&DB, &Plan) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_InitColumns(&Plan, 1, &Cols) );
+   TEST_ASSERT_EQUAL_HEX64( UINT64_MAX, Plan.ops[0].mask );
+
+   const struct LIN_Frame_S frame = { .id = 0x30, .length = 8, .data = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF } };
+   TEST_ASSERT_EQUAL_size_t( 1, LDF_DecodeBatch(&Plan, &frame, 1, &Cols) );
+   TEST_ASSERT_EQUAL_HEX64( UINT64_C(0xEFCDAB8967452301), Cols.values[0][0] );
+}
+
+void test_LDF_DecodeBatch_UnknownIDAndWrongLength_Skipped(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_CompileDecodePlan(&DB, &Plan) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_InitColumns(&Plan, 8, &Cols) );
+
+   const struct LIN_Frame_S frames[] =
+   {
+      { .id = 0x10, .length = 2, .data = { 0xFF, 0xFF } },  // No such frame
+      { .id = 0x40, .length = 1, .data = { 0xFF } },        // Not even an ID
+      { .id = 0x03, .length = 2, .data = { 0xFF, 0xFF } },  // LSM_Frm2 is 1 byte
+      { .id = 0x03, .length = 1, .data = { 0x01 } },
+   };
+   TEST_ASSERT_EQUAL_size_t( 4, LDF_DecodeBatch(&Plan, frames, 4, &Cols) );
+   TEST_ASSERT_EQUAL_size_t( 4, Cols.num_rows );
+   TEST_ASSERT_EQUAL_size_t( 3, Cols.frames_skipped );
+
+   size_t err = SignalIndex("LSMerror");
+   TEST_ASSERT_EQUAL_size_t( 1, Cols.counts[err] );
+   TEST_ASSERT_EQUAL_UINT32( 3, Cols.rows[err][0] );
+}
+
+void test_LDF_DecodeBatch_StopsWhenFull(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_CompileDecodePlan(&DB, &Plan) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_InitColumns(&Plan, 2, &Cols) );
+
+   const struct LIN_Frame_S frames[] =
+   {
+      { .id = 0x05, .length = 1, .data = { 0x01 } },
+      { .id = 0x05, .length = 1, .data = { 0x00 } },
+      { .id = 0x05, .length = 1, .data = { 0x01 } },
+   };
+   size_t rsm_err = SignalIndex("RSMerror");
+
+   TEST_ASSERT_EQUAL_size_t( 2, LDF_DecodeBatch(&Plan, frames, 3, &Cols) );
+   TEST_ASSERT_EQUAL_size_t( 0, LDF_DecodeBatch(&Plan, &frames[2], 1, &Cols) );
+   TEST_ASSERT_EQUAL_size_t( 2, Cols.counts[rsm_err] );
+
+   LDF_ResetColumns(&Cols);
+   TEST_ASSERT_EQUAL_size_t( 0, Cols.counts[rsm_err] );
+   TEST_ASSERT_EQUAL_size_t( 1, LDF_DecodeBatch(&Plan, &frames[2], 1, &Cols) );
+   TEST_ASSERT_EQUAL_size_t( 1, Cols.counts[rsm_err] );
+   TEST_ASSERT_EQUAL_UINT64( 1, Cols.values[rsm_err][0] );
+   TEST_ASSERT_EQUAL_UINT32( 0, Cols.rows[rsm_err][0] );
+}
+
+void test_LDF_DecodeBatch_MatchesBitByBitReference(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_CompileDecodePlan(&DB, &Plan) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_InitColumns(&Plan, RANDOM_BATCH_SIZE, &Cols) );
+
+   // Random payloads for random frames from the LDF, fixed seed
+   static struct LIN_Frame_S frames[RANDOM_BATCH_SIZE];
+   srand(0x4C494E);
+   for ( size_t i = 0; i < RANDOM_BATCH_SIZE; i++ )
+   {
+      const struct LDF_Frame_S * frame = &DB.frames[ (size_t)rand() % DB.num_frames ];
+      frames[i].id = frame->id;
+      frames[i].length = frame->length;
+      for ( size_t b = 0; b < LDF_MAX_FRAME_LEN; b++ )
+      {
+         frames[i].data[b] = (uint8_t)rand();
+      }
+   }
+   TEST_ASSERT_EQUAL_size_t( RANDOM_BATCH_SIZE, LDF_DecodeBatch(&Plan, frames, RANDOM_BATCH_SIZE, &Cols) );
+   TEST_ASSERT_EQUAL_size_t( 0, Cols.frames_skipped );
+
+   // Walk the frames again the slow way and check each value landed where it should
+   size_t seen[LDF_NO_INDEX] = { 0 };
+   for ( size_t i = 0; i < RANDOM_BATCH_SIZE; i++ )
+   {
+      const struct LDF_Frame_S * frame = LDF_FrameByID(&DB, frames[i].id);
+      for ( uint16_t s = 0; s < frame->num_signals; s++ )
+      {
+         const struct LDF_FrameSignal_S * fs = &DB.frame_signals[frame->first_signal + s];
+         uint64_t expected = ReferenceExtract( frames[i].data, fs->bit_offset, DB.signals[fs->signal].size_bits );
+         size_t n = seen[fs->signal]++;
+         TEST_ASSERT_EQUAL_UINT32( i, Cols.rows[fs->signal][n] );
+         TEST_ASSERT_EQUAL_HEX64( expected, Cols.values[fs->signal][n] );
+      }
+   }
+   for ( size_t c = 0; c < Plan.num_columns; c++ )
+   {
+      TEST_ASSERT_EQUAL_size_t( seen[c], Cols.counts[c] );
+   }
+}
+
+/* LDF_ScaleColumn */
+
+/******************************************************************************/
+
+void test_LDF_ScaleColumn_AppliesEncoding(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_CompileDecodePlan(&DB, &Plan) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_InitColumns(&Plan, 2, &Cols) );
+
+   // 1000 * 0.5 - 100 = 400 rpm, 0 * 0.5 - 100 = -100 rpm
+   const struct LIN_Frame_S frames[] =
+   {
+      { .id = 0x27, .length = 4, .data = { 0, 0, 0xE8, 0x03 } },
+      { .id = 0x27, .length = 4, .data = { 0, 0, 0x00, 0x00 } },
+   };
+   TEST_ASSERT_EQUAL_size_t( 2, LDF_DecodeBatch(&Plan, frames, 2, &Cols) );
+
+   double physical[2];
+   size_t speed = SignalIndex("MotorSpeed");
+   LDF_ScaleColumn(&Plan, &Cols, speed, physical);
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 400.0, physical[0] );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, -100.0, physical[1] );
+}
+
+void test_LDF_ScaleColumn_UnencodedIsRaw(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_CompileDecodePlan(&DB, &Plan) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_InitColumns(&Plan, 1, &Cols) );
+
+   const struct LIN_Frame_S frame = { .id = 0x02, .length = 2, .data = { 0x00, 0xC8 } };
+   TEST_ASSERT_EQUAL_size_t( 1, LDF_DecodeBatch(&Plan, &frame, 1, &Cols) );
+
+   double physical;
+   LDF_ScaleColumn(&Plan, &Cols, SignalIndex("LeftIntLightsSwitch"), &physical);
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 200.0, physical );
+}
@@ -0,0 +1,230 @@
+/*!
+ * @file    test_lin_emit.c
+ * @brief   Test file for the firmware header generator
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_emit.h"
+
+/* Local Macro Definitions */
+#define MAX_HEADER_LEN           8192u
+
+/* Local Variables */
+static char Header[MAX_HEADER_LEN];
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static enum LIN_PID_Result_E Emit( enum EMIT_Language_E language, enum EMIT_Layout_E layout, const char * prefix );
+
+/* EMIT_ParityTable / EMIT_ParityMasks */
+void test_EMIT_ParityTable_ExtractsEveryPID(void);
+void test_EMIT_ParityMasks_ExtractEveryPID(void);
+
+/* EMIT_LayoutFromName / EMIT_PrefixIsValid */
+void test_EMIT_LayoutFromName_AndCosts(void);
+void test_EMIT_PrefixIsValid(void);
+
+/* EMIT_Header */
+void test_EMIT_Header_CTable(void);
+void test_EMIT_Header_CPPMaskWithPrefix(void);
+void test_EMIT_Header_CParity(void);
+void test_EMIT_Header_UnwritableStream(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* EMIT_ParityTable / EMIT_ParityMasks */
+
+   RUN_TEST(test_EMIT_ParityTable_ExtractsEveryPID);
+   RUN_TEST(test_EMIT_ParityMasks_ExtractEveryPID);
+
+   /* EMIT_LayoutFromName / EMIT_PrefixIsValid */
+
+   RUN_TEST(test_EMIT_LayoutFromName_AndCosts);
+   RUN_TEST(test_EMIT_PrefixIsValid);
+
+   /* EMIT_Header */
+
+   RUN_TEST(test_EMIT_Header_CTable);
+   RUN_TEST(test_EMIT_Header_CPPMaskWithPrefix);
+   RUN_TEST(test_EMIT_Header_CParity);
+   RUN_TEST(test_EMIT_Header_UnwritableStream);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   memset( Header, 0, sizeof(Header) );
+}
+
+void tearDown(void)
+{
+}
+
+/* Helpers */
+
+/**
+ * @brief Generate a header into Header, by way of a temporary file.
+ */
+static enum LIN_PID_Result_E Emit( enum EMIT_Language_E language, enum EMIT_Layout_E layout, const char * prefix )
+{
+   struct EMIT_Options_S options = { language, layout, prefix };
+   FILE * fp = tmpfile();
+   TEST_ASSERT_NOT_NULL( fp );
+   enum LIN_PID_Result_E result = EMIT_Header(fp, &options);
+   rewind(fp);
+   size_t len = fread(Header, 1, sizeof(Header) - 1u, fp);
+   TEST_ASSERT_TRUE( len < (sizeof(Header) - 1u) );
+   Header[len] = '\0';
+   (void)fclose(fp);
+   return result;
+}
+
+/* EMIT_ParityTable / EMIT_ParityMasks */
+/******************************************************************************/
+
+void test_EMIT_ParityTable_ExtractsEveryPID(void)
+{
+   uint8_t table[EMIT_PARITY_TABLE_LEN];
+   EMIT_ParityTable(table);
+
+   // The same extraction the generated pid() does
+   for ( uint8_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      uint8_t pid = (uint8_t)( id | ((((unsigned int)(table[id >> 2]) >> ((id & 3u) << 1)) & 3u) << 6) );
+      TEST_ASSERT_EQUAL_HEX8( ComputePID(id), pid );
+   }
+   TEST_ASSERT_EQUAL_HEX8( 0x1E, table[0] );    // 0x80, 0xC1, 0x42, 0x03: P1:P0 of 10, 11, 01, 00 from bit 0 up
+}
+
+void test_EMIT_ParityMasks_ExtractEveryPID(void)
+{
+   uint64_t p0;
+   uint64_t p1;
+   EMIT_ParityMasks(&p0, &p1);
+
+   for ( uint8_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      uint8_t pid = (uint8_t)( id | (((p0 >> id) & 1u) << 6) | (((p1 >> id) & 1u) << 7) );
+      TEST_ASSERT_EQUAL_HEX8( ComputePID(id), pid );
+   }
+}
+
+/* EMIT_LayoutFromName / EMIT_PrefixIsValid */
+/******************************************************************************/
+
+void test_EMIT_LayoutFromName_AndCosts(void)
+{
+   enum EMIT_Layout_E layout = NUM_OF_EMIT_LAYOUTS;
+   TEST_ASSERT_TRUE( EMIT_LayoutFromName("parity", &layout) );
+   TEST_ASSERT_EQUAL_INT( EMIT_LAYOUT_PARITY, layout );
+   TEST_ASSERT_TRUE( EMIT_LayoutFromName("mask", &layout) );
+   TEST_ASSERT_EQUAL_INT( EMIT_LAYOUT_MASK, layout );
+   TEST_ASSERT_FALSE( EMIT_LayoutFromName("Table", &layout) );
+   TEST_ASSERT_EQUAL_INT( EMIT_LAYOUT_MASK, layout );
+
+   // The smaller the data, the more it costs to get a PID out of it
+   const struct EMIT_Cost_S * table = EMIT_LayoutCost(EMIT_LAYOUT_TABLE);
+   const struct EMIT_Cost_S * parity = EMIT_LayoutCost(EMIT_LAYOUT_PARITY);
+   TEST_ASSERT_EQUAL_STRING( "table", table->name );
+   TEST_ASSERT_EQUAL_size_t( 64, table->data_bytes );
+   TEST_ASSERT_EQUAL_size_t( 16, parity->data_bytes );
+   TEST_ASSERT_TRUE( parity->cycles_8bit > table->cycles_8bit );
+   TEST_ASSERT_TRUE( EMIT_LayoutCost(EMIT_LAYOUT_MASK)->cycles_8bit > parity->cycles_8bit );
+}
+
+void test_EMIT_PrefixIsValid(void)
+{
+   TEST_ASSERT_TRUE( EMIT_PrefixIsValid("lin") );
+   TEST_ASSERT_TRUE( EMIT_PrefixIsValid("_Ecu2") );
+   TEST_ASSERT_FALSE( EMIT_PrefixIsValid(NULL) );
+   TEST_ASSERT_FALSE( EMIT_PrefixIsValid("") );
+   TEST_ASSERT_FALSE( EMIT_PrefixIsValid("2ecu") );
+   TEST_ASSERT_FALSE( EMIT_PrefixIsValid("ecu-lin") );
+   TEST_ASSERT_FALSE( EMIT_PrefixIsValid("a_prefix_that_is_far_too_long_to_use") );
+}
+
+/* EMIT_Header */
+/******************************************************************************/
+
+void test_EMIT_Header_CTable(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, Emit(EMIT_C, EMIT_LAYOUT_TABLE, EMIT_DEFAULT_PREFIX) );
+
+   TEST_ASSERT_NOT_NULL( strstr(Header, "lin_pid --emit-c --layout table --prefix lin\n") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "#ifndef LIN_PID_LUT_H\n#define LIN_PID_LUT_H\n") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "static const uint8_t lin_pid_table[64] =\n{\n   0x80, 0xC1, 0x42, 0x03,") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "   0x78, 0x39, 0xBA, 0xFB, 0x3C, 0x7D, 0xFE, 0xBF\n};") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "static inline uint8_t lin_pid( uint8_t id )\n{\n   return lin_pid_table[id & 0x3Fu];") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "static inline uint8_t lin_checksum( uint8_t protected_id,") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, " 64 B") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "   <- this one") );
+   TEST_ASSERT_TRUE( strstr(Header, "   <- this one") < strstr(Header, " * parity") );
+   TEST_ASSERT_NULL( strstr(Header, "static_assert") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "#endif // LIN_PID_LUT_H\n") );
+}
+
+void test_EMIT_Header_CPPMaskWithPrefix(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, Emit(EMIT_CPP, EMIT_LAYOUT_MASK, "ecu") );
+
+   uint64_t p0;
+   uint64_t p1;
+   EMIT_ParityMasks(&p0, &p1);
+   char expected[128];
+   (void)snprintf(expected, sizeof(expected), "constexpr std::uint64_t pid_p0_mask = 0x%016llXull;\n", (unsigned long long)p0);
+   TEST_ASSERT_NOT_NULL( strstr(Header, expected) );
+   (void)snprintf(expected, sizeof(expected), "constexpr std::uint64_t pid_p1_mask = 0x%016llXull;\n", (unsigned long long)p1);
+   TEST_ASSERT_NOT_NULL( strstr(Header, expected) );
+
+   TEST_ASSERT_NOT_NULL( strstr(Header, "#ifndef ECU_PID_LUT_HPP\n") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "#include <cstdint>\n\nnamespace ecu\n{\n") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "constexpr std::uint8_t pid( std::uint8_t id ) noexcept\n") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "static_cast<std::uint8_t>( id | (((pid_p0_mask >> id) & 1u) << 6)") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "static_assert( pid(0x00) == 0x80 &&") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "pid(0x3C) == 0x3C &&") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "} // namespace ecu\n\n#endif // ECU_PID_LUT_HPP\n") );
+   TEST_ASSERT_NULL( strstr(Header, "ecu_") );
+}
+
+void test_EMIT_Header_CParity(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, Emit(EMIT_C, EMIT_LAYOUT_PARITY, "lin") );
+
+   TEST_ASSERT_NOT_NULL( strstr(Header, "static const uint8_t lin_pid_parity[16] =\n{\n   0x1E,") );
+   TEST_ASSERT_NOT_NULL( strstr(Header, "(unsigned int)(lin_pid_parity[id >> 2]) >> ((id & 3u) << 1)") );
+   TEST_ASSERT_NULL( strstr(Header, "lin_pid_table") );
+}
+
+void test_EMIT_Header_UnwritableStream(void)
+{
+   // Opened for reading only, so every write fails
+   FILE * fp = fopen("test/sample.ldf", "r");
+   TEST_ASSERT_NOT_NULL( fp );
+   struct EMIT_Options_S options = { EMIT_C, EMIT_LAYOUT_TABLE, EMIT_DEFAULT_PREFIX };
+   TEST_ASSERT_EQUAL_INT( EmitFileUnwritable, EMIT_Header(fp, &options) );
+   (void)fclose(fp);
+}
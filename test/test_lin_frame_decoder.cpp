@@ -0,0 +1,330 @@
+/*!
+ * @file    test_lin_frame_decoder.cpp
+ * @brief   Test file for the policy-templated C++ frame decoder
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_frame_decoder.hpp"
+
+/* Datatypes */
+
+struct VectorSink
+{
+   std::vector<CAP_Frame_S> * frames;
+
+   void operator()( const CAP_Frame_S & frame ) const
+   {
+      frames->push_back(frame);
+   }
+};
+
+/* Local Variables */
+static std::vector<CAP_Frame_S> Frames;
+static std::vector<CAP_Frame_S> OtherFrames;
+static std::vector<uint8_t> Stream;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static void AppendFrame( uint8_t id, const std::vector<uint8_t> & data, bool enhanced );
+static void CollectFrame( const CAP_Frame_S * frame, void * ctx );
+static void BuildNoisyStream( size_t num_frames );
+template <typename ChecksumPolicy, typename ResyncPolicy>
+static void CheckRuntimeMatchesStatic( LOG_Checksum_E model, bool strict );
+
+/* FrameDecoder */
+void test_FrameDecoder_DecodesFrames(void);
+void test_FrameDecoder_ChecksumPolicies(void);
+void test_FrameDecoder_StrictDropsBadPIDsLenientFlagsThem(void);
+void test_FrameDecoder_BreakInsideResponse(void);
+void test_FrameDecoder_ResyncAndFlush(void);
+void test_FrameDecoder_RuntimeMatchesStatic(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* FrameDecoder */
+
+   RUN_TEST(test_FrameDecoder_DecodesFrames);
+   RUN_TEST(test_FrameDecoder_ChecksumPolicies);
+   RUN_TEST(test_FrameDecoder_StrictDropsBadPIDsLenientFlagsThem);
+   RUN_TEST(test_FrameDecoder_BreakInsideResponse);
+   RUN_TEST(test_FrameDecoder_ResyncAndFlush);
+   RUN_TEST(test_FrameDecoder_RuntimeMatchesStatic);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   Frames.clear();
+   OtherFrames.clear();
+   Stream.clear();
+}
+
+void tearDown(void)
+{
+}
+
+/* Helpers */
+
+/**
+ * @brief Append a break, sync, PID, the data and its checksum to Stream.
+ */
+static void AppendFrame( uint8_t id, const std::vector<uint8_t> & data, bool enhanced )
+{
+   uint8_t pid = lin_pid::compute_pid(id);
+   Stream.push_back(0x00);
+   Stream.push_back(lin_pid::frame_sync_byte);
+   Stream.push_back(pid);
+   Stream.insert(Stream.end(), data.begin(), data.end());
+   Stream.push_back(lin_pid::checksum(pid, data.data(), data.size(), enhanced));
+}
+
+static void CollectFrame( const CAP_Frame_S * frame, void * ctx )
+{
+   static_cast<std::vector<CAP_Frame_S> *>(ctx)->push_back(*frame);
+}
+
+/**
+ * @brief Fill Stream with frames of every ID and length, some with a bad PID,
+ *        a bad checksum, a missing sync byte, or a 0x00 0x55 in their data.
+ */
+static void BuildNoisyStream( size_t num_frames )
+{
+   uint32_t x = 0x2545F491u;
+   for ( size_t f = 0; f < num_frames; f++ )
+   {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      uint8_t id = static_cast<uint8_t>( x & MAX_ID_ALLOWED );
+      std::vector<uint8_t> data( (x >> 6) % (CAP_MAX_FRAME_LEN + 1u) );
+      for ( size_t i = 0; i < data.size(); i++ )
+      {
+         data[i] = static_cast<uint8_t>( x >> (i * 3u) );
+      }
+      if ( (data.size() >= 3u) && (0u == ((x >> 20) & 7u)) )
+      {
+         data[0] = 0x00;
+         data[1] = lin_pid::frame_sync_byte;
+      }
+      AppendFrame( id, data, lin_pid::Lin2Checksum::enhanced(id) );
+
+      size_t header = Stream.size() - data.size() - 3u;
+      switch ( (x >> 24) & 0xFu )
+      {
+         case 0:
+            Stream[header + 2u] ^= 0x80;     // Bad parity
+            break;
+         case 1:
+            Stream.back() ^= 0x01;           // Bad checksum
+            break;
+         case 2:
+            Stream[header + 1u] = 0x54;      // Bad sync
+            break;
+         default:
+            break;
+      }
+   }
+}
+
+/**
+ * @brief A RuntimeFrameDecoder set up as model and strict must hand out
+ *        exactly what the static decoder does.
+ */
+template <typename ChecksumPolicy, typename ResyncPolicy>
+static void CheckRuntimeMatchesStatic( LOG_Checksum_E model, bool strict )
+{
+   Frames.clear();
+   OtherFrames.clear();
+
+   lin_pid::FrameDecoder<ChecksumPolicy, ResyncPolicy, VectorSink> fixed( VectorSink { &Frames } );
+   lin_pid::RuntimeFrameDecoder runtime( lin_pid::FunctionSink { CollectFrame, &OtherFrames },
+                                         lin_pid::RuntimeChecksum { model },
+                                         lin_pid::RuntimeResync { strict } );
+   // In uneven pieces, as reads come
+   for ( size_t i = 0; i < Stream.size(); i += 37u )
+   {
+      size_t len = ( (Stream.size() - i) < 37u ) ? (Stream.size() - i) : 37u;
+      fixed.feed( Stream.data() + i, len );
+      runtime.feed( Stream.data() + i, len );
+   }
+   fixed.flush();
+   runtime.flush();
+
+   TEST_ASSERT_EQUAL_size_t( Frames.size(), OtherFrames.size() );
+   TEST_ASSERT_EQUAL_INT( 0, memcmp(Frames.data(), OtherFrames.data(), Frames.size() * sizeof(CAP_Frame_S)) );
+   TEST_ASSERT_EQUAL_INT( 0, memcmp(&fixed.stats(), &runtime.stats(), sizeof(lin_pid::DecoderStats)) );
+   TEST_ASSERT_EQUAL_UINT64( Frames.size(), fixed.stats().frames );
+}
+
+/* FrameDecoder */
+/******************************************************************************/
+
+void test_FrameDecoder_DecodesFrames(void)
+{
+   AppendFrame( 0x10, { 0x01, 0x02, 0xFF }, true );
+   AppendFrame( 0x3C, { 0x00, 0x55, 0x12, 0x22, 0x33, 0x44, 0x55, 0x66 }, false );   // Classic, and a 0x00 0x55 of data
+   AppendFrame( 0x22, {}, true );
+   AppendFrame( 0x05, { 0xAA }, true );
+   Stream.back() ^= 0xFF;
+
+   lin_pid::FrameDecoder<lin_pid::Lin2Checksum, lin_pid::StrictResync, VectorSink> decoder( VectorSink { &Frames } );
+   decoder.feed( Stream.data(), Stream.size() );
+   TEST_ASSERT_EQUAL_size_t( 3, Frames.size() );    // The last one is still open
+   decoder.flush();
+   TEST_ASSERT_EQUAL_size_t( 4, Frames.size() );
+
+   TEST_ASSERT_EQUAL_HEX8( 0x10, Frames[0].id );
+   TEST_ASSERT_EQUAL_HEX8( 0x50, Frames[0].pid );
+   TEST_ASSERT_EQUAL_UINT8( 3, Frames[0].length );
+   TEST_ASSERT_EQUAL_HEX8( 0xFF, Frames[0].data[2] );
+   TEST_ASSERT_EQUAL_HEX8( 0, Frames[0].flags );
+
+   TEST_ASSERT_EQUAL_HEX8( 0x3C, Frames[1].id );
+   TEST_ASSERT_EQUAL_UINT8( 8, Frames[1].length );
+   TEST_ASSERT_EQUAL_HEX8( 0x55, Frames[1].data[1] );
+   TEST_ASSERT_EQUAL_HEX8( 0, Frames[1].flags );
+
+   // Just a checksum byte: no data at all
+   TEST_ASSERT_EQUAL_UINT8( 0, Frames[2].length );
+   TEST_ASSERT_EQUAL_HEX8( 0, Frames[2].flags );
+
+   TEST_ASSERT_EQUAL_HEX8( CAP_FLAG_CHECKSUM_ERROR, Frames[3].flags );
+
+   const lin_pid::DecoderStats & stats = decoder.stats();
+   TEST_ASSERT_EQUAL_UINT64( Stream.size(), stats.bytes );
+   TEST_ASSERT_EQUAL_UINT64( 4, stats.breaks );
+   TEST_ASSERT_EQUAL_UINT64( 4, stats.frames );
+   TEST_ASSERT_EQUAL_UINT64( 1, stats.checksum_errors );
+   TEST_ASSERT_EQUAL_UINT64( 0, stats.stray_bytes );
+}
+
+void test_FrameDecoder_ChecksumPolicies(void)
+{
+   AppendFrame( 0x3C, { 0x10, 0x20 }, true );    // Enhanced where LIN 2 wants classic
+   AppendFrame( 0x01, { 0x10, 0x20 }, false );
+
+   lin_pid::FrameDecoder<lin_pid::EnhancedChecksum, lin_pid::StrictResync, VectorSink> enhanced( VectorSink { &Frames } );
+   enhanced.feed( Stream.data(), Stream.size() );
+   enhanced.flush();
+   lin_pid::FrameDecoder<lin_pid::ClassicChecksum, lin_pid::StrictResync, VectorSink> classic( VectorSink { &OtherFrames } );
+   classic.feed( Stream.data(), Stream.size() );
+   classic.flush();
+
+   TEST_ASSERT_EQUAL_size_t( 2, Frames.size() );
+   TEST_ASSERT_EQUAL_HEX8( 0, Frames[0].flags );
+   TEST_ASSERT_EQUAL_HEX8( CAP_FLAG_CHECKSUM_ERROR, Frames[1].flags );
+   TEST_ASSERT_EQUAL_HEX8( CAP_FLAG_CHECKSUM_ERROR, OtherFrames[0].flags );
+   TEST_ASSERT_EQUAL_HEX8( 0, OtherFrames[1].flags );
+
+   // Same sum as the C side uses
+   const uint8_t data[] = { 0x4A, 0x55, 0x93, 0xE5 };
+   TEST_ASSERT_EQUAL_HEX8( 0xE6, lin_pid::checksum(0x00, data, sizeof(data), false) );
+   static_assert( lin_pid::Lin2Checksum::enhanced(0x3B) && !lin_pid::Lin2Checksum::enhanced(0x3C) );
+}
+
+void test_FrameDecoder_StrictDropsBadPIDsLenientFlagsThem(void)
+{
+   AppendFrame( 0x11, { 0x01 }, true );
+   Stream[2] ^= 0x40;
+   AppendFrame( 0x12, { 0x02 }, true );
+
+   lin_pid::FrameDecoder<lin_pid::Lin2Checksum, lin_pid::StrictResync, VectorSink> strict( VectorSink { &Frames } );
+   strict.feed( Stream.data(), Stream.size() );
+   strict.flush();
+   TEST_ASSERT_EQUAL_size_t( 1, Frames.size() );
+   TEST_ASSERT_EQUAL_HEX8( 0x12, Frames[0].id );
+   TEST_ASSERT_EQUAL_UINT64( 1, strict.stats().pid_errors );
+   TEST_ASSERT_EQUAL_UINT64( 2, strict.stats().stray_bytes );    // The bad frame's response
+
+   lin_pid::FrameDecoder<lin_pid::Lin2Checksum, lin_pid::LenientResync, VectorSink> lenient( VectorSink { &OtherFrames } );
+   lenient.feed( Stream.data(), Stream.size() );
+   lenient.flush();
+   TEST_ASSERT_EQUAL_size_t( 2, OtherFrames.size() );
+   TEST_ASSERT_EQUAL_HEX8( 0x11, OtherFrames[0].id );
+   TEST_ASSERT_EQUAL_HEX8( CAP_FLAG_PID_ERROR | CAP_FLAG_CHECKSUM_ERROR, OtherFrames[0].flags );
+   TEST_ASSERT_EQUAL_UINT64( 1, lenient.stats().pid_errors );
+   TEST_ASSERT_EQUAL_UINT64( 0, lenient.stats().stray_bytes );
+}
+
+void test_FrameDecoder_BreakInsideResponse(void)
+{
+   // A response cut short by the next header, and one with 0x00 0x55 and a
+   // bad PID in its data
+   Stream = { 0x00, 0x55, lin_pid::compute_pid(0x20), 0x01, 0x02 };
+   AppendFrame( 0x21, { 0x00, 0x55, 0x21, 0x03 }, true );
+
+   lin_pid::FrameDecoder<lin_pid::Lin2Checksum, lin_pid::StrictResync, VectorSink> strict( VectorSink { &Frames } );
+   strict.feed( Stream.data(), Stream.size() );
+   strict.flush();
+   TEST_ASSERT_EQUAL_size_t( 2, Frames.size() );
+   TEST_ASSERT_EQUAL_HEX8( 0x20, Frames[0].id );
+   TEST_ASSERT_EQUAL_UINT8( 1, Frames[0].length );
+   TEST_ASSERT_EQUAL_HEX8( 0x02, Frames[0].checksum );
+   TEST_ASSERT_EQUAL_UINT8( 4, Frames[1].length );
+   TEST_ASSERT_EQUAL_HEX8( 0, Frames[1].flags );
+
+   // Taking any PID, the data's 0x00 0x55 0x21 is a header too
+   lin_pid::FrameDecoder<lin_pid::Lin2Checksum, lin_pid::LenientResync, VectorSink> lenient( VectorSink { &OtherFrames } );
+   lenient.feed( Stream.data(), Stream.size() );
+   lenient.flush();
+   TEST_ASSERT_EQUAL_size_t( 3, OtherFrames.size() );
+   TEST_ASSERT_EQUAL_UINT8( 0, OtherFrames[1].length );
+   TEST_ASSERT_EQUAL_HEX8( 0x21, OtherFrames[2].pid );
+   TEST_ASSERT_EQUAL_HEX8( CAP_FLAG_PID_ERROR | CAP_FLAG_CHECKSUM_ERROR, OtherFrames[2].flags );
+}
+
+void test_FrameDecoder_ResyncAndFlush(void)
+{
+   AppendFrame( 0x01, { 0x01, 0x02 }, true );
+   lin_pid::FrameDecoder<lin_pid::Lin2Checksum, lin_pid::StrictResync, VectorSink> decoder( VectorSink { &Frames } );
+
+   // Bytes lost mid-response: the frame never comes out, and what follows is stray
+   decoder.feed( Stream.data(), 4 );
+   decoder.resync();
+   decoder.feed( Stream.data() + 4, Stream.size() - 4u );
+   decoder.flush();
+   TEST_ASSERT_EQUAL_size_t( 0, Frames.size() );
+   TEST_ASSERT_EQUAL_UINT64( 2, decoder.stats().stray_bytes );
+
+   // A flush with nothing open hands out nothing
+   decoder.flush();
+   TEST_ASSERT_EQUAL_size_t( 0, Frames.size() );
+   decoder.feed( std::span<const uint8_t>(Stream) );
+   decoder.flush();
+   TEST_ASSERT_EQUAL_size_t( 1, Frames.size() );
+   TEST_ASSERT_EQUAL_HEX8( 0, Frames[0].flags );
+}
+
+void test_FrameDecoder_RuntimeMatchesStatic(void)
+{
+   BuildNoisyStream( 20000 );
+
+   CheckRuntimeMatchesStatic<lin_pid::Lin2Checksum, lin_pid::StrictResync>( LOG_CHECKSUM_LIN2, true );
+   TEST_ASSERT_TRUE( Frames.size() > 15000u );
+   CheckRuntimeMatchesStatic<lin_pid::Lin2Checksum, lin_pid::LenientResync>( LOG_CHECKSUM_LIN2, false );
+   CheckRuntimeMatchesStatic<lin_pid::ClassicChecksum, lin_pid::StrictResync>( LOG_CHECKSUM_CLASSIC, true );
+   CheckRuntimeMatchesStatic<lin_pid::ClassicChecksum, lin_pid::LenientResync>( LOG_CHECKSUM_CLASSIC, false );
+}
@@ -0,0 +1,257 @@
+/*!
+ * @file    test_lin_hist.c
+ * @brief   Test file for the log-linear latency histograms
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include "unity.h"
+#include "lin_hist.h"
+
+/* Local Macro Definitions */
+#define NUM_OF_RECORDS           200000u
+
+/* Datatypes */
+
+struct Recorder_S
+{
+   pthread_t thread;
+   struct Hist_S hist;
+   bool done;
+};
+
+/* Local Variables */
+static struct Recorder_S Recorder;
+static struct Hist_S Hist;
+static struct Hist_S Other;
+static struct Hist_S Snapshot;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static void * RecordThread( void * arg );
+
+/* Hist_Bucket */
+void test_Hist_Bucket_SmallValuesExact(void);
+void test_Hist_Bucket_BoundsAndRelativeError(void);
+void test_Hist_Bucket_ClampsPastMaxBits(void);
+
+/* Hist_Percentile */
+void test_Hist_Percentile_BucketHighEdgeWithinMinMax(void);
+
+/* Hist_Merge */
+void test_Hist_Merge_SumsHistograms(void);
+void test_Hist_Merge_SnapshotsWhileRecording(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* Hist_Bucket */
+
+   RUN_TEST(test_Hist_Bucket_SmallValuesExact);
+   RUN_TEST(test_Hist_Bucket_BoundsAndRelativeError);
+   RUN_TEST(test_Hist_Bucket_ClampsPastMaxBits);
+
+   /* Hist_Percentile */
+
+   RUN_TEST(test_Hist_Percentile_BucketHighEdgeWithinMinMax);
+
+   /* Hist_Merge */
+
+   RUN_TEST(test_Hist_Merge_SumsHistograms);
+   RUN_TEST(test_Hist_Merge_SnapshotsWhileRecording);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   Hist_Init(&Hist);
+   Hist_Init(&Other);
+   Hist_Init(&Snapshot);
+}
+
+void tearDown(void)
+{
+}
+
+/* Helpers */
+
+static void * RecordThread( void * arg )
+{
+   struct Recorder_S * recorder = (struct Recorder_S *)arg;
+   for ( uint64_t i = 1; i <= NUM_OF_RECORDS; i++ )
+   {
+      Hist_Record(&recorder->hist, (i * 7919u) % 1000000u);
+   }
+   __atomic_store_n( &recorder->done, true, __ATOMIC_RELEASE );
+   return NULL;
+}
+
+/* Hist_Bucket */
+/******************************************************************************/
+
+void test_Hist_Bucket_SmallValuesExact(void)
+{
+   for ( uint64_t v = 0; v < 64u; v++ )
+   {
+      TEST_ASSERT_EQUAL_size_t( (size_t)v, Hist_Bucket(v) );
+      TEST_ASSERT_EQUAL_UINT64( v, Hist_BucketLow((size_t)v) );
+      TEST_ASSERT_EQUAL_UINT64( v, Hist_BucketHigh((size_t)v) );
+   }
+   // From 64 to 127 still one value per bucket, then two
+   TEST_ASSERT_EQUAL_size_t( 64, Hist_Bucket(64) );
+   TEST_ASSERT_EQUAL_size_t( 127, Hist_Bucket(127) );
+   TEST_ASSERT_EQUAL_size_t( 128, Hist_Bucket(128) );
+   TEST_ASSERT_EQUAL_size_t( 128, Hist_Bucket(129) );
+   TEST_ASSERT_EQUAL_UINT64( 129, Hist_BucketHigh(128) );
+}
+
+void test_Hist_Bucket_BoundsAndRelativeError(void)
+{
+   // Buckets tile the values with no gaps, each no wider than 1/64 of its start
+   for ( size_t bucket = 0; bucket < (HIST_NUM_BUCKETS - 1u); bucket++ )
+   {
+      uint64_t low = Hist_BucketLow(bucket);
+      uint64_t high = Hist_BucketHigh(bucket);
+      TEST_ASSERT_EQUAL_size_t( bucket, Hist_Bucket(low) );
+      TEST_ASSERT_EQUAL_size_t( bucket, Hist_Bucket(high) );
+      TEST_ASSERT_EQUAL_UINT64( high + 1u, Hist_BucketLow(bucket + 1u) );
+      TEST_ASSERT_TRUE( (high - low) * 64u <= low );
+   }
+
+   // And so does any value in between
+   for ( uint64_t v = 1000; v < (UINT64_C(1) << 40); v = v * 3u + 17u )
+   {
+      size_t bucket = Hist_Bucket(v);
+      TEST_ASSERT_TRUE( (Hist_BucketLow(bucket) <= v) && (v <= Hist_BucketHigh(bucket)) );
+   }
+}
+
+void test_Hist_Bucket_ClampsPastMaxBits(void)
+{
+   const uint64_t top = UINT64_C(1) << HIST_MAX_BITS;
+   TEST_ASSERT_EQUAL_size_t( HIST_NUM_BUCKETS - 2u, Hist_Bucket(top - 1u) );
+   TEST_ASSERT_EQUAL_size_t( HIST_NUM_BUCKETS - 1u, Hist_Bucket(top) );
+   TEST_ASSERT_EQUAL_size_t( HIST_NUM_BUCKETS - 1u, Hist_Bucket(UINT64_MAX) );
+   TEST_ASSERT_EQUAL_UINT64( top, Hist_BucketLow(HIST_NUM_BUCKETS - 1u) );
+   TEST_ASSERT_EQUAL_UINT64( UINT64_MAX, Hist_BucketHigh(HIST_NUM_BUCKETS - 1u) );
+
+   // The exact max is kept, so the top percentile still reads true
+   Hist_Record(&Hist, top * 3u);
+   TEST_ASSERT_EQUAL_UINT64( 1, Hist.buckets[HIST_NUM_BUCKETS - 1u] );
+   TEST_ASSERT_EQUAL_UINT64( top * 3u, Hist_Percentile(&Hist, 100.0) );
+}
+
+/* Hist_Percentile */
+/******************************************************************************/
+
+void test_Hist_Percentile_BucketHighEdgeWithinMinMax(void)
+{
+   TEST_ASSERT_EQUAL_UINT64( 0, Hist_Percentile(&Hist, 50.0) );
+   TEST_ASSERT_DOUBLE_WITHIN( 0.0, 0.0, Hist_Mean(&Hist) );
+
+   // 90 fast answers, 9 slower, and one very late
+   for ( unsigned int i = 0; i < 90u; i++ )
+   {
+      Hist_Record(&Hist, 1500);
+   }
+   for ( unsigned int i = 0; i < 9u; i++ )
+   {
+      Hist_Record(&Hist, 40000);
+   }
+   Hist_Record(&Hist, 3000000);
+
+   TEST_ASSERT_EQUAL_UINT64( 100, Hist.count );
+   TEST_ASSERT_EQUAL_UINT64( 1500, Hist.min );
+   TEST_ASSERT_EQUAL_UINT64( 3000000, Hist.max );
+   TEST_ASSERT_DOUBLE_WITHIN( 0.001, (90.0 * 1500.0 + 9.0 * 40000.0 + 3000000.0) / 100.0, Hist_Mean(&Hist) );
+
+   // 1500 shares [1488, 1503]; 40000 shares [39936, 40447]
+   TEST_ASSERT_EQUAL_UINT64( 1503, Hist_Percentile(&Hist, 50.0) );
+   TEST_ASSERT_EQUAL_UINT64( 1503, Hist_Percentile(&Hist, 90.0) );
+   TEST_ASSERT_EQUAL_UINT64( 40447, Hist_Percentile(&Hist, 99.0) );
+   TEST_ASSERT_EQUAL_UINT64( 3000000, Hist_Percentile(&Hist, 99.9) );
+   TEST_ASSERT_EQUAL_UINT64( 3000000, Hist_Percentile(&Hist, 100.0) );
+   TEST_ASSERT_EQUAL_UINT64( 90, Hist_CountBetween(&Hist, 1024, 2048) );
+   TEST_ASSERT_EQUAL_UINT64( 9, Hist_CountBetween(&Hist, 32768, 65536) );
+
+   // Held within the max: 1000 shares [1000, 1007]
+   Hist_Init(&Other);
+   Hist_Record(&Other, 1000);
+   TEST_ASSERT_EQUAL_UINT64( 1000, Hist_Percentile(&Other, 50.0) );
+}
+
+/* Hist_Merge */
+/******************************************************************************/
+
+void test_Hist_Merge_SumsHistograms(void)
+{
+   Hist_Record(&Hist, 10);
+   Hist_Record(&Hist, 5000);
+   Hist_Record(&Other, 3);
+   Hist_Record(&Other, 5000);
+   Hist_Record(&Other, 900000);
+
+   Hist_Merge(&Snapshot, &Hist);
+   Hist_Merge(&Snapshot, &Other);
+   TEST_ASSERT_EQUAL_UINT64( 5, Snapshot.count );
+   TEST_ASSERT_EQUAL_UINT64( 3, Snapshot.min );
+   TEST_ASSERT_EQUAL_UINT64( 900000, Snapshot.max );
+   TEST_ASSERT_EQUAL_UINT64( 10u + 5000u + 3u + 5000u + 900000u, Snapshot.sum );
+   TEST_ASSERT_EQUAL_UINT64( 2, Snapshot.buckets[Hist_Bucket(5000)] );
+   TEST_ASSERT_EQUAL_UINT64( 5055, Hist_Percentile(&Snapshot, 60.0) );   // [4992, 5055]
+
+   // An empty histogram leaves the min and max alone
+   Hist_Init(&Hist);
+   Hist_Merge(&Snapshot, &Hist);
+   TEST_ASSERT_EQUAL_UINT64( 5, Snapshot.count );
+   TEST_ASSERT_EQUAL_UINT64( 3, Snapshot.min );
+}
+
+void test_Hist_Merge_SnapshotsWhileRecording(void)
+{
+   Hist_Init(&Recorder.hist);
+   Recorder.done = false;
+   TEST_ASSERT_EQUAL_INT( 0, pthread_create(&Recorder.thread, NULL, RecordThread, &Recorder) );
+
+   // Snapshots never go backwards and always agree with their own buckets
+   uint64_t last = 0;
+   while ( !__atomic_load_n(&Recorder.done, __ATOMIC_ACQUIRE) )
+   {
+      Hist_Init(&Snapshot);
+      Hist_Merge(&Snapshot, &Recorder.hist);
+      TEST_ASSERT_TRUE( Snapshot.count >= last );
+      TEST_ASSERT_TRUE( Snapshot.count <= NUM_OF_RECORDS );
+      TEST_ASSERT_EQUAL_UINT64( Snapshot.count, Hist_CountBetween(&Snapshot, 0, UINT64_MAX) );
+      last = Snapshot.count;
+   }
+   TEST_ASSERT_EQUAL_INT( 0, pthread_join(Recorder.thread, NULL) );
+
+   Hist_Init(&Snapshot);
+   Hist_Merge(&Snapshot, &Recorder.hist);
+   TEST_ASSERT_EQUAL_UINT64( NUM_OF_RECORDS, Snapshot.count );
+   TEST_ASSERT_EQUAL_UINT64( NUM_OF_RECORDS, Recorder.hist.count );
+   TEST_ASSERT_EQUAL_UINT64( Recorder.hist.sum, Snapshot.sum );
+}
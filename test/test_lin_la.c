@@ -0,0 +1,483 @@
+/*!
+ * @file    test_lin_la.c
+ * @brief   Test file for frame recovery from logic-analyzer sample dumps
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_log.h"
+#include "lin_cap.h"
+#include "lin_la.h"
+
+/* Local Macro Definitions */
+#define SAMPLE_RATE_HZ           1000000u
+#define MAX_DUMP_LEN             (64u * 1024u)
+#define MAX_RECORDED             32u
+#define DUMP_PATH                "test_lin_la.bin"
+
+/* Datatypes */
+
+struct Recorder_S
+{
+   size_t num_frames;
+   struct CAP_Frame_S frames[MAX_RECORDED];
+};
+
+/* Local Variables */
+static uint8_t Dump[MAX_DUMP_LEN];
+static uint64_t DumpSamples;        // Written so far
+static double DumpTime;             // Where the transmitter is, in (fractional) samples
+static double SamplesPerBit;
+static struct Recorder_S Recorder;
+static struct LA_Options_S Options;
+static struct LA_Stats_S Stats;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static void StartDump( uint32_t baud, uint64_t offset );
+static void SetBaud( double baud );
+static void Level( unsigned int level, double bits );
+static void UARTByte( uint8_t value, bool stop );
+static void Header( uint8_t pid );
+static void Frame( uint8_t id, const uint8_t * data, uint8_t length, bool enhanced );
+static size_t DumpLen( void );
+static void RecordFrame( const struct CAP_Frame_S * frame, void * ctx );
+
+/* LA_Decode */
+void test_LA_Decode_RecoversFrames(void);
+void test_LA_Decode_FlagsPIDAndChecksumErrors(void);
+void test_LA_Decode_SkipsBadSyncAndStrayBytes(void);
+void test_LA_Decode_AnyWordAlignment(void);
+void test_LA_Decode_RejectsLowSampleRate(void);
+void test_LA_Decode_DetectsBaud(void);
+void test_LA_Decode_TracksDrift(void);
+void test_LA_Decode_RejectsOutlierSync(void);
+
+/* LA_DecodeFile */
+void test_LA_DecodeFile_MatchesMemory(void);
+void test_LA_DecodeFile_EmptyFile(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* LA_Decode */
+
+   RUN_TEST(test_LA_Decode_RecoversFrames);
+   RUN_TEST(test_LA_Decode_FlagsPIDAndChecksumErrors);
+   RUN_TEST(test_LA_Decode_SkipsBadSyncAndStrayBytes);
+   RUN_TEST(test_LA_Decode_AnyWordAlignment);
+   RUN_TEST(test_LA_Decode_RejectsLowSampleRate);
+   RUN_TEST(test_LA_Decode_DetectsBaud);
+   RUN_TEST(test_LA_Decode_TracksDrift);
+   RUN_TEST(test_LA_Decode_RejectsOutlierSync);
+
+   /* LA_DecodeFile */
+
+   RUN_TEST(test_LA_DecodeFile_MatchesMemory);
+   RUN_TEST(test_LA_DecodeFile_EmptyFile);
+
+   (void)remove(DUMP_PATH);
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   memset( &Recorder, 0, sizeof(Recorder) );
+   memset( &Stats, 0, sizeof(Stats) );
+   memset( &Options, 0, sizeof(Options) );
+   Options.sample_rate_hz = SAMPLE_RATE_HZ;
+   Options.baud = LA_DEFAULT_BAUD;
+   Options.checksum = LOG_CHECKSUM_LIN2;
+   Options.on_frame = RecordFrame;
+   Options.ctx = &Recorder;
+   StartDump(LA_DEFAULT_BAUD, 0);
+}
+
+void tearDown(void)
+{
+}
+
+/* Helpers */
+
+/**
+ * @brief Start over with an idle line of offset samples.
+ */
+static void StartDump( uint32_t baud, uint64_t offset )
+{
+   memset( Dump, 0xFF, sizeof(Dump) );
+   SetBaud(baud);
+   DumpSamples = offset;
+   DumpTime = (double)offset;
+}
+
+/**
+ * @brief Change the transmitter's speed from here on, as a drifting clock would.
+ */
+static void SetBaud( double baud )
+{
+   SamplesPerBit = (double)SAMPLE_RATE_HZ / baud;
+}
+
+/**
+ * @brief Drive the line for a (possibly fractional) number of bit times.
+ *        Edges land where a real transmitter's would, rounding to the
+ *        nearest sample, so they drift across sample and word boundaries.
+ */
+static void Level( unsigned int level, double bits )
+{
+   DumpTime += bits * SamplesPerBit;
+   uint64_t end = (uint64_t)(DumpTime + 0.5);
+   TEST_ASSERT_TRUE( end <= (8u * (uint64_t)MAX_DUMP_LEN) );
+   for ( ; DumpSamples < end; DumpSamples++ )
+   {
+      if ( 0u == level )
+      {
+         Dump[DumpSamples / 8u] &= (uint8_t)~(1u << (DumpSamples % 8u));
+      }
+   }
+}
+
+static void UARTByte( uint8_t value, bool stop )
+{
+   Level(0, 1.0);
+   for ( unsigned int bit = 0; bit < 8u; bit++ )
+   {
+      Level( (unsigned int)(value >> bit) & 1u, 1.0 );
+   }
+   Level( stop ? 1u : 0u, 1.0 );
+}
+
+static void Header( uint8_t pid )
+{
+   Level(1, 2.0);
+   Level(0, 13.0);
+   Level(1, 1.0);
+   UARTByte(LA_SYNC_BYTE, true);
+   Level(1, 0.5);
+   UARTByte(pid, true);
+}
+
+static void Frame( uint8_t id, const uint8_t * data, uint8_t length, bool enhanced )
+{
+   uint8_t pid = ReferencePID(id);
+   Header(pid);
+   Level(1, 1.25);      // Response space
+   for ( uint8_t i = 0; i < length; i++ )
+   {
+      UARTByte(data[i], true);
+      Level(1, (i % 2u) ? 0.0 : 0.75);
+   }
+   UARTByte( LOG_Checksum(pid, data, length, enhanced), true );
+}
+
+static size_t DumpLen( void )
+{
+   // A few idle bytes past the last stop bit
+   return (size_t)(DumpSamples / 8u) + 4u;
+}
+
+static void RecordFrame( const struct CAP_Frame_S * frame, void * ctx )
+{
+   struct Recorder_S * recorder = (struct Recorder_S *)ctx;
+   TEST_ASSERT_TRUE( recorder->num_frames < MAX_RECORDED );
+   recorder->frames[recorder->num_frames++] = *frame;
+}
+
+/* LA_Decode */
+/******************************************************************************/
+
+void test_LA_Decode_RecoversFrames(void)
+{
+   const uint8_t data[8] = { 0x00, 0xFF, 0x55, 0xAA, 0x01, 0x80, 0x7E, 0x3C };
+   Frame(0x22, data, 8, true);
+   uint64_t second_break = DumpSamples + (uint64_t)(2.0 * SamplesPerBit + 0.5);
+   Frame(0x3C, data, 8, false);   // Diagnostic: classic checksum
+   Header( ReferencePID(0x10) );  // Nobody answered
+   Frame(0x01, &data[4], 2, true);
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, DumpLen(), &Options, &Stats) );
+   TEST_ASSERT_EQUAL_size_t( 4, Recorder.num_frames );
+   TEST_ASSERT_EQUAL_UINT64( 4, Stats.breaks );
+   TEST_ASSERT_EQUAL_UINT64( 4, Stats.frames );
+   TEST_ASSERT_EQUAL_UINT64( 0, Stats.sync_errors + Stats.framing_errors + Stats.pid_errors +
+                                Stats.checksum_errors + Stats.stray_bytes );
+
+   const struct CAP_Frame_S * frame = &Recorder.frames[0];
+   TEST_ASSERT_EQUAL_UINT8( 0x22, frame->id );
+   TEST_ASSERT_EQUAL_UINT8( ReferencePID(0x22), frame->pid );
+   TEST_ASSERT_EQUAL_UINT8( 8, frame->length );
+   TEST_ASSERT_EQUAL_MEMORY( data, frame->data, 8 );
+   TEST_ASSERT_EQUAL_UINT8( LOG_Checksum(frame->pid, data, 8, true), frame->checksum );
+   TEST_ASSERT_EQUAL_UINT8( 0, frame->flags );
+   // The break starts 2 bit times in: 104 us at 19200 baud
+   TEST_ASSERT_EQUAL_UINT64( 104, frame->timestamp_us );
+
+   TEST_ASSERT_EQUAL_UINT8( 0x3C, Recorder.frames[1].id );
+   TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[1].flags );
+   TEST_ASSERT_EQUAL_UINT64( second_break, Recorder.frames[1].timestamp_us );   // 1 sample per us
+   TEST_ASSERT_EQUAL_UINT8( 0x10, Recorder.frames[2].id );
+   TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[2].length );
+   TEST_ASSERT_EQUAL_UINT8( 2, Recorder.frames[3].length );
+   TEST_ASSERT_EQUAL_MEMORY( &data[4], Recorder.frames[3].data, 2 );
+
+   // The same bus at another baud rate decodes the same way
+   memset( &Recorder, 0, sizeof(Recorder) );
+   StartDump(9600, 0);
+   Frame(0x22, data, 8, true);
+   Options.baud = 9600;
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, DumpLen(), &Options, &Stats) );
+   TEST_ASSERT_EQUAL_size_t( 1, Recorder.num_frames );
+   TEST_ASSERT_EQUAL_MEMORY( data, Recorder.frames[0].data, 8 );
+}
+
+void test_LA_Decode_FlagsPIDAndChecksumErrors(void)
+{
+   const uint8_t data[4] = { 0x10, 0x20, 0x30, 0x40 };
+
+   // Parity bits flipped
+   uint8_t bad_pid = (uint8_t)(ReferencePID(0x05) ^ 0xC0u);
+   Header(bad_pid);
+   Level(1, 1.0);
+   UARTByte( LOG_Checksum(bad_pid, data, 0, true), true );
+
+   // Wrong checksum, then a framing error in an otherwise good response
+   Frame(0x06, data, 3, false);
+   Header( ReferencePID(0x07) );
+   Level(1, 1.0);
+   UARTByte(0x10, false);
+   Level(1, 2.0);
+   UARTByte( LOG_Checksum(ReferencePID(0x07), data, 1, true), true );
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, DumpLen(), &Options, &Stats) );
+   TEST_ASSERT_EQUAL_size_t( 3, Recorder.num_frames );
+   TEST_ASSERT_EQUAL_UINT8( 0x05, Recorder.frames[0].id );
+   TEST_ASSERT_EQUAL_UINT8( bad_pid, Recorder.frames[0].pid );
+   TEST_ASSERT_EQUAL_UINT8( CAP_FLAG_PID_ERROR, Recorder.frames[0].flags );
+   TEST_ASSERT_EQUAL_UINT8( CAP_FLAG_CHECKSUM_ERROR, Recorder.frames[1].flags );
+   TEST_ASSERT_EQUAL_UINT8( CAP_FLAG_CHECKSUM_ERROR, Recorder.frames[2].flags );
+   TEST_ASSERT_EQUAL_UINT64( 1, Stats.pid_errors );
+   TEST_ASSERT_EQUAL_UINT64( 2, Stats.checksum_errors );
+   TEST_ASSERT_EQUAL_UINT64( 1, Stats.framing_errors );
+
+   // Classic everywhere, for LIN 1.x
+   memset( &Recorder, 0, sizeof(Recorder) );
+   StartDump(LA_DEFAULT_BAUD, 0);
+   Frame(0x06, data, 3, false);
+   Options.checksum = LOG_CHECKSUM_CLASSIC;
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, DumpLen(), &Options, &Stats) );
+   TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[0].flags );
+}
+
+void test_LA_Decode_SkipsBadSyncAndStrayBytes(void)
+{
+   const uint8_t data[2] = { 0x01, 0x02 };
+
+   // Noise before any break, then a break with the wrong sync
+   UARTByte(0x33, true);
+   Level(1, 3.0);
+   Level(0, 14.0);
+   Level(1, 1.0);
+   UARTByte(0x54, true);
+   UARTByte( ReferencePID(0x01), true );
+
+   // A good frame with more response than any frame can have
+   Frame(0x02, data, 2, true);
+   for ( unsigned int i = 0; i < LA_MAX_RESPONSE_LEN; i++ )
+   {
+      UARTByte(0xEE, true);
+   }
+
+   // Cut off mid-PID
+   Level(1, 2.0);
+   Level(0, 13.0);
+   Level(1, 1.0);
+   UARTByte(LA_SYNC_BYTE, true);
+   Level(0, 3.0);
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, (size_t)(DumpSamples / 8u), &Options, &Stats) );
+   TEST_ASSERT_EQUAL_size_t( 1, Recorder.num_frames );
+   TEST_ASSERT_EQUAL_UINT8( 0x02, Recorder.frames[0].id );
+   TEST_ASSERT_EQUAL_UINT8( CAP_FLAG_CHECKSUM_ERROR, Recorder.frames[0].flags );   // 0xEE... isn't a checksum
+   TEST_ASSERT_EQUAL_UINT64( 3, Stats.breaks );
+   TEST_ASSERT_EQUAL_UINT64( 1, Stats.sync_errors );
+   TEST_ASSERT_EQUAL_UINT64( 1u + 1u + 3u, Stats.stray_bytes );   // Noise, PID after bad sync, response overrun
+}
+
+void test_LA_Decode_AnyWordAlignment(void)
+{
+   const uint8_t data[8] = { 0xF0, 0x0F, 0x00, 0xFF, 0x81, 0x18, 0xC3, 0x3C };
+
+   // Shift the whole bus across every position within a word
+   for ( uint64_t offset = 0; offset < 64u; offset++ )
+   {
+      memset( &Recorder, 0, sizeof(Recorder) );
+      StartDump(LA_DEFAULT_BAUD, offset);
+      Frame(0x2A, data, 8, true);
+      Frame(0x15, data, 4, true);
+
+      TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, DumpLen(), &Options, &Stats) );
+      TEST_ASSERT_EQUAL_size_t( 2, Recorder.num_frames );
+      TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[0].flags | Recorder.frames[1].flags );
+      TEST_ASSERT_EQUAL_MEMORY( data, Recorder.frames[0].data, 8 );
+      TEST_ASSERT_EQUAL_UINT8( 4, Recorder.frames[1].length );
+      TEST_ASSERT_EQUAL_UINT64( offset + 104u, Recorder.frames[0].timestamp_us );
+   }
+}
+
+void test_LA_Decode_RejectsLowSampleRate(void)
+{
+   Options.sample_rate_hz = (uint64_t)LA_DEFAULT_BAUD * LA_MIN_SAMPLES_PER_BIT - 1u;
+   TEST_ASSERT_EQUAL_INT( SampleRateTooLow, LA_Decode(Dump, 16, &Options, &Stats) );
+   Options.sample_rate_hz++;
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, 16, &Options, &Stats) );
+   TEST_ASSERT_EQUAL_UINT64( 128, Stats.samples );
+   TEST_ASSERT_EQUAL_UINT64( 0, Stats.breaks );
+
+   // Nothing to check up front when the rate is to be detected
+   Options.baud = 0;
+   Options.sample_rate_hz = 1u;
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, 16, &Options, &Stats) );
+   TEST_ASSERT_DOUBLE_WITHIN( 0.5, 0.0, Stats.baud );
+}
+
+void test_LA_Decode_DetectsBaud(void)
+{
+   const uint32_t bauds[] = { 19200, 10417, 9600, 2400 };
+   const uint8_t data[8] = { 0x00, 0xFF, 0x55, 0xAA, 0x01, 0x80, 0x7E, 0x3C };
+
+   for ( size_t i = 0; i < (sizeof(bauds) / sizeof(bauds[0])); i++ )
+   {
+      memset( &Recorder, 0, sizeof(Recorder) );
+      StartDump(bauds[i], 0);
+      UARTByte(0x33, true);   // Noise before the first break is skipped
+      for ( uint8_t id = 0; id < 3u; id++ )
+      {
+         Frame(id, data, 8, true);
+      }
+      Header( ReferencePID(0x10) );
+
+      Options.baud = 0;
+      TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, DumpLen(), &Options, &Stats) );
+      TEST_ASSERT_EQUAL_size_t( 4, Recorder.num_frames );
+      TEST_ASSERT_EQUAL_UINT64( 4, Stats.breaks );
+      TEST_ASSERT_EQUAL_UINT64( 0, Stats.sync_errors + Stats.framing_errors + Stats.pid_errors +
+                                   Stats.checksum_errors + Stats.stray_bytes + Stats.sync_outliers );
+      TEST_ASSERT_EQUAL_MEMORY( data, Recorder.frames[2].data, 8 );
+      TEST_ASSERT_EQUAL_UINT8( 0x10, Recorder.frames[3].id );
+      TEST_ASSERT_DOUBLE_WITHIN( 0.005 * bauds[i], (double)bauds[i], Stats.baud );
+   }
+}
+
+void test_LA_Decode_TracksDrift(void)
+{
+   const uint8_t data[8] = { 0xF0, 0x0F, 0x00, 0xFF, 0x81, 0x18, 0xC3, 0x3C };
+
+   // The master's clock runs 8% fast by the end: far enough that reading the
+   // last frames at the starting rate puts the later bit centres in the
+   // wrong bits
+   const unsigned int num_frames = MAX_RECORDED;
+   for ( unsigned int i = 0; i < num_frames; i++ )
+   {
+      SetBaud( LA_DEFAULT_BAUD * (1.0 + (0.08 * i) / (num_frames - 1u)) );
+      Frame( (uint8_t)i, data, 8, true );
+   }
+
+   Options.baud = 0;
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, DumpLen(), &Options, &Stats) );
+   TEST_ASSERT_EQUAL_size_t( num_frames, Recorder.num_frames );
+   TEST_ASSERT_EQUAL_UINT64( 0, Stats.framing_errors + Stats.pid_errors + Stats.checksum_errors +
+                                Stats.sync_outliers );
+   // The estimate lags a ramp, but never by more than it accepts
+   TEST_ASSERT_DOUBLE_WITHIN( BAUD_TOLERANCE * 1.08 * LA_DEFAULT_BAUD, 1.08 * LA_DEFAULT_BAUD, Stats.baud );
+   TEST_ASSERT_TRUE( Stats.baud > (1.04 * LA_DEFAULT_BAUD) );
+
+   memset( &Recorder, 0, sizeof(Recorder) );
+   Options.baud = LA_DEFAULT_BAUD;
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, DumpLen(), &Options, &Stats) );
+   TEST_ASSERT_TRUE( (Stats.framing_errors + Stats.pid_errors + Stats.checksum_errors) > 0u );
+}
+
+void test_LA_Decode_RejectsOutlierSync(void)
+{
+   const uint8_t data[4] = { 0x10, 0x20, 0x30, 0x40 };
+
+   for ( uint8_t id = 0; id < 12u; id++ )
+   {
+      // One frame, once the estimate is seeded, from a node nowhere near the bus's rate
+      SetBaud( (9u == id) ? (0.8 * LA_DEFAULT_BAUD) : LA_DEFAULT_BAUD );
+      Frame(id, data, 4, true);
+   }
+
+   Options.baud = 0;
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, DumpLen(), &Options, &Stats) );
+   // That frame is read at the estimate, so its sync field doesn't come out
+   // as 0x55 and it's dropped, as a slave would drop it
+   TEST_ASSERT_EQUAL_size_t( 11, Recorder.num_frames );
+   TEST_ASSERT_EQUAL_UINT64( 12, Stats.breaks );
+   TEST_ASSERT_EQUAL_UINT64( 1, Stats.sync_errors );
+   TEST_ASSERT_EQUAL_UINT64( 1, Stats.sync_outliers );
+   TEST_ASSERT_EQUAL_UINT8( 10, Recorder.frames[9].id );
+   TEST_ASSERT_DOUBLE_WITHIN( 0.005 * LA_DEFAULT_BAUD, (double)LA_DEFAULT_BAUD, Stats.baud );
+   TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[11].flags );
+}
+
+/* LA_DecodeFile */
+/******************************************************************************/
+
+void test_LA_DecodeFile_MatchesMemory(void)
+{
+   const uint8_t data[5] = { 1, 2, 3, 4, 5 };
+   for ( uint8_t id = 0; id < 20u; id++ )
+   {
+      Frame(id, data, (uint8_t)((id % 5u) + 1u), true);
+   }
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_Decode(Dump, DumpLen(), &Options, &Stats) );
+   struct Recorder_S expected = Recorder;
+   TEST_ASSERT_EQUAL_size_t( 20, expected.num_frames );
+
+   FILE * fp = fopen(DUMP_PATH, "wb");
+   TEST_ASSERT_NOT_NULL(fp);
+   TEST_ASSERT_EQUAL_size_t( DumpLen(), fwrite(Dump, 1, DumpLen(), fp) );
+   fclose(fp);
+
+   memset( &Recorder, 0, sizeof(Recorder) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_DecodeFile(DUMP_PATH, &Options, &Stats) );
+   TEST_ASSERT_EQUAL_MEMORY( &expected, &Recorder, sizeof(expected) );
+   TEST_ASSERT_EQUAL_UINT64( 8u * DumpLen(), Stats.samples );
+
+   TEST_ASSERT_EQUAL_INT( SampleFileUnreadable, LA_DecodeFile("no/such/dump.bin", &Options, &Stats) );
+}
+
+void test_LA_DecodeFile_EmptyFile(void)
+{
+   FILE * fp = fopen(DUMP_PATH, "wb");
+   TEST_ASSERT_NOT_NULL(fp);
+   fclose(fp);
+
+   Stats.samples = 1;
+   TEST_ASSERT_EQUAL_INT( GoodResult, LA_DecodeFile(DUMP_PATH, &Options, &Stats) );
+   TEST_ASSERT_EQUAL_size_t( 0, Recorder.num_frames );
+   TEST_ASSERT_EQUAL_UINT64( 0, Stats.samples );
+   TEST_ASSERT_EQUAL_UINT64( 0, Stats.breaks );
+}
@@ -0,0 +1,638 @@
+/*!
+ * @file    test_lin_ldf.c
+ * @brief   Test file for the LDF parser and frame database
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_ldf.h"
+
+/* Local Macro Definitions */
+#define SAMPLE_LDF_PATH    "test/sample.ldf"
+#define PARSE_STR(str, db) LDF_Parse( (str), strlen(str), (db) )
+
+/* Local Variables */
+static struct LDF_Database_S DB;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* LDF_Load */
+
+void test_LDF_Load_SampleFile_Succeeds(void);
+void test_LDF_Load_MissingFile_Fails(void);
+
+/* Header Statements */
+
+void test_LDF_Parse_Empty_IsEmptyDatabase(void);
+void test_LDF_Parse_Speed_ConvertedToBitsPerSec(void);
+void test_LDF_Parse_ProtocolVersion(void);
+
+/* Nodes */
+
+void test_LDF_Parse_Nodes_MasterAndSlaves(void);
+void test_LDF_Parse_Nodes_Duplicate_Fails(void);
+
+/* Signals */
+
+void test_LDF_Parse_Signals_SizeInitAndPublisher(void);
+void test_LDF_Parse_Signals_ByteArrayInitValue(void);
+void test_LDF_Parse_Signals_DiagnosticWithoutPublisher(void);
+void test_LDF_Parse_Signals_UndefinedPublisher_Fails(void);
+void test_LDF_Parse_Signals_SizeOutOfRange_Fails(void);
+
+/* Frames */
+
+void test_LDF_Parse_Frames_IDsAndPrecomputedPIDs(void);
+void test_LDF_Parse_Frames_IndexedByID(void);
+void test_LDF_Parse_Frames_SignalLayout(void);
+void test_LDF_Parse_Frames_DiagnosticFrames(void);
+void test_LDF_Parse_Frames_DefaultLengthFromID(void);
+void test_LDF_Parse_Frames_DuplicateID_Fails(void);
+void test_LDF_Parse_Frames_IDOutOfRange_Fails(void);
+void test_LDF_Parse_Frames_SignalPastEndOfFrame_Fails(void);
+void test_LDF_Parse_Frames_UndefinedSignal_Fails(void);
+void test_LDF_Parse_Frames_SignalListedTwice_Fails(void);
+
+/* Schedule Tables */
+
+void test_LDF_Parse_ScheduleTables_Entries(void);
+void test_LDF_Parse_ScheduleTables_CommandsMapToMasterReq(void);
+void test_LDF_Parse_ScheduleTables_MissingDelay_Fails(void);
+
+/* Signal Encodings */
+void test_LDF_Parse_Encodings_PhysicalScaling(void);
+void test_LDF_Parse_Encodings_LogicalOnly_IsUnscaled(void);
+void test_LDF_Parse_Encodings_UndefinedEncoding_Fails(void);
+void test_LDF_Parse_Encodings_UndefinedSignal_Fails(void);
+
+/* Lexing */
+
+void test_LDF_Parse_CommentsAreIgnored(void);
+void test_LDF_Parse_SyntaxError_ReportsLine(void);
+void test_LDF_Parse_UnterminatedBlock_Fails(void);
+void test_LDF_Parse_UnterminatedString_Fails(void);
+
+/* Lookups */
+
+void test_LDF_FrameByName(void);
+void test_LDF_FrameByID_OutOfRange(void);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* LDF_Load */
+
+   RUN_TEST(test_LDF_Load_SampleFile_Succeeds);
+   RUN_TEST(test_LDF_Load_MissingFile_Fails);
+
+   /* Header Statements */
+
+   RUN_TEST(test_LDF_Parse_Empty_IsEmptyDatabase);
+   RUN_TEST(test_LDF_Parse_Speed_ConvertedToBitsPerSec);
+   RUN_TEST(test_LDF_Parse_ProtocolVersion);
+
+   /* Nodes */
+
+   RUN_TEST(test_LDF_Parse_Nodes_MasterAndSlaves);
+   RUN_TEST(test_LDF_Parse_Nodes_Duplicate_Fails);
+
+   /* Signals */
+
+   RUN_TEST(test_LDF_Parse_Signals_SizeInitAndPublisher);
+   RUN_TEST(test_LDF_Parse_Signals_ByteArrayInitValue);
+   RUN_TEST(test_LDF_Parse_Signals_DiagnosticWithoutPublisher);
+   RUN_TEST(test_LDF_Parse_Signals_UndefinedPublisher_Fails);
+   RUN_TEST(test_LDF_Parse_Signals_SizeOutOfRange_Fails);
+
+   /* Frames */
+
+   RUN_TEST(test_LDF_Parse_Frames_IDsAndPrecomputedPIDs);
+   RUN_TEST(test_LDF_Parse_Frames_IndexedByID);
+   RUN_TEST(test_LDF_Parse_Frames_SignalLayout);
+   RUN_TEST(test_LDF_Parse_Frames_DiagnosticFrames);
+   RUN_TEST(test_LDF_Parse_Frames_DefaultLengthFromID);
+   RUN_TEST(test_LDF_Parse_Frames_DuplicateID_Fails);
+   RUN_TEST(test_LDF_Parse_Frames_IDOutOfRange_Fails);
+   RUN_TEST(test_LDF_Parse_Frames_SignalPastEndOfFrame_Fails);
+   RUN_TEST(test_LDF_Parse_Frames_UndefinedSignal_Fails);
+   RUN_TEST(test_LDF_Parse_Frames_SignalListedTwice_Fails);
+
+   /* Schedule Tables */
+
+   RUN_TEST(test_LDF_Parse_ScheduleTables_Entries);
+   RUN_TEST(test_LDF_Parse_ScheduleTables_CommandsMapToMasterReq);
+   RUN_TEST(test_LDF_Parse_ScheduleTables_MissingDelay_Fails);
+
+   /* Signal Encodings */
+
+   RUN_TEST(test_LDF_Parse_Encodings_PhysicalScaling);
+   RUN_TEST(test_LDF_Parse_Encodings_LogicalOnly_IsUnscaled);
+   RUN_TEST(test_LDF_Parse_Encodings_UndefinedEncoding_Fails);
+   RUN_TEST(test_LDF_Parse_Encodings_UndefinedSignal_Fails);
+
+   /* Lexing */
+
+   RUN_TEST(test_LDF_Parse_CommentsAreIgnored);
+   RUN_TEST(test_LDF_Parse_SyntaxError_ReportsLine);
+   RUN_TEST(test_LDF_Parse_UnterminatedBlock_Fails);
+   RUN_TEST(test_LDF_Parse_UnterminatedString_Fails);
+
+   /* Lookups */
+
+   RUN_TEST(test_LDF_FrameByName);
+   RUN_TEST(test_LDF_FrameByID_OutOfRange);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset( &DB, 0, sizeof(DB) );
+}
+void tearDown(void)
+{
+   LDF_Free(&DB);
+}
+
+/* LDF_Load */
+
+/******************************************************************************/
+
+void test_LDF_Load_SampleFile_Succeeds(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+
+   TEST_ASSERT_EQUAL_size_t( 3, DB.num_nodes );
+   TEST_ASSERT_EQUAL_size_t( 9, DB.num_signals );
+   TEST_ASSERT_EQUAL_size_t( 8, DB.num_frames );
+   TEST_ASSERT_EQUAL_size_t( 3, DB.num_schedule_tables );
+   TEST_ASSERT_EQUAL_UINT32( 19200, DB.baud_rate );
+
+   const struct LDF_Frame_S * frame = LDF_FrameByName(&DB, "MotorStatus");
+   TEST_ASSERT_NOT_NULL( frame );
+   TEST_ASSERT_EQUAL_HEX8( 0x27, frame->id );
+   TEST_ASSERT_EQUAL_HEX8( 0xE7, frame->pid );
+}
+
+void test_LDF_Load_MissingFile_Fails(void)
+{
+   TEST_ASSERT_EQUAL_INT( LDFFileUnreadable, LDF_Load("test/no_such_file.ldf", &DB) );
+   TEST_ASSERT_EQUAL_size_t( 0, DB.num_frames );
+}
+
+/* Header Statements */
+
+/******************************************************************************/
+
+void test_LDF_Parse_Empty_IsEmptyDatabase(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, PARSE_STR("", &DB) );
+   TEST_ASSERT_EQUAL_size_t( 0, DB.num_frames );
+   for ( uint8_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      TEST_ASSERT_NULL( LDF_FrameByID(&DB, id) );
+   }
+
+   LDF_Free(&DB);
+   TEST_ASSERT_EQUAL_INT( GoodResult, PARSE_STR("LIN_description_file;", &DB) );
+   TEST_ASSERT_EQUAL_UINT32( 0, DB.baud_rate );
+}
+
+void test_LDF_Parse_Speed_ConvertedToBitsPerSec(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, PARSE_STR("LIN_speed = 10.417 kbps;", &DB) );
+   TEST_ASSERT_EQUAL_UINT32( 10417, DB.baud_rate );
+
+   LDF_Free(&DB);
+   TEST_ASSERT_EQUAL_INT( GoodResult, PARSE_STR("LIN_speed = 9.6kbps;", &DB) );
+   TEST_ASSERT_EQUAL_UINT32( 9600, DB.baud_rate );
+}
+
+void test_LDF_Parse_ProtocolVersion(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, PARSE_STR("LIN_protocol_version = \"2.2\";", &DB) );
+   TEST_ASSERT_EQUAL_STRING( "2.2", DB.protocol_version );
+}
+
+/* Nodes */
+
+/******************************************************************************/
+
+void test_LDF_Parse_Nodes_MasterAndSlaves(void)
+{
+   const char * ldf =
+      "Nodes {\n"
+      "   Master: Gateway, 10 ms, 0.5 ms, 48 bits, 40 %;\n"
+      "   Slaves: DoorL, DoorR, Seat;\n"
+      "}\n";
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, PARSE_STR(ldf, &DB) );
+   TEST_ASSERT_EQUAL_size_t( 4, DB.num_nodes );
+
+   TEST_ASSERT_EQUAL_STRING( "Gateway", DB.nodes[0].name );
+   TEST_ASSERT_TRUE( DB.nodes[0].is_master );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 10.0, DB.nodes[0].time_base_ms );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 0.5, DB.nodes[0].jitter_ms );
+
+   TEST_ASSERT_EQUAL_STRING( "DoorL", DB.nodes[1].name );
+   TEST_ASSERT_EQUAL_STRING( "DoorR", DB.nodes[2].name );
+   TEST_ASSERT_EQUAL_STRING( "Seat",  DB.nodes[3].name );
+   TEST_ASSERT_FALSE( DB.nodes[3].is_master );
+}
+
+void test_LDF_Parse_Nodes_Duplicate_Fails(void)
+{
+   TEST_ASSERT_EQUAL_INT( LDFDuplicateDefinition,
+                          PARSE_STR("Nodes { Master: A, 5 ms, 0 ms; Slaves: B, A; }", &DB) );
+}
+
+/* Signals */
+
+/******************************************************************************/
+
+void test_LDF_Parse_Signals_SizeInitAndPublisher(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+
+   TEST_ASSERT_EQUAL_STRING( "IgnitionKeyPos", DB.signals[5].name );
+   TEST_ASSERT_EQUAL_UINT8( 3, DB.signals[5].size_bits );
+   TEST_ASSERT_EQUAL_UINT64( 0, DB.signals[5].init_value );
+   TEST_ASSERT_EQUAL_STRING( "CEM", DB.nodes[ DB.signals[5].publisher ].name );
+
+   TEST_ASSERT_EQUAL_STRING( "RightIntLightsSwitch", DB.signals[1].name );
+   TEST_ASSERT_EQUAL_STRING( "RSM", DB.nodes[ DB.signals[1].publisher ].name );
+}
+
+void test_LDF_Parse_Signals_ByteArrayInitValue(void)
+{
+   const char * ldf =
+      "Nodes { Master: M, 5 ms, 0 ms; }\n"
+      "Signals { Big: 64, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08}, M; }\n";
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, PARSE_STR(ldf, &DB) );
+   TEST_ASSERT_EQUAL_UINT8( 64, DB.signals[0].size_bits );
+   TEST_ASSERT_EQUAL_HEX64( 0x0807060504030201ull, DB.signals[0].init_value );
+}
+
+void test_LDF_Parse_Signals_DiagnosticWithoutPublisher(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+
+   TEST_ASSERT_EQUAL_STRING( "MasterReqB0", DB.signals[7].name );
+   TEST_ASSERT_EQUAL_UINT16( LDF_NO_INDEX, DB.signals[7].publisher );
+}
+
+void test_LDF_Parse_Signals_UndefinedPublisher_Fails(void)
+{
+   const char * ldf =
+      "Nodes { Master: M, 5 ms, 0 ms; }\n"
+      "Signals { S: 8, 0, Nobody; }\n";
+
+   TEST_ASSERT_EQUAL_INT( LDFUndefinedReference, PARSE_STR(ldf, &DB) );
+   TEST_ASSERT_EQUAL_size_t( 2, DB.error_line );
+}
+
+void test_LDF_Parse_Signals_SizeOutOfRange_Fails(void)
+{
+   TEST_ASSERT_EQUAL_INT( LDFValueOutOfRange,
+                          PARSE_STR("Nodes { Master: M, 5 ms, 0 ms; } Signals { S: 65, 0, M; }", &DB) );
+   LDF_Free(&DB);
+   TEST_ASSERT_EQUAL_INT( LDFValueOutOfRange,
+                          PARSE_STR("Nodes { Master: M, 5 ms, 0 ms; } Signals { S: 0, 0, M; }", &DB) );
+}
+
+/* Frames */
+
+/******************************************************************************/
+
+void test_LDF_Parse_Frames_IDsAndPrecomputedPIDs(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+
+   for ( size_t i = 0; i < DB.num_frames; i++ )
+   {
+      TEST_ASSERT_EQUAL_HEX8( ComputePID(DB.frames[i].id), DB.frames[i].pid );
+   }
+
+   TEST_ASSERT_EQUAL_STRING( "CEM_Frm1", DB.frames[0].name );
+   TEST_ASSERT_EQUAL_HEX8( 0x01, DB.frames[0].id );
+   TEST_ASSERT_EQUAL_HEX8( 0xC1, DB.frames[0].pid );
+   TEST_ASSERT_EQUAL_UINT8( 1, DB.frames[0].length );
+   TEST_ASSERT_EQUAL_STRING( "CEM", DB.nodes[ DB.frames[0].publisher ].name );
+}
+
+void test_LDF_Parse_Frames_IndexedByID(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+
+   size_t num_indexed = 0;
+   for ( uint8_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      const struct LDF_Frame_S * frame = LDF_FrameByID(&DB, id);
+      if ( frame != NULL )
+      {
+         TEST_ASSERT_EQUAL_HEX8( id, frame->id );
+         num_indexed++;
+      }
+   }
+   TEST_ASSERT_EQUAL_size_t( DB.num_frames, num_indexed );
+
+   TEST_ASSERT_EQUAL_STRING( "LSM_Frm2", LDF_FrameByID(&DB, 0x03)->name );
+   TEST_ASSERT_NULL( LDF_FrameByID(&DB, 0x06) ); // Event-triggered frames aren't modelled
+}
+
+void test_LDF_Parse_Frames_SignalLayout(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+
+   const struct LDF_Frame_S * frame = LDF_FrameByName(&DB, "LSM_Frm2");
+   TEST_ASSERT_NOT_NULL( frame );
+   TEST_ASSERT_EQUAL_UINT16( 2, frame->num_signals );
+
+   const struct LDF_FrameSignal_S * sig = &DB.frame_signals[frame->first_signal];
+   TEST_ASSERT_EQUAL_STRING( "LSMerror", DB.signals[sig[0].signal].name );
+   TEST_ASSERT_EQUAL_UINT8( 0, sig[0].bit_offset );
+   TEST_ASSERT_EQUAL_STRING( "IgnitionKeyPos", DB.signals[sig[1].signal].name );
+   TEST_ASSERT_EQUAL_UINT8( 5, sig[1].bit_offset );
+}
+
+void test_LDF_Parse_Frames_DiagnosticFrames(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+
+   const struct LDF_Frame_S * frame = LDF_FrameByID(&DB, 0x3C);
+   TEST_ASSERT_NOT_NULL( frame );
+   TEST_ASSERT_EQUAL_STRING( "MasterReq", frame->name );
+   TEST_ASSERT_TRUE( frame->is_diagnostic );
+   TEST_ASSERT_EQUAL_UINT8( 8, frame->length );
+   TEST_ASSERT_EQUAL_HEX8( 0x3C, frame->pid );
+   TEST_ASSERT_EQUAL_UINT16( 2, frame->num_signals );
+
+   TEST_ASSERT_EQUAL_HEX8( 0x7D, LDF_FrameByName(&DB, "SlaveResp")->pid );
+}
+
+void test_LDF_Parse_Frames_DefaultLengthFromID(void)
+{
+   const char * ldf =
+      "Nodes { Master: M, 5 ms, 0 ms; }\n"
+      "Frames {\n"
+      "   Short: 0x1F, M { }\n"
+      "   Medium: 0x20, M { }\n"
+      "   Long: 0x30, M { }\n"
+      "}\n";
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, PARSE_STR(ldf, &DB) );
+   TEST_ASSERT_EQUAL_UINT8( 2, LDF_FrameByName(&DB, "Short")->length );
+   TEST_ASSERT_EQUAL_UINT8( 4, LDF_FrameByName(&DB, "Medium")->length );
+   TEST_ASSERT_EQUAL_UINT8( 8, LDF_FrameByName(&DB, "Long")->length );
+}
+
+void test_LDF_Parse_Frames_DuplicateID_Fails(void)
+{
+   const char * ldf =
+      "Nodes { Master: M, 5 ms, 0 ms; }\n"
+      "Frames {\n"
+      "   A: 0x10, M, 2 { }\n"
+      "   B: 16, M, 2 { }\n"
+      "}\n";
+
+   TEST_ASSERT_EQUAL_INT( LDFDuplicateDefinition, PARSE_STR(ldf, &DB) );
+   TEST_ASSERT_EQUAL_size_t( 4, DB.error_line );
+}
+
+void test_LDF_Parse_Frames_IDOutOfRange_Fails(void)
+{
+   TEST_ASSERT_EQUAL_INT( LDFValueOutOfRange,
+                          PARSE_STR("Nodes { Master: M, 5 ms, 0 ms; } Frames { A: 0x40, M, 2 { } }", &DB) );
+}
+
+void test_LDF_Parse_Frames_SignalPastEndOfFrame_Fails(void)
+{
+   const char * ldf =
+      "Nodes { Master: M, 5 ms, 0 ms; }\n"
+      "Signals { S: 8, 0, M; }\n"
+      "Frames { A: 0x10, M, 1 { S, 1; } }\n";
+
+   TEST_ASSERT_EQUAL_INT( LDFValueOutOfRange, PARSE_STR(ldf, &DB) );
+}
+
+void test_LDF_Parse_Frames_UndefinedSignal_Fails(void)
+{
+   const char * ldf =
+      "Nodes { Master: M, 5 ms, 0 ms; }\n"
+      "Frames { A: 0x10, M, 1 { Nope, 0; } }\n";
+
+   TEST_ASSERT_EQUAL_INT( LDFUndefinedReference, PARSE_STR(ldf, &DB) );
+}
+
+void test_LDF_Parse_Frames_SignalListedTwice_Fails(void)
+{
+   const char * ldf =
+      "Nodes { Master: M, 5 ms, 0 ms; }\n"
+      "Signals { S: 4, 0, M; }\n"
+      "Frames { A: 0x10, M, 1 { S, 0; S, 4; } }\n";
+
+   TEST_ASSERT_EQUAL_INT( LDFDuplicateDefinition, PARSE_STR(ldf, &DB) );
+}
+
+/* Schedule Tables */
+
+/******************************************************************************/
+
+void test_LDF_Parse_ScheduleTables_Entries(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+
+   const struct LDF_ScheduleTable_S * table = &DB.schedule_tables[1];
+   TEST_ASSERT_EQUAL_STRING( "Normal_Schedule", table->name );
+   TEST_ASSERT_EQUAL_UINT16( 5, table->num_entries );
+
+   const struct LDF_ScheduleEntry_S * entries = &DB.schedule_entries[table->first_entry];
+   TEST_ASSERT_EQUAL_STRING( "CEM_Frm1", DB.frames[entries[0].frame].name );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 15.0, entries[0].delay_ms );
+   TEST_ASSERT_EQUAL_STRING( "MotorStatus", DB.frames[entries[3].frame].name );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 10.0, entries[3].delay_ms );
+
+   // Event-triggered frame: timing kept, no frame to point at
+   TEST_ASSERT_EQUAL_UINT16( LDF_NO_INDEX, entries[4].frame );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 10.0, entries[4].delay_ms );
+}
+
+void test_LDF_Parse_ScheduleTables_CommandsMapToMasterReq(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+
+   const struct LDF_ScheduleTable_S * table = &DB.schedule_tables[0];
+   TEST_ASSERT_EQUAL_STRING( "Configuration_Schedule", table->name );
+   TEST_ASSERT_EQUAL_UINT16( 2, table->num_entries );
+
+   for ( uint16_t i = 0; i < table->num_entries; i++ )
+   {
+      const struct LDF_ScheduleEntry_S * entry = &DB.schedule_entries[table->first_entry + i];
+      TEST_ASSERT_EQUAL_STRING( "MasterReq", DB.frames[entry->frame].name );
+   }
+}
+
+void test_LDF_Parse_ScheduleTables_MissingDelay_Fails(void)
+{
+   const char * ldf =
+      "Nodes { Master: M, 5 ms, 0 ms; }\n"
+      "Frames { A: 0x10, M, 1 { } }\n"
+      "Schedule_tables { T { A 10 ms; } }\n";
+
+   TEST_ASSERT_EQUAL_INT( LDFSyntaxError, PARSE_STR(ldf, &DB) );
+   TEST_ASSERT_EQUAL_size_t( 3, DB.error_line );
+}
+
+/* Signal Encodings */
+
+/******************************************************************************/
+
+void test_LDF_Parse_Encodings_PhysicalScaling(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_size_t( 2, DB.num_encodings );
+
+   const struct LDF_Signal_S * signal = NULL;
+   for ( size_t i = 0; i < DB.num_signals; i++ )
+   {
+      if ( strcmp(DB.signals[i].name, "MotorSpeed") == 0 )
+      {
+         signal = &DB.signals[i];
+      }
+   }
+   TEST_ASSERT_NOT_NULL( signal );
+   TEST_ASSERT_NOT_EQUAL( LDF_NO_INDEX, signal->encoding );
+
+   const struct LDF_Encoding_S * encoding = &DB.encodings[signal->encoding];
+   TEST_ASSERT_EQUAL_STRING( "MotorSpeedEnc", encoding->name );
+   TEST_ASSERT_TRUE( encoding->has_physical );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 0.5, encoding->scale );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, -100.0, encoding->offset );
+   TEST_ASSERT_EQUAL_STRING( "rpm", encoding->unit );
+}
+
+void test_LDF_Parse_Encodings_LogicalOnly_IsUnscaled(void)
+{
+   const char * ldf =
+      "Nodes { Master: M, 5 ms, 0 ms; }\n"
+      "Signals { A: 2, 0, M; B: 8, 0, M; }\n"
+      "Signal_encoding_types {\n"
+      "   Onoff { logical_value, 0, \"off\"; logical_value, 1, \"on\"; }\n"
+      "}\n"
+      "Signal_representation { Onoff: A; }\n";
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, PARSE_STR(ldf, &DB) );
+   TEST_ASSERT_EQUAL_UINT16( 0, DB.signals[0].encoding );
+   TEST_ASSERT_EQUAL_UINT16( LDF_NO_INDEX, DB.signals[1].encoding );
+
+   const struct LDF_Encoding_S * encoding = &DB.encodings[0];
+   TEST_ASSERT_FALSE( encoding->has_physical );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 1.0, encoding->scale );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 0.0, encoding->offset );
+   TEST_ASSERT_NULL( encoding->unit );
+}
+
+void test_LDF_Parse_Encodings_UndefinedEncoding_Fails(void)
+{
+   const char * ldf =
+      "Nodes { Master: M, 5 ms, 0 ms; }\n"
+      "Signals { A: 2, 0, M; }\n"
+      "Signal_representation { Nope: A; }\n";
+
+   TEST_ASSERT_EQUAL_INT( LDFUndefinedReference, PARSE_STR(ldf, &DB) );
+   TEST_ASSERT_EQUAL_size_t( 3, DB.error_line );
+}
+
+void test_LDF_Parse_Encodings_UndefinedSignal_Fails(void)
+{
+   const char * ldf =
+      "Signal_encoding_types { E { physical_value, 0, 255, 1, 0; } }\n"
+      "Signal_representation { E: Nope; }\n";
+
+   TEST_ASSERT_EQUAL_INT( LDFUndefinedReference, PARSE_STR(ldf, &DB) );
+}
+
+/* Lexing */
+
+/******************************************************************************/
+
+void test_LDF_Parse_CommentsAreIgnored(void)
+{
+   const char * ldf =
+      "// Line comment\n"
+      "Nodes { /* block\n"
+      "   comment */ Master: M, 5 ms, 0 ms; // trailing\n"
+      "}\n"
+      "Frames { A: 0x10, M, 1 { } } /* unterminated at EOF is fine";
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, PARSE_STR(ldf, &DB) );
+   TEST_ASSERT_EQUAL_size_t( 1, DB.num_nodes );
+   TEST_ASSERT_EQUAL_size_t( 1, DB.num_frames );
+}
+
+void test_LDF_Parse_SyntaxError_ReportsLine(void)
+{
+   const char * ldf =
+      "LIN_description_file;\n"
+      "\n"
+      "Nodes {\n"
+      "   Master M, 5 ms, 0 ms;\n"
+      "}\n";
+
+   TEST_ASSERT_EQUAL_INT( LDFSyntaxError, PARSE_STR(ldf, &DB) );
+   TEST_ASSERT_EQUAL_size_t( 4, DB.error_line );
+   TEST_ASSERT_NULL( DB.frames );
+}
+
+void test_LDF_Parse_UnterminatedBlock_Fails(void)
+{
+   TEST_ASSERT_EQUAL_INT( LDFSyntaxError, PARSE_STR("Nodes { Master: M, 5 ms, 0 ms;", &DB) );
+   LDF_Free(&DB);
+   TEST_ASSERT_EQUAL_INT( LDFSyntaxError, PARSE_STR("Unknown_block { { }", &DB) );
+}
+
+void test_LDF_Parse_UnterminatedString_Fails(void)
+{
+   TEST_ASSERT_EQUAL_INT( LDFSyntaxError, PARSE_STR("Channel_name = \"DB;\n", &DB) );
+}
+
+/* Lookups */
+
+/******************************************************************************/
+
+void test_LDF_FrameByName(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+
+   TEST_ASSERT_NOT_NULL( LDF_FrameByName(&DB, "RSM_Frm1") );
+   TEST_ASSERT_EQUAL_HEX8( 0x04, LDF_FrameByName(&DB, "RSM_Frm1")->id );
+   TEST_ASSERT_NULL( LDF_FrameByName(&DB, "RSM_Frm") );
+   TEST_ASSERT_NULL( LDF_FrameByName(&DB, "rsm_frm1") );
+   TEST_ASSERT_NULL( LDF_FrameByName(&DB, "") );
+}
+
+void test_LDF_FrameByID_OutOfRange(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+
+   TEST_ASSERT_NULL( LDF_FrameByID(&DB, MAX_ID_ALLOWED + 1) );
+   TEST_ASSERT_NULL( LDF_FrameByID(&DB, 0xFF) );
+}
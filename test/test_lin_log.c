@@ -0,0 +1,601 @@
+/*!
+ * @file    test_lin_log.c
+ * @brief   Test file for the text bus log reader
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_log.h"
+
+/* Local Macro Definitions */
+#define SAMPLE_CSV_PATH          "test/sample.csv"
+#define SAMPLE_ASC_PATH          "test/sample.asc"
+#define MAX_RECORDED_ANOMALIES   4096u
+#define NUM_OF_GENERATED_LINES   40000u
+
+/* Datatypes */
+
+struct AnomalyRecord_S
+{
+   struct LOG_Anomaly_S anomalies[MAX_RECORDED_ANOMALIES];
+   size_t count;
+};
+
+/* Local Variables */
+static struct LOG_Summary_S Summary;
+static struct LOG_Summary_S OtherSummary;
+static struct AnomalyRecord_S Record;
+static struct AnomalyRecord_S OtherRecord;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static void RecordAnomaly( const struct LOG_Anomaly_S * anomaly, void * ctx );
+static enum LIN_PID_Result_E ProcessFile( const char * path,
+                                          enum LOG_Format_E format,
+                                          unsigned int num_threads,
+                                          size_t chunk_len,
+                                          struct LOG_Summary_S * summary,
+                                          struct AnomalyRecord_S * record );
+static enum LOG_Anomaly_E ProcessCSVLine( const char * line, struct LOG_Frame_S * frame, struct LOG_Anomaly_S * anomaly );
+
+/* LOG_Checksum */
+void test_LOG_Checksum_ClassicAndEnhanced(void);
+
+/* LOG_FormatFromPath */
+void test_LOG_FormatFromPath_AscExtension(void);
+
+/* LOG_ProcessLine */
+void test_LOG_ProcessLine_CSVValidFrame(void);
+void test_LOG_ProcessLine_CSVSkipsCommentsHeadersAndBlanks(void);
+void test_LOG_ProcessLine_CSVAnomalies(void);
+void test_LOG_ProcessLine_CSVBadIDCarriesParseIDError(void);
+void test_LOG_ProcessLine_DiagnosticIDsUseClassicChecksum(void);
+void test_LOG_ProcessLine_ClassicOption(void);
+void test_LOG_ProcessLine_ASCValidFrame(void);
+void test_LOG_ProcessLine_ASCSkipsBusEvents(void);
+
+/* LOG_ProcessStream */
+void test_LOG_ProcessStream_SampleCSV(void);
+void test_LOG_ProcessStream_SampleASC(void);
+void test_LOG_ProcessStream_CRLFLineEndings(void);
+void test_LOG_ProcessStream_ThreadsAndChunksDontChangeResult(void);
+
+/* LOG_Tail */
+void test_LOG_Tail_AnySplitMatchesProcessStream(void);
+void test_LOG_Tail_HoldsLineUntilItsNewline(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* LOG_Checksum */
+
+   RUN_TEST(test_LOG_Checksum_ClassicAndEnhanced);
+
+   /* LOG_FormatFromPath */
+
+   RUN_TEST(test_LOG_FormatFromPath_AscExtension);
+
+   /* LOG_ProcessLine */
+
+   RUN_TEST(test_LOG_ProcessLine_CSVValidFrame);
+   RUN_TEST(test_LOG_ProcessLine_CSVSkipsCommentsHeadersAndBlanks);
+   RUN_TEST(test_LOG_ProcessLine_CSVAnomalies);
+   RUN_TEST(test_LOG_ProcessLine_CSVBadIDCarriesParseIDError);
+   RUN_TEST(test_LOG_ProcessLine_DiagnosticIDsUseClassicChecksum);
+   RUN_TEST(test_LOG_ProcessLine_ClassicOption);
+   RUN_TEST(test_LOG_ProcessLine_ASCValidFrame);
+   RUN_TEST(test_LOG_ProcessLine_ASCSkipsBusEvents);
+
+   /* LOG_ProcessStream */
+
+   RUN_TEST(test_LOG_ProcessStream_SampleCSV);
+   RUN_TEST(test_LOG_ProcessStream_SampleASC);
+   RUN_TEST(test_LOG_ProcessStream_CRLFLineEndings);
+   RUN_TEST(test_LOG_ProcessStream_ThreadsAndChunksDontChangeResult);
+
+   /* LOG_Tail */
+
+   RUN_TEST(test_LOG_Tail_AnySplitMatchesProcessStream);
+   RUN_TEST(test_LOG_Tail_HoldsLineUntilItsNewline);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   memset( &Record, 0, sizeof(Record) );
+   memset( &OtherRecord, 0, sizeof(OtherRecord) );
+}
+
+void tearDown(void)
+{
+}
+
+/* Helpers */
+
+static void RecordAnomaly( const struct LOG_Anomaly_S * anomaly, void * ctx )
+{
+   struct AnomalyRecord_S * record = ctx;
+   if ( record->count < MAX_RECORDED_ANOMALIES )
+   {
+      record->anomalies[record->count] = *anomaly;
+   }
+   record->count++;
+}
+
+static enum LIN_PID_Result_E ProcessFile( const char * path,
+                                          enum LOG_Format_E format,
+                                          unsigned int num_threads,
+                                          size_t chunk_len,
+                                          struct LOG_Summary_S * summary,
+                                          struct AnomalyRecord_S * record )
+{
+   FILE * fp = fopen(path, "rb");
+   TEST_ASSERT_NOT_NULL(fp);
+
+   struct LOG_Options_S options = { 0 };
+   options.format = format;
+   options.checksum = LOG_CHECKSUM_LIN2;
+   options.num_threads = num_threads;
+   options.chunk_len = chunk_len;
+   options.on_anomaly = RecordAnomaly;
+   options.ctx = record;
+
+   enum LIN_PID_Result_E result = LOG_ProcessStream(fp, &options, summary);
+   fclose(fp);
+   return result;
+}
+
+static enum LOG_Anomaly_E ProcessCSVLine( const char * line, struct LOG_Frame_S * frame, struct LOG_Anomaly_S * anomaly )
+{
+   TEST_ASSERT_TRUE( LOG_ProcessLine(line, strlen(line), LOG_FORMAT_CSV, LOG_CHECKSUM_LIN2, frame, anomaly) );
+   return anomaly->kind;
+}
+
+/* LOG_Checksum */
+/******************************************************************************/
+
+void test_LOG_Checksum_ClassicAndEnhanced(void)
+{
+   const uint8_t data[] = { 0x01, 0x02, 0x03, 0x04 };
+   const uint8_t carries[] = { 0xFF, 0xFF, 0x80 };
+
+   TEST_ASSERT_EQUAL_HEX8( 0xF5, LOG_Checksum(0xE7, data, sizeof(data), false) );
+   TEST_ASSERT_EQUAL_HEX8( 0x0E, LOG_Checksum(0xE7, data, sizeof(data), true) );
+
+   // 0xE2 + 0xFF = 0x1E1 -> 0xE2, + 0xFF = 0x1E1 -> 0xE2, + 0x80 = 0x162 -> 0x63, ~ = 0x9C
+   TEST_ASSERT_EQUAL_HEX8( 0x9C, LOG_Checksum(0xE2, carries, sizeof(carries), true) );
+
+   // No data: classic is ~0, enhanced is ~PID
+   TEST_ASSERT_EQUAL_HEX8( 0xFF, LOG_Checksum(0xE7, NULL, 0, false) );
+   TEST_ASSERT_EQUAL_HEX8( 0x18, LOG_Checksum(0xE7, NULL, 0, true) );
+}
+
+/* LOG_FormatFromPath */
+/******************************************************************************/
+
+void test_LOG_FormatFromPath_AscExtension(void)
+{
+   TEST_ASSERT_EQUAL_INT( LOG_FORMAT_ASC, LOG_FormatFromPath("capture.asc") );
+   TEST_ASSERT_EQUAL_INT( LOG_FORMAT_ASC, LOG_FormatFromPath("dir.v2/CAPTURE.ASC") );
+   TEST_ASSERT_EQUAL_INT( LOG_FORMAT_CSV, LOG_FormatFromPath("capture.csv") );
+   TEST_ASSERT_EQUAL_INT( LOG_FORMAT_CSV, LOG_FormatFromPath("capture.ascii") );
+   TEST_ASSERT_EQUAL_INT( LOG_FORMAT_CSV, LOG_FormatFromPath("capture") );
+}
+
+/* LOG_ProcessLine */
+/******************************************************************************/
+
+void test_LOG_ProcessLine_CSVValidFrame(void)
+{
+   struct LOG_Frame_S frame;
+   struct LOG_Anomaly_S anomaly;
+   const uint8_t expected_data[] = { 0x01, 0x02, 0x03, 0x04 };
+
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_NONE, ProcessCSVLine("  12.5000015 , 2, 0x27 , 0xE7, 01 02 03 04 , 0E", &frame, &anomaly) );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 12.5000015, frame.timestamp );
+   TEST_ASSERT_EQUAL_UINT8( 2, frame.channel );
+   TEST_ASSERT_EQUAL_HEX8( 0x27, frame.id );
+   TEST_ASSERT_TRUE( frame.has_pid );
+   TEST_ASSERT_EQUAL_HEX8( 0xE7, frame.pid );
+   TEST_ASSERT_EQUAL_UINT8( 4, frame.length );
+   TEST_ASSERT_EQUAL_HEX8_ARRAY( expected_data, frame.data, sizeof(expected_data) );
+   TEST_ASSERT_EQUAL_HEX8( 0x0E, frame.checksum );
+
+   // The ID goes through the same parser as the command line, so any of its spellings work
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_NONE, ProcessCSVLine("1,1,27h,,01 02 03 04,0x0E", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_HEX8( 0x27, frame.id );
+   TEST_ASSERT_FALSE( frame.has_pid );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_NONE, ProcessCSVLine("1,1,39d,,01 02 03 04,0E", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_HEX8( 0x27, frame.id );
+
+   // Zero-length response
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_NONE, ProcessCSVLine("1,1,0x27,0xE7,,18", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_UINT8( 0, frame.length );
+}
+
+void test_LOG_ProcessLine_CSVSkipsCommentsHeadersAndBlanks(void)
+{
+   struct LOG_Frame_S frame;
+   struct LOG_Anomaly_S anomaly;
+   const char * skipped[] =
+   {
+      "",
+      "   ",
+      "# comment",
+      "// comment",
+      "timestamp,channel,id,pid,data,checksum"
+   };
+
+   for ( size_t i = 0; i < (sizeof(skipped) / sizeof(skipped[0])); i++ )
+   {
+      TEST_ASSERT_FALSE( LOG_ProcessLine(skipped[i], strlen(skipped[i]), LOG_FORMAT_CSV, LOG_CHECKSUM_LIN2, &frame, &anomaly) );
+      TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_NONE, anomaly.kind );
+   }
+}
+
+void test_LOG_ProcessLine_CSVAnomalies(void)
+{
+   struct LOG_Frame_S frame;
+   struct LOG_Anomaly_S anomaly;
+
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_PID_MISMATCH, ProcessCSVLine("1,1,0x27,0xE8,01 02 03 04,0E", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_HEX8( 0xE7, anomaly.expected );
+   TEST_ASSERT_EQUAL_HEX8( 0xE8, anomaly.frame.pid );
+
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_CHECKSUM, ProcessCSVLine("1,1,0x27,0xE7,01 02 03 04,0F", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_HEX8( 0x0E, anomaly.expected );
+   TEST_ASSERT_EQUAL_HEX8( 0x0F, anomaly.frame.checksum );
+
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_LENGTH, ProcessCSVLine("1,1,0x27,0xE7,00 01 02 03 04 05 06 07 08,00", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_HEX8( 0x27, anomaly.frame.id );
+   TEST_ASSERT_EQUAL_UINT8( LOG_MAX_FRAME_LEN, anomaly.expected );
+
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_SYNTAX, ProcessCSVLine("1,1,0x27,0xE7,01 02 03 04", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_SYNTAX, ProcessCSVLine("1,1,0x27,0xE7,01 02 03 04,0E,extra", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_SYNTAX, ProcessCSVLine("1,1,0x27,0xE7,01 0G 03 04,0E", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_SYNTAX, ProcessCSVLine("1.2.3,1,0x27,0xE7,01 02 03 04,0E", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_SYNTAX, ProcessCSVLine("1,256,0x27,0xE7,01 02 03 04,0E", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_SYNTAX, ProcessCSVLine("1,1,,0xE7,01 02 03 04,0E", &frame, &anomaly) );
+}
+
+void test_LOG_ProcessLine_CSVBadIDCarriesParseIDError(void)
+{
+   struct LOG_Frame_S frame;
+   struct LOG_Anomaly_S anomaly;
+
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_BAD_ID, ProcessCSVLine("1,1,0x40,,00,FF", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_INT( ID_OOR, anomaly.id_error );
+
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_BAD_ID, ProcessCSVLine("1,1,0x2G,,00,FF", &frame, &anomaly) );
+   TEST_ASSERT_NOT_EQUAL( GoodResult, anomaly.id_error );
+
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_BAD_ID, ProcessCSVLine("1,1,0x0000000000000027,,00,FF", &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_INT( TooManyDigitsEntered, anomaly.id_error );
+}
+
+void test_LOG_ProcessLine_DiagnosticIDsUseClassicChecksum(void)
+{
+   struct LOG_Frame_S frame;
+   struct LOG_Anomaly_S anomaly;
+
+   // Master request: classic over 01..08 is 0xDB
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_NONE, ProcessCSVLine("1,1,0x3C,0x3C,01 02 03 04 05 06 07 08,DB", &frame, &anomaly) );
+
+   // The enhanced checksum over the same bytes is wrong for 0x3C
+   uint8_t enhanced = LOG_Checksum(0x3C, frame.data, frame.length, true);
+   char line[64];
+   snprintf( line, sizeof(line), "1,1,0x3C,0x3C,01 02 03 04 05 06 07 08,%02X", (unsigned int)enhanced );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_CHECKSUM, ProcessCSVLine(line, &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_HEX8( 0xDB, anomaly.expected );
+}
+
+void test_LOG_ProcessLine_ClassicOption(void)
+{
+   struct LOG_Frame_S frame;
+   struct LOG_Anomaly_S anomaly;
+   const char * classic_line = "1,1,0x27,0xE7,01 02 03 04,F5";
+   const char * enhanced_line = "1,1,0x27,0xE7,01 02 03 04,0E";
+
+   TEST_ASSERT_TRUE( LOG_ProcessLine(classic_line, strlen(classic_line), LOG_FORMAT_CSV, LOG_CHECKSUM_CLASSIC, &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_NONE, anomaly.kind );
+
+   TEST_ASSERT_TRUE( LOG_ProcessLine(enhanced_line, strlen(enhanced_line), LOG_FORMAT_CSV, LOG_CHECKSUM_CLASSIC, &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_CHECKSUM, anomaly.kind );
+   TEST_ASSERT_EQUAL_HEX8( 0xF5, anomaly.expected );
+}
+
+void test_LOG_ProcessLine_ASCValidFrame(void)
+{
+   struct LOG_Frame_S frame;
+   struct LOG_Anomaly_S anomaly;
+   const char * line = "   0.010000 Li1 27 Rx 4 01 02 03 04 checksum = 0E header time = 40, full time = 90";
+   const uint8_t expected_data[] = { 0x01, 0x02, 0x03, 0x04 };
+
+   TEST_ASSERT_TRUE( LOG_ProcessLine(line, strlen(line), LOG_FORMAT_ASC, LOG_CHECKSUM_LIN2, &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_NONE, anomaly.kind );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 0.01, frame.timestamp );
+   TEST_ASSERT_EQUAL_UINT8( 1, frame.channel );
+   TEST_ASSERT_EQUAL_HEX8( 0x27, frame.id );
+   TEST_ASSERT_FALSE( frame.has_pid );
+   TEST_ASSERT_EQUAL_UINT8( 4, frame.length );
+   TEST_ASSERT_EQUAL_HEX8_ARRAY( expected_data, frame.data, sizeof(expected_data) );
+
+   // ASC IDs are always hex, even when they look decimal
+   line = "1.0 L2 10 Tx 2 AA 55 checksum = AF";
+   TEST_ASSERT_TRUE( LOG_ProcessLine(line, strlen(line), LOG_FORMAT_ASC, LOG_CHECKSUM_LIN2, &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_NONE, anomaly.kind );
+   TEST_ASSERT_EQUAL_HEX8( 0x10, frame.id );
+   TEST_ASSERT_EQUAL_UINT8( 2, frame.channel );
+
+   line = "1.0 Li1 10 Rx 3 AA 55 checksum = AF";
+   TEST_ASSERT_TRUE( LOG_ProcessLine(line, strlen(line), LOG_FORMAT_ASC, LOG_CHECKSUM_LIN2, &frame, &anomaly) );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_LENGTH, anomaly.kind );
+   TEST_ASSERT_EQUAL_UINT8( 3, anomaly.expected );
+   TEST_ASSERT_EQUAL_UINT8( 2, anomaly.frame.length );
+}
+
+void test_LOG_ProcessLine_ASCSkipsBusEvents(void)
+{
+   struct LOG_Frame_S frame;
+   struct LOG_Anomaly_S anomaly;
+   const char * skipped[] =
+   {
+      "date Sun Oct 18 10:00:00.000 am 2026",
+      "base hex  timestamps absolute",
+      "   0.000000 Start of measurement",
+      "   0.035000 Li1 TransmErr 22",
+      "   0.036000 Li1 Sleep"
+   };
+
+   for ( size_t i = 0; i < (sizeof(skipped) / sizeof(skipped[0])); i++ )
+   {
+      TEST_ASSERT_FALSE( LOG_ProcessLine(skipped[i], strlen(skipped[i]), LOG_FORMAT_ASC, LOG_CHECKSUM_LIN2, &frame, &anomaly) );
+      TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_NONE, anomaly.kind );
+   }
+}
+
+/* LOG_ProcessStream */
+/******************************************************************************/
+
+void test_LOG_ProcessStream_SampleCSV(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, ProcessFile(SAMPLE_CSV_PATH, LOG_FORMAT_CSV, 1, 0, &Summary, &Record) );
+
+   TEST_ASSERT_EQUAL_UINT64( 13, Summary.lines );
+   TEST_ASSERT_EQUAL_UINT64( 10, Summary.frames );
+   TEST_ASSERT_EQUAL_UINT64( 5, Summary.anomalies[LOG_ANOMALY_NONE] );
+   TEST_ASSERT_EQUAL_UINT64( 1, Summary.anomalies[LOG_ANOMALY_PID_MISMATCH] );
+   TEST_ASSERT_EQUAL_UINT64( 1, Summary.anomalies[LOG_ANOMALY_CHECKSUM] );
+   TEST_ASSERT_EQUAL_UINT64( 1, Summary.anomalies[LOG_ANOMALY_BAD_ID] );
+   TEST_ASSERT_EQUAL_UINT64( 1, Summary.anomalies[LOG_ANOMALY_LENGTH] );
+   TEST_ASSERT_EQUAL_UINT64( 1, Summary.anomalies[LOG_ANOMALY_SYNTAX] );
+
+   // Anomalies arrive in file order with their line numbers
+   const size_t expected_lines[] = { 7, 8, 9, 10, 11 };
+   const enum LOG_Anomaly_E expected_kinds[] =
+   {
+      LOG_ANOMALY_PID_MISMATCH, LOG_ANOMALY_CHECKSUM, LOG_ANOMALY_BAD_ID, LOG_ANOMALY_LENGTH, LOG_ANOMALY_SYNTAX
+   };
+   TEST_ASSERT_EQUAL_size_t( 5, Record.count );
+   for ( size_t i = 0; i < Record.count; i++ )
+   {
+      TEST_ASSERT_EQUAL_size_t( expected_lines[i], Record.anomalies[i].line );
+      TEST_ASSERT_EQUAL_INT( expected_kinds[i], Record.anomalies[i].kind );
+   }
+
+   const struct LOG_IDStats_S * stats = &Summary.per_id[0x27];
+   TEST_ASSERT_EQUAL_UINT64( 3, stats->frames );
+   TEST_ASSERT_EQUAL_UINT64( 1, stats->pid_errors );
+   TEST_ASSERT_EQUAL_UINT64( 1, stats->checksum_errors );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 0.01, stats->first_timestamp );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 0.06, stats->last_timestamp );
+
+   stats = &Summary.per_id[0x10];
+   TEST_ASSERT_EQUAL_UINT64( 3, stats->frames );
+   TEST_ASSERT_EQUAL_UINT64( 0, stats->pid_errors + stats->checksum_errors );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 0.1, stats->last_timestamp );
+
+   TEST_ASSERT_EQUAL_UINT64( 1, Summary.per_id[0x3C].frames );
+   TEST_ASSERT_EQUAL_UINT64( 1, Summary.per_id[0x22].frames );
+}
+
+void test_LOG_ProcessStream_SampleASC(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, ProcessFile(SAMPLE_ASC_PATH, LOG_FORMAT_ASC, 1, 0, &Summary, &Record) );
+
+   TEST_ASSERT_EQUAL_UINT64( 13, Summary.lines );
+   TEST_ASSERT_EQUAL_UINT64( 7, Summary.frames );
+   TEST_ASSERT_EQUAL_UINT64( 4, Summary.anomalies[LOG_ANOMALY_NONE] );
+
+   TEST_ASSERT_EQUAL_size_t( 3, Record.count );
+   TEST_ASSERT_EQUAL_size_t( 10, Record.anomalies[0].line );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_CHECKSUM, Record.anomalies[0].kind );
+   TEST_ASSERT_EQUAL_size_t( 11, Record.anomalies[1].line );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_LENGTH, Record.anomalies[1].kind );
+   TEST_ASSERT_EQUAL_size_t( 12, Record.anomalies[2].line );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_BAD_ID, Record.anomalies[2].kind );
+   TEST_ASSERT_EQUAL_INT( ID_OOR, Record.anomalies[2].id_error );
+
+   TEST_ASSERT_EQUAL_UINT64( 2, Summary.per_id[0x27].frames );
+   TEST_ASSERT_EQUAL_UINT64( 1, Summary.per_id[0x27].checksum_errors );
+}
+
+void test_LOG_ProcessStream_CRLFLineEndings(void)
+{
+   FILE * fp = tmpfile();
+   TEST_ASSERT_NOT_NULL(fp);
+   fputs( "timestamp,channel,id,pid,data,checksum\r\n", fp );
+   fputs( "0.1,1,0x27,0xE7,01 02 03 04,0E\r\n", fp );
+   fputs( "0.2,1,0x27,0xE7,01 02 03 04,0F\r\n", fp );
+   fputs( "0.3,1,0x10,0x50,AA 55,AF", fp );   // No newline at the end
+   rewind(fp);
+
+   struct LOG_Options_S options = { 0 };
+   options.format = LOG_FORMAT_CSV;
+   options.num_threads = 1;
+   options.chunk_len = 8;     // Smaller than a line, so the buffer has to grow
+   options.on_anomaly = RecordAnomaly;
+   options.ctx = &Record;
+   TEST_ASSERT_EQUAL_INT( GoodResult, LOG_ProcessStream(fp, &options, &Summary) );
+   fclose(fp);
+
+   TEST_ASSERT_EQUAL_UINT64( 4, Summary.lines );
+   TEST_ASSERT_EQUAL_UINT64( 3, Summary.frames );
+   TEST_ASSERT_EQUAL_size_t( 1, Record.count );
+   TEST_ASSERT_EQUAL_size_t( 3, Record.anomalies[0].line );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_CHECKSUM, Record.anomalies[0].kind );
+}
+
+void test_LOG_ProcessStream_ThreadsAndChunksDontChangeResult(void)
+{
+   // Big enough to be split across several threads, with an anomaly every so often
+   FILE * fp = tmpfile();
+   TEST_ASSERT_NOT_NULL(fp);
+   fputs( "timestamp,channel,id,pid,data,checksum\n", fp );
+   for ( unsigned int i = 0; i < NUM_OF_GENERATED_LINES; i++ )
+   {
+      uint8_t id = (uint8_t)(i % (MAX_ID_ALLOWED + 1u));
+      uint8_t data[4] = { (uint8_t)i, (uint8_t)(i >> 8), 0x5A, 0xA5 };
+      bool enhanced = ( id < 0x3C );
+      uint8_t checksum = LOG_Checksum(ReferencePID(id), data, sizeof(data), enhanced);
+      if ( 0 == (i % 97u) )
+      {
+         checksum ^= 0x01;
+      }
+      fprintf( fp, "%u.%06u,1,0x%02X,0x%02X,%02X %02X %02X %02X,%02X\n",
+               i / 1000u, (i % 1000u) * 1000u, (unsigned int)id, (unsigned int)ReferencePID(id),
+               data[0], data[1], data[2], data[3], (unsigned int)checksum );
+   }
+   rewind(fp);
+
+   struct LOG_Options_S options = { 0 };
+   options.format = LOG_FORMAT_CSV;
+   options.on_anomaly = RecordAnomaly;
+
+   options.num_threads = 1;
+   options.ctx = &Record;
+   TEST_ASSERT_EQUAL_INT( GoodResult, LOG_ProcessStream(fp, &options, &Summary) );
+   rewind(fp);
+
+   // Small chunks with lines straddling every boundary, and several threads per chunk
+   options.num_threads = 4;
+   options.chunk_len = 300u * 1024u + 7u;
+   options.ctx = &OtherRecord;
+   TEST_ASSERT_EQUAL_INT( GoodResult, LOG_ProcessStream(fp, &options, &OtherSummary) );
+   fclose(fp);
+
+   TEST_ASSERT_EQUAL_UINT64( NUM_OF_GENERATED_LINES + 1u, Summary.lines );
+   TEST_ASSERT_EQUAL_UINT64( NUM_OF_GENERATED_LINES, Summary.frames );
+   TEST_ASSERT_EQUAL_UINT64( (NUM_OF_GENERATED_LINES + 96u) / 97u, Summary.anomalies[LOG_ANOMALY_CHECKSUM] );
+   TEST_ASSERT_EQUAL_MEMORY( &Summary, &OtherSummary, sizeof(Summary) );
+
+   TEST_ASSERT_EQUAL_size_t( Record.count, OtherRecord.count );
+   for ( size_t i = 0; i < Record.count; i++ )
+   {
+      TEST_ASSERT_EQUAL_size_t( (i * 97u) + 2u, Record.anomalies[i].line );
+      TEST_ASSERT_EQUAL_size_t( Record.anomalies[i].line, OtherRecord.anomalies[i].line );
+   }
+}
+
+/* LOG_Tail */
+/******************************************************************************/
+
+void test_LOG_Tail_AnySplitMatchesProcessStream(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, ProcessFile(SAMPLE_CSV_PATH, LOG_FORMAT_CSV, 1, 0, &Summary, &Record) );
+
+   FILE * fp = fopen(SAMPLE_CSV_PATH, "rb");
+   TEST_ASSERT_NOT_NULL(fp);
+   char text[1024];
+   size_t len = fread(text, 1, sizeof(text), fp);
+   fclose(fp);
+   TEST_ASSERT_TRUE( (len > 0) && (len < sizeof(text)) );
+
+   struct LOG_Options_S options = { 0 };
+   options.format = LOG_FORMAT_CSV;
+   options.checksum = LOG_CHECKSUM_LIN2;
+   options.on_anomaly = RecordAnomaly;
+   options.ctx = &OtherRecord;
+
+   // However the writes happened to land, the result is the same as reading it all at once
+   for ( size_t piece_len = 1; piece_len <= len; piece_len++ )
+   {
+      memset( &OtherRecord, 0, sizeof(OtherRecord) );
+      struct LOG_Tail_S tail;
+      LOG_TailInit(&tail, &options);
+      for ( size_t pos = 0; pos < len; pos += piece_len )
+      {
+         size_t n = ( (len - pos) < piece_len ) ? (len - pos) : piece_len;
+         TEST_ASSERT_EQUAL_INT( GoodResult, LOG_TailFeed(&tail, &text[pos], n) );
+      }
+      LOG_TailFlush(&tail);
+
+      TEST_ASSERT_EQUAL_MEMORY( &Summary, &tail.summary, sizeof(Summary) );
+      TEST_ASSERT_EQUAL_size_t( Record.count, OtherRecord.count );
+      for ( size_t i = 0; i < Record.count; i++ )
+      {
+         TEST_ASSERT_EQUAL_size_t( Record.anomalies[i].line, OtherRecord.anomalies[i].line );
+         TEST_ASSERT_EQUAL_INT( Record.anomalies[i].kind, OtherRecord.anomalies[i].kind );
+      }
+      LOG_TailFree(&tail);
+   }
+}
+
+void test_LOG_Tail_HoldsLineUntilItsNewline(void)
+{
+   struct LOG_Options_S options = { 0 };
+   options.format = LOG_FORMAT_CSV;
+   options.checksum = LOG_CHECKSUM_LIN2;
+   options.on_anomaly = RecordAnomaly;
+   options.ctx = &Record;
+
+   struct LOG_Tail_S tail;
+   LOG_TailInit(&tail, &options);
+
+   const char * first = "0.1,1,0x27,0xE7,01 02 03 04,0F";   // Bad checksum
+   TEST_ASSERT_EQUAL_INT( GoodResult, LOG_TailFeed(&tail, first, strlen(first)) );
+   TEST_ASSERT_EQUAL_UINT64( 0, tail.summary.lines );
+   TEST_ASSERT_EQUAL_size_t( 0, Record.count );
+
+   // The newline finishes it, and the next line is held in turn
+   const char * rest = "\r\n0.2,1,0x10,0x50,AA 55,A";
+   TEST_ASSERT_EQUAL_INT( GoodResult, LOG_TailFeed(&tail, rest, strlen(rest)) );
+   TEST_ASSERT_EQUAL_UINT64( 1, tail.summary.lines );
+   TEST_ASSERT_EQUAL_UINT64( 1, tail.summary.frames );
+   TEST_ASSERT_EQUAL_size_t( 1, Record.count );
+   TEST_ASSERT_EQUAL_size_t( 1, Record.anomalies[0].line );
+   TEST_ASSERT_EQUAL_INT( LOG_ANOMALY_CHECKSUM, Record.anomalies[0].kind );
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, LOG_TailFeed(&tail, "F\n", 2) );
+   TEST_ASSERT_EQUAL_UINT64( 2, tail.summary.lines );
+   TEST_ASSERT_EQUAL_UINT64( 2, tail.summary.frames );
+   TEST_ASSERT_EQUAL_size_t( 1, Record.count );
+   TEST_ASSERT_EQUAL_UINT64( 2, tail.summary.per_id[0x10].frames + tail.summary.per_id[0x27].frames );
+
+   // Nothing held, so flushing adds nothing
+   LOG_TailFlush(&tail);
+   TEST_ASSERT_EQUAL_UINT64( 2, tail.summary.lines );
+   LOG_TailFree(&tail);
+}
@@ -0,0 +1,390 @@
+/*!
+ * @file    test_lin_node.c
+ * @brief   Test file for the pty master/slave node emulator
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <signal.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_log.h"
+#include "lin_ldf.h"
+#include "lin_cap.h"
+#include "lin_sched.h"
+#include "lin_node.h"
+
+/* Local Macro Definitions */
+#define SAMPLE_LDF_PATH          "test/sample.ldf"
+#define SLOT_MS                  10.0     // Roomy, so a loaded machine still answers in the slot
+#define NUM_OF_CYCLES            5u
+#define MAX_RECORDED             64u
+#define SLAVE_START_NS           20000000L
+#define READ_TIMEOUT_MS          1000
+#define REPORT_POLL_NS           1000000L
+
+/* Datatypes */
+
+struct Recorder_S
+{
+   size_t num_frames;
+   struct CAP_Frame_S frames[MAX_RECORDED];
+};
+
+struct SlaveThread_S
+{
+   pthread_t thread;
+   struct Node_Options_S options;
+   struct Node_Stats_S stats;
+   enum LIN_PID_Result_E result;
+};
+
+/* Local Variables */
+static int MasterFd = -1;
+static int SlaveFd = -1;
+static char SlavePath[NODE_MAX_PATH_LEN];
+static struct Recorder_S Recorder;
+static unsigned int NumReports;
+static uint64_t ReportedHeaders;
+static struct SlaveThread_S Slave;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static void StartSlave( void );
+static void StopSlave( void );
+static void * SlaveThread( void * arg );
+static void SetResponse( struct Node_Response_S * responses, uint8_t id, const uint8_t * data, uint8_t length );
+static void RecordFrame( const struct CAP_Frame_S * frame, void * ctx );
+static void RecordReport( const struct Node_Stats_S * stats, void * ctx );
+static size_t ReadResponse( uint8_t * response, size_t len );
+
+/* Node_Run */
+void test_Node_Run_MasterAndSlaveExchange(void);
+void test_Node_Run_SlaveSkipsBadPIDAndStrays(void);
+void test_Node_Run_MasterFlagsBadResponse(void);
+void test_Node_Run_SIGUSR1Reports(void);
+
+/* Node_ResponsesFromLDF */
+void test_Node_ResponsesFromLDF_PacksInitValues(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* Node_Run */
+
+   RUN_TEST(test_Node_Run_MasterAndSlaveExchange);
+   RUN_TEST(test_Node_Run_SlaveSkipsBadPIDAndStrays);
+   RUN_TEST(test_Node_Run_MasterFlagsBadResponse);
+   RUN_TEST(test_Node_Run_SIGUSR1Reports);
+
+   /* Node_ResponsesFromLDF */
+
+   RUN_TEST(test_Node_ResponsesFromLDF_PacksInitValues);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   memset( &Recorder, 0, sizeof(Recorder) );
+   NumReports = 0;
+   ReportedHeaders = 0;
+   memset( &Slave, 0, sizeof(Slave) );
+   Slave.options.role = NODE_SLAVE;
+   Slave.options.checksum = LOG_CHECKSUM_LIN2;
+   TEST_ASSERT_EQUAL_INT( GoodResult, Node_OpenPty(&MasterFd, &SlaveFd, SlavePath) );
+   Slave.options.fd = SlaveFd;
+}
+
+void tearDown(void)
+{
+   Node_ClosePort(MasterFd);
+   Node_ClosePort(SlaveFd);
+   MasterFd = -1;
+   SlaveFd = -1;
+}
+
+/* Helpers */
+
+/**
+ * @brief Run the slave on the pty's slave end, and give it a moment to get
+ *        to its first wait before anything is sent.
+ */
+static void StartSlave( void )
+{
+   TEST_ASSERT_EQUAL_INT( 0, pthread_create(&Slave.thread, NULL, SlaveThread, &Slave) );
+   struct timespec settle = { 0, SLAVE_START_NS };
+   (void)nanosleep(&settle, NULL);
+}
+
+/**
+ * @brief Hang up the master end, which is what stops the slave.
+ */
+static void StopSlave( void )
+{
+   Node_ClosePort(MasterFd);
+   MasterFd = -1;
+   TEST_ASSERT_EQUAL_INT( 0, pthread_join(Slave.thread, NULL) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, Slave.result );
+}
+
+static void * SlaveThread( void * arg )
+{
+   struct SlaveThread_S * slave = (struct SlaveThread_S *)arg;
+   slave->result = Node_Run(&slave->options, &slave->stats);
+   return NULL;
+}
+
+static void SetResponse( struct Node_Response_S * responses, uint8_t id, const uint8_t * data, uint8_t length )
+{
+   responses[id].published = true;
+   responses[id].length = length;
+   memcpy( responses[id].data, data, length );
+}
+
+static void RecordFrame( const struct CAP_Frame_S * frame, void * ctx )
+{
+   struct Recorder_S * recorder = (struct Recorder_S *)ctx;
+   TEST_ASSERT_TRUE( recorder->num_frames < MAX_RECORDED );
+   recorder->frames[recorder->num_frames++] = *frame;
+}
+
+/**
+ * @brief Called from the slave's thread; the count is read with an atomic
+ *        load from the test's.
+ */
+static void RecordReport( const struct Node_Stats_S * stats, void * ctx )
+{
+   (void)ctx;
+   ReportedHeaders = stats->headers;
+   __atomic_store_n( &NumReports, NumReports + 1u, __ATOMIC_RELEASE );
+}
+
+/**
+ * @brief Read what the slave sends back, until len bytes are in or it goes
+ *        quiet. Returns how many came.
+ */
+static size_t ReadResponse( uint8_t * response, size_t len )
+{
+   size_t got = 0;
+   struct pollfd pfd = { MasterFd, POLLIN, 0 };
+   while ( (got < len) && (poll(&pfd, 1, READ_TIMEOUT_MS) > 0) )
+   {
+      ssize_t n = read(MasterFd, &response[got], len - got);
+      TEST_ASSERT_TRUE( n > 0 );
+      got += (size_t)n;
+   }
+   return got;
+}
+
+/* Node_Run */
+/******************************************************************************/
+
+void test_Node_Run_MasterAndSlaveExchange(void)
+{
+   const uint8_t data[8] = { 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88 };
+   const struct Sched_Slot_S slots[] =
+   {
+      { SLOT_MS, 0x10, 4 },            // Slave
+      { SLOT_MS, 0x11, 2 },            // Nobody
+      { SLOT_MS, 0x12, 2 },            // The master itself
+      { SLOT_MS, SCHED_NO_ID, 8 },     // Nothing goes out
+      { SLOT_MS, 0x3C, 8 },            // Slave, classic checksum
+   };
+   SetResponse(Slave.options.responses, 0x10, data, 4);
+   SetResponse(Slave.options.responses, 0x3C, data, 8);
+   StartSlave();
+
+   struct Node_Options_S master;
+   memset( &master, 0, sizeof(master) );
+   master.role = NODE_MASTER;
+   master.fd = MasterFd;
+   master.checksum = LOG_CHECKSUM_LIN2;
+   master.slots = slots;
+   master.num_slots = sizeof(slots) / sizeof(slots[0]);
+   master.cycles = NUM_OF_CYCLES;
+   master.on_frame = RecordFrame;
+   master.ctx = &Recorder;
+   SetResponse(master.responses, 0x12, &data[6], 2);
+
+   struct Node_Stats_S stats;
+   TEST_ASSERT_EQUAL_INT( GoodResult, Node_Run(&master, &stats) );
+   StopSlave();
+
+   TEST_ASSERT_EQUAL_UINT64( 4u * NUM_OF_CYCLES, stats.headers );
+   TEST_ASSERT_EQUAL_UINT64( 3u * NUM_OF_CYCLES, stats.responses );
+   TEST_ASSERT_EQUAL_UINT64( NUM_OF_CYCLES, stats.no_responses );
+   TEST_ASSERT_EQUAL_UINT64( 0, stats.checksum_errors + stats.stray_bytes + stats.dropped_writes );
+   TEST_ASSERT_EQUAL_UINT64( 2u * NUM_OF_CYCLES, stats.latency.count );   // Not its own responses
+   TEST_ASSERT_TRUE( stats.latency.min > 0u );
+   TEST_ASSERT_TRUE( stats.latency.max < (uint64_t)(SLOT_MS * 1e6) );
+
+   TEST_ASSERT_EQUAL_UINT64( 4u * NUM_OF_CYCLES, Slave.stats.headers );
+   TEST_ASSERT_EQUAL_UINT64( 2u * NUM_OF_CYCLES, Slave.stats.responses );
+   TEST_ASSERT_EQUAL_UINT64( 2u * NUM_OF_CYCLES, Slave.stats.latency.count );
+   TEST_ASSERT_EQUAL_UINT64( 0, Slave.stats.pid_errors + Slave.stats.stray_bytes );   // The master's own responses aren't stray
+
+   // Frames come out in slot order, as read back
+   TEST_ASSERT_EQUAL_size_t( 4u * NUM_OF_CYCLES, Recorder.num_frames );
+   const struct CAP_Frame_S * frame = &Recorder.frames[0];
+   TEST_ASSERT_EQUAL_UINT8( 0x10, frame->id );
+   TEST_ASSERT_EQUAL_UINT8( ComputePID(0x10), frame->pid );
+   TEST_ASSERT_EQUAL_UINT8( 4, frame->length );
+   TEST_ASSERT_EQUAL_MEMORY( data, frame->data, 4 );
+   TEST_ASSERT_EQUAL_UINT8( LOG_Checksum(frame->pid, data, 4, true), frame->checksum );
+   TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[1].length );
+   TEST_ASSERT_EQUAL_UINT8( 0x12, Recorder.frames[2].id );
+   TEST_ASSERT_EQUAL_MEMORY( &data[6], Recorder.frames[2].data, 2 );
+   TEST_ASSERT_EQUAL_UINT8( 0x3C, Recorder.frames[3].id );
+   TEST_ASSERT_EQUAL_UINT8( LOG_Checksum(ComputePID(0x3C), data, 8, false), Recorder.frames[3].checksum );
+   TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[3].flags );
+
+   // Slots start on the schedule, not whenever the last one finished
+   uint64_t cycle_us = (uint64_t)(5.0 * SLOT_MS * 1000.0);
+   TEST_ASSERT_UINT64_WITHIN( cycle_us / 10u, (NUM_OF_CYCLES - 1u) * cycle_us,
+                              Recorder.frames[Recorder.num_frames - 4u].timestamp_us );
+}
+
+void test_Node_Run_SlaveSkipsBadPIDAndStrays(void)
+{
+   const uint8_t data[3] = { 0xA5, 0x5A, 0x00 };
+   SetResponse(Slave.options.responses, 0x20, data, 3);
+   SetResponse(Slave.options.responses, 0x21, data, 3);
+   StartSlave();
+
+   // A stray byte, a break with the wrong sync, a header for 0x21 with its
+   // parity bits flipped, someone else's response, and then a good header
+   // for 0x20
+   const uint8_t bytes[] = { 0x42,
+                             NODE_BREAK_BYTE, 0x54,
+                             NODE_BREAK_BYTE, NODE_SYNC_BYTE, (uint8_t)(ComputePID(0x21) ^ 0xC0u),
+                             0x00, 0x12, 0x34,
+                             NODE_BREAK_BYTE, NODE_SYNC_BYTE, ComputePID(0x20) };
+   TEST_ASSERT_EQUAL_INT( (int)sizeof(bytes), (int)write(MasterFd, bytes, sizeof(bytes)) );
+
+   uint8_t response[4] = { 0 };
+   size_t got = ReadResponse(response, sizeof(response));
+   StopSlave();
+
+   TEST_ASSERT_EQUAL_size_t( sizeof(response), got );
+   TEST_ASSERT_EQUAL_MEMORY( data, response, 3 );
+   TEST_ASSERT_EQUAL_UINT8( LOG_Checksum(ComputePID(0x20), data, 3, true), response[3] );
+   TEST_ASSERT_EQUAL_UINT64( 2, Slave.stats.headers );
+   TEST_ASSERT_EQUAL_UINT64( 1, Slave.stats.pid_errors );
+   TEST_ASSERT_EQUAL_UINT64( 1, Slave.stats.responses );
+   TEST_ASSERT_EQUAL_UINT64( 2, Slave.stats.stray_bytes );   // 0x42 and the bad sync; not the response
+}
+
+void test_Node_Run_MasterFlagsBadResponse(void)
+{
+   const uint8_t data[2] = { 0x01, 0x02 };
+   const struct Sched_Slot_S slots[] = { { SLOT_MS, 0x05, 2 } };
+
+   // The "slave" publishes a checksum for the wrong checksum model
+   Slave.options.checksum = LOG_CHECKSUM_CLASSIC;
+   SetResponse(Slave.options.responses, 0x05, data, 2);
+   StartSlave();
+
+   struct Node_Options_S master;
+   memset( &master, 0, sizeof(master) );
+   master.role = NODE_MASTER;
+   master.fd = MasterFd;
+   master.checksum = LOG_CHECKSUM_LIN2;
+   master.slots = slots;
+   master.num_slots = 1;
+   master.cycles = 2;
+   master.on_frame = RecordFrame;
+   master.ctx = &Recorder;
+
+   struct Node_Stats_S stats;
+   TEST_ASSERT_EQUAL_INT( GoodResult, Node_Run(&master, &stats) );
+   StopSlave();
+
+   TEST_ASSERT_EQUAL_UINT64( 2, stats.headers );
+   TEST_ASSERT_EQUAL_UINT64( 2, stats.checksum_errors );
+   TEST_ASSERT_EQUAL_UINT64( 0, stats.responses );
+   TEST_ASSERT_EQUAL_size_t( 2, Recorder.num_frames );
+   TEST_ASSERT_EQUAL_UINT8( CAP_FLAG_CHECKSUM_ERROR, Recorder.frames[1].flags );
+   TEST_ASSERT_EQUAL_MEMORY( data, Recorder.frames[1].data, 2 );
+}
+
+void test_Node_Run_SIGUSR1Reports(void)
+{
+   const uint8_t data[2] = { 0x12, 0x34 };
+   SetResponse(Slave.options.responses, 0x20, data, 2);
+   Slave.options.on_report = RecordReport;
+   StartSlave();
+
+   const uint8_t header[] = { NODE_BREAK_BYTE, NODE_SYNC_BYTE, ComputePID(0x20) };
+   TEST_ASSERT_EQUAL_INT( (int)sizeof(header), (int)write(MasterFd, header, sizeof(header)) );
+   uint8_t response[3];
+   TEST_ASSERT_EQUAL_size_t( sizeof(response), ReadResponse(response, sizeof(response)) );
+
+   // Sent to the slave's thread, the only one with SIGUSR1 handled
+   TEST_ASSERT_EQUAL_INT( 0, pthread_kill(Slave.thread, SIGUSR1) );
+   struct timespec tick = { 0, REPORT_POLL_NS };
+   for ( unsigned int i = 0; (i < (unsigned int)READ_TIMEOUT_MS) && (0 == __atomic_load_n(&NumReports, __ATOMIC_ACQUIRE)); i++ )
+   {
+      (void)nanosleep(&tick, NULL);
+   }
+   StopSlave();
+
+   // The report came mid-run, and the run carried on to the hangup
+   TEST_ASSERT_EQUAL_UINT( 1, NumReports );
+   TEST_ASSERT_EQUAL_UINT64( 1, ReportedHeaders );
+   TEST_ASSERT_EQUAL_UINT64( 1, Slave.stats.responses );
+   TEST_ASSERT_EQUAL_UINT64( 1, Slave.stats.latency.count );
+}
+
+/* Node_ResponsesFromLDF */
+/******************************************************************************/
+
+void test_Node_ResponsesFromLDF_PacksInitValues(void)
+{
+   struct LDF_Database_S db;
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &db) );
+
+   struct Node_Response_S responses[CAP_NUM_OF_IDS];
+   Node_ResponsesFromLDF(&db, 0, responses);   // CEM, the master
+   TEST_ASSERT_TRUE( responses[0x01].published );
+   TEST_ASSERT_EQUAL_UINT8( 1, responses[0x01].length );
+   TEST_ASSERT_TRUE( responses[0x27].published );
+   TEST_ASSERT_EQUAL_UINT8( 4, responses[0x27].length );
+   // MotorSpeed's {0x00, 0x01} lands at bit 16
+   const uint8_t motor_status[4] = { 0x00, 0x00, 0x00, 0x01 };
+   TEST_ASSERT_EQUAL_MEMORY( motor_status, responses[0x27].data, 4 );
+   TEST_ASSERT_FALSE( responses[0x02].published );
+   TEST_ASSERT_FALSE( responses[0x3C].published );            // Diagnostic frames aren't modelled
+
+   Node_ResponsesFromLDF(&db, 1, responses);   // LSM
+   TEST_ASSERT_TRUE( responses[0x02].published && responses[0x03].published );
+   TEST_ASSERT_FALSE( responses[0x01].published || responses[0x04].published );
+   TEST_ASSERT_EQUAL_UINT8( 2, responses[0x02].length );
+
+   LDF_Free(&db);
+}
@@ -7,6 +7,8 @@
  * @copyright MIT License
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 /* File Inclusions */
 #include <stdint.h>
 #include <stdio.h>
@@ -14,18 +16,25 @@
 #include <stdbool.h>
 #include <string.h>
 #include <ctype.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
 #include "unity.h"
+#include "re.h"
 #include "lin_pid.h"
+#include "lin_char.h"
 
 /* Local Macro Definitions */
 #define MAX_ARGS_TO_CHECK  5  // e.g., lin_pid XX --hex --quiet --no-new-line
 #define MAX_NUM_LEN        6  // strlen("0x3F") + 1
 #define MAX_ARG_LEN        (strlen("--no-new-line"))
 #define MAX_ERR_MSG_LEN    100
+#define MAX_STREAM_IDS     2000
+#define MAX_STREAM_LEN     (MAX_STREAM_IDS * 14)  // Up to 10 bytes of token and 3 of delimiters
 
 /* Datatypes */
 
-#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd ) \
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd, pre, width, base, upper, suf ) \
    enum,
 
 enum NumericFormat_E
@@ -37,7 +46,32 @@ enum NumericFormat_E
 
 #undef LIN_PID_NUMERIC_FORMAT
 
+struct IDSpelling_S
+{
+   uint32_t key;
+   uint8_t id;
+   uint8_t format;
+   bool ishex;
+   bool isdec;
+};
+
 /* Local Variables */
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd, pre, width, base, upper, suf ) \
+   regexp,
+static const char * const FORMAT_REGEX_PATTERNS[NUM_OF_NUMERIC_FORMATS] =
+{
+   #include "lin_pid_supported_formats.h"
+};
+#undef LIN_PID_NUMERIC_FORMAT
+
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd, pre, width, base, upper, suf ) \
+   prnt_fmt,
+static const char * const FORMAT_PRINT_FORMATS[NUM_OF_NUMERIC_FORMATS] =
+{
+   #include "lin_pid_supported_formats.h"
+};
+#undef LIN_PID_NUMERIC_FORMAT
+
 static const uint8_t REFERENCE_PID_TABLE[MAX_ID_ALLOWED + 1] =
 {
    0x80, 0xC1, 0x42, 0x03, 0xC4, 0x85, 0x06, 0x47, 
@@ -53,6 +87,8 @@ static const uint8_t REFERENCE_PID_TABLE[MAX_ID_ALLOWED + 1] =
 /* External Data */
 
 /* Forward Function Declarations */
+static size_t RandomTokenStream( char * stream, size_t num_tokens, size_t * starts, size_t * lens );
+static void * WriteIDsLate( void * pipe_fd );
 
 /* Test Setup */
 void setUp(void);
@@ -109,6 +145,7 @@ void test_GetID_HexRange_XZ_Format(void);
 void test_GetID_NumRange_Zd_Format(void);
 void test_GetID_NumRange_ZD_Format(void);
 void test_GetID_DecRange_Z_Format_PreemptivelyDec(void);
+void test_GetID_InvalidNum_HexPrefixAndSuffix(void);
 
 // TODO: GetID Invalid digits in
 //void test_GetID_InvalidNum_TooManyDigits_ZZ_Format(void);
@@ -260,6 +297,31 @@ void test_DetermineEntryFormat_LowercasedSuffix_LeadingZeros(void);
 void test_DetermineEntryFormat_UppercaseDSuffix_NoLeadingZeros(void);
 void test_DetermineEntryFormat_UppercaseDSuffix_LeadingZeros(void);
 
+/* MatchFormatPattern */
+
+void test_MatchFormatPattern_AgreesWithRegex_CanonicalSpellings(void);
+void test_MatchFormatPattern_AgreesWithRegex_MalformedSpellings(void);
+
+/* NumericFormatters */
+
+void test_NumericFormatters_AgreeWithSnprintf_AllFormats(void);
+void test_NumericFormatters_WriteNothingPastTheirLength(void);
+
+/* LookupIDSpelling */
+
+void test_LookupIDSpelling_AgreesWithGetID_EveryShortToken(void);
+void test_LookupIDSpelling_CanonicalSpellings(void);
+void test_LookupIDSpelling_LeavesTheRestToGetID(void);
+
+/* ParseIDs */
+
+void test_ParseIDs_SplitsOnEveryDelimiterInEveryLane(void);
+void test_ParseIDs_AgreesWithParseID_RandomStream(void);
+void test_ParseIDs_SameResultsWhereverTheStreamIsCut(void);
+void test_ParseIDs_StopsAtMaxIDsAndUnfinishedTokens(void);
+void test_lin_pid_cli_PipedIDs_WriterNotStartedYet(void);
+void test_lin_pid_cli_PipedIDs_RejectsOtherFlags(void);
+
 /* Extern Functions */
 extern enum LIN_PID_Result_E GetID( const char * str,
                                     uint8_t * id,
@@ -286,6 +348,14 @@ extern enum NumericFormat_E DetermineEntryFormat( const char * str,
 extern void CompileAllRegexPatterns(void);
 extern void FreeAllRegexPatterns(void);
 
+extern bool MatchFormatPattern( const char * pattern, const char * str );
+
+extern size_t (* const NumericFormatters[NUM_OF_NUMERIC_FORMATS])( char * buf, unsigned int value );
+
+extern const struct IDSpelling_S * LookupIDSpelling( const char * str,
+                                                     bool ishex,
+                                                     bool isdec );
+
 /* Meat of the Program */
 
 int main(void)
@@ -338,6 +408,7 @@ int main(void)
    RUN_TEST(test_GetID_NumRange_Zd_Format);
    RUN_TEST(test_GetID_NumRange_ZD_Format);
    RUN_TEST(test_GetID_DecRange_Z_Format_PreemptivelyDec);
+   RUN_TEST(test_GetID_InvalidNum_HexPrefixAndSuffix);
 
    // TODO: GetID Invalid test cases
 //   RUN_TEST(test_GetID_InvalidNum_TooManyDigits_ZZ_Format);
@@ -473,6 +544,31 @@ int main(void)
    RUN_TEST(test_DetermineEntryFormat_UppercaseDSuffix_NoLeadingZeros);
    RUN_TEST(test_DetermineEntryFormat_UppercaseDSuffix_LeadingZeros);
 
+   /* MatchFormatPattern */
+
+   RUN_TEST(test_MatchFormatPattern_AgreesWithRegex_CanonicalSpellings);
+   RUN_TEST(test_MatchFormatPattern_AgreesWithRegex_MalformedSpellings);
+
+   /* NumericFormatters */
+
+   RUN_TEST(test_NumericFormatters_AgreeWithSnprintf_AllFormats);
+   RUN_TEST(test_NumericFormatters_WriteNothingPastTheirLength);
+
+   /* LookupIDSpelling */
+
+   RUN_TEST(test_LookupIDSpelling_AgreesWithGetID_EveryShortToken);
+   RUN_TEST(test_LookupIDSpelling_CanonicalSpellings);
+   RUN_TEST(test_LookupIDSpelling_LeavesTheRestToGetID);
+
+   /* ParseIDs */
+
+   RUN_TEST(test_ParseIDs_SplitsOnEveryDelimiterInEveryLane);
+   RUN_TEST(test_ParseIDs_AgreesWithParseID_RandomStream);
+   RUN_TEST(test_ParseIDs_SameResultsWhereverTheStreamIsCut);
+   RUN_TEST(test_ParseIDs_StopsAtMaxIDsAndUnfinishedTokens);
+   RUN_TEST(test_lin_pid_cli_PipedIDs_WriterNotStartedYet);
+   RUN_TEST(test_lin_pid_cli_PipedIDs_RejectsOtherFlags);
+
    return UNITY_END();
 }
 
@@ -1181,6 +1277,26 @@ void test_GetID_DecRange_Z_Format_PreemptivelyDec(void)
    }
 }
 
+void test_GetID_InvalidNum_HexPrefixAndSuffix(void)
+{
+   // One hex digit or two, with or without --hex
+   static const char * const STRS[] = { "x3Fh", "X3fH", "x3Fx", "XAh", "xAX" };
+   for ( size_t i = 0; i < (sizeof(STRS) / sizeof(STRS[0])); i++ )
+   {
+      for ( int hex = 0; hex <= 1; hex++ )
+      {
+         uint8_t parsed_id;
+         bool pre_emptively_hex = ( hex != 0 );
+         bool pre_emptively_dec = false;
+         enum LIN_PID_Result_E result = GetID(STRS[i], &parsed_id, &pre_emptively_hex, &pre_emptively_dec);
+
+         TEST_ASSERT_EQUAL_INT_MESSAGE( (int)HexPrefixAndSuffixEncountered, (int)result, STRS[i] );
+         TEST_ASSERT_EQUAL_INT_MESSAGE( (int)HexPrefixAndSuffixEncountered,
+                                        (int)ParseID(STRS[i], (hex != 0), false, &parsed_id), STRS[i] );
+      }
+   }
+}
+
 /******************************************************************************/
 
 void test_MyAtoI_ValidDecimalDigits(void)
@@ -4735,3 +4851,470 @@ void test_DetermineEntryFormat_UppercaseDSuffix_LeadingZeros(void)
    //TEST_ASSERT_NOT_EQUAL_INT( UppercaseDSuffix_LeadingZeros, DetermineEntryFormat("063D", false, false) );
 }
 
+// The print formats come straight from lin_pid_supported_formats.h
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+#endif
+
+/* MatchFormatPattern */
+
+/******************************************************************************/
+
+void test_MatchFormatPattern_AgreesWithRegex_CanonicalSpellings(void)
+{
+   // Every format's own spelling of every ID, checked against every pattern
+   for ( int fmt = 0; fmt < NUM_OF_NUMERIC_FORMATS; fmt++ )
+   {
+      for ( unsigned int id = 0; id <= MAX_ID_ALLOWED; id++ )
+      {
+         char str[MAX_NUM_LEN + 2];
+         snprintf( str, sizeof(str), FORMAT_PRINT_FORMATS[fmt], id );
+
+         for ( int pat = 0; pat < NUM_OF_NUMERIC_FORMATS; pat++ )
+         {
+            int match_len;
+            bool expected = ( re_match(FORMAT_REGEX_PATTERNS[pat], str, &match_len) != -1 );
+            TEST_ASSERT_EQUAL_MESSAGE( expected,
+                                       MatchFormatPattern(FORMAT_REGEX_PATTERNS[pat], str),
+                                       str );
+         }
+      }
+   }
+}
+
+void test_MatchFormatPattern_AgreesWithRegex_MalformedSpellings(void)
+{
+   static const char * const MALFORMED[] =
+   {
+      "", "0", "0x", "x", "X", "h", "d", "0xG", "0x1G", "G1", "1g", "0x123",
+      "1234", "0x1Ah", "x1d", "1Ahd", "0x-1", "-1", " 1", "1 ", "1hh", "0X1A",
+      "0x1aX", "xx1", "1dd", "1D1", "0xx1", "00x1", "1A2B"
+   };
+
+   for ( size_t i = 0; i < (sizeof(MALFORMED) / sizeof(MALFORMED[0])); i++ )
+   {
+      for ( int pat = 0; pat < NUM_OF_NUMERIC_FORMATS; pat++ )
+      {
+         int match_len;
+         bool expected = ( re_match(FORMAT_REGEX_PATTERNS[pat], MALFORMED[i], &match_len) != -1 );
+         TEST_ASSERT_EQUAL_MESSAGE( expected,
+                                    MatchFormatPattern(FORMAT_REGEX_PATTERNS[pat], MALFORMED[i]),
+                                    MALFORMED[i] );
+      }
+   }
+}
+
+/* NumericFormatters */
+
+/******************************************************************************/
+
+void test_NumericFormatters_AgreeWithSnprintf_AllFormats(void)
+{
+   // Also checks each format's pieces in lin_pid_supported_formats.h against
+   // its print format
+   for ( int fmt = 0; fmt < NUM_OF_NUMERIC_FORMATS; fmt++ )
+   {
+      for ( unsigned int value = 0; value <= UINT8_MAX; value++ )
+      {
+         char expected[16];
+         char actual[16] = {0};
+         int expected_len = snprintf( expected, sizeof(expected), FORMAT_PRINT_FORMATS[fmt], value );
+
+         size_t actual_len = NumericFormatters[fmt]( actual, value );
+
+         TEST_ASSERT_EQUAL_size_t( (size_t)expected_len, actual_len );
+         TEST_ASSERT_EQUAL_STRING_MESSAGE( expected, actual, FORMAT_PRINT_FORMATS[fmt] );
+      }
+   }
+}
+
+void test_NumericFormatters_WriteNothingPastTheirLength(void)
+{
+   char buf[8];
+   memset( buf, '#', sizeof(buf) );
+
+   TEST_ASSERT_EQUAL_size_t( 4, NumericFormatters[ClassicHexPrefix_LeadingZeros_Uppercase](buf, 0x0B) );
+   TEST_ASSERT_EQUAL_MEMORY( "0x0B####", buf, sizeof(buf) );
+
+   memset( buf, '#', sizeof(buf) );
+   TEST_ASSERT_EQUAL_size_t( 4, NumericFormatters[LowercasedSuffix_LeadingZeros](buf, 255) );
+   TEST_ASSERT_EQUAL_MEMORY( "255d####", buf, sizeof(buf) );
+
+   memset( buf, '#', sizeof(buf) );
+   TEST_ASSERT_EQUAL_size_t( 1, NumericFormatters[HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase](buf, 0) );
+   TEST_ASSERT_EQUAL_MEMORY( "0#######", buf, sizeof(buf) );
+}
+
+/* LookupIDSpelling */
+
+/******************************************************************************/
+
+void test_LookupIDSpelling_AgreesWithGetID_EveryShortToken(void)
+{
+   // Every character GetID() could take, and a few it can't
+   static const char ALPHABET[] = "0123456789abcdefABCDEFxXhHg -";
+   const size_t num_chars = strlen(ALPHABET);
+
+   for ( int flag = 0; flag < 3; flag++ )
+   {
+      bool ishex = ( 1 == flag );
+      bool isdec = ( 2 == flag );
+      size_t num_tokens = 1;
+      for ( size_t len = 1; len <= 4; len++ )
+      {
+         num_tokens *= num_chars;
+         for ( size_t n = 0; n < num_tokens; n++ )
+         {
+            char token[5] = {0};
+            for ( size_t i = 0, rest = n; i < len; i++, rest /= num_chars )
+            {
+               token[i] = ALPHABET[rest % num_chars];
+            }
+
+            uint8_t id = 0xFF;
+            bool parsed_hex = ishex;
+            bool parsed_dec = isdec;
+            bool valid = ( GoodResult == GetID(token, &id, &parsed_hex, &parsed_dec) ) &&
+                         ( id <= MAX_ID_ALLOWED );
+            enum NumericFormat_E format = valid ? DetermineEntryFormat(token, parsed_hex, parsed_dec)
+                                                : INVALID_NUMERIC_FORMAT;
+
+            const struct IDSpelling_S * spelling = LookupIDSpelling(token, ishex, isdec);
+
+            TEST_ASSERT_EQUAL_MESSAGE( (INVALID_NUMERIC_FORMAT != format), (spelling != NULL), token );
+            if ( spelling != NULL )
+            {
+               TEST_ASSERT_EQUAL_HEX8_MESSAGE( id, spelling->id, token );
+               TEST_ASSERT_EQUAL_INT_MESSAGE( format, spelling->format, token );
+               TEST_ASSERT_EQUAL_MESSAGE( parsed_hex, spelling->ishex, token );
+               TEST_ASSERT_EQUAL_MESSAGE( parsed_dec, spelling->isdec, token );
+            }
+         }
+      }
+   }
+}
+
+void test_LookupIDSpelling_CanonicalSpellings(void)
+{
+   for ( unsigned int id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      char token[MAX_NUM_LEN];
+      const struct IDSpelling_S * spelling;
+
+      (void)snprintf( token, sizeof(token), "0x%02X", id );
+      spelling = LookupIDSpelling(token, false, false);
+      TEST_ASSERT_NOT_NULL( spelling );
+      TEST_ASSERT_EQUAL_HEX8( id, spelling->id );
+      // First match wins, and "0x3F" has no leading zero to speak of
+      TEST_ASSERT_EQUAL_INT( (id >= 0x10) ? ClassicHexPrefix_NoLeadingZeros_Uppercase
+                                          : ClassicHexPrefix_LeadingZeros_Uppercase,
+                             spelling->format );
+
+      (void)snprintf( token, sizeof(token), "%02xh", id );
+      spelling = LookupIDSpelling(token, true, false);
+      TEST_ASSERT_NOT_NULL( spelling );
+      TEST_ASSERT_EQUAL_HEX8( id, spelling->id );
+      TEST_ASSERT_TRUE( spelling->ishex && !spelling->isdec );
+
+      (void)snprintf( token, sizeof(token), "%u", id );
+      spelling = LookupIDSpelling(token, false, true);
+      TEST_ASSERT_NOT_NULL( spelling );
+      TEST_ASSERT_EQUAL_HEX8( id, spelling->id );
+      TEST_ASSERT_TRUE( !spelling->ishex && spelling->isdec );
+   }
+}
+
+void test_LookupIDSpelling_LeavesTheRestToGetID(void)
+{
+   // Out of range, too long, padded, or spelled in a way no format mirrors
+   static const char * const MISSES[] = { "", "40", "0xFF", "99d", "0x3F0", "0x3Fh", "x3Fh", "X3fH", " 3C", "3C ", "0X1A", "aB" };
+   for ( size_t i = 0; i < (sizeof(MISSES) / sizeof(MISSES[0])); i++ )
+   {
+      TEST_ASSERT_NULL( LookupIDSpelling(MISSES[i], false, false) );
+   }
+
+   // Bytes past ASCII can't reach the bits the flags take up in the key
+   for ( int ch = 0x80; ch < 256; ch++ )
+   {
+      const char token[] = { (char)(ch & 0xFF), '\0' };
+      TEST_ASSERT_NULL( LookupIDSpelling(token, false, false) );
+   }
+
+   // ParseID() falls back on GetID() for whatever the table doesn't hold
+   uint8_t id = 0xFF;
+   TEST_ASSERT_EQUAL_INT( GoodResult, ParseID(" 3C", false, false, &id) );
+   TEST_ASSERT_EQUAL_HEX8( 0x3C, id );
+   TEST_ASSERT_EQUAL_INT( GoodResult, ParseID("0X1A", false, false, &id) );
+   TEST_ASSERT_EQUAL_HEX8( 0x1A, id );
+   TEST_ASSERT_EQUAL_INT( ID_OOR, ParseID("40", false, false, &id) );
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+/* ParseIDs */
+
+/******************************************************************************/
+
+/**
+ * @brief Random tokens of 1 to 10 bytes, good and bad, each followed by a run
+ *        of 1 to 3 delimiters; where each token starts and how long it is.
+ */
+static size_t RandomTokenStream( char * stream, size_t num_tokens, size_t * starts, size_t * lens )
+{
+   static const char TOKEN_CHARS[] = "0123456789abcdefABCDEFxXhHdDg_\x80\xC3\xFF";
+   static const char DELIMITERS[] = " \t\n\r\f\v,";   // And NUL, the terminator
+
+   size_t len = 0;
+   for ( size_t i = 0; i < num_tokens; i++ )
+   {
+      starts[i] = len;
+      lens[i] = 1u + ( (size_t)rand() % 10u );
+      for ( size_t j = 0; j < lens[i]; j++ )
+      {
+         stream[len++] = TOKEN_CHARS[ (size_t)rand() % (sizeof(TOKEN_CHARS) - 1u) ];
+      }
+
+      size_t num_delimiters = 1u + ( (size_t)rand() % 3u );
+      for ( size_t j = 0; j < num_delimiters; j++ )
+      {
+         stream[len++] = DELIMITERS[ (size_t)rand() % sizeof(DELIMITERS) ];
+      }
+   }
+   return len;
+}
+
+void test_ParseIDs_SplitsOnEveryDelimiterInEveryLane(void)
+{
+   // The byte under test lands in each lane of the word read at the token's
+   // start, then in each lane of the shorter one read near the end of data
+   for ( int ch = 0; ch < 256; ch++ )
+   {
+      bool delimiter = CHAR_IS(ch, CHAR_TOKEN_DELIM);
+      for ( size_t lane = 1; lane < 8; lane++ )
+      {
+         for ( size_t padding = 0; padding <= 8; padding += 8 )
+         {
+            char stream[24];
+            memset( stream, '1', lane );
+            stream[lane] = (char)ch;
+            stream[lane + 1] = '1';
+            memset( &stream[lane + 2], '\n', 1 + padding );
+            size_t len = lane + 3 + padding;
+
+            uint8_t ids[2];
+            enum LIN_PID_Result_E results[2];
+            size_t consumed = 0;
+            TEST_ASSERT_EQUAL_size_t( delimiter ? 2 : 1,
+                                      ParseIDs(stream, len, false, false, ids, results, 2, &consumed) );
+            // Through the token's delimiter at max_ids; through every delimiter short of it
+            TEST_ASSERT_EQUAL_size_t( delimiter ? (lane + 3) : len, consumed );
+         }
+      }
+   }
+}
+
+void test_ParseIDs_AgreesWithParseID_RandomStream(void)
+{
+   static char stream[MAX_STREAM_LEN];
+   static size_t starts[MAX_STREAM_IDS];
+   static size_t lens[MAX_STREAM_IDS];
+   static uint8_t ids[MAX_STREAM_IDS];
+   static enum LIN_PID_Result_E results[MAX_STREAM_IDS];
+
+   srand(0x504944);
+   size_t len = RandomTokenStream( stream, MAX_STREAM_IDS, starts, lens );
+
+   for ( int flag = 0; flag < 3; flag++ )
+   {
+      bool ishex = ( 1 == flag );
+      bool isdec = ( 2 == flag );
+      size_t consumed = 0;
+      TEST_ASSERT_EQUAL_size_t( MAX_STREAM_IDS,
+                                ParseIDs(stream, len, ishex, isdec, ids, results, MAX_STREAM_IDS, &consumed) );
+      // Up to and including the delimiter right after the last token
+      TEST_ASSERT_EQUAL_size_t( starts[MAX_STREAM_IDS - 1] + lens[MAX_STREAM_IDS - 1] + 1u, consumed );
+
+      size_t num_good = 0;
+      for ( size_t i = 0; i < MAX_STREAM_IDS; i++ )
+      {
+         char token[11] = {0};
+         memcpy( token, &stream[starts[i]], lens[i] );
+
+         uint8_t id = 0xFF;
+         enum LIN_PID_Result_E result = ParseID( token, ishex, isdec, &id );
+         TEST_ASSERT_EQUAL_INT_MESSAGE( result, results[i], token );
+         if ( GoodResult == result )
+         {
+            TEST_ASSERT_EQUAL_HEX8_MESSAGE( id, ids[i], token );
+            num_good++;
+         }
+      }
+
+      // Enough of the short tokens are IDs for the hash to have been tried
+      TEST_ASSERT_GREATER_THAN( 0, num_good );
+   }
+}
+
+void test_ParseIDs_SameResultsWhereverTheStreamIsCut(void)
+{
+   static char stream[MAX_STREAM_LEN];
+   static size_t starts[MAX_STREAM_IDS];
+   static size_t lens[MAX_STREAM_IDS];
+   static uint8_t whole_ids[MAX_STREAM_IDS];
+   static enum LIN_PID_Result_E whole_results[MAX_STREAM_IDS];
+   enum { NUM_OF_TOKENS = 40 };
+
+   srand(0x435554);
+   size_t len = RandomTokenStream( stream, NUM_OF_TOKENS, starts, lens );
+   size_t consumed = 0;
+   TEST_ASSERT_EQUAL_size_t( NUM_OF_TOKENS,
+                             ParseIDs(stream, len, false, false, whole_ids, whole_results, NUM_OF_TOKENS, &consumed) );
+
+   for ( size_t cut = 0; cut <= len; cut++ )
+   {
+      uint8_t ids[NUM_OF_TOKENS];
+      enum LIN_PID_Result_E results[NUM_OF_TOKENS];
+
+      // The first piece, then whatever it left over along with the rest
+      size_t num_ids = ParseIDs( stream, cut, false, false, ids, results, NUM_OF_TOKENS, &consumed );
+      TEST_ASSERT_LESS_OR_EQUAL( cut, consumed );
+      num_ids += ParseIDs( &stream[consumed], len - consumed, false, false,
+                           &ids[num_ids], &results[num_ids], NUM_OF_TOKENS - num_ids, &consumed );
+
+      TEST_ASSERT_EQUAL_size_t( NUM_OF_TOKENS, num_ids );
+      for ( size_t i = 0; i < NUM_OF_TOKENS; i++ )
+      {
+         TEST_ASSERT_EQUAL_INT( whole_results[i], results[i] );
+         if ( GoodResult == results[i] )
+         {
+            TEST_ASSERT_EQUAL_HEX8( whole_ids[i], ids[i] );
+         }
+      }
+   }
+}
+
+void test_ParseIDs_StopsAtMaxIDsAndUnfinishedTokens(void)
+{
+   static const char STREAM[] = "  0x3F,27\n3Fh\t\t40 27d x";
+   uint8_t ids[4] = { 0xFF, 0xFF, 0xFF, 0xFF };
+   enum LIN_PID_Result_E results[4];
+   size_t consumed = 0;
+
+   TEST_ASSERT_EQUAL_size_t( 2, ParseIDs(STREAM, strlen(STREAM), false, false, ids, results, 2, &consumed) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, results[0] );
+   TEST_ASSERT_EQUAL_HEX8( 0x3F, ids[0] );
+   TEST_ASSERT_EQUAL_INT( GoodResult, results[1] );
+   TEST_ASSERT_EQUAL_HEX8( 0x27, ids[1] );
+   TEST_ASSERT_EQUAL_size_t( strlen("  0x3F,27\n"), consumed );
+
+   // The trailing "x" has no delimiter after it yet, so it's left for later
+   const char * rest = &STREAM[consumed];
+   TEST_ASSERT_EQUAL_size_t( 3, ParseIDs(rest, strlen(rest), false, false, ids, results, 4, &consumed) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, results[0] );
+   TEST_ASSERT_EQUAL_HEX8( 0x3F, ids[0] );
+   TEST_ASSERT_EQUAL_INT( ID_OOR, results[1] );
+   TEST_ASSERT_EQUAL_INT( GoodResult, results[2] );
+   TEST_ASSERT_EQUAL_HEX8( 27, ids[2] );
+   TEST_ASSERT_EQUAL_STRING( "x", &rest[consumed] );
+
+   // Nothing but delimiters, or nothing at all
+   TEST_ASSERT_EQUAL_size_t( 0, ParseIDs(" ,\n", 3, false, false, ids, results, 4, &consumed) );
+   TEST_ASSERT_EQUAL_size_t( 3, consumed );
+   TEST_ASSERT_EQUAL_size_t( 0, ParseIDs("", 0, false, false, ids, results, 4, &consumed) );
+   TEST_ASSERT_EQUAL_size_t( 0, consumed );
+}
+
+/**
+ * @brief The other end of `cat ids.txt | lin_pid -q`, slow to get going.
+ */
+static void * WriteIDsLate( void * pipe_fd )
+{
+   static const char IDS[] = "0x3F 0x10,22d\n";
+   int fd = *(int *)pipe_fd;
+
+   struct timespec delay = { 0, 50L * 1000L * 1000L };
+   (void)nanosleep(&delay, NULL);
+   ssize_t written = write( fd, IDS, strlen(IDS) );
+   (void)close(fd);
+
+   return ( written == (ssize_t)strlen(IDS) ) ? pipe_fd : NULL;
+}
+
+void test_lin_pid_cli_PipedIDs_WriterNotStartedYet(void)
+{
+   // stdin from a real pipe that's still empty when the CLI starts, stdout to a file
+   int ids_pipe[2];
+   TEST_ASSERT_EQUAL_INT( 0, pipe(ids_pipe) );
+   FILE * out = tmpfile();
+   TEST_ASSERT_NOT_NULL( out );
+
+   (void)fflush(stdout);
+   int saved_stdin = dup(STDIN_FILENO);
+   int saved_stdout = dup(STDOUT_FILENO);
+   TEST_ASSERT_TRUE( (saved_stdin >= 0) && (saved_stdout >= 0) );
+   (void)dup2( ids_pipe[0], STDIN_FILENO );
+   (void)close( ids_pipe[0] );
+   (void)dup2( fileno(out), STDOUT_FILENO );
+
+   pthread_t writer;
+   TEST_ASSERT_EQUAL_INT( 0, pthread_create(&writer, NULL, WriteIDsLate, &ids_pipe[1]) );
+
+   char prog[] = "lin_pid";
+   char quiet[] = "-q";
+   char * argv[] = { prog, quiet, NULL };
+   int exit_status = lin_pid_cli( 2, argv );
+   (void)fflush(stdout);
+
+   void * wrote = NULL;
+   (void)pthread_join( writer, &wrote );
+   (void)dup2( saved_stdin, STDIN_FILENO );
+   (void)dup2( saved_stdout, STDOUT_FILENO );
+   (void)close( saved_stdin );
+   (void)close( saved_stdout );
+   clearerr(stdin);
+
+   // Every ID the writer sent, once it got round to it
+   char expected[64];
+   (void)snprintf( expected, sizeof(expected), "0x%02X\n0x%02X\n0x%02X\n",
+                   (unsigned int)ReferencePID(0x3F), (unsigned int)ReferencePID(0x10),
+                   (unsigned int)ReferencePID(22) );
+   char got[64] = {0};
+   rewind(out);
+   size_t got_len = fread( got, sizeof(char), sizeof(got) - 1, out );
+   (void)fclose(out);
+
+   TEST_ASSERT_NOT_NULL( wrote );
+   TEST_ASSERT_EQUAL_INT( EXIT_SUCCESS, exit_status );
+   TEST_ASSERT_EQUAL_size_t( strlen(expected), got_len );
+   TEST_ASSERT_EQUAL_STRING( expected, got );
+}
+
+void test_lin_pid_cli_PipedIDs_RejectsOtherFlags(void)
+{
+   static const char IDS[] = "0x3F\n";
+   int ids_pipe[2];
+   TEST_ASSERT_EQUAL_INT( 0, pipe(ids_pipe) );
+   TEST_ASSERT_EQUAL_INT( (ssize_t)strlen(IDS), write(ids_pipe[1], IDS, strlen(IDS)) );
+   (void)close( ids_pipe[1] );
+
+   int saved_stdin = dup(STDIN_FILENO);
+   TEST_ASSERT_TRUE( saved_stdin >= 0 );
+   (void)dup2( ids_pipe[0], STDIN_FILENO );
+   (void)close( ids_pipe[0] );
+
+   // Same as on the command line: --no-new-line is a valid flag, but not one
+   // piped IDs take
+   char prog[] = "lin_pid";
+   char no_new_line[] = "--no-new-line";
+   char * argv[] = { prog, no_new_line, NULL };
+   int exit_status = lin_pid_cli( 2, argv );
+
+   (void)dup2( saved_stdin, STDIN_FILENO );
+   (void)close( saved_stdin );
+   clearerr(stdin);
+
+   TEST_ASSERT_EQUAL_INT( EXIT_FAILURE, exit_status );
+}
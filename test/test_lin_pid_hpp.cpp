@@ -0,0 +1,257 @@
+/*!
+ * @file    test_lin_pid_hpp.cpp
+ * @brief   Test file for the header-only C++ API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_pid.hpp"
+
+/* Compile-Time Checks */
+
+static_assert( lin_pid::compute_pid(0x00) == 0x80 );
+static_assert( lin_pid::compute_pid(0x3C) == 0x3C );
+static_assert( lin_pid::compute_pid(0x40) == INVALID_PID );
+static_assert( lin_pid::pid_table[0x27] == 0xE7 );
+static_assert( lin_pid::validate_pid(0xE7) && !lin_pid::validate_pid(0x27) );
+static_assert( lin_pid::parse_id("0x27").id == 0x27 );
+static_assert( lin_pid::parse_id("27h").id == 0x27 );
+static_assert( lin_pid::parse_id("39d").id == 0x27 );
+static_assert( lin_pid::parse_id("39", false, true).id == 0x27 );
+static_assert( lin_pid::parse_id("40").result == ID_OOR );
+static_assert( lin_pid::parse_id("  ").result == WhiteSpaceOnlyIDArg );
+static_assert( lin_pid::parse_id("x3Fh").result == HexPrefixAndSuffixEncountered );
+
+constexpr std::array<std::uint8_t, 4> IDS = { 0x00, 0x01, 0x3F, 0x40 };
+constexpr std::array<std::uint8_t, 4> PIDS = []() constexpr
+{
+   std::array<std::uint8_t, 4> pids {};
+   (void)lin_pid::compute_pids( IDS, pids );
+   return pids;
+}();
+static_assert( (PIDS[0] == 0x80) && (PIDS[1] == 0xC1) && (PIDS[2] == 0xBF) && (PIDS[3] == INVALID_PID) );
+
+/* Local Macro Definitions */
+#define PARSE_ALPHABET           " 059aAfFxXhHdDz"
+#define MAX_PARSE_TOKEN_LEN      5u
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static size_t CompareParsers( std::string & token, size_t len );
+
+/* compute_pid / validate_pid */
+void test_compute_pid_MatchesComputePID(void);
+void test_validate_pid_OnlyTablePIDsPass(void);
+
+/* parse_id */
+void test_parse_id_AgreesWithParseID(void);
+void test_parse_id_StopsAtEndOfView(void);
+
+/* compute_pids / validate_pids */
+void test_compute_pids_Spans(void);
+void test_validate_pids_Spans(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* compute_pid / validate_pid */
+
+   RUN_TEST(test_compute_pid_MatchesComputePID);
+   RUN_TEST(test_validate_pid_OnlyTablePIDsPass);
+
+   /* parse_id */
+
+   RUN_TEST(test_parse_id_AgreesWithParseID);
+   RUN_TEST(test_parse_id_StopsAtEndOfView);
+
+   /* compute_pids / validate_pids */
+
+   RUN_TEST(test_compute_pids_Spans);
+   RUN_TEST(test_validate_pids_Spans);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/* Helpers */
+
+/**
+ * @brief Check parse_id() against ParseID() for token and every token that
+ *        extends it out to len characters of PARSE_ALPHABET, under no flag,
+ *        --hex and --dec.
+ *
+ * @return How many tokens both parsed as an ID.
+ */
+static size_t CompareParsers( std::string & token, size_t len )
+{
+   static const bool FLAGS[3][2] = { { false, false }, { true, false }, { false, true } };
+   size_t good = 0;
+
+   for ( const auto & flags : FLAGS )
+   {
+      uint8_t id = 0xFF;
+      enum LIN_PID_Result_E expected = ParseID(token.c_str(), flags[0], flags[1], &id);
+      lin_pid::parsed_id parsed = lin_pid::parse_id(token, flags[0], flags[1]);
+      TEST_ASSERT_EQUAL_INT_MESSAGE( expected, parsed.result, token.c_str() );
+      if ( GoodResult == expected )
+      {
+         TEST_ASSERT_EQUAL_HEX8_MESSAGE( id, parsed.id, token.c_str() );
+         good++;
+      }
+   }
+
+   if ( token.size() < len )
+   {
+      for ( const char * ch = PARSE_ALPHABET; *ch != '\0'; ch++ )
+      {
+         token.push_back(*ch);
+         good += CompareParsers( token, len );
+         token.pop_back();
+      }
+   }
+   return good;
+}
+
+/* compute_pid / validate_pid */
+/******************************************************************************/
+
+void test_compute_pid_MatchesComputePID(void)
+{
+   for ( unsigned int id = 0; id <= UINT8_MAX; id++ )
+   {
+      TEST_ASSERT_EQUAL_HEX8( ComputePID(static_cast<uint8_t>(id)),
+                              lin_pid::compute_pid(static_cast<uint8_t>(id)) );
+   }
+   for ( uint8_t id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      TEST_ASSERT_EQUAL_HEX8( ReferencePID(id), lin_pid::pid_table[id] );
+   }
+}
+
+void test_validate_pid_OnlyTablePIDsPass(void)
+{
+   size_t valid = 0;
+   for ( unsigned int pid = 0; pid <= UINT8_MAX; pid++ )
+   {
+      bool expected = ( lin_pid::pid_table[pid & MAX_ID_ALLOWED] == pid );
+      TEST_ASSERT_EQUAL_INT( expected, lin_pid::validate_pid(static_cast<uint8_t>(pid)) );
+      valid += expected ? 1u : 0u;
+   }
+   TEST_ASSERT_EQUAL_size_t( MAX_ID_ALLOWED + 1u, valid );
+}
+
+/* parse_id */
+/******************************************************************************/
+
+void test_parse_id_AgreesWithParseID(void)
+{
+   // Every token up to MAX_PARSE_TOKEN_LEN characters long, blanks, letters
+   // that are no digit at all and the CLI's length limit included
+   std::string token;
+   size_t good = CompareParsers( token, MAX_PARSE_TOKEN_LEN );
+   TEST_ASSERT_TRUE( good > 1000u );
+
+   // And every valid ID in every spelling the CLI prints
+   static const char HEX_DIGITS[] = "0123456789ABCDEF";
+   for ( unsigned int id = 0; id <= MAX_ID_ALLOWED; id++ )
+   {
+      const std::string hex = { HEX_DIGITS[id >> 4], HEX_DIGITS[id & 0xFu] };
+      const std::string dec = { static_cast<char>('0' + (id / 10u)), static_cast<char>('0' + (id % 10u)) };
+      for ( const std::string & str : { "0x" + hex, hex, hex + "h", "x" + hex, dec + "d", dec + "D" } )
+      {
+         lin_pid::parsed_id parsed = lin_pid::parse_id(str);
+         TEST_ASSERT_EQUAL_INT_MESSAGE( GoodResult, parsed.result, str.c_str() );
+         TEST_ASSERT_EQUAL_HEX8_MESSAGE( id, parsed.id, str.c_str() );
+      }
+   }
+}
+
+void test_parse_id_StopsAtEndOfView(void)
+{
+   const char buf[] = "27h99";
+   lin_pid::parsed_id parsed = lin_pid::parse_id( std::string_view(buf, 3) );
+   TEST_ASSERT_EQUAL_INT( GoodResult, parsed.result );
+   TEST_ASSERT_EQUAL_HEX8( 0x27, parsed.id );
+
+   parsed = lin_pid::parse_id( std::string_view(buf) );
+   TEST_ASSERT_EQUAL_INT( TooManyDigitsEntered, parsed.result );
+   TEST_ASSERT_EQUAL_HEX8( 0, parsed.id );
+
+   TEST_ASSERT_EQUAL_INT( WhiteSpaceOnlyIDArg, lin_pid::parse_id( std::string_view() ).result );
+   TEST_ASSERT_EQUAL_INT( HexDigitEncounteredUnderDecSetting_FirstDigit, lin_pid::parse_id("A", false, true).result );
+}
+
+/* compute_pids / validate_pids */
+/******************************************************************************/
+
+void test_compute_pids_Spans(void)
+{
+   std::array<uint8_t, UINT8_MAX + 1u> ids;
+   std::array<uint8_t, UINT8_MAX + 1u> pids;
+   for ( size_t i = 0; i < ids.size(); i++ )
+   {
+      ids[i] = static_cast<uint8_t>(i);
+   }
+   pids.fill(0xAA);
+
+   TEST_ASSERT_EQUAL_size_t( UINT8_MAX - MAX_ID_ALLOWED, lin_pid::compute_pids(ids, pids) );
+   for ( size_t i = 0; i < ids.size(); i++ )
+   {
+      TEST_ASSERT_EQUAL_HEX8( ComputePID(ids[i]), pids[i] );
+   }
+
+   // Only as much of the output as there is input gets written
+   pids.fill(0xAA);
+   TEST_ASSERT_EQUAL_size_t( 0, lin_pid::compute_pids( std::span(ids).first(4), pids ) );
+   TEST_ASSERT_EQUAL_HEX8( 0x03, pids[3] );
+   TEST_ASSERT_EQUAL_HEX8( 0xAA, pids[4] );
+   TEST_ASSERT_EQUAL_size_t( 0, lin_pid::compute_pids( std::span<const uint8_t>(), pids ) );
+}
+
+void test_validate_pids_Spans(void)
+{
+   std::array<uint8_t, 6> pids = { 0x80, 0x00, 0xC1, 0x41, 0xBF, 0x3C };
+   std::array<bool, 6> valid;
+   valid.fill(false);
+
+   TEST_ASSERT_EQUAL_size_t( 4, lin_pid::validate_pids(pids, valid) );
+   TEST_ASSERT_TRUE( valid[0] );
+   TEST_ASSERT_FALSE( valid[1] );
+   TEST_ASSERT_TRUE( valid[2] );
+   TEST_ASSERT_FALSE( valid[3] );
+   TEST_ASSERT_TRUE( valid[4] );
+   TEST_ASSERT_TRUE( valid[5] );
+
+   // The pointer and length form is what C++17 callers get
+   TEST_ASSERT_EQUAL_size_t( 1, lin_pid::validate_pids(pids.data() + 1, 3, valid.data()) );
+   TEST_ASSERT_FALSE( valid[0] );
+   TEST_ASSERT_TRUE( valid[1] );
+}
@@ -0,0 +1,303 @@
+/*!
+ * @file    test_lin_sched.c
+ * @brief   Test file for the schedule-table timing simulator
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_ldf.h"
+#include "lin_sched.h"
+
+/* Local Macro Definitions */
+#define SAMPLE_LDF_PATH       "test/sample.ldf"
+#define TOLERANCE_MS          1e-9
+#define NUM_OF_SWEEP_BAUDS    200u
+#define NUM_OF_SWEEP_TABLES   3u
+
+/* Local Variables */
+static struct LDF_Database_S DB;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Frame Times */
+void test_Sched_FrameTimeNominal_MatchesBitBudget(void);
+void test_Sched_FrameTimeMax_Is1p4TimesNominal(void);
+
+/* Sched_Simulate */
+void test_Sched_Simulate_SlotStartsAndPIDs(void);
+void test_Sched_Simulate_HeadroomAndOverruns(void);
+void test_Sched_Simulate_Utilization(void);
+void test_Sched_Simulate_UnknownFrameSizedAsEightBytes(void);
+void test_Sched_Simulate_EmptyTable(void);
+
+/* Sched_SlotsFromLDF */
+void test_Sched_SlotsFromLDF_SampleTable(void);
+
+/* Sched_Sweep */
+void test_Sched_Sweep_MatchesSequentialSimulation(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* Frame Times */
+
+   RUN_TEST(test_Sched_FrameTimeNominal_MatchesBitBudget);
+   RUN_TEST(test_Sched_FrameTimeMax_Is1p4TimesNominal);
+
+   /* Sched_Simulate */
+
+   RUN_TEST(test_Sched_Simulate_SlotStartsAndPIDs);
+   RUN_TEST(test_Sched_Simulate_HeadroomAndOverruns);
+   RUN_TEST(test_Sched_Simulate_Utilization);
+   RUN_TEST(test_Sched_Simulate_UnknownFrameSizedAsEightBytes);
+   RUN_TEST(test_Sched_Simulate_EmptyTable);
+
+   /* Sched_SlotsFromLDF */
+
+   RUN_TEST(test_Sched_SlotsFromLDF_SampleTable);
+
+   /* Sched_Sweep */
+
+   RUN_TEST(test_Sched_Sweep_MatchesSequentialSimulation);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset( &DB, 0, sizeof(DB) );
+}
+void tearDown(void)
+{
+   LDF_Free(&DB);
+}
+
+/* Frame Times */
+
+/******************************************************************************/
+
+void test_Sched_FrameTimeNominal_MatchesBitBudget(void)
+{
+   // 34 header bits + 10 * (8 + 1) response bits = 124 bits
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 124.0 * 1000.0 / 19200.0, Sched_FrameTimeNominalMs(8, 19200) );
+   // 34 + 10 * (1 + 1) = 54 bits
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 54.0 * 1000.0 / 9600.0, Sched_FrameTimeNominalMs(1, 9600) );
+   // Header and checksum alone
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 44.0 * 1000.0 / 20000.0, Sched_FrameTimeNominalMs(0, 20000) );
+}
+
+void test_Sched_FrameTimeMax_Is1p4TimesNominal(void)
+{
+   const uint32_t bauds[] = { 2400, 9600, 10417, 19200, 20000 };
+   for ( size_t i = 0; i < sizeof(bauds) / sizeof(bauds[0]); i++ )
+   {
+      for ( uint8_t len = 0; len <= LDF_MAX_FRAME_LEN; len++ )
+      {
+         TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS,
+                                    1.4 * Sched_FrameTimeNominalMs(len, bauds[i]),
+                                    Sched_FrameTimeMaxMs(len, bauds[i]) );
+      }
+   }
+}
+
+/* Sched_Simulate */
+
+/******************************************************************************/
+
+void test_Sched_Simulate_SlotStartsAndPIDs(void)
+{
+   const struct Sched_Slot_S slots[] =
+   {
+      { .slot_ms = 10.0, .id = 0x01, .length = 2 },
+      { .slot_ms = 15.0, .id = 0x27, .length = 4 },
+      { .slot_ms = 5.0,  .id = 0x3C, .length = 8 },
+   };
+   struct Sched_SlotTiming_S timings[3];
+   struct Sched_Summary_S summary;
+
+   Sched_Simulate(slots, 3, 19200, timings, &summary);
+
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 0.0, timings[0].start_ms );
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 10.0, timings[1].start_ms );
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 25.0, timings[2].start_ms );
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 30.0, summary.cycle_ms );
+
+   for ( size_t i = 0; i < 3; i++ )
+   {
+      TEST_ASSERT_EQUAL_HEX8( slots[i].id, timings[i].id );
+      TEST_ASSERT_EQUAL_HEX8( ComputePID(slots[i].id), timings[i].pid );
+      TEST_ASSERT_EQUAL_UINT8( slots[i].length, timings[i].length );
+      TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, Sched_FrameTimeNominalMs(slots[i].length, 19200), timings[i].nominal_ms );
+      TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, Sched_FrameTimeMaxMs(slots[i].length, 19200), timings[i].max_ms );
+   }
+   TEST_ASSERT_EQUAL_HEX8( 0xE7, timings[1].pid );
+}
+
+void test_Sched_Simulate_HeadroomAndOverruns(void)
+{
+   // An 8-byte frame at 19200 needs ~9.04 ms worst case
+   const struct Sched_Slot_S slots[] =
+   {
+      { .slot_ms = 10.0, .id = 0x30, .length = 8 },
+      { .slot_ms = 9.0,  .id = 0x31, .length = 8 },
+      { .slot_ms = 5.0,  .id = 0x01, .length = 1 },
+   };
+   struct Sched_SlotTiming_S timings[3];
+   struct Sched_Summary_S summary;
+
+   Sched_Simulate(slots, 3, 19200, timings, &summary);
+
+   double max8 = Sched_FrameTimeMaxMs(8, 19200);
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 10.0 - max8, timings[0].headroom_ms );
+   TEST_ASSERT_FALSE( timings[0].overrun );
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 9.0 - max8, timings[1].headroom_ms );
+   TEST_ASSERT_TRUE( timings[1].overrun );
+   TEST_ASSERT_FALSE( timings[2].overrun );
+
+   TEST_ASSERT_EQUAL_size_t( 1, summary.num_overruns );
+   TEST_ASSERT_EQUAL_size_t( 1, summary.worst_slot );
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 9.0 - max8, summary.min_headroom_ms );
+
+   // The same table at a faster baud rate fits
+   Sched_Simulate(slots, 3, 20000, NULL, &summary);
+   TEST_ASSERT_EQUAL_size_t( 0, summary.num_overruns );
+   TEST_ASSERT_EQUAL_UINT32( 20000, summary.baud_rate );
+}
+
+void test_Sched_Simulate_Utilization(void)
+{
+   const struct Sched_Slot_S slots[] =
+   {
+      { .slot_ms = 10.0, .id = 0x10, .length = 2 },
+      { .slot_ms = 10.0, .id = 0x20, .length = 4 },
+   };
+   struct Sched_Summary_S summary;
+
+   Sched_Simulate(slots, 2, 10000, NULL, &summary);
+
+   // At 10 kbit/s a bit is 0.1 ms: 64 bits + 84 bits = 14.8 ms busy of 20 ms
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 14.8, summary.busy_nominal_ms );
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 14.8 * 1.4, summary.busy_max_ms );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-12, 14.8 / 20.0, summary.utilization );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-12, (14.8 * 1.4) / 20.0, summary.worst_case_utilization );
+}
+
+void test_Sched_Simulate_UnknownFrameSizedAsEightBytes(void)
+{
+   const struct Sched_Slot_S slot = { .slot_ms = 20.0, .id = SCHED_NO_ID, .length = 0 };
+   struct Sched_SlotTiming_S timing;
+   struct Sched_Summary_S summary;
+
+   Sched_Simulate(&slot, 1, 19200, &timing, &summary);
+
+   TEST_ASSERT_EQUAL_UINT8( 8, timing.length );
+   TEST_ASSERT_EQUAL_HEX8( INVALID_PID, timing.pid );
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, Sched_FrameTimeMaxMs(8, 19200), timing.max_ms );
+}
+
+void test_Sched_Simulate_EmptyTable(void)
+{
+   struct Sched_Summary_S summary;
+
+   Sched_Simulate(NULL, 0, 19200, NULL, &summary);
+
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 0.0, summary.cycle_ms );
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 0.0, summary.utilization );
+   TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, 0.0, summary.min_headroom_ms );
+   TEST_ASSERT_EQUAL_size_t( 0, summary.num_overruns );
+}
+
+/* Sched_SlotsFromLDF */
+
+/******************************************************************************/
+
+void test_Sched_SlotsFromLDF_SampleTable(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_STRING( "Normal_Schedule", DB.schedule_tables[1].name );
+
+   struct Sched_Slot_S * slots = NULL;
+   size_t num_slots = 0;
+   TEST_ASSERT_EQUAL_INT( GoodResult, Sched_SlotsFromLDF(&DB, 1, &slots, &num_slots) );
+   TEST_ASSERT_EQUAL_size_t( 5, num_slots );
+
+   // CEM_Frm1, LSM_Frm2, RSM_Frm2, MotorStatus, Node_Status_Event
+   const uint8_t ids[] = { 0x01, 0x03, 0x05, 0x27, SCHED_NO_ID };
+   const uint8_t lens[] = { 1, 1, 1, 4, 8 };
+   const double delays[] = { 15.0, 15.0, 15.0, 10.0, 10.0 };
+   for ( size_t i = 0; i < num_slots; i++ )
+   {
+      TEST_ASSERT_EQUAL_HEX8( ids[i], slots[i].id );
+      TEST_ASSERT_EQUAL_UINT8( lens[i], slots[i].length );
+      TEST_ASSERT_DOUBLE_WITHIN( TOLERANCE_MS, delays[i], slots[i].slot_ms );
+   }
+
+   free(slots);
+}
+
+/* Sched_Sweep */
+
+/******************************************************************************/
+
+void test_Sched_Sweep_MatchesSequentialSimulation(void)
+{
+   TEST_ASSERT_EQUAL_INT( GoodResult, LDF_Load(SAMPLE_LDF_PATH, &DB) );
+   TEST_ASSERT_EQUAL_size_t( NUM_OF_SWEEP_TABLES, DB.num_schedule_tables );
+
+   struct Sched_Slot_S * slots[NUM_OF_SWEEP_TABLES];
+   size_t num_slots[NUM_OF_SWEEP_TABLES];
+   for ( size_t t = 0; t < NUM_OF_SWEEP_TABLES; t++ )
+   {
+      TEST_ASSERT_EQUAL_INT( GoodResult, Sched_SlotsFromLDF(&DB, t, &slots[t], &num_slots[t]) );
+   }
+
+   static struct Sched_Candidate_S candidates[NUM_OF_SWEEP_TABLES * NUM_OF_SWEEP_BAUDS];
+   static struct Sched_Summary_S expected[NUM_OF_SWEEP_TABLES * NUM_OF_SWEEP_BAUDS];
+   static struct Sched_Summary_S actual[NUM_OF_SWEEP_TABLES * NUM_OF_SWEEP_BAUDS];
+   size_t num_candidates = NUM_OF_SWEEP_TABLES * NUM_OF_SWEEP_BAUDS;
+   for ( size_t c = 0; c < num_candidates; c++ )
+   {
+      candidates[c].slots = slots[c % NUM_OF_SWEEP_TABLES];
+      candidates[c].num_slots = num_slots[c % NUM_OF_SWEEP_TABLES];
+      candidates[c].baud_rate = 1000u + (uint32_t)(100u * (c / NUM_OF_SWEEP_TABLES));
+      Sched_Simulate( candidates[c].slots, candidates[c].num_slots, candidates[c].baud_rate,
+                      NULL, &expected[c] );
+   }
+
+   // One per core, a single thread, an uneven split, and more threads than work
+   const unsigned int thread_counts[] = { 0, 1, 7, 1000 };
+   for ( size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++ )
+   {
+      memset( actual, 0xFF, sizeof(actual) );
+      Sched_Sweep(candidates, num_candidates, actual, thread_counts[t]);
+      TEST_ASSERT_EQUAL_MEMORY( expected, actual, sizeof(expected) );
+   }
+
+   // Fewer candidates than threads
+   memset( actual, 0xFF, sizeof(actual) );
+   Sched_Sweep(candidates, 2, actual, 8);
+   TEST_ASSERT_EQUAL_MEMORY( expected, actual, 2 * sizeof(expected[0]) );
+
+   for ( size_t t = 0; t < NUM_OF_SWEEP_TABLES; t++ )
+   {
+      free(slots[t]);
+   }
+}
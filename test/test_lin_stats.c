@@ -0,0 +1,380 @@
+/*!
+ * @file    test_lin_stats.c
+ * @brief   Test file for the per-ID capture statistics
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_cap.h"
+#include "lin_stats.h"
+
+/* Local Macro Definitions */
+#define NUM_OF_GENERATED_FRAMES  100000u   // Enough for several threads' worth of frames
+#define MAX_CAPTURE_LEN          (4u * 1024u * 1024u)
+
+/* Local Variables */
+static struct Stats_Summary_S Summary;
+static struct Stats_Summary_S OtherSummary;
+static uint8_t * Capture;
+static size_t CaptureLen;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static struct CAP_Frame_S FrameAt( uint8_t id, uint64_t timestamp_us );
+static struct CAP_Frame_S GeneratedFrame( uint32_t n );
+static void WriteGeneratedCapture( uint32_t num_frames );
+
+/* Stats_AddFrame */
+void test_Stats_AddFrame_PeriodsAndJitterBuckets(void);
+void test_Stats_AddFrame_ErrorsAndMissingResponses(void);
+void test_Stats_AddFrame_SkipsOutOfOrderFrames(void);
+
+/* Stats_Append / Stats_Combine */
+void test_Stats_Append_CountsPeriodAcrossTheJoin(void);
+void test_Stats_Append_OverlappingJoinIsOutOfOrder(void);
+void test_Stats_Combine_KeepsStreamsApart(void);
+
+/* Stats_ProcessCapture */
+void test_Stats_ProcessCapture_ThreadsDontChangeResult(void);
+void test_Stats_ProcessCapture_ReportsCutShortCapture(void);
+void test_Stats_ProcessCapture_ReportsBlockStartingBeforeLastOneEnds(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* Stats_AddFrame */
+
+   RUN_TEST(test_Stats_AddFrame_PeriodsAndJitterBuckets);
+   RUN_TEST(test_Stats_AddFrame_ErrorsAndMissingResponses);
+   RUN_TEST(test_Stats_AddFrame_SkipsOutOfOrderFrames);
+
+   /* Stats_Append / Stats_Combine */
+
+   RUN_TEST(test_Stats_Append_CountsPeriodAcrossTheJoin);
+   RUN_TEST(test_Stats_Append_OverlappingJoinIsOutOfOrder);
+   RUN_TEST(test_Stats_Combine_KeepsStreamsApart);
+
+   /* Stats_ProcessCapture */
+
+   RUN_TEST(test_Stats_ProcessCapture_ThreadsDontChangeResult);
+   RUN_TEST(test_Stats_ProcessCapture_ReportsCutShortCapture);
+   RUN_TEST(test_Stats_ProcessCapture_ReportsBlockStartingBeforeLastOneEnds);
+
+   free(Capture);
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   Stats_Init(&Summary);
+   Stats_Init(&OtherSummary);
+}
+
+void tearDown(void)
+{
+}
+
+/* Helpers */
+
+static struct CAP_Frame_S FrameAt( uint8_t id, uint64_t timestamp_us )
+{
+   struct CAP_Frame_S frame = { 0 };
+   frame.timestamp_us = timestamp_us;
+   frame.id = id;
+   frame.pid = ReferencePID(id);
+   frame.length = 2;
+   return frame;
+}
+
+/**
+ * @brief A bus where ID n % 8 goes out every 8 ms, give or take n % 5 us,
+ *        with the odd error and unanswered header.
+ */
+static struct CAP_Frame_S GeneratedFrame( uint32_t n )
+{
+   struct CAP_Frame_S frame = FrameAt( (uint8_t)(n % 8u), ((uint64_t)n * 1000u) + (n % 5u) );
+   frame.length = ( 0 == (n % 101u) ) ? 0u : 4u;
+   frame.flags = (uint8_t)( ((0 == (n % 37u)) ? CAP_FLAG_PID_ERROR : 0u) |
+                            ((0 == (n % 53u)) ? CAP_FLAG_CHECKSUM_ERROR : 0u) );
+   return frame;
+}
+
+static void WriteGeneratedCapture( uint32_t num_frames )
+{
+   if ( NULL == Capture )
+   {
+      Capture = malloc(MAX_CAPTURE_LEN);
+      TEST_ASSERT_NOT_NULL(Capture);
+   }
+
+   FILE * fp = tmpfile();
+   TEST_ASSERT_NOT_NULL(fp);
+   struct CAP_Writer_S writer;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterOpen(&writer, fp, 0) );
+   for ( uint32_t n = 0; n < num_frames; n++ )
+   {
+      struct CAP_Frame_S frame = GeneratedFrame(n);
+      TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriteFrame(&writer, &frame) );
+   }
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterClose(&writer) );
+
+   rewind(fp);
+   CaptureLen = fread(Capture, 1, MAX_CAPTURE_LEN, fp);
+   TEST_ASSERT_TRUE( CaptureLen < MAX_CAPTURE_LEN );
+   fclose(fp);
+}
+
+/* Stats_AddFrame */
+/******************************************************************************/
+
+void test_Stats_AddFrame_PeriodsAndJitterBuckets(void)
+{
+   // Periods 1000, 1000, 1001, 1004, 21004: jitters 0, 1, 3, 20000
+   const uint64_t timestamps[] = { 500, 1500, 2500, 3501, 4505, 25509 };
+   for ( size_t i = 0; i < (sizeof(timestamps) / sizeof(timestamps[0])); i++ )
+   {
+      struct CAP_Frame_S frame = FrameAt(0x22, timestamps[i]);
+      Stats_AddFrame(&Summary, &frame);
+   }
+
+   const struct Stats_ID_S * stats = &Summary.per_id[0x22];
+   TEST_ASSERT_EQUAL_UINT64( 6, Summary.frames );
+   TEST_ASSERT_EQUAL_UINT64( 6, stats->frames );
+   TEST_ASSERT_EQUAL_UINT64( 5, stats->periods );
+   TEST_ASSERT_EQUAL_UINT64( 1000, stats->period_min_us );
+   TEST_ASSERT_EQUAL_UINT64( 21004, stats->period_max_us );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 25009.0 / 5.0, Stats_MeanPeriodUs(stats) );
+
+   TEST_ASSERT_EQUAL_UINT64( 1, stats->jitter[0] );
+   TEST_ASSERT_EQUAL_UINT64( 1, stats->jitter[1] );    // [1, 2)
+   TEST_ASSERT_EQUAL_UINT64( 1, stats->jitter[2] );    // [2, 4)
+   TEST_ASSERT_EQUAL_UINT64( 1, stats->jitter[STATS_JITTER_BUCKETS - 1u] );
+   uint64_t total = 0;
+   for ( size_t b = 0; b < STATS_JITTER_BUCKETS; b++ )
+   {
+      total += stats->jitter[b];
+   }
+   TEST_ASSERT_EQUAL_UINT64( 4, total );
+
+   // Untouched IDs have nothing, and no period
+   TEST_ASSERT_EQUAL_UINT64( 0, Summary.per_id[0x21].frames );
+   TEST_ASSERT_DOUBLE_WITHIN( 1e-9, 0.0, Stats_MeanPeriodUs(&Summary.per_id[0x21]) );
+}
+
+void test_Stats_AddFrame_ErrorsAndMissingResponses(void)
+{
+   struct CAP_Frame_S frame = FrameAt(0x10, 0);
+   frame.flags = CAP_FLAG_PID_ERROR;
+   Stats_AddFrame(&Summary, &frame);
+   frame.timestamp_us = 10;
+   frame.flags = CAP_FLAG_CHECKSUM_ERROR;
+   Stats_AddFrame(&Summary, &frame);
+   frame.timestamp_us = 20;
+   frame.flags = 0;
+   frame.length = 0;
+   Stats_AddFrame(&Summary, &frame);
+
+   const struct Stats_ID_S * stats = &Summary.per_id[0x10];
+   TEST_ASSERT_EQUAL_UINT64( 3, stats->frames );
+   TEST_ASSERT_EQUAL_UINT64( 1, stats->parity_errors );
+   TEST_ASSERT_EQUAL_UINT64( 1, stats->checksum_errors );
+   TEST_ASSERT_EQUAL_UINT64( 1, stats->missing_responses );
+}
+
+void test_Stats_AddFrame_SkipsOutOfOrderFrames(void)
+{
+   const uint64_t timestamps[] = { 1000, 2000, 1500, 3000 };
+   for ( size_t i = 0; i < (sizeof(timestamps) / sizeof(timestamps[0])); i++ )
+   {
+      struct CAP_Frame_S frame = FrameAt(0x03, timestamps[i]);
+      frame.flags = CAP_FLAG_PID_ERROR;
+      Stats_AddFrame(&Summary, &frame);
+   }
+
+   const struct Stats_ID_S * stats = &Summary.per_id[0x03];
+   TEST_ASSERT_EQUAL_UINT64( 3, Summary.frames );
+   TEST_ASSERT_EQUAL_UINT64( 3, stats->frames );
+   TEST_ASSERT_EQUAL_UINT64( 1, stats->out_of_order );
+   TEST_ASSERT_EQUAL_UINT64( 3, stats->parity_errors );
+   TEST_ASSERT_EQUAL_UINT64( 2, stats->periods );
+   TEST_ASSERT_EQUAL_UINT64( 1000, stats->period_min_us );
+   TEST_ASSERT_EQUAL_UINT64( 1000, stats->period_max_us );
+   TEST_ASSERT_EQUAL_UINT64( 3000, stats->last_us );
+}
+
+/* Stats_Append / Stats_Combine */
+/******************************************************************************/
+
+void test_Stats_Append_CountsPeriodAcrossTheJoin(void)
+{
+   // One stream of 10 frames, and the same stream cut at every point
+   for ( uint32_t n = 0; n < 10u; n++ )
+   {
+      struct CAP_Frame_S frame = FrameAt(0x05, ((uint64_t)n * 1000u) + ((n * n) % 7u));
+      Stats_AddFrame(&Summary, &frame);
+   }
+
+   for ( uint32_t cut = 0; cut <= 10u; cut++ )
+   {
+      struct Stats_Summary_S later;
+      Stats_Init(&OtherSummary);
+      Stats_Init(&later);
+      for ( uint32_t n = 0; n < 10u; n++ )
+      {
+         struct CAP_Frame_S frame = FrameAt(0x05, ((uint64_t)n * 1000u) + ((n * n) % 7u));
+         Stats_AddFrame( (n < cut) ? &OtherSummary : &later, &frame );
+      }
+      Stats_Append(&OtherSummary, &later);
+      TEST_ASSERT_EQUAL_MEMORY( &Summary, &OtherSummary, sizeof(Summary) );
+   }
+}
+
+void test_Stats_Append_OverlappingJoinIsOutOfOrder(void)
+{
+   const uint64_t earlier[] = { 1000, 2000, 3000 };
+   const uint64_t later[] = { 2500, 4500 };
+   for ( size_t i = 0; i < (sizeof(earlier) / sizeof(earlier[0])); i++ )
+   {
+      struct CAP_Frame_S frame = FrameAt(0x07, earlier[i]);
+      Stats_AddFrame(&Summary, &frame);
+   }
+   for ( size_t i = 0; i < (sizeof(later) / sizeof(later[0])); i++ )
+   {
+      struct CAP_Frame_S frame = FrameAt(0x07, later[i]);
+      Stats_AddFrame(&OtherSummary, &frame);
+   }
+   Stats_Append(&Summary, &OtherSummary);
+
+   // Both sides' own periods count, but nothing across the join
+   const struct Stats_ID_S * stats = &Summary.per_id[0x07];
+   TEST_ASSERT_EQUAL_UINT64( 5, Summary.frames );
+   TEST_ASSERT_EQUAL_UINT64( 5, stats->frames );
+   TEST_ASSERT_EQUAL_UINT64( 1, stats->out_of_order );
+   TEST_ASSERT_EQUAL_UINT64( 3, stats->periods );
+   TEST_ASSERT_EQUAL_UINT64( 1000, stats->period_min_us );
+   TEST_ASSERT_EQUAL_UINT64( 2000, stats->period_max_us );
+   TEST_ASSERT_EQUAL_UINT64( 4500, stats->last_us );
+}
+
+void test_Stats_Combine_KeepsStreamsApart(void)
+{
+   struct CAP_Frame_S frame = FrameAt(0x05, 0);
+   Stats_AddFrame(&Summary, &frame);
+   frame.timestamp_us = 1000;
+   Stats_AddFrame(&Summary, &frame);
+
+   frame.timestamp_us = 5000;
+   Stats_AddFrame(&OtherSummary, &frame);
+   frame.timestamp_us = 7000;
+   Stats_AddFrame(&OtherSummary, &frame);
+
+   Stats_Combine(&Summary, &OtherSummary);
+   const struct Stats_ID_S * stats = &Summary.per_id[0x05];
+   TEST_ASSERT_EQUAL_UINT64( 4, Summary.frames );
+   TEST_ASSERT_EQUAL_UINT64( 4, stats->frames );
+   TEST_ASSERT_EQUAL_UINT64( 2, stats->periods );
+   TEST_ASSERT_EQUAL_UINT64( 1000, stats->period_min_us );
+   TEST_ASSERT_EQUAL_UINT64( 2000, stats->period_max_us );
+   TEST_ASSERT_EQUAL_UINT64( 0, stats->jitter[0] + stats->jitter[10] + stats->jitter[11] );
+}
+
+/* Stats_ProcessCapture */
+/******************************************************************************/
+
+void test_Stats_ProcessCapture_ThreadsDontChangeResult(void)
+{
+   WriteGeneratedCapture(NUM_OF_GENERATED_FRAMES);
+   struct CAP_Reader_S reader;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+
+   for ( uint32_t n = 0; n < NUM_OF_GENERATED_FRAMES; n++ )
+   {
+      struct CAP_Frame_S frame = GeneratedFrame(n);
+      Stats_AddFrame(&Summary, &frame);
+   }
+
+   const unsigned int thread_counts[] = { 1, 2, 5, 0 };
+   for ( size_t i = 0; i < (sizeof(thread_counts) / sizeof(thread_counts[0])); i++ )
+   {
+      Stats_Init(&OtherSummary);
+      TEST_ASSERT_EQUAL_INT( GoodResult, Stats_ProcessCapture(&reader, thread_counts[i], &OtherSummary) );
+      TEST_ASSERT_EQUAL_MEMORY( &Summary, &OtherSummary, sizeof(Summary) );
+   }
+
+   const struct Stats_ID_S * stats = &Summary.per_id[3];
+   TEST_ASSERT_EQUAL_UINT64( NUM_OF_GENERATED_FRAMES / 8u, stats->frames );
+   TEST_ASSERT_EQUAL_UINT64( 8000u - 2u, stats->period_min_us );   // (n + 8) % 5 is 3 more or 2 less than n % 5
+   TEST_ASSERT_EQUAL_UINT64( 8000u + 3u, stats->period_max_us );
+   CAP_Close(&reader);
+}
+
+void test_Stats_ProcessCapture_ReportsCutShortCapture(void)
+{
+   WriteGeneratedCapture(1000);
+   struct CAP_Reader_S reader;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+
+   reader.num_frames++;
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, Stats_ProcessCapture(&reader, 1, &Summary) );
+   TEST_ASSERT_EQUAL_UINT64( 1000, Summary.frames );
+   CAP_Close(&reader);
+}
+
+void test_Stats_ProcessCapture_ReportsBlockStartingBeforeLastOneEnds(void)
+{
+   WriteGeneratedCapture(NUM_OF_GENERATED_FRAMES);
+   struct CAP_Reader_S reader;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+
+   // Push the last frame of block 195 (ID 7, at 50175000 us) 20 ms late, past
+   // the next two frames with ID 7, which start the next block on time
+   const uint64_t late_frame = (196u * CAP_DEFAULT_BLOCK_FRAMES) - 1u;
+   struct CAP_Cursor_S cursor;
+   TEST_ASSERT_TRUE( CAP_SeekFrame(&reader, late_frame, &cursor) );
+   uint8_t * delta = &Capture[cursor.offset];
+   uint32_t late_us = (uint32_t)delta[0] | ((uint32_t)delta[1] << 8) | ((uint32_t)delta[2] << 16) |
+                      ((uint32_t)delta[3] << 24);
+   late_us += 20000u;
+   for ( size_t i = 0; i < 4u; i++ )
+   {
+      delta[i] = (uint8_t)(late_us >> (8u * i));
+   }
+
+   // The reader stops short rather than going back in time, whatever the split
+   const unsigned int thread_counts[] = { 1, 2, 5, 0 };
+   for ( size_t i = 0; i < (sizeof(thread_counts) / sizeof(thread_counts[0])); i++ )
+   {
+      Stats_Init(&Summary);
+      TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, Stats_ProcessCapture(&reader, thread_counts[i], &Summary) );
+      for ( size_t id = 0; id < CAP_NUM_OF_IDS; id++ )
+      {
+         TEST_ASSERT_EQUAL_UINT64( 0, Summary.per_id[id].out_of_order );
+      }
+   }
+
+   Stats_Init(&Summary);
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, Stats_ProcessCapture(&reader, 1, &Summary) );
+   TEST_ASSERT_EQUAL_UINT64( late_frame + 1u, Summary.frames );
+   CAP_Close(&reader);
+}
@@ -0,0 +1,472 @@
+/*!
+ * @file    test_lin_tp.c
+ * @brief   Test file for the diagnostic transport-layer reassembler
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_cap.h"
+#include "lin_tp.h"
+
+/* Local Macro Definitions */
+#define MAX_RECORDED             64u
+#define MAX_RECORDED_BYTES       256u
+#define MAX_CAPTURE_LEN          (256u * 1024u)
+#define NUM_OF_BUS_CYCLES        700u   // Room for MAX_RECORDED / 2 exchanges
+
+/* Datatypes */
+
+struct RecordedMessage_S
+{
+   struct TP_Message_S message;
+   uint8_t data[MAX_RECORDED_BYTES];
+};
+
+struct Recorder_S
+{
+   size_t num_messages;
+   size_t num_errors;
+   struct RecordedMessage_S messages[MAX_RECORDED];
+   struct TP_Error_S errors[MAX_RECORDED];
+};
+
+/* Local Variables */
+static struct TP_Reassembler_S TP;
+static struct Recorder_S Recorder;
+static struct Recorder_S OtherRecorder;
+static uint8_t Capture[MAX_CAPTURE_LEN];
+static size_t CaptureLen;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static void InitWith( struct Recorder_S * recorder, uint64_t timeout_us );
+static void RecordMessage( const struct TP_Message_S * message, void * ctx );
+static void RecordError( const struct TP_Error_S * error, void * ctx );
+static struct CAP_Frame_S DiagFrame( uint8_t id, uint64_t timestamp_us, uint8_t nad, uint8_t pci, const uint8_t * rest );
+static void FeedSegmented( uint8_t id, uint64_t timestamp_us, uint8_t nad, const uint8_t * message, uint16_t length );
+
+/* TP_Feed */
+void test_TP_Feed_SingleFrame(void);
+void test_TP_Feed_ReassemblesAcrossSequenceWrap(void);
+void test_TP_Feed_SequenceErrorDropsMessage(void);
+void test_TP_Feed_TimeoutAndIncompleteOnFlush(void);
+void test_TP_Feed_SessionsPerNADAndDirection(void);
+
+/* TP_ProcessCapture */
+void test_TP_ProcessCapture_PostingsMatchFullScan(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* TP_Feed */
+
+   RUN_TEST(test_TP_Feed_SingleFrame);
+   RUN_TEST(test_TP_Feed_ReassemblesAcrossSequenceWrap);
+   RUN_TEST(test_TP_Feed_SequenceErrorDropsMessage);
+   RUN_TEST(test_TP_Feed_TimeoutAndIncompleteOnFlush);
+   RUN_TEST(test_TP_Feed_SessionsPerNADAndDirection);
+
+   /* TP_ProcessCapture */
+
+   RUN_TEST(test_TP_ProcessCapture_PostingsMatchFullScan);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   InitWith(&Recorder, 0);
+}
+
+void tearDown(void)
+{
+}
+
+/* Helpers */
+
+static void InitWith( struct Recorder_S * recorder, uint64_t timeout_us )
+{
+   memset( recorder, 0, sizeof(*recorder) );
+   struct TP_Options_S options = { 0 };
+   options.timeout_us = timeout_us;
+   options.on_message = RecordMessage;
+   options.on_error = RecordError;
+   options.ctx = recorder;
+   TP_Init(&TP, &options);
+}
+
+static void RecordMessage( const struct TP_Message_S * message, void * ctx )
+{
+   struct Recorder_S * recorder = (struct Recorder_S *)ctx;
+   TEST_ASSERT_TRUE( recorder->num_messages < MAX_RECORDED );
+   TEST_ASSERT_TRUE( message->length <= MAX_RECORDED_BYTES );
+
+   struct RecordedMessage_S * recorded = &recorder->messages[recorder->num_messages++];
+   recorded->message = *message;
+   recorded->message.data = NULL;
+   memcpy( recorded->data, message->data, message->length );
+}
+
+static void RecordError( const struct TP_Error_S * error, void * ctx )
+{
+   struct Recorder_S * recorder = (struct Recorder_S *)ctx;
+   TEST_ASSERT_TRUE( recorder->num_errors < MAX_RECORDED );
+   recorder->errors[recorder->num_errors++] = *error;
+}
+
+/**
+ * @brief An 8-byte diagnostic frame. rest is the 6 bytes after the PCI, or
+ *        NULL for 0xFF padding.
+ */
+static struct CAP_Frame_S DiagFrame( uint8_t id, uint64_t timestamp_us, uint8_t nad, uint8_t pci, const uint8_t * rest )
+{
+   struct CAP_Frame_S frame = { 0 };
+   frame.timestamp_us = timestamp_us;
+   frame.id = id;
+   frame.pid = ReferencePID(id);
+   frame.length = TP_FRAME_LEN;
+   frame.data[0] = nad;
+   frame.data[1] = pci;
+   for ( size_t i = 0; i < 6u; i++ )
+   {
+      frame.data[2u + i] = ( rest != NULL ) ? rest[i] : 0xFFu;
+   }
+   return frame;
+}
+
+/**
+ * @brief Feed a message as a first frame and its consecutive frames, 10 ms apart.
+ */
+static void FeedSegmented( uint8_t id, uint64_t timestamp_us, uint8_t nad, const uint8_t * message, uint16_t length )
+{
+   uint8_t rest[6];
+   rest[0] = (uint8_t)(length & 0xFFu);
+   memcpy( &rest[1], message, TP_FF_DATA_LEN );
+   struct CAP_Frame_S frame = DiagFrame(id, timestamp_us, nad, (uint8_t)(0x10u | (length >> 8)), rest);
+   TP_Feed(&TP, &frame);
+
+   uint8_t sn = 1;
+   for ( uint16_t sent = TP_FF_DATA_LEN; sent < length; sent = (uint16_t)(sent + TP_CF_DATA_LEN) )
+   {
+      memset( rest, 0xFF, sizeof(rest) );
+      size_t left = (size_t)(length - sent);
+      memcpy( rest, &message[sent], (left < TP_CF_DATA_LEN) ? left : TP_CF_DATA_LEN );
+      timestamp_us += 10000u;
+      frame = DiagFrame(id, timestamp_us, nad, (uint8_t)(0x20u | sn), rest);
+      TP_Feed(&TP, &frame);
+      sn = (uint8_t)((sn + 1u) & 0x0Fu);
+   }
+}
+
+/* TP_Feed */
+/******************************************************************************/
+
+void test_TP_Feed_SingleFrame(void)
+{
+   const uint8_t read_by_id[6] = { 0xB2, 0x01, 0x02, 0xFF, 0xFF, 0xFF };
+   struct CAP_Frame_S frame = DiagFrame(TP_MASTER_REQUEST_ID, 1000, 0x0A, 0x03, read_by_id);
+   TP_Feed(&TP, &frame);
+
+   // Ignored: not diagnostic. Counted but not a message: go-to-sleep.
+   frame.id = 0x21;
+   TP_Feed(&TP, &frame);
+   frame = DiagFrame(TP_MASTER_REQUEST_ID, 2000, TP_NAD_SLEEP, 0xFF, NULL);
+   TP_Feed(&TP, &frame);
+
+   const uint8_t positive[6] = { 0xF2, 0x01, 0x02, 0x03, 0x04, 0xFF };
+   frame = DiagFrame(TP_SLAVE_RESPONSE_ID, 3000, 0x0A, 0x05, positive);
+   TP_Feed(&TP, &frame);
+
+   TEST_ASSERT_EQUAL_size_t( 2, Recorder.num_messages );
+   TEST_ASSERT_EQUAL_size_t( 0, Recorder.num_errors );
+   TEST_ASSERT_EQUAL_UINT64( 3, TP.stats.frames );
+   TEST_ASSERT_EQUAL_UINT64( 1, TP.stats.sleeps );
+   TEST_ASSERT_EQUAL_UINT64( 2, TP.stats.messages );
+
+   const struct RecordedMessage_S * request = &Recorder.messages[0];
+   TEST_ASSERT_EQUAL_UINT8( 0x0A, request->message.nad );
+   TEST_ASSERT_FALSE( request->message.response );
+   TEST_ASSERT_EQUAL_UINT16( 3, request->message.length );
+   TEST_ASSERT_EQUAL_UINT16( 1, request->message.frames );
+   TEST_ASSERT_EQUAL_UINT64( 1000, request->message.first_us );
+   TEST_ASSERT_EQUAL_MEMORY( read_by_id, request->data, 3 );
+
+   const struct RecordedMessage_S * response = &Recorder.messages[1];
+   TEST_ASSERT_TRUE( response->message.response );
+   TEST_ASSERT_EQUAL_UINT16( 5, response->message.length );
+   TEST_ASSERT_EQUAL_MEMORY( positive, response->data, 5 );
+
+   // Length 0 and length 7 can't be single frames, nor can a short frame be anything
+   frame = DiagFrame(TP_SLAVE_RESPONSE_ID, 4000, 0x0A, 0x00, NULL);
+   TP_Feed(&TP, &frame);
+   frame.data[1] = 0x07;
+   TP_Feed(&TP, &frame);
+   frame.length = 4;
+   frame.data[1] = 0x01;
+   TP_Feed(&TP, &frame);
+   TEST_ASSERT_EQUAL_UINT64( 3, TP.stats.errors[TP_ERROR_BAD_FRAME] );
+   TEST_ASSERT_EQUAL_size_t( 2, Recorder.num_messages );
+}
+
+void test_TP_Feed_ReassemblesAcrossSequenceWrap(void)
+{
+   // 5 + 6 * 19 = 119, so 20 consecutive frames and the SN goes 1..15, 0..4
+   uint8_t message[120];
+   for ( size_t i = 0; i < sizeof(message); i++ )
+   {
+      message[i] = (uint8_t)(i * 7u + 3u);
+   }
+   FeedSegmented(TP_SLAVE_RESPONSE_ID, 50000, 0x22, message, sizeof(message));
+
+   TEST_ASSERT_EQUAL_size_t( 0, Recorder.num_errors );
+   TEST_ASSERT_EQUAL_size_t( 1, Recorder.num_messages );
+   const struct RecordedMessage_S * recorded = &Recorder.messages[0];
+   TEST_ASSERT_EQUAL_UINT16( sizeof(message), recorded->message.length );
+   TEST_ASSERT_EQUAL_UINT16( 21, recorded->message.frames );
+   TEST_ASSERT_EQUAL_UINT64( 50000, recorded->message.first_us );
+   TEST_ASSERT_EQUAL_UINT64( 50000 + (20u * 10000u), recorded->message.last_us );
+   TEST_ASSERT_EQUAL_MEMORY( message, recorded->data, sizeof(message) );
+   TEST_ASSERT_EQUAL_UINT( 0, TP.num_active );
+
+   // Exactly one first frame's worth past a single frame still needs a consecutive frame
+   FeedSegmented(TP_MASTER_REQUEST_ID, 400000, 0x22, message, TP_MAX_SF_LEN + 1u);
+   TEST_ASSERT_EQUAL_size_t( 2, Recorder.num_messages );
+   TEST_ASSERT_EQUAL_UINT16( 2, Recorder.messages[1].message.frames );
+   TEST_ASSERT_EQUAL_MEMORY( message, Recorder.messages[1].data, TP_MAX_SF_LEN + 1u );
+}
+
+void test_TP_Feed_SequenceErrorDropsMessage(void)
+{
+   const uint8_t ff[6] = { 20, 0x22, 0xF1, 0x90, 0x00, 0x00 };
+   struct CAP_Frame_S frame = DiagFrame(TP_SLAVE_RESPONSE_ID, 0, 0x05, 0x10, ff);
+   TP_Feed(&TP, &frame);
+   frame = DiagFrame(TP_SLAVE_RESPONSE_ID, 10000, 0x05, 0x21, NULL);
+   TP_Feed(&TP, &frame);
+
+   // SN 2 lost; SN 3 gives it away and the message is dropped...
+   frame = DiagFrame(TP_SLAVE_RESPONSE_ID, 20000, 0x05, 0x23, NULL);
+   TP_Feed(&TP, &frame);
+   // ...so SN 4 belongs to nothing
+   frame = DiagFrame(TP_SLAVE_RESPONSE_ID, 30000, 0x05, 0x24, NULL);
+   TP_Feed(&TP, &frame);
+
+   TEST_ASSERT_EQUAL_size_t( 0, Recorder.num_messages );
+   TEST_ASSERT_EQUAL_size_t( 2, Recorder.num_errors );
+   const struct TP_Error_S * error = &Recorder.errors[0];
+   TEST_ASSERT_EQUAL_INT( TP_ERROR_SEQUENCE, error->kind );
+   TEST_ASSERT_EQUAL_UINT64( 20000, error->timestamp_us );
+   TEST_ASSERT_EQUAL_UINT8( 0x05, error->nad );
+   TEST_ASSERT_TRUE( error->response );
+   TEST_ASSERT_EQUAL_UINT8( 2, error->expected_sn );
+   TEST_ASSERT_EQUAL_UINT8( 3, error->sn );
+   TEST_ASSERT_EQUAL_UINT16( 11, error->received );
+   TEST_ASSERT_EQUAL_UINT16( 20, error->length );
+   TEST_ASSERT_EQUAL_INT( TP_ERROR_UNEXPECTED_CF, Recorder.errors[1].kind );
+
+   // A checksum error drops the frame, so the next one is out of sequence
+   frame = DiagFrame(TP_SLAVE_RESPONSE_ID, 40000, 0x05, 0x10, ff);
+   TP_Feed(&TP, &frame);
+   frame = DiagFrame(TP_SLAVE_RESPONSE_ID, 50000, 0x05, 0x21, NULL);
+   frame.flags = CAP_FLAG_CHECKSUM_ERROR;
+   TP_Feed(&TP, &frame);
+   frame = DiagFrame(TP_SLAVE_RESPONSE_ID, 60000, 0x05, 0x22, NULL);
+   TP_Feed(&TP, &frame);
+   TEST_ASSERT_EQUAL_UINT64( 1, TP.stats.dropped );
+   TEST_ASSERT_EQUAL_UINT64( 2, TP.stats.errors[TP_ERROR_SEQUENCE] );
+   TEST_ASSERT_EQUAL_STRING( "sequence error", TP_ErrorName(TP_ERROR_SEQUENCE) );
+}
+
+void test_TP_Feed_TimeoutAndIncompleteOnFlush(void)
+{
+   InitWith(&Recorder, 50000);
+
+   const uint8_t ff[6] = { 30, 0x22, 0xF1, 0x90, 0x00, 0x00 };
+   struct CAP_Frame_S frame = DiagFrame(TP_MASTER_REQUEST_ID, 100000, 0x07, 0x10, ff);
+   TP_Feed(&TP, &frame);
+
+   // Any diagnostic frame moves time on; this one comes 60 ms later
+   const uint8_t sf[6] = { 0xB2, 0x00, 0xFF, 0xFF, 0xFF, 0xFF };
+   frame = DiagFrame(TP_MASTER_REQUEST_ID, 160000, 0x08, 0x02, sf);
+   TP_Feed(&TP, &frame);
+   frame = DiagFrame(TP_MASTER_REQUEST_ID, 170000, 0x07, 0x21, NULL);
+   TP_Feed(&TP, &frame);
+
+   TEST_ASSERT_EQUAL_size_t( 1, Recorder.num_messages );
+   TEST_ASSERT_EQUAL_size_t( 2, Recorder.num_errors );
+   TEST_ASSERT_EQUAL_INT( TP_ERROR_TIMEOUT, Recorder.errors[0].kind );
+   TEST_ASSERT_EQUAL_UINT64( 150000, Recorder.errors[0].timestamp_us );
+   TEST_ASSERT_EQUAL_UINT8( 0x07, Recorder.errors[0].nad );
+   TEST_ASSERT_EQUAL_UINT16( TP_FF_DATA_LEN, Recorder.errors[0].received );
+   TEST_ASSERT_EQUAL_INT( TP_ERROR_UNEXPECTED_CF, Recorder.errors[1].kind );
+
+   // Whatever is still going at the end of the stream
+   frame = DiagFrame(TP_SLAVE_RESPONSE_ID, 200000, 0x07, 0x10, ff);
+   TP_Feed(&TP, &frame);
+   TEST_ASSERT_EQUAL_UINT( 1, TP.num_active );
+   TP_Flush(&TP);
+   TEST_ASSERT_EQUAL_UINT( 0, TP.num_active );
+   TEST_ASSERT_EQUAL_size_t( 3, Recorder.num_errors );
+   TEST_ASSERT_EQUAL_INT( TP_ERROR_INCOMPLETE, Recorder.errors[2].kind );
+   TEST_ASSERT_TRUE( Recorder.errors[2].response );
+   TEST_ASSERT_EQUAL_UINT64( 200000, Recorder.errors[2].timestamp_us );
+}
+
+void test_TP_Feed_SessionsPerNADAndDirection(void)
+{
+   const uint8_t ff[6] = { 8, 0x22, 0x01, 0x02, 0x03, 0x04 };
+   const uint8_t cf[6] = { 0x05, 0x06, 0x07, 0xFF, 0xFF, 0xFF };
+
+   // A request and a response for the same NAD, interleaved
+   struct CAP_Frame_S frame = DiagFrame(TP_MASTER_REQUEST_ID, 0, 0x01, 0x10, ff);
+   TP_Feed(&TP, &frame);
+   frame = DiagFrame(TP_SLAVE_RESPONSE_ID, 10, 0x01, 0x10, ff);
+   TP_Feed(&TP, &frame);
+   TEST_ASSERT_EQUAL_UINT( 2, TP.num_active );
+
+   // A new first frame for the request cuts off the old one
+   frame = DiagFrame(TP_MASTER_REQUEST_ID, 20, 0x01, 0x10, ff);
+   TP_Feed(&TP, &frame);
+   TEST_ASSERT_EQUAL_size_t( 1, Recorder.num_errors );
+   TEST_ASSERT_EQUAL_INT( TP_ERROR_INTERRUPTED, Recorder.errors[0].kind );
+   TEST_ASSERT_FALSE( Recorder.errors[0].response );
+   TEST_ASSERT_EQUAL_UINT( 2, TP.num_active );
+
+   frame = DiagFrame(TP_SLAVE_RESPONSE_ID, 30, 0x01, 0x21, cf);
+   TP_Feed(&TP, &frame);
+   frame = DiagFrame(TP_MASTER_REQUEST_ID, 40, 0x01, 0x21, cf);
+   TP_Feed(&TP, &frame);
+   TEST_ASSERT_EQUAL_size_t( 2, Recorder.num_messages );
+   TEST_ASSERT_TRUE( Recorder.messages[0].message.response );
+   TEST_ASSERT_FALSE( Recorder.messages[1].message.response );
+   TEST_ASSERT_EQUAL_UINT64( 20, Recorder.messages[1].message.first_us );
+   TEST_ASSERT_EQUAL_UINT( 0, TP.num_active );
+
+   // Fill every session; one more first frame has nowhere to go
+   for ( uint8_t nad = 1; nad <= TP_MAX_SESSIONS; nad++ )
+   {
+      frame = DiagFrame(TP_MASTER_REQUEST_ID, 100u + nad, nad, 0x10, ff);
+      TP_Feed(&TP, &frame);
+   }
+   TEST_ASSERT_EQUAL_UINT( TP_MAX_SESSIONS, TP.num_active );
+   frame = DiagFrame(TP_MASTER_REQUEST_ID, 200, 0x7E, 0x10, ff);
+   TP_Feed(&TP, &frame);
+   TEST_ASSERT_EQUAL_UINT64( 1, TP.stats.errors[TP_ERROR_NO_SESSION] );
+
+   // A single frame needs no session, and finishing one frees it for the next
+   const uint8_t sf[6] = { 0xB2, 0x00, 0xFF, 0xFF, 0xFF, 0xFF };
+   frame = DiagFrame(TP_MASTER_REQUEST_ID, 210, 0x7E, 0x02, sf);
+   TP_Feed(&TP, &frame);
+   frame = DiagFrame(TP_MASTER_REQUEST_ID, 220, 0x03, 0x21, cf);
+   TP_Feed(&TP, &frame);
+   frame = DiagFrame(TP_MASTER_REQUEST_ID, 230, 0x7E, 0x10, ff);
+   TP_Feed(&TP, &frame);
+   TEST_ASSERT_EQUAL_UINT64( 1, TP.stats.errors[TP_ERROR_NO_SESSION] );
+   TEST_ASSERT_EQUAL_UINT( TP_MAX_SESSIONS, TP.num_active );
+   TEST_ASSERT_EQUAL_size_t( 4, Recorder.num_messages );
+}
+
+/* TP_ProcessCapture */
+/******************************************************************************/
+
+void test_TP_ProcessCapture_PostingsMatchFullScan(void)
+{
+   uint8_t message[40];
+   for ( size_t i = 0; i < sizeof(message); i++ )
+   {
+      message[i] = (uint8_t)(0xA0u + i);
+   }
+
+   // Ordinary traffic every ms, with a segmented request and its segmented
+   // response now and then. Each response frame shares its request frame's
+   // timestamp, so only the record order can keep them straight.
+   FILE * fp = tmpfile();
+   TEST_ASSERT_NOT_NULL(fp);
+   struct CAP_Writer_S writer;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterOpen(&writer, fp, 64) );
+   for ( uint32_t cycle = 0; cycle < NUM_OF_BUS_CYCLES; cycle++ )
+   {
+      uint64_t t = (uint64_t)cycle * 1000u;
+      struct CAP_Frame_S frame = DiagFrame( (uint8_t)(cycle % 0x3Cu), t, 0, 0, NULL );
+      frame.length = 4;
+      TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriteFrame(&writer, &frame) );
+
+      uint32_t part = cycle % 20u;   // 0: FF, 1..6: CFs (40 = 5 + 6 * 6 - 1)
+      if ( (cycle / 20u) >= (MAX_RECORDED / 2u) )
+      {
+         continue;
+      }
+      uint8_t rest[6];
+      uint8_t pci;
+      if ( 0u == part )
+      {
+         rest[0] = sizeof(message);
+         memcpy( &rest[1], message, TP_FF_DATA_LEN );
+         pci = 0x10;
+      }
+      else if ( part <= 6u )
+      {
+         size_t at = TP_FF_DATA_LEN + ((part - 1u) * TP_CF_DATA_LEN);
+         memset( rest, 0xFF, sizeof(rest) );
+         memcpy( rest, &message[at], ((sizeof(message) - at) < TP_CF_DATA_LEN) ? (sizeof(message) - at) : TP_CF_DATA_LEN );
+         pci = (uint8_t)(0x20u | part);
+      }
+      else
+      {
+         continue;
+      }
+      frame = DiagFrame(TP_MASTER_REQUEST_ID, t, 0x11, pci, rest);
+      TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriteFrame(&writer, &frame) );
+      frame = DiagFrame(TP_SLAVE_RESPONSE_ID, t, 0x11, pci, rest);
+      TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriteFrame(&writer, &frame) );
+   }
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_WriterClose(&writer) );
+   rewind(fp);
+   CaptureLen = fread(Capture, 1, MAX_CAPTURE_LEN, fp);
+   TEST_ASSERT_TRUE( CaptureLen < MAX_CAPTURE_LEN );
+   fclose(fp);
+
+   struct CAP_Reader_S reader;
+   TEST_ASSERT_EQUAL_INT( GoodResult, CAP_OpenMemory(Capture, CaptureLen, &reader) );
+   TEST_ASSERT_NOT_NULL( reader.postings );
+   TEST_ASSERT_EQUAL_INT( GoodResult, TP_ProcessCapture(&TP, &reader) );
+   TEST_ASSERT_EQUAL_size_t( MAX_RECORDED, Recorder.num_messages );
+   TEST_ASSERT_EQUAL_size_t( 0, Recorder.num_errors );
+   TEST_ASSERT_FALSE( Recorder.messages[0].message.response );
+   TEST_ASSERT_TRUE( Recorder.messages[1].message.response );
+   TEST_ASSERT_EQUAL_MEMORY( message, Recorder.messages[1].data, sizeof(message) );
+   struct TP_Stats_S stats = TP.stats;
+
+   // The same capture without postings is scanned front to back instead
+   reader.postings = NULL;
+   InitWith(&OtherRecorder, 0);
+   TEST_ASSERT_EQUAL_INT( GoodResult, TP_ProcessCapture(&TP, &reader) );
+   TEST_ASSERT_EQUAL_MEMORY( &Recorder, &OtherRecorder, sizeof(Recorder) );
+   TEST_ASSERT_EQUAL_MEMORY( &stats, &TP.stats, sizeof(stats) );
+
+   // Cut short
+   InitWith(&OtherRecorder, 0);
+   reader.num_frames++;
+   TEST_ASSERT_EQUAL_INT( CaptureFileCorrupt, TP_ProcessCapture(&TP, &reader) );
+   CAP_Close(&reader);
+}
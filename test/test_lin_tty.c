@@ -0,0 +1,481 @@
+/*!
+ * @file    test_lin_tty.c
+ * @brief   Test file for the multi-channel tty capture
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Sun Oct 18, 2026
+ * @copyright MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include "unity.h"
+#include "lin_pid.h"
+#include "lin_log.h"
+#include "lin_cap.h"
+#include "lin_node.h"
+#include "lin_tty.h"
+
+/* Local Macro Definitions */
+#define MAX_RECORDED             64u
+#define MAX_BYTES                128u
+#define NUM_OF_PTYS              2u
+#define RING_TEST_CHUNKS         ( 50u * TTY_RING_CHUNKS )
+#define DRAIN_POLL_NS            1000000L
+#define DRAIN_POLLS              2000u
+#define START_NS                 1000000u
+
+/* Datatypes */
+
+struct Recorder_S
+{
+   size_t num_frames;
+   struct CAP_Frame_S frames[MAX_RECORDED];
+};
+
+struct Bytes_S
+{
+   size_t len;
+   uint8_t bytes[MAX_BYTES];
+};
+
+struct CaptureThread_S
+{
+   pthread_t thread;
+   struct TTY_Options_S options;
+   struct TTY_Stats_S stats[NUM_OF_PTYS];
+   enum LIN_PID_Result_E result;
+};
+
+/* Local Variables */
+static struct Recorder_S Recorder;
+static struct TTY_Decoder_S Decoder;
+static struct TTY_Ring_S Ring;
+
+/* Forward Function Declarations */
+
+/* Test Setup */
+void setUp(void);
+void tearDown(void);
+
+/* Helpers */
+static void RecordFrame( const struct CAP_Frame_S * frame, void * ctx );
+static void AddHeader( struct Bytes_S * out, uint8_t id, bool marked );
+static void AddResponse( struct Bytes_S * out, uint8_t id, const uint8_t * data, uint8_t length );
+static void AddByte( struct Bytes_S * out, uint8_t value );
+static void * CaptureThread( void * arg );
+static void * RingProducer( void * arg );
+static void WaitUntilRead( int fd );
+
+/* TTY_Decoder */
+void test_TTY_Decoder_MarkedBreaksAndEscapes(void);
+void test_TTY_Decoder_BareZeroBreaksOnPtys(void);
+void test_TTY_Decoder_DatesBytesWithinARead(void);
+
+/* TTY_Ring */
+void test_TTY_Ring_HandsOverInOrder(void);
+
+/* TTY_Capture */
+void test_TTY_Capture_TwoPtys(void);
+
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   /* TTY_Decoder */
+
+   RUN_TEST(test_TTY_Decoder_MarkedBreaksAndEscapes);
+   RUN_TEST(test_TTY_Decoder_BareZeroBreaksOnPtys);
+   RUN_TEST(test_TTY_Decoder_DatesBytesWithinARead);
+
+   /* TTY_Ring */
+
+   RUN_TEST(test_TTY_Ring_HandsOverInOrder);
+
+   /* TTY_Capture */
+
+   RUN_TEST(test_TTY_Capture_TwoPtys);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   memset( &Recorder, 0, sizeof(Recorder) );
+   TTY_DecoderInit(&Decoder, 1u, LOG_CHECKSUM_LIN2, START_NS);
+   Decoder.on_frame = RecordFrame;
+   Decoder.ctx = &Recorder;
+}
+
+void tearDown(void)
+{
+}
+
+/* Helpers */
+
+static void RecordFrame( const struct CAP_Frame_S * frame, void * ctx )
+{
+   struct Recorder_S * recorder = (struct Recorder_S *)ctx;
+   TEST_ASSERT_TRUE( recorder->num_frames < MAX_RECORDED );
+   recorder->frames[recorder->num_frames++] = *frame;
+}
+
+/**
+ * @brief Break, sync, and PID, the break marked as a UART would or bare as
+ *        on a pty.
+ */
+static void AddHeader( struct Bytes_S * out, uint8_t id, bool marked )
+{
+   if ( marked )
+   {
+      AddByte(out, 0xFF);
+      AddByte(out, 0x00);
+   }
+   AddByte(out, 0x00);
+   AddByte(out, 0x55);
+   AddByte(out, ComputePID(id));
+}
+
+static void AddResponse( struct Bytes_S * out, uint8_t id, const uint8_t * data, uint8_t length )
+{
+   uint8_t pid = ComputePID(id);
+   for ( uint8_t i = 0; i < length; i++ )
+   {
+      AddByte(out, data[i]);
+      if ( 0xFF == data[i] )
+      {
+         AddByte(out, 0xFF);     // PARMRK doubles a real 0xFF
+      }
+   }
+   uint8_t checksum = LOG_Checksum(pid, data, length, true);
+   AddByte(out, checksum);
+   if ( 0xFF == checksum )
+   {
+      AddByte(out, 0xFF);
+   }
+}
+
+static void AddByte( struct Bytes_S * out, uint8_t value )
+{
+   TEST_ASSERT_TRUE( out->len < MAX_BYTES );
+   out->bytes[out->len++] = value;
+}
+
+static void * CaptureThread( void * arg )
+{
+   struct CaptureThread_S * capture = (struct CaptureThread_S *)arg;
+   capture->result = TTY_Capture(&capture->options, capture->stats);
+   return NULL;
+}
+
+/**
+ * @brief Push RING_TEST_CHUNKS chunks, each holding its own sequence number,
+ *        spinning whenever the ring is full.
+ */
+static void * RingProducer( void * arg )
+{
+   struct TTY_Ring_S * ring = (struct TTY_Ring_S *)arg;
+   for ( uint32_t seq = 0; seq < RING_TEST_CHUNKS; )
+   {
+      struct TTY_Chunk_S * chunk = TTY_RingClaim(ring);
+      if ( NULL == chunk )
+      {
+         continue;
+      }
+      chunk->timestamp_ns = seq;
+      chunk->len = (uint16_t)sizeof(seq);
+      memcpy( chunk->bytes, &seq, sizeof(seq) );
+      TTY_RingPublish(ring);
+      seq++;
+   }
+   return NULL;
+}
+
+/**
+ * @brief Wait until the capture has read everything queued on fd.
+ */
+static void WaitUntilRead( int fd )
+{
+   int pending = 1;
+   for ( unsigned int i = 0; (pending > 0) && (i < DRAIN_POLLS); i++ )
+   {
+      struct timespec pause = { 0, DRAIN_POLL_NS };
+      (void)nanosleep(&pause, NULL);
+      TEST_ASSERT_EQUAL_INT( 0, ioctl(fd, FIONREAD, &pending) );
+   }
+   TEST_ASSERT_EQUAL_INT( 0, pending );
+}
+
+/* TTY_Decoder */
+/******************************************************************************/
+
+void test_TTY_Decoder_MarkedBreaksAndEscapes(void)
+{
+   struct Bytes_S in = { 0 };
+   const uint8_t data[4] = { 0x00, 0xFF, 0x55, 0x12 };
+   AddHeader(&in, 0x27, true);
+   AddResponse(&in, 0x27, data, sizeof(data));
+
+   // Once breaks are marked, 00 55 and a valid PID in a response are data
+   const uint8_t lookalike[3] = { 0x00, 0x55, ComputePID(0x01) };
+   AddHeader(&in, 0x02, true);
+   AddResponse(&in, 0x02, lookalike, sizeof(lookalike));
+
+   // A byte with a framing error, then a header with a bad PID
+   AddHeader(&in, 0x03, true);
+   AddByte(&in, 0x11);
+   AddByte(&in, 0xFF);
+   AddByte(&in, 0x00);
+   AddByte(&in, 0x22);
+   AddByte(&in, 0x33);
+   AddByte(&in, 0xFF);
+   AddByte(&in, 0x00);
+   AddByte(&in, 0x00);
+   AddByte(&in, 0x55);
+   AddByte(&in, (uint8_t)(ComputePID(0x04) ^ 0x80u));
+
+   // Fed a byte at a time, as a port with VMIN 1 might hand them over
+   for ( size_t i = 0; i < in.len; i++ )
+   {
+      TTY_DecoderFeed(&Decoder, &in.bytes[i], 1u, START_NS + (i * 1000u));
+   }
+   TTY_DecoderFlush(&Decoder);
+
+   TEST_ASSERT_EQUAL_size_t( 4, Recorder.num_frames );
+   TEST_ASSERT_EQUAL_UINT8( 0x27, Recorder.frames[0].id );
+   TEST_ASSERT_EQUAL_UINT8( 4, Recorder.frames[0].length );
+   TEST_ASSERT_EQUAL_UINT8_ARRAY( data, Recorder.frames[0].data, sizeof(data) );
+   TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[0].flags );
+   TEST_ASSERT_EQUAL_UINT8( 1, Recorder.frames[0].channel );
+
+   TEST_ASSERT_EQUAL_UINT8( 0x02, Recorder.frames[1].id );
+   TEST_ASSERT_EQUAL_UINT8( 3, Recorder.frames[1].length );
+   TEST_ASSERT_EQUAL_UINT8_ARRAY( lookalike, Recorder.frames[1].data, sizeof(lookalike) );
+   TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[1].flags );
+
+   TEST_ASSERT_EQUAL_UINT8( 0x03, Recorder.frames[2].id );
+   TEST_ASSERT_EQUAL_UINT8( CAP_FLAG_CHECKSUM_ERROR, Recorder.frames[2].flags );
+   TEST_ASSERT_EQUAL_UINT8( 0x04, Recorder.frames[3].id );
+   TEST_ASSERT_EQUAL_UINT8( CAP_FLAG_PID_ERROR, Recorder.frames[3].flags );
+
+   TEST_ASSERT_EQUAL_UINT64( in.len, Decoder.stats.bytes );
+   TEST_ASSERT_EQUAL_UINT64( 4, Decoder.stats.breaks );
+   TEST_ASSERT_EQUAL_UINT64( 4, Decoder.stats.frames );
+   TEST_ASSERT_EQUAL_UINT64( 1, Decoder.stats.framing_errors );
+   TEST_ASSERT_EQUAL_UINT64( 1, Decoder.stats.pid_errors );
+   TEST_ASSERT_EQUAL_UINT64( 1, Decoder.stats.checksum_errors );
+   TEST_ASSERT_EQUAL_UINT64( 0, Decoder.stats.sync_errors );
+   TEST_ASSERT_EQUAL_UINT64( 0, Decoder.stats.stray_bytes );
+}
+
+void test_TTY_Decoder_BareZeroBreaksOnPtys(void)
+{
+   struct Bytes_S in = { 0 };
+   AddByte(&in, 0x42);                          // Stray, before any break
+   AddByte(&in, 0x00);                          // A break with no sync after it
+   AddByte(&in, 0x66);
+
+   // Zeros in a response, even 00 55 without a valid PID after it, are data
+   const uint8_t zeros[5] = { 0x00, 0x00, 0x55, 0x00, 0x00 };
+   AddHeader(&in, 0x10, false);
+   AddResponse(&in, 0x10, zeros, sizeof(zeros));
+
+   // A response whose checksum comes out 0x00, right before the next header
+   const uint8_t sums_to_ff[1] = { 0xEE };
+   AddHeader(&in, 0x11, false);
+   AddResponse(&in, 0x11, sums_to_ff, sizeof(sums_to_ff));
+   AddHeader(&in, 0x12, false);                 // Nobody answers
+   AddHeader(&in, 0x13, false);
+
+   TTY_DecoderFeed(&Decoder, in.bytes, in.len, START_NS);
+   TTY_DecoderFlush(&Decoder);
+
+   TEST_ASSERT_EQUAL_size_t( 4, Recorder.num_frames );
+   TEST_ASSERT_EQUAL_UINT8( 0x10, Recorder.frames[0].id );
+   TEST_ASSERT_EQUAL_UINT8( sizeof(zeros), Recorder.frames[0].length );
+   TEST_ASSERT_EQUAL_UINT8_ARRAY( zeros, Recorder.frames[0].data, sizeof(zeros) );
+   TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[0].flags );
+
+   TEST_ASSERT_EQUAL_UINT8( 0x11, Recorder.frames[1].id );
+   TEST_ASSERT_EQUAL_UINT8( 1, Recorder.frames[1].length );
+   TEST_ASSERT_EQUAL_HEX8( 0xEE, Recorder.frames[1].data[0] );
+   TEST_ASSERT_EQUAL_HEX8( 0x00, Recorder.frames[1].checksum );
+   TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[1].flags );
+
+   TEST_ASSERT_EQUAL_UINT8( 0x12, Recorder.frames[2].id );
+   TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[2].length );
+   TEST_ASSERT_EQUAL_UINT8( 0x13, Recorder.frames[3].id );
+   TEST_ASSERT_EQUAL_UINT8( 0, Recorder.frames[3].length );
+
+   TEST_ASSERT_EQUAL_UINT64( 5, Decoder.stats.breaks );
+   TEST_ASSERT_EQUAL_UINT64( 1, Decoder.stats.sync_errors );
+   TEST_ASSERT_EQUAL_UINT64( 1, Decoder.stats.stray_bytes );
+   TEST_ASSERT_EQUAL_UINT64( 0, Decoder.stats.checksum_errors );
+}
+
+void test_TTY_Decoder_DatesBytesWithinARead(void)
+{
+   const uint64_t byte_ns = 520833u;           // 19200 baud
+   Decoder.byte_ns = byte_ns;
+
+   // Two headers in one read that returned 10 ms in
+   struct Bytes_S in = { 0 };
+   AddHeader(&in, 0x01, false);
+   AddHeader(&in, 0x02, false);
+   const uint64_t read_ns = START_NS + 10000000u;
+   TTY_DecoderFeed(&Decoder, in.bytes, in.len, read_ns);
+
+   // A later read that, going by the byte times, would start before the last
+   // one ended: the times are held back from going backwards
+   struct Bytes_S late = { 0 };
+   AddByte(&late, 0x33);
+   AddByte(&late, 0x33);
+   AddHeader(&late, 0x03, false);
+   TTY_DecoderFeed(&Decoder, late.bytes, late.len, read_ns + byte_ns);
+   TTY_DecoderFlush(&Decoder);
+
+   TEST_ASSERT_EQUAL_size_t( 3, Recorder.num_frames );
+   TEST_ASSERT_EQUAL_UINT64( (10000000u - (5u * byte_ns)) / 1000u, Recorder.frames[0].timestamp_us );
+   TEST_ASSERT_EQUAL_UINT64( (10000000u - (2u * byte_ns)) / 1000u, Recorder.frames[1].timestamp_us );
+   TEST_ASSERT_EQUAL_UINT64( 10000000u / 1000u, Recorder.frames[2].timestamp_us );
+   TEST_ASSERT_EQUAL_UINT8( 1, Recorder.frames[1].length );
+   TEST_ASSERT_EQUAL_UINT8( CAP_FLAG_CHECKSUM_ERROR, Recorder.frames[1].flags );
+}
+
+/* TTY_Ring */
+/******************************************************************************/
+
+void test_TTY_Ring_HandsOverInOrder(void)
+{
+   TTY_RingInit(&Ring);
+   TEST_ASSERT_NULL( TTY_RingPeek(&Ring) );
+
+   // Full after exactly TTY_RING_CHUNKS claims
+   for ( unsigned int i = 0; i < TTY_RING_CHUNKS; i++ )
+   {
+      TEST_ASSERT_NOT_NULL( TTY_RingClaim(&Ring) );
+      TTY_RingPublish(&Ring);
+   }
+   TEST_ASSERT_NULL( TTY_RingClaim(&Ring) );
+   TTY_RingRelease(&Ring);
+   TEST_ASSERT_NOT_NULL( TTY_RingClaim(&Ring) );
+
+   // Then a producer thread running many times around it
+   TTY_RingInit(&Ring);
+   pthread_t producer;
+   TEST_ASSERT_EQUAL_INT( 0, pthread_create(&producer, NULL, RingProducer, &Ring) );
+   uint32_t expected = 0;
+   bool in_order = true;
+   while ( expected < RING_TEST_CHUNKS )
+   {
+      const struct TTY_Chunk_S * chunk = TTY_RingPeek(&Ring);
+      if ( NULL == chunk )
+      {
+         continue;
+      }
+      uint32_t seq;
+      memcpy( &seq, chunk->bytes, sizeof(seq) );
+      in_order = in_order && ( seq == expected ) && ( chunk->timestamp_ns == expected );
+      TTY_RingRelease(&Ring);
+      expected++;
+   }
+   (void)pthread_join(producer, NULL);
+   TEST_ASSERT_TRUE( in_order );
+   TEST_ASSERT_NULL( TTY_RingPeek(&Ring) );
+}
+
+/* TTY_Capture */
+/******************************************************************************/
+
+void test_TTY_Capture_TwoPtys(void)
+{
+   int master_fds[NUM_OF_PTYS];
+   int held_fds[NUM_OF_PTYS];
+   int fds[NUM_OF_PTYS];
+   char path[NODE_MAX_PATH_LEN];
+   for ( size_t p = 0; p < NUM_OF_PTYS; p++ )
+   {
+      TEST_ASSERT_EQUAL_INT( GoodResult, Node_OpenPty(&master_fds[p], &held_fds[p], path) );
+      TEST_ASSERT_EQUAL_INT( GoodResult, TTY_Open(path, 0u, &fds[p]) );
+   }
+   TEST_ASSERT_EQUAL_INT( TTYBaudUnsupported, TTY_Open(path, 10400u, &fds[0]) );
+
+   static struct CaptureThread_S capture;
+   memset( &capture, 0, sizeof(capture) );
+   capture.options.fds = fds;
+   capture.options.num_channels = NUM_OF_PTYS;
+   capture.options.checksum = LOG_CHECKSUM_LIN2;
+   capture.options.on_frame = RecordFrame;
+   capture.options.ctx = &Recorder;
+   TEST_ASSERT_EQUAL_INT( 0, pthread_create(&capture.thread, NULL, CaptureThread, &capture) );
+
+   // Channel 1 gets three frames, channel 2 one
+   const uint8_t data[2] = { 0xFF, 0x01 };
+   for ( unsigned int i = 0; i < 3u; i++ )
+   {
+      struct Bytes_S out = { 0 };
+      AddHeader(&out, (uint8_t)(0x20u + i), false);
+      AddByte(&out, data[0]);                   // No PARMRK on this side to double it
+      AddByte(&out, data[1]);
+      AddByte(&out, LOG_Checksum(ComputePID((uint8_t)(0x20u + i)), data, sizeof(data), true));
+      TEST_ASSERT_EQUAL_INT( (int)out.len, (int)write(master_fds[0], out.bytes, out.len) );
+   }
+   struct Bytes_S out = { 0 };
+   AddHeader(&out, 0x30, false);
+   TEST_ASSERT_EQUAL_INT( (int)out.len, (int)write(master_fds[1], out.bytes, out.len) );
+
+   for ( size_t p = 0; p < NUM_OF_PTYS; p++ )
+   {
+      WaitUntilRead(fds[p]);
+      Node_ClosePort(master_fds[p]);
+   }
+   (void)pthread_join(capture.thread, NULL);
+   for ( size_t p = 0; p < NUM_OF_PTYS; p++ )
+   {
+      TTY_Close(fds[p]);
+      Node_ClosePort(held_fds[p]);
+   }
+
+   TEST_ASSERT_EQUAL_INT( GoodResult, capture.result );
+   TEST_ASSERT_EQUAL_size_t( 4, Recorder.num_frames );
+   unsigned int on_channel[NUM_OF_PTYS + 1u] = { 0 };
+   for ( size_t f = 0; f < Recorder.num_frames; f++ )
+   {
+      const struct CAP_Frame_S * frame = &Recorder.frames[f];
+      TEST_ASSERT_EQUAL_UINT8( 0, frame->flags );
+      TEST_ASSERT_TRUE( (frame->channel >= 1u) && (frame->channel <= NUM_OF_PTYS) );
+      on_channel[frame->channel]++;
+      if ( 1u == frame->channel )
+      {
+         TEST_ASSERT_EQUAL_UINT8( 2, frame->length );
+         TEST_ASSERT_EQUAL_UINT8_ARRAY( data, frame->data, sizeof(data) );
+      }
+   }
+   TEST_ASSERT_EQUAL_UINT( 3, on_channel[1] );
+   TEST_ASSERT_EQUAL_UINT( 1, on_channel[2] );
+
+   TEST_ASSERT_EQUAL_UINT64( 3, capture.stats[0].frames );
+   TEST_ASSERT_EQUAL_UINT64( 1, capture.stats[1].frames );
+   TEST_ASSERT_EQUAL_UINT64( 3u * 7u, capture.stats[0].bytes );   // The 0xFFs come doubled
+   for ( size_t p = 0; p < NUM_OF_PTYS; p++ )
+   {
+      TEST_ASSERT_EQUAL_UINT64( 0, capture.stats[p].dropped_bytes );
+      TEST_ASSERT_EQUAL_UINT64( 0, capture.stats[p].checksum_errors );
+      TEST_ASSERT_EQUAL_UINT64( 0, capture.stats[p].stray_bytes );
+   }
+}